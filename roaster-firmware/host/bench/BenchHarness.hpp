@@ -0,0 +1,116 @@
+#ifndef HOST_BENCH_HARNESS_HPP
+#define HOST_BENCH_HARNESS_HPP
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+// Tiny wall-clock benchmark harness for the host build. Each case runs a
+// warm-up pass and then several timed passes; the fastest pass is reported so
+// scheduler noise on a shared CI runner does not inflate the numbers.
+namespace HostBench
+{
+struct Options
+{
+  double scale = 1.0;
+  bool csv = false;
+};
+
+struct Result
+{
+  const char *name;
+  uint64_t calls;
+  double nsPerCall;
+};
+
+inline Options parseArgs(int argc, char **argv)
+{
+  Options options;
+  for (int index = 1; index < argc; index++)
+  {
+    if (strcmp(argv[index], "--quick") == 0)
+    {
+      options.scale = 0.01;
+    }
+    else if (strcmp(argv[index], "--csv") == 0)
+    {
+      options.csv = true;
+    }
+    else if (strcmp(argv[index], "--scale") == 0 && index + 1 < argc)
+    {
+      options.scale = atof(argv[++index]);
+    }
+  }
+  if (options.scale <= 0.0)
+  {
+    options.scale = 1.0;
+  }
+  return options;
+}
+
+template <typename T>
+inline void doNotOptimize(const T &value)
+{
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+template <typename Fn>
+Result measure(const char *name, const Options &options, uint64_t baseCalls, Fn &&fn)
+{
+  static constexpr int TIMED_PASSES = 5;
+
+  uint64_t calls = static_cast<uint64_t>(static_cast<double>(baseCalls) * options.scale);
+  if (calls == 0)
+  {
+    calls = 1;
+  }
+
+  for (uint64_t call = 0; call < calls / 10 + 1; call++)
+  {
+    fn(call);
+  }
+
+  double bestNs = 0.0;
+  for (int pass = 0; pass < TIMED_PASSES; pass++)
+  {
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t call = 0; call < calls; call++)
+    {
+      fn(call);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    if (pass == 0 || ns < bestNs)
+    {
+      bestNs = ns;
+    }
+  }
+
+  return {name, calls, bestNs / static_cast<double>(calls)};
+}
+
+inline void report(const std::vector<Result> &results, const Options &options)
+{
+  if (options.csv)
+  {
+    printf("benchmark,ns_per_call,calls\n");
+    for (const Result &result : results)
+    {
+      printf("%s,%.2f,%llu\n", result.name, result.nsPerCall, static_cast<unsigned long long>(result.calls));
+    }
+    return;
+  }
+
+  printf("%-48s %14s %12s\n", "benchmark", "ns/call", "calls");
+  for (const Result &result : results)
+  {
+    printf("%-48s %14.2f %12llu\n", result.name, result.nsPerCall, static_cast<unsigned long long>(result.calls));
+  }
+}
+} // namespace HostBench
+
+#endif // HOST_BENCH_HARNESS_HPP
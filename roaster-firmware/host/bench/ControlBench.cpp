@@ -0,0 +1,210 @@
+// Host benchmarks for the 250 ms control tick: PID step (double reference,
+// float and Q16.16), gain-schedule decision, MPC solve and horizon setup,
+// profile setpoint lookup, and the step-response FOPDT fit that runs when
+// calibration completes.
+//
+// The host has a double-precision FPU, so the PID variants land close together
+// here; on the ESP32-S3 double runs in software and float/Q16.16 do not.
+//
+//   ./roaster-control-bench            full run
+//   ./roaster-control-bench --quick    1% of the calls (ctest smoke run)
+//   ./roaster-control-bench --csv      machine-readable output for tracking
+
+#include <Arduino.h>
+
+#include "../../src/control/PIDController.hpp"
+#include "../../src/control/PIDRuntimeController.hpp"
+#include "../../src/control/StepResponseTuner.hpp"
+#include "../../src/profiles/RoastProfile.hpp"
+#include "BenchHarness.hpp"
+
+struct StepResponseTunerHostAccess
+{
+  // Fills the active sample buffer with a noiseless FOPDT step response so the
+  // least-squares fit has a realistic 500-sample record to chew on.
+  static void loadStepResponse(StepResponseTuner &tuner, double baseline, double deltaT,
+                               double tau, double theta)
+  {
+    tuner.baselineTemp = baseline;
+    tuner.noiseStdDev = 0.05;
+    tuner.activeBandIndex = 0;
+    tuner.bandConfigs[0] = {80.0, 50.0, 175.0, 120.0, 225.0};
+    tuner.activeSampleCount = StepResponseTuner::MAX_SAMPLES;
+    for (uint16_t i = 0; i < StepResponseTuner::MAX_SAMPLES; i++)
+    {
+      double t = static_cast<double>(i) * 0.25;
+      double temp = t <= theta ? baseline : baseline + deltaT * (1.0 - exp(-(t - theta) / tau));
+      StepResponseTuner::TraceSample &sample = tuner.samples[i];
+      sample.elapsedMs = static_cast<uint32_t>(i) * 250U;
+      sample.actualTempF = static_cast<float>(temp);
+      sample.setpointTempF = static_cast<float>(baseline + deltaT);
+      sample.heaterOutput = 130.0f;
+    }
+  }
+
+  static bool fitLeastSquares(StepResponseTuner &tuner, double deltaT, double finalTemp)
+  {
+    StepResponseTuner::BandResult result;
+    tuner.fitFOPDT_LeastSquares(result, tuner.bandConfigs[0], deltaT, finalTemp);
+    return result.model.valid;
+  }
+};
+
+static Calibration::CharacterizationSummary makeBandSummary()
+{
+  Calibration::CharacterizationSummary summary = {};
+  const double targets[Calibration::BAND_COUNT] = {225.0, 290.0, 380.0};
+  for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++)
+  {
+    Calibration::BandCharacterization &band = summary.bands[index];
+    band.valid = true;
+    band.targetTemp = targets[index];
+    band.minTemp = targets[index] - 45.0;
+    band.maxTemp = targets[index] + 45.0;
+    band.drift = -0.08;
+    band.coolingCoeff = 0.010 + 0.001 * index;
+    band.heaterCoeff = 0.0050 - 0.0004 * index;
+    band.deadTime = 6.0 + 2.0 * index;
+    band.kp = 7.0 + 2.0 * index;
+    band.ki = 0.7;
+    band.kd = 2.0;
+  }
+  summary.validBandCount = Calibration::BAND_COUNT;
+  return summary;
+}
+
+template <typename Controller>
+static HostBench::Result measurePID(const char *name, const HostBench::Options &options)
+{
+  double input = 200.0;
+  double setpoint = 210.0;
+  double output = 0.0;
+  Controller pid(&input, &setpoint, &output, 0, 255, 8.0, 0.46, 2.0);
+  pid.setTimeStep(250);
+  HostClock::setMillis(0);
+  pid.run();
+  return HostBench::measure(name, options, 5000000, [&](uint64_t call) {
+    HostClock::advanceMillis(250);
+    input = 200.0 + static_cast<double>(call & 63) * 0.125;
+    pid.run();
+    HostBench::doNotOptimize(output);
+  });
+}
+
+static void buildRoastProfile(RoastProfile &profile)
+{
+  profile.clearSetpoints();
+  profile.addSetpoint(60000, 250, 90);
+  profile.addSetpoint(120000, 300, 85);
+  profile.addSetpoint(180000, 330, 80);
+  profile.addSetpoint(240000, 355, 75);
+  profile.addSetpoint(300000, 375, 70);
+  profile.addSetpoint(360000, 390, 70);
+  profile.addSetpoint(420000, 405, 65);
+  profile.addSetpoint(480000, 418, 65);
+  profile.addSetpoint(600000, 430, 60);
+  profile.startProfile(75, 0);
+}
+
+int main(int argc, char **argv)
+{
+  HostBench::Options options = HostBench::parseArgs(argc, argv);
+  std::vector<HostBench::Result> results;
+
+  results.push_back(measurePID<PIDController>("PIDController::run", options));
+  results.push_back(measurePID<FloatPIDController>("FloatPIDController::run", options));
+  results.push_back(measurePID<FixedPIDController>("FixedPIDController::run", options));
+
+  {
+    PIDRuntimeController controller;
+    controller.setFallbackGains(8.0, 0.46, 0.0);
+    controller.loadFromSummary(makeBandSummary());
+    results.push_back(HostBench::measure("PIDRuntimeController::decide", options, 5000000, [&](uint64_t call) {
+      unsigned long now = static_cast<unsigned long>(call) * 250UL;
+      double setpoint = 180.0 + static_cast<double>(call % 960) * 0.25;
+      PIDRuntimeController::ControlDecision decision = controller.decide(now, setpoint - 3.0, setpoint, 90.0);
+      HostBench::doNotOptimize(decision);
+    }));
+  }
+
+  {
+    PIDRuntimeController controller;
+    controller.setFallbackGains(8.0, 0.46, 0.0);
+    controller.loadFromSummary(makeBandSummary());
+    ModelPredictiveController &mpc = controller.getPredictiveController();
+    double reference[ModelPredictiveController::PREDICTION_POINTS];
+    results.push_back(HostBench::measure("ModelPredictiveController::solve", options, 1000000, [&](uint64_t call) {
+      double setpoint = 240.0 + static_cast<double>(call % 960) * 0.25;
+      for (uint8_t point = 0; point < ModelPredictiveController::PREDICTION_POINTS; point++)
+      {
+        reference[point] = setpoint + point;
+      }
+      double command = mpc.solve(1, setpoint - 2.0 + static_cast<double>(call & 7) * 0.25, 90.0, reference);
+      mpc.recordCommand(command);
+      HostBench::doNotOptimize(command);
+    }));
+    results.push_back(HostBench::measure("ModelPredictiveController::configureBand", options, 100000, [&](uint64_t call) {
+      bool valid = mpc.configureBand(static_cast<uint8_t>(call % Calibration::BAND_COUNT), -0.08, 0.011, 0.0048, 8.0);
+      HostBench::doNotOptimize(valid);
+    }));
+  }
+
+  {
+    PIDRuntimeController controller;
+    controller.loadFromSummary(makeBandSummary());
+    SmithPredictor &smith = controller.getSmithPredictor();
+    results.push_back(HostBench::measure("SmithPredictor::recordCommand", options, 5000000, [&](uint64_t call) {
+      smith.recordCommand(1, static_cast<double>((call * 37) & 255));
+      double correction = smith.getCorrection();
+      HostBench::doNotOptimize(correction);
+    }));
+  }
+
+  {
+    static RoastProfile profile;
+    buildRoastProfile(profile);
+    results.push_back(HostBench::measure("RoastProfile::getTargetTemp", options, 10000000, [&](uint64_t call) {
+      uint32_t tick = static_cast<uint32_t>((call % 2400) * 250U);
+      uint32_t target = profile.getTargetTemp(tick);
+      HostBench::doNotOptimize(target);
+    }));
+    results.push_back(HostBench::measure("RoastProfile::getTargetFanSpeed", options, 10000000, [&](uint64_t call) {
+      uint32_t tick = static_cast<uint32_t>((call % 2400) * 250U);
+      uint32_t target = profile.getTargetFanSpeed(tick);
+      HostBench::doNotOptimize(target);
+    }));
+    // plotProfileOnDisplay() walks the profile backwards over 480 columns.
+    results.push_back(HostBench::measure("RoastProfile::getTargetTempAtTime (plot)", options, 10000000, [&](uint64_t call) {
+      uint32_t column = static_cast<uint32_t>(call % 480);
+      uint32_t target = profile.getTargetTempAtTime((600000U * (479U - column)) / 480U);
+      HostBench::doNotOptimize(target);
+    }));
+    results.push_back(HostBench::measure("RoastProfile::getTargetTempAtTime (random)", options, 10000000, [&](uint64_t call) {
+      uint32_t target = profile.getTargetTempAtTime(static_cast<uint32_t>((call * 2654435761ULL) % 660000ULL));
+      HostBench::doNotOptimize(target);
+    }));
+  }
+
+  {
+    static RoastProfile profile;
+    buildRoastProfile(profile);
+    profile.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+    results.push_back(HostBench::measure("RoastProfile::getTargetTemp (pchip)", options, 10000000, [&](uint64_t call) {
+      uint32_t tick = static_cast<uint32_t>((call % 2400) * 250U);
+      uint32_t target = profile.getTargetTemp(tick);
+      HostBench::doNotOptimize(target);
+    }));
+  }
+
+  {
+    static StepResponseTuner tuner;
+    StepResponseTunerHostAccess::loadStepResponse(tuner, 175.0, 40.0, 35.0, 4.0);
+    results.push_back(HostBench::measure("StepResponseTuner::fitFOPDT_LeastSquares", options, 2000, [&](uint64_t) {
+      bool valid = StepResponseTunerHostAccess::fitLeastSquares(tuner, 40.0, 215.0);
+      HostBench::doNotOptimize(valid);
+    }));
+  }
+
+  HostBench::report(results, options);
+  return 0;
+}
@@ -0,0 +1,140 @@
+// Host benchmarks for the once-a-second state broadcast: writing the
+// /api/state payload into a fixed buffer, and the full broadcast path of
+// taking the shared frame, writing it and handing it to two clients.
+//
+// Every operator new is counted while the cases run. The broadcast path
+// should make none, so the run fails if it does.
+//
+//   ./roaster-state-bench            full run
+//   ./roaster-state-bench --quick    1% of the calls (ctest smoke run)
+//   ./roaster-state-bench --csv      machine-readable output for tracking
+
+#include <Arduino.h>
+
+#include <new>
+
+#include "../../src/network/SystemStateJson.hpp"
+#include "../../src/support/SharedFrameBuffer.hpp"
+#include "BenchHarness.hpp"
+
+static uint64_t heapAllocations = 0;
+
+void *operator new(size_t size)
+{
+  heapAllocations++;
+  void *block = malloc(size ? size : 1);
+  if (block == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return block;
+}
+
+void operator delete(void *block) noexcept
+{
+  free(block);
+}
+
+void operator delete(void *block, size_t) noexcept
+{
+  free(block);
+}
+
+static PerfChannel perfControl("control", 125);
+static PerfChannel perfTick("tick", 5);
+static PerfChannel perfStateMachine("stateMachine", 500);
+static PerfChannel perfWsBroadcast("wsBroadcast", 1000);
+static PerfChannel perfRoastTrace("roastTrace", 1000);
+static PerfChannel perfLoop("loop", 0);
+static PerfChannel *const perfChannels[] = {&perfControl, &perfTick, &perfStateMachine,
+                                            &perfWsBroadcast, &perfRoastTrace, &perfLoop};
+
+static SystemStateSnapshot roastingState(uint64_t call)
+{
+  SystemStateSnapshot state;
+  state.timestamp = static_cast<unsigned long>(call * 1000ULL);
+  state.state = "ROASTING";
+  state.currentTemp = 200.0 + static_cast<double>(call % 2500) * 0.1;
+  state.setpointTemp = state.currentTemp + 2.5;
+  state.fanTemp = 180.0 + static_cast<double>(call % 700) * 0.1;
+  state.rateOfRise = (static_cast<double>(call % 400) - 200.0) * 0.05;
+  state.heater = static_cast<int>(call % 256);
+  state.pidTrim = -12.35;
+  state.feedforward = 140.0;
+  state.pwmFan = 200;
+  state.bdcFan = 1450;
+  state.scheduleEnabled = true;
+  state.activeBand = 1;
+  state.heaterMode = "pid";
+  state.progress = static_cast<int>(call % 900);
+  state.setpointCount = 9;
+  state.finalTemp = 435;
+  state.lastRejectedReason = "none";
+  state.faultCode = "none";
+  state.faultMessage = "";
+  state.heapFree = 150000 + static_cast<uint32_t>(call % 30000);
+  state.heapSize = 327680;
+  state.perfChannels = perfChannels;
+  state.perfChannelCount = sizeof(perfChannels) / sizeof(perfChannels[0]);
+  return state;
+}
+
+int main(int argc, char **argv)
+{
+  HostBench::Options options = HostBench::parseArgs(argc, argv);
+  std::vector<HostBench::Result> results;
+  results.reserve(4);
+
+  // Some timer history so the perf section has real percentiles to write
+  for (uint32_t sample = 0; sample < 2000; sample++)
+  {
+    perfControl.finish(perfControl.start());
+    perfWsBroadcast.finish(perfWsBroadcast.start());
+    delay(1);
+  }
+
+  static char payload[STATE_JSON_CAPACITY];
+  size_t lastLength = 0;
+  uint64_t writes = 0;
+  uint64_t before = heapAllocations;
+  HostBench::Result write = HostBench::measure("writeSystemStateJson", options, 2000000, [&](uint64_t call) {
+    lastLength = writeSystemStateJson(roastingState(call), payload, sizeof(payload));
+    writes++;
+    HostBench::doNotOptimize(lastLength);
+  });
+  uint64_t writeAllocations = heapAllocations - before;
+  results.push_back(write);
+
+  SharedFrameBuffer frames(STATE_JSON_CAPACITY);
+  uint64_t broadcasts = 0;
+  before = heapAllocations;
+  HostBench::Result broadcast = HostBench::measure("state broadcast (2 clients)", options, 2000000, [&](uint64_t call) {
+    SharedFrameBuffer::Frame frame = frames.acquire();
+    size_t length = writeSystemStateJson(roastingState(call), reinterpret_cast<char *>(frame->data()), frame->size());
+    frame->resize(length);
+    SharedFrameBuffer::Frame clientA = frame;
+    SharedFrameBuffer::Frame clientB = frame;
+    HostBench::doNotOptimize(clientA);
+    HostBench::doNotOptimize(clientB);
+    broadcasts++;
+  });
+  uint64_t broadcastAllocations = heapAllocations - before;
+  results.push_back(broadcast);
+
+  HostBench::report(results, options);
+
+  if (!options.csv)
+  {
+    printf("\npayload %zu bytes; heap allocations: %llu in %llu writes, %llu in %llu broadcasts\n", lastLength,
+           static_cast<unsigned long long>(writeAllocations),
+           static_cast<unsigned long long>(writes),
+           static_cast<unsigned long long>(broadcastAllocations),
+           static_cast<unsigned long long>(broadcasts));
+  }
+  if (lastLength == 0 || writeAllocations != 0 || broadcastAllocations != 0)
+  {
+    fprintf(stderr, "state broadcast path allocated or overflowed\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,204 @@
+#ifndef HOST_AUNIT_SHIM_H
+#define HOST_AUNIT_SHIM_H
+
+#include <Arduino.h>
+
+#include <type_traits>
+#include <vector>
+
+// Subset of the AUnit API used by tests/*.ino so the same suites run on the
+// host. Tests run in registration order on the first TestRunner::run() call;
+// SketchMain.cpp turns the result into a process exit code for ctest.
+namespace aunit
+{
+enum class Verbosity
+{
+  kDefault,
+  kAll
+};
+
+namespace internal
+{
+struct TestCase
+{
+  const char *name;
+  void (*body)();
+};
+
+struct State
+{
+  std::vector<TestCase> tests;
+  const char *currentTest = nullptr;
+  bool currentFailed = false;
+  bool done = false;
+  bool verbose = false;
+  uint16_t passed = 0;
+  uint16_t failed = 0;
+};
+
+inline State &state()
+{
+  static State instance;
+  return instance;
+}
+
+struct Registrar
+{
+  Registrar(const char *name, void (*body)()) { state().tests.push_back({name, body}); }
+};
+
+inline std::string describe(const String &value) { return std::string("\"") + value.c_str() + "\""; }
+inline std::string describe(const char *value) { return std::string("\"") + (value ? value : "") + "\""; }
+inline std::string describe(bool value) { return value ? "true" : "false"; }
+
+template <typename T>
+std::string describe(const T &value)
+{
+  if constexpr (std::is_floating_point<T>::value)
+  {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.6f", static_cast<double>(value));
+    return buffer;
+  }
+  else if constexpr (std::is_enum<T>::value)
+  {
+    return std::to_string(static_cast<long long>(value));
+  }
+  else if constexpr (std::is_signed<T>::value)
+  {
+    return std::to_string(static_cast<long long>(value));
+  }
+  else
+  {
+    return std::to_string(static_cast<unsigned long long>(value));
+  }
+}
+
+inline void fail(const char *file, int line, const char *expression, const std::string &detail)
+{
+  State &s = state();
+  s.currentFailed = true;
+  printf("  assertion failed: %s\n", expression);
+  if (!detail.empty())
+  {
+    printf("    %s\n", detail.c_str());
+  }
+  printf("    at %s:%d\n", file, line);
+}
+
+template <typename A, typename B>
+std::string pair(const A &lhs, const B &rhs)
+{
+  return "lhs=" + describe(lhs) + " rhs=" + describe(rhs);
+}
+
+template <typename A, typename B>
+bool equal(const A &lhs, const B &rhs)
+{
+  if constexpr (std::is_arithmetic<A>::value && std::is_arithmetic<B>::value)
+  {
+    using Common = typename std::common_type<A, B>::type;
+    return static_cast<Common>(lhs) == static_cast<Common>(rhs);
+  }
+  else
+  {
+    return lhs == rhs;
+  }
+}
+
+template <typename A, typename B>
+bool less(const A &lhs, const B &rhs)
+{
+  using Common = typename std::common_type<A, B>::type;
+  return static_cast<Common>(lhs) < static_cast<Common>(rhs);
+}
+} // namespace internal
+
+class TestRunner
+{
+public:
+  static void setTimeout(unsigned long) {}
+  static void setVerbosity(Verbosity verbosity) { internal::state().verbose = verbosity == Verbosity::kAll; }
+  static void setPrinter(HostSerial *) {}
+
+  static void list()
+  {
+    for (const internal::TestCase &test : internal::state().tests)
+    {
+      printf("Test %s\n", test.name);
+    }
+  }
+
+  static void run()
+  {
+    internal::State &s = internal::state();
+    if (s.done)
+    {
+      return;
+    }
+
+    for (const internal::TestCase &test : s.tests)
+    {
+      s.currentTest = test.name;
+      s.currentFailed = false;
+      test.body();
+      if (s.currentFailed)
+      {
+        s.failed++;
+        printf("Test %s failed.\n", test.name);
+      }
+      else
+      {
+        s.passed++;
+        if (s.verbose)
+        {
+          printf("Test %s passed.\n", test.name);
+        }
+      }
+    }
+
+    printf("TestRunner summary: %u passed, %u failed, %u total.\n",
+           s.passed, s.failed, static_cast<unsigned>(s.tests.size()));
+    s.done = true;
+  }
+
+  static bool isDone() { return internal::state().done; }
+  static uint16_t failedCount() { return internal::state().failed; }
+};
+} // namespace aunit
+
+#define test(name)                                                        \
+  static void aunit_test_##name();                                        \
+  static aunit::internal::Registrar aunit_registrar_##name(#name, aunit_test_##name); \
+  static void aunit_test_##name()
+
+#define AUNIT_HOST_CHECK(condition, expression, detail)                   \
+  do                                                                      \
+  {                                                                       \
+    if (!(condition))                                                     \
+    {                                                                     \
+      aunit::internal::fail(__FILE__, __LINE__, expression, detail);      \
+      return;                                                             \
+    }                                                                     \
+  } while (0)
+
+#define assertTrue(condition) AUNIT_HOST_CHECK((condition), "assertTrue(" #condition ")", std::string())
+#define assertFalse(condition) AUNIT_HOST_CHECK(!(condition), "assertFalse(" #condition ")", std::string())
+#define assertEqual(lhs, rhs) \
+  AUNIT_HOST_CHECK(aunit::internal::equal((lhs), (rhs)), "assertEqual(" #lhs ", " #rhs ")", aunit::internal::pair((lhs), (rhs)))
+#define assertNotEqual(lhs, rhs) \
+  AUNIT_HOST_CHECK(!aunit::internal::equal((lhs), (rhs)), "assertNotEqual(" #lhs ", " #rhs ")", aunit::internal::pair((lhs), (rhs)))
+#define assertLess(lhs, rhs) \
+  AUNIT_HOST_CHECK(aunit::internal::less((lhs), (rhs)), "assertLess(" #lhs ", " #rhs ")", aunit::internal::pair((lhs), (rhs)))
+#define assertMore(lhs, rhs) \
+  AUNIT_HOST_CHECK(aunit::internal::less((rhs), (lhs)), "assertMore(" #lhs ", " #rhs ")", aunit::internal::pair((lhs), (rhs)))
+#define assertLessOrEqual(lhs, rhs) \
+  AUNIT_HOST_CHECK(!aunit::internal::less((rhs), (lhs)), "assertLessOrEqual(" #lhs ", " #rhs ")", aunit::internal::pair((lhs), (rhs)))
+#define assertMoreOrEqual(lhs, rhs) \
+  AUNIT_HOST_CHECK(!aunit::internal::less((lhs), (rhs)), "assertMoreOrEqual(" #lhs ", " #rhs ")", aunit::internal::pair((lhs), (rhs)))
+#define assertNear(expected, actual, tolerance)                                                        \
+  AUNIT_HOST_CHECK(fabs(static_cast<double>(expected) - static_cast<double>(actual)) <= (tolerance), \
+                   "assertNear(" #expected ", " #actual ", " #tolerance ")",                           \
+                   aunit::internal::pair((expected), (actual)))
+
+#endif // HOST_AUNIT_SHIM_H
@@ -0,0 +1,6 @@
+#ifndef HOST_AUNIT_VERBOSE_SHIM_H
+#define HOST_AUNIT_VERBOSE_SHIM_H
+
+#include <AUnit.h>
+
+#endif // HOST_AUNIT_VERBOSE_SHIM_H
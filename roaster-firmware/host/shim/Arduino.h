@@ -0,0 +1,268 @@
+#ifndef HOST_ARDUINO_SHIM_H
+#define HOST_ARDUINO_SHIM_H
+
+// Minimal Arduino API for building the firmware headers on Linux/macOS.
+// Only what src/ and the AUnit suites actually use lives here. Time is a
+// virtual clock: millis() only moves when delay() or HostClock advances it,
+// which keeps host tests deterministic and lets simulations run faster than
+// real time.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#define ROASTER_HOST_BUILD 1
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::max;
+using std::min;
+using std::abs;
+
+#if defined(__GLIBC__) && (__GLIBC__ == 2) && (__GLIBC_MINOR__ < 38)
+inline size_t strlcpy(char *dst, const char *src, size_t size)
+{
+  size_t length = strlen(src);
+  if (size > 0)
+  {
+    size_t copyLength = length >= size ? size - 1 : length;
+    memcpy(dst, src, copyLength);
+    dst[copyLength] = '\0';
+  }
+  return length;
+}
+
+inline size_t strlcat(char *dst, const char *src, size_t size)
+{
+  size_t used = strnlen(dst, size);
+  if (used == size)
+  {
+    return size + strlen(src);
+  }
+  return used + strlcpy(dst + used, src, size - used);
+}
+#endif
+
+// ============================================================================
+// VIRTUAL CLOCK
+// ============================================================================
+
+namespace HostClock
+{
+inline uint64_t nowMicros = 0;
+
+inline void setMillis(unsigned long ms) { nowMicros = static_cast<uint64_t>(ms) * 1000ULL; }
+inline void advanceMillis(unsigned long ms) { nowMicros += static_cast<uint64_t>(ms) * 1000ULL; }
+inline void advanceMicros(uint64_t us) { nowMicros += us; }
+}
+
+inline unsigned long millis() { return static_cast<unsigned long>(HostClock::nowMicros / 1000ULL); }
+inline unsigned long micros() { return static_cast<unsigned long>(HostClock::nowMicros); }
+inline void delay(unsigned long ms) { HostClock::advanceMillis(ms); }
+inline void delayMicroseconds(unsigned int us) { HostClock::advanceMicros(us); }
+inline void yield() {}
+
+// ============================================================================
+// GPIO (no-ops on host)
+// ============================================================================
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+inline void analogWrite(uint8_t, int) {}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+inline long random(long howBig) { return howBig > 0 ? ::random() % howBig : 0; }
+inline long random(long howSmall, long howBig) { return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall); }
+inline void randomSeed(unsigned long seed) { ::srandom(static_cast<unsigned int>(seed)); }
+
+// ============================================================================
+// STRING
+// ============================================================================
+
+class String
+{
+public:
+  String() = default;
+  String(const char *value) : data(value ? value : "") {}
+  String(const std::string &value) : data(value) {}
+  explicit String(char value) : data(1, value) {}
+  explicit String(int value) : data(std::to_string(value)) {}
+  explicit String(unsigned int value) : data(std::to_string(value)) {}
+  explicit String(long value) : data(std::to_string(value)) {}
+  explicit String(unsigned long value) : data(std::to_string(value)) {}
+  explicit String(long long value) : data(std::to_string(value)) {}
+  explicit String(unsigned long long value) : data(std::to_string(value)) {}
+  explicit String(float value, unsigned int decimals = 2) : String(static_cast<double>(value), decimals) {}
+  explicit String(double value, unsigned int decimals = 2)
+  {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", static_cast<int>(decimals), value);
+    data = buffer;
+  }
+
+  unsigned int length() const { return static_cast<unsigned int>(data.size()); }
+  bool isEmpty() const { return data.empty(); }
+  const char *c_str() const { return data.c_str(); }
+  void reserve(unsigned int size) { data.reserve(size); }
+  char charAt(unsigned int index) const { return index < data.size() ? data[index] : '\0'; }
+  char operator[](unsigned int index) const { return charAt(index); }
+
+  String &operator+=(const String &other) { data += other.data; return *this; }
+  String &operator+=(const char *other) { data += (other ? other : ""); return *this; }
+  String &operator+=(char other) { data += other; return *this; }
+  String &operator+=(int other) { data += std::to_string(other); return *this; }
+  String &operator+=(unsigned int other) { data += std::to_string(other); return *this; }
+  String &operator+=(long other) { data += std::to_string(other); return *this; }
+  String &operator+=(unsigned long other) { data += std::to_string(other); return *this; }
+  String &operator+=(double other) { data += String(other).data; return *this; }
+  bool concat(const String &other) { data += other.data; return true; }
+  bool concat(const char *other) { data += (other ? other : ""); return true; }
+  bool concat(char other) { data += other; return true; }
+
+  friend String operator+(const String &lhs, const String &rhs) { return String(lhs.data + rhs.data); }
+  friend String operator+(const String &lhs, const char *rhs) { return String(lhs.data + (rhs ? rhs : "")); }
+  friend String operator+(const char *lhs, const String &rhs) { return String((lhs ? lhs : "") + rhs.data); }
+  friend bool operator==(const String &lhs, const String &rhs) { return lhs.data == rhs.data; }
+  friend bool operator==(const String &lhs, const char *rhs) { return lhs.data == (rhs ? rhs : ""); }
+  friend bool operator!=(const String &lhs, const String &rhs) { return lhs.data != rhs.data; }
+  friend bool operator!=(const String &lhs, const char *rhs) { return !(lhs == rhs); }
+  friend bool operator<(const String &lhs, const String &rhs) { return lhs.data < rhs.data; }
+
+  bool equals(const String &other) const { return data == other.data; }
+  bool startsWith(const String &prefix) const { return data.compare(0, prefix.data.size(), prefix.data) == 0; }
+  bool endsWith(const String &suffix) const
+  {
+    return data.size() >= suffix.data.size() &&
+           data.compare(data.size() - suffix.data.size(), suffix.data.size(), suffix.data) == 0;
+  }
+
+  int indexOf(char value, unsigned int from = 0) const
+  {
+    size_t position = data.find(value, from);
+    return position == std::string::npos ? -1 : static_cast<int>(position);
+  }
+
+  int indexOf(const String &value, unsigned int from = 0) const
+  {
+    size_t position = data.find(value.data, from);
+    return position == std::string::npos ? -1 : static_cast<int>(position);
+  }
+
+  String substring(unsigned int from) const { return from >= data.size() ? String() : String(data.substr(from)); }
+  String substring(unsigned int from, unsigned int to) const
+  {
+    if (from > to)
+    {
+      std::swap(from, to);
+    }
+    if (from >= data.size())
+    {
+      return String();
+    }
+    return String(data.substr(from, std::min<size_t>(to, data.size()) - from));
+  }
+
+  void trim()
+  {
+    size_t first = data.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos)
+    {
+      data.clear();
+      return;
+    }
+    size_t last = data.find_last_not_of(" \t\r\n");
+    data = data.substr(first, last - first + 1);
+  }
+
+  void replace(const String &find, const String &replacement)
+  {
+    if (find.data.empty())
+    {
+      return;
+    }
+    size_t position = 0;
+    while ((position = data.find(find.data, position)) != std::string::npos)
+    {
+      data.replace(position, find.data.size(), replacement.data);
+      position += replacement.data.size();
+    }
+  }
+
+  long toInt() const { return strtol(data.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(data.c_str(), nullptr); }
+  double toDouble() const { return strtod(data.c_str(), nullptr); }
+
+private:
+  std::string data;
+};
+
+// ============================================================================
+// SERIAL
+// ============================================================================
+
+class HostSerial
+{
+public:
+  void begin(unsigned long) {}
+  void end() {}
+  void flush() { fflush(stdout); }
+  int available() const { return 0; }
+  int read() { return -1; }
+  explicit operator bool() const { return true; }
+
+  size_t print(const char *value) { return fputs(value ? value : "", stdout) >= 0 ? strlen(value ? value : "") : 0; }
+  size_t print(const String &value) { return print(value.c_str()); }
+  size_t print(char value) { return fputc(value, stdout) == EOF ? 0 : 1; }
+  size_t print(int value) { return static_cast<size_t>(::printf("%d", value)); }
+  size_t print(unsigned int value) { return static_cast<size_t>(::printf("%u", value)); }
+  size_t print(long value) { return static_cast<size_t>(::printf("%ld", value)); }
+  size_t print(unsigned long value) { return static_cast<size_t>(::printf("%lu", value)); }
+  size_t print(double value, int decimals = 2) { return static_cast<size_t>(::printf("%.*f", decimals, value)); }
+
+  size_t println() { return print("\n"); }
+  template <typename T>
+  size_t println(const T &value)
+  {
+    size_t written = print(value);
+    return written + println();
+  }
+  size_t println(double value, int decimals) { return print(value, decimals) + println(); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+  {
+    va_list args;
+    va_start(args, format);
+    int written = vprintf(format, args);
+    va_end(args);
+    return written > 0 ? static_cast<size_t>(written) : 0;
+  }
+};
+
+inline HostSerial Serial;
+
+#endif // HOST_ARDUINO_SHIM_H
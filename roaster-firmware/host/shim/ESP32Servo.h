@@ -0,0 +1,28 @@
+#ifndef HOST_ESP32SERVO_SHIM_H
+#define HOST_ESP32SERVO_SHIM_H
+
+#include <Arduino.h>
+
+class ESP32PWM
+{
+public:
+  static void allocateTimer(int) {}
+};
+
+// Records the last commanded pulse width instead of driving a servo.
+class Servo
+{
+public:
+  int attach(int newPin) { pin = newPin; return 0; }
+  void detach() { pin = -1; }
+  bool attached() const { return pin >= 0; }
+  void setPeriodHertz(int) {}
+  void writeMicroseconds(int value) { pulseMicros = value; }
+  int readMicroseconds() const { return pulseMicros; }
+
+private:
+  int pin = -1;
+  int pulseMicros = 0;
+};
+
+#endif // HOST_ESP32SERVO_SHIM_H
@@ -0,0 +1,26 @@
+#ifndef HOST_PWMRELAY_SHIM_H
+#define HOST_PWMRELAY_SHIM_H
+
+#include <Arduino.h>
+
+// Records the last commanded duty instead of toggling a pin.
+class PWMrelay
+{
+public:
+  explicit PWMrelay(uint8_t pin, bool activeLevel = LOW) : pin(pin), activeLevel(activeLevel) {}
+
+  void setPWM(uint8_t duty) { pwm = duty; }
+  uint8_t getPWM() const { return pwm; }
+  void setPeriod(uint16_t newPeriodMs) { periodMs = newPeriodMs; }
+  uint16_t getPeriod() const { return periodMs; }
+  void setLevel(bool level) { activeLevel = level; }
+  void tick() {}
+
+private:
+  uint8_t pin;
+  bool activeLevel;
+  uint8_t pwm = 0;
+  uint16_t periodMs = 1000;
+};
+
+#endif // HOST_PWMRELAY_SHIM_H
@@ -0,0 +1,169 @@
+#ifndef HOST_PREFERENCES_SHIM_H
+#define HOST_PREFERENCES_SHIM_H
+
+#include <Arduino.h>
+
+#include <map>
+#include <vector>
+
+// In-memory stand-in for the ESP32 NVS Preferences API. Every Preferences
+// instance that opens the same namespace shares one store, like NVS does on
+// the device. Commit counters let host tests reason about flash wear.
+namespace HostNvs
+{
+struct Stats
+{
+  uint32_t writes = 0;
+  uint32_t removes = 0;
+  uint32_t reads = 0;
+};
+
+inline std::map<std::string, std::map<std::string, std::vector<uint8_t>>> namespaces;
+inline Stats stats;
+
+inline void reset()
+{
+  namespaces.clear();
+  stats = {};
+}
+}
+
+class Preferences
+{
+public:
+  bool begin(const char *name, bool readOnly = false, const char * = nullptr)
+  {
+    store = &HostNvs::namespaces[name ? name : ""];
+    this->readOnly = readOnly;
+    return true;
+  }
+
+  void end() { store = nullptr; }
+
+  bool clear()
+  {
+    if (!writable())
+    {
+      return false;
+    }
+    store->clear();
+    HostNvs::stats.removes++;
+    return true;
+  }
+
+  bool remove(const char *key)
+  {
+    if (!writable() || store->erase(key) == 0)
+    {
+      return false;
+    }
+    HostNvs::stats.removes++;
+    return true;
+  }
+
+  bool isKey(const char *key) const { return store && store->count(key) > 0; }
+  size_t freeEntries() const { return 512; }
+
+  size_t putBool(const char *key, bool value) { return putValue(key, static_cast<uint8_t>(value ? 1 : 0)); }
+  size_t putUChar(const char *key, uint8_t value) { return putValue(key, value); }
+  size_t putInt(const char *key, int32_t value) { return putValue(key, value); }
+  size_t putUInt(const char *key, uint32_t value) { return putValue(key, value); }
+  size_t putLong(const char *key, int32_t value) { return putValue(key, value); }
+  size_t putULong(const char *key, uint32_t value) { return putValue(key, value); }
+  size_t putFloat(const char *key, float value) { return putValue(key, value); }
+  size_t putDouble(const char *key, double value) { return putValue(key, value); }
+
+  size_t putString(const char *key, const char *value)
+  {
+    const char *text = value ? value : "";
+    return putBytes(key, text, strlen(text) + 1) > 0 ? strlen(text) : 0;
+  }
+
+  size_t putString(const char *key, const String &value) { return putString(key, value.c_str()); }
+
+  size_t putBytes(const char *key, const void *value, size_t length)
+  {
+    if (!writable() || key == nullptr || (value == nullptr && length > 0))
+    {
+      return 0;
+    }
+    const uint8_t *bytes = static_cast<const uint8_t *>(value);
+    (*store)[key] = std::vector<uint8_t>(bytes, bytes + length);
+    HostNvs::stats.writes++;
+    return length;
+  }
+
+  bool getBool(const char *key, bool defaultValue = false) { return getValue<uint8_t>(key, defaultValue ? 1 : 0) != 0; }
+  uint8_t getUChar(const char *key, uint8_t defaultValue = 0) { return getValue(key, defaultValue); }
+  int32_t getInt(const char *key, int32_t defaultValue = 0) { return getValue(key, defaultValue); }
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0) { return getValue(key, defaultValue); }
+  int32_t getLong(const char *key, int32_t defaultValue = 0) { return getValue(key, defaultValue); }
+  uint32_t getULong(const char *key, uint32_t defaultValue = 0) { return getValue(key, defaultValue); }
+  float getFloat(const char *key, float defaultValue = NAN) { return getValue(key, defaultValue); }
+  double getDouble(const char *key, double defaultValue = NAN) { return getValue(key, defaultValue); }
+
+  String getString(const char *key, const String &defaultValue = String())
+  {
+    const std::vector<uint8_t> *entry = find(key);
+    if (entry == nullptr || entry->empty())
+    {
+      return defaultValue;
+    }
+    return String(reinterpret_cast<const char *>(entry->data()));
+  }
+
+  size_t getBytesLength(const char *key)
+  {
+    const std::vector<uint8_t> *entry = find(key);
+    return entry ? entry->size() : 0;
+  }
+
+  size_t getBytes(const char *key, void *buffer, size_t maxLength)
+  {
+    const std::vector<uint8_t> *entry = find(key);
+    if (entry == nullptr || buffer == nullptr || entry->size() > maxLength)
+    {
+      return 0;
+    }
+    memcpy(buffer, entry->data(), entry->size());
+    return entry->size();
+  }
+
+private:
+  std::map<std::string, std::vector<uint8_t>> *store = nullptr;
+  bool readOnly = false;
+
+  bool writable() const { return store != nullptr && !readOnly; }
+
+  const std::vector<uint8_t> *find(const char *key)
+  {
+    if (store == nullptr || key == nullptr)
+    {
+      return nullptr;
+    }
+    HostNvs::stats.reads++;
+    auto it = store->find(key);
+    return it == store->end() ? nullptr : &it->second;
+  }
+
+  template <typename T>
+  size_t putValue(const char *key, T value)
+  {
+    return putBytes(key, &value, sizeof(value));
+  }
+
+  template <typename T>
+  T getValue(const char *key, T defaultValue)
+  {
+    const std::vector<uint8_t> *entry = find(key);
+    if (entry == nullptr || entry->size() != sizeof(T))
+    {
+      return defaultValue;
+    }
+    T value;
+    memcpy(&value, entry->data(), sizeof(T));
+    return value;
+  }
+};
+
+#endif // HOST_PREFERENCES_SHIM_H
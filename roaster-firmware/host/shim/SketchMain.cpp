@@ -0,0 +1,17 @@
+// Drives an Arduino sketch (setup() once, then loop()) on the host until the
+// AUnit shim reports that every registered test has run.
+
+#include <AUnit.h>
+
+void setup();
+void loop();
+
+int main()
+{
+  setup();
+  while (!aunit::TestRunner::isDone())
+  {
+    loop();
+  }
+  return aunit::TestRunner::failedCount() == 0 ? 0 : 1;
+}
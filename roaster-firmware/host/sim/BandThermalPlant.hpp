@@ -0,0 +1,139 @@
+#ifndef BAND_THERMAL_PLANT_HPP
+#define BAND_THERMAL_PLANT_HPP
+
+#include <Arduino.h>
+#include <math.h>
+
+#include "../../src/platform/CalibrationTypes.hpp"
+
+// Bean-mass thermal model assembled from the per-band FOPDT characterization
+// the step-response tuner stores. Within a band:
+//
+//   dT/dt = drift + heaterCoeff * u(t - deadTime) - coolingCoeff * (T - ambient)
+//
+// which is the same energy balance StepResponseTuner uses to derive
+// coolingCoeff (heaterCoeff * u_baseline = coolingCoeff * (T_baseline - T_ambient)).
+// The active band is picked from the current bean temperature, so the plant
+// gets hotter-running, laggier dynamics as the roast progresses exactly as the
+// calibration measured them.
+class BandThermalPlant
+{
+public:
+  struct Options
+  {
+    double ambientTemp = 75.0;
+    double initialTemp = 75.0;
+    double stepSeconds = 0.05;
+    double fanSensorCoupling = 0.3;  // Exhaust sensor sits between ambient and bean temp
+    double sensorResolution = 0.25;   // MAX6675 reports in 0.25 C steps; kept in F units here
+  };
+
+  static constexpr uint16_t MAX_DELAY_STEPS = 1024;
+
+  bool configure(const Calibration::CharacterizationSummary &summary, const Options &newOptions)
+  {
+    options = newOptions;
+    options.stepSeconds = max(options.stepSeconds, 0.001);
+    validBandCount = 0;
+    for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++)
+    {
+      bands[index] = summary.bands[index];
+      if (bands[index].valid)
+      {
+        validBandCount++;
+      }
+    }
+
+    beanTemp = options.initialTemp;
+    elapsedSeconds = 0.0;
+    historyIndex = 0;
+    for (uint16_t index = 0; index < MAX_DELAY_STEPS; index++)
+    {
+      heaterHistory[index] = 0.0;
+    }
+    return validBandCount > 0;
+  }
+
+  // Advances the model by one integration step with the given heater command (0-255).
+  void step(double heaterCommand)
+  {
+    heaterHistory[historyIndex] = constrain(heaterCommand, 0.0, 255.0);
+
+    const Calibration::BandCharacterization &band = bands[selectBand()];
+    long delaySteps = constrain(lround(band.deadTime / options.stepSeconds), 0L, static_cast<long>(MAX_DELAY_STEPS - 1));
+    double delayedCommand = heaterHistory[(historyIndex + MAX_DELAY_STEPS - delaySteps) % MAX_DELAY_STEPS];
+    historyIndex = (historyIndex + 1) % MAX_DELAY_STEPS;
+
+    double rate = band.drift + band.heaterCoeff * delayedCommand - band.coolingCoeff * (beanTemp - options.ambientTemp);
+    beanTemp += rate * options.stepSeconds;
+    elapsedSeconds += options.stepSeconds;
+  }
+
+  void advance(double seconds, double heaterCommand)
+  {
+    long steps = lround(seconds / options.stepSeconds);
+    for (long index = 0; index < steps; index++)
+    {
+      step(heaterCommand);
+    }
+  }
+
+  double getBeanTemp() const { return beanTemp; }
+  double getElapsedSeconds() const { return elapsedSeconds; }
+  int8_t getActiveBandIndex() const { return static_cast<int8_t>(selectBand()); }
+
+  // Bean reading as the thermocouple amplifier would report it.
+  double readBeanSensor() const
+  {
+    return quantize(beanTemp);
+  }
+
+  double readFanSensor() const
+  {
+    return quantize(options.ambientTemp + options.fanSensorCoupling * (beanTemp - options.ambientTemp));
+  }
+
+private:
+  Options options;
+  Calibration::BandCharacterization bands[Calibration::BAND_COUNT] = {};
+  uint8_t validBandCount = 0;
+  double beanTemp = 75.0;
+  double elapsedSeconds = 0.0;
+  double heaterHistory[MAX_DELAY_STEPS] = {};
+  uint16_t historyIndex = 0;
+
+  double quantize(double value) const
+  {
+    if (options.sensorResolution <= 0.0)
+    {
+      return value;
+    }
+    return round(value / options.sensorResolution) * options.sensorResolution;
+  }
+
+  uint8_t selectBand() const
+  {
+    uint8_t nearestBand = 0;
+    double nearestDelta = 1e9;
+    for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++)
+    {
+      if (!bands[index].valid)
+      {
+        continue;
+      }
+      if (beanTemp >= bands[index].minTemp && beanTemp <= bands[index].maxTemp)
+      {
+        return index;
+      }
+      double delta = fabs(beanTemp - bands[index].targetTemp);
+      if (delta < nearestDelta)
+      {
+        nearestDelta = delta;
+        nearestBand = index;
+      }
+    }
+    return nearestBand;
+  }
+};
+
+#endif // BAND_THERMAL_PLANT_HPP
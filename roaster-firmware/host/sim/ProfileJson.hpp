@@ -0,0 +1,196 @@
+#ifndef HOST_PROFILE_JSON_HPP
+#define HOST_PROFILE_JSON_HPP
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Minimal reader for the roast-profiles/*.json files so the simulator can load
+// the same documents the web UI uploads without pulling ArduinoJson into the
+// host build. Only the fields ProfileManager::saveProfile consumes are read.
+namespace ProfileJson
+{
+struct Setpoint
+{
+  uint32_t timeSeconds = 0;
+  uint32_t temp = 0;
+  uint32_t fanSpeed = 0;
+};
+
+struct Document
+{
+  std::string name;
+  std::vector<Setpoint> setpoints;
+};
+
+namespace detail
+{
+inline size_t skipString(const std::string &text, size_t index)
+{
+  // index points at the opening quote; returns the index after the closing quote.
+  for (index++; index < text.size(); index++)
+  {
+    if (text[index] == '\\')
+    {
+      index++;
+    }
+    else if (text[index] == '"')
+    {
+      return index + 1;
+    }
+  }
+  return text.size();
+}
+
+inline size_t skipWhitespace(const std::string &text, size_t index)
+{
+  while (index < text.size() && (text[index] == ' ' || text[index] == '\t' || text[index] == '\n' || text[index] == '\r'))
+  {
+    index++;
+  }
+  return index;
+}
+} // namespace detail
+
+// Parses a profile document. Returns false when the name or setpoints array is
+// missing or a setpoint lacks one of time/temp/fanSpeed.
+inline bool parse(const std::string &text, Document &document)
+{
+  document = {};
+  int objectDepth = 0;
+  bool inSetpoints = false;
+  int setpointsDepth = 0;
+  Setpoint current;
+  uint8_t currentFields = 0;
+
+  size_t index = 0;
+  while (index < text.size())
+  {
+    char c = text[index];
+    if (c == '{')
+    {
+      objectDepth++;
+      if (inSetpoints && objectDepth == setpointsDepth + 1)
+      {
+        current = {};
+        currentFields = 0;
+      }
+      index++;
+    }
+    else if (c == '}')
+    {
+      if (inSetpoints && objectDepth == setpointsDepth + 1)
+      {
+        if (currentFields != 0x7)
+        {
+          return false;
+        }
+        document.setpoints.push_back(current);
+      }
+      objectDepth--;
+      index++;
+    }
+    else if (c == ']' && inSetpoints && objectDepth == setpointsDepth)
+    {
+      inSetpoints = false;
+      index++;
+    }
+    else if (c == '"')
+    {
+      size_t end = detail::skipString(text, index);
+      std::string key = text.substr(index + 1, end - index - 2);
+      size_t valueIndex = detail::skipWhitespace(text, end);
+      if (valueIndex >= text.size() || text[valueIndex] != ':')
+      {
+        index = end; // A string value, not a key
+        continue;
+      }
+      valueIndex = detail::skipWhitespace(text, valueIndex + 1);
+
+      if (objectDepth == 1 && key == "name" && valueIndex < text.size() && text[valueIndex] == '"')
+      {
+        size_t valueEnd = detail::skipString(text, valueIndex);
+        document.name = text.substr(valueIndex + 1, valueEnd - valueIndex - 2);
+        index = valueEnd;
+      }
+      else if (objectDepth == 1 && key == "setpoints" && valueIndex < text.size() && text[valueIndex] == '[')
+      {
+        inSetpoints = true;
+        setpointsDepth = objectDepth;
+        index = valueIndex + 1;
+      }
+      else if (inSetpoints && objectDepth == setpointsDepth + 1 &&
+               (key == "time" || key == "temp" || key == "fanSpeed"))
+      {
+        char *numberEnd = nullptr;
+        unsigned long value = strtoul(text.c_str() + valueIndex, &numberEnd, 10);
+        if (numberEnd == text.c_str() + valueIndex)
+        {
+          return false;
+        }
+        if (key == "time")
+        {
+          current.timeSeconds = static_cast<uint32_t>(value);
+          currentFields |= 0x1;
+        }
+        else if (key == "temp")
+        {
+          current.temp = static_cast<uint32_t>(value);
+          currentFields |= 0x2;
+        }
+        else
+        {
+          current.fanSpeed = static_cast<uint32_t>(value);
+          currentFields |= 0x4;
+        }
+        index = static_cast<size_t>(numberEnd - text.c_str());
+      }
+      else
+      {
+        index = valueIndex;
+      }
+    }
+    else
+    {
+      index++;
+    }
+  }
+
+  return !document.name.empty() && !document.setpoints.empty();
+}
+
+inline bool loadFile(const std::string &path, Document &document)
+{
+  std::ifstream file(path);
+  if (!file)
+  {
+    return false;
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return parse(buffer.str(), document);
+}
+
+// Mirrors ProfileManager::saveProfile: clear to the default (0,0,0) point, then
+// append every setpoint with its time converted to milliseconds.
+template <typename Profile>
+bool applyTo(const Document &document, Profile &profile)
+{
+  profile.clearSetpoints();
+  for (const Setpoint &setpoint : document.setpoints)
+  {
+    if (!profile.validateSetpoint(setpoint.temp, setpoint.fanSpeed))
+    {
+      return false;
+    }
+    profile.addSetpoint(setpoint.timeSeconds * 1000, setpoint.temp, setpoint.fanSpeed);
+  }
+  return true;
+}
+} // namespace ProfileJson
+
+#endif // HOST_PROFILE_JSON_HPP
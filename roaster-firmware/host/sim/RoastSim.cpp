@@ -0,0 +1,133 @@
+// Runs every roast profile through the closed-loop simulator and prints the
+// tracking metrics PIDValidationSession would report on the device.
+//
+//   ./roaster-roast-sim                         all profiles in ROASTER_PROFILES_DIR
+//   ./roaster-roast-sim path/to/profile.json    selected profiles
+//   ./roaster-roast-sim --validation            the built-in PID validation profile
+//   ./roaster-roast-sim --csv                   machine-readable output
+//   ./roaster-roast-sim --mpc                   heater on the model-predictive mode
+//   ./roaster-roast-sim --smith                 heater PID behind the Smith predictor
+
+#include <Arduino.h>
+
+#include <dirent.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "ProfileJson.hpp"
+#include "RoastSimulator.hpp"
+
+static std::vector<std::string> listProfiles(const char *directory)
+{
+  std::vector<std::string> paths;
+  DIR *dir = opendir(directory);
+  if (dir == nullptr)
+  {
+    return paths;
+  }
+  while (dirent *entry = readdir(dir))
+  {
+    std::string name = entry->d_name;
+    if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0)
+    {
+      paths.push_back(std::string(directory) + "/" + name);
+    }
+  }
+  closedir(dir);
+  std::sort(paths.begin(), paths.end());
+  return paths;
+}
+
+static void printResult(const char *name, const RoastSim::Result &result, bool csv)
+{
+  const PIDValidationSession::Summary &tracking = result.tracking;
+  if (csv)
+  {
+    printf("%s,%d,%.1f,%.1f,%.2f,%.2f,%.2f,%.1f,%.2f,%.1f\n", name, result.completed ? 1 : 0,
+           result.durationSeconds, result.acquisitionSeconds, tracking.meanAbsError, tracking.rmse,
+           tracking.maxAbsError, tracking.withinTwoDegreesPercent, result.maxOvershoot,
+           result.heaterSaturationPercent);
+    return;
+  }
+  printf("%-44s %4s %8.1f %8.1f %7.2f %7.2f %7.2f %7.1f %7.2f %7.1f\n", name, result.completed ? "yes" : "NO",
+         result.durationSeconds, result.acquisitionSeconds, tracking.meanAbsError, tracking.rmse,
+         tracking.maxAbsError, tracking.withinTwoDegreesPercent, result.maxOvershoot,
+         result.heaterSaturationPercent);
+}
+
+int main(int argc, char **argv)
+{
+  bool csv = false;
+  bool validation = false;
+  std::vector<std::string> paths;
+  for (int index = 1; index < argc; index++)
+  {
+    if (strcmp(argv[index], "--csv") == 0)
+    {
+      csv = true;
+    }
+    else if (strcmp(argv[index], "--validation") == 0)
+    {
+      validation = true;
+    }
+    else if (strcmp(argv[index], "--mpc") == 0)
+    {
+      heaterControlMode = HEATER_MODE_MPC;
+    }
+    else if (strcmp(argv[index], "--smith") == 0)
+    {
+      heaterControlMode = HEATER_MODE_SMITH;
+    }
+    else
+    {
+      paths.push_back(argv[index]);
+    }
+  }
+  if (paths.empty() && !validation)
+  {
+    paths = listProfiles(ROASTER_PROFILES_DIR);
+  }
+
+  if (csv)
+  {
+    printf("profile,completed,duration_s,acquired_s,mae_f,rmse_f,max_abs_f,within2_pct,overshoot_f,saturated_pct\n");
+  }
+  else
+  {
+    printf("%-44s %4s %8s %8s %7s %7s %7s %7s %7s %7s\n", "profile", "done", "dur_s", "acq_s", "mae", "rmse",
+           "max", "in2F%", "over", "sat%");
+  }
+
+  Calibration::CharacterizationSummary plantModel = RoastSim::makePopperCharacterization();
+  RoastSim::applyCharacterization(plantModel);
+
+  int failures = 0;
+  for (const std::string &path : paths)
+  {
+    ProfileJson::Document document;
+    if (!ProfileJson::loadFile(path, document) || !ProfileJson::applyTo(document, profile))
+    {
+      fprintf(stderr, "Failed to load %s\n", path.c_str());
+      failures++;
+      continue;
+    }
+    RoastSim::Result result = RoastSim::run(plantModel);
+    printResult(document.name.c_str(), result, csv);
+    failures += result.completed ? 0 : 1;
+  }
+
+  if (validation)
+  {
+    PIDValidationSession::buildValidationProfile(profile);
+    RoastSim::Options options;
+    options.completeOnProgress = true;
+    RoastSim::Result result = RoastSim::run(plantModel, options);
+    printResult("PID validation", result, csv);
+    failures += result.completed ? 0 : 1;
+  }
+
+  return failures == 0 ? 0 : 1;
+}
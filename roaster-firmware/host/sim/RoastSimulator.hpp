@@ -0,0 +1,237 @@
+#ifndef HOST_ROAST_SIMULATOR_HPP
+#define HOST_ROAST_SIMULATOR_HPP
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <PWMrelay.h>
+#include <ESP32Servo.h>
+#include <math.h>
+
+#include <vector>
+
+#include "../../src/control/PIDValidation.hpp"
+#include "../../src/control/RoastControlLoop.hpp"
+#include "../../src/platform/CalibrationTypes.hpp"
+#include "../../src/platform/PreferencesJournal.hpp"
+#include "BandThermalPlant.hpp"
+
+// Closed-loop roast simulator: runs the firmware's updateRoastControl() on the
+// same 250 ms cadence as controlLoopTimer against a BandThermalPlant, advancing
+// HostClock instead of waiting, so a 12 minute roast takes a few milliseconds.
+//
+// This header defines the globals RoastControlLoop.hpp expects (the sketch
+// normally owns them), so include it from exactly one translation unit.
+
+Preferences preferences;
+PreferencesJournal preferencesJournal(preferences);
+
+double kp = 8.0;
+double ki = 0.46;
+double kd = 0;
+double currentTemp = 0;
+double setpointTemp = 0;
+double heaterPidInputVal = 0;
+double heaterPidSetpointVal = 0;
+double heaterOutputVal = 0;
+double heaterPidTrimVal = 0;
+double heaterFeedforwardVal = 0;
+double fanTemp = 0;
+double rateOfRise = 0;
+double appliedKp = -1;
+double appliedKi = -1;
+double appliedKd = -1;
+
+byte setpointFanSpeed = 0;
+int setpointProgress = 0;
+int bdcFanMs = 0;
+int activePidBandIndex = -1;
+
+bool pidScheduleConfigured = false;
+bool pidScheduleActive = false;
+
+RoasterState roasterState = IDLE;
+HeaterControlMode heaterControlMode = HEATER_MODE_PID;
+
+PWMrelay heaterRelay(0, HIGH);
+PWMrelay fanRelay(0, HIGH);
+Servo bdcFan;
+
+RoastProfile profile;
+HeaterPIDController heaterPID(&heaterPidInputVal, &heaterPidSetpointVal, &heaterPidTrimVal, 0, 255, kp, ki, kd);
+PIDRuntimeController pidRuntimeController;
+RateOfRiseEstimator beanRorEstimator(ROR_WINDOW_DEFAULT_SECONDS * 1000UL);
+
+namespace RoastSim
+{
+// What heaterPID saw and produced on one control tick, for replaying a
+// simulated roast through another controller.
+struct ControlTick
+{
+  unsigned long nowMs;
+  double input;
+  double setpoint;
+  double kp;
+  double ki;
+  double kd;
+  double output;
+};
+
+struct Options
+{
+  BandThermalPlant::Options plant;
+  unsigned long controlIntervalMs = 250;  // controlLoopTimer
+  unsigned long sampleIntervalMs = 1000;  // roastTraceTimer
+  unsigned long timeoutMs = 30UL * 60UL * 1000UL;
+  double acquisitionBand = 5.0;           // Tracking is scored once |error| first drops below this
+  bool completeOnProgress = false;        // Validation runs end on profile progress, roasts on final temp
+  std::vector<ControlTick> *trace = nullptr; // Appended to on every control tick when set
+};
+
+struct Result
+{
+  bool completed = false;
+  double durationSeconds = 0.0;
+  double acquisitionSeconds = -1.0;
+  double finalTemp = 0.0;
+  double maxOvershoot = 0.0;
+  double heaterSaturationPercent = 0.0;
+  uint32_t controlTicks = 0;
+  PIDValidationSession::Summary tracking = {};
+};
+
+// Band characterization shaped like a hot-air popper roaster: slower and
+// laggier as the bean mass heats, with enough authority to reach ~550F.
+// Gains follow the same SIMC PI(D) rules StepResponseTuner::computeSIMC uses
+// with tau_c = theta.
+inline Calibration::CharacterizationSummary makePopperCharacterization()
+{
+  Calibration::CharacterizationSummary summary = {};
+  const double targets[Calibration::BAND_COUNT] = {180.0, 280.0, 380.0};
+  const double minTemps[Calibration::BAND_COUNT] = {0.0, 230.0, 330.0};
+  const double maxTemps[Calibration::BAND_COUNT] = {230.0, 330.0, 500.0};
+  const double heaterCoeffs[Calibration::BAND_COUNT] = {0.0200, 0.0198, 0.0195};
+  const double coolingCoeffs[Calibration::BAND_COUNT] = {0.0105, 0.0110, 0.0115};
+  const double deadTimes[Calibration::BAND_COUNT] = {4.0, 5.0, 6.0};
+
+  for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++)
+  {
+    Calibration::BandCharacterization &band = summary.bands[index];
+    band.valid = true;
+    band.targetTemp = targets[index];
+    band.minTemp = minTemps[index];
+    band.maxTemp = maxTemps[index];
+    band.heaterCoeff = heaterCoeffs[index];
+    band.coolingCoeff = coolingCoeffs[index];
+    band.drift = 0.0;
+    band.deadTime = deadTimes[index];
+    band.timeConstant = 1.0 / band.coolingCoeff;
+    band.processGain = band.heaterCoeff / band.coolingCoeff;
+
+    double theta = band.deadTime;
+    double kc = band.timeConstant / (band.processGain * (2.0 * theta));
+    double tauI = min(band.timeConstant, 8.0 * theta);
+    band.kp = kc;
+    band.ki = kc / tauI;
+    band.kd = kc * theta / 3.0;
+  }
+  summary.validBandCount = Calibration::BAND_COUNT;
+  return summary;
+}
+
+// Loads the band schedule the way roaster-firmware.ino does after a
+// calibration has been applied.
+inline void applyCharacterization(const Calibration::CharacterizationSummary &summary)
+{
+  pidRuntimeController.setFallbackGains(kp, ki, kd);
+  pidRuntimeController.loadFromSummary(summary);
+  pidScheduleConfigured = pidRuntimeController.isEnabled();
+}
+
+// Runs the loaded `profile` from plant ambient until completion or timeout.
+inline Result run(const Calibration::CharacterizationSummary &plantModel, const Options &options = Options())
+{
+  Result result;
+  BandThermalPlant plant;
+  plant.configure(plantModel, options.plant);
+
+  HostClock::setMillis(1000);
+  unsigned long startMs = millis();
+  currentTemp = plant.readBeanSensor();
+  fanTemp = plant.readFanSensor();
+  heaterRelay.setPWM(0);
+  beanRorEstimator.reset();
+
+  roasterState = ROASTING;
+  profile.startProfile(static_cast<uint32_t>(lround(currentTemp)), startMs);
+  resetRoastControllerState();
+
+  PIDValidationSession tracking;
+  RoastProfile scratchProfile;
+  uint32_t saturatedTicks = 0;
+  unsigned long nextSampleMs = startMs;
+  double finalTarget = static_cast<double>(profile.getFinalTargetTemp());
+
+  while (millis() - startMs < options.timeoutMs)
+  {
+    unsigned long now = millis();
+    currentTemp = plant.readBeanSensor();
+    fanTemp = plant.readFanSensor();
+    recordBeanTempSample(now, currentTemp);
+
+    bool done = options.completeOnProgress ? profile.getProfileProgress(now) >= 100 : currentTemp >= finalTarget;
+    if (done)
+    {
+      result.completed = true;
+      break;
+    }
+
+    updateRoastControl(now);
+    result.controlTicks++;
+    if (options.trace != nullptr)
+    {
+      options.trace->push_back({now, heaterPidInputVal, heaterPidSetpointVal, appliedKp, appliedKi, appliedKd, heaterPidTrimVal});
+    }
+    if (heaterRelay.getPWM() >= 255)
+    {
+      saturatedTicks++;
+    }
+
+    if (now >= nextSampleMs)
+    {
+      nextSampleMs += options.sampleIntervalMs;
+      double error = currentTemp - setpointTemp;
+      if (!tracking.isActive() && fabs(error) < options.acquisitionBand)
+      {
+        tracking.start(scratchProfile, currentTemp);
+        result.acquisitionSeconds = static_cast<double>(now - startMs) / 1000.0;
+      }
+      if (tracking.isActive())
+      {
+        tracking.recordSample(currentTemp, setpointTemp);
+        result.maxOvershoot = max(result.maxOvershoot, error);
+      }
+    }
+
+    plant.advance(static_cast<double>(options.controlIntervalMs) / 1000.0, heaterRelay.getPWM());
+    HostClock::advanceMillis(options.controlIntervalMs);
+  }
+
+  result.durationSeconds = static_cast<double>(millis() - startMs) / 1000.0;
+  result.finalTemp = currentTemp;
+  if (result.controlTicks > 0)
+  {
+    result.heaterSaturationPercent = 100.0 * static_cast<double>(saturatedTicks) / static_cast<double>(result.controlTicks);
+  }
+  if (tracking.isActive())
+  {
+    tracking.finish(result.completed, result.durationSeconds, result.completed ? "profile_complete" : "timeout");
+  }
+  result.tracking = tracking.getSummary();
+
+  roasterState = IDLE;
+  resetRoastControllerState();
+  return result;
+}
+} // namespace RoastSim
+
+#endif // HOST_ROAST_SIMULATOR_HPP
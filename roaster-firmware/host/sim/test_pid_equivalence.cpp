@@ -0,0 +1,246 @@
+/**
+ * PID Numeric Equivalence Tests
+ *
+ * Replays simulated roasts of every profile in roast-profiles/ through the
+ * double, float and Q16.16 instantiations of BasicPIDController and fails when
+ * the reduced-precision heater output drifts from the double reference:
+ * - Q16.16 arithmetic rounds and saturates instead of wrapping
+ * - Replaying a recorded trace reproduces heaterPID's output exactly
+ * - float and Q16.16 stay within the stated tolerance of double on every tick
+ * - The firmware heater type, at the firmware's 250 ms step, still tracks
+ *   every profile in closed loop
+ */
+
+#include <AUnit.h>
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "ProfileJson.hpp"
+#include "RoastSimulator.hpp"
+
+using namespace aunit;
+
+// Heater output tolerances against the double controller, in PWM counts of
+// 255. The relay takes whole counts, so the mismatch bound only catches ticks
+// where a sub-count difference happens to straddle a rounding boundary.
+#define FLOAT_MAX_OUTPUT_DELTA 0.001
+#define FIXED_MAX_OUTPUT_DELTA 0.05
+#define MAX_PWM_MISMATCH_PERCENT 2.0
+#define MAX_MEAN_ABS_ERROR_F 4.0
+
+struct ReplayStats
+{
+  double maxDelta = 0.0;
+  uint32_t pwmMismatches = 0;
+  uint32_t ticks = 0;
+
+  double pwmMismatchPercent() const
+  {
+    return ticks > 0 ? 100.0 * static_cast<double>(pwmMismatches) / static_cast<double>(ticks) : 0.0;
+  }
+};
+
+static std::vector<std::string> listProfiles()
+{
+  std::vector<std::string> paths;
+  DIR *dir = opendir(ROASTER_PROFILES_DIR);
+  if (dir == nullptr)
+  {
+    return paths;
+  }
+  while (dirent *entry = readdir(dir))
+  {
+    std::string name = entry->d_name;
+    if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0)
+    {
+      paths.push_back(std::string(ROASTER_PROFILES_DIR) + "/" + name);
+    }
+  }
+  closedir(dir);
+  std::sort(paths.begin(), paths.end());
+  return paths;
+}
+
+// Feeds the recorded input, setpoint and gains to a fresh controller on the
+// recorded ticks and returns its output on each.
+template <typename Controller>
+static std::vector<double> replay(const std::vector<RoastSim::ControlTick> &trace)
+{
+  std::vector<double> outputs;
+  outputs.reserve(trace.size());
+  double input = 0.0;
+  double setpoint = 0.0;
+  double output = 0.0;
+  Controller pid(&input, &setpoint, &output, 0, 255, kp, ki, kd);
+  pid.setTimeStep(250);
+
+  for (const RoastSim::ControlTick &tick : trace)
+  {
+    input = tick.input;
+    setpoint = tick.setpoint;
+    pid.setGains(tick.kp, tick.ki, tick.kd);
+    pid.run(tick.nowMs);
+    outputs.push_back(output);
+  }
+  return outputs;
+}
+
+static ReplayStats compare(const std::vector<double> &reference, const std::vector<double> &candidate)
+{
+  ReplayStats stats;
+  for (size_t index = 0; index < reference.size() && index < candidate.size(); index++)
+  {
+    stats.maxDelta = max(stats.maxDelta, fabs(reference[index] - candidate[index]));
+    if (lround(reference[index]) != lround(candidate[index]))
+    {
+      stats.pwmMismatches++;
+    }
+    stats.ticks++;
+  }
+  return stats;
+}
+
+// Simulates `path` in closed loop with the firmware's heaterPID, recording
+// every control tick into `trace`.
+static RoastSim::Result recordRoast(const std::string &path, std::vector<RoastSim::ControlTick> &trace,
+                                    ProfileJson::Document &document)
+{
+  trace.clear();
+  if (!ProfileJson::loadFile(path, document) || !ProfileJson::applyTo(document, profile))
+  {
+    return RoastSim::Result();
+  }
+  Calibration::CharacterizationSummary model = RoastSim::makePopperCharacterization();
+  RoastSim::applyCharacterization(model);
+
+  RoastSim::Options options;
+  options.trace = &trace;
+  return RoastSim::run(model, options);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  TestRunner::setTimeout(60);
+  heaterPID.setTimeStep(250); // Same as main firmware
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Q16.16 Arithmetic Tests
+// ============================================================================
+
+test(Q16_RoundTripsAndRounds)
+{
+  assertEqual(Q16_16::ONE, Q16_16(1.0).getRaw());
+  assertEqual(-Q16_16::ONE, Q16_16(static_cast<int32_t>(-1)).getRaw());
+  assertNear(425.3, Q16_16(425.3).toDouble(), 1.0 / Q16_16::ONE);
+  assertNear(-0.35, static_cast<double>(Q16_16(-0.35)), 1.0 / Q16_16::ONE);
+
+  assertNear(2.875, (Q16_16(1.25) * Q16_16(2.3)).toDouble(), 1e-4);
+  assertNear(-12.5, (Q16_16(25.0) / Q16_16(-2.0)).toDouble(), 1e-9);
+  assertNear(0.1, (Q16_16(0.3) - Q16_16(0.2)).toDouble(), 2.0 / Q16_16::ONE);
+  assertTrue(Q16_16(0.5) > Q16_16());
+  assertTrue(-Q16_16(0.5) < Q16_16());
+}
+
+test(Q16_SaturatesInsteadOfWrapping)
+{
+  assertEqual(Q16_16::RAW_MAX, Q16_16(40000.0).getRaw());
+  assertEqual(Q16_16::RAW_MIN, Q16_16(-40000.0).getRaw());
+  assertEqual(Q16_16::RAW_MAX, (Q16_16(30000.0) + Q16_16(30000.0)).getRaw());
+  assertEqual(Q16_16::RAW_MIN, (Q16_16(-300.0) * Q16_16(300.0)).getRaw());
+  assertEqual(Q16_16::RAW_MAX, (Q16_16(255.0) / Q16_16::epsilon()).getRaw());
+  assertEqual(Q16_16::RAW_MIN, (Q16_16(-1.0) / Q16_16()).getRaw());
+  assertEqual(Q16_16::RAW_MAX, (-Q16_16::minValue()).getRaw());
+  assertEqual(0, Q16_16(NAN).getRaw());
+}
+
+// ============================================================================
+// Controller Equivalence Tests
+// ============================================================================
+
+test(PIDEquivalence_StepResponseMatchesDouble)
+{
+  double input = 150.0;
+  double setpoint = 250.0;
+  double referenceOut = 0.0;
+  double floatOut = 0.0;
+  double fixedOut = 0.0;
+  PIDController reference(&input, &setpoint, &referenceOut, 0, 255, 3.5, 0.09, 6.0);
+  FloatPIDController single(&input, &setpoint, &floatOut, 0, 255, 3.5, 0.09, 6.0);
+  FixedPIDController fixed(&input, &setpoint, &fixedOut, 0, 255, 3.5, 0.09, 6.0);
+  reference.setTimeStep(250);
+  single.setTimeStep(250);
+  fixed.setTimeStep(250);
+
+  // First-order plant driven by the reference output; all three see the
+  // same measurements, so any difference is numeric.
+  for (unsigned long now = 0; now < 600000UL; now += 250)
+  {
+    reference.run(now);
+    single.run(now);
+    fixed.run(now);
+    assertNear(referenceOut, floatOut, FLOAT_MAX_OUTPUT_DELTA);
+    assertNear(referenceOut, fixedOut, FIXED_MAX_OUTPUT_DELTA);
+    input += 0.25 * (0.02 * referenceOut - 0.01 * (input - 75.0));
+    if (now == 300000UL)
+    {
+      setpoint = 400.0;
+    }
+  }
+  assertNear(400.0, input, 2.0);
+  assertNear(reference.getIntegral(), fixed.getIntegral(), 0.5);
+}
+
+test(PIDEquivalence_ReplayReproducesHeaterPID)
+{
+  std::vector<std::string> paths = listProfiles();
+  assertMore(static_cast<int>(paths.size()), 0);
+
+  std::vector<RoastSim::ControlTick> trace;
+  ProfileJson::Document document;
+  assertTrue(recordRoast(paths.front(), trace, document).completed);
+  assertMore(static_cast<int>(trace.size()), 0);
+
+  std::vector<double> replayed = replay<HeaterPIDController>(trace);
+  for (size_t index = 0; index < trace.size(); index++)
+  {
+    assertEqual(trace[index].output, replayed[index]);
+  }
+}
+
+test(PIDEquivalence_AllRoastProfilesWithinTolerance)
+{
+  std::vector<std::string> paths = listProfiles();
+  assertMore(static_cast<int>(paths.size()), 0);
+
+  for (const std::string &path : paths)
+  {
+    std::vector<RoastSim::ControlTick> trace;
+    ProfileJson::Document document;
+    RoastSim::Result result = recordRoast(path, trace, document);
+    assertTrue(result.completed);
+    assertLess(result.tracking.meanAbsError, MAX_MEAN_ABS_ERROR_F);
+
+    std::vector<double> reference = replay<PIDController>(trace);
+    ReplayStats single = compare(reference, replay<FloatPIDController>(trace));
+    ReplayStats fixed = compare(reference, replay<FixedPIDController>(trace));
+    Serial.printf("  %-44s ticks=%u float=%.5f (%.2f%%) q16=%.5f (%.2f%%)\n", document.name.c_str(),
+                  static_cast<unsigned>(single.ticks), single.maxDelta, single.pwmMismatchPercent(),
+                  fixed.maxDelta, fixed.pwmMismatchPercent());
+
+    assertLess(single.maxDelta, FLOAT_MAX_OUTPUT_DELTA);
+    assertLess(fixed.maxDelta, FIXED_MAX_OUTPUT_DELTA);
+    assertLess(single.pwmMismatchPercent(), MAX_PWM_MISMATCH_PERCENT);
+    assertLess(fixed.pwmMismatchPercent(), MAX_PWM_MISMATCH_PERCENT);
+  }
+}
@@ -0,0 +1,276 @@
+/**
+ * Closed-Loop Roast Simulation Tests
+ *
+ * Runs updateRoastControl() against the band FOPDT plant for every profile in
+ * roast-profiles/ and fails when tracking regresses:
+ * - Every profile reaches its drop temperature near the scheduled time
+ * - Tracking error after acquisition stays within the regression bounds
+ * - The plant itself honors the band gain and dead time it was built from
+ * - The MPC heater mode tracks every profile at least as well as PID
+ * - The Smith-predictor mode improves the PIDValidationSession metrics over
+ *   plain PID, and stays stable when the plant's dead time and gain are off
+ */
+
+#include <AUnit.h>
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "ProfileJson.hpp"
+#include "RoastSimulator.hpp"
+
+using namespace aunit;
+
+// Regression bounds, set with margin over the current controller's results.
+#define MAX_ACQUISITION_SECONDS 75.0
+#define MAX_MEAN_ABS_ERROR_F 4.0
+#define MAX_ABS_ERROR_F 18.0
+#define MAX_OVERSHOOT_F 5.0
+#define MAX_LATE_FINISH_SECONDS 90.0
+#define MAX_MPC_MEAN_ABS_ERROR_F 1.0
+#define MAX_SMITH_MEAN_ABS_ERROR_F 1.5
+
+static std::vector<std::string> listProfiles()
+{
+  std::vector<std::string> paths;
+  DIR *dir = opendir(ROASTER_PROFILES_DIR);
+  if (dir == nullptr)
+  {
+    return paths;
+  }
+  while (dirent *entry = readdir(dir))
+  {
+    std::string name = entry->d_name;
+    if (name.size() > 5 && name.compare(name.size() - 5, 5, ".json") == 0)
+    {
+      paths.push_back(std::string(ROASTER_PROFILES_DIR) + "/" + name);
+    }
+  }
+  closedir(dir);
+  std::sort(paths.begin(), paths.end());
+  return paths;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  TestRunner::setTimeout(60);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Plant Model Tests
+// ============================================================================
+
+test(Plant_SteadyStateMatchesBandGain)
+{
+  Calibration::CharacterizationSummary model = RoastSim::makePopperCharacterization();
+  BandThermalPlant::Options options;
+  BandThermalPlant plant;
+  assertTrue(plant.configure(model, options));
+
+  // Band 0 holds below 230F: 75 + 0.020 * 60 / 0.0105 = ~189F
+  plant.advance(900.0, 60.0);
+  double expected = options.ambientTemp + model.bands[0].heaterCoeff * 60.0 / model.bands[0].coolingCoeff;
+  assertNear(expected, plant.getBeanTemp(), 0.5);
+  assertEqual(0, plant.getActiveBandIndex());
+}
+
+test(Plant_HonorsDeadTime)
+{
+  Calibration::CharacterizationSummary model = RoastSim::makePopperCharacterization();
+  BandThermalPlant plant;
+  assertTrue(plant.configure(model, BandThermalPlant::Options()));
+
+  plant.advance(model.bands[0].deadTime - 0.5, 255.0);
+  assertNear(75.0, plant.getBeanTemp(), 0.01);
+
+  plant.advance(2.0, 255.0);
+  assertMore(plant.getBeanTemp(), 76.0);
+}
+
+// ============================================================================
+// Closed-Loop Profile Tests
+// ============================================================================
+
+test(Sim_AllRoastProfilesTrack)
+{
+  std::vector<std::string> paths = listProfiles();
+  assertMore(static_cast<int>(paths.size()), 0);
+
+  Calibration::CharacterizationSummary model = RoastSim::makePopperCharacterization();
+  RoastSim::applyCharacterization(model);
+  assertTrue(pidScheduleConfigured);
+
+  for (const std::string &path : paths)
+  {
+    ProfileJson::Document document;
+    assertTrue(ProfileJson::loadFile(path, document));
+    assertTrue(ProfileJson::applyTo(document, profile));
+
+    RoastSim::Result result = RoastSim::run(model);
+    double scheduledSeconds = static_cast<double>(document.setpoints.back().timeSeconds);
+    Serial.printf("  %-44s %.0fs mae=%.2fF max=%.2fF over=%.2fF\n", document.name.c_str(),
+                  result.durationSeconds, result.tracking.meanAbsError, result.tracking.maxAbsError,
+                  result.maxOvershoot);
+
+    assertTrue(result.completed);
+    assertMore(result.acquisitionSeconds, 0.0);
+    assertLess(result.acquisitionSeconds, MAX_ACQUISITION_SECONDS);
+    assertLess(result.durationSeconds, scheduledSeconds + MAX_LATE_FINISH_SECONDS);
+    assertLess(result.tracking.meanAbsError, MAX_MEAN_ABS_ERROR_F);
+    assertLess(result.tracking.maxAbsError, MAX_ABS_ERROR_F);
+    assertLess(result.maxOvershoot, MAX_OVERSHOOT_F);
+  }
+}
+
+test(Sim_ValidationProfileCompletes)
+{
+  Calibration::CharacterizationSummary model = RoastSim::makePopperCharacterization();
+  RoastSim::applyCharacterization(model);
+  PIDValidationSession::buildValidationProfile(profile);
+
+  RoastSim::Options options;
+  options.completeOnProgress = true;
+  RoastSim::Result result = RoastSim::run(model, options);
+
+  assertTrue(result.completed);
+  assertNear(131.0, result.durationSeconds, 1.0);
+  assertMore(static_cast<int>(result.tracking.sampleCount), 60);
+}
+
+test(Sim_RunIsDeterministic)
+{
+  Calibration::CharacterizationSummary model = RoastSim::makePopperCharacterization();
+  RoastSim::applyCharacterization(model);
+  PIDValidationSession::buildValidationProfile(profile);
+
+  RoastSim::Options options;
+  options.completeOnProgress = true;
+  RoastSim::Result first = RoastSim::run(model, options);
+  RoastSim::Result second = RoastSim::run(model, options);
+
+  assertEqual(first.controlTicks, second.controlTicks);
+  assertEqual(first.tracking.meanAbsError, second.tracking.meanAbsError);
+  assertEqual(first.tracking.maxAbsError, second.tracking.maxAbsError);
+}
+
+test(Sim_MpcTracksAllProfiles)
+{
+  std::vector<std::string> paths = listProfiles();
+  assertMore(static_cast<int>(paths.size()), 0);
+
+  Calibration::CharacterizationSummary model = RoastSim::makePopperCharacterization();
+  RoastSim::applyCharacterization(model);
+
+  for (const std::string &path : paths)
+  {
+    ProfileJson::Document document;
+    assertTrue(ProfileJson::loadFile(path, document));
+    assertTrue(ProfileJson::applyTo(document, profile));
+
+    heaterControlMode = HEATER_MODE_PID;
+    RoastSim::Result pid = RoastSim::run(model);
+    heaterControlMode = HEATER_MODE_MPC;
+    RoastSim::Result mpc = RoastSim::run(model);
+    heaterControlMode = HEATER_MODE_PID;
+    Serial.printf("  %-44s pid mae=%.2fF  mpc mae=%.2fF max=%.2fF over=%.2fF\n", document.name.c_str(),
+                  pid.tracking.meanAbsError, mpc.tracking.meanAbsError, mpc.tracking.maxAbsError, mpc.maxOvershoot);
+
+    assertTrue(mpc.completed);
+    assertLess(mpc.tracking.meanAbsError, MAX_MPC_MEAN_ABS_ERROR_F);
+    assertLess(mpc.tracking.meanAbsError, pid.tracking.meanAbsError);
+    assertLess(mpc.tracking.maxAbsError, MAX_ABS_ERROR_F);
+    assertLess(mpc.maxOvershoot, MAX_OVERSHOOT_F);
+  }
+}
+
+// Validation profile, then every roast profile, in PID and Smith modes. The
+// validation run is scored exactly as the on-device validation is.
+test(Sim_SmithPredictorImprovesValidationMetrics)
+{
+  Calibration::CharacterizationSummary model = RoastSim::makePopperCharacterization();
+  RoastSim::applyCharacterization(model);
+
+  RoastSim::Options options;
+  options.completeOnProgress = true;
+  PIDValidationSession::buildValidationProfile(profile);
+  heaterControlMode = HEATER_MODE_PID;
+  PIDValidationSession::Summary pid = RoastSim::run(model, options).tracking;
+  heaterControlMode = HEATER_MODE_SMITH;
+  PIDValidationSession::Summary smith = RoastSim::run(model, options).tracking;
+  heaterControlMode = HEATER_MODE_PID;
+  Serial.printf("  validation pid mae=%.2fF rmse=%.2fF in2=%.1f%%  smith mae=%.2fF rmse=%.2fF in2=%.1f%%\n",
+                pid.meanAbsError, pid.rmse, pid.withinTwoDegreesPercent, smith.meanAbsError, smith.rmse,
+                smith.withinTwoDegreesPercent);
+
+  assertTrue(smith.complete);
+  assertLess(smith.meanAbsError, pid.meanAbsError);
+  assertLess(smith.rmse, pid.rmse);
+  assertMore(smith.withinTwoDegreesPercent, pid.withinTwoDegreesPercent);
+
+  std::vector<std::string> paths = listProfiles();
+  assertMore(static_cast<int>(paths.size()), 0);
+  for (const std::string &path : paths)
+  {
+    ProfileJson::Document document;
+    assertTrue(ProfileJson::loadFile(path, document));
+    assertTrue(ProfileJson::applyTo(document, profile));
+
+    RoastSim::Result pidRoast = RoastSim::run(model);
+    heaterControlMode = HEATER_MODE_SMITH;
+    RoastSim::Result smithRoast = RoastSim::run(model);
+    heaterControlMode = HEATER_MODE_PID;
+    Serial.printf("  %-44s pid mae=%.2fF  smith mae=%.2fF max=%.2fF over=%.2fF\n", document.name.c_str(),
+                  pidRoast.tracking.meanAbsError, smithRoast.tracking.meanAbsError, smithRoast.tracking.maxAbsError,
+                  smithRoast.maxOvershoot);
+
+    assertTrue(smithRoast.completed);
+    assertLess(smithRoast.tracking.meanAbsError, MAX_SMITH_MEAN_ABS_ERROR_F);
+    assertLess(smithRoast.tracking.meanAbsError, pidRoast.tracking.meanAbsError);
+    assertLess(smithRoast.tracking.maxAbsError, MAX_ABS_ERROR_F);
+    assertLess(smithRoast.maxOvershoot, MAX_OVERSHOOT_F);
+  }
+}
+
+// The controller keeps the calibrated models while the plant runs 30% more
+// dead time and a 15% weaker element, the drift a real popper shows as the
+// element ages and the batch size changes.
+test(Sim_SmithPredictorToleratesModelMismatch)
+{
+  Calibration::CharacterizationSummary model = RoastSim::makePopperCharacterization();
+  RoastSim::applyCharacterization(model);
+  Calibration::CharacterizationSummary plantModel = model;
+  for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++)
+  {
+    plantModel.bands[index].deadTime *= 1.3;
+    plantModel.bands[index].heaterCoeff *= 0.85;
+  }
+
+  std::vector<std::string> paths = listProfiles();
+  assertMore(static_cast<int>(paths.size()), 0);
+  for (const std::string &path : paths)
+  {
+    ProfileJson::Document document;
+    assertTrue(ProfileJson::loadFile(path, document));
+    assertTrue(ProfileJson::applyTo(document, profile));
+
+    heaterControlMode = HEATER_MODE_SMITH;
+    RoastSim::Result result = RoastSim::run(plantModel);
+    heaterControlMode = HEATER_MODE_PID;
+    Serial.printf("  %-44s mismatched smith mae=%.2fF max=%.2fF over=%.2fF\n", document.name.c_str(),
+                  result.tracking.meanAbsError, result.tracking.maxAbsError, result.maxOvershoot);
+
+    assertTrue(result.completed);
+    assertLess(result.tracking.meanAbsError, MAX_MEAN_ABS_ERROR_F);
+    assertLess(result.tracking.maxAbsError, MAX_ABS_ERROR_F);
+    assertLess(result.maxOvershoot, MAX_OVERSHOOT_F);
+  }
+}
@@ -1,5 +1,4 @@
 #include "Arduino.h"
-#include <max6675.h>
 #include <SimpleTimer.h>
 #include <PWMrelay.h>
 #include <SPI.h>
@@ -27,6 +26,10 @@
 
 #include "src/platform/RoasterTypes.hpp"
 #include "src/platform/BoardConfig.hpp"
+#include "src/platform/ControlTask.hpp"
+#include "src/platform/PreferencesJournal.hpp"
+#include "src/support/PerfStats.hpp"
+#include "src/sensors/ThermocoupleAcquisition.hpp"
 #include "src/display/DisplayBackendConfig.hpp"
 #include "src/support/DebugLog.hpp"
 #include "src/display/DisplayAdapter.hpp"
@@ -49,6 +52,18 @@ bool canClearErrorState();
 #include "src/network/Network.hpp"
 
 Preferences preferences;
+// Settings go through here so bursts of puts cost one batch of NVS commits
+// from loop() instead of one blocking commit each.
+PreferencesJournal preferencesJournal(preferences);
+
+// Profiles share the settings namespace unless the firmware is built for
+// the LittleFS store (see src/profiles/ProfileStore.hpp).
+#if ROASTER_PROFILE_STORE == ROASTER_PROFILE_STORE_LITTLEFS
+FileStore profileFiles;
+ProfileStore &profileStore = profileFiles;
+#else
+ProfileStore &profileStore = preferences;
+#endif
 
 // Pin definitions
 constexpr int TC1_CS = BoardConfig::BeanThermocoupleChipSelectPin;
@@ -71,14 +86,23 @@ double kd = 0;
 #define VERSION "2025-12-24"
 #endif
 
-// Use timers for simple multitasking
-SimpleTimer checkTempTimer(125);
+// Sensor reads, safety checks and the PID step run on a dedicated task
+// (see runControlCycle); everything else is polled from loop() on timers.
+ControlTask controlTask;
 SimpleTimer tickTimer(5);
-SimpleTimer controlLoopTimer(250);
 SimpleTimer stateMachineTimer(500);
 SimpleTimer wsBroadcastTimer(1000);  // WebSocket broadcast every 1 second
 SimpleTimer roastTraceTimer(1000);   // Roast trace capture every 1 second
 
+// Lateness/runtime histograms per timer, served at /api/perf
+PerfChannel perfControl("control", 125);
+PerfChannel perfTick("tick", 5);
+PerfChannel perfStateMachine("stateMachine", 500);
+PerfChannel perfWsBroadcast("wsBroadcast", 1000);
+PerfChannel perfRoastTrace("roastTrace", 1000);
+PerfChannel perfLoop("loop", 0);
+volatile bool perfResetRequested = false;
+
 // PWM is used to control fan and heater outputs
 PWMrelay heaterRelay(HEATER, HIGH);
 PWMrelay fanRelay(FAN, HIGH);
@@ -102,10 +126,18 @@ static void configureJcHeapForPsram() {
 RoastProfile profile;
 ProfileManager profileManager;
 
+// Completed roasts on flash under /roasts, with or without SystemLink. Opt-in
+// with ROASTER_ROAST_ARCHIVE=1, which also needs a filesystem partition.
+LittleFsRoastFiles roastFiles;
+RoastArchive roastArchive(roastFiles);
+unsigned long roastArchiveStartedAtMs = 0;
+
 // Roaster state variables
 // NOTE: All temperature values throughout this codebase are in Fahrenheit (°F)
 double currentTemp = 0;     // Current bean temperature (°F)
 double setpointTemp = 0;    // Target temperature from profile (°F)
+double heaterPidInputVal = 0;    // heaterPID input: bean temp, plus the Smith correction
+double heaterPidSetpointVal = 0; // heaterPID setpoint: profile, one dead time ahead in Smith mode
 double heaterOutputVal = 0; // Final heater command (0-255)
 double heaterPidTrimVal = 0;
 double heaterFeedforwardVal = 0;
@@ -113,10 +145,12 @@ byte setpointFanSpeed = 0;  // Target fan speed (0-255)
 int setpointProgress = 0;   // Roast time in seconds
 int bdcFanMs = 800;         // BDC fan servo pulse width (800-2000 µs)
 double fanTemp = 0;         // Inlet/fan temperature sensor (°F)
+double rateOfRise = 0;      // Bean rate of rise (°F/min), 0 until the RoR window has samples
 int badReadingCount = 0;    // Track consecutive bad thermocouple readings
 char lastRejectedBeanReadReason[16] = "none";
 char activeFaultCode[32] = "none";
 char activeFaultMessage[96] = "";
+volatile bool emergencyFaultPending = false; // Set by the control task, reported from loop()
 
 // Restart handling
 bool restartRequested = false;
@@ -134,6 +168,92 @@ WifiCredentials wifiCredentials;
 
 // Roaster state variable (enum defined in RoasterTypes.hpp)
 RoasterState roasterState = IDLE;
+HeaterControlMode heaterControlMode = HEATER_MODE_PID;
+
+static RoastArchiveOutcome roastArchiveOutcomeFor(SystemLinkRoastOutcome outcome)
+{
+  switch (outcome)
+  {
+  case SYSTEMLINK_OUTCOME_PASSED:
+    return ROAST_ARCHIVE_PASSED;
+  case SYSTEMLINK_OUTCOME_TERMINATED:
+    return ROAST_ARCHIVE_TERMINATED;
+  case SYSTEMLINK_OUTCOME_ERRORED:
+    return ROAST_ARCHIVE_ERRORED;
+  case SYSTEMLINK_OUTCOME_NONE:
+  default:
+    return ROAST_ARCHIVE_RECORDING;
+  }
+}
+
+// Roast archive hooks, called from loop() next to the SystemLink ones
+void archiveRoastStarted()
+{
+  if (!roastArchive.isAvailable())
+  {
+    return;
+  }
+
+  RoastArchiveHeader info;
+  String activeId = profileManager.getActiveProfileId();
+  String activeName;
+  profileManager.loadProfileMeta(activeId, activeName);
+  roastArchiveCopyString(info.profileId, sizeof(info.profileId), activeId.c_str());
+  roastArchiveCopyString(info.profileName, sizeof(info.profileName), activeName.c_str());
+  time_t now = time(nullptr);
+  info.startedAt = now > 1600000000 ? static_cast<uint32_t>(now) : 0;
+  info.finalTargetTempF = getEffectiveFinalTargetTemp();
+  info.kp = static_cast<float>(kp);
+  info.ki = static_cast<float>(ki);
+  info.kd = static_cast<float>(kd);
+  roastArchiveStartedAtMs = millis();
+  if (roastArchive.startRoast(info))
+  {
+    LOG_INFOF("Roast archive: recording roast %lu", (unsigned long)roastArchive.currentId());
+  }
+  else
+  {
+    LOG_WARN("Roast archive: could not create roast file");
+  }
+}
+
+void archiveRoastSample()
+{
+  if (!roastArchive.isRecording())
+  {
+    return;
+  }
+
+  RoastArchiveSample sample;
+  sample.elapsedSeconds = (millis() - roastArchiveStartedAtMs) / 1000UL;
+  sample.beanTenthsF = static_cast<int16_t>(lroundf(static_cast<float>(currentTemp) * 10.0f));
+  sample.targetTenthsF = static_cast<int16_t>(lroundf(static_cast<float>(setpointTemp) * 10.0f));
+  sample.heaterTenths = static_cast<int16_t>(lroundf(static_cast<float>(heaterOutputVal) * 10.0f));
+  sample.fanTempTenthsF = static_cast<int16_t>(lroundf(static_cast<float>(fanTemp) * 10.0f));
+  sample.fanTenths = static_cast<int16_t>(setpointFanSpeed * 10);
+  roastArchive.recordSample(sample);
+}
+
+void archiveRoastOutcome(SystemLinkRoastOutcome outcome, const char *reason)
+{
+  roastArchive.noteOutcome(roastArchiveOutcomeFor(outcome), reason);
+}
+
+void archiveRoastFinished(SystemLinkRoastOutcome outcome, const char *reason)
+{
+  if (!roastArchive.isRecording())
+  {
+    return;
+  }
+
+  uint32_t id = roastArchive.currentId();
+  if (!roastArchive.finishRoast(roastArchiveOutcomeFor(outcome), reason))
+  {
+    LOG_WARNF("Roast archive: roast %lu was not fully written", (unsigned long)id);
+  }
+  LOG_INFOF("Roast archive: saved roast %lu (%u roasts, %u bytes)", (unsigned long)id,
+            (unsigned)roastArchive.snapshot().size(), (unsigned)roastArchive.totalBytes());
+}
 
 inline bool shouldFilterBeanTempSpikes()
 {
@@ -192,7 +312,9 @@ inline void setActiveFault(const char *faultCode, const char *displayMessage)
 inline String formatBeanSensorFaultMessage(double reading)
 {
   char buffer[96];
-  const char *reason = strcmp(lastRejectedBeanReadReason, "spike") == 0 ? "unstable" : "range error";
+  const char *reason = strcmp(lastRejectedBeanReadReason, "spike") == 0  ? "unstable"
+                       : strcmp(lastRejectedBeanReadReason, "open") == 0 ? "open circuit"
+                                                                         : "range error";
   snprintf(buffer, sizeof(buffer), "Bean sensor %s (raw %.1fF)", reason, reading);
   return String(buffer);
 }
@@ -226,6 +348,8 @@ inline String formatErrorRecoveryBlockedMessage()
   return String("Fault lockout remains active until the controller reports a safe state.");
 }
 
+// Returns to IDLE with the outputs off. Called under ControlLock; the caller
+// updates SystemLink and the display after releasing it.
 inline void clearEmergencyErrorState()
 {
   LOG_INFOF("Clearing error state: fault=%s bean=%.1fF fan=%.1fF", activeFaultCode, currentTemp, fanTemp);
@@ -247,12 +371,11 @@ inline void clearEmergencyErrorState()
   fanRelay.setPWM(0);
   bdcFan.writeMicroseconds(800);
   bdcFanMs = 800;
-
-  systemLinkUpdateLastFault("none");
-  displayShowScreen(DisplayScreen::Start);
 }
 
-inline void enterEmergencyErrorState(const char *faultCode, const char *displayMessage)
+// Safety half of a fault: forces the outputs safe and latches ERROR. Safe to
+// call from the control task.
+inline void latchEmergencyErrorState(const char *faultCode, const char *displayMessage)
 {
   setActiveFault(faultCode, displayMessage);
   roasterState = ERROR;
@@ -262,25 +385,46 @@ inline void enterEmergencyErrorState(const char *faultCode, const char *displayM
   fanRelay.setPWM(255);
   bdcFan.writeMicroseconds(2000);
   bdcFanMs = 2000;
-  systemLinkUpdateLastFault(faultCode);
-  systemLinkFinishRoast(SYSTEMLINK_OUTCOME_ERRORED, faultCode);
+  emergencyFaultPending = true;
+}
+
+// Reporting half of a fault, run from loop(): SystemLink and the LVGL display
+// must not be driven from the control task.
+inline void publishPendingEmergencyFault()
+{
+  if (!emergencyFaultPending)
+  {
+    return;
+  }
+
+  emergencyFaultPending = false;
+  systemLinkUpdateLastFault(activeFaultCode);
+  systemLinkFinishRoast(SYSTEMLINK_OUTCOME_ERRORED, activeFaultCode);
+  archiveRoastFinished(SYSTEMLINK_OUTCOME_ERRORED, activeFaultCode);
   displayShowErrorMessage(activeFaultMessage);
 }
 
-MAX6675 thermocouple(THERMOCOUPLE_SCK, TC1_CS, THERMOCOUPLE_MISO);
-MAX6675 thermocoupleFan(THERMOCOUPLE_SCK, TC2_CS, THERMOCOUPLE_MISO);
-PIDController heaterPID(&currentTemp, &setpointTemp, &heaterPidTrimVal, 0, 255, kp, ki, kd);
+// Thermocouple channels on the shared SPI bus, in chip-select order
+constexpr uint8_t BEAN_THERMOCOUPLE = 0;
+constexpr uint8_t FAN_THERMOCOUPLE = 1;
+const int thermocoupleChipSelects[] = {TC1_CS, TC2_CS};
+Max6675SpiTransport thermocoupleTransport(THERMOCOUPLE_SCK, THERMOCOUPLE_MISO, thermocoupleChipSelects, 2);
+ThermocoupleAcquisition thermocoupleAcquisition;
+ThermocoupleFilter beanTempFilter;
+ThermocoupleFilter fanTempFilter;
+HeaterPIDController heaterPID(&heaterPidInputVal, &heaterPidSetpointVal, &heaterPidTrimVal, 0, 255, kp, ki, kd);
 StepResponseTuner stepTuner;
 bool autoValidateAfterCooling = false;
 PIDRuntimeController pidRuntimeController;
+RateOfRiseEstimator beanRorEstimator(ROR_WINDOW_DEFAULT_SECONDS * 1000UL);
 PIDValidationSession pidValidation;
 
-uint8_t profileBuffer[200];
 int finalTempOverride = -1; // UI override for final target temp (F)
 RoastProfile validationSavedProfile;
 bool validationProfileLoaded = false;
 int savedValidationFinalTempOverride = -1;
 unsigned long roastStartedAtMs = 0;
+bool roastStartPending = false; // Set by startRoastSession(), announced by the state machine
 double appliedKp = kp;
 double appliedKi = ki;
 double appliedKd = kd;
@@ -311,6 +455,7 @@ uint32_t getEffectiveFinalTargetTemp()
   {
     return constrain(finalTempOverride, 0, 500);
   }
+  ControlLock controlLock;  // Recursive, so callers may already hold it
   return profile.getFinalTargetTemp();
 }
 
@@ -326,6 +471,14 @@ void updateCalibrationControl(unsigned long now)
 
 void updateStepResponseCalibration(unsigned long now)
 {
+  if (stepTuner.isComplete() || !stepTuner.isRunning())
+  {
+    // Session is over; hold the heater off until loop() applies the results.
+    heaterOutputVal = 0;
+    heaterRelay.setPWM(0);
+    return;
+  }
+
   heaterOutputVal = stepTuner.getOutput(currentTemp, fanTemp, setpointFanSpeed);
   setpointTemp = stepTuner.getSetpoint();
   heaterPidTrimVal = heaterOutputVal;
@@ -337,14 +490,84 @@ void updateStepResponseCalibration(unsigned long now)
   bdcFan.writeMicroseconds(calibrationBdcValue);
   bdcFanMs = calibrationBdcValue;
   heaterRelay.setPWM(heaterOutputVal);
+}
+
+// What one state-machine step leaves for loop() to do once it has released
+// ControlLock: display updates, WebSocket pushes, SystemLink and roast
+// archive bookkeeping and flash writes. The control task must never wait
+// behind any of them.
+struct StateMachineEffects
+{
+  static constexpr uint8_t MAX_PUSH_MESSAGES = 2;
+
+  bool hasTelemetry = false;
+  DisplayTelemetry telemetry;
+  bool hasScreen = false;
+  DisplayScreen screen = DisplayScreen::Start;
+  int screenTargetTempF = -1; // Sent before the screen change when set
+
+  const char *pushMessages[MAX_PUSH_MESSAGES] = {};
+  uint8_t pushCount = 0;
+
+  bool roastStarted = false;
+  bool roastingPhaseStarted = false;
+  bool coolingPhaseStarted = false;
+  bool roastEnded = false;
+  SystemLinkRoastOutcome outcome = SYSTEMLINK_OUTCOME_NONE;
+  const char *outcomeReason = "";
+
+  bool calibrationSaved = false;
+  bool startAutoValidation = false;
+
+  void show(const DisplayTelemetry &value)
+  {
+    telemetry = value;
+    hasTelemetry = true;
+  }
+
+  void showScreen(DisplayScreen value, int targetTempF = -1)
+  {
+    screen = value;
+    screenTargetTempF = targetTempF;
+    hasScreen = true;
+  }
+
+  void push(const char *message)
+  {
+    if (pushCount < MAX_PUSH_MESSAGES)
+    {
+      pushMessages[pushCount++] = message;
+    }
+  }
+
+  void coolingStarted(SystemLinkRoastOutcome value, const char *reason)
+  {
+    coolingPhaseStarted = true;
+    outcome = value;
+    outcomeReason = reason;
+    showScreen(DisplayScreen::Cooling, COOLING_TARGET_TEMP);
+  }
 
+  void roastFinished(SystemLinkRoastOutcome value, const char *reason)
+  {
+    roastEnded = true;
+    outcome = value;
+    outcomeReason = reason;
+  }
+};
+
+// Applies or reports the end of a step-response session. Runs from the state
+// machine in loop() under ControlLock; the Preferences flush, the SystemLink
+// publish and the screen change are left in `effects`.
+bool finishStepResponseCalibrationIfEnded(StateMachineEffects &effects)
+{
   if (stepTuner.isComplete())
   {
     double newKp, newKi, newKd;
     stepTuner.getPID(newKp, newKi, newKd);
 
     setManualPIDGains(newKp, newKi, newKd);
-    pidRuntimeController.clearPreferences(preferences);
+    pidRuntimeController.clearPreferences(preferencesJournal);
     pidScheduleConfigured = false;
     activePidBandIndex = -1;
 
@@ -352,22 +575,21 @@ void updateStepResponseCalibration(unsigned long now)
     Calibration::CharacterizationSummary cs = stepTuner.getCharacterizationSummary();
     pidRuntimeController.loadFromSummary(cs);
     if (pidRuntimeController.isEnabled()) {
-      pidRuntimeController.saveToPreferences(preferences);
+      pidRuntimeController.saveToPreferences(preferencesJournal);
       pidScheduleConfigured = true;
       LOG_INFO("Step-response band models loaded into gain scheduler");
     }
 
     LOG_INFOF("Step-response tuning saved: Kp=%.4f, Ki=%.6f, Kd=%.4f", kp, ki, kd);
-
-    // Publish calibration data to SystemLink
-    systemLinkPublishCalibration(stepTuner);
+    effects.calibrationSaved = true;
 
     resetRoastControllerState();
     heaterRelay.setPWM(0);
     autoValidateAfterCooling = true;
-    enterCoolingState();
-    sendWsMessage("{ \"pushMessage\": \"pidTuningComplete\" }");
-    return;
+    enterCoolingControlState();
+    effects.showScreen(DisplayScreen::Cooling, COOLING_TARGET_TEMP);
+    effects.push("{ \"pushMessage\": \"pidTuningComplete\" }");
+    return true;
   }
 
   if (!stepTuner.isRunning())
@@ -375,14 +597,558 @@ void updateStepResponseCalibration(unsigned long now)
     LOG_WARNF("Step-response tuning ended: %s", stepTuner.getLastError());
     resetRoastControllerState();
     heaterRelay.setPWM(0);
-    enterCoolingState();
+    enterCoolingControlState();
+    effects.showScreen(DisplayScreen::Cooling, COOLING_TARGET_TEMP);
     if (strcmp(stepTuner.getLastError(), "cancelled") == 0)
     {
-      sendWsMessage("{ \"pushMessage\": \"pidTuningCancelled\" }");
+      effects.push("{ \"pushMessage\": \"pidTuningCancelled\" }");
     }
     else
     {
-      sendWsMessage("{ \"pushMessage\": \"pidTuningFailed\" }");
+      effects.push("{ \"pushMessage\": \"pidTuningFailed\" }");
+    }
+    return true;
+  }
+
+  return false;
+}
+
+// Bean thermocouple sample with range/spike rejection and the
+// over-temperature checks. Runs on the control task.
+void handleBeanSample(const ThermocoupleSample &sample)
+{
+  double reading = sample.fahrenheit();
+  double previousAcceptedTemp = currentTemp;
+  double lastValidTemp = beanTempFilter.getLastValid();
+
+  // Open input, out-of-range (MAX6675 returns ~2048°F on some wiring faults)
+  // and physically impossible jumps are all rejected by the filter.
+  ThermocoupleFilter::Verdict verdict = beanTempFilter.evaluate(reading, shouldFilterBeanTempSpikes());
+  if (verdict == ThermocoupleFilter::SPIKE)
+  {
+    setLastRejectedBeanReadReason("spike");
+    LOG_WARNF("Temp spike ignored: lastValid=%.1fF raw=%.1fF accepted=%.1fF", lastValidTemp, reading, previousAcceptedTemp);
+  }
+  else if (verdict != ThermocoupleFilter::ACCEPTED)
+  {
+    setLastRejectedBeanReadReason(ThermocoupleFilter::verdictName(verdict));
+    LOG_WARNF("Temp %s error ignored: raw=%.1fF accepted=%.1fF lastValid=%.1fF", ThermocoupleFilter::verdictName(verdict), reading, previousAcceptedTemp, lastValidTemp);
+  }
+
+  if (verdict != ThermocoupleFilter::ACCEPTED)
+  {
+    badReadingCount++;
+    if (badReadingCount >= MAX_BAD_READINGS)
+    {
+      // SENSOR FAILURE - EMERGENCY STOP
+      DEBUG_PRINTLN("EMERGENCY: Thermocouple failure detected!");
+      String message = formatBeanSensorFaultMessage(reading);
+      latchEmergencyErrorState("sensor_failed", message.c_str());
+    }
+  }
+  else
+  {
+    currentTemp = reading;
+    badReadingCount = 0; // Reset counter on good reading
+    recordBeanTempSample(millis(), reading);
+
+    if (previousAcceptedTemp > 0.0) {
+      bool suspiciousLowLatch = reading <= 40.0 && previousAcceptedTemp >= 80.0;
+      bool largeAcceptedDrop = abs(reading - previousAcceptedTemp) >= 20.0;
+      if (suspiciousLowLatch || largeAcceptedDrop) {
+        LOG_WARNF("Bean temp accepted: prev=%.1fF raw=%.1fF new=%.1fF lastValid=%.1fF state=%d heater=%.1f", previousAcceptedTemp, reading, currentTemp, beanTempFilter.getLastValid(), roasterState, heaterOutputVal);
+      }
+    }
+
+    if (isRoastActiveState() && currentTemp > MAX_ROAST_TEMP)
+    {
+      DEBUG_PRINTLN("EMERGENCY: Roast temperature limit exceeded!");
+      latchEmergencyErrorState("roast_over_temperature", "Roast Over Temp");
+    }
+
+    // THERMAL RUNAWAY PROTECTION
+    if (roasterState != ERROR && currentTemp > MAX_SAFE_TEMP)
+    {
+      // EMERGENCY SHUTDOWN
+      DEBUG_PRINTLN("EMERGENCY: Thermal runaway detected!");
+      latchEmergencyErrorState("over_temperature", "Over Temp");
+    }
+  }
+}
+
+// Exhaust/fan thermocouple sample and the fan over-temperature trip. Runs on
+// the control task.
+void handleFanSample(const ThermocoupleSample &sample)
+{
+  static int fanOverTempCount = 0;
+  static bool fanTempSafetyArmedLogged = false;
+  static bool fanTempSafetyDelayLogged = false;
+
+  double fReading = sample.fahrenheit();
+  const bool fanTempSafetyArmed = shouldEnforceFanTempSafety();
+
+  // The implausibility check must not move the spike reference, so it runs
+  // before the filter sees the reading.
+  bool isImplausibleFanReading = false;
+  if (!isnan(fReading) && fReading <= SENSOR_FAULT_TEMP && heaterOutputVal <= 0.0 && currentTemp < 140.0) {
+    if (fReading > currentTemp + 30.0) {
+      isImplausibleFanReading = true;
+      fanOverTempCount = 0;
+      LOG_WARNF("Fan temp implausible with heater off ignored: bean=%.1fF fan=%.1fF", currentTemp, fReading);
+    }
+  }
+
+  ThermocoupleFilter::Verdict verdict = ThermocoupleFilter::ACCEPTED;
+  if (!isImplausibleFanReading) {
+    double lastValidFanTemp = fanTempFilter.getLastValid();
+    verdict = fanTempFilter.evaluate(fReading, shouldFilterFanTempSpikes());
+    if (verdict == ThermocoupleFilter::SPIKE) {
+      fanOverTempCount = 0;
+      LOG_WARNF("Fan temp spike ignored: %.1f -> %.1f", lastValidFanTemp, fReading);
+    } else if (verdict != ThermocoupleFilter::ACCEPTED) {
+      fanOverTempCount = 0;
+      LOG_WARNF("Fan temp %s error ignored: %.1f", ThermocoupleFilter::verdictName(verdict), fReading);
+    }
+  }
+
+  if (verdict == ThermocoupleFilter::ACCEPTED && !isImplausibleFanReading) {
+    fanTemp = fReading;
+
+    if (roasterState == ROASTING && !fanTempSafetyArmed) {
+      if (roastStartedAtMs > 0 && !fanTempSafetyDelayLogged) {
+        unsigned long warmupRemainingMs = FAN_TEMP_SAFETY_ARM_DELAY_MS;
+        unsigned long elapsedRoastMs = millis() - roastStartedAtMs;
+        if (elapsedRoastMs < FAN_TEMP_SAFETY_ARM_DELAY_MS) {
+          warmupRemainingMs = FAN_TEMP_SAFETY_ARM_DELAY_MS - elapsedRoastMs;
+        } else {
+          warmupRemainingMs = 0;
+        }
+
+        LOG_INFOF("Fan temp safety delayed: remaining=%lums bean=%.1fF fan=%.1fF heater=%.1f",
+                  warmupRemainingMs,
+                  currentTemp,
+                  fanTemp,
+                  heaterOutputVal);
+        fanTempSafetyDelayLogged = true;
+      }
+      fanTempSafetyArmedLogged = false;
+    } else if (fanTempSafetyArmed && !fanTempSafetyArmedLogged) {
+      LOG_INFOF("Fan temp safety armed: elapsed=%lus bean=%.1fF fan=%.1fF heater=%.1f threshold=%.1fF",
+                roastStartedAtMs > 0 ? (millis() - roastStartedAtMs) / 1000UL : 0UL,
+                currentTemp,
+                fanTemp,
+                heaterOutputVal,
+                MAX_SAFE_FAN_TEMP);
+      fanTempSafetyArmedLogged = true;
+    }
+
+    // Require the over-temp reading to persist briefly so one noisy sample
+    // cannot immediately trip the roaster into an error state.
+    if (fanTempSafetyArmed && fanTemp > MAX_SAFE_FAN_TEMP) {
+      fanOverTempCount++;
+      LOG_WARNF("Fan temp over threshold (%d/3): %.1fF bean=%.1fF heater=%.1f elapsed=%lus",
+                fanOverTempCount,
+                fanTemp,
+                currentTemp,
+                heaterOutputVal,
+                roastStartedAtMs > 0 ? (millis() - roastStartedAtMs) / 1000UL : 0UL);
+      if (fanOverTempCount >= 3) {
+        DEBUG_PRINTLN("EMERGENCY: Fan/Exhaust Over Temp!");
+        LOG_ERRORF("Fan temp safety trip: bean=%.1fF fan=%.1fF heater=%.1f elapsed=%lus threshold=%.1fF",
+                   currentTemp,
+                   fanTemp,
+                   heaterOutputVal,
+                   roastStartedAtMs > 0 ? (millis() - roastStartedAtMs) / 1000UL : 0UL,
+                   MAX_SAFE_FAN_TEMP);
+        latchEmergencyErrorState("fan_over_temperature", "Fan over temp");
+      }
+    } else {
+      fanOverTempCount = 0;
+    }
+  }
+}
+
+// One 125 ms control-task cycle. The acquisition engine staggers the bean and
+// fan reads so both are never taken in the same window (4 Hz each), and the
+// 250 ms control step runs right after each fresh bean sample.
+void runControlCycle(unsigned long now)
+{
+  PerfScope perfScope(perfControl, controlTask.getCurrentReleaseUs());
+  thermocoupleAcquisition.poll(static_cast<uint32_t>(micros()));
+
+  bool freshBeanSample = false;
+  ThermocoupleSample sample;
+  while (thermocoupleAcquisition.pop(sample))
+  {
+    if (sample.channel == BEAN_THERMOCOUPLE)
+    {
+      handleBeanSample(sample);
+      freshBeanSample = true;
+    }
+    else if (sample.channel == FAN_THERMOCOUPLE)
+    {
+      handleFanSample(sample);
+    }
+  }
+
+  if (!freshBeanSample)
+  {
+    return;
+  }
+
+  updateRoastControl(now);
+  updateCalibrationControl(now);
+  systemLinkRecordHighRateSample();
+}
+
+// Clears every perf histogram. Runs from loop() so it never races the timers
+// it resets; the control channel is only touched under ControlLock.
+void resetPerfStats()
+{
+  perfResetRequested = false;
+  perfTick.reset();
+  perfStateMachine.reset();
+  perfWsBroadcast.reset();
+  perfRoastTrace.reset();
+  perfLoop.reset();
+  ControlLock controlLock;
+  perfControl.reset();
+}
+
+// One state-machine step. Runs in loop() under ControlLock and only touches
+// control state; everything slow is left in `effects` for afterwards.
+void runStateMachine(StateMachineEffects &effects)
+{
+  static RoasterState lastState = IDLE;
+  if (roasterState != lastState)
+  {
+    LOG_INFOF("State transition: %d -> %d", lastState, roasterState);
+
+    // Handle state entry logic
+    if (roasterState == CALIBRATING)
+    {
+      // Stop PID to prevent interference
+      resetRoastControllerState();
+
+      // Initialize fan ramp
+      fanRampStep = 0;
+
+      LOG_INFO("Calibration: Starting fan ramp sequence");
+    }
+
+    lastState = roasterState;
+  }
+
+  switch (roasterState)
+  {
+  case IDLE:
+    digitalWrite(HEATER, LOW);
+    digitalWrite(FAN, LOW);
+    bdcFan.writeMicroseconds(800); // Ensure BDC stays at low speed
+    bdcFanMs = 800;
+    resetRoastControllerState();
+    break;
+
+  case START_ROAST:
+  {
+    if (roastStartPending)
+    {
+      roastStartPending = false;
+      effects.roastStarted = true;
+      effects.showScreen(DisplayScreen::Roasting, (int)lround(setpointTemp));
+    }
+
+    // Non-blocking fan ramp-up
+    if (fanRampStep == 0)
+    {
+      LOG_INFOF("Starting roast - Fan ramp-up initiated (%.1fF)", currentTemp);
+      fanRampStartTime = millis();
+      fanRampStep = 800;
+    }
+
+    unsigned long elapsed = millis() - fanRampStartTime;
+    int targetStep = 800 + (elapsed / 500) * 100;
+
+    // Update fan speed every 500ms
+    if (targetStep <= 2000 && targetStep > fanRampStep)
+    {
+      bdcFan.writeMicroseconds(targetStep);
+      fanRampStep = targetStep;
+    }
+
+    // Fan ramp complete after reaching 2000 and waiting additional 500ms
+    if (fanRampStep >= 2000 && elapsed >= 6500)
+    {
+      // Reset for next roast
+      fanRampStep = 0;
+
+      // Start roasting with current active profile
+      roasterState = ROASTING;
+      roastStartedAtMs = millis();
+      profile.startProfile((int)currentTemp, millis());
+      effects.roastingPhaseStarted = true;
+      resetRoastControllerState();
+      updateRoastControl(millis());
+      
+      // Log active PID parameters
+      PIDRuntimeController::ControlDecision decision = pidRuntimeController.getLastDecision();
+      LOG_INFOF("PID Active: Kp=%.4f, Ki=%.4f, Kd=%.4f, Schedule=%s, Band=%d, FF=%.1f",
+                decision.kp,
+                decision.ki,
+                decision.kd,
+                decision.scheduleActive ? "banded" : "single",
+                decision.bandIndex,
+                decision.feedforward);
+      LOG_INFOF("Roast started: Target=%.0fF, Setpoints=%d", (float)getEffectiveFinalTargetTemp(), profile.getSetpointCount());
+      LOG_INFOF("Fan temp safety warmup: delay=%lums threshold=%.1fF", FAN_TEMP_SAFETY_ARM_DELAY_MS, MAX_SAFE_FAN_TEMP);
+      effects.push("{ \"pushMessage\": \"startRoasting\" }");
+    }
+
+    // Set initial PWM fan speed
+    fanRelay.setPWM(profile.getTargetFanSpeed(millis()));
+    break;
+  }
+
+  case ROASTING:
+  {
+    if (roastShouldCompleteNow())
+    {
+      bool validationRun = currentRoastUsesValidationProfile();
+      if (validationRun)
+      {
+        finalizeValidationIfRunning(true, "profile_complete");
+      }
+
+      resetRoastControllerState();
+      heaterRelay.setPWM(heaterOutputVal);
+
+      effects.coolingStarted(SYSTEMLINK_OUTCOME_PASSED,
+                             validationRun ? "validation_profile_complete" : "final_target_reached");
+      enterCoolingControlState();
+
+      setpointProgress = 0;
+      LOG_INFOF("Roast complete at %.1fF - entering cooling phase", currentTemp);
+    }
+
+    DisplayTelemetry telemetry;
+    telemetry.roasterState = roasterState;
+    telemetry.currentTempF = (int)currentTemp;
+    telemetry.targetTempF = (int)lround(setpointTemp);
+    telemetry.fanPercent = (int)round(setpointFanSpeed * 100 / 255);
+    telemetry.progressSeconds = setpointProgress;
+    telemetry.elapsedSeconds = roastStartedAtMs > 0 ? static_cast<int>((millis() - roastStartedAtMs) / 1000UL) : -1;
+    telemetry.heaterOutput = (int)lround(heaterOutputVal);
+    telemetry.bdcFanMicros = bdcFanMs;
+    telemetry.fanTempF = (int)lround(fanTemp);
+    telemetry.rateOfRiseFPerMin = static_cast<float>(rateOfRise);
+    effects.show(telemetry);
+    break;
+  }
+
+  case COOLING:
+  {
+    digitalWrite(HEATER, LOW);
+
+    DisplayTelemetry telemetry;
+    telemetry.roasterState = roasterState;
+    telemetry.currentTempF = (int)currentTemp;
+    telemetry.targetTempF = COOLING_TARGET_TEMP;
+    telemetry.fanPercent = 100;
+    telemetry.bdcFanMicros = bdcFanMs;
+    telemetry.rateOfRiseFPerMin = static_cast<float>(rateOfRise);
+    effects.show(telemetry);
+
+    // Check for cooling timeout (30 minutes max)
+    unsigned long coolingDuration = millis() - coolingStartTime;
+    if (coolingDuration > MAX_COOLING_TIME)
+    {
+      autoValidateAfterCooling = false;
+      finalizeValidationIfRunning(false, "cooling_timeout");
+      LOG_WARNF("Cooling timeout after %lu minutes - forcing IDLE", coolingDuration / 60000);
+      effects.roastFinished(SYSTEMLINK_OUTCOME_TERMINATED, "cooling_timeout");
+      fanRelay.setPWM(0);
+      bdcFan.writeMicroseconds(800);
+      digitalWrite(FAN, LOW);
+      roasterState = IDLE;
+      effects.push("{ \"pushMessage\": \"endRoasting\" }");
+      effects.showScreen(DisplayScreen::Start);
+      break;
+    }
+
+    if (currentTemp <= COOLING_TARGET_TEMP)
+    {
+      restoreValidationProfileIfNeeded();
+      effects.roastFinished(SYSTEMLINK_OUTCOME_NONE, "cooling_complete");
+      fanRelay.setPWM(0);
+      bdcFan.writeMicroseconds(800);
+      digitalWrite(FAN, LOW);
+      roasterState = IDLE;
+
+      LOG_INFOF("Cooling complete at %.1fF - returning to IDLE", currentTemp);
+      effects.push("{ \"pushMessage\": \"endRoasting\" }");
+      effects.showScreen(DisplayScreen::Start);
+
+      // Auto-validate after step-response tuning, once this roast is filed
+      if (autoValidateAfterCooling) {
+        autoValidateAfterCooling = false;
+        effects.startAutoValidation = true;
+      }
+    }
+    break;
+  }
+
+  case ERROR:
+  {
+    finalizeValidationIfRunning(false, "error_state");
+    // ERROR state: Keep system in safe mode until manual reset
+    // Heater must stay OFF, cooling fan at safe speed
+    digitalWrite(HEATER, LOW);
+    heaterRelay.setPWM(0);
+    resetRoastControllerState();
+
+    // Run cooling fan at safe speed (not maximum to avoid mechanical stress)
+    fanRelay.setPWM(200);           // ~78% speed for sustained cooling
+    bdcFan.writeMicroseconds(1500); // Mid-range for BDC fan
+    bdcFanMs = 1500;
+
+    // Update display with current temperature
+    DisplayTelemetry telemetry;
+    telemetry.roasterState = roasterState;
+    telemetry.currentTempF = (int)currentTemp;
+    telemetry.fanPercent = (int)round(200.0 * 100.0 / 255.0);
+    telemetry.bdcFanMicros = bdcFanMs;
+    effects.show(telemetry);
+
+    // ERROR state logged when entered, not every loop iteration
+
+    // ERROR remains latched until the user explicitly requests a reset and
+    // the controller reports safe temperatures with valid sensor data.
+    break;
+  }
+
+  case CALIBRATING:
+  {
+    // Fan Ramp Logic (Reuse logic from START_ROAST)
+    if (fanRampStep < 2000) 
+    {
+      if (fanRampStep == 0) {
+           fanRampStartTime = millis();
+           fanRampStep = 800;
+           LOG_INFO("Calibration: Fan ramp initiated");
+      }
+
+      unsigned long elapsed = millis() - fanRampStartTime;
+      int targetStep = 800 + (elapsed / 500) * 100;
+
+      if (targetStep > fanRampStep)
+      {
+        fanRampStep = targetStep;
+        if (fanRampStep > 2000) fanRampStep = 2000;
+        
+        bdcFan.writeMicroseconds(fanRampStep);
+        // Ramp PWM fan proportionally
+        int pwmFan = map(fanRampStep, 800, 2000, 50, 255);
+        fanRelay.setPWM(pwmFan);
+        LOG_INFOF("Calib Ramp: BDC=%d", fanRampStep);
+      }
+      
+      // Ensure heater is OFF during ramp
+      heaterRelay.setPWM(0);
+      break; 
+    }
+
+    if (finishStepResponseCalibrationIfEnded(effects))
+    {
+      break;
+    }
+
+    LOG_INFO("State: CALIBRATING loop");
+
+    fanRelay.setPWM(setpointFanSpeed);
+    int calibrationBdcValue = constrain(5 * setpointFanSpeed + 700, 800, 2000);
+    bdcFan.writeMicroseconds(calibrationBdcValue);
+    bdcFanMs = calibrationBdcValue;
+
+    // Update UI
+    double calSetpoint = stepTuner.getSetpoint();
+    DisplayTelemetry telemetry;
+    telemetry.roasterState = roasterState;
+    telemetry.currentTempF = (int)currentTemp;
+    telemetry.targetTempF = (int)round(calSetpoint);
+    telemetry.fanPercent = (int)round(setpointFanSpeed * 100.0 / 255.0);
+    telemetry.bdcFanMicros = bdcFanMs;
+    effects.show(telemetry);
+    break;
+  }
+
+  default:
+    LOG_WARNF("Unknown state: %d - returning to IDLE", roasterState);
+    roasterState = IDLE;
+    break;
+  }
+}
+
+// The slow half of a state-machine step, run after ControlLock is released
+void applyStateMachineEffects(const StateMachineEffects &effects)
+{
+  if (effects.roastStarted)
+  {
+    systemLinkMarkRoastStarted();
+    archiveRoastStarted();
+  }
+  if (effects.roastingPhaseStarted)
+  {
+    systemLinkMarkRoastingPhaseStarted();
+  }
+  if (effects.coolingPhaseStarted)
+  {
+    systemLinkMarkCoolingPhaseStarted(effects.outcome, effects.outcomeReason);
+    archiveRoastOutcome(effects.outcome, effects.outcomeReason);
+  }
+  if (effects.roastEnded)
+  {
+    systemLinkFinishRoast(effects.outcome, effects.outcomeReason);
+    archiveRoastFinished(effects.outcome, effects.outcomeReason);
+  }
+  if (effects.calibrationSaved)
+  {
+    // Twenty minutes of calibration is not worth losing to a reset
+    preferencesJournal.flush();
+    systemLinkPublishCalibration(stepTuner);
+  }
+
+  if (effects.hasScreen)
+  {
+    if (effects.screenTargetTempF >= 0)
+    {
+      displaySetTargetTemp(effects.screenTargetTempF);
+    }
+    displayShowScreen(effects.screen);
+  }
+  if (effects.hasTelemetry)
+  {
+    displayUpdateTelemetry(effects.telemetry);
+  }
+  for (uint8_t i = 0; i < effects.pushCount; i++)
+  {
+    sendWsMessage(effects.pushMessages[i]);
+  }
+
+  if (effects.startAutoValidation)
+  {
+    LOG_INFO("Starting auto-validation after step-response tuning");
+    bool started;
+    {
+      ControlLock controlLock;
+      started = startValidationRoast(200.0, 70);
+    }
+    if (started)
+    {
+      sendWsMessage("{ \"pushMessage\": \"pidValidationStarted\" }");
+    }
+    else
+    {
+      LOG_WARN("Auto-validation could not start (temp or state issue)");
     }
   }
 }
@@ -413,10 +1179,6 @@ void setup()
     bdcFan.writeMicroseconds(800);
   }
 
-  // Explicitly enable the pinMode for the SPI pins because the library doesn't appear to do this correctly when running on an ESP32
-  pinMode(TC1_CS, OUTPUT);
-  pinMode(THERMOCOUPLE_SCK, OUTPUT);
-  pinMode(THERMOCOUPLE_MISO, INPUT);
 
   // Set output pins to safe state (LOW)
   digitalWrite(HEATER, LOW);
@@ -466,31 +1228,59 @@ void setup()
     // Continue with defaults - don't halt system
   }
 
+#if ROASTER_ROAST_ARCHIVE
+  if (roastArchive.begin())
+  {
+    LOG_INFOF("Roast archive: %u roasts, %u bytes on flash", (unsigned)roastArchive.snapshot().size(), (unsigned)roastArchive.totalBytes());
+  }
+  else
+  {
+    LOG_WARN("Roast archive disabled - no filesystem partition");
+  }
+#endif
+
+#if ROASTER_PROFILE_STORE == ROASTER_PROFILE_STORE_LITTLEFS
+  if (!profileFiles.begin("profiles"))
+  {
+    LOG_ERROR("LittleFS mount failed - profiles cannot be saved (is there a filesystem partition?)");
+  }
+  else
+  {
+    profileManager.migrateFromNvs(preferences);
+  }
+#endif
+
   // Load PID values
-  kp = preferences.getDouble("kp", 8.0);
-  ki = preferences.getDouble("ki", 0.46);
-  kd = preferences.getDouble("kd", 0.0);
+  kp = preferencesJournal.getDouble("kp", 8.0);
+  ki = preferencesJournal.getDouble("ki", 0.46);
+  kd = preferencesJournal.getDouble("kd", 0.0);
   loadSystemLinkConfig();
   pidRuntimeController.setFallbackGains(kp, ki, kd);
-  pidRuntimeController.loadFromPreferences(preferences);
+  pidRuntimeController.loadFromPreferences(preferencesJournal);
   pidScheduleConfigured = pidRuntimeController.isEnabled();
   applyHeaterPIDGains(kp, ki, kd);
+  setRateOfRiseWindowSeconds(preferencesJournal.getInt("ror_window", ROR_WINDOW_DEFAULT_SECONDS), false);
+  setHeaterControlMode(heaterControlModeFromInt(preferencesJournal.getInt("heater_mode", HEATER_MODE_PID)), false);
   LOG_INFOF("PID Loaded: Kp=%.4f, Ki=%.4f, Kd=%.4f", kp, ki, kd);
   LOG_INFOF("PID runtime schedule %s (%u valid bands)", pidRuntimeController.isEnabled() ? "enabled" : "disabled", pidRuntimeController.getValidBandCount());
+  LOG_INFOF("Heater control mode: %s", getHeaterControlModeName(heaterControlMode));
 
   // --- BOOT LOOP PROTECTION ---
   // If we crash repeatedly during startup (e.g. due to corrupt NVS), purge profiles
-  int bootCount = preferences.getInt("boot_count", 0);
+  int bootCount = preferencesJournal.getInt("boot_count", 0);
   Serial.printf("Boot count: %d\n", bootCount); // Force print to Serial
   if (bootCount > 5) {
     LOG_ERRORF("CRITICAL: Boot loop detected (count=%d)! Purging all profiles to recover system.", bootCount);
     Serial.println("CRITICAL: Purging profiles due to boot loop!");
     systemLinkUpdateLastFault("boot_loop_detected");
     profileManager.deleteAllProfiles();
-    preferences.putInt("boot_count", 0);
+    preferencesJournal.putInt("boot_count", 0);
+    preferencesJournal.flush();
     delay(2000); // Allow time for serial log to be seen
   } else {
-    preferences.putInt("boot_count", bootCount + 1);
+    // Must reach flash before anything that might crash
+    preferencesJournal.putInt("boot_count", bootCount + 1);
+    preferencesJournal.flush();
     LOG_INFOF("Boot count: %d", bootCount + 1);
   }
   // ----------------------------
@@ -498,19 +1288,20 @@ void setup()
   systemLinkSetBootContext(bootCount + 1);
   systemLinkPrepareRecoveryPublish();
 
-  wifiCredentials.ssid = preferences.getString("ssid", "");
-  wifiCredentials.password = preferences.getString("password", "");
+  wifiCredentials.ssid = preferencesJournal.getString("ssid", "");
+  wifiCredentials.password = preferencesJournal.getString("password", "");
   displaySetWifiFormState(DisplayWifiFormState{wifiCredentials.ssid, wifiCredentials.password});
 
   String ipAddress = initializeWifi(wifiCredentials);
   if (ipAddress != "Failed to connect to WiFi")
   {
-    preferences.putString("ssid", wifiCredentials.ssid);
-    preferences.putString("password", wifiCredentials.password);
+    preferencesJournal.putString("ssid", wifiCredentials.ssid);
+    preferencesJournal.putString("password", wifiCredentials.password);
   }
 
   // Initialize profile system: ensure default exists, then load active profile
   LOG_INFO("Initializing profile system...");
+  profileManager.rebuildIndex();
   profileManager.ensureDefault();
   
   String activeId = profileManager.getActiveProfileId();
@@ -549,11 +1340,32 @@ void setup()
   displayShowScreen(DisplayScreen::Start);
   initSystemLinkTagTask();
   initSystemLinkPublishTask();
+
+  // Acquisition and control task share a start time so sample reads land on
+  // control-cycle boundaries.
+  if (!thermocoupleAcquisition.begin(thermocoupleTransport, static_cast<uint32_t>(micros())))
+  {
+    LOG_ERROR("Thermocouple SPI transport failed to start");
+  }
+
+  ControlTask::Config controlTaskConfig;
+  if (!controlTask.begin(controlTaskConfig, runControlCycle))
+  {
+    LOG_ERROR("Control task creation failed - polling control cycle from loop()");
+  }
+  LOG_INFOF("Control cycle every %lums (%s)", static_cast<unsigned long>(controlTask.getPeriodMs()),
+            controlTask.isThreaded() ? "dedicated task" : "polled from loop");
   LOG_INFO("Setup complete - entering main loop");
 }
 
 void loop()
 {
+  if (perfResetRequested)
+  {
+    resetPerfStats();
+  }
+  PerfScope loopPerfScope(perfLoop);
+
   // Reset watchdog timer every loop iteration
   // If loop hangs for >10 seconds, system will reset
   esp_task_wdt_reset();
@@ -561,16 +1373,20 @@ void loop()
   // Reset boot count if system has been stable for 10 seconds
   static bool bootCountReset = false;
   if (!bootCountReset && millis() > 10000) {
-    preferences.putInt("boot_count", 0);
+    preferencesJournal.putInt("boot_count", 0);
     bootCountReset = true;
     LOG_INFO("System stable - boot count reset");
   }
 
+  // Pending settings writes go to flash from here, never from the control task
+  preferencesJournal.flushIfDue();
+
   // Check WiFi connection and auto-reconnect if needed
   checkWiFiConnection(wifiCredentials);
 
   if (tickTimer.isReady())
   {
+    PerfScope perfScope(perfTick);
     if (!otaUpdateInProgress)
     {
       displayTick();
@@ -586,442 +1402,21 @@ void loop()
     tickTimer.reset();
   }
 
-  if (checkTempTimer.isReady())
+  if (!controlTask.isThreaded())
   {
-    static int readCycle = 0; // 0-7 counter for 1Hz fan updates
-    static double lastValidTemp = 0;
-    static bool firstReading = true;
-    static double lastValidFanTemp = 0;
-    static bool firstFanReading = true;
-    static int fanOverTempCount = 0;
-    static bool fanTempSafetyArmedLogged = false;
-    static bool fanTempSafetyDelayLogged = false;
-
-    // Cycle 0, 2, 4, 6: Read Main Sensor (4 Hz)
-    // Cycle 1, 3, 5, 7: Read Fan Sensor (4 Hz)
-    // This ensures we never read both sensors in the same 125ms window
-    if (readCycle % 2 == 0)
-    {
-      // Read thermocouple with failure detection
-      double reading = thermocouple.readFarenheit();
-      double previousAcceptedTemp = currentTemp;
-
-      // 1. Range Check: MAX6675 returns ~2048°F when disconnected
-      // We also check for negative values which are invalid for this application
-      bool isRangeError = (reading < 0 || reading > SENSOR_FAULT_TEMP);
-      if (isRangeError)
-      {
-        setLastRejectedBeanReadReason("range");
-        LOG_WARNF("Temp range error ignored: raw=%.1fF accepted=%.1fF lastValid=%.1fF", reading, previousAcceptedTemp, lastValidTemp);
-      }
-      
-      // 2. Spike Check: Ignore physically impossible temperature jumps
-      bool isSpike = false;
-      if (!isRangeError && !firstReading && shouldFilterBeanTempSpikes() && abs(reading - lastValidTemp) > MAX_TEMP_JUMP) {
-        isSpike = true;
-        setLastRejectedBeanReadReason("spike");
-        LOG_WARNF("Temp spike ignored: lastValid=%.1fF raw=%.1fF accepted=%.1fF", lastValidTemp, reading, previousAcceptedTemp);
-      }
-
-      if (isRangeError || isSpike)
-      {
-        badReadingCount++;
-        if (badReadingCount >= MAX_BAD_READINGS)
-        {
-          // SENSOR FAILURE - EMERGENCY STOP
-          DEBUG_PRINTLN("EMERGENCY: Thermocouple failure detected!");
-          String message = formatBeanSensorFaultMessage(reading);
-          enterEmergencyErrorState("sensor_failed", message.c_str());
-        }
-      }
-      else
-      {
-        currentTemp = reading;
-        lastValidTemp = reading;
-        firstReading = false;
-        badReadingCount = 0; // Reset counter on good reading
-
-        if (previousAcceptedTemp > 0.0) {
-          bool suspiciousLowLatch = reading <= 40.0 && previousAcceptedTemp >= 80.0;
-          bool largeAcceptedDrop = abs(reading - previousAcceptedTemp) >= 20.0;
-          if (suspiciousLowLatch || largeAcceptedDrop) {
-            LOG_WARNF("Bean temp accepted: prev=%.1fF raw=%.1fF new=%.1fF lastValid=%.1fF state=%d heater=%.1f", previousAcceptedTemp, reading, currentTemp, lastValidTemp, roasterState, heaterOutputVal);
-          }
-        }
-
-        if (isRoastActiveState() && currentTemp > MAX_ROAST_TEMP)
-        {
-          DEBUG_PRINTLN("EMERGENCY: Roast temperature limit exceeded!");
-          enterEmergencyErrorState("roast_over_temperature", "Roast Over Temp");
-        }
-
-        // THERMAL RUNAWAY PROTECTION
-        if (roasterState != ERROR && currentTemp > MAX_SAFE_TEMP)
-        {
-          // EMERGENCY SHUTDOWN
-          DEBUG_PRINTLN("EMERGENCY: Thermal runaway detected!");
-          enterEmergencyErrorState("over_temperature", "Over Temp");
-        }
-      }
-    }
-    // Odd cycles: Read Fan Sensor (4 Hz)
-    else
-    {
-      double fReading = thermocoupleFan.readFarenheit();
-      const bool fanTempSafetyArmed = shouldEnforceFanTempSafety();
-      bool isFanRangeError = (fReading <= 0 || fReading > SENSOR_FAULT_TEMP);
-      if (isFanRangeError) {
-        fanOverTempCount = 0;
-        LOG_WARNF("Fan temp range error ignored: %.1f", fReading);
-      }
-
-      bool isFanSpike = false;
-      if (!isFanRangeError && !firstFanReading && shouldFilterFanTempSpikes() && abs(fReading - lastValidFanTemp) > MAX_TEMP_JUMP) {
-        isFanSpike = true;
-        fanOverTempCount = 0;
-        LOG_WARNF("Fan temp spike ignored: %.1f -> %.1f", lastValidFanTemp, fReading);
-      }
-
-      bool isImplausibleFanReading = false;
-      if (!isFanRangeError && !isFanSpike && heaterOutputVal <= 0.0 && currentTemp < 140.0) {
-        if (fReading > currentTemp + 30.0) {
-          isImplausibleFanReading = true;
-          fanOverTempCount = 0;
-          LOG_WARNF("Fan temp implausible with heater off ignored: bean=%.1fF fan=%.1fF", currentTemp, fReading);
-        }
-      }
-
-      if (!isFanRangeError && !isFanSpike && !isImplausibleFanReading) {
-        fanTemp = fReading;
-        lastValidFanTemp = fReading;
-        firstFanReading = false;
-
-        if (roasterState == ROASTING && !fanTempSafetyArmed) {
-          if (roastStartedAtMs > 0 && !fanTempSafetyDelayLogged) {
-            unsigned long warmupRemainingMs = FAN_TEMP_SAFETY_ARM_DELAY_MS;
-            unsigned long elapsedRoastMs = millis() - roastStartedAtMs;
-            if (elapsedRoastMs < FAN_TEMP_SAFETY_ARM_DELAY_MS) {
-              warmupRemainingMs = FAN_TEMP_SAFETY_ARM_DELAY_MS - elapsedRoastMs;
-            } else {
-              warmupRemainingMs = 0;
-            }
-
-            LOG_INFOF("Fan temp safety delayed: remaining=%lums bean=%.1fF fan=%.1fF heater=%.1f",
-                      warmupRemainingMs,
-                      currentTemp,
-                      fanTemp,
-                      heaterOutputVal);
-            fanTempSafetyDelayLogged = true;
-          }
-          fanTempSafetyArmedLogged = false;
-        } else if (fanTempSafetyArmed && !fanTempSafetyArmedLogged) {
-          LOG_INFOF("Fan temp safety armed: elapsed=%lus bean=%.1fF fan=%.1fF heater=%.1f threshold=%.1fF",
-                    roastStartedAtMs > 0 ? (millis() - roastStartedAtMs) / 1000UL : 0UL,
-                    currentTemp,
-                    fanTemp,
-                    heaterOutputVal,
-                    MAX_SAFE_FAN_TEMP);
-          fanTempSafetyArmedLogged = true;
-        }
-
-        // Require the over-temp reading to persist briefly so one noisy sample
-        // cannot immediately trip the roaster into an error state.
-        if (fanTempSafetyArmed && fanTemp > MAX_SAFE_FAN_TEMP) {
-          fanOverTempCount++;
-          LOG_WARNF("Fan temp over threshold (%d/3): %.1fF bean=%.1fF heater=%.1f elapsed=%lus",
-                    fanOverTempCount,
-                    fanTemp,
-                    currentTemp,
-                    heaterOutputVal,
-                    roastStartedAtMs > 0 ? (millis() - roastStartedAtMs) / 1000UL : 0UL);
-          if (fanOverTempCount >= 3) {
-            DEBUG_PRINTLN("EMERGENCY: Fan/Exhaust Over Temp!");
-            LOG_ERRORF("Fan temp safety trip: bean=%.1fF fan=%.1fF heater=%.1f elapsed=%lus threshold=%.1fF",
-                       currentTemp,
-                       fanTemp,
-                       heaterOutputVal,
-                       roastStartedAtMs > 0 ? (millis() - roastStartedAtMs) / 1000UL : 0UL,
-                       MAX_SAFE_FAN_TEMP);
-            enterEmergencyErrorState("fan_over_temperature", "Fan over temp");
-          }
-        } else {
-          fanOverTempCount = 0;
-        }
-      }
-    }
-
-    readCycle = (readCycle + 1) % 8;
-    // Metrics now available via debug console at /console
-    checkTempTimer.reset();
-  }
-
-  if (controlLoopTimer.isReady())
-  {
-    unsigned long now = millis();
-    updateRoastControl(now);
-    updateCalibrationControl(now);
-    systemLinkRecordHighRateSample();
-    controlLoopTimer.reset();
+    controlTask.runIfDue();
   }
+  publishPendingEmergencyFault();
 
   if (stateMachineTimer.isReady())
   {
-    static RoasterState lastState = IDLE;
-    if (roasterState != lastState) {
-        LOG_INFOF("State transition: %d -> %d", lastState, roasterState);
-        
-        // Handle state entry logic
-        if (roasterState == CALIBRATING) {
-             // Stop PID to prevent interference
-             resetRoastControllerState();
-             
-             // Initialize fan ramp
-             fanRampStep = 0;
-             
-             LOG_INFO("Calibration: Starting fan ramp sequence");
-        }
-        
-        lastState = roasterState;
-    }
-
-    switch (roasterState)
-    {
-    case IDLE:
-      digitalWrite(HEATER, LOW);
-      digitalWrite(FAN, LOW);
-      bdcFan.writeMicroseconds(800); // Ensure BDC stays at low speed
-      bdcFanMs = 800;
-      resetRoastControllerState();
-      break;
-
-    case START_ROAST:
+    PerfScope perfScope(perfStateMachine);
+    StateMachineEffects effects;
     {
-      // Non-blocking fan ramp-up
-      if (fanRampStep == 0)
-      {
-        LOG_INFOF("Starting roast - Fan ramp-up initiated (%.1fF)", currentTemp);
-        fanRampStartTime = millis();
-        fanRampStep = 800;
-      }
-
-      unsigned long elapsed = millis() - fanRampStartTime;
-      int targetStep = 800 + (elapsed / 500) * 100;
-
-      // Update fan speed every 500ms
-      if (targetStep <= 2000 && targetStep > fanRampStep)
-      {
-        bdcFan.writeMicroseconds(targetStep);
-        fanRampStep = targetStep;
-      }
-
-      // Fan ramp complete after reaching 2000 and waiting additional 500ms
-      if (fanRampStep >= 2000 && elapsed >= 6500)
-      {
-        // Reset for next roast
-        fanRampStep = 0;
-
-        // Start roasting with current active profile
-        roasterState = ROASTING;
-        roastStartedAtMs = millis();
-        profile.startProfile((int)currentTemp, millis());
-        systemLinkMarkRoastingPhaseStarted();
-        resetRoastControllerState();
-        updateRoastControl(millis());
-        
-        // Log active PID parameters
-        PIDRuntimeController::ControlDecision decision = pidRuntimeController.getLastDecision();
-        LOG_INFOF("PID Active: Kp=%.4f, Ki=%.4f, Kd=%.4f, Schedule=%s, Band=%d, FF=%.1f",
-                  decision.kp,
-                  decision.ki,
-                  decision.kd,
-                  decision.scheduleActive ? "banded" : "single",
-                  decision.bandIndex,
-                  decision.feedforward);
-        LOG_INFOF("Roast started: Target=%.0fF, Setpoints=%d", (float)getEffectiveFinalTargetTemp(), profile.getSetpointCount());
-        LOG_INFOF("Fan temp safety warmup: delay=%lums threshold=%.1fF", FAN_TEMP_SAFETY_ARM_DELAY_MS, MAX_SAFE_FAN_TEMP);
-        sendWsMessage("{ \"pushMessage\": \"startRoasting\" }");
-      }
-
-      // Set initial PWM fan speed
-      fanRelay.setPWM(profile.getTargetFanSpeed(millis()));
-      break;
-    }
-
-    case ROASTING:
-    {
-      if (roastShouldCompleteNow())
-      {
-        bool validationRun = currentRoastUsesValidationProfile();
-        if (validationRun)
-        {
-          finalizeValidationIfRunning(true, "profile_complete");
-        }
-
-        resetRoastControllerState();
-        heaterRelay.setPWM(heaterOutputVal);
-
-        systemLinkMarkCoolingPhaseStarted(SYSTEMLINK_OUTCOME_PASSED,
-                                          validationRun ? "validation_profile_complete" : "final_target_reached");
-        enterCoolingState();
-
-        setpointProgress = 0;
-        LOG_INFOF("Roast complete at %.1fF - entering cooling phase", currentTemp);
-      }
-
-      DisplayTelemetry telemetry;
-      telemetry.roasterState = roasterState;
-      telemetry.currentTempF = (int)currentTemp;
-      telemetry.targetTempF = (int)lround(setpointTemp);
-      telemetry.fanPercent = (int)round(setpointFanSpeed * 100 / 255);
-      telemetry.progressSeconds = setpointProgress;
-      telemetry.elapsedSeconds = roastStartedAtMs > 0 ? static_cast<int>((millis() - roastStartedAtMs) / 1000UL) : -1;
-      telemetry.heaterOutput = (int)lround(heaterOutputVal);
-      telemetry.bdcFanMicros = bdcFanMs;
-      telemetry.fanTempF = (int)lround(fanTemp);
-      displayUpdateTelemetry(telemetry);
-      break;
-    }
-
-    case COOLING:
-    {
-      digitalWrite(HEATER, LOW);
-
-      DisplayTelemetry telemetry;
-      telemetry.roasterState = roasterState;
-      telemetry.currentTempF = (int)currentTemp;
-      telemetry.targetTempF = COOLING_TARGET_TEMP;
-      telemetry.fanPercent = 100;
-      telemetry.bdcFanMicros = bdcFanMs;
-      displayUpdateTelemetry(telemetry);
-
-      // Check for cooling timeout (30 minutes max)
-      unsigned long coolingDuration = millis() - coolingStartTime;
-      if (coolingDuration > MAX_COOLING_TIME)
-      {
-        autoValidateAfterCooling = false;
-        finalizeValidationIfRunning(false, "cooling_timeout");
-        LOG_WARNF("Cooling timeout after %lu minutes - forcing IDLE", coolingDuration / 60000);
-        systemLinkFinishRoast(SYSTEMLINK_OUTCOME_TERMINATED, "cooling_timeout");
-        fanRelay.setPWM(0);
-        bdcFan.writeMicroseconds(800);
-        digitalWrite(FAN, LOW);
-        roasterState = IDLE;
-        sendWsMessage("{ \"pushMessage\": \"endRoasting\" }");
-        displayShowScreen(DisplayScreen::Start);
-        break;
-      }
-
-      if (currentTemp <= COOLING_TARGET_TEMP)
-      {
-        restoreValidationProfileIfNeeded();
-        systemLinkFinishRoast(SYSTEMLINK_OUTCOME_NONE, "cooling_complete");
-        fanRelay.setPWM(0);
-        bdcFan.writeMicroseconds(800);
-        digitalWrite(FAN, LOW);
-        roasterState = IDLE;
-
-        LOG_INFOF("Cooling complete at %.1fF - returning to IDLE", currentTemp);
-        sendWsMessage("{ \"pushMessage\": \"endRoasting\" }");
-        displayShowScreen(DisplayScreen::Start);
-
-        // Auto-validate after step-response tuning
-        if (autoValidateAfterCooling) {
-          autoValidateAfterCooling = false;
-          LOG_INFO("Starting auto-validation after step-response tuning");
-          if (startValidationRoast(200.0, 70)) {
-            sendWsMessage("{ \"pushMessage\": \"pidValidationStarted\" }");
-          } else {
-            LOG_WARN("Auto-validation could not start (temp or state issue)");
-          }
-        }
-      }
-      break;
-    }
-
-    case ERROR:
-    {
-      finalizeValidationIfRunning(false, "error_state");
-      // ERROR state: Keep system in safe mode until manual reset
-      // Heater must stay OFF, cooling fan at safe speed
-      digitalWrite(HEATER, LOW);
-      heaterRelay.setPWM(0);
-      resetRoastControllerState();
-
-      // Run cooling fan at safe speed (not maximum to avoid mechanical stress)
-      fanRelay.setPWM(200);           // ~78% speed for sustained cooling
-      bdcFan.writeMicroseconds(1500); // Mid-range for BDC fan
-      bdcFanMs = 1500;
-
-      // Update display with current temperature
-      DisplayTelemetry telemetry;
-      telemetry.roasterState = roasterState;
-      telemetry.currentTempF = (int)currentTemp;
-      telemetry.fanPercent = (int)round(200.0 * 100.0 / 255.0);
-      telemetry.bdcFanMicros = bdcFanMs;
-      displayUpdateTelemetry(telemetry);
-
-      // ERROR state logged when entered, not every loop iteration
-
-      // ERROR remains latched until the user explicitly requests a reset and
-      // the controller reports safe temperatures with valid sensor data.
-      break;
-    }
-
-    case CALIBRATING:
-    {
-      // Fan Ramp Logic (Reuse logic from START_ROAST)
-      if (fanRampStep < 2000) 
-      {
-        if (fanRampStep == 0) {
-             fanRampStartTime = millis();
-             fanRampStep = 800;
-             LOG_INFO("Calibration: Fan ramp initiated");
-        }
-
-        unsigned long elapsed = millis() - fanRampStartTime;
-        int targetStep = 800 + (elapsed / 500) * 100;
-
-        if (targetStep > fanRampStep)
-        {
-          fanRampStep = targetStep;
-          if (fanRampStep > 2000) fanRampStep = 2000;
-          
-          bdcFan.writeMicroseconds(fanRampStep);
-          // Ramp PWM fan proportionally
-          int pwmFan = map(fanRampStep, 800, 2000, 50, 255);
-          fanRelay.setPWM(pwmFan);
-          LOG_INFOF("Calib Ramp: BDC=%d", fanRampStep);
-        }
-        
-        // Ensure heater is OFF during ramp
-        heaterRelay.setPWM(0);
-        break; 
-      }
-
-      LOG_INFO("State: CALIBRATING loop");
-
-      fanRelay.setPWM(setpointFanSpeed);
-      int calibrationBdcValue = constrain(5 * setpointFanSpeed + 700, 800, 2000);
-      bdcFan.writeMicroseconds(calibrationBdcValue);
-      bdcFanMs = calibrationBdcValue;
-
-      // Update UI
-      double calSetpoint = stepTuner.getSetpoint();
-      DisplayTelemetry telemetry;
-      telemetry.roasterState = roasterState;
-      telemetry.currentTempF = (int)currentTemp;
-      telemetry.targetTempF = (int)round(calSetpoint);
-      telemetry.fanPercent = (int)round(setpointFanSpeed * 100.0 / 255.0);
-      telemetry.bdcFanMicros = bdcFanMs;
-      displayUpdateTelemetry(telemetry);
-      break;
-    }
-
-    default:
-      LOG_WARNF("Unknown state: %d - returning to IDLE", roasterState);
-      roasterState = IDLE;
-      break;
+      ControlLock controlLock;
+      runStateMachine(effects);
     }
+    applyStateMachineEffects(effects);
     stateMachineTimer.reset();
   }
 
@@ -1029,6 +1424,7 @@ void loop()
   if (restartRequested && millis() >= restartAt)
   {
     LOG_INFO("Restarting controller after calibration...");
+    preferencesJournal.flush();
     delay(100);
     ESP.restart();
   }
@@ -1036,18 +1432,28 @@ void loop()
   // Broadcast system state via WebSocket to debug console
   if (!otaUpdateInProgress && wsBroadcastTimer.isReady())
   {
+    PerfScope perfScope(perfWsBroadcast);
     broadcastSystemState();
-    broadcastLogs(50);  // Send last 50 log entries
+    broadcastLogs(50);  // New entries per client; the last 50 on connect
     wsBroadcastTimer.reset();
   }
 
+  // Artisan push subscribers each run on their own interval
+  if (!otaUpdateInProgress)
+  {
+    broadcastArtisanPush();
+  }
+  pumpWebSocketQueues();
+
   if (!otaUpdateInProgress && roastTraceTimer.isReady())
   {
+    PerfScope perfScope(perfRoastTrace);
     if (roasterState == ROASTING && pidValidation.isActive())
     {
       pidValidation.recordSample(currentTemp, setpointTemp);
     }
     systemLinkRecordRoastSample();
+    archiveRoastSample();
     roastTraceTimer.reset();
   }
 }
@@ -1059,7 +1465,11 @@ void handleStartRoastCommand()
   LOG_INFO("Start roast command received");
   
   // Use the currently active profile (managed by web UI)
-  int spCount = profile.getSetpointCount();
+  int spCount;
+  {
+    ControlLock controlLock;
+    spCount = profile.getSetpointCount();
+  }
   LOG_INFOF("Starting roast with active profile (%d setpoints)", spCount);
   
   if (spCount == 0) {
@@ -1069,53 +1479,80 @@ void handleStartRoastCommand()
   }
   
   int uiFinalTemp = readDisplayFinalTargetTempWithRetry();
-  if (uiFinalTemp != DISPLAY_READ_ERROR && uiFinalTemp > 0) {
-    finalTempOverride = constrain(uiFinalTemp, 0, 500);
-    LOG_INFOF("Using display final target override: %dF", finalTempOverride);
-    // Also update the active profile's final setpoint so heater control uses the override
-    profile.setFinalTargetTemp(finalTempOverride);
-  } else {
-    finalTempOverride = profile.getFinalTargetTemp();
-    LOG_WARN("Display final target not available - using profile final temp");
+  {
+    ControlLock controlLock;
+    if (uiFinalTemp != DISPLAY_READ_ERROR && uiFinalTemp > 0) {
+      finalTempOverride = constrain(uiFinalTemp, 0, 500);
+      LOG_INFOF("Using display final target override: %dF", finalTempOverride);
+      // Also update the active profile's final setpoint so heater control uses the override
+      profile.setFinalTargetTemp(finalTempOverride);
+    } else {
+      finalTempOverride = profile.getFinalTargetTemp();
+      LOG_WARN("Display final target not available - using profile final temp");
+    }
+    
+    startRoastSession();
   }
-  
-  startRoastSession();
   LOG_INFO("Start roast command complete - state set to START_ROAST");
 }
 
+// The stop commands change state and outputs under ControlLock and update
+// SystemLink, the archive and the display after releasing it, as loop() does
+// with the state machine's effects.
 void handleStopRoastCommand()
 {
-  if (roasterState == ERROR)
+  bool wasError;
+  bool errorCleared = false;
+  char blockedMessage[sizeof(activeFaultMessage)] = "";
   {
-    if (canClearErrorState())
+    ControlLock controlLock;
+    wasError = roasterState == ERROR;
+    if (!wasError)
+    {
+      finalizeValidationIfRunning(false, "user_stop");
+      resetRoastControllerState();
+      heaterRelay.setPWM(heaterOutputVal);
+      digitalWrite(HEATER, LOW);
+      enterCoolingControlState();
+    }
+    else if (canClearErrorState())
     {
       clearEmergencyErrorState();
+      errorCleared = true;
     }
     else
     {
-      String blockedMessage = formatErrorRecoveryBlockedMessage();
-      setActiveFault(activeFaultCode, blockedMessage.c_str());
-      displayShowErrorMessage(activeFaultMessage);
+      setActiveFault(activeFaultCode, formatErrorRecoveryBlockedMessage().c_str());
+      strlcpy(blockedMessage, activeFaultMessage, sizeof(blockedMessage));
       LOG_WARNF("Error reset blocked: fault=%s bean=%.1fF fan=%.1fF badReadings=%d", activeFaultCode, currentTemp, fanTemp, badReadingCount);
     }
-    return;
   }
 
-  finalizeValidationIfRunning(false, "user_stop");
-  systemLinkMarkCoolingPhaseStarted(SYSTEMLINK_OUTCOME_TERMINATED, "user_stop");
-
-  resetRoastControllerState();
-  heaterRelay.setPWM(heaterOutputVal);
-  digitalWrite(HEATER, LOW);
-
-  enterCoolingState();
+  if (errorCleared)
+  {
+    systemLinkUpdateLastFault("none");
+    displayShowScreen(DisplayScreen::Start);
+  }
+  else if (wasError)
+  {
+    displayShowErrorMessage(blockedMessage);
+  }
+  else
+  {
+    systemLinkMarkCoolingPhaseStarted(SYSTEMLINK_OUTCOME_TERMINATED, "user_stop");
+    archiveRoastOutcome(SYSTEMLINK_OUTCOME_TERMINATED, "user_stop");
+    showCoolingScreen();
+  }
 }
 
 void handleStopCoolingCommand()
 {
-  finalizeValidationIfRunning(false, "cooling_skipped");
-  restoreValidationProfileIfNeeded();
-  roasterState = IDLE;
+  {
+    ControlLock controlLock;
+    finalizeValidationIfRunning(false, "cooling_skipped");
+    restoreValidationProfileIfNeeded();
+    roasterState = IDLE;
+  }
   displayShowScreen(DisplayScreen::Start);
 }
 
@@ -1133,8 +1570,8 @@ void handleApplyWifiCommand()
   displaySetWifiIp(ip);
   if (WiFi.status() == WL_CONNECTED)
   {
-    preferences.putString("ssid", wifiCredentials.ssid);
-    preferences.putString("password", wifiCredentials.password);
+    preferencesJournal.putString("ssid", wifiCredentials.ssid);
+    preferencesJournal.putString("password", wifiCredentials.password);
   }
 }
 
@@ -0,0 +1,260 @@
+#ifndef MODEL_PREDICTIVE_CONTROLLER_HPP
+#define MODEL_PREDICTIVE_CONTROLLER_HPP
+
+#include <Arduino.h>
+#include <math.h>
+#include "../platform/CalibrationTypes.hpp"
+#include "../support/RingBuffer.hpp"
+
+// Heater MPC on the calibrated band models. Each band is the FOPDT energy
+// balance the step-response tuner fits,
+//
+//   dT/dt = drift + heaterCoeff * u(t - deadTime) - coolingCoeff * (T - ambient)
+//
+// discretized at the 250 ms control step. Every tick the controller rolls the
+// measured bean temperature forward through the dead time using the commands
+// already sent, then picks CONTROL_MOVES blocked heater levels that minimize
+// squared tracking error at PREDICTION_POINTS points along the profile plus a
+// move-suppression term, subject to 0 <= u <= 255. Only the first level is
+// applied.
+//
+// Everything that depends only on the band (step-response matrix, Hessian) is
+// built in configureBand(), so the online solve is a few hundred float
+// multiply-adds plus a short projected Gauss-Seidel sweep over a 3x3 QP.
+// An integrating disturbance estimate absorbs model mismatch, which is what
+// keeps steady-state tracking offset-free.
+class ModelPredictiveController {
+public:
+    static constexpr uint32_t STEP_MS = 250;
+    static constexpr uint8_t MAX_DELAY_STEPS = 64;     // 16 s of dead time
+    static constexpr uint8_t PREDICTION_POINTS = 16;
+    static constexpr uint8_t POINT_STEPS = 8;          // 2 s between points
+    static constexpr uint8_t CONTROL_MOVES = 3;
+    static constexpr uint8_t MAX_SWEEPS = 30;
+
+    struct SolveStats {
+        uint8_t sweeps;
+        float disturbance;
+        float predictedTemp; // Bean temp expected once the dead time has passed
+    };
+
+    void clear() {
+        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
+            horizons[index].valid = false;
+        }
+        reset();
+    }
+
+    void reset() {
+        history.clear();
+        disturbance = 0.0f;
+        lastTemp = 0.0f;
+        lastTempValid = false;
+        lastBandIndex = -1;
+        for (uint8_t move = 0; move < CONTROL_MOVES; move++) {
+            moves[move] = 0.0f;
+        }
+        stats = {};
+    }
+
+    // Precomputes the prediction matrices for one band.
+    bool configureBand(uint8_t bandIndex, double drift, double coolingCoeff, double heaterCoeff, double deadTime) {
+        if (bandIndex >= Calibration::BAND_COUNT) {
+            return false;
+        }
+        BandHorizon &horizon = horizons[bandIndex];
+        horizon.valid = false;
+        if (!(heaterCoeff > 0.0) || coolingCoeff < 0.0 || deadTime < 0.0) {
+            return false;
+        }
+
+        double stepSeconds = STEP_MS / 1000.0;
+        double decay = exp(-coolingCoeff * stepSeconds);
+        double gain = coolingCoeff > 1e-9 ? (1.0 - decay) / coolingCoeff : stepSeconds;
+
+        horizon.decay = static_cast<float>(decay);
+        horizon.heaterGain = static_cast<float>(heaterCoeff * gain);
+        horizon.driftGain = static_cast<float>(drift * gain);
+        horizon.ambientGain = static_cast<float>(1.0 - decay);
+        horizon.delaySteps = static_cast<uint8_t>(constrain(lround(deadTime / stepSeconds), 0L, static_cast<long>(MAX_DELAY_STEPS)));
+
+        // Free response and step response at each prediction point.
+        double power = 1.0;
+        double powerSum = 0.0;
+        uint16_t step = 0;
+        double impulse[PREDICTION_POINTS * POINT_STEPS];
+        for (uint8_t point = 0; point < PREDICTION_POINTS; point++) {
+            uint16_t pointStep = (point + 1) * POINT_STEPS;
+            for (; step < pointStep; step++) {
+                impulse[step] = power;
+                powerSum += power;
+                power *= decay;
+            }
+            horizon.freeDecay[point] = static_cast<float>(power);
+            horizon.freeAccum[point] = static_cast<float>(powerSum);
+
+            // Command u[i] reaches T at the point with weight a^(s-1-i) * b.
+            for (uint8_t move = 0; move < CONTROL_MOVES; move++) {
+                double sum = 0.0;
+                for (uint16_t input = moveStart(move); input < moveEnd(move) && input < pointStep; input++) {
+                    sum += impulse[pointStep - 1 - input];
+                }
+                horizon.dynamic[point][move] = static_cast<float>(sum * heaterCoeff * gain);
+            }
+        }
+
+        // H = G'G + lambda * D'D, D the first-difference operator with u_prev.
+        for (uint8_t row = 0; row < CONTROL_MOVES; row++) {
+            for (uint8_t column = 0; column < CONTROL_MOVES; column++) {
+                double sum = 0.0;
+                for (uint8_t point = 0; point < PREDICTION_POINTS; point++) {
+                    sum += static_cast<double>(horizon.dynamic[point][row]) * horizon.dynamic[point][column];
+                }
+                if (row == column) {
+                    sum += MOVE_WEIGHT * (row + 1 < CONTROL_MOVES ? 2.0 : 1.0);
+                } else if (row + 1 == column || column + 1 == row) {
+                    sum -= MOVE_WEIGHT;
+                }
+                horizon.hessian[row][column] = static_cast<float>(sum);
+            }
+            horizon.inverseDiagonal[row] = static_cast<float>(1.0 / horizon.hessian[row][row]);
+        }
+
+        horizon.valid = true;
+        return true;
+    }
+
+    bool isBandReady(int8_t bandIndex) const {
+        return bandIndex >= 0 && bandIndex < Calibration::BAND_COUNT && horizons[bandIndex].valid;
+    }
+
+    // Milliseconds from now to prediction point `point` for this band; the
+    // caller samples the profile there to build the reference.
+    uint32_t getPointOffsetMs(int8_t bandIndex, uint8_t point) const {
+        uint8_t delaySteps = isBandReady(bandIndex) ? horizons[bandIndex].delaySteps : 0;
+        return (static_cast<uint32_t>(delaySteps) + static_cast<uint32_t>(point + 1) * POINT_STEPS) * STEP_MS;
+    }
+
+    // Records the heater command actually applied this tick, whichever
+    // controller produced it, so the dead-time prediction stays correct
+    // across mode switches.
+    void recordCommand(double command) {
+        history.push(static_cast<float>(constrain(command, 0.0, 255.0)));
+    }
+
+    // Heater command (0-255) for this tick. `reference` holds the profile
+    // setpoint at each getPointOffsetMs() offset.
+    double solve(int8_t bandIndex, double beanTemp, double ambientTemp, const double *reference) {
+        if (!isBandReady(bandIndex)) {
+            return 0.0;
+        }
+        const BandHorizon &horizon = horizons[bandIndex];
+        float temp = static_cast<float>(beanTemp);
+        float offset = horizon.driftGain + horizon.ambientGain * static_cast<float>(ambientTemp);
+
+        if (lastTempValid && bandIndex == lastBandIndex) {
+            float expected = horizon.decay * lastTemp + horizon.heaterGain * commandAgo(horizon.delaySteps + 1) + offset + disturbance;
+            disturbance += DISTURBANCE_GAIN * (temp - expected);
+            disturbance = constrain(disturbance, -MAX_DISTURBANCE, MAX_DISTURBANCE);
+        }
+        lastTemp = temp;
+        lastTempValid = true;
+        lastBandIndex = bandIndex;
+        offset += disturbance;
+
+        // Roll forward through the dead time with commands already sent.
+        float delayed = temp;
+        for (uint8_t step = 0; step < horizon.delaySteps; step++) {
+            delayed = horizon.decay * delayed + horizon.heaterGain * commandAgo(horizon.delaySteps - step) + offset;
+        }
+
+        float previous = commandAgo(1);
+        float gradient[CONTROL_MOVES] = {};
+        for (uint8_t point = 0; point < PREDICTION_POINTS; point++) {
+            float free = horizon.freeDecay[point] * delayed + horizon.freeAccum[point] * offset;
+            float error = free - static_cast<float>(reference[point]);
+            for (uint8_t move = 0; move < CONTROL_MOVES; move++) {
+                gradient[move] += horizon.dynamic[point][move] * error;
+            }
+        }
+        gradient[0] -= static_cast<float>(MOVE_WEIGHT) * previous;
+
+        // Projected Gauss-Seidel on the box-constrained QP, warm-started
+        // from the last solution.
+        uint8_t sweeps = 0;
+        while (sweeps < MAX_SWEEPS) {
+            sweeps++;
+            float largestChange = 0.0f;
+            for (uint8_t move = 0; move < CONTROL_MOVES; move++) {
+                float residual = gradient[move];
+                for (uint8_t column = 0; column < CONTROL_MOVES; column++) {
+                    residual += horizon.hessian[move][column] * moves[column];
+                }
+                float updated = constrain(moves[move] - residual * horizon.inverseDiagonal[move], 0.0f, 255.0f);
+                largestChange = max(largestChange, fabsf(updated - moves[move]));
+                moves[move] = updated;
+            }
+            if (largestChange < CONVERGED_CHANGE) {
+                break;
+            }
+        }
+
+        stats.sweeps = sweeps;
+        stats.disturbance = disturbance;
+        stats.predictedTemp = delayed;
+        return moves[0];
+    }
+
+    SolveStats getLastSolveStats() const { return stats; }
+    float getDisturbance() const { return disturbance; }
+    uint8_t getDelaySteps(int8_t bandIndex) const { return isBandReady(bandIndex) ? horizons[bandIndex].delaySteps : 0; }
+
+private:
+    static constexpr double MOVE_WEIGHT = 0.001;
+    static constexpr float DISTURBANCE_GAIN = 0.02f;
+    static constexpr float MAX_DISTURBANCE = 2.0f;  // °F per step
+    static constexpr float CONVERGED_CHANGE = 0.01f;
+
+    struct BandHorizon {
+        bool valid = false;
+        uint8_t delaySteps = 0;
+        float decay = 1.0f;
+        float heaterGain = 0.0f;
+        float driftGain = 0.0f;
+        float ambientGain = 0.0f;
+        float freeDecay[PREDICTION_POINTS] = {};
+        float freeAccum[PREDICTION_POINTS] = {};
+        float dynamic[PREDICTION_POINTS][CONTROL_MOVES] = {};
+        float hessian[CONTROL_MOVES][CONTROL_MOVES] = {};
+        float inverseDiagonal[CONTROL_MOVES] = {};
+    };
+
+    BandHorizon horizons[Calibration::BAND_COUNT];
+    RingBuffer<float, MAX_DELAY_STEPS + 2> history;
+    float moves[CONTROL_MOVES] = {};
+    float disturbance = 0.0f;
+    float lastTemp = 0.0f;
+    bool lastTempValid = false;
+    int8_t lastBandIndex = -1;
+    SolveStats stats = {};
+
+    // First step of each blocked move; the last block holds to the horizon end.
+    static uint16_t moveStart(uint8_t move) {
+        static const uint16_t starts[CONTROL_MOVES] = {0, POINT_STEPS, 4 * POINT_STEPS};
+        return starts[move];
+    }
+
+    static uint16_t moveEnd(uint8_t move) {
+        return move + 1 < CONTROL_MOVES ? moveStart(move + 1) : PREDICTION_POINTS * POINT_STEPS;
+    }
+
+    // Command sent `ticks` ticks ago (1 = last tick); 0 before history starts.
+    float commandAgo(uint16_t ticks) const {
+        if (ticks == 0 || ticks > history.size()) {
+            return 0.0f;
+        }
+        return history.peek(history.size() - ticks);
+    }
+};
+
+#endif // MODEL_PREDICTIVE_CONTROLLER_HPP
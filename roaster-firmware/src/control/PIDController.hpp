@@ -2,35 +2,44 @@
 #define PID_CONTROLLER_HPP
 
 #include <Arduino.h>
-
-class PIDController {
+#include "../support/FixedPoint.hpp"
+
+// PID with trapezoidal integration, conditional-integration anti-windup and a
+// filtered derivative on measurement. T is the type the step is computed in;
+// IO is the type of the bound input/setpoint/output variables, so a float or
+// Q16.16 controller can drive the firmware's double globals with only three
+// conversions per step. Gains and limits are set as double and converted once.
+template <typename T, typename IO = T>
+class BasicPIDController {
 public:
-    PIDController(double *input,
-                  double *setpoint,
-                  double *output,
-                  double outputMin,
-                  double outputMax,
-                  double kp,
-                  double ki,
-                  double kd)
+    BasicPIDController(IO *input,
+                       IO *setpoint,
+                       IO *output,
+                       double outputMin,
+                       double outputMax,
+                       double kp,
+                       double ki,
+                       double kd)
         : input(input),
           setpoint(setpoint),
           output(output),
-          outputMin(outputMin),
-          outputMax(outputMax) {
+          outputMin(static_cast<T>(outputMin)),
+          outputMax(static_cast<T>(outputMax)) {
         setGains(kp, ki, kd);
     }
 
     void setGains(double newKp, double newKi, double newKd) {
-        kp = newKp;
-        ki = newKi;
-        kd = newKd;
+        kp = static_cast<T>(newKp);
+        ki = static_cast<T>(newKi);
+        kd = static_cast<T>(newKd);
+        updateIntegralBounds();
     }
 
     void setOutputRange(double newOutputMin, double newOutputMax) {
-        outputMin = newOutputMin;
-        outputMax = newOutputMax;
-        integral = constrain(integral, integralLowerBound(), integralUpperBound());
+        outputMin = static_cast<T>(newOutputMin);
+        outputMax = static_cast<T>(newOutputMax);
+        updateIntegralBounds();
+        integral = clamp(integral, integralMin, integralMax);
     }
 
     void setTimeStep(unsigned long newTimeStepMs) {
@@ -38,46 +47,51 @@ public:
     }
 
     void run() {
+        run(millis());
+    }
+
+    void run(unsigned long now) {
         if (stopped) {
             stopped = false;
-            reset();
+            reset(now);
         }
 
-        unsigned long now = millis();
         unsigned long dtMs = now - lastStepMs;
         if (dtMs < timeStepMs) {
             return;
         }
 
         lastStepMs = now;
-        double dtSeconds = static_cast<double>(dtMs) / 1000.0;
-        double processValue = *input;
-        double error = *setpoint - processValue;
+        // dtMs >= timeStepMs >= 1, so the rate divide below is always defined.
+        int32_t stepMs = static_cast<int32_t>(dtMs < MAX_STEP_MS ? dtMs : MAX_STEP_MS);
+        T dtSeconds = static_cast<T>(stepMs) / static_cast<T>(1000.0);
+        T processValue = static_cast<T>(*input);
+        T error = static_cast<T>(*setpoint) - processValue;
 
         if (!previousInputValid) {
             previousInput = processValue;
             previousInputValid = true;
         }
 
-        double measuredRate = (processValue - previousInput) / max(dtSeconds, 1e-6);
+        T measuredRate = (processValue - previousInput) / dtSeconds;
         previousInput = processValue;
-        filteredMeasurementRate += DERIVATIVE_FILTER * (measuredRate - filteredMeasurementRate);
+        filteredMeasurementRate += static_cast<T>(DERIVATIVE_FILTER) * (measuredRate - filteredMeasurementRate);
 
-        double proportional = kp * error;
-        double derivative = -kd * filteredMeasurementRate;
+        T proportional = kp * error;
+        T derivative = -(kd * filteredMeasurementRate);
 
-        double candidateIntegral = integral + 0.5 * (error + previousError) * dtSeconds;
-        double unsaturated = proportional + ki * candidateIntegral + derivative;
+        T candidateIntegral = integral + static_cast<T>(0.5) * (error + previousError) * dtSeconds;
+        T unsaturated = proportional + ki * candidateIntegral + derivative;
 
-        bool saturatingHigh = unsaturated > outputMax && error > 0.0;
-        bool saturatingLow = unsaturated < outputMin && error < 0.0;
+        bool saturatingHigh = unsaturated > outputMax && error > T();
+        bool saturatingLow = unsaturated < outputMin && error < T();
         if (!saturatingHigh && !saturatingLow) {
-            integral = constrain(candidateIntegral, integralLowerBound(), integralUpperBound());
+            integral = clamp(candidateIntegral, integralMin, integralMax);
         }
 
         previousError = error;
-        double command = proportional + ki * integral + derivative;
-        *output = constrain(command, outputMin, outputMax);
+        T command = proportional + ki * integral + derivative;
+        *output = static_cast<IO>(clamp(command, outputMin, outputMax));
     }
 
     void stop() {
@@ -86,11 +100,15 @@ public:
     }
 
     void reset() {
-        lastStepMs = millis();
-        integral = 0.0;
-        previousError = 0.0;
-        filteredMeasurementRate = 0.0;
-        previousInput = input ? *input : 0.0;
+        reset(millis());
+    }
+
+    void reset(unsigned long now) {
+        lastStepMs = now;
+        integral = T();
+        previousError = T();
+        filteredMeasurementRate = T();
+        previousInput = input ? static_cast<T>(*input) : T();
         previousInputValid = input != nullptr;
     }
 
@@ -99,46 +117,68 @@ public:
     }
 
     double getIntegral() const {
-        return integral;
+        return static_cast<double>(integral);
     }
 
     void setIntegral(double newIntegral) {
-        integral = constrain(newIntegral, integralLowerBound(), integralUpperBound());
+        integral = clamp(static_cast<T>(newIntegral), integralMin, integralMax);
     }
 
 private:
     static constexpr double DERIVATIVE_FILTER = 0.35;
-
-    double *input = nullptr;
-    double *setpoint = nullptr;
-    double *output = nullptr;
-    double kp = 0.0;
-    double ki = 0.0;
-    double kd = 0.0;
-    double integral = 0.0;
-    double previousError = 0.0;
-    double previousInput = 0.0;
-    double filteredMeasurementRate = 0.0;
-    double outputMin = 0.0;
-    double outputMax = 255.0;
+    // Longest step the controller integrates over (keeps Q16.16 dt in range).
+    static constexpr unsigned long MAX_STEP_MS = 30000UL;
+
+    IO *input = nullptr;
+    IO *setpoint = nullptr;
+    IO *output = nullptr;
+    T kp = T();
+    T ki = T();
+    T kd = T();
+    T integral = T();
+    T integralMin = T();
+    T integralMax = T();
+    T previousError = T();
+    T previousInput = T();
+    T filteredMeasurementRate = T();
+    T outputMin = T();
+    T outputMax = static_cast<T>(255.0);
     unsigned long timeStepMs = 1000UL;
     unsigned long lastStepMs = 0UL;
     bool stopped = true;
     bool previousInputValid = false;
 
-    double integralLowerBound() const {
-        if (ki <= 1e-9) {
-            return outputMin;
-        }
-        return outputMin / ki;
+    static T clamp(T value, T low, T high) {
+        return value < low ? low : (value > high ? high : value);
     }
 
-    double integralUpperBound() const {
-        if (ki <= 1e-9) {
-            return outputMax;
+    // Cached so run() does not divide by ki every step.
+    void updateIntegralBounds() {
+        if (ki <= static_cast<T>(1e-9)) {
+            integralMin = outputMin;
+            integralMax = outputMax;
+            return;
         }
-        return outputMax / ki;
+        integralMin = outputMin / ki;
+        integralMax = outputMax / ki;
     }
 };
 
-#endif
\ No newline at end of file
+// Reference implementation; what the tests and tools bind to.
+typedef BasicPIDController<double> PIDController;
+
+// Single precision runs on the ESP32-S3 FPU; double is emulated in software.
+typedef BasicPIDController<float, double> FloatPIDController;
+
+// Integer-only variant for cores without an FPU.
+typedef BasicPIDController<Q16_16, double> FixedPIDController;
+
+// Numeric type of the firmware heater loop. Build with
+// -DROASTER_HEATER_PID_NUMERIC=double to fall back to the reference version.
+#ifndef ROASTER_HEATER_PID_NUMERIC
+#define ROASTER_HEATER_PID_NUMERIC float
+#endif
+
+typedef BasicPIDController<ROASTER_HEATER_PID_NUMERIC, double> HeaterPIDController;
+
+#endif
@@ -4,7 +4,14 @@
 #include <Arduino.h>
 #include <Preferences.h>
 #include <math.h>
+#include <stddef.h>
+#include <string.h>
 #include "../platform/CalibrationTypes.hpp"
+#include "../platform/PreferencesJournal.hpp"
+#include "../support/Crc32.hpp"
+#include "ModelPredictiveController.hpp"
+#include "RateOfRiseEstimator.hpp"
+#include "SmithPredictor.hpp"
 
 class PIDRuntimeController {
 public:
@@ -36,22 +43,24 @@ public:
         validBandCount = 0;
         activeBandIndex = -1;
         lastSetpointValid = false;
-        lastSetpointTemp = 0.0;
-        lastSetpointMs = 0;
+        setpointSlope.reset();
         lastFeedforward = 0.0;
         lastDecision = {};
         for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
             bands[index] = {};
         }
+        predictive.clear();
+        smith.clear();
     }
 
     void resetForRoast() {
         activeBandIndex = -1;
         lastSetpointValid = false;
-        lastSetpointTemp = 0.0;
-        lastSetpointMs = 0;
+        setpointSlope.reset();
         lastFeedforward = 0.0;
         lastDecision = {};
+        predictive.reset();
+        smith.reset();
     }
 
     void setFallbackGains(double newKp, double newKi, double newKd) {
@@ -85,74 +94,54 @@ public:
         }
 
         enabled = validBandCount >= 2;
+        configureBandModels();
         return enabled;
     }
 
-    bool loadFromPreferences(Preferences &prefs) {
+    // The schedule is one CRC-checked blob under SCHEDULE_KEY, so loading
+    // is a single read and a save can never leave bands from two
+    // calibrations side by side. Store is Preferences or PreferencesJournal.
+    // Schedules saved as per-band keys by older firmware are converted the
+    // first time they load.
+    template <typename Store>
+    bool loadFromPreferences(Store &prefs) {
         clear();
 
-        enabled = prefs.getBool("pid_sched", false);
-        if (!enabled) {
-            return false;
-        }
-
-        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
-            BandModel &band = bands[index];
-            band.valid = prefs.getBool(makeBandKey(index, "v"), false);
-            if (!band.valid) {
-                continue;
+        size_t length = prefs.getBytesLength(SCHEDULE_KEY);
+        if (length > 0) {
+            ScheduleBlob blob;
+            if (length != sizeof(blob) || prefs.getBytes(SCHEDULE_KEY, &blob, sizeof(blob)) != sizeof(blob) ||
+                !decodeSchedule(blob)) {
+                clear(); // Corrupt or from another layout: run on fallback gains
+            }
+        } else if (prefs.isKey(LEGACY_ENABLED_KEY)) {
+            loadLegacySchedule(prefs);
+            // The blob has to reach flash before any remove does, so a reset
+            // in between just converts again. A journal writes keys in the
+            // order it first cached them, and the legacy keys were just read,
+            // so it is flushed here. On a failed write the old keys stay.
+            if (!enabled || (saveToPreferences(prefs) && commitNow(prefs))) {
+                removeLegacySchedule(prefs);
             }
-
-            band.targetTemp = prefs.getDouble(makeBandKey(index, "tg"), 0.0);
-            band.minTemp = prefs.getDouble(makeBandKey(index, "mn"), 0.0);
-            band.maxTemp = prefs.getDouble(makeBandKey(index, "mx"), 0.0);
-            band.drift = prefs.getDouble(makeBandKey(index, "dr"), 0.0);
-            band.coolingCoeff = prefs.getDouble(makeBandKey(index, "cc"), 0.0);
-            band.heaterCoeff = prefs.getDouble(makeBandKey(index, "hc"), 0.0);
-            band.deadTime = prefs.getDouble(makeBandKey(index, "dt"), 0.0);
-            band.kp = prefs.getDouble(makeBandKey(index, "kp"), 0.0);
-            band.ki = prefs.getDouble(makeBandKey(index, "ki"), 0.0);
-            band.kd = prefs.getDouble(makeBandKey(index, "kd"), 0.0);
-            validBandCount++;
         }
 
-        enabled = validBandCount >= 2;
-        if (!enabled) {
-            prefs.putBool("pid_sched", false);
-        }
+        configureBandModels();
         return enabled;
     }
 
-    void saveToPreferences(Preferences &prefs) const {
-        prefs.putBool("pid_sched", enabled);
-        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
-            const BandModel &band = bands[index];
-            prefs.putBool(makeBandKey(index, "v"), band.valid);
-            if (!band.valid) {
-                continue;
-            }
-
-            prefs.putDouble(makeBandKey(index, "tg"), band.targetTemp);
-            prefs.putDouble(makeBandKey(index, "mn"), band.minTemp);
-            prefs.putDouble(makeBandKey(index, "mx"), band.maxTemp);
-            prefs.putDouble(makeBandKey(index, "dr"), band.drift);
-            prefs.putDouble(makeBandKey(index, "cc"), band.coolingCoeff);
-            prefs.putDouble(makeBandKey(index, "hc"), band.heaterCoeff);
-            prefs.putDouble(makeBandKey(index, "dt"), band.deadTime);
-            prefs.putDouble(makeBandKey(index, "kp"), band.kp);
-            prefs.putDouble(makeBandKey(index, "ki"), band.ki);
-            prefs.putDouble(makeBandKey(index, "kd"), band.kd);
-        }
+    template <typename Store>
+    bool saveToPreferences(Store &prefs) const {
+        ScheduleBlob blob;
+        encodeSchedule(blob);
+        return prefs.putBytes(SCHEDULE_KEY, &blob, sizeof(blob)) == sizeof(blob);
     }
 
-    void clearPreferences(Preferences &prefs) {
+    template <typename Store>
+    void clearPreferences(Store &prefs) {
         clear();
-        prefs.putBool("pid_sched", false);
-        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
-            const char *suffixes[] = {"v", "tg", "mn", "mx", "dr", "cc", "hc", "dt", "kp", "ki", "kd"};
-            for (size_t suffixIndex = 0; suffixIndex < sizeof(suffixes) / sizeof(suffixes[0]); suffixIndex++) {
-                prefs.remove(makeBandKey(index, suffixes[suffixIndex]));
-            }
+        prefs.remove(SCHEDULE_KEY);
+        if (prefs.isKey(LEGACY_ENABLED_KEY)) {
+            removeLegacySchedule(prefs);
         }
     }
 
@@ -174,15 +163,8 @@ public:
         }
 
         const BandModel &band = bands[bandIndex];
-        double desiredRate = 0.0;
-        if (lastSetpointValid && now > lastSetpointMs) {
-            double dtSeconds = static_cast<double>(now - lastSetpointMs) / 1000.0;
-            if (dtSeconds > 0.0) {
-                desiredRate = (setpointTemp - lastSetpointTemp) / dtSeconds;
-            }
-        }
-
-        desiredRate = constrain(desiredRate, -0.75, 1.5);
+        setpointSlope.addSample(static_cast<uint32_t>(now), setpointTemp);
+        double desiredRate = constrain(setpointSlope.getRatePerSecond(), -0.75, 1.5);
         double effectiveAmbient = ambientTemp > 20.0 ? ambientTemp : currentTemp;
         double leadTarget = setpointTemp + desiredRate * min(band.deadTime, 12.0);
         double rawFeedforward = (desiredRate - band.drift - band.coolingCoeff * (leadTarget - effectiveAmbient)) / max(band.heaterCoeff, 1e-6);
@@ -193,8 +175,6 @@ public:
             : rawFeedforward;
 
         lastSetpointValid = true;
-        lastSetpointTemp = setpointTemp;
-        lastSetpointMs = now;
         lastFeedforward = smoothedFeedforward;
         activeBandIndex = bandIndex;
 
@@ -214,10 +194,61 @@ public:
     ControlDecision getLastDecision() const { return lastDecision; }
     const BandModel &getBand(uint8_t index) const { return bands[index]; }
 
+    // Horizon matrices for the MPC heater mode, rebuilt whenever bands load.
+    ModelPredictiveController &getPredictiveController() { return predictive; }
+    const ModelPredictiveController &getPredictiveController() const { return predictive; }
+
+    // Dead-time model for the Smith-predictor heater mode, rebuilt with it.
+    SmithPredictor &getSmithPredictor() { return smith; }
+    const SmithPredictor &getSmithPredictor() const { return smith; }
+
 private:
+    static constexpr const char *SCHEDULE_KEY = "pid_bands";
+    static constexpr uint32_t SCHEDULE_MAGIC = 0x53444950; // "PIDS"
+    static constexpr uint8_t SCHEDULE_VERSION = 1;
+    static constexpr uint8_t BAND_FIELD_COUNT = 10;
+    // Per-key layout of older firmware: "pid_sched" plus "pb<band><suffix>"
+    static constexpr const char *LEGACY_ENABLED_KEY = "pid_sched";
+
+    // Native layout; the blob is only ever read back by the same firmware
+    // family on the same chip. The CRC covers everything before it.
+    struct ScheduleBlob {
+        uint32_t magic;
+        uint8_t version;
+        uint8_t bandCount;
+        uint8_t validMask;
+        uint8_t reserved;
+        double fields[Calibration::BAND_COUNT][BAND_FIELD_COUNT];
+        uint32_t crc;
+    };
+
+    struct BandField {
+        double BandModel::*member;
+        const char *legacySuffix;
+    };
+
+    static const BandField *bandFields() {
+        static const BandField fields[BAND_FIELD_COUNT] = {
+            {&BandModel::targetTemp, "tg"},
+            {&BandModel::minTemp, "mn"},
+            {&BandModel::maxTemp, "mx"},
+            {&BandModel::drift, "dr"},
+            {&BandModel::coolingCoeff, "cc"},
+            {&BandModel::heaterCoeff, "hc"},
+            {&BandModel::deadTime, "dt"},
+            {&BandModel::kp, "kp"},
+            {&BandModel::ki, "ki"},
+            {&BandModel::kd, "kd"},
+        };
+        return fields;
+    }
+
     static constexpr double FEEDFORWARD_SCALE = 0.85;
     static constexpr double FEEDFORWARD_FILTER = 0.35;
     static constexpr double BAND_HYSTERESIS_F = 6.0;
+    // Short enough to follow profile segment changes, long enough to span
+    // several 250 ms control steps.
+    static constexpr uint32_t SETPOINT_SLOPE_WINDOW_MS = 2000;
 
     double fallbackKp = 0.0;
     double fallbackKi = 0.0;
@@ -226,11 +257,27 @@ private:
     uint8_t validBandCount = 0;
     int8_t activeBandIndex = -1;
     bool lastSetpointValid = false;
-    double lastSetpointTemp = 0.0;
-    unsigned long lastSetpointMs = 0;
+    SlidingSlopeEstimator<16> setpointSlope{SETPOINT_SLOPE_WINDOW_MS, 2};
     double lastFeedforward = 0.0;
     BandModel bands[Calibration::BAND_COUNT];
     ControlDecision lastDecision;
+    ModelPredictiveController predictive;
+    SmithPredictor smith;
+
+    void configureBandModels() {
+        predictive.clear();
+        smith.clear();
+        if (!enabled) {
+            return;
+        }
+        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
+            const BandModel &band = bands[index];
+            if (band.valid) {
+                predictive.configureBand(index, band.drift, band.coolingCoeff, band.heaterCoeff, band.deadTime);
+                smith.configureBand(index, band.coolingCoeff, band.heaterCoeff, band.deadTime);
+            }
+        }
+    }
 
     int8_t selectBand(double setpointTemp) {
         if (activeBandIndex >= 0 && bands[activeBandIndex].valid) {
@@ -265,7 +312,80 @@ private:
         return nearestBand;
     }
 
-    const char *makeBandKey(uint8_t bandIndex, const char *suffix) const {
+    void encodeSchedule(ScheduleBlob &blob) const {
+        memset(&blob, 0, sizeof(blob)); // Padding too, so equal schedules give equal blobs
+        blob.magic = SCHEDULE_MAGIC;
+        blob.version = SCHEDULE_VERSION;
+        blob.bandCount = Calibration::BAND_COUNT;
+        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
+            const BandModel &band = bands[index];
+            if (!band.valid) {
+                continue;
+            }
+            blob.validMask |= static_cast<uint8_t>(1u << index);
+            for (uint8_t field = 0; field < BAND_FIELD_COUNT; field++) {
+                blob.fields[index][field] = band.*(bandFields()[field].member);
+            }
+        }
+        blob.crc = crc32(reinterpret_cast<const uint8_t *>(&blob), offsetof(ScheduleBlob, crc));
+    }
+
+    bool decodeSchedule(const ScheduleBlob &blob) {
+        if (blob.magic != SCHEDULE_MAGIC || blob.version != SCHEDULE_VERSION ||
+            blob.bandCount != Calibration::BAND_COUNT ||
+            blob.crc != crc32(reinterpret_cast<const uint8_t *>(&blob), offsetof(ScheduleBlob, crc))) {
+            return false;
+        }
+        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
+            BandModel &band = bands[index];
+            band.valid = (blob.validMask & (1u << index)) != 0;
+            if (!band.valid) {
+                continue;
+            }
+            for (uint8_t field = 0; field < BAND_FIELD_COUNT; field++) {
+                band.*(bandFields()[field].member) = blob.fields[index][field];
+            }
+            validBandCount++;
+        }
+        enabled = validBandCount >= 2;
+        return true;
+    }
+
+    template <typename Store>
+    void loadLegacySchedule(Store &prefs) {
+        if (!prefs.getBool(LEGACY_ENABLED_KEY, false)) {
+            return;
+        }
+        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
+            BandModel &band = bands[index];
+            band.valid = prefs.getBool(makeBandKey(index, "v"), false);
+            if (!band.valid) {
+                continue;
+            }
+            for (uint8_t field = 0; field < BAND_FIELD_COUNT; field++) {
+                band.*(bandFields()[field].member) = prefs.getDouble(makeBandKey(index, bandFields()[field].legacySuffix), 0.0);
+            }
+            validBandCount++;
+        }
+        enabled = validBandCount >= 2;
+    }
+
+    // Preferences commits every put; a journal only on flush()
+    static bool commitNow(Preferences &) { return true; }
+    static bool commitNow(PreferencesJournal &journal) { return journal.flush(); }
+
+    template <typename Store>
+    static void removeLegacySchedule(Store &prefs) {
+        prefs.remove(LEGACY_ENABLED_KEY);
+        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
+            prefs.remove(makeBandKey(index, "v"));
+            for (uint8_t field = 0; field < BAND_FIELD_COUNT; field++) {
+                prefs.remove(makeBandKey(index, bandFields()[field].legacySuffix));
+            }
+        }
+    }
+
+    static const char *makeBandKey(uint8_t bandIndex, const char *suffix) {
         static char key[16];
         snprintf(key, sizeof(key), "pb%u%s", bandIndex, suffix);
         return key;
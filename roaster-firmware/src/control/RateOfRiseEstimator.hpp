@@ -0,0 +1,143 @@
+#ifndef RATE_OF_RISE_ESTIMATOR_HPP
+#define RATE_OF_RISE_ESTIMATOR_HPP
+
+#include <Arduino.h>
+#include "../support/RingBuffer.hpp"
+
+// Least-squares slope over a sliding time window. Each sample updates the
+// running sums in constant time (add the new point, subtract the ones that
+// aged out), so the cost does not depend on the window length. The sums are
+// rebuilt from the buffered points once every Capacity samples, with time
+// re-referenced to the oldest point, which bounds floating-point drift from
+// the repeated add/subtract without giving up amortized O(1) updates.
+//
+// Capacity bounds the number of points in the window; at the 4 Hz bean
+// sample rate the default 240 covers a 60 s window.
+template <size_t Capacity>
+class SlidingSlopeEstimator {
+public:
+    static constexpr uint32_t DEFAULT_WINDOW_MS = 30000;
+
+    explicit SlidingSlopeEstimator(uint32_t windowMs = DEFAULT_WINDOW_MS, uint8_t minSamples = 3)
+        : windowMs(windowMs > 0 ? windowMs : 1), minSamples(minSamples < 2 ? 2 : minSamples) {}
+
+    void setWindowMs(uint32_t newWindowMs) {
+        windowMs = newWindowMs > 0 ? newWindowMs : 1;
+        if (!points.empty()) {
+            evictOlderThan(newestMs);
+        }
+    }
+
+    void reset() {
+        points.clear();
+        sumX = sumY = sumXX = sumXY = 0.0;
+        baseMs = 0;
+        newestMs = 0;
+        samplesSinceRebuild = 0;
+    }
+
+    // Adds a sample at `timeMs` (wrapping millis()). Samples that do not move
+    // time forward are ignored.
+    void addSample(uint32_t timeMs, double value) {
+        if (points.empty()) {
+            reset();
+            baseMs = timeMs;
+        } else if (static_cast<int32_t>(timeMs - newestMs) <= 0) {
+            return;
+        }
+
+        newestMs = timeMs;
+        evictOlderThan(timeMs);
+        if (points.full()) {
+            removeOldest();
+        }
+
+        Point point = {timeMs, static_cast<float>(value)};
+        points.push(point);
+        accumulate(point, 1.0);
+
+        if (++samplesSinceRebuild >= Capacity) {
+            rebuild();
+        }
+    }
+
+    bool isValid() const {
+        return points.size() >= minSamples && slopeDenominator() > 1e-9;
+    }
+
+    // Slope in value units per second; 0 until enough samples are in the window.
+    double getRatePerSecond() const {
+        if (!isValid()) {
+            return 0.0;
+        }
+        double count = static_cast<double>(points.size());
+        return (count * sumXY - sumX * sumY) / slopeDenominator();
+    }
+
+    double getRatePerMinute() const { return getRatePerSecond() * 60.0; }
+
+    size_t getSampleCount() const { return points.size(); }
+    uint32_t getWindowMs() const { return windowMs; }
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    struct Point {
+        uint32_t timeMs;
+        float value;
+    };
+
+    RingBuffer<Point, Capacity> points;
+    uint32_t windowMs;
+    uint8_t minSamples;
+    uint32_t baseMs = 0;
+    uint32_t newestMs = 0;
+    size_t samplesSinceRebuild = 0;
+    double sumX = 0.0;
+    double sumY = 0.0;
+    double sumXX = 0.0;
+    double sumXY = 0.0;
+
+    double slopeDenominator() const {
+        double count = static_cast<double>(points.size());
+        return count * sumXX - sumX * sumX;
+    }
+
+    void accumulate(const Point &point, double sign) {
+        double x = static_cast<double>(static_cast<int32_t>(point.timeMs - baseMs)) / 1000.0;
+        double y = static_cast<double>(point.value);
+        sumX += sign * x;
+        sumY += sign * y;
+        sumXX += sign * x * x;
+        sumXY += sign * x * y;
+    }
+
+    void removeOldest() {
+        Point oldest;
+        if (points.pop(oldest)) {
+            accumulate(oldest, -1.0);
+        }
+    }
+
+    void evictOlderThan(uint32_t nowMs) {
+        while (!points.empty() && nowMs - points.peek(0).timeMs > windowMs) {
+            removeOldest();
+        }
+    }
+
+    void rebuild() {
+        samplesSinceRebuild = 0;
+        sumX = sumY = sumXX = sumXY = 0.0;
+        if (points.empty()) {
+            return;
+        }
+        baseMs = points.peek(0).timeMs;
+        for (size_t index = 0; index < points.size(); index++) {
+            accumulate(points.peek(index), 1.0);
+        }
+    }
+};
+
+// Bean rate of rise: 60 s of 4 Hz samples at most.
+typedef SlidingSlopeEstimator<240> RateOfRiseEstimator;
+
+#endif // RATE_OF_RISE_ESTIMATOR_HPP
@@ -8,20 +8,25 @@
 
 #include "PIDController.hpp"
 #include "PIDRuntimeController.hpp"
+#include "RateOfRiseEstimator.hpp"
+#include "../platform/PreferencesJournal.hpp"
 #include "../platform/RoasterTypes.hpp"
 #include "../profiles/RoastProfile.hpp"
 
-extern Preferences preferences;
+extern PreferencesJournal preferencesJournal;
 
 extern double kp;
 extern double ki;
 extern double kd;
 extern double currentTemp;
 extern double setpointTemp;
+extern double heaterPidInputVal;
+extern double heaterPidSetpointVal;
 extern double heaterOutputVal;
 extern double heaterPidTrimVal;
 extern double heaterFeedforwardVal;
 extern double fanTemp;
+extern double rateOfRise;
 extern double appliedKp;
 extern double appliedKi;
 extern double appliedKd;
@@ -35,14 +40,16 @@ extern bool pidScheduleConfigured;
 extern bool pidScheduleActive;
 
 extern RoasterState roasterState;
+extern HeaterControlMode heaterControlMode;
 
 extern PWMrelay heaterRelay;
 extern PWMrelay fanRelay;
 extern Servo bdcFan;
 
 extern RoastProfile profile;
-extern PIDController heaterPID;
+extern HeaterPIDController heaterPID;
 extern PIDRuntimeController pidRuntimeController;
+extern RateOfRiseEstimator beanRorEstimator;
 
 inline void applyHeaterPIDGains(double newKp, double newKi, double newKd)
 {
@@ -75,16 +82,134 @@ inline void setManualPIDGains(double newKp, double newKi, double newKd)
   ki = newKi;
   kd = newKd;
 
-  preferences.putDouble("kp", kp);
-  preferences.putDouble("ki", ki);
-  preferences.putDouble("kd", kd);
+  preferencesJournal.putDouble("kp", kp);
+  preferencesJournal.putDouble("ki", ki);
+  preferencesJournal.putDouble("kd", kd);
 
   pidRuntimeController.setFallbackGains(kp, ki, kd);
-  pidRuntimeController.clearPreferences(preferences);
+  pidRuntimeController.clearPreferences(preferencesJournal);
   pidScheduleConfigured = false;
   resetRoastControllerState();
 }
 
+// Feeds an accepted bean reading into the RoR window and republishes the
+// rate (°F/min) read by the display, WebSocket state, Artisan and SystemLink.
+inline void recordBeanTempSample(unsigned long now, double beanTemp)
+{
+  beanRorEstimator.addSample(static_cast<uint32_t>(now), beanTemp);
+  rateOfRise = beanRorEstimator.getRatePerMinute();
+}
+
+inline uint16_t getRateOfRiseWindowSeconds()
+{
+  return static_cast<uint16_t>(beanRorEstimator.getWindowMs() / 1000UL);
+}
+
+inline uint16_t setRateOfRiseWindowSeconds(int seconds, bool persist)
+{
+  uint16_t windowSeconds = static_cast<uint16_t>(constrain(seconds, ROR_WINDOW_MIN_SECONDS, ROR_WINDOW_MAX_SECONDS));
+  beanRorEstimator.setWindowMs(windowSeconds * 1000UL);
+  rateOfRise = beanRorEstimator.getRatePerMinute();
+  if (persist)
+  {
+    preferencesJournal.putInt("ror_window", windowSeconds);
+  }
+  return windowSeconds;
+}
+
+inline const char *getHeaterControlModeName(HeaterControlMode mode)
+{
+  switch (mode)
+  {
+  case HEATER_MODE_MPC:
+    return "mpc";
+  case HEATER_MODE_SMITH:
+    return "smith";
+  default:
+    return "pid";
+  }
+}
+
+inline bool parseHeaterControlMode(const char *name, HeaterControlMode &mode)
+{
+  if (strcmp(name, "mpc") == 0)
+  {
+    mode = HEATER_MODE_MPC;
+    return true;
+  }
+  if (strcmp(name, "smith") == 0)
+  {
+    mode = HEATER_MODE_SMITH;
+    return true;
+  }
+  if (strcmp(name, "pid") == 0)
+  {
+    mode = HEATER_MODE_PID;
+    return true;
+  }
+  return false;
+}
+
+// Maps a persisted "heater_mode" value back to a mode, PID for anything unknown.
+inline HeaterControlMode heaterControlModeFromInt(int value)
+{
+  return value == HEATER_MODE_MPC || value == HEATER_MODE_SMITH ? static_cast<HeaterControlMode>(value) : HEATER_MODE_PID;
+}
+
+// MPC needs the calibrated band models; without them the roast stays on PID
+// whatever the selected mode.
+inline bool isPredictiveHeaterControlActive()
+{
+  return heaterControlMode == HEATER_MODE_MPC && pidScheduleActive &&
+         pidRuntimeController.getPredictiveController().isBandReady(static_cast<int8_t>(activePidBandIndex));
+}
+
+// Like MPC, the Smith predictor needs the band model for its dead time.
+inline bool isSmithPredictorActive()
+{
+  return heaterControlMode == HEATER_MODE_SMITH && pidScheduleActive &&
+         pidRuntimeController.getSmithPredictor().isBandReady(static_cast<int8_t>(activePidBandIndex));
+}
+
+inline void setHeaterControlMode(HeaterControlMode mode, bool persist)
+{
+  heaterControlMode = mode;
+  if (persist)
+  {
+    preferencesJournal.putInt("heater_mode", static_cast<int>(mode));
+  }
+}
+
+// Profile lookup cursors for the look-ahead points. Each point moves
+// forward with the clock like the control loop's own lookup, so each keeps
+// its own cursor and stays O(1) per tick, and the shared cursor stays on the
+// current segment for updateRoastControl(). Only touched on the control path.
+inline uint16_t *predictionPointCursors()
+{
+  static uint16_t cursors[ModelPredictiveController::PREDICTION_POINTS] = {};
+  return cursors;
+}
+
+inline uint16_t &smithLeadCursor()
+{
+  static uint16_t cursor = 0;
+  return cursor;
+}
+
+// Samples the profile at each MPC prediction point and solves for this
+// tick's heater command.
+inline double computePredictiveHeaterOutput(unsigned long now, int8_t bandIndex, double ambientTemp)
+{
+  ModelPredictiveController &predictive = pidRuntimeController.getPredictiveController();
+  uint16_t *cursors = predictionPointCursors();
+  double reference[ModelPredictiveController::PREDICTION_POINTS];
+  for (uint8_t point = 0; point < ModelPredictiveController::PREDICTION_POINTS; point++)
+  {
+    reference[point] = profile.getTargetTemp(now + predictive.getPointOffsetMs(bandIndex, point), cursors[point]);
+  }
+  return predictive.solve(bandIndex, currentTemp, ambientTemp, reference);
+}
+
 inline void updateRoastControl(unsigned long now)
 {
   if (roasterState != ROASTING)
@@ -99,12 +224,43 @@ inline void updateRoastControl(unsigned long now)
   PIDRuntimeController::ControlDecision decision = pidRuntimeController.decide(now, currentTemp, setpointTemp, fanTemp);
   pidScheduleActive = decision.scheduleActive;
   activePidBandIndex = decision.bandIndex;
-  applyHeaterPIDGains(decision.kp, decision.ki, decision.kd);
-
-  heaterPID.run();
 
-  heaterFeedforwardVal = decision.feedforward;
-  heaterOutputVal = constrain(heaterPidTrimVal + heaterFeedforwardVal, 0.0, 255.0);
+  if (isPredictiveHeaterControlActive())
+  {
+    // The PID restarts from a clean state if the mode is switched back.
+    if (!heaterPID.isStopped())
+    {
+      heaterPID.stop();
+    }
+    heaterPidTrimVal = 0;
+    heaterFeedforwardVal = 0;
+    double predictiveOutput = computePredictiveHeaterOutput(now, decision.bandIndex, fanTemp > 20.0 ? fanTemp : currentTemp);
+    heaterOutputVal = constrain(predictiveOutput, 0.0, 255.0);
+  }
+  else
+  {
+    if (isSmithPredictorActive())
+    {
+      // PID closes the loop on where the bean temperature is heading once
+      // the commands in flight land, against the profile one dead time ahead.
+      const SmithPredictor &smith = pidRuntimeController.getSmithPredictor();
+      SmithPredictor::Gains gains = smith.getGains(decision.bandIndex);
+      applyHeaterPIDGains(gains.kp, gains.ki, gains.kd);
+      heaterPidInputVal = currentTemp + smith.getCorrection();
+      heaterPidSetpointVal = profile.getTargetTemp(now + smith.getLeadMs(decision.bandIndex), smithLeadCursor());
+    }
+    else
+    {
+      applyHeaterPIDGains(decision.kp, decision.ki, decision.kd);
+      heaterPidInputVal = currentTemp;
+      heaterPidSetpointVal = setpointTemp;
+    }
+    heaterPID.run(now);
+    heaterFeedforwardVal = decision.feedforward;
+    heaterOutputVal = constrain(heaterPidTrimVal + heaterFeedforwardVal, 0.0, 255.0);
+  }
+  pidRuntimeController.getPredictiveController().recordCommand(heaterOutputVal);
+  pidRuntimeController.getSmithPredictor().recordCommand(decision.bandIndex, heaterOutputVal);
   fanRelay.setPWM(setpointFanSpeed);
 
   int bdcValue = constrain(5 * setpointFanSpeed + 700, 800, 2000);
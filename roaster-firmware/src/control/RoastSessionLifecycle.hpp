@@ -17,6 +17,7 @@ extern int bdcFanMs;
 extern int finalTempOverride;
 extern unsigned long coolingStartTime;
 extern unsigned long roastStartedAtMs;
+extern bool roastStartPending;
 
 extern bool validationProfileLoaded;
 
@@ -33,7 +34,6 @@ extern int savedValidationFinalTempOverride;
 
 uint32_t getEffectiveFinalTargetTemp();
 void resetRoastControllerState();
-static void systemLinkMarkRoastStarted();
 
 inline bool currentRoastUsesValidationProfile()
 {
@@ -79,13 +79,14 @@ inline bool roastShouldCompleteNow()
   return currentTemp >= getEffectiveFinalTargetTemp();
 }
 
+// Called under ControlLock. The state machine's next pass announces the
+// start (SystemLink session, roast archive file, Roasting screen) once the
+// lock is released, so callers never hold it over flash or display work.
 inline void startRoastSession()
 {
   roastStartedAtMs = 0;
   roasterState = START_ROAST;
-  systemLinkMarkRoastStarted();
-  displaySetTargetTemp((int)lround(setpointTemp));
-  displayShowScreen(DisplayScreen::Roasting);
+  roastStartPending = true;
 }
 
 inline bool startValidationRoast(double finalTargetTemp, uint32_t fanPercent)
@@ -109,7 +110,9 @@ inline bool startValidationRoast(double finalTargetTemp, uint32_t fanPercent)
   return true;
 }
 
-inline void enterCoolingState()
+// Entering COOLING, under ControlLock; showCoolingScreen() follows once the
+// caller has released it
+inline void enterCoolingControlState()
 {
   setpointTemp = COOLING_TARGET_TEMP;
   roasterState = COOLING;
@@ -120,7 +123,10 @@ inline void enterCoolingState()
   fanRelay.setPWM(setpointFanSpeed);
   bdcFan.writeMicroseconds(2000);
   bdcFanMs = 2000;
+}
 
+inline void showCoolingScreen()
+{
   displaySetTargetTemp(COOLING_TARGET_TEMP);
   displayShowScreen(DisplayScreen::Cooling);
 }
@@ -0,0 +1,142 @@
+#ifndef SMITH_PREDICTOR_HPP
+#define SMITH_PREDICTOR_HPP
+
+#include <Arduino.h>
+#include <math.h>
+#include "../platform/CalibrationTypes.hpp"
+#include "../support/RingBuffer.hpp"
+
+// Smith-predictor dead-time compensation for the heater PID. Two copies of
+// the active band's FOPDT model run on the commands actually applied, one
+// with the band dead time and one without:
+//
+//   x[k+1] = a * x[k] + b * u[k]          (undelayed)
+//   z[k+1] = a * z[k] + b * u[k - d]      (delayed)
+//
+// with a = exp(-coolingCoeff * dt) and b = heaterCoeff * (1 - a) / coolingCoeff.
+// Drift and ambient enter both copies equally, so only the heater response is
+// modelled. The PID then sees measured + (x - z), which is what the bean
+// temperature will read once the commands already in flight arrive, and is
+// compared against the profile one dead time ahead. With the delay taken out
+// of the loop the band gains can be set from the delay-free plant, which is
+// where the tracking gain over the detuned SIMC gains comes from.
+//
+// The delay line is a fixed RingBuffer of past commands; nothing allocates
+// per tick.
+class SmithPredictor {
+public:
+    static constexpr uint32_t STEP_MS = 250;
+    static constexpr uint8_t MAX_DELAY_STEPS = 64;  // 16 s of dead time
+
+    struct Gains {
+        double kp = 0.0;
+        double ki = 0.0;
+        double kd = 0.0;
+    };
+
+    void clear() {
+        for (uint8_t index = 0; index < Calibration::BAND_COUNT; index++) {
+            bands[index].valid = false;
+        }
+        reset();
+    }
+
+    void reset() {
+        history.clear();
+        undelayedResponse = 0.0f;
+        delayedResponse = 0.0f;
+        lastBandIndex = -1;
+    }
+
+    // Discretizes one band and derives PI gains for its delay-free part
+    // (SIMC with the closed-loop time constant set to the band dead time).
+    bool configureBand(uint8_t bandIndex, double coolingCoeff, double heaterCoeff, double deadTime) {
+        if (bandIndex >= Calibration::BAND_COUNT) {
+            return false;
+        }
+        BandModel &band = bands[bandIndex];
+        band.valid = false;
+        if (!(heaterCoeff > 0.0) || !(coolingCoeff > 0.0) || deadTime < 0.0) {
+            return false;
+        }
+
+        double stepSeconds = STEP_MS / 1000.0;
+        double decay = exp(-coolingCoeff * stepSeconds);
+        band.decay = static_cast<float>(decay);
+        band.heaterGain = static_cast<float>(heaterCoeff * (1.0 - decay) / coolingCoeff);
+        band.delaySteps = static_cast<uint8_t>(constrain(lround(deadTime / stepSeconds), 0L, static_cast<long>(MAX_DELAY_STEPS)));
+
+        double timeConstant = 1.0 / coolingCoeff;
+        double processGain = heaterCoeff / coolingCoeff;
+        double closedLoopTime = max(deadTime, MIN_CLOSED_LOOP_SECONDS);
+        band.gains.kp = timeConstant / (processGain * closedLoopTime);
+        band.gains.ki = band.gains.kp / min(timeConstant, 4.0 * closedLoopTime);
+        band.gains.kd = 0.0;
+        band.valid = true;
+        return true;
+    }
+
+    bool isBandReady(int8_t bandIndex) const {
+        return bandIndex >= 0 && bandIndex < Calibration::BAND_COUNT && bands[bandIndex].valid;
+    }
+
+    Gains getGains(int8_t bandIndex) const { return isBandReady(bandIndex) ? bands[bandIndex].gains : Gains(); }
+
+    // How far ahead of now the PID setpoint should be sampled.
+    uint32_t getLeadMs(int8_t bandIndex) const {
+        return isBandReady(bandIndex) ? static_cast<uint32_t>(bands[bandIndex].delaySteps) * STEP_MS : 0;
+    }
+
+    // Model response still in flight: add to the measured bean temperature.
+    double getCorrection() const {
+        return static_cast<double>(undelayedResponse - delayedResponse);
+    }
+
+    // Advances both model copies by one control step with the heater command
+    // applied this tick. Called in every heater mode so the delay line is
+    // already full when the Smith mode is selected mid-roast; the last usable
+    // band keeps the models running while no band is active.
+    void recordCommand(int8_t bandIndex, double command) {
+        float applied = static_cast<float>(constrain(command, 0.0, 255.0));
+        history.push(applied);
+        if (isBandReady(bandIndex)) {
+            lastBandIndex = bandIndex;
+        }
+        if (lastBandIndex < 0) {
+            return;
+        }
+        const BandModel &band = bands[lastBandIndex];
+        undelayedResponse = band.decay * undelayedResponse + band.heaterGain * applied;
+        delayedResponse = band.decay * delayedResponse + band.heaterGain * commandAgo(band.delaySteps + 1);
+    }
+
+private:
+    // Floor on the closed-loop time constant for bands with little or no
+    // dead time, so the gains stay inside what the relay PWM can follow.
+    static constexpr double MIN_CLOSED_LOOP_SECONDS = 2.0;
+
+    struct BandModel {
+        bool valid = false;
+        uint8_t delaySteps = 0;
+        float decay = 1.0f;
+        float heaterGain = 0.0f;
+        Gains gains;
+    };
+
+    BandModel bands[Calibration::BAND_COUNT];
+    RingBuffer<float, MAX_DELAY_STEPS + 1> history;
+    float undelayedResponse = 0.0f;
+    float delayedResponse = 0.0f;
+    int8_t lastBandIndex = -1;
+
+    // Command pushed `ticks` pushes ago (1 = the one just pushed); 0 before
+    // the history starts, which matches the heater being off before a roast.
+    float commandAgo(uint16_t ticks) const {
+        if (ticks == 0 || ticks > history.size()) {
+            return 0.0f;
+        }
+        return history.peek(history.size() - ticks);
+    }
+};
+
+#endif // SMITH_PREDICTOR_HPP
@@ -223,6 +223,10 @@ public:
         return activeSampleCount > 0 ? activeSampleCount : lastBandSampleCount;
     }
 
+    // Changes whenever the trace is cleared or switches buffers, so a reader
+    // spread over several calls can tell its indexes no longer apply
+    uint16_t getTraceGeneration() const { return traceGeneration; }
+
     TraceSample getTraceSample(uint16_t index) const {
         if (activeSampleCount > 0 && index < activeSampleCount) {
             return samples[index];
@@ -305,6 +309,9 @@ public:
     }
 
 private:
+    // Host benchmarks drive the private fitting routines directly.
+    friend struct StepResponseTunerHostAccess;
+
     enum Phase {
         IDLE,
         STABILIZE,
@@ -372,6 +379,7 @@ private:
     uint16_t activeSampleCount = 0;
     uint16_t lastBandSampleCount = 0;
     uint16_t totalSampleCount = 0;
+    uint16_t traceGeneration = 0;  // Not reset by start(), so it keeps moving
     TraceSample samples[MAX_SAMPLES];
     TraceSample lastBandSamples[MAX_SAMPLES];
 
@@ -406,6 +414,7 @@ private:
         activeSampleCount = 0;
         lastBandSampleCount = 0;
         totalSampleCount = 0;
+        traceGeneration++;
         recommendedKp = 0.0;
         recommendedKi = 0.0;
         recommendedKd = 0.0;
@@ -415,11 +424,11 @@ private:
         noiseStdDev = 0.0;
         lastAmbientTemp = 70.0;
         memset(bandConfigs, 0, sizeof(bandConfigs));
-        memset(bandResults, 0, sizeof(bandResults));
-        memset(samples, 0, sizeof(samples));
-        memset(lastBandSamples, 0, sizeof(lastBandSamples));
+        for (BandResult &result : bandResults) result = BandResult();
+        for (TraceSample &sample : samples) sample = TraceSample();
+        for (TraceSample &sample : lastBandSamples) sample = TraceSample();
         memset(recentTemps, 0, sizeof(recentTemps));
-        memset(&summary, 0, sizeof(summary));
+        summary = Summary();
         memset(seedGains, 0, sizeof(seedGains));
         copyError("none");
     }
@@ -453,12 +462,14 @@ private:
 
     void clearActiveSamples() {
         activeSampleCount = 0;
+        traceGeneration++;
         lastSampleMs = 0;
-        memset(samples, 0, sizeof(samples));
+        for (TraceSample &sample : samples) sample = TraceSample();
     }
 
     void copyBandTrace() {
         lastBandSampleCount = activeSampleCount;
+        traceGeneration++;
         if (lastBandSampleCount > 0) {
             memcpy(lastBandSamples, samples, sizeof(TraceSample) * lastBandSampleCount);
         }
@@ -476,6 +487,9 @@ private:
 
         // Store trace sample
         if (activeSampleCount < MAX_SAMPLES) {
+            if (activeSampleCount == 0) {
+                traceGeneration++;  // The trace moves off lastBandSamples
+            }
             TraceSample &s = samples[activeSampleCount++];
             s.elapsedMs = now - phaseStartMs;
             s.actualTempF = static_cast<float>(chamberTemp);
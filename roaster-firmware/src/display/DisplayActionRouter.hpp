@@ -107,21 +107,13 @@ inline void refreshProfileBrowser(const String &preferredId = String())
     selectedId = profileManager.getActiveProfileId();
   }
 
-  std::vector<String> ids = profileManager.getProfileIds();
+  std::vector<ProfileSummary> summaries = profileManager.getProfileSummaries();
   int selectedIndex = -1;
-  for (size_t index = 0; index < ids.size(); ++index)
+  for (const ProfileSummary &summary : summaries)
   {
-    String name;
-    int finalTarget = -1;
-    bool active = false;
-    if (!profileManager.getProfileSummary(ids[index], name, finalTarget, active))
-    {
-      continue;
-    }
-
-    profileBrowserIds.push_back(ids[index]);
-    profileBrowserEntries.push_back(DisplayProfileSummary{name, finalTarget, active});
-    if (ids[index] == selectedId)
+    profileBrowserIds.push_back(summary.id);
+    profileBrowserEntries.push_back(DisplayProfileSummary{summary.name, summary.finalTarget, summary.active});
+    if (summary.id == selectedId)
     {
       selectedIndex = static_cast<int>(profileBrowserEntries.size()) - 1;
     }
@@ -218,7 +210,10 @@ inline bool activateSelectedProfile()
     return false;
   }
 
-  finalTempOverride = profile.getFinalTargetTemp();
+  {
+    ControlLock controlLock;
+    finalTempOverride = profile.getFinalTargetTemp();
+  }
   syncActiveProfileDisplay(false);
   displaySetFinalTargetTemp(finalTempOverride);
   refreshProfileBrowser(selectedId);
@@ -53,6 +53,7 @@ struct DisplayTelemetry
   int heaterOutput = -1;
   int bdcFanMicros = -1;
   int fanTempF = -1;
+  float rateOfRiseFPerMin = NAN; // NAN hides the RoR readout
 };
 
 struct DisplayWifiFormState
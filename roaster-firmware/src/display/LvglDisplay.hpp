@@ -45,6 +45,7 @@ inline int elapsedSecondsValue = -1;
 inline int fanTempValue = -1;
 inline int heaterOutputValue = -1;
 inline int bdcFanMicrosValue = -1;
+inline float rateOfRiseValue = NAN;
 inline String wifiStatusText = "No network";
 inline String activeProfileText = "No profile";
 inline String profileBrowserFocusText;
@@ -1260,7 +1261,16 @@ inline void updateDerivedLabels()
     {
       lv_label_set_text(targetTempLabel, "Target --\nStop --");
     }
-    lv_label_set_text(progressLabel, elapsedBuffer);
+    if (!isnan(rateOfRiseValue))
+    {
+      char progressBuffer[48];
+      snprintf(progressBuffer, sizeof(progressBuffer), "%s | RoR %+.1f%s/min", elapsedBuffer, rateOfRiseValue, TempUnitSuffix);
+      lv_label_set_text(progressLabel, progressBuffer);
+    }
+    else
+    {
+      lv_label_set_text(progressLabel, elapsedBuffer);
+    }
     if (fanPercentValue >= 0 && heaterPercent >= 0)
     {
       lv_label_set_text_fmt(fanLabel, "Fan %d%% | Heat %d%%", fanPercentValue, heaterPercent);
@@ -1874,6 +1884,7 @@ inline void updateTelemetry(const DisplayTelemetry &telemetry)
   fanTempValue = telemetry.fanTempF;
   heaterOutputValue = telemetry.heaterOutput;
   bdcFanMicrosValue = telemetry.bdcFanMicros;
+  rateOfRiseValue = telemetry.rateOfRiseFPerMin;
   updateDerivedLabels();
 }
 
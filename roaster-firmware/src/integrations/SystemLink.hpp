@@ -14,9 +14,10 @@
 #include "../platform/BoardConfig.hpp"
 #include "../profiles/ProfileManager.hpp"
 #include "../control/StepResponseTuner.hpp"
+#include "../platform/PreferencesJournal.hpp"
 #include "../platform/RoasterTypes.hpp"
 
-extern Preferences preferences;
+extern PreferencesJournal preferencesJournal;
 extern ProfileManager profileManager;
 extern RoastProfile profile;
 extern StepResponseTuner stepTuner;
@@ -24,6 +25,7 @@ extern double currentTemp;
 extern double setpointTemp;
 extern byte setpointFanSpeed;
 extern double fanTemp;
+extern double rateOfRise;
 extern double heaterOutputVal;
 extern double heaterPidTrimVal;
 extern double heaterFeedforwardVal;
@@ -120,6 +122,7 @@ struct HighRateTraceSample {
   int16_t appliedKpHundredths;
   int16_t appliedKiThousandths;
   int16_t appliedKdHundredths;
+  int16_t rateOfRiseTenthsFPerMin;
   int8_t activeBandIndex;
   int8_t stateCode;
   uint8_t flags;
@@ -463,7 +466,7 @@ static void systemLinkUpdatePublishStatus(const String &status, bool persist = t
   portEXIT_CRITICAL(&systemLinkLock);
 
   if (persist) {
-    preferences.putString(SYSTEMLINK_LAST_PUB_STATUS_KEY, status);
+    preferencesJournal.putString(SYSTEMLINK_LAST_PUB_STATUS_KEY, status);
   }
 }
 
@@ -473,7 +476,7 @@ static void systemLinkUpdateLastFault(const String &fault, bool persist = true)
   portEXIT_CRITICAL(&systemLinkLock);
 
   if (persist) {
-    preferences.putString(SYSTEMLINK_LAST_FAULT_KEY, fault);
+    preferencesJournal.putString(SYSTEMLINK_LAST_FAULT_KEY, fault);
   }
 }
 
@@ -490,38 +493,38 @@ static void systemLinkPersistBreadcrumb(const SystemLinkRoastSession &session,
                                         bool active,
                                         bool pending,
                                         const char *phase) {
-  preferences.putBool(SYSTEMLINK_ACTIVE_KEY, active);
-  preferences.putBool(SYSTEMLINK_PENDING_KEY, pending);
-  preferences.putString(SYSTEMLINK_PHASE_KEY, phase);
-  preferences.putString(SYSTEMLINK_BC_PROFILE_ID_KEY, session.profileId);
-  preferences.putString(SYSTEMLINK_BC_PROFILE_NAME_KEY, session.profileName);
-  preferences.putUInt(SYSTEMLINK_BC_TARGET_KEY, session.finalTargetTempF);
-  preferences.putUInt(SYSTEMLINK_BC_SP_COUNT_KEY, session.setpointCount);
-  preferences.putDouble(SYSTEMLINK_BC_KP_KEY, session.kp);
-  preferences.putDouble(SYSTEMLINK_BC_KI_KEY, session.ki);
-  preferences.putDouble(SYSTEMLINK_BC_KD_KEY, session.kd);
-  preferences.putInt(SYSTEMLINK_BC_OVERRIDE_KEY, session.finalTempOverrideF);
-  preferences.putString(SYSTEMLINK_BC_REASON_KEY, session.outcomeReason);
+  preferencesJournal.putBool(SYSTEMLINK_ACTIVE_KEY, active);
+  preferencesJournal.putBool(SYSTEMLINK_PENDING_KEY, pending);
+  preferencesJournal.putString(SYSTEMLINK_PHASE_KEY, phase);
+  preferencesJournal.putString(SYSTEMLINK_BC_PROFILE_ID_KEY, session.profileId);
+  preferencesJournal.putString(SYSTEMLINK_BC_PROFILE_NAME_KEY, session.profileName);
+  preferencesJournal.putUInt(SYSTEMLINK_BC_TARGET_KEY, session.finalTargetTempF);
+  preferencesJournal.putUInt(SYSTEMLINK_BC_SP_COUNT_KEY, session.setpointCount);
+  preferencesJournal.putDouble(SYSTEMLINK_BC_KP_KEY, session.kp);
+  preferencesJournal.putDouble(SYSTEMLINK_BC_KI_KEY, session.ki);
+  preferencesJournal.putDouble(SYSTEMLINK_BC_KD_KEY, session.kd);
+  preferencesJournal.putInt(SYSTEMLINK_BC_OVERRIDE_KEY, session.finalTempOverrideF);
+  preferencesJournal.putString(SYSTEMLINK_BC_REASON_KEY, session.outcomeReason);
 }
 
 static void systemLinkClearBreadcrumb() {
-  preferences.putBool(SYSTEMLINK_ACTIVE_KEY, false);
-  preferences.putBool(SYSTEMLINK_PENDING_KEY, false);
-  preferences.putString(SYSTEMLINK_PHASE_KEY, "idle");
-  preferences.remove(SYSTEMLINK_BC_PROFILE_ID_KEY);
-  preferences.remove(SYSTEMLINK_BC_PROFILE_NAME_KEY);
-  preferences.remove(SYSTEMLINK_BC_TARGET_KEY);
-  preferences.remove(SYSTEMLINK_BC_SP_COUNT_KEY);
-  preferences.remove(SYSTEMLINK_BC_KP_KEY);
-  preferences.remove(SYSTEMLINK_BC_KI_KEY);
-  preferences.remove(SYSTEMLINK_BC_KD_KEY);
-  preferences.remove(SYSTEMLINK_BC_OVERRIDE_KEY);
-  preferences.remove(SYSTEMLINK_BC_REASON_KEY);
+  preferencesJournal.putBool(SYSTEMLINK_ACTIVE_KEY, false);
+  preferencesJournal.putBool(SYSTEMLINK_PENDING_KEY, false);
+  preferencesJournal.putString(SYSTEMLINK_PHASE_KEY, "idle");
+  preferencesJournal.remove(SYSTEMLINK_BC_PROFILE_ID_KEY);
+  preferencesJournal.remove(SYSTEMLINK_BC_PROFILE_NAME_KEY);
+  preferencesJournal.remove(SYSTEMLINK_BC_TARGET_KEY);
+  preferencesJournal.remove(SYSTEMLINK_BC_SP_COUNT_KEY);
+  preferencesJournal.remove(SYSTEMLINK_BC_KP_KEY);
+  preferencesJournal.remove(SYSTEMLINK_BC_KI_KEY);
+  preferencesJournal.remove(SYSTEMLINK_BC_KD_KEY);
+  preferencesJournal.remove(SYSTEMLINK_BC_OVERRIDE_KEY);
+  preferencesJournal.remove(SYSTEMLINK_BC_REASON_KEY);
 }
 
 static void systemLinkPrepareRecoveryPublish() {
-  bool hadActive = preferences.getBool(SYSTEMLINK_ACTIVE_KEY, false);
-  bool hadPending = preferences.getBool(SYSTEMLINK_PENDING_KEY, false);
+  bool hadActive = preferencesJournal.getBool(SYSTEMLINK_ACTIVE_KEY, false);
+  bool hadPending = preferencesJournal.getBool(SYSTEMLINK_PENDING_KEY, false);
   if (!hadActive && !hadPending) {
     return;
   }
@@ -529,19 +532,19 @@ static void systemLinkPrepareRecoveryPublish() {
   memset(&systemLinkPublishSession, 0, sizeof(SystemLinkRoastSession));
   systemLinkPublishSession.outcome = SYSTEMLINK_OUTCOME_ERRORED;
   systemLinkPublishSession.recoveredAfterReset = true;
-  systemLinkPublishSession.finalTargetTempF = preferences.getUInt(SYSTEMLINK_BC_TARGET_KEY, 0);
-  systemLinkPublishSession.setpointCount = preferences.getUInt(SYSTEMLINK_BC_SP_COUNT_KEY, 0);
-  systemLinkPublishSession.kp = preferences.getDouble(SYSTEMLINK_BC_KP_KEY, kp);
-  systemLinkPublishSession.ki = preferences.getDouble(SYSTEMLINK_BC_KI_KEY, ki);
-  systemLinkPublishSession.kd = preferences.getDouble(SYSTEMLINK_BC_KD_KEY, kd);
-  systemLinkPublishSession.finalTempOverrideF = preferences.getInt(SYSTEMLINK_BC_OVERRIDE_KEY, -1);
+  systemLinkPublishSession.finalTargetTempF = preferencesJournal.getUInt(SYSTEMLINK_BC_TARGET_KEY, 0);
+  systemLinkPublishSession.setpointCount = preferencesJournal.getUInt(SYSTEMLINK_BC_SP_COUNT_KEY, 0);
+  systemLinkPublishSession.kp = preferencesJournal.getDouble(SYSTEMLINK_BC_KP_KEY, kp);
+  systemLinkPublishSession.ki = preferencesJournal.getDouble(SYSTEMLINK_BC_KI_KEY, ki);
+  systemLinkPublishSession.kd = preferencesJournal.getDouble(SYSTEMLINK_BC_KD_KEY, kd);
+  systemLinkPublishSession.finalTempOverrideF = preferencesJournal.getInt(SYSTEMLINK_BC_OVERRIDE_KEY, -1);
   systemLinkCopyString(systemLinkPublishSession.profileId,
                        sizeof(systemLinkPublishSession.profileId),
-                       preferences.getString(SYSTEMLINK_BC_PROFILE_ID_KEY, ""));
+                       preferencesJournal.getString(SYSTEMLINK_BC_PROFILE_ID_KEY, ""));
   systemLinkCopyString(systemLinkPublishSession.profileName,
                        sizeof(systemLinkPublishSession.profileName),
-                       preferences.getString(SYSTEMLINK_BC_PROFILE_NAME_KEY, ""));
-  String phase = preferences.getString(SYSTEMLINK_PHASE_KEY, hadPending ? "publish_pending" : "roasting");
+                       preferencesJournal.getString(SYSTEMLINK_BC_PROFILE_NAME_KEY, ""));
+  String phase = preferencesJournal.getString(SYSTEMLINK_PHASE_KEY, hadPending ? "publish_pending" : "roasting");
   String resetReason = systemLinkResetReasonName(esp_reset_reason());
   String reason = String("reset_during_") + phase + ":" + resetReason;
   systemLinkCopyString(systemLinkPublishSession.outcomeReason,
@@ -890,7 +893,8 @@ static bool systemLinkCreateHighRateTraceTable(const String &resultId,
     {"scheduleActive", "BOOL"},
     {"appliedKp", "FLOAT64"},
     {"appliedKi", "FLOAT64"},
-    {"appliedKd", "FLOAT64"}
+    {"appliedKd", "FLOAT64"},
+    {"rateOfRiseFPerMin", "FLOAT64"}
   };
 
   for (size_t index = 0; index < sizeof(columnSpecs) / sizeof(columnSpecs[0]); index++) {
@@ -940,8 +944,8 @@ static bool systemLinkAppendHighRateTraceRows(const String &tableId,
                                               bool endOfData) {
   String body;
   size_t rowCount = static_cast<size_t>(endIndex - startIndex);
-  body.reserve(512 + rowCount * 180);
-  body += F("{\"frame\":{\"columns\":[\"rowIndex\",\"elapsedMs\",\"stateCode\",\"actualTempF\",\"targetTempF\",\"fanTempF\",\"heaterOutput\",\"heaterPidTrim\",\"heaterFeedforward\",\"fanOutput\",\"activeBand\",\"scheduleActive\",\"appliedKp\",\"appliedKi\",\"appliedKd\"],\"data\":[");
+  body.reserve(512 + rowCount * 192);
+  body += F("{\"frame\":{\"columns\":[\"rowIndex\",\"elapsedMs\",\"stateCode\",\"actualTempF\",\"targetTempF\",\"fanTempF\",\"heaterOutput\",\"heaterPidTrim\",\"heaterFeedforward\",\"fanOutput\",\"activeBand\",\"scheduleActive\",\"appliedKp\",\"appliedKi\",\"appliedKd\",\"rateOfRiseFPerMin\"],\"data\":[");
 
   for (uint16_t index = startIndex; index < endIndex; index++) {
     if (index > startIndex) {
@@ -979,6 +983,8 @@ static bool systemLinkAppendHighRateTraceRows(const String &tableId,
     systemLinkAppendJsonStringValue(body, systemLinkSerializeScaledFloat(sample.appliedKiThousandths, 1000));
     body += ',';
     systemLinkAppendJsonStringValue(body, systemLinkSerializeScaledFloat(sample.appliedKdHundredths, 100));
+    body += ',';
+    systemLinkAppendJsonStringValue(body, systemLinkSerializeScaledFloat(sample.rateOfRiseTenthsFPerMin, 10));
     body += ']';
   }
 
@@ -1205,38 +1211,38 @@ static String systemLinkStatusDisplayName(SystemLinkRoastOutcome outcome) {
 
 static void loadSystemLinkConfig() {
   portENTER_CRITICAL(&systemLinkLock);
-  systemLinkConfig.enabled = preferences.getBool(SYSTEMLINK_ENABLED_KEY, false);
+  systemLinkConfig.enabled = preferencesJournal.getBool(SYSTEMLINK_ENABLED_KEY, false);
   systemLinkCopyString(systemLinkConfig.apiUrl,
                        sizeof(systemLinkConfig.apiUrl),
-                       preferences.getString(SYSTEMLINK_API_URL_KEY,
+                       preferencesJournal.getString(SYSTEMLINK_API_URL_KEY,
                                              "https://dev-api.lifecyclesolutions.ni.com"));
   systemLinkCopyString(systemLinkConfig.workspaceId,
                        sizeof(systemLinkConfig.workspaceId),
-                       preferences.getString(SYSTEMLINK_WORKSPACE_KEY, ""));
+                       preferencesJournal.getString(SYSTEMLINK_WORKSPACE_KEY, ""));
   systemLinkCopyString(systemLinkConfig.systemId,
                        sizeof(systemLinkConfig.systemId),
-                       preferences.getString(SYSTEMLINK_SYSTEM_ID_KEY, ""));
+                       preferencesJournal.getString(SYSTEMLINK_SYSTEM_ID_KEY, ""));
   systemLinkCopyString(systemLinkConfig.apiKey,
                        sizeof(systemLinkConfig.apiKey),
-                       preferences.getString(SYSTEMLINK_API_KEY_KEY, ""));
+                       preferencesJournal.getString(SYSTEMLINK_API_KEY_KEY, ""));
   systemLinkCopyString(systemLinkTelemetry.lastFault,
                        sizeof(systemLinkTelemetry.lastFault),
-                       preferences.getString(SYSTEMLINK_LAST_FAULT_KEY, "none"));
+                       preferencesJournal.getString(SYSTEMLINK_LAST_FAULT_KEY, "none"));
   systemLinkCopyString(systemLinkTelemetry.publishStatus,
                        sizeof(systemLinkTelemetry.publishStatus),
-                       preferences.getString(SYSTEMLINK_LAST_PUB_STATUS_KEY, "idle"));
+                       preferencesJournal.getString(SYSTEMLINK_LAST_PUB_STATUS_KEY, "idle"));
   portEXIT_CRITICAL(&systemLinkLock);
 }
 
 static void saveSystemLinkConfig() {
-  preferences.putBool(SYSTEMLINK_ENABLED_KEY, systemLinkConfig.enabled);
-  preferences.putString(SYSTEMLINK_API_URL_KEY, systemLinkConfig.apiUrl);
-  preferences.putString(SYSTEMLINK_WORKSPACE_KEY, systemLinkConfig.workspaceId);
-  preferences.putString(SYSTEMLINK_SYSTEM_ID_KEY, systemLinkConfig.systemId);
+  preferencesJournal.putBool(SYSTEMLINK_ENABLED_KEY, systemLinkConfig.enabled);
+  preferencesJournal.putString(SYSTEMLINK_API_URL_KEY, systemLinkConfig.apiUrl);
+  preferencesJournal.putString(SYSTEMLINK_WORKSPACE_KEY, systemLinkConfig.workspaceId);
+  preferencesJournal.putString(SYSTEMLINK_SYSTEM_ID_KEY, systemLinkConfig.systemId);
   if (systemLinkConfig.apiKey[0] == '\0') {
-    preferences.remove(SYSTEMLINK_API_KEY_KEY);
+    preferencesJournal.remove(SYSTEMLINK_API_KEY_KEY);
   } else {
-    preferences.putString(SYSTEMLINK_API_KEY_KEY, systemLinkConfig.apiKey);
+    preferencesJournal.putString(SYSTEMLINK_API_KEY_KEY, systemLinkConfig.apiKey);
   }
 }
 
@@ -1648,6 +1654,7 @@ static void systemLinkRecordHighRateSample() {
     sample.appliedKpHundredths = static_cast<int16_t>(lroundf(static_cast<float>(appliedKp) * 100.0f));
     sample.appliedKiThousandths = static_cast<int16_t>(lroundf(static_cast<float>(appliedKi) * 1000.0f));
     sample.appliedKdHundredths = static_cast<int16_t>(lroundf(static_cast<float>(appliedKd) * 100.0f));
+    sample.rateOfRiseTenthsFPerMin = static_cast<int16_t>(lroundf(static_cast<float>(rateOfRise) * 10.0f));
     sample.activeBandIndex = static_cast<int8_t>(activePidBandIndex);
     sample.stateCode = static_cast<int8_t>(roasterState);
     sample.flags = pidScheduleActive ? 0x01U : 0x00U;
@@ -0,0 +1,149 @@
+#ifndef ARTISAN_STREAM_HPP
+#define ARTISAN_STREAM_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../support/JsonWriter.hpp"
+#include "../support/StaticMutex.hpp"
+
+// Artisan's WebSocket device polls with {"command":"getData","id":n} and
+// matches the reply by "id":
+//   {"id":n,"data":{"bt":..,"st":..,"fs":..,"ft":..,"ror":..}}
+// The reply goes to the client that asked only. A client that would
+// rather not poll sends {"command":"push","interval":ms} once and then gets
+//   {"push":"data","ts":millis,"data":{...}}
+// every `interval` ms (clamped to ARTISAN_PUSH_MIN_INTERVAL_MS..
+// ARTISAN_PUSH_MAX_INTERVAL_MS); "interval":0 stops it. Replies and push
+// frames are written into fixed buffers, without a JsonDocument.
+
+static constexpr size_t ARTISAN_JSON_CAPACITY = 192;
+static constexpr uint32_t ARTISAN_PUSH_MIN_INTERVAL_MS = 250;
+static constexpr uint32_t ARTISAN_PUSH_MAX_INTERVAL_MS = 10000;
+
+struct ArtisanReading {
+  double bt = 0.0;   // Bean temperature (°F)
+  double st = 0.0;   // Setpoint (°F)
+  int fs = 0;        // Fan speed (%)
+  double ft = 0.0;   // Inlet temperature (°F)
+  double ror = 0.0;  // Bean rate of rise (°F/min)
+};
+
+// The request's "id", echoed back as it came: a number, a string, or left
+// out when the request had none.
+struct ArtisanRequestId {
+  bool present = false;
+  const char *text = nullptr;  // Set for string ids
+  long number = 0;
+};
+
+inline void writeArtisanData(JsonWriter &json, const ArtisanReading &reading) {
+  json.beginObject("data");
+  json.fieldFixed("bt", reading.bt, 2);
+  json.fieldFixed("st", reading.st, 2);
+  json.fieldInt("fs", reading.fs);
+  json.fieldFixed("ft", reading.ft, 2);
+  json.fieldFixed("ror", reading.ror, 2);
+  json.endObject();
+}
+
+// Both writers return the length, or 0 if the payload did not fit.
+inline size_t writeArtisanReply(const ArtisanReading &reading, const ArtisanRequestId &id, char *out, size_t capacity) {
+  JsonWriter json(out, capacity);
+  json.beginObject();
+  if (id.present && id.text != nullptr) {
+    json.fieldString("id", id.text);
+  } else if (id.present) {
+    json.fieldInt("id", id.number);
+  }
+  writeArtisanData(json, reading);
+  json.endObject();
+  return json.overflowed() ? 0 : json.length();
+}
+
+inline size_t writeArtisanPush(const ArtisanReading &reading, unsigned long timestamp, char *out, size_t capacity) {
+  JsonWriter json(out, capacity);
+  json.beginObject();
+  json.fieldString("push", "data");
+  json.fieldUInt("ts", timestamp);
+  writeArtisanData(json, reading);
+  json.endObject();
+  return json.overflowed() ? 0 : json.length();
+}
+
+// Clients with a push interval. Commands arrive on the network task and
+// frames go out from loop(), hence the lock.
+class ArtisanPushSubscribers {
+ public:
+  static constexpr size_t MAX_SUBSCRIBERS = 8;
+
+  // The interval actually used for a requested one; 0 stays 0 (stop)
+  static uint32_t clampInterval(long intervalMs) {
+    if (intervalMs <= 0) return 0;
+    if (intervalMs < static_cast<long>(ARTISAN_PUSH_MIN_INTERVAL_MS)) return ARTISAN_PUSH_MIN_INTERVAL_MS;
+    if (intervalMs > static_cast<long>(ARTISAN_PUSH_MAX_INTERVAL_MS)) return ARTISAN_PUSH_MAX_INTERVAL_MS;
+    return static_cast<uint32_t>(intervalMs);
+  }
+
+  // The first frame is due right away. False when every slot is taken.
+  bool subscribe(uint32_t clientId, uint32_t intervalMs, unsigned long now) {
+    Lock lock;
+    int index = find(clientId);
+    if (index < 0) {
+      if (count >= MAX_SUBSCRIBERS) return false;
+      index = static_cast<int>(count++);
+    }
+    subscribers[index] = Subscriber{clientId, intervalMs, now};
+    return true;
+  }
+
+  void unsubscribe(uint32_t clientId) {
+    Lock lock;
+    int index = find(clientId);
+    if (index < 0) return;
+    subscribers[index] = subscribers[--count];
+  }
+
+  // Copies the ids of the clients due a frame at `now` into `out` and
+  // schedules their next one. A client that fell more than an interval
+  // behind is rescheduled from now rather than sent a burst.
+  size_t takeDue(unsigned long now, uint32_t *out) {
+    Lock lock;
+    size_t due = 0;
+    for (size_t i = 0; i < count; i++) {
+      Subscriber &subscriber = subscribers[i];
+      if (static_cast<long>(now - subscriber.nextDue) < 0) continue;
+      out[due++] = subscriber.clientId;
+      subscriber.nextDue += subscriber.intervalMs;
+      if (static_cast<long>(now - subscriber.nextDue) >= 0) {
+        subscriber.nextDue = now + subscriber.intervalMs;
+      }
+    }
+    return due;
+  }
+
+  size_t size() {
+    Lock lock;
+    return count;
+  }
+
+ private:
+  struct Subscriber {
+    uint32_t clientId;
+    uint32_t intervalMs;
+    unsigned long nextDue;
+  };
+
+  using Lock = StaticMutexLock<ArtisanPushSubscribers>;
+
+  Subscriber subscribers[MAX_SUBSCRIBERS] = {};
+  size_t count = 0;
+
+  int find(uint32_t clientId) const {
+    for (size_t i = 0; i < count; i++) {
+      if (subscribers[i].clientId == clientId) return static_cast<int>(i);
+    }
+    return -1;
+  }
+};
+
+#endif // ARTISAN_STREAM_HPP
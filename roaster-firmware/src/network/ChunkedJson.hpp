@@ -0,0 +1,353 @@
+#ifndef CHUNKED_JSON_HPP
+#define CHUNKED_JSON_HPP
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <memory>
+#include <utility>
+#include "../support/JsonWriter.hpp"
+#include "../control/StepResponseTuner.hpp"
+#include "../platform/ControlTask.hpp"
+#include "../profiles/RoastProfile.hpp"
+
+// JSON responses that grow with their data (the calibration trace, a
+// profile's setpoints) are written a piece at a time into one small buffer
+// and handed to beginChunkedResponse, instead of being built whole in a
+// JsonDocument or String first. The heap held per response is the piece
+// buffer plus whatever the stream copied to describe, however long the
+// document gets.
+//
+//   auto stream = std::make_shared<StepTraceJsonStream>(stepTuner);
+//   request->beginChunkedResponse("application/json",
+//       [stream](uint8_t *buffer, size_t maxLen, size_t) -> size_t {
+//         return stream->read(buffer, maxLen);
+//       });
+
+// Fits the largest single piece below: one calibration band with its model
+static constexpr size_t CHUNKED_JSON_PIECE_CAPACITY = 768;
+
+class ChunkedJsonStream {
+ public:
+  explicit ChunkedJsonStream(size_t pieceCapacity = CHUNKED_JSON_PIECE_CAPACITY)
+      : piece(new char[pieceCapacity]), json(piece.get(), pieceCapacity) {}
+  virtual ~ChunkedJsonStream() = default;
+
+  ChunkedJsonStream(const ChunkedJsonStream &) = delete;
+  ChunkedJsonStream &operator=(const ChunkedJsonStream &) = delete;
+
+  // Copies up to maxLen bytes of the document into out; 0 once it is done.
+  // A piece that overflows the buffer ends the response there, so the
+  // client sees truncated JSON rather than the server writing past it.
+  size_t read(uint8_t *out, size_t maxLen) {
+    size_t copied = 0;
+    while (copied < maxLen) {
+      if (sent == json.length()) {
+        if (finished) break;
+        json.reuseBuffer();
+        sent = 0;
+        finished = !writeNext(json);
+        if (json.overflowed()) {
+          failed = true;
+          finished = true;
+          json.reuseBuffer();
+        }
+        continue;
+      }
+      size_t count = json.length() - sent;
+      if (count > maxLen - copied) count = maxLen - copied;
+      memcpy(out + copied, json.c_str() + sent, count);
+      sent += count;
+      copied += count;
+    }
+    return copied;
+  }
+
+  bool done() const { return finished && sent == json.length(); }
+  bool overflowed() const { return failed; }
+
+ protected:
+  // Writes the next piece; false once the document is closed
+  virtual bool writeNext(JsonWriter &json) = 0;
+
+ private:
+  std::unique_ptr<char[]> piece;
+  JsonWriter json;
+  size_t sent = 0;
+  bool finished = false;
+  bool failed = false;
+};
+
+// GET /api/calibrate-pid/trace, read straight from the tuner's sample
+// array. The sample count is taken when the response starts; samples
+// recorded while it is being sent wait for the next poll. The control task
+// keeps recording meanwhile, so each piece is read under ControlLock, and a
+// trace cleared or moved to another band since the start ends the array
+// there rather than mixing in samples of a different band.
+class StepTraceJsonStream : public ChunkedJsonStream {
+ public:
+  static constexpr uint16_t SAMPLES_PER_PIECE = 6;
+
+  explicit StepTraceJsonStream(const StepResponseTuner &tuner) : tuner(tuner) {
+    ControlLock controlLock;
+    count = tuner.getTraceSampleCount();
+    band = tuner.getActiveBandIndex();
+    generation = tuner.getTraceGeneration();
+  }
+
+ protected:
+  bool writeNext(JsonWriter &json) override {
+    ControlLock controlLock;
+    if (!started) {
+      started = true;
+      json.beginObject();
+      json.fieldBool("running", tuner.isRunning());
+      json.fieldString("method", "step_response");
+      json.fieldString("phase", tuner.getPhaseName());
+      json.fieldUInt("bandIndex", static_cast<unsigned long>(band) + 1);
+      json.beginArray("samples");
+      return true;
+    }
+    if (tuner.getTraceGeneration() != generation || tuner.getActiveBandIndex() != band) {
+      count = next;
+    } else if (count > tuner.getTraceSampleCount()) {
+      count = tuner.getTraceSampleCount();
+    }
+    for (uint16_t i = 0; i < SAMPLES_PER_PIECE && next < count; i++, next++) {
+      StepResponseTuner::TraceSample sample = tuner.getTraceSample(next);
+      json.beginObject();
+      json.fieldFixed("elapsedSeconds", sample.elapsedMs / 1000.0, 1);
+      json.fieldFixed("actualTempF", sample.actualTempF, 1);
+      json.fieldFixed("setpointTempF", sample.setpointTempF, 1);
+      json.fieldFixed("heaterOutput", sample.heaterOutput, 1);
+      json.fieldUInt("phaseId", sample.phaseId);
+      json.endObject();
+    }
+    if (next < count) return true;
+    json.endArray();
+    json.endObject();
+    return false;
+  }
+
+ private:
+  const StepResponseTuner &tuner;
+  uint16_t count = 0;
+  uint8_t band = 0;
+  uint16_t generation = 0;
+  uint16_t next = 0;
+  bool started = false;
+};
+
+// GET /api/calibrate-pid/status: the tuner state and a copy of its summary,
+// one band per piece. kp/ki/kd are the gains in force, reported once the
+// calibration is complete.
+class StepStatusJsonStream : public ChunkedJsonStream {
+ public:
+  StepStatusJsonStream(const StepResponseTuner &tuner, double kp, double ki, double kd)
+      : kp(kp), ki(ki), kd(kd) {
+    // The control task advances the tuner, so copy it in one piece under
+    // ControlLock rather than mixing fields from two ticks.
+    ControlLock controlLock;
+    running = tuner.isRunning();
+    complete = tuner.isComplete();
+    progressPercent = tuner.getProgressPercent();
+    sampleCount = tuner.getSampleCount();
+    summary = tuner.getSummary();
+    copyText(phase, sizeof(phase), tuner.getPhaseName());
+    copyText(lastError, sizeof(lastError), tuner.getLastError());
+    bandCount = summary.totalBands < StepResponseTuner::MAX_BANDS
+                    ? summary.totalBands
+                    : StepResponseTuner::MAX_BANDS;
+  }
+
+ protected:
+  bool writeNext(JsonWriter &json) override {
+    switch (stage) {
+      case HEADER:
+        writeHeader(json);
+        stage = BANDS;
+        return true;
+      case BANDS:
+        if (band == 0) json.beginArray("bands");
+        if (band < bandCount) {
+          writeBand(json, summary.bands[band], band);
+          band++;
+          return true;
+        }
+        json.endArray();
+        band = 0;
+        stage = CYCLES;
+        return true;
+      case CYCLES:
+        if (band == 0) json.beginArray("cycles");
+        if (band < bandCount) {
+          writeCycle(json, summary.bands[band], band);
+          band++;
+          return true;
+        }
+        json.endArray();
+        stage = FOOTER;
+        return true;
+      case FOOTER:
+      default:
+        if (complete) {
+          json.fieldFixed("kp", kp, 6);
+          json.fieldFixed("ki", ki, 6);
+          json.fieldFixed("kd", kd, 6);
+        }
+        json.endObject();
+        json.endObject();
+        return false;
+    }
+  }
+
+ private:
+  enum Stage : uint8_t { HEADER, BANDS, CYCLES, FOOTER };
+
+  bool running;
+  bool complete;
+  double progressPercent;
+  uint16_t sampleCount;
+  char phase[32];
+  char lastError[32];
+  StepResponseTuner::Summary summary;
+  double kp;
+  double ki;
+  double kd;
+  uint8_t bandCount = 0;
+  Stage stage = HEADER;
+  uint8_t band = 0;
+
+  static void copyText(char *out, size_t size, const char *text) {
+    snprintf(out, size, "%s", text ? text : "");
+  }
+
+  void writeHeader(JsonWriter &json) {
+    json.beginObject();
+    json.fieldBool("running", running);
+    json.fieldBool("complete", complete);
+    json.fieldString("phase", phase);
+    json.fieldFixed("progressPercent", progressPercent, 1);
+    json.fieldUInt("sampleCount", sampleCount);
+    json.fieldString("lastError", lastError);
+    json.fieldString("method", "step_response");
+
+    json.beginObject("model");
+    json.fieldBool("valid", summary.valid);
+    json.fieldBool("passed", summary.passed);
+    json.fieldFixed("targetTemp", summary.targetTemp, 1);
+    json.fieldFixed("ambientTemp", summary.ambientTemp, 1);
+    json.fieldFixed("recommendedKp", summary.recommendedKp, 6);
+    json.fieldFixed("recommendedKi", summary.recommendedKi, 6);
+    json.fieldFixed("recommendedKd", summary.recommendedKd, 6);
+    json.fieldFixed("meanFitRmse", summary.meanFitRmse, 3);
+    json.fieldFixed("worstFitRmse", summary.worstFitRmse, 3);
+    json.fieldFixed("maxTemp", summary.maxTemp, 1);
+    json.fieldUInt("validBandCount", summary.validBandCount);
+    json.fieldUInt("totalSamples", summary.totalSamples);
+    json.fieldUInt("completedBands", summary.completedBands);
+    json.fieldUInt("totalBands", summary.totalBands);
+    json.fieldFixed("tauCFactor", summary.tauCFactor, 3);
+    json.fieldFixed("currentSetpoint", summary.currentSetpoint, 1);
+  }
+
+  static void writeBand(JsonWriter &json, const StepResponseTuner::BandResult &br, uint8_t i) {
+    json.beginObject();
+    json.fieldUInt("index", i + 1);
+    json.fieldBool("valid", br.valid);
+    json.fieldFixed("targetTemp", br.targetTemp, 1);
+    json.fieldFixed("minTemp", br.minTemp, 1);
+    json.fieldFixed("maxTemp", br.maxTemp, 1);
+    json.fieldUInt("sampleCount", br.sampleCount);
+    json.fieldFixed("kp", br.kp, 6);
+    json.fieldFixed("ki", br.ki, 6);
+    json.fieldFixed("kd", br.kd, 6);
+    if (br.model.valid) {
+      json.fieldFixed("processGain", br.model.processGain, 4);
+      json.fieldFixed("timeConstant", br.model.timeConstant, 1);
+      json.fieldFixed("deadTime", br.model.deadTime, 1);
+      json.fieldFixed("fitRmse", br.model.fitRmse, 3);
+      json.fieldFixed("baselineTemp", br.model.baselineTemp, 1);
+      json.fieldFixed("finalTemp", br.model.finalTemp, 1);
+    }
+    json.endObject();
+  }
+
+  // Backward-compatible cycle entry (maps bands to cycles)
+  static void writeCycle(JsonWriter &json, const StepResponseTuner::BandResult &br, uint8_t i) {
+    json.beginObject();
+    json.fieldUInt("index", i + 1);
+    json.fieldBool("valid", br.valid);
+    json.fieldBool("passed", br.valid);
+    json.fieldBool("modelValid", br.model.valid);
+    json.fieldFixed("processGain", br.model.processGain, 4);
+    json.fieldFixed("timeConstant", br.model.timeConstant, 1);
+    json.fieldFixed("deadTime", br.model.deadTime, 1);
+    json.fieldFixed("fitRmse", br.model.fitRmse, 3);
+    json.fieldUInt("sampleCount", br.sampleCount);
+    json.fieldFixed("kp", br.kp, 6);
+    json.fieldFixed("ki", br.ki, 6);
+    json.fieldFixed("kd", br.kd, 6);
+    json.endObject();
+  }
+};
+
+// GET /api/profile/:id. Takes the profile as read from flash; the piece
+// buffer grows with the name only, never with the setpoint count.
+class ProfileJsonStream : public ChunkedJsonStream {
+ public:
+  static constexpr int SETPOINTS_PER_PIECE = 8;
+
+  ProfileJsonStream(const String &id, const String &name, bool active, RoastProfile &&profile)
+      : ChunkedJsonStream(pieceCapacityFor(id, name)),
+        id(id), name(name), active(active), profile(std::move(profile)) {}
+
+ protected:
+  bool writeNext(JsonWriter &json) override {
+    if (!started) {
+      started = true;
+      json.beginObject();
+      json.fieldString("id", id.c_str());
+      json.fieldString("name", name.c_str());
+      json.fieldBool("active", active);
+      json.fieldString("interpolation",
+                       profile.getInterpolationMode() == RoastProfile::INTERPOLATION_PCHIP ? "pchip" : "linear");
+      json.beginArray("setpoints");
+      return true;
+    }
+    int count = profile.getSetpointCount();
+    for (int written = 0; written < SETPOINTS_PER_PIECE && next < count; next++) {
+      auto sp = profile.getSetpoint(next);
+      if (sp.time == 0 && sp.temp == 0 && sp.fanSpeed == 0) continue;
+      json.beginObject();
+      // Whole seconds print as integers, anything else to the millisecond
+      json.fieldFixed("time", sp.time / 1000.0, 3);
+      json.fieldUInt("temp", sp.temp);
+      json.fieldUInt("fanSpeed", sp.fanSpeed);
+      json.endObject();
+      written++;
+    }
+    if (next < count) return true;
+    json.endArray();
+    json.endObject();
+    return false;
+  }
+
+ private:
+  String id;
+  String name;
+  bool active;
+  RoastProfile profile;
+  int next = 0;
+  bool started = false;
+
+  // Every byte of the id and name may need a six-byte \u escape
+  static size_t pieceCapacityFor(const String &id, const String &name) {
+    size_t header = 128 + 6 * (id.length() + name.length());
+    return header > CHUNKED_JSON_PIECE_CAPACITY ? header : CHUNKED_JSON_PIECE_CAPACITY;
+  }
+};
+
+#endif // CHUNKED_JSON_HPP
@@ -12,13 +12,26 @@
 #include <ElegantOTA.h>  // v3.1.7+ with async mode enabled for ESPAsyncWebServer compatibility
 #include "../support/DebugLog.hpp"
 #include "../display/DisplayAdapter.hpp"
+#include "../platform/ControlTask.hpp"
+#include "../support/PerfStats.hpp"
+#include "../support/SharedFrameBuffer.hpp"
+#include "../support/LogCursors.hpp"
+#include "../sensors/ThermocoupleAcquisition.hpp"
 #include "../control/PIDController.hpp"
 #include "../control/StepResponseTuner.hpp"
 #include "../control/PIDRuntimeController.hpp"
+#include "../platform/PreferencesJournal.hpp"
 #include "../control/PIDValidation.hpp"
 #include "../profiles/ProfileManager.hpp"    // Profile backend logic
-#include "ProfileWebUI.hpp"     // Profile UI HTML/CSS/JS
-#include "../integrations/SystemLinkWebUI.hpp"
+#include "../profiles/ProfileArchive.hpp"    // Bulk tar import/export
+#include "../profiles/RoastArchive.hpp"      // Completed roasts on flash
+#include "SystemStateJson.hpp"
+#include "ChunkedJson.hpp"       // Streamed trace, calibration status and profile responses
+#include "TelemetryStream.hpp"
+#include "ArtisanStream.hpp"
+#include "WsClientQueues.hpp"
+#include "WebAssetData.hpp"     // Gzipped web UIs from web/ (tools/embed-web-assets.py)
+#include <memory>
 #include <vector>
 
 // Removed global JsonDocument to prevent heap fragmentation
@@ -215,8 +228,8 @@ void ensureWifiEventLogging() {
     case ARDUINO_EVENT_WIFI_STA_GOT_IP:
       LOG_INFOF("WiFi event: STA got IP %s", WiFi.localIP().toString().c_str());
       networkAddressRefreshRequested = true;
-      preferences.putString("ssid", wifiCredentials.ssid);
-      preferences.putString("password", wifiCredentials.password);
+      preferencesJournal.putString("ssid", wifiCredentials.ssid);
+      preferencesJournal.putString("password", wifiCredentials.password);
       break;
     case ARDUINO_EVENT_WIFI_SCAN_DONE:
       LOG_INFOF(
@@ -238,6 +251,7 @@ extern double currentTemp;
 extern double setpointTemp;
 extern byte setpointFanSpeed;
 extern double fanTemp;
+extern double rateOfRise;
 extern double heaterOutputVal;
 extern double heaterPidTrimVal;
 extern double heaterFeedforwardVal;
@@ -249,28 +263,43 @@ extern double kp;
 extern double ki;
 extern double kd;
 extern RoasterState roasterState;  // Defined in RoasterTypes.hpp
+extern HeaterControlMode heaterControlMode;
 extern WifiCredentials wifiCredentials;
 extern RoastProfile profile;  // Profile configuration
 extern ProfileManager profileManager;
+extern RoastArchive roastArchive;
 extern Preferences preferences; // NVS preferences from main firmware
-extern uint8_t profileBuffer[200];
+extern PreferencesJournal preferencesJournal;
 extern StepResponseTuner stepTuner;
 extern PIDRuntimeController pidRuntimeController;
 extern PIDValidationSession pidValidation;
-extern PIDController heaterPID;
+extern HeaterPIDController heaterPID;
 extern bool restartRequested;
 extern unsigned long restartAt;
+extern ControlTask controlTask;
+extern PerfChannel perfControl;
+extern PerfChannel perfTick;
+extern PerfChannel perfStateMachine;
+extern PerfChannel perfWsBroadcast;
+extern PerfChannel perfRoastTrace;
+extern PerfChannel perfLoop;
+extern volatile bool perfResetRequested;
+extern ThermocoupleAcquisition thermocoupleAcquisition;
 
 // Helper to refresh the active profile view after profile changes
 void plotProfileOnWaveform();
 bool startValidationRoast(double finalTargetTemp, uint32_t fanPercent);
 void setManualPIDGains(double newKp, double newKi, double newKd);
+uint16_t getRateOfRiseWindowSeconds();
+uint16_t setRateOfRiseWindowSeconds(int seconds, bool persist);
 
 void refreshActiveProfileDisplay() {
     String activeId = profileManager.getActiveProfileId();
   LOG_INFOF("refreshActiveProfileDisplay: Updating for ID %s", activeId.c_str());
     String activeName;
-    if (activeId.length() > 0) profileManager.loadProfileMeta(activeId, activeName);
+    int finalTarget = -1;
+    bool active = false;
+    if (activeId.length() > 0) profileManager.getProfileSummary(activeId, activeName, finalTarget, active);
     
   displayShowScreen(DisplayScreen::ProfileActive);
     delay(100);
@@ -281,7 +310,11 @@ void refreshActiveProfileDisplay() {
     }
     
     // Update the active profile view with the current final target value.
-    uint32_t finalTemp = profile.getFinalTargetTemp();
+    uint32_t finalTemp;
+    {
+        ControlLock controlLock;
+        finalTemp = profile.getFinalTargetTemp();
+    }
   displaySetStoredProfileFinalTarget(static_cast<int>(finalTemp));
   displaySetFinalTargetTemp(finalTemp);
 
@@ -404,7 +437,83 @@ void onOTAEnd(bool success) {
 //   ElegantOTA.loop();
 // }
 
-void handleWebSocketMessage(void *arg, uint8_t *data, size_t len) {
+// Clients that asked for the delta telemetry stream (TelemetryStream.hpp)
+TelemetrySubscribers telemetrySubscribers;
+// What each client has waiting to go out (WsClientQueues.hpp)
+WsClientQueues wsClientQueues;
+
+void handleTelemetryCommand(AsyncWebSocketClient *client, const char *mode, const char *encodingName) {
+  char reply[768];
+  TelemetryEncoding encoding = TELEMETRY_JSON;
+  bool delta = strcmp(mode, "full") != 0;
+  if (delta && (strcmp(mode, "delta") != 0 || !parseTelemetryEncoding(encodingName, encoding))) {
+    client->text("{\"telemetry\":{\"error\":\"unsupported_mode\"}}");
+    return;
+  }
+  if (!delta) {
+    telemetrySubscribers.unsubscribe(client->id());
+  } else if (!telemetrySubscribers.subscribe(client->id(), encoding)) {
+    client->text("{\"telemetry\":{\"error\":\"too_many_subscribers\"}}");
+    return;
+  }
+  if (writeTelemetryAck(delta, encoding, reply, sizeof(reply)) > 0) {
+    client->text(reply);
+  }
+  LOG_INFOF("WebSocket client #%u telemetry: %s %s", client->id(), delta ? "delta" : "full",
+            delta ? telemetryEncodingName(encoding) : "json");
+}
+
+// Clients that asked Artisan data to be pushed (ArtisanStream.hpp)
+ArtisanPushSubscribers artisanPushSubscribers;
+SharedFrameBuffer artisanPushFrame(ARTISAN_JSON_CAPACITY);
+
+ArtisanReading captureArtisanReading() {
+  ArtisanReading reading;
+  reading.bt = currentTemp;
+  reading.st = setpointTemp;
+  reading.fs = setpointFanSpeed * 100 / 255;
+  reading.ft = fanTemp;
+  reading.ror = rateOfRise;
+  return reading;
+}
+
+void handleArtisanPushCommand(AsyncWebSocketClient *client, long requestedInterval) {
+  char reply[64];
+  uint32_t interval = ArtisanPushSubscribers::clampInterval(requestedInterval);
+  if (interval == 0) {
+    artisanPushSubscribers.unsubscribe(client->id());
+  } else if (!artisanPushSubscribers.subscribe(client->id(), interval, millis())) {
+    client->text("{\"push\":{\"error\":\"too_many_subscribers\"}}");
+    return;
+  }
+  snprintf(reply, sizeof(reply), "{\"push\":{\"interval\":%lu}}", static_cast<unsigned long>(interval));
+  client->text(reply);
+  LOG_INFOF("WebSocket client #%u Artisan push: %lu ms", client->id(), static_cast<unsigned long>(interval));
+}
+
+// Sends the push subscribers whose interval is up one shared frame
+void broadcastArtisanPush() {
+  uint32_t due[ArtisanPushSubscribers::MAX_SUBSCRIBERS];
+  size_t dueCount = artisanPushSubscribers.takeDue(millis(), due);
+  if (dueCount == 0) {
+    return;
+  }
+  SharedFrameBuffer::Frame frame = artisanPushFrame.acquire();
+  size_t length = writeArtisanPush(captureArtisanReading(), millis(), reinterpret_cast<char *>(frame->data()), frame->size());
+  if (length == 0) {
+    return;
+  }
+  frame->resize(length);
+  for (size_t i = 0; i < dueCount; i++) {
+    AsyncWebSocketClient *client = ws.client(due[i]);
+    if (client == nullptr || client->status() != WS_CONNECTED) {
+      continue;
+    }
+    wsClientQueues.offerLatest(due[i], WS_FRAME_ARTISAN, frame);
+  }
+}
+
+void handleWebSocketMessage(AsyncWebSocketClient *client, void *arg, uint8_t *data, size_t len) {
   AwsFrameInfo *info = (AwsFrameInfo *)arg;
   if (info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT) {
     // Allocate buffer with space for null terminator (prevent buffer overflow)
@@ -438,17 +547,29 @@ void handleWebSocketMessage(void *arg, uint8_t *data, size_t len) {
     // Whitelist of valid commands
     const char* command = wsRequestDoc["command"];
     if (strcmp(command, "getData") == 0) {
-      // Local allocation for response as well
-      StaticJsonDocument<1024> wsResponseDoc;
-      wsResponseDoc["id"] = wsRequestDoc["id"];
-      JsonObject temp_data = wsResponseDoc["data"].to<JsonObject>();
-      temp_data["bt"] = currentTemp;
-      temp_data["st"] = setpointTemp;
-      temp_data["fs"] = setpointFanSpeed * 100 / 255;
-      temp_data["ft"] = fanTemp;
-      String jsonResponse;
-      serializeJson(wsResponseDoc, jsonResponse);
-      ws.textAll(jsonResponse);
+      // Answer the client that asked; the others poll for themselves
+      ArtisanRequestId id;
+      JsonVariantConst requestId = wsRequestDoc["id"];
+      if (requestId.is<long>()) {
+        id.present = true;
+        id.number = requestId.as<long>();
+      } else if (requestId.is<const char*>()) {
+        id.present = true;
+        id.text = requestId.as<const char*>();
+      }
+      char reply[ARTISAN_JSON_CAPACITY];
+      size_t length = writeArtisanReply(captureArtisanReading(), id, reply, sizeof(reply));
+      if (length > 0) {
+        client->text(reply, length);
+      } else {
+        DEBUG_PRINTLN("WebSocket: getData id too long to echo");
+      }
+    } else if (strcmp(command, "push") == 0) {
+      handleArtisanPushCommand(client, wsRequestDoc["interval"] | 1000L);
+    } else if (strcmp(command, "telemetry") == 0) {
+      handleTelemetryCommand(client, wsRequestDoc["mode"] | "delta", wsRequestDoc["encoding"] | "json");
+    } else if (strcmp(command, "keyframe") == 0) {
+      telemetrySubscribers.requestKeyframe(client->id());
     } else {
       // Unknown command - log and ignore
       DEBUG_PRINTF("WebSocket: Unknown command '%s' - ignoring\n", command);
@@ -461,12 +582,19 @@ void onEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType
   switch (type) {
     case WS_EVT_CONNECT:
       DEBUG_PRINTF("WebSocket client #%u connected from %s\n", client->id(), client->remoteIP().toString().c_str());
+      if (!wsClientQueues.add(client->id())) {
+        LOG_WARNF("WebSocket client #%u refused: %u clients connected", client->id(), (unsigned)WsClientQueues::MAX_CLIENTS);
+        client->close();
+      }
       break;
     case WS_EVT_DISCONNECT:
       DEBUG_PRINTF("WebSocket client #%u disconnected\n", client->id());
+      telemetrySubscribers.unsubscribe(client->id());
+      artisanPushSubscribers.unsubscribe(client->id());
+      wsClientQueues.remove(client->id());
       break;
     case WS_EVT_DATA:
-      handleWebSocketMessage(arg, data, len);
+      handleWebSocketMessage(client, arg, data, len);
       break;
     case WS_EVT_PONG:
     case WS_EVT_PING:
@@ -489,51 +617,154 @@ const char* getStateName(byte state) {
   }
 }
 
-// Serialize system state to JSON
-String getSystemStateJSON() {
-  DynamicJsonDocument doc(1408);
-  
-  doc["timestamp"] = millis();
-  doc["state"] = getStateName(roasterState);
+PerfChannel *const perfChannels[] = {
+  &perfControl, &perfTick, &perfStateMachine, &perfWsBroadcast, &perfRoastTrace, &perfLoop
+};
+constexpr size_t PERF_CHANNEL_COUNT = sizeof(perfChannels) / sizeof(perfChannels[0]);
+
+// One state frame shared by every client, reused from one broadcast to the next
+SharedFrameBuffer stateFrame(STATE_JSON_CAPACITY);
+
+// A second of logging fits; a new client's backlog arrives over a few broadcasts
+constexpr size_t LOG_FRAME_CAPACITY = 2048;
+SharedFrameBuffer logFrame(LOG_FRAME_CAPACITY);
+// Per request; "more" tells a poller to come back for the rest
+constexpr size_t LOG_HTTP_CAPACITY = 8192;
+LogCursors logCursors;
+
+void appendHistogramJSON(JsonObject out, const LatencyHistogram &histogram, bool includeBuckets) {
+  out["n"] = histogram.getSamples();
+  out["p50"] = histogram.percentileUs(50);
+  out["p99"] = histogram.percentileUs(99);
+  out["max"] = histogram.getMaxUs();
+  out["overruns"] = histogram.getOverruns();
+  if (includeBuckets) {
+    JsonArray buckets = out.createNestedArray("buckets");
+    for (uint8_t bucket = 0; bucket < LatencyHistogram::BUCKET_COUNT; bucket++) {
+      buckets.add(histogram.getBucketCount(bucket));
+    }
+  }
+}
+
+// Full timer histograms for /api/perf. All values are microseconds.
+String getPerfJSON(bool includeBuckets) {
+  DynamicJsonDocument doc(includeBuckets ? 8192 : 3072);
+
   doc["uptime"] = millis() / 1000;
-  
-  JsonObject temps = doc.createNestedObject("temps");
-  temps["current"] = round(currentTemp * 10) / 10.0;
-  temps["setpoint"] = round(setpointTemp * 10) / 10.0;
-  temps["fan"] = round(fanTemp * 10) / 10.0;
-  
-  JsonObject control = doc.createNestedObject("control");
-  control["heater"] = (int)heaterOutputVal;
-  control["pidTrim"] = round(heaterPidTrimVal * 10) / 10.0;
-  control["feedforward"] = round(heaterFeedforwardVal * 10) / 10.0;
-  control["pwmFan"] = (int)setpointFanSpeed;
-  control["bdcFan"] = bdcFanMs;
-  control["scheduleEnabled"] = pidRuntimeController.isEnabled();
-  control["activeBand"] = pidRuntimeController.getActiveBandIndex();
-  
-  JsonObject profileObj = doc.createNestedObject("profile");
-  profileObj["progress"] = setpointProgress;
-  profileObj["setpointCount"] = profile.getSetpointCount();
-  profileObj["finalTemp"] = (int)profile.getFinalTargetTemp();
-  
-  JsonObject safety = doc.createNestedObject("safety");
-  safety["badReadings"] = badReadingCount;
-  safety["lastRejectedReason"] = lastRejectedBeanReadReason;
-
-  JsonObject fault = doc.createNestedObject("fault");
-  fault["code"] = activeFaultCode;
-  fault["message"] = activeFaultMessage;
-  fault["canClear"] = canClearErrorState();
-  
-  JsonObject memory = doc.createNestedObject("memory");
-  memory["heapFree"] = ESP.getFreeHeap();
-  memory["heapSize"] = ESP.getHeapSize();
-  
+  if (includeBuckets) {
+    // Upper bound of each bucket; the last one is open-ended.
+    JsonArray bounds = doc.createNestedArray("bucketBoundsUs");
+    for (uint8_t bucket = 0; bucket + 1 < LatencyHistogram::BUCKET_COUNT; bucket++) {
+      bounds.add(LatencyHistogram::bucketUpperBoundUs(bucket));
+    }
+  }
+
+  PeriodicSchedule::Stats taskStats = controlTask.getStats();
+  JsonObject task = doc.createNestedObject("controlTask");
+  task["threaded"] = controlTask.isThreaded();
+  task["periodMs"] = controlTask.getPeriodMs();
+  task["cycles"] = taskStats.cycles;
+  task["skippedReleases"] = taskStats.skippedReleases;
+  task["overruns"] = taskStats.overruns;
+  task["maxLatenessUs"] = taskStats.maxLatenessUs;
+  task["maxExecutionUs"] = taskStats.maxExecutionUs;
+
+  ThermocoupleAcquisition::Stats acquisitionStats = thermocoupleAcquisition.getStats();
+  JsonObject acquisition = doc.createNestedObject("thermocouples");
+  acquisition["samples"] = acquisitionStats.samples;
+  acquisition["transportErrors"] = acquisitionStats.transportErrors;
+  acquisition["skippedReads"] = acquisitionStats.skippedReads;
+  acquisition["queueOverflows"] = thermocoupleAcquisition.getOverflows();
+
+  PreferencesJournal::Stats journalStats = preferencesJournal.getStats();
+  JsonObject journal = doc.createNestedObject("preferences");
+  journal["writes"] = journalStats.writes;
+  journal["flashWrites"] = journalStats.flashWrites;
+  journal["writesAvoided"] = journalStats.coalesced + journalStats.unchanged;
+  journal["coalesced"] = journalStats.coalesced;
+  journal["unchanged"] = journalStats.unchanged;
+  journal["failed"] = journalStats.failedFlashWrites;
+  journal["flushes"] = journalStats.flushes;
+  journal["forcedFlushes"] = journalStats.forcedFlushes;
+  journal["pending"] = preferencesJournal.pendingCount();
+
+  doc["stateFrameReplacements"] = stateFrame.replacementCount();
+  doc["logFrameReplacements"] = logFrame.replacementCount();
+
+  WsClientQueues::ClientStats clientStats[WsClientQueues::MAX_CLIENTS];
+  size_t clientCount = wsClientQueues.snapshot(clientStats);
+  JsonArray wsClients = doc.createNestedArray("wsClients");
+  for (size_t index = 0; index < clientCount; index++) {
+    JsonObject entry = wsClients.createNestedObject();
+    AsyncWebSocketClient *client = ws.client(clientStats[index].clientId);
+    entry["id"] = clientStats[index].clientId;
+    entry["inFlight"] = client != nullptr ? client->queueLen() : 0;
+    entry["pending"] = clientStats[index].pending;
+    entry["maxPending"] = clientStats[index].maxPending;
+    entry["sent"] = clientStats[index].sent;
+    entry["dropped"] = clientStats[index].dropped;
+    entry["events"] = clientStats[index].events;
+  }
+
+  JsonObject timers = doc.createNestedObject("timers");
+  for (size_t index = 0; index < PERF_CHANNEL_COUNT; index++) {
+    const PerfChannel &channel = *perfChannels[index];
+    JsonObject timer = timers.createNestedObject(channel.getName());
+    timer["periodUs"] = channel.getPeriodUs();
+    appendHistogramJSON(timer.createNestedObject("lateness"), channel.getLateness(), includeBuckets);
+    appendHistogramJSON(timer.createNestedObject("runtime"), channel.getRuntime(), includeBuckets);
+  }
+
   String output;
   serializeJson(doc, output);
   return output;
 }
 
+// Copies the live values the state payload reports
+SystemStateSnapshot captureSystemState() {
+  SystemStateSnapshot state;
+  state.timestamp = millis();
+  state.state = getStateName(roasterState);
+
+  state.currentTemp = currentTemp;
+  state.setpointTemp = setpointTemp;
+  state.fanTemp = fanTemp;
+  state.rateOfRise = rateOfRise;
+
+  state.heater = (int)heaterOutputVal;
+  state.pidTrim = heaterPidTrimVal;
+  state.feedforward = heaterFeedforwardVal;
+  state.pwmFan = (int)setpointFanSpeed;
+  state.bdcFan = bdcFanMs;
+  state.scheduleEnabled = pidRuntimeController.isEnabled();
+  state.activeBand = pidRuntimeController.getActiveBandIndex();
+  state.heaterMode = getHeaterControlModeName(heaterControlMode);
+  state.mpcActive = isPredictiveHeaterControlActive();
+  state.smithActive = isSmithPredictorActive();
+
+  state.progress = setpointProgress;
+  {
+    // The profile is swapped and reallocated by web handlers under this lock
+    ControlLock controlLock;
+    state.setpointCount = profile.getSetpointCount();
+    state.finalTemp = (int)profile.getFinalTargetTemp();
+  }
+
+  state.badReadings = badReadingCount;
+  state.lastRejectedReason = lastRejectedBeanReadReason;
+
+  state.faultCode = activeFaultCode;
+  state.faultMessage = activeFaultMessage;
+  state.faultCanClear = canClearErrorState();
+
+  state.heapFree = ESP.getFreeHeap();
+  state.heapSize = ESP.getHeapSize();
+
+  state.perfChannels = perfChannels;
+  state.perfChannelCount = PERF_CHANNEL_COUNT;
+  return state;
+}
+
 // Simple sanitization for legacy name-based storage
 String sanitizeProfileName(const String& name) {
   String sanitized;
@@ -560,16 +791,174 @@ bool loadProfileByName(const String& name) {
   return false;
 }
 
+// Telemetry frame buffers by [keyframe][encoding], made on first use
+std::unique_ptr<SharedFrameBuffer> telemetryBuffers[2][TELEMETRY_ENCODING_COUNT];
+TelemetryDeltaTracker telemetryDelta;
+uint32_t telemetrySeq = 0;
+
+static bool isTelemetrySubscriber(uint32_t clientId, const TelemetrySubscribers::Subscriber *subscribers, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    if (subscribers[i].clientId == clientId) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Sends each subscriber a keyframe or the delta since the last broadcast.
+// Every frame is encoded at most once per encoding and shared between the
+// clients that use it.
+void broadcastTelemetry(const SystemStateSnapshot &state, const TelemetrySubscribers::Subscriber *subscribers, size_t count) {
+  TelemetryFrame frame;
+  captureTelemetryFrame(state, frame);
+  frame.seq = ++telemetrySeq;
+  uint32_t changed = telemetryDelta.update(frame);
+  bool keyframeDue = frame.seq % TELEMETRY_KEYFRAME_INTERVAL == 0;
+
+  SharedFrameBuffer::Frame encoded[2][TELEMETRY_ENCODING_COUNT];
+  for (size_t i = 0; i < count; i++) {
+    const TelemetrySubscribers::Subscriber &subscriber = subscribers[i];
+    AsyncWebSocketClient *client = ws.client(subscriber.clientId);
+    if (client == nullptr || client->status() != WS_CONNECTED) {
+      continue;
+    }
+    bool keyframe = keyframeDue || subscriber.needsKeyframe;
+    SharedFrameBuffer::Frame &payload = encoded[keyframe][subscriber.encoding];
+    if (!payload) {
+      std::unique_ptr<SharedFrameBuffer> &buffer = telemetryBuffers[keyframe][subscriber.encoding];
+      if (!buffer) {
+        buffer.reset(new SharedFrameBuffer(subscriber.encoding == TELEMETRY_JSON ? TELEMETRY_JSON_CAPACITY : TELEMETRY_BINARY_CAPACITY));
+      }
+      payload = buffer->acquire();
+      size_t length = encodeTelemetryFrame(frame, changed, keyframe, subscriber.encoding, payload->data(), payload->size());
+      if (length == 0) {
+        LOG_WARN("Telemetry frame skipped: payload exceeds its buffer");
+        payload.reset();
+        continue;
+      }
+      payload->resize(length);
+    }
+    // A delta replaced before it went out leaves the client behind
+    bool replaced = wsClientQueues.offerLatest(subscriber.clientId, WS_FRAME_TELEMETRY, payload,
+                                               subscriber.encoding != TELEMETRY_JSON);
+    if (replaced && !keyframe) {
+      telemetrySubscribers.requestKeyframe(subscriber.clientId);
+    }
+  }
+}
+
+// Runs `visit` for every connected client. The ids come from wsClientQueues,
+// where each client is registered on connect, and each is looked up with
+// ws.client(), which takes AsyncWebSocket's lock; ws.getClients() hands out
+// the library's list unlocked while the async_tcp task adds to it.
+template <typename Visit>
+void forEachConnectedClient(Visit visit) {
+  uint32_t ids[WsClientQueues::MAX_CLIENTS];
+  size_t idCount = wsClientQueues.clientIds(ids);
+  for (size_t i = 0; i < idCount; i++) {
+    AsyncWebSocketClient *client = ws.client(ids[i]);
+    if (client != nullptr && client->status() == WS_CONNECTED) {
+      visit(*client);
+    }
+  }
+}
+
 // Broadcast system state to all WebSocket clients
 void broadcastSystemState() {
-  String stateJson = getSystemStateJSON();
-  ws.textAll(stateJson);
+  if (ws.count() == 0) {
+    return;
+  }
+  SystemStateSnapshot state = captureSystemState();
+  TelemetrySubscribers::Subscriber subscribers[TelemetrySubscribers::MAX_SUBSCRIBERS];
+  size_t subscriberCount = telemetrySubscribers.take(subscribers);
+
+  if (subscriberCount < ws.count()) {
+    SharedFrameBuffer::Frame frame = stateFrame.acquire();
+    size_t length = writeSystemStateJson(state, reinterpret_cast<char *>(frame->data()), frame->size());
+    if (length == 0) {
+      LOG_WARN("State broadcast skipped: payload exceeds STATE_JSON_CAPACITY");
+    } else {
+      frame->resize(length);
+      forEachConnectedClient([&](AsyncWebSocketClient &client) {
+        if (!isTelemetrySubscriber(client.id(), subscribers, subscriberCount)) {
+          wsClientQueues.offerLatest(client.id(), WS_FRAME_STATE, frame);
+        }
+      });
+    }
+  }
+
+  if (subscriberCount > 0) {
+    broadcastTelemetry(state, subscribers, subscriberCount);
+  }
+}
+
+// Sends each client the log entries it has not seen yet, starting with the
+// last `backlog` entries for a new client. Clients that are caught up get
+// nothing, and clients at the same cursor share one frame.
+void broadcastLogs(int backlog = 10) {
+  uint32_t latestSeq = debugLogger.getLatestSeq();
+  SharedFrameBuffer::Frame frame;
+  uint32_t frameSince = 0;
+  uint32_t frameCursor = 0;
+
+  forEachConnectedClient([&](AsyncWebSocketClient &client) {
+    uint32_t *cursor = logCursors.cursorFor(client.id());
+    if (cursor == nullptr || *cursor >= latestSeq) {
+      return;
+    }
+    if (wsClientQueues.hasPending(client.id(), WS_FRAME_LOGS)) {
+      return;  // Its cursor moves on once the waiting frame is out
+    }
+    if (!frame || frameSince != *cursor) {
+      frame = logFrame.acquire();
+      size_t length = debugLogger.writeLogsJSON(reinterpret_cast<char *>(frame->data()), frame->size(), *cursor, backlog, &frameCursor);
+      frame->resize(length);
+      frameSince = *cursor;
+    }
+    if (frame->empty()) {
+      return;
+    }
+    wsClientQueues.offerLatest(client.id(), WS_FRAME_LOGS, frame);
+    *cursor = frameCursor;
+  });
+  logCursors.prune();
+}
+
+// Hands each client what it has waiting, while its AsyncWebSocket queue is
+// shorter than WS_MAX_IN_FLIGHT, and drops the queues of clients that are
+// gone. Runs every loop() pass.
+void pumpWebSocketQueues() {
+  wsClientQueues.prune([](uint32_t clientId) {
+    AsyncWebSocketClient *client = ws.client(clientId);
+    return client != nullptr && client->status() == WS_CONNECTED;
+  });
+  forEachConnectedClient([](AsyncWebSocketClient &client) {
+    WsClientQueues::Message message;
+    while (client.queueLen() < WS_MAX_IN_FLIGHT && wsClientQueues.pop(client.id(), message)) {
+      if (message.binary) {
+        client.binary(message.frame);
+      } else {
+        client.text(message.frame);
+      }
+    }
+  });
 }
 
-// Broadcast logs to all WebSocket clients
-void broadcastLogs(int maxEntries = 10) {
-  String logsJson = debugLogger.getLogsJSON(maxEntries, true);  // Wrap in {logs: [...]}
-  ws.textAll(logsJson);
+// Serves a page from flash as gzip, or 304 Not Modified when the browser's
+// cached copy carries the same ETag. no-cache makes the browser revalidate
+// on every load, so a firmware update shows up immediately.
+void sendWebAsset(AsyncWebServerRequest *request, const WebAsset &asset) {
+  AsyncWebServerResponse *response;
+  if (request->hasHeader("If-None-Match") &&
+      webAssetETagMatches(request->header("If-None-Match").c_str(), asset.etag)) {
+    response = request->beginResponse(304);
+  } else {
+    response = request->beginResponse(200, asset.contentType, asset.data, asset.length);
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
 }
 
 void initWebSocket() {
@@ -747,19 +1136,113 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
   // API endpoint: System state
   server.on("/api/state", HTTP_GET, [](AsyncWebServerRequest *request) {
     LOG_DEBUG("API: /api/state requested");
-    String json = getSystemStateJSON();
+    char json[STATE_JSON_CAPACITY];
+    if (writeSystemStateJson(captureSystemState(), json, sizeof(json)) == 0) {
+      request->send(500, "application/json", "{\"error\":\"state_too_large\"}");
+      return;
+    }
     request->send(200, "application/json", json);
   });
 
+  // API endpoint: Timer latency histograms (?buckets=1 adds bucket counts)
+  server.on("/api/perf", HTTP_GET, [](AsyncWebServerRequest *request) {
+    bool includeBuckets = request->hasParam("buckets") && request->getParam("buckets")->value() != "0";
+    request->send(200, "application/json", getPerfJSON(includeBuckets));
+  });
+
+  // Clears the histograms on the next loop() pass
+  server.on("/api/perf/reset", HTTP_POST, [](AsyncWebServerRequest *request) {
+    perfResetRequested = true;
+    LOG_INFO("Perf histograms reset requested");
+    request->send(200, "application/json", "{\"ok\":true}");
+  });
+
   // =============================================================================
   // PROFILE API - ID-based RESTful CRUD Operations
   // =============================================================================
 
+  // The bulk routes go first: "/api/profiles" below also matches its subpaths.
+
+  // GET /api/profiles/export - every profile as a tar of JSON files, rendered
+  // one profile at a time as the client reads
+  server.on("/api/profiles/export", HTTP_GET, [](AsyncWebServerRequest *request) {
+    LOG_DEBUG("GET /api/profiles/export");
+    std::shared_ptr<ProfileArchiveExporter> exporter = std::make_shared<ProfileArchiveExporter>(profileManager);
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/x-tar",
+      [exporter](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        size_t written = exporter->read(buffer, maxLen);
+        if (written == 0) {
+          LOG_INFOF("Profile export finished: %d profiles", (int)exporter->exportedCount());
+        }
+        return written;
+      });
+    response->addHeader("Content-Disposition", "attachment; filename=\"roast-profiles.tar\"");
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+  });
+
+  // POST /api/profiles/import - tar of profile JSON files, e.g.
+  //   tar cf - roast-profiles/*.json | curl -H 'Content-Type: application/x-tar' --data-binary @- .../api/profiles/import
+  // Saved file by file as the upload arrives, so only one is held in RAM.
+  server.on("/api/profiles/import", HTTP_POST,
+    [](AsyncWebServerRequest *request) {
+      if (request->contentLength() == 0) {
+        request->send(400, "application/json", "{\"ok\":false,\"error\":\"empty_archive\"}");
+      }
+    },
+    nullptr,
+    [](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+      if (index == 0) {
+        request->_tempObject = new ProfileArchiveImporter(profileManager);
+        // The server free()s a leftover _tempObject; an aborted upload has to
+        // run the importer's destructor instead.
+        request->onDisconnect([request]() {
+          delete (ProfileArchiveImporter*)request->_tempObject;
+          request->_tempObject = nullptr;
+        });
+      }
+
+      ProfileArchiveImporter* importer = (ProfileArchiveImporter*)request->_tempObject;
+      if (!importer) {
+        LOG_ERROR("POST /api/profiles/import: importer allocation failed");
+        request->send(500, "application/json", "{\"error\":\"internal_error\"}");
+        return;
+      }
+
+      importer->feed(data, len);
+      if (index + len < total) {
+        esp_task_wdt_reset(); // Pet watchdog during large uploads
+        yield();
+        return;
+      }
+
+      LOG_INFOF("Profile import: %d added, %d updated, %d failed", importer->importedCount(),
+                importer->updatedCount(), importer->failedCount());
+      String out = importer->resultJson();
+      int status = importer->succeeded() ? 200 : 400;
+      delete importer;
+      request->_tempObject = nullptr;
+      request->send(status, "application/json", out);
+    }
+  );
+
   // GET /api/profiles - list summaries
   server.on("/api/profiles", HTTP_GET, [](AsyncWebServerRequest *request) {
     LOG_DEBUG("GET /api/profiles");
+    // The profile index generation changes on every save, delete and
+    // activate, so it serves as the ETag and unchanged lists cost a 304.
+    String etag = "\"" + String(profileManager.getIndexGeneration(), HEX) + "\"";
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+      AsyncWebServerResponse *response = request->beginResponse(304);
+      response->addHeader("ETag", etag);
+      request->send(response);
+      return;
+    }
     String result = profileManager.getProfilesList();
-    request->send(200, "application/json", result);
+    AsyncWebServerResponse *response = request->beginResponse(200, "application/json", result);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
   });
 
   // POST /api/profiles - create
@@ -788,7 +1271,7 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
       }
 
       // Guard against oversized payloads that can destabilize heap
-      if (body->length() > 4096) {
+      if (body->length() > ProfileManager::MAX_PROFILE_JSON_BYTES) {
         LOG_WARNF("POST /api/profiles: payload too large (%d)", (int)body->length());
         delete body;
         request->send(413, "application/json", "{\"error\":\"payload_too_large\"}");
@@ -825,18 +1308,21 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
     }
     LOG_DEBUGF("GET /api/profile/%s", id.c_str());
     
-    String result = profileManager.getProfile(id);
-    DynamicJsonDocument doc(2048);
-    DeserializationError err = deserializeJson(doc, result);
-    
-    if (err) {
-        request->send(500, "application/json", "{\"error\":\"json_error\"}");
-    } else if (doc.containsKey("error")) {
-        String error = doc["error"].as<String>();
-        request->send((error == "not_found") ? 404 : 400, "application/json", result);
-    } else {
-        request->send(200, "application/json", result);
+    RoastProfile profile;
+    if (!profileManager.readProfile(id, profile)) {
+      request->send(404, "application/json", "{\"error\":\"not_found\"}");
+      return;
     }
+    String name;
+    profileManager.loadProfileMeta(id, name);
+    bool active = (id == profileManager.getActiveProfileId());
+
+    std::shared_ptr<ProfileJsonStream> stream = std::make_shared<ProfileJsonStream>(id, name, active, std::move(profile));
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+      [stream](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        return stream->read(buffer, maxLen);
+      });
+    request->send(response);
   });
 
   // POST /api/profile/:id/activate
@@ -892,7 +1378,7 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
       for (size_t i = 0; i < len; i++) *body += (char)data[i];
       if (index + len < total) { yield(); return; }
 
-      if (body->length() > 4096) {
+      if (body->length() > ProfileManager::MAX_PROFILE_JSON_BYTES) {
         LOG_WARNF("PUT /api/profile/%s: payload too large (%d)", id.c_str(), (int)body->length());
         delete body;
         request->_tempObject = nullptr;
@@ -902,7 +1388,7 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
 
       LOG_DEBUGF("PUT /api/profile/%s: updating profile", id.c_str());
       
-      DynamicJsonDocument doc(4096);
+      DynamicJsonDocument doc(ProfileManager::profileJsonCapacity(RoastProfile::MAX_SETPOINTS));
       DeserializationError err = deserializeJson(doc, *body);
       if (err) {
           delete body;
@@ -955,20 +1441,96 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
     }
   });
 
+  // =============================================================================
+  // ROAST ARCHIVE
+  // =============================================================================
+
+  // GET /api/roasts/:id.csv or /api/roasts/:id.json - one archived roast,
+  // streamed from flash a row at a time
+  server.on("/api/roasts/*", HTTP_GET, [](AsyncWebServerRequest *request) {
+    String name = request->url().substring(String("/api/roasts/").length());
+    char *end = nullptr;
+    uint32_t id = static_cast<uint32_t>(strtoul(name.c_str(), &end, 10));
+    RoastArchiveExporter::Format format;
+    if (strcmp(end, ".csv") == 0) {
+      format = RoastArchiveExporter::FORMAT_CSV;
+    } else if (strcmp(end, ".json") == 0 || *end == '\0') {
+      format = RoastArchiveExporter::FORMAT_JSON;
+    } else {
+      request->send(400, "application/json", "{\"error\":\"unknown_format\"}");
+      return;
+    }
+    std::shared_ptr<RoastArchiveExporter> exporter;
+    if (id > 0 && roastArchive.contains(id)) {
+      exporter = std::make_shared<RoastArchiveExporter>(roastArchive.storage(), id, format);
+    }
+    if (!exporter || !exporter->isOpen()) {
+      request->send(404, "application/json", "{\"error\":\"not_found\"}");
+      return;
+    }
+    AsyncWebServerResponse *response = request->beginChunkedResponse(
+      format == RoastArchiveExporter::FORMAT_CSV ? "text/csv" : "application/json",
+      [exporter](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        return exporter->read(buffer, maxLen);
+      });
+    String disposition = String("attachment; filename=\"roast-") + String(static_cast<unsigned long>(id)) +
+                         (format == RoastArchiveExporter::FORMAT_CSV ? ".csv\"" : ".json\"");
+    response->addHeader("Content-Disposition", disposition);
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+  });
+
+  // DELETE /api/roasts/:id
+  server.on("/api/roasts/*", HTTP_DELETE, [](AsyncWebServerRequest *request) {
+    String name = request->url().substring(String("/api/roasts/").length());
+    uint32_t id = static_cast<uint32_t>(strtoul(name.c_str(), nullptr, 10));
+    if (roastArchive.remove(id)) {
+      LOG_INFOF("Roast archive: deleted roast %lu", (unsigned long)id);
+      request->send(200, "application/json", "{\"ok\":true}");
+    } else if (id != 0 && id == roastArchive.currentId()) {
+      request->send(409, "application/json", "{\"ok\":false,\"error\":\"roast_in_progress\"}");
+    } else {
+      request->send(404, "application/json", "{\"ok\":false,\"error\":\"not_found\"}");
+    }
+  });
+
+  // GET /api/roasts - archived roasts, newest first
+  server.on("/api/roasts", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (!roastArchive.isAvailable()) {
+      request->send(503, "application/json", "{\"error\":\"no_filesystem\"}");
+      return;
+    }
+    std::shared_ptr<RoastArchiveListing> listing = std::make_shared<RoastArchiveListing>(roastArchive);
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+      [listing](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        return listing->read(buffer, maxLen);
+      });
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+  });
+
   // =============================================================================
   // OTHER API ENDPOINTS
   // =============================================================================
 
-  // API endpoint: Debug logs
+  // API endpoint: Debug logs. ?since=<cursor> returns only newer entries.
   server.on("/api/logs", HTTP_GET, [](AsyncWebServerRequest *request) {
-    LOG_DEBUG("API: /api/logs requested");
     int maxEntries = 50;
     if (request->hasParam("max")) {
       maxEntries = request->getParam("max")->value().toInt();
       maxEntries = constrain(maxEntries, 1, 100);
     }
-    String json = debugLogger.getLogsJSON(maxEntries, true);  // Wrap in {logs: [...]}
-    request->send(200, "application/json", json);
+    uint32_t since = 0;
+    if (request->hasParam("since")) {
+      since = static_cast<uint32_t>(strtoul(request->getParam("since")->value().c_str(), nullptr, 10));
+    }
+    std::unique_ptr<char[]> json(new (std::nothrow) char[LOG_HTTP_CAPACITY]);
+    if (!json) {
+      request->send(503, "application/json", "{\"error\":\"out_of_memory\"}");
+      return;
+    }
+    debugLogger.writeLogsJSON(json.get(), LOG_HTTP_CAPACITY, since, maxEntries);
+    request->send(200, "application/json", json.get());
   });
 
   server.on("/api/systemlink", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -1010,87 +1572,12 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
   // Register more specific PID validation routes before /api/pid because
   // ESPAsyncWebServer matches the shorter prefix route first.
   server.on("/api/calibrate-pid/status", HTTP_GET, [](AsyncWebServerRequest *request) {
-    StaticJsonDocument<4096> doc;
-
-    doc["running"] = stepTuner.isRunning();
-    doc["complete"] = stepTuner.isComplete();
-    doc["phase"] = stepTuner.getPhaseName();
-    doc["progressPercent"] = stepTuner.getProgressPercent();
-      doc["sampleCount"] = stepTuner.getSampleCount();
-      doc["lastError"] = stepTuner.getLastError();
-      doc["method"] = "step_response";
-
-      StepResponseTuner::Summary ss = stepTuner.getSummary();
-      JsonObject model = doc.createNestedObject("model");
-      model["valid"] = ss.valid;
-      model["passed"] = ss.passed;
-      model["targetTemp"] = ss.targetTemp;
-      model["ambientTemp"] = ss.ambientTemp;
-      model["recommendedKp"] = ss.recommendedKp;
-      model["recommendedKi"] = ss.recommendedKi;
-      model["recommendedKd"] = ss.recommendedKd;
-      model["meanFitRmse"] = ss.meanFitRmse;
-      model["worstFitRmse"] = ss.worstFitRmse;
-      model["maxTemp"] = ss.maxTemp;
-      model["validBandCount"] = ss.validBandCount;
-      model["totalSamples"] = ss.totalSamples;
-      model["completedBands"] = ss.completedBands;
-      model["totalBands"] = ss.totalBands;
-      model["tauCFactor"] = ss.tauCFactor;
-      model["currentSetpoint"] = ss.currentSetpoint;
-
-      // Band details with FOPDT models
-      JsonArray bands = model.createNestedArray("bands");
-      for (uint8_t i = 0; i < ss.totalBands && i < StepResponseTuner::MAX_BANDS; i++) {
-        const StepResponseTuner::BandResult &br = ss.bands[i];
-        JsonObject item = bands.createNestedObject();
-        item["index"] = i + 1;
-        item["valid"] = br.valid;
-        item["targetTemp"] = br.targetTemp;
-        item["minTemp"] = br.minTemp;
-        item["maxTemp"] = br.maxTemp;
-        item["sampleCount"] = br.sampleCount;
-        item["kp"] = br.kp;
-        item["ki"] = br.ki;
-        item["kd"] = br.kd;
-        if (br.model.valid) {
-          item["processGain"] = br.model.processGain;
-          item["timeConstant"] = br.model.timeConstant;
-          item["deadTime"] = br.model.deadTime;
-          item["fitRmse"] = br.model.fitRmse;
-          item["baselineTemp"] = br.model.baselineTemp;
-          item["finalTemp"] = br.model.finalTemp;
-        }
-      }
-
-      // Backward-compatible cycle array (maps bands to cycles)
-      JsonArray cycles = model.createNestedArray("cycles");
-      for (uint8_t i = 0; i < ss.totalBands && i < StepResponseTuner::MAX_BANDS; i++) {
-        const StepResponseTuner::BandResult &br = ss.bands[i];
-        JsonObject item = cycles.createNestedObject();
-        item["index"] = i + 1;
-        item["valid"] = br.valid;
-        item["passed"] = br.valid;
-        item["modelValid"] = br.model.valid;
-        item["processGain"] = br.model.processGain;
-        item["timeConstant"] = br.model.timeConstant;
-        item["deadTime"] = br.model.deadTime;
-        item["fitRmse"] = br.model.fitRmse;
-        item["sampleCount"] = br.sampleCount;
-        item["kp"] = br.kp;
-        item["ki"] = br.ki;
-        item["kd"] = br.kd;
-      }
-
-      if (stepTuner.isComplete()) {
-        model["kp"] = kp;
-        model["ki"] = ki;
-        model["kd"] = kd;
-      }
-
-    String out;
-    serializeJson(doc, out);
-    request->send(200, "application/json", out);
+    std::shared_ptr<StepStatusJsonStream> stream = std::make_shared<StepStatusJsonStream>(stepTuner, kp, ki, kd);
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+      [stream](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        return stream->read(buffer, maxLen);
+      });
+    request->send(response);
   });
 
   server.on("/api/pid/validate/status", HTTP_GET, [](AsyncWebServerRequest *request) {
@@ -1143,6 +1630,7 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
     if (request->hasParam("tau_c")) {
       tauCFactor = request->getParam("tau_c")->value().toFloat();
     }
+    ControlLock controlLock;
     stepTuner.start(currentTemp, kp, ki, kd, setpointFanSpeed, tauCFactor);
     if (!stepTuner.isRunning()) {
       String error = String("{\"error\":\"") + stepTuner.getLastError() + "\"}";
@@ -1162,40 +1650,20 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
       return;
     }
 
-    stepTuner.cancel();
+    {
+      ControlLock controlLock;
+      stepTuner.cancel();
+    }
     request->send(200, "application/json", "{\"ok\":true,\"status\":\"cancel_requested\"}");
   });
 
   server.on("/api/calibrate-pid/trace", HTTP_GET, [](AsyncWebServerRequest *request) {
-    String out = "{";
-    out += "\"running\":";
-
-    out += stepTuner.isRunning() ? "true" : "false";
-    out += ",\"method\":\"step_response\"";
-    out += ",\"phase\":\"";
-    out += stepTuner.getPhaseName();
-      out += "\",\"bandIndex\":";
-      out += String(static_cast<int>(stepTuner.getActiveBandIndex()) + 1);
-      out += ",\"samples\":[";
-
-      uint16_t count = stepTuner.getTraceSampleCount();
-      for (uint16_t index = 0; index < count; index++) {
-        StepResponseTuner::TraceSample sample = stepTuner.getTraceSample(index);
-        if (index > 0) out += ',';
-        out += "{\"elapsedSeconds\":";
-        out += String(sample.elapsedMs / 1000.0f, 1);
-        out += ",\"actualTempF\":";
-        out += String(sample.actualTempF, 1);
-        out += ",\"setpointTempF\":";
-        out += String(sample.setpointTempF, 1);
-        out += ",\"heaterOutput\":";
-        out += String(sample.heaterOutput, 1);
-        out += ",\"phaseId\":";
-        out += String(sample.phaseId);
-        out += '}';
-      }
-    out += "]}";
-    request->send(200, "application/json", out);
+    std::shared_ptr<StepTraceJsonStream> stream = std::make_shared<StepTraceJsonStream>(stepTuner);
+    AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+      [stream](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+        return stream->read(buffer, maxLen);
+      });
+    request->send(response);
   });
 
   server.on("/api/pid/validate", HTTP_POST, [](AsyncWebServerRequest *request) {
@@ -1216,7 +1684,12 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
       fanPercent = request->getParam("fanPercent")->value().toInt();
     }
 
-    if (!startValidationRoast(target, constrain(fanPercent, 20, 100))) {
+    bool started;
+    {
+      ControlLock controlLock;
+      started = startValidationRoast(target, constrain(fanPercent, 20, 100));
+    }
+    if (!started) {
       request->send(500, "application/json", "{\"error\":\"failed_to_start_validation\"}");
       return;
     }
@@ -1231,6 +1704,57 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
     request->send(200, "application/json", out);
   });
 
+  // Bean RoR window: GET reports it, POST ?window=<seconds> changes and persists it
+  server.on("/api/ror", HTTP_GET, [](AsyncWebServerRequest *request) {
+    char msg[96];
+    snprintf(msg, sizeof(msg), "{\"ror\":%.1f,\"windowSeconds\":%u}", rateOfRise, getRateOfRiseWindowSeconds());
+    request->send(200, "application/json", msg);
+  });
+
+  server.on("/api/ror", HTTP_POST, [](AsyncWebServerRequest *request) {
+    if (!request->hasParam("window")) {
+      request->send(400, "application/json", "{\"error\":\"window parameter required\"}");
+      return;
+    }
+    uint16_t windowSeconds;
+    {
+      ControlLock controlLock;
+      windowSeconds = setRateOfRiseWindowSeconds(request->getParam("window")->value().toInt(), true);
+    }
+    LOG_INFOF("RoR window set to %us", windowSeconds);
+    char msg[64];
+    snprintf(msg, sizeof(msg), "{\"ok\":true,\"windowSeconds\":%u}", windowSeconds);
+    request->send(200, "application/json", msg);
+  });
+
+  // Heater control mode: GET reports it, POST ?mode=pid|mpc|smith switches and persists it.
+  // MPC and Smith only take over while a calibrated band schedule is active.
+  server.on("/api/control/mode", HTTP_GET, [](AsyncWebServerRequest *request) {
+    char msg[128];
+    snprintf(msg, sizeof(msg), "{\"mode\":\"%s\",\"mpcActive\":%s,\"smithActive\":%s,\"mpcAvailable\":%s}",
+             getHeaterControlModeName(heaterControlMode),
+             isPredictiveHeaterControlActive() ? "true" : "false",
+             isSmithPredictorActive() ? "true" : "false",
+             pidRuntimeController.isEnabled() ? "true" : "false");
+    request->send(200, "application/json", msg);
+  });
+
+  server.on("/api/control/mode", HTTP_POST, [](AsyncWebServerRequest *request) {
+    HeaterControlMode mode;
+    if (!request->hasParam("mode") || !parseHeaterControlMode(request->getParam("mode")->value().c_str(), mode)) {
+      request->send(400, "application/json", "{\"error\":\"mode must be pid, mpc or smith\"}");
+      return;
+    }
+    {
+      ControlLock controlLock;
+      setHeaterControlMode(mode, true);
+    }
+    LOG_INFOF("Heater control mode set to %s", getHeaterControlModeName(mode));
+    char msg[64];
+    snprintf(msg, sizeof(msg), "{\"ok\":true,\"mode\":\"%s\"}", getHeaterControlModeName(mode));
+    request->send(200, "application/json", msg);
+  });
+
   // API endpoint: Get current PID values
   server.on("/api/pid", HTTP_GET, [](AsyncWebServerRequest *request) {
     StaticJsonDocument<512> doc;
@@ -1240,6 +1764,7 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
     doc["scheduleEnabled"] = pidRuntimeController.isEnabled();
     doc["activeBand"] = pidRuntimeController.getActiveBandIndex();
     doc["validBandCount"] = pidRuntimeController.getValidBandCount();
+    doc["mode"] = getHeaterControlModeName(heaterControlMode);
     String out;
     serializeJson(doc, out);
     request->send(200, "application/json", out);
@@ -1279,7 +1804,10 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
       double newKi = doc.containsKey("ki") ? doc["ki"].as<double>() : ki;
       double newKd = doc.containsKey("kd") ? doc["kd"].as<double>() : kd;
 
-      setManualPIDGains(newKp, newKi, newKd);
+      {
+        ControlLock controlLock;
+        setManualPIDGains(newKp, newKi, newKd);
+      }
 
       StaticJsonDocument<384> resp;
       resp["ok"] = true;
@@ -1296,1289 +1824,24 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
   // Debug Console UI
   server.on("/console", HTTP_GET, [](AsyncWebServerRequest *request) {
     LOG_INFO("Console UI accessed");
-    request->send(200, "text/html", R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0">
-  <title>Roaster Debug Console</title>
-  <style>
-    * { margin: 0; padding: 0; box-sizing: border-box; }
-    body {
-      font-family: 'Segoe UI', Inter, -apple-system, sans-serif;
-      background: #333333;
-      color: #FFFFFF;
-      padding: 20px;
-      line-height: 1.5;
-    }
-    .topnav {
-      max-width: 1400px;
-      margin: 0 auto 20px;
-      padding: 14px;
-      display: flex;
-      flex-wrap: wrap;
-      gap: 10px;
-      background: #2D2D2D;
-      border-bottom: 2px solid #444;
-      align-items: center;
-    }
-    .topnav-logo {
-      display: flex;
-      align-items: center;
-      gap: 10px;
-      margin-right: auto;
-      font-weight: 900;
-      font-size: 20px;
-      color: #009944;
-      text-transform: uppercase;
-      letter-spacing: 1px;
-    }
-    .topnav a {
-      display: inline-flex;
-      align-items: center;
-      justify-content: center;
-      min-width: 100px;
-      padding: 12px 16px;
-      border-radius: 0;
-      background: #3A3A3A;
-      color: #CCCCCC;
-      text-decoration: none;
-      font-weight: 700;
-      text-transform: uppercase;
-      font-size: 14px;
-      transition: 0.2s;
-    }
-    .topnav a:hover { background: #444444; color: #FFF; }
-    .topnav a.active { background: #009944; color: #fff; }
-    .page {
-      max-width: 1400px;
-      margin: 0 auto;
-      display: grid;
-      grid-template-columns: minmax(0, 1fr);
-      gap: 18px;
-    }
-    .header {
-      background: #2D2D2D;
-      border: none;
-      border-top: 4px solid #009944;
-      padding: 24px;
-    }
-    .header h1 {
-      font-size: 28px;
-      font-weight: 900;
-      color: #fff;
-      text-transform: uppercase;
-      margin-bottom: 8px;
-    }
-    .header .subtitle {
-      color: #AAA;
-      font-size: 14px;
-      display: flex;
-      align-items: center;
-      gap: 16px;
-      flex-wrap: wrap;
-      font-weight: bold;
-    }
-    .status-badge {
-      display: inline-flex;
-      align-items: center;
-      gap: 6px;
-      padding: 4px 12px;
-      background: #222222;
-      border: 1px solid #444;
-      border-radius: 0;
-      font-size: 12px;
-      font-weight: 700;
-      text-transform: uppercase;
-    }
-    .status-dot {
-      width: 8px;
-      height: 8px;
-      border-radius: 50%;
-      background: #3fb950;
-      animation: pulse 2s ease-in-out infinite;
-    }
-    @keyframes pulse {
-      0%, 100% { opacity: 1; }
-      50% { opacity: 0.5; }
-    }
-    .grid {
-      display: grid;
-      grid-template-columns: repeat(auto-fit, minmax(320px, 1fr));
-      gap: 18px;
-    }
-    .page > *,
-    .grid > * {
-      min-width: 0;
-    }
-    .card {
-      background: #2D2D2D;
-      border: none;
-      border-top: 4px solid #444;
-      padding: 20px;
-    }
-    .card-title {
-      font-size: 16px;
-      font-weight: 800;
-      margin-bottom: 16px;
-      color: #fff;
-      display: flex;
-      align-items: center;
-      gap: 8px;
-      text-transform: uppercase;
-    }
-    .card-title::before {
-      content: '';
-      width: 4px;
-      height: 16px;
-      background: #009944;
-      border-radius: 0;
-    }
-    .metric-row {
-      display: flex;
-      justify-content: space-between;
-      padding: 10px 0;
-      border-bottom: 1px solid #444;
-    }
-    .metric-row:last-child {
-      border-bottom: none;
-    }
-    .metric-label {
-      color: #AAA;
-      font-size: 13px;
-      font-weight: 700;
-      text-transform: uppercase;
-    }
-    .metric-value {
-      font-weight: 900;
-      font-size: 16px;
-      color: #FFFFFF;
-      font-family: 'Courier New', monospace;
-    }
-    .metric-value.large {
-      font-size: 32px;
-      color: #009944;
-    }
-    .metric-value.warn {
-      color: #f0883e;
-    }
-    .metric-value.error {
-      color: #f85149;
-    }
-    .gauge-container {
-      position: relative;
-      width: 100%;
-      height: 120px;
-      margin: 16px 0;
-    }
-    .gauge {
-      width: 100%;
-      height: 100%;
-    }
-    .gauge-value {
-      position: absolute;
-      top: 50%;
-      left: 50%;
-      transform: translate(-50%, -50%);
-      font-size: 28px;
-      font-weight: 700;
-      color: #fff;
-    }
-    .gauge-label {
-      text-align: center;
-      color: #8b949e;
-      font-size: 13px;
-      margin-top: 8px;
-    }
-    .panel {
-      background: #222222;
-      border: 1px solid #444;
-      padding: 12px;
-    }
-    .log-container {
-      background: #222222;
-      border: 1px solid #444;
-      border-radius: 0;
-      padding: 12px;
-      max-height: 400px;
-      overflow-y: auto;
-      font-family: 'Courier New', monospace;
-      font-size: 13px;
-    }
-    .log-entry {
-      padding: 6px 8px;
-      margin: 2px 0;
-      border-radius: 0;
-      display: flex;
-      gap: 12px;
-      border-left: 3px solid transparent;
-      background: #2D2D2D;
-    }
-    .log-entry.DEBUG { border-left-color: #8b949e; }
-    .log-entry.INFO { border-left-color: #009944; }
-    .log-entry.WARN { border-left-color: #f0883e; }
-    .log-entry.ERROR { border-left-color: #f85149; background: rgba(248, 81, 73, 0.1); }
-    .log-time {
-      color: #AAA;
-      min-width: 80px;
-    }
-    .log-level {
-      min-width: 50px;
-      font-weight: 700;
-    }
-    .log-level.DEBUG { color: #8b949e; }
-    .log-level.INFO { color: #009944; }
-    .log-level.WARN { color: #f0883e; }
-    .log-level.ERROR { color: #f85149; }
-    .log-message {
-      color: #FFFFFF;
-      flex: 1;
-    }
-    .controls {
-      display: flex;
-      gap: 12px;
-      margin-bottom: 12px;
-      flex-wrap: wrap;
-    }
-    .btn {
-      padding: 12px 16px;
-      background: #444444;
-      border: none;
-      color: #fff;
-      border-radius: 0;
-      cursor: pointer;
-      font-size: 14px;
-      font-weight: 700;
-      text-transform: uppercase;
-      transition: 0.2s;
-    }
-    .btn:hover {
-      background: #555555;
-    }
-    .btn.active {
-      background: #009944;
-      color: #fff;
-    }
-    .full-width {
-      grid-column: 1 / -1;
-    }
-    @media (max-width: 768px) {
-      .grid {
-        grid-template-columns: 1fr;
-      }
-      .header h1 {
-        font-size: 22px;
-      }
-    }
-    @media (max-width: 480px) {
-      body {
-        padding: 12px;
-      }
-      .topnav {
-        padding: 12px;
-        gap: 8px;
-      }
-      .topnav-logo {
-        width: 100%;
-        margin-right: 0;
-        justify-content: center;
-        font-size: 18px;
-      }
-      .topnav a {
-        flex: 1 1 calc(50% - 8px);
-        min-width: 0;
-        padding: 12px 10px;
-        font-size: 12px;
-      }
-      .header,
-      .card {
-        padding: 16px;
-      }
-      .header .subtitle,
-      .controls,
-      .metric-row,
-      .log-entry {
-        gap: 8px;
-      }
-      .metric-row,
-      .log-entry {
-        flex-direction: column;
-        align-items: flex-start;
-      }
-      .log-time,
-      .log-level {
-        min-width: 0;
-      }
-      .gauge-value {
-        font-size: 24px;
-      }
-    }
-  </style>
-</head>
-<body>
-  <nav class="topnav">
-    <div class="topnav-logo">
-      <svg width="24" height="24" viewBox="0 0 24 24" fill="none" xmlns="http://www.w3.org/2000/svg">
-        <path d="M4.5,10 C2.5,15 9,17 12,17 C15,17 21.5,15 19.5,10 C17.5,5 11,3 8,3 C5,3 6.5,5 4.5,10 Z" fill="#009944" />
-        <path d="M5,10 Q12,14 19,9" stroke="#2D2D2D" stroke-width="1.5" fill="none" />
-        <path d="M9,18 Q8,20 10,22" stroke="#009944" stroke-width="2" fill="none" stroke-linecap="round" />
-        <path d="M12,19 Q11,21 13,23" stroke="#009944" stroke-width="2" fill="none" stroke-linecap="round" />
-        <path d="M15,18 Q14,20 16,22" stroke="#009944" stroke-width="2" fill="none" stroke-linecap="round" />
-      </svg>
-      Roaster Control
-    </div>
-    <a class="active" href="/">Console</a>
-    <a href="/profile">Profiles</a>
-    <a href="/pid">PID</a>
-    <a href="/update">Update</a>
-    <a href="/systemlink">SystemLink</a>
-  </nav>
-  <div class="page">
-    <div class="header">
-      <h1>Roaster Debug Console</h1>
-      <div class="subtitle">
-        <span class="status-badge">
-          <span class="status-dot"></span>
-          <span id="stateText">Loading...</span>
-        </span>
-        <span id="uptime">Uptime: --</span>
-        <span>Last Update: <span id="lastUpdate">--</span></span>
-      </div>
-    </div>
-
-  <div class="grid">
-    <div class="card">
-      <div class="card-title">Bean Temperature</div>
-      <div style="display: flex; justify-content: center; margin: 20px 0;">
-        <svg id="tempGauge" width="200" height="200" viewBox="0 0 200 200">
-          <circle cx="100" cy="100" r="90" fill="none" stroke="#444" stroke-width="12"/>
-          <path id="tempArc" fill="none" stroke="url(#tempGradient)" stroke-width="12" stroke-linecap="round"/>
-          <text x="100" y="95" text-anchor="middle" font-size="36" font-weight="bold" fill="#fff" id="tempValue">--</text>
-          <text x="100" y="115" text-anchor="middle" font-size="16" fill="#AAA">F</text>
-          <text x="100" y="135" text-anchor="middle" font-size="13" fill="#009944" id="tempTarget">Target: --</text>
-          <defs>
-            <linearGradient id="tempGradient" x1="0%" y1="0%" x2="100%" y2="0%">
-              <stop offset="0%" style="stop-color:#0050FF;stop-opacity:1" />
-              <stop offset="50%" style="stop-color:#009944;stop-opacity:1" />
-              <stop offset="100%" style="stop-color:#CC0000;stop-opacity:1" />
-            </linearGradient>
-          </defs>
-        </svg>
-      </div>
-      <div class="metric-row">
-        <span class="metric-label">Fan Temp</span>
-        <span class="metric-value" id="fanTemp">--°F</span>
-      </div>
-    </div>
-
-    <div class="card">
-      <div class="card-title">Control Output</div>
-      <div style="margin: 20px 0;">
-        <div style="margin-bottom: 20px;">
-          <div style="display: flex; justify-content: space-between; margin-bottom: 8px;">
-            <span class="metric-label">Heater</span>
-            <span class="metric-value" id="heaterOutput">--%</span>
-          </div>
-          <div class="panel" style="padding: 0; height: 24px; overflow: hidden;">
-            <div id="heaterBar" style="height: 100%; background: linear-gradient(90deg, #f0883e, #CC0000); width: 0%; transition: width 0.3s;"></div>
-          </div>
-        </div>
-        <div style="margin-bottom: 20px;">
-          <div style="display: flex; justify-content: space-between; margin-bottom: 8px;">
-            <span class="metric-label">PWM Fan</span>
-            <span class="metric-value" id="pwmFan">--</span>
-          </div>
-          <div class="panel" style="padding: 0; height: 24px; overflow: hidden;">
-            <div id="fanBar" style="height: 100%; background: linear-gradient(90deg, #0050FF, #009944); width: 0%; transition: width 0.3s;"></div>
-          </div>
-        </div>
-        <div class="metric-row">
-          <span class="metric-label">BDC Fan</span>
-          <span class="metric-value" id="bdcFan">-- µs</span>
-        </div>
-      </div>
-    </div>
-
-    <div class="card">
-      <div class="card-title">Roast Profile</div>
-      <div style="margin: 20px 0;">
-        <div style="display: flex; justify-content: space-between; margin-bottom: 8px;">
-          <span class="metric-label">Progress</span>
-          <span class="metric-value" id="profileProgress">--%</span>
-        </div>
-        <div class="panel" style="padding: 0; height: 32px; overflow: hidden; margin-bottom: 20px;">
-          <div id="progressBar" style="height: 100%; background: linear-gradient(90deg, #009944, #0050FF); width: 0%; transition: width 0.5s; display: flex; align-items: center; justify-content: center; font-size: 14px; font-weight: 700; color: #fff;"></div>
-        </div>
-      </div>
-      <div class="metric-row">
-        <span class="metric-label">Setpoints</span>
-        <span class="metric-value" id="setpointCount">--</span>
-      </div>
-      <div class="metric-row">
-        <span class="metric-label">Final Target</span>
-        <span class="metric-value" id="finalTemp">--°F</span>
-      </div>
-    </div>
-
-    <div class="card">
-      <div class="card-title">Safety and System</div>
-      <div class="metric-row">
-        <span class="metric-label">Bad Readings</span>
-        <span class="metric-value" id="badReadings">--</span>
-      </div>
-      <div class="metric-row">
-        <span class="metric-label">Last Reject</span>
-        <span class="metric-value" id="lastRejectedReason">--</span>
-      </div>
-      <div class="metric-row">
-        <span class="metric-label">Free Heap</span>
-        <span class="metric-value" id="heapFree">-- KB</span>
-      </div>
-      <div class="metric-row">
-        <span class="metric-label">Heap Usage</span>
-        <span class="metric-value" id="heapUsage">--%</span>
-      </div>
-    </div>
-
-    <div class="card full-width">
-      <div class="card-title">Live Temperature Chart</div>
-      <div class="panel">
-        <canvas id="tempChart" width="800" height="200" style="width: 100%; height: 200px;"></canvas>
-      </div>
-    </div>
-
-    <div class="card full-width">
-      <div class="card-title">Debug Logs</div>
-      <div class="controls">
-        <button class="btn active" onclick="filterLogs('ALL')">All</button>
-        <button class="btn" onclick="filterLogs('ERROR')">Errors</button>
-        <button class="btn" onclick="filterLogs('WARN')">Warnings</button>
-        <button class="btn" onclick="filterLogs('INFO')">Info</button>
-        <button class="btn" onclick="filterLogs('DEBUG')">Debug</button>
-        <button class="btn" onclick="clearLogs()">Clear Display</button>
-        <button class="btn" onclick="toggleAutoScroll()">Auto-scroll: <span id="autoScrollState">ON</span></button>
-      </div>
-      <div class="log-container" id="logContainer">
-        <div class="log-entry INFO">
-          <span class="log-time">00:00:00</span>
-          <span class="log-level INFO">INFO</span>
-          <span class="log-message">Console loaded. Fetching data...</span>
-        </div>
-      </div>
-    </div>
-  </div>
-  </div>
-
-  <script>
-    let autoScroll = true;
-    let logFilter = 'ALL';
-    let wsConnected = false;
-
-    function formatUptime(seconds) {
-      const h = Math.floor(seconds / 3600);
-      const m = Math.floor((seconds % 3600) / 60);
-      const s = seconds % 60;
-      return `${h}h ${m}m ${s}s`;
-    }
-
-    function updateSystemState(data) {
-      document.getElementById('stateText').textContent = data.state || '--';
-      document.getElementById('uptime').textContent = 'Uptime: ' + formatUptime(data.uptime || 0);
-      document.getElementById('lastUpdate').textContent = new Date().toLocaleTimeString();
-
-      // Update temperature gauge
-      const currentTemp = data.temps?.current || 0;
-      const setpointTemp = data.temps?.setpoint || 0;
-      document.getElementById('tempValue').textContent = Math.round(currentTemp);
-      document.getElementById('tempTarget').textContent = 'Target: ' + Math.round(setpointTemp);
-      updateGauge(currentTemp, 500); // Max temp 500°F
-      
-      document.getElementById('fanTemp').textContent = (data.temps?.fan || '--') + '°F';
-
-      // Update control bars
-      const heaterPct = Math.round((data.control?.heater || 0) / 255 * 100);
-      document.getElementById('heaterOutput').textContent = heaterPct + '%';
-      document.getElementById('heaterBar').style.width = heaterPct + '%';
-      
-      const pwmFan = data.control?.pwmFan || 0;
-      const fanPct = Math.round(pwmFan / 255 * 100);
-      document.getElementById('pwmFan').textContent = pwmFan;
-      document.getElementById('fanBar').style.width = fanPct + '%';
-      
-      document.getElementById('bdcFan').textContent = (data.control?.bdcFan || '--') + ' µs';
-
-      // Update profile progress
-      const progress = data.profile?.progress || 0;
-      document.getElementById('profileProgress').textContent = progress + '%';
-      const progressBar = document.getElementById('progressBar');
-      progressBar.style.width = progress + '%';
-      progressBar.textContent = progress > 10 ? progress + '%' : '';
-      
-      document.getElementById('setpointCount').textContent = data.profile?.setpointCount || '--';
-      document.getElementById('finalTemp').textContent = (data.profile?.finalTemp || '--') + '°F';
-
-      const badReadings = data.safety?.badReadings || 0;
-      const badReadingsEl = document.getElementById('badReadings');
-      badReadingsEl.textContent = badReadings;
-      badReadingsEl.className = 'metric-value' + (badReadings > 5 ? ' error' : badReadings > 2 ? ' warn' : '');
-
-      const lastRejectedReason = data.safety?.lastRejectedReason || 'none';
-      const lastRejectedReasonEl = document.getElementById('lastRejectedReason');
-      lastRejectedReasonEl.textContent = lastRejectedReason;
-      lastRejectedReasonEl.className = 'metric-value' + (lastRejectedReason !== 'none' ? ' warn' : '');
-
-      const heapFree = Math.round((data.memory?.heapFree || 0) / 1024);
-      const heapSize = data.memory?.heapSize || 1;
-      const heapUsage = Math.round((1 - (data.memory?.heapFree || 0) / heapSize) * 100);
-      document.getElementById('heapFree').textContent = heapFree + ' KB';
-      const heapUsageEl = document.getElementById('heapUsage');
-      heapUsageEl.textContent = heapUsage + '%';
-      heapUsageEl.className = 'metric-value' + (heapUsage > 80 ? ' error' : heapUsage > 60 ? ' warn' : '');
-      
-      // Update temperature chart
-      updateChart(currentTemp, setpointTemp);
-    }
-
-    function updateLogs(logs) {
-      const container = document.getElementById('logContainer');
-      container.innerHTML = '';
-      
-      logs.forEach(log => {
-        if (logFilter !== 'ALL' && log.level !== logFilter) return;
-        
-        const entry = document.createElement('div');
-        entry.className = 'log-entry ' + log.level;
-        
-        const time = new Date(log.timestamp).toLocaleTimeString();
-        entry.innerHTML = `
-          <span class="log-time">${time}</span>
-          <span class="log-level ${log.level}">${log.level}</span>
-          <span class="log-message">${log.message}</span>
-        `;
-        
-        container.appendChild(entry);
-      });
-
-      if (autoScroll) {
-        container.scrollTop = container.scrollHeight;
-      }
-    }
-
-    function filterLogs(level) {
-      logFilter = level;
-      document.querySelectorAll('.controls .btn').forEach(btn => {
-        btn.classList.toggle('active', btn.textContent.startsWith(level) || (level === 'ALL' && btn.textContent === 'All'));
-      });
-      fetchLogs();
-    }
-
-    function clearLogs() {
-      document.getElementById('logContainer').innerHTML = '<div class="log-entry INFO"><span class="log-time">' + 
-        new Date().toLocaleTimeString() + '</span><span class="log-level INFO">INFO</span>' +
-        '<span class="log-message">Display cleared (logs still in memory)</span></div>';
-    }
-
-    function toggleAutoScroll() {
-      autoScroll = !autoScroll;
-      document.getElementById('autoScrollState').textContent = autoScroll ? 'ON' : 'OFF';
-    }
-
-    // Temperature gauge rendering
-    function updateGauge(temp, maxTemp) {
-      const percentage = Math.min(temp / maxTemp, 1);
-      const angle = percentage * 270 - 135; // -135° to 135° (270° arc)
-      const radians = (angle * Math.PI) / 180;
-      
-      const centerX = 100;
-      const centerY = 100;
-      const radius = 90;
-      
-      const startX = centerX + radius * Math.cos(-135 * Math.PI / 180);
-      const startY = centerY + radius * Math.sin(-135 * Math.PI / 180);
-      const endX = centerX + radius * Math.cos(radians);
-      const endY = centerY + radius * Math.sin(radians);
-      
-      const largeArc = percentage > 0.75 ? 1 : 0;
-      
-      const path = `M ${startX} ${startY} A ${radius} ${radius} 0 ${largeArc} 1 ${endX} ${endY}`;
-      document.getElementById('tempArc').setAttribute('d', path);
-    }
-
-    // Temperature chart
-    const chartData = {
-      temps: [],
-      setpoints: [],
-      times: [],
-      maxPoints: 120 // 2 minutes at 1 sample/second
-    };
-
-    function updateChart(temp, setpoint) {
-      const now = new Date();
-      chartData.temps.push(temp);
-      chartData.setpoints.push(setpoint);
-      chartData.times.push(now);
-      
-      // Keep only last maxPoints
-      if (chartData.temps.length > chartData.maxPoints) {
-        chartData.temps.shift();
-        chartData.setpoints.shift();
-        chartData.times.shift();
-      }
-      
-      drawChart();
-    }
-
-    function drawChart() {
-      const canvas = document.getElementById('tempChart');
-      const ctx = canvas.getContext('2d');
-      const width = canvas.width;
-      const height = canvas.height;
-      
-      // Clear canvas
-      ctx.fillStyle = '#222222';
-      ctx.fillRect(0, 0, width, height);
-      
-      if (chartData.temps.length < 2) return;
-      
-      // Find min/max for scaling
-      const allValues = [...chartData.temps, ...chartData.setpoints];
-      const minTemp = Math.min(...allValues) - 10;
-      const maxTemp = Math.max(...allValues) + 10;
-      const tempRange = maxTemp - minTemp;
-      
-      // Draw grid
-      ctx.strokeStyle = '#444';
-      ctx.lineWidth = 1;
-      for (let i = 0; i <= 4; i++) {
-        const y = (height / 4) * i;
-        ctx.beginPath();
-        ctx.moveTo(0, y);
-        ctx.lineTo(width, y);
-        ctx.stroke();
-      }
-      
-      // Draw setpoint line
-      ctx.strokeStyle = '#0050FF';
-      ctx.lineWidth = 2;
-      ctx.setLineDash([5, 5]);
-      ctx.beginPath();
-      chartData.setpoints.forEach((temp, i) => {
-        const x = (i / (chartData.maxPoints - 1)) * width;
-        const y = height - ((temp - minTemp) / tempRange) * height;
-        if (i === 0) ctx.moveTo(x, y);
-        else ctx.lineTo(x, y);
-      });
-      ctx.stroke();
-      ctx.setLineDash([]);
-      
-      // Draw temperature line
-      ctx.strokeStyle = '#009944';
-      ctx.lineWidth = 3;
-      ctx.beginPath();
-      chartData.temps.forEach((temp, i) => {
-        const x = (i / (chartData.maxPoints - 1)) * width;
-        const y = height - ((temp - minTemp) / tempRange) * height;
-        if (i === 0) ctx.moveTo(x, y);
-        else ctx.lineTo(x, y);
-      });
-      ctx.stroke();
-      
-      // Draw labels
-      ctx.fillStyle = '#AAA';
-      ctx.font = '12px monospace';
-      ctx.textAlign = 'left';
-      ctx.fillText(Math.round(maxTemp) + '°F', 5, 15);
-      ctx.fillText(Math.round(minTemp) + '°F', 5, height - 5);
-    }
-
-    async function fetchState() {
-      try {
-        const response = await fetch('/api/state');
-        const data = await response.json();
-        updateSystemState(data);
-      } catch (error) {
-        console.error('Error fetching state:', error);
-      }
-    }
-
-    async function fetchLogs() {
-      try {
-        const response = await fetch('/api/logs?max=100');
-        const data = await response.json();
-        updateLogs(data.logs || []);
-      } catch (error) {
-        console.error('Error fetching logs:', error);
-      }
-    }
-
-    // WebSocket connection
-    let ws = null;
-    let reconnectInterval = null;
-    let pollingInterval = null;
-    let logsPollingInterval = null;
-
-    function connectWebSocket() {
-      const protocol = window.location.protocol === 'https:' ? 'wss:' : 'ws:';
-      const wsUrl = `${protocol}//${window.location.host}/WebSocket`;
-      
-      ws = new WebSocket(wsUrl);
-      
-      ws.onopen = () => {
-        console.log('WebSocket connected');
-        wsConnected = true;
-        document.querySelector('.status-dot').style.background = '#009944';
-        
-        // Stop polling when WebSocket is connected
-        if (pollingInterval) {
-          clearInterval(pollingInterval);
-          pollingInterval = null;
-        }
-        if (logsPollingInterval) {
-          clearInterval(logsPollingInterval);
-          logsPollingInterval = null;
-        }
-        
-        // Clear reconnect timer
-        if (reconnectInterval) {
-          clearTimeout(reconnectInterval);
-          reconnectInterval = null;
-        }
-      };
-      
-      ws.onmessage = (event) => {
-        try {
-          const data = JSON.parse(event.data);
-          
-          // Check if it's state data or logs data
-          if (data.state !== undefined) {
-            updateSystemState(data);
-          } else if (data.logs !== undefined) {
-            updateLogs(data.logs);
-          }
-        } catch (error) {
-          console.error('Error parsing WebSocket message:', error);
-        }
-      };
-      
-      ws.onerror = (error) => {
-        console.error('WebSocket error:', error);
-      };
-      
-      ws.onclose = () => {
-        console.log('WebSocket disconnected');
-        wsConnected = false;
-        document.querySelector('.status-dot').style.background = '#f0883e';
-        
-        // Fall back to polling
-        if (!pollingInterval) {
-          pollingInterval = setInterval(fetchState, 1000);
-        }
-        if (!logsPollingInterval) {
-          logsPollingInterval = setInterval(fetchLogs, 2000);
-        }
-        
-        // Try to reconnect after 5 seconds
-        if (!reconnectInterval) {
-          reconnectInterval = setTimeout(connectWebSocket, 5000);
-        }
-      };
-    }
-
-    // Initial load
-    fetchState();
-    fetchLogs();
-
-    // Try to connect via WebSocket
-    connectWebSocket();
-
-    // Start with polling as fallback (will be cleared if WebSocket connects)
-    pollingInterval = setInterval(fetchState, 1000);
-    logsPollingInterval = setInterval(fetchLogs, 2000);
-  </script>
-</body>
-</html>
-)rawliteral");
+    sendWebAsset(request, WEB_ASSET_CONSOLE);
   });
 
   // PID Tuning UI
   server.on("/pid", HTTP_GET, [](AsyncWebServerRequest *request) {
     LOG_INFO("PID UI accessed");
-    request->send(200, "text/html", R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-  <meta charset="UTF-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1.0">
-  <title>PID Workflow</title>
-  <style>
-    * { margin: 0; padding: 0; box-sizing: border-box; }
-    body { font-family: 'Segoe UI', Inter, -apple-system, sans-serif; background: #333333; color: #FFFFFF; padding: 20px; line-height: 1.5; }
-    .topnav { max-width: 1100px; margin: 0 auto 20px; padding: 14px; display:flex; flex-wrap:wrap; gap:10px; background:#2D2D2D; border-bottom:2px solid #444; align-items:center; }
-    .topnav-logo { display:flex; align-items:center; gap:10px; margin-right:auto; font-weight:900; font-size:20px; color:#009944; text-transform:uppercase; letter-spacing:1px; }
-    .topnav a { display:inline-flex; align-items:center; justify-content:center; min-width:100px; padding:12px 16px; border-radius:0; background:#3A3A3A; color:#CCCCCC; text-decoration:none; font-weight:700; text-transform:uppercase; font-size:14px; transition: 0.2s; }
-    .topnav a:hover { background:#444444; color:#FFF; }
-    .topnav a.active { background:#009944; color:#fff; }
-    .page { max-width: 1100px; margin: 0 auto; display: grid; grid-template-columns: minmax(0, 1fr); gap: 16px; }
-    .card { background: #2D2D2D; border: none; border-top: 4px solid #444; padding: 20px; }
-    .page > *, .two-col > * { min-width: 0; }
-    h1, h2 { margin-top: 0; color: #fff; text-transform: uppercase; font-weight: 800; font-size: 20px; }
-    h1 { font-size: 24px; font-weight: 900; }
-    label { display: block; margin: 12px 0 4px; color: #AAA; font-size: 13px; font-weight: bold; text-transform: uppercase; }
-    input { width: 100%; padding: 12px; border-radius: 0; border: 1px solid #444; background: #222222; color: #FFF; font-weight: bold; }
-    input:focus { outline: none; border-color: #009944; }
-    button { margin-top: 14px; width: 100%; padding: 14px; border: none; border-radius: 0; font-weight: 700; cursor: pointer; text-transform: uppercase; transition: 0.2s; }
-    button:disabled { opacity: 0.45; cursor: not-allowed; }
-    .primary { background: #009944; color: #fff; }
-    .primary:hover { background: #007A36; }
-    .secondary { background: #444444; color: #fff; }
-    .secondary:hover { background: #555555; }
-    .tertiary { background: #CC0000; color: #fff; }
-    .tertiary:hover { background: #A30000; }
-    .note { color: #AAA; font-size: 13px; margin-top: 8px; font-weight: bold; }
-    .row { display: grid; grid-template-columns: repeat(3, 1fr); gap: 10px; }
-    .two-col { display: grid; grid-template-columns: repeat(auto-fit, minmax(280px, 1fr)); gap: 16px; }
-    .button-row { display: grid; grid-template-columns: repeat(2, minmax(0, 1fr)); gap: 10px; }
-    .status-grid { display: grid; grid-template-columns: repeat(auto-fit, minmax(180px, 1fr)); gap: 10px; margin-top: 16px; }
-    .metric { background: #222222; border: 1px solid #444; padding: 12px; }
-    .metric-label { color: #AAA; font-size: 12px; text-transform: uppercase; letter-spacing: 0.04em; font-weight: bold; }
-    .metric-value { color: #fff; font-size: 20px; font-weight: 900; margin-top: 6px; }
-    .chart { margin-top: 16px; background: #222222; border: 1px solid #444; padding: 12px; }
-    .chart canvas { width: 100%; height: 260px; display: block; }
-    .legend { display: flex; gap: 18px; margin-top: 10px; color: #AAA; font-size: 12px; font-weight: bold; text-transform: uppercase; }
-    .legend span { display: inline-flex; align-items: center; gap: 8px; }
-    .legend span::before { content: ""; width: 18px; height: 3px; border-radius: 0; display: inline-block; }
-    .legend .actual::before { background: #0050FF; }
-    .legend .setpoint::before { background: #FFFFFF; }
-    table { width: 100%; border-collapse: collapse; margin-top: 16px; }
-    th, td { text-align: left; padding: 10px; border-bottom: 1px solid #444; font-size: 14px; font-weight: bold; }
-    th { color: #AAA; text-transform: uppercase; font-size: 12px; }
-    .small { font-size: 12px; color: #AAA; }
-    @media (max-width: 480px) {
-      body {
-        padding: 12px;
-      }
-      .topnav {
-        padding: 12px;
-        gap: 8px;
-      }
-      .topnav-logo {
-        width: 100%;
-        margin-right: 0;
-        justify-content: center;
-        font-size: 18px;
-      }
-      .topnav a {
-        flex: 1 1 calc(50% - 8px);
-        min-width: 0;
-        padding: 12px 10px;
-        font-size: 12px;
-      }
-      .card {
-        padding: 16px;
-      }
-      .row,
-      .button-row,
-      .status-grid,
-      .two-col {
-        grid-template-columns: 1fr;
-      }
-      .legend {
-        display: grid;
-        gap: 8px;
-      }
-      table {
-        display: block;
-        overflow-x: auto;
-        white-space: nowrap;
-      }
-    }
-  </style>
-</head>
-<body>
-  <nav class="topnav">
-    <div class="topnav-logo">
-      <svg width="24" height="24" viewBox="0 0 24 24" fill="none" xmlns="http://www.w3.org/2000/svg">
-        <path d="M4.5,10 C2.5,15 9,17 12,17 C15,17 21.5,15 19.5,10 C17.5,5 11,3 8,3 C5,3 6.5,5 4.5,10 Z" fill="#009944" />
-        <path d="M5,10 Q12,14 19,9" stroke="#2D2D2D" stroke-width="1.5" fill="none" />
-        <path d="M9,18 Q8,20 10,22" stroke="#009944" stroke-width="2" fill="none" stroke-linecap="round" />
-        <path d="M12,19 Q11,21 13,23" stroke="#009944" stroke-width="2" fill="none" stroke-linecap="round" />
-        <path d="M15,18 Q14,20 16,22" stroke="#009944" stroke-width="2" fill="none" stroke-linecap="round" />
-      </svg>
-      Roaster Control
-    </div>
-    <a href="/">Console</a>
-    <a href="/profile">Profiles</a>
-    <a class="active" href="/pid">PID</a>
-    <a href="/update">Update</a>
-    <a href="/systemlink">SystemLink</a>
-  </nav>
-  <div class="page">
-    <div class="card">
-      <h1>PID Workflow</h1>
-      <p class="note">Apply manual gains directly, or run the step-response PID tuning workflow. The tuner applies open-loop step inputs at 2 temperature bands, fits FOPDT models, and calculates SIMC PID gains.</p>
-      <div class="row">
-        <div>
-          <label for="kp">Kp</label>
-          <input id="kp" type="number" step="0.01" />
-        </div>
-        <div>
-          <label for="ki">Ki</label>
-          <input id="ki" type="number" step="0.01" />
-        </div>
-        <div>
-          <label for="kd">Kd</label>
-          <input id="kd" type="number" step="0.01" />
-        </div>
-      </div>
-      <button class="primary" onclick="applyPid()">Apply PID Values</button>
-      <p class="note" id="status">Loading current PID...</p>
-    </div>
-
-    <div class="two-col">
-      <div class="card">
-        <h2>PID Tuning</h2>
-        <label for="fan">Calibration Fan PWM (0-255)</label>
-        <input id="fan" type="number" value="255" />
-        <div id="stepOptions">
-          <label for="tauC">&tau;<sub>c</sub> Factor (0.3-3.0, lower = more aggressive)</label>
-          <input id="tauC" type="number" min="0.3" max="3.0" step="0.1" value="0.5" />
-        </div>
-        <div class="button-row">
-          <button id="startAutotuneButton" class="secondary" onclick="startAutotune()">Run Step-Response PID Tuning</button>
-          <button id="cancelAutotuneButton" class="tertiary" onclick="cancelAutotune()" disabled>Cancel Tuning</button>
-        </div>
-        <p class="note" id="methodNote">The step-response tuner stabilizes at 2 temperature bands (175, 275F), applies a heater step, records the open-loop response, fits a first-order-plus-dead-time model, and computes SIMC PID gains. Auto-validation runs after cooling.</p>
-        <div class="status-grid">
-          <div class="metric"><div class="metric-label">Phase</div><div class="metric-value" id="autotunePhase">--</div></div>
-          <div class="metric"><div class="metric-label">Progress</div><div class="metric-value" id="autotuneProgress">--</div></div>
-          <div class="metric"><div class="metric-label">Setpoint</div><div class="metric-value" id="autotuneSetpoint">--</div></div>
-          <div class="metric"><div class="metric-label">Best PID</div><div class="metric-value small" id="autotunePid">--</div></div>
-          <div class="metric"><div class="metric-label" id="autotuneBestLabel">Best Cycle</div><div class="metric-value" id="autotuneBest">--</div></div>
-          <div class="metric"><div class="metric-label">Outcome</div><div class="metric-value" id="autotuneOutcome">--</div></div>
-        </div>
-        <div class="note" id="autotuneSummary">No tuning run recorded yet.</div>
-        <div class="chart">
-          <canvas id="autotuneChart" width="760" height="260"></canvas>
-          <div class="legend">
-            <span class="actual">Actual Temp</span>
-            <span class="setpoint">Setpoint</span>
-          </div>
-        </div>
-        <table>
-          <thead id="cycleTableHeader">
-            <tr><th>Cycle</th><th>MAE</th><th>Overshoot</th><th>Oscillations</th><th>Score</th><th>PID</th></tr>
-          </thead>
-          <tbody id="cycleTableBody">
-            <tr><td colspan="6" class="small">No data yet.</td></tr>
-          </tbody>
-        </table>
-      </div>
-    </div>
-  </div>
-
-  <script>
-    const chartCanvas = document.getElementById('autotuneChart');
-    const chartCtx = chartCanvas.getContext('2d');
-    const pidInputIds = ['kp', 'ki', 'kd'];
-    let latestTraceSamples = [];
-    let pidInputsDirty = false;
-    let suppressPidDirty = false;
-
-    function formatNumber(value, digits = 2) {
-      return Number.isFinite(value) ? value.toFixed(digits) : '--';
-    }
-
-    function bindPidInputs() {
-      pidInputIds.forEach(id => {
-        const input = document.getElementById(id);
-        input.addEventListener('input', () => {
-          if (!suppressPidDirty) {
-            pidInputsDirty = true;
-          }
-        });
-      });
-    }
-
-    function setPidInputs(nextKp, nextKi, nextKd) {
-      suppressPidDirty = true;
-      document.getElementById('kp').value = Number.isFinite(nextKp) ? Number(nextKp).toFixed(2) : '';
-      document.getElementById('ki').value = Number.isFinite(nextKi) ? Number(nextKi).toFixed(3) : '';
-      document.getElementById('kd').value = Number.isFinite(nextKd) ? Number(nextKd).toFixed(2) : '';
-      suppressPidDirty = false;
-      pidInputsDirty = false;
-    }
-
-    function drawTracePlaceholder(message) {
-      chartCtx.clearRect(0, 0, chartCanvas.width, chartCanvas.height);
-      chartCtx.fillStyle = '#0d1117';
-      chartCtx.fillRect(0, 0, chartCanvas.width, chartCanvas.height);
-      chartCtx.fillStyle = '#8b949e';
-      chartCtx.font = '14px Arial';
-      chartCtx.textAlign = 'center';
-      chartCtx.fillText(message, chartCanvas.width / 2, chartCanvas.height / 2);
-    }
-
-    function renderTrace(samples) {
-      latestTraceSamples = Array.isArray(samples) ? samples : [];
-
-      const width = chartCanvas.width;
-      const height = chartCanvas.height;
-      const padLeft = 52;
-      const padRight = 18;
-      const padTop = 18;
-      const padBottom = 34;
-
-      chartCtx.clearRect(0, 0, width, height);
-      chartCtx.fillStyle = '#0d1117';
-      chartCtx.fillRect(0, 0, width, height);
-
-      if (!latestTraceSamples.length) {
-        drawTracePlaceholder('No trace data yet.');
-        return;
-      }
-
-      const maxTime = latestTraceSamples.reduce((maxValue, sample) => Math.max(maxValue, Number(sample.elapsedSeconds) || 0), 0);
-      const temperatureValues = latestTraceSamples.flatMap(sample => [Number(sample.actualTempF), Number(sample.setpointTempF)]).filter(Number.isFinite);
-
-      if (!temperatureValues.length) {
-        drawTracePlaceholder('Trace data unavailable.');
-        return;
-      }
-
-      let minTemp = Math.min(...temperatureValues);
-      let maxTemp = Math.max(...temperatureValues);
-      minTemp = Math.floor((minTemp - 5) / 5) * 5;
-      maxTemp = Math.ceil((maxTemp + 5) / 5) * 5;
-
-      if (maxTemp <= minTemp) {
-        maxTemp = minTemp + 10;
-      }
-
-      const plotWidth = width - padLeft - padRight;
-      const plotHeight = height - padTop - padBottom;
-      const xFor = time => padLeft + ((Number(time) || 0) / Math.max(maxTime, 1)) * plotWidth;
-      const yFor = temp => padTop + (1 - ((Number(temp) - minTemp) / (maxTemp - minTemp))) * plotHeight;
-
-      chartCtx.strokeStyle = '#21262d';
-      chartCtx.lineWidth = 1;
-      for (let row = 0; row <= 4; row++) {
-        const y = padTop + (plotHeight / 4) * row;
-        chartCtx.beginPath();
-        chartCtx.moveTo(padLeft, y);
-        chartCtx.lineTo(width - padRight, y);
-        chartCtx.stroke();
-      }
-
-      chartCtx.fillStyle = '#8b949e';
-      chartCtx.font = '11px Arial';
-      chartCtx.textAlign = 'right';
-      for (let row = 0; row <= 4; row++) {
-        const ratio = 1 - row / 4;
-        const labelTemp = minTemp + (maxTemp - minTemp) * ratio;
-        const y = padTop + (plotHeight / 4) * row + 4;
-        chartCtx.fillText(`${formatNumber(labelTemp, 0)}F`, padLeft - 8, y);
-      }
-
-      chartCtx.textAlign = 'center';
-      for (let column = 0; column <= 4; column++) {
-        const timeValue = (Math.max(maxTime, 1) / 4) * column;
-        const x = padLeft + (plotWidth / 4) * column;
-        chartCtx.fillText(`${formatNumber(timeValue, 0)}s`, x, height - 10);
-      }
-
-      function drawSeries(color, accessor) {
-        chartCtx.beginPath();
-        chartCtx.strokeStyle = color;
-        chartCtx.lineWidth = 2;
-        let started = false;
-        latestTraceSamples.forEach(sample => {
-          const value = Number(accessor(sample));
-          if (!Number.isFinite(value)) {
-            return;
-          }
-          const x = xFor(sample.elapsedSeconds);
-          const y = yFor(value);
-          if (!started) {
-            chartCtx.moveTo(x, y);
-            started = true;
-          } else {
-            chartCtx.lineTo(x, y);
-          }
-        });
-        if (started) {
-          chartCtx.stroke();
-        }
-      }
-
-      drawSeries('#58a6ff', sample => sample.actualTempF);
-      drawSeries('#f2cc60', sample => sample.setpointTempF);
-    }
-
-    async function loadPid() {
-      try {
-        const res = await fetch('/api/pid');
-        const data = await res.json();
-        setPidInputs(data.kp, data.ki, data.kd);
-        document.getElementById('status').textContent = 'Current PID loaded.';
-      } catch (e) {
-        document.getElementById('status').textContent = 'Failed to load PID values.';
-      }
-    }
-
-    async function applyPid() {
-      const kp = parseFloat(document.getElementById('kp').value);
-      const ki = parseFloat(document.getElementById('ki').value);
-      const kd = parseFloat(document.getElementById('kd').value);
-      if (!Number.isFinite(kp) || !Number.isFinite(ki) || !Number.isFinite(kd)) {
-        document.getElementById('status').textContent = 'Enter valid numeric PID values before applying.';
-        return;
-      }
-      document.getElementById('status').textContent = 'Applying PID...';
-      try {
-        const res = await fetch('/api/pid', { method: 'POST', headers: { 'Content-Type': 'application/json' }, body: JSON.stringify({ kp, ki, kd }) });
-        const data = await res.json();
-        if (data.ok) {
-          setPidInputs(data.kp, data.ki, data.kd);
-          document.getElementById('status').textContent = 'PID applied and saved.';
-        } else {
-          document.getElementById('status').textContent = 'Failed to apply PID.';
-        }
-      } catch (e) {
-        document.getElementById('status').textContent = 'Failed to apply PID.';
-      }
-    }
-
-    let activeMethod = 'step_response';
-
-    async function startAutotune() {
-      const fan = parseInt(document.getElementById('fan').value) || 255;
-      const tauC = parseFloat(document.getElementById('tauC').value) || 0.5;
-      let url = `/api/calibrate-pid?fan=${fan}&method=step_response&tau_c=${tauC}`;
-      document.getElementById('status').textContent = 'Starting step-response tuning...';
-      try {
-        const res = await fetch(url, { method: 'POST' });
-        if (res.ok) {
-          document.getElementById('status').textContent = 'Step-response tuning started.';
-          document.getElementById('autotuneSummary').textContent = 'Step-response tuning running...';
-          updateTableHeader('step_response');
-          loadAutotuneStatus();
-          loadAutotuneTrace();
-        } else {
-          const txt = await res.text();
-          document.getElementById('status').textContent = 'Failed to start tuning: ' + txt;
-        }
-      } catch (e) {
-        document.getElementById('status').textContent = 'Failed to start tuning.';
-      }
-    }
-
-    async function cancelAutotune() {
-      document.getElementById('status').textContent = 'Cancelling tuning...';
-      try {
-        const res = await fetch('/api/calibrate-pid/cancel', { method: 'POST' });
-        const txt = await res.text();
-        document.getElementById('status').textContent = res.ok ? 'Tuning cancelled.' : 'Failed to cancel tuning.';
-        if (!res.ok && txt) {
-          document.getElementById('status').textContent += ' ' + txt;
-        }
-        loadAutotuneStatus();
-        loadAutotuneTrace();
-      } catch (e) {
-        document.getElementById('status').textContent = 'Failed to cancel tuning.';
-      }
-    }
-
-    async function loadAutotuneTrace() {
-      try {
-        const res = await fetch('/api/calibrate-pid/trace');
-        const data = await res.json();
-        renderTrace(data.samples || []);
-      } catch (e) {
-        if (!latestTraceSamples.length) {
-          drawTracePlaceholder('Trace unavailable.');
-        }
-      }
-    }
-
-    function updateTableHeader() {
-      const thead = document.getElementById('cycleTableHeader');
-      thead.innerHTML = '<tr><th>Band</th><th>Temp</th><th>Kp (process)</th><th>&tau; (s)</th><th>&theta; (s)</th><th>RMSE</th><th>PID</th></tr>';
-      document.getElementById('autotuneBestLabel').textContent = 'Bands';
-    }
-
-    async function loadAutotuneStatus() {
-      try {
-        const res = await fetch('/api/calibrate-pid/status');
-        const data = await res.json();
-        const model = data.model || {};
-
-        document.getElementById('startAutotuneButton').disabled = !!data.running;
-        document.getElementById('cancelAutotuneButton').disabled = !data.running;
-        document.getElementById('autotunePhase').textContent = data.phase || '--';
-        document.getElementById('autotuneProgress').textContent = `${formatNumber(data.progressPercent, 0)}%`;
-        document.getElementById('autotuneSetpoint').textContent = Number.isFinite(model.currentSetpoint) ? `${formatNumber(model.currentSetpoint, 1)}F` : '--';
-        document.getElementById('autotunePid').textContent = Number.isFinite(model.recommendedKp) ? `Kp ${formatNumber(model.recommendedKp, 2)} Ki ${formatNumber(model.recommendedKi, 3)} Kd ${formatNumber(model.recommendedKd, 2)}` : '--';
-
-        updateTableHeader();
-        document.getElementById('autotuneBest').textContent = `${model.completedBands || 0} / ${model.totalBands || 2}`;
-
-        if (data.running) {
-          document.getElementById('autotuneOutcome').textContent = 'running';
-          document.getElementById('autotuneSummary').textContent = `Step-response tuning in progress. Completed ${model.completedBands || 0} of ${model.totalBands || 2} bands. \u03C4c factor: ${formatNumber(model.tauCFactor, 1)}.`;
-        } else if (data.complete) {
-          document.getElementById('autotuneOutcome').textContent = model.passed ? 'passed' : 'best found';
-          document.getElementById('autotuneSummary').textContent = `Step-response tuning ${model.passed ? 'passed' : 'completed'}: PID Kp ${formatNumber(model.recommendedKp, 2)} Ki ${formatNumber(model.recommendedKi, 3)} Kd ${formatNumber(model.recommendedKd, 2)}, mean RMSE ${formatNumber(model.meanFitRmse, 2)}F.`;
-          if (Number.isFinite(model.recommendedKp) && !pidInputsDirty) {
-            setPidInputs(model.recommendedKp, model.recommendedKi, model.recommendedKd);
-          }
-        } else if (data.lastError === 'cancelled') {
-          document.getElementById('autotuneOutcome').textContent = 'cancelled';
-          document.getElementById('autotuneSummary').textContent = 'Step-response tuning cancelled. Recovery cooling is active.';
-        } else if (data.lastError && data.lastError !== 'none') {
-          document.getElementById('autotuneOutcome').textContent = 'failed';
-          document.getElementById('autotuneSummary').textContent = `Step-response tuning failed: ${data.lastError}.`;
-        } else {
-          document.getElementById('autotuneOutcome').textContent = 'idle';
-        }
-
-        const bands = (model.bands || []).filter(b => b.valid);
-        const rows = bands.map(b => {
-          return `<tr><td>${b.index}</td><td>${formatNumber(b.targetTemp, 0)}F</td><td>${formatNumber(b.processGain, 4)}</td><td>${formatNumber(b.timeConstant, 1)}</td><td>${formatNumber(b.deadTime, 1)}</td><td>${formatNumber(b.fitRmse, 2)}F</td><td class="small">Kp ${formatNumber(b.kp, 2)} Ki ${formatNumber(b.ki, 3)} Kd ${formatNumber(b.kd, 2)}</td></tr>`;
-        });
-        document.getElementById('cycleTableBody').innerHTML = rows.length ? rows.join('') : '<tr><td colspan="7" class="small">No band data yet.</td></tr>';
-      } catch (e) {
-        document.getElementById('autotunePhase').textContent = 'offline';
-        document.getElementById('autotuneOutcome').textContent = 'offline';
-        document.getElementById('startAutotuneButton').disabled = false;
-        document.getElementById('cancelAutotuneButton').disabled = true;
-      }
-    }
-
-    drawTracePlaceholder('Loading trace...');
-  bindPidInputs();
-    loadPid();
-    loadAutotuneStatus();
-    loadAutotuneTrace();
-    setInterval(() => {
-      loadAutotuneStatus();
-      loadAutotuneTrace();
-    }, 1500);
-  </script>
-</body>
-</html>
-)rawliteral");
+    sendWebAsset(request, WEB_ASSET_PID);
   });
 
   // Profile Editor UI
   server.on("/profile", HTTP_GET, [](AsyncWebServerRequest *request) {
     LOG_INFO("Profile Editor UI accessed");
-    request->send_P(200, "text/html", PROFILE_EDITOR_HTML);
+    sendWebAsset(request, WEB_ASSET_PROFILE);
   });
 
   server.on("/systemlink", HTTP_GET, [](AsyncWebServerRequest *request) {
     LOG_INFO("SystemLink config UI accessed");
-    request->send_P(200, "text/html", SYSTEMLINK_CONFIG_HTML);
+    sendWebAsset(request, WEB_ASSET_SYSTEMLINK);
   });
 
   server.addHandler(&otaStateGuardHandler);
@@ -2597,11 +1860,21 @@ String initializeWifi(const WifiCredentials& wifiCredentials) {
   // return WiFi.localIP().toString();
 }
 
-// Send WebSocket message to all connected clients
+// Queue an event for every connected client. Events are never dropped: a
+// client too far behind to take one more is disconnected instead, and
+// reconnects to fresh state.
 void sendWsMessage(String message) {
 #ifdef ARDUINO_ARCH_ESP32
   if (WiFi.status() == WL_CONNECTED) {
-    ws.textAll(message);
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(message.c_str());
+    SharedFrameBuffer::Frame frame = std::make_shared<std::vector<uint8_t>>(bytes, bytes + message.length());
+    forEachConnectedClient([&](AsyncWebSocketClient &client) {
+      if (!wsClientQueues.offerEvent(client.id(), frame)) {
+        LOG_WARNF("WebSocket client #%u dropped: %u events waiting", client.id(), (unsigned)WS_MAX_QUEUED_EVENTS);
+        client.close();
+      }
+    });
+    pumpWebSocketQueues();
   }
 #endif
 }
@@ -0,0 +1,125 @@
+#ifndef SYSTEM_STATE_JSON_HPP
+#define SYSTEM_STATE_JSON_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../support/JsonWriter.hpp"
+#include "../support/PerfStats.hpp"
+
+// The state payload the console polls from /api/state and every WebSocket
+// client gets once a second. Network.hpp copies the live values into a
+// snapshot and the writer lays them out, so the payload can be produced
+// (and tested on the host) without the firmware globals or a heap.
+
+// Room for the payload with six perf timers and the longest fault message
+static constexpr size_t STATE_JSON_CAPACITY = 1536;
+
+struct SystemStateSnapshot {
+  unsigned long timestamp = 0;
+  const char *state = "";
+
+  double currentTemp = 0.0;
+  double setpointTemp = 0.0;
+  double fanTemp = 0.0;
+  double rateOfRise = 0.0;
+
+  int heater = 0;
+  double pidTrim = 0.0;
+  double feedforward = 0.0;
+  int pwmFan = 0;
+  int bdcFan = 0;
+  bool scheduleEnabled = false;
+  int activeBand = -1;
+  const char *heaterMode = "";
+  bool mpcActive = false;
+  bool smithActive = false;
+
+  int progress = 0;
+  int setpointCount = 0;
+  int finalTemp = 0;
+
+  int badReadings = 0;
+  const char *lastRejectedReason = "";
+
+  const char *faultCode = "";
+  const char *faultMessage = "";
+  bool faultCanClear = false;
+
+  uint32_t heapFree = 0;
+  uint32_t heapSize = 0;
+
+  const PerfChannel *const *perfChannels = nullptr;
+  size_t perfChannelCount = 0;
+};
+
+// Writes the payload into `out`. Returns its length, or 0 if it did not
+// fit in `capacity` bytes (which includes a terminating NUL).
+inline size_t writeSystemStateJson(const SystemStateSnapshot &state, char *out, size_t capacity) {
+  JsonWriter json(out, capacity);
+  json.beginObject();
+  json.fieldUInt("timestamp", state.timestamp);
+  json.fieldString("state", state.state);
+  json.fieldUInt("uptime", state.timestamp / 1000);
+
+  json.beginObject("temps");
+  json.fieldFixed("current", state.currentTemp, 1);
+  json.fieldFixed("setpoint", state.setpointTemp, 1);
+  json.fieldFixed("fan", state.fanTemp, 1);
+  json.fieldFixed("ror", state.rateOfRise, 1);
+  json.endObject();
+
+  json.beginObject("control");
+  json.fieldInt("heater", state.heater);
+  json.fieldFixed("pidTrim", state.pidTrim, 1);
+  json.fieldFixed("feedforward", state.feedforward, 1);
+  json.fieldInt("pwmFan", state.pwmFan);
+  json.fieldInt("bdcFan", state.bdcFan);
+  json.fieldBool("scheduleEnabled", state.scheduleEnabled);
+  json.fieldInt("activeBand", state.activeBand);
+  json.fieldString("mode", state.heaterMode);
+  json.fieldBool("mpcActive", state.mpcActive);
+  json.fieldBool("smithActive", state.smithActive);
+  json.endObject();
+
+  json.beginObject("profile");
+  json.fieldInt("progress", state.progress);
+  json.fieldInt("setpointCount", state.setpointCount);
+  json.fieldInt("finalTemp", state.finalTemp);
+  json.endObject();
+
+  json.beginObject("safety");
+  json.fieldInt("badReadings", state.badReadings);
+  json.fieldString("lastRejectedReason", state.lastRejectedReason);
+  json.endObject();
+
+  json.beginObject("fault");
+  json.fieldString("code", state.faultCode);
+  json.fieldString("message", state.faultMessage);
+  json.fieldBool("canClear", state.faultCanClear);
+  json.endObject();
+
+  json.beginObject("memory");
+  json.fieldUInt("heapFree", state.heapFree);
+  json.fieldUInt("heapSize", state.heapSize);
+  json.endObject();
+
+  // Compact timer summary; /api/perf has the full histograms.
+  json.beginObject("perf");
+  for (size_t index = 0; index < state.perfChannelCount; index++) {
+    const PerfChannel &channel = *state.perfChannels[index];
+    json.beginObject(channel.getName());
+    json.fieldUInt("lateP99", channel.getLateness().percentileUs(99));
+    json.fieldUInt("lateMax", channel.getLateness().getMaxUs());
+    json.fieldUInt("runP50", channel.getRuntime().percentileUs(50));
+    json.fieldUInt("runP99", channel.getRuntime().percentileUs(99));
+    json.fieldUInt("runMax", channel.getRuntime().getMaxUs());
+    json.fieldUInt("overruns", channel.getLateness().getOverruns() + channel.getRuntime().getOverruns());
+    json.endObject();
+  }
+  json.endObject();
+
+  json.endObject();
+  return json.overflowed() ? 0 : json.length();
+}
+
+#endif // SYSTEM_STATE_JSON_HPP
@@ -0,0 +1,385 @@
+#ifndef TELEMETRY_STREAM_HPP
+#define TELEMETRY_STREAM_HPP
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "SystemStateJson.hpp"
+#include "../support/Crc32.hpp"
+#include "../support/JsonWriter.hpp"
+#include "../support/PackWriter.hpp"
+#include "../support/StaticMutex.hpp"
+
+// Opt-in telemetry stream on /WebSocket for dashboards that only need
+// what changed. A client sends
+//   {"command":"telemetry","mode":"delta","encoding":"json"|"cbor"|"msgpack"}
+// and from then on gets, instead of the full state JSON each second,
+//   {"t":"k"|"d","seq":n,"ts":millis,"f":{field:value,...}}
+// where a keyframe ("k") carries every field and a delta ("d") only the
+// fields that changed since the previous frame. JSON frames go out as text
+// with the dotted field names below as keys; CBOR and MessagePack frames
+// go out as binary with the field's index as key. The reply to the
+// command lists the names in index order. Keyframes follow the subscribe
+// command, a {"command":"keyframe"} request, and every
+// TELEMETRY_KEYFRAME_INTERVAL frames, so a client that sees a gap in "seq"
+// can resynchronise. {"command":"telemetry","mode":"full"} goes back to
+// the full state JSON, which stays the default for Artisan and the
+// console.
+//
+// Temperatures and other tenths are compared after rounding to 0.1, so
+// noise below the displayed resolution does not count as a change. The
+// perf timers stay on /api/perf and the full state.
+
+static constexpr uint32_t TELEMETRY_KEYFRAME_INTERVAL = 30;
+static constexpr size_t TELEMETRY_JSON_CAPACITY = 1024;
+static constexpr size_t TELEMETRY_BINARY_CAPACITY = 512;
+
+enum TelemetryEncoding : uint8_t {
+  TELEMETRY_JSON,
+  TELEMETRY_CBOR,
+  TELEMETRY_MSGPACK,
+  TELEMETRY_ENCODING_COUNT,
+};
+
+inline const char *telemetryEncodingName(TelemetryEncoding encoding) {
+  switch (encoding) {
+    case TELEMETRY_CBOR: return "cbor";
+    case TELEMETRY_MSGPACK: return "msgpack";
+    default: return "json";
+  }
+}
+
+inline bool parseTelemetryEncoding(const char *name, TelemetryEncoding &encoding) {
+  if (name == nullptr || strcmp(name, "json") == 0) {
+    encoding = TELEMETRY_JSON;
+  } else if (strcmp(name, "cbor") == 0) {
+    encoding = TELEMETRY_CBOR;
+  } else if (strcmp(name, "msgpack") == 0) {
+    encoding = TELEMETRY_MSGPACK;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+enum TelemetryFieldType : uint8_t {
+  TELEMETRY_INT,
+  TELEMETRY_TENTHS,
+  TELEMETRY_BOOL,
+  TELEMETRY_STRING,
+};
+
+struct TelemetryFieldInfo {
+  const char *name;
+  TelemetryFieldType type;
+};
+
+// Field indexes are the binary keys; append new fields at the end.
+enum TelemetryField : uint8_t {
+  TF_STATE,
+  TF_TEMP_CURRENT,
+  TF_TEMP_SETPOINT,
+  TF_TEMP_FAN,
+  TF_TEMP_ROR,
+  TF_HEATER,
+  TF_PID_TRIM,
+  TF_FEEDFORWARD,
+  TF_PWM_FAN,
+  TF_BDC_FAN,
+  TF_SCHEDULE_ENABLED,
+  TF_ACTIVE_BAND,
+  TF_HEATER_MODE,
+  TF_MPC_ACTIVE,
+  TF_SMITH_ACTIVE,
+  TF_PROGRESS,
+  TF_SETPOINT_COUNT,
+  TF_FINAL_TEMP,
+  TF_BAD_READINGS,
+  TF_LAST_REJECTED_REASON,
+  TF_FAULT_CODE,
+  TF_FAULT_MESSAGE,
+  TF_FAULT_CAN_CLEAR,
+  TF_HEAP_FREE,
+  TF_HEAP_SIZE,
+  TELEMETRY_FIELD_COUNT,
+};
+
+static_assert(TELEMETRY_FIELD_COUNT <= 32, "telemetry field masks are 32 bits");
+static constexpr uint32_t TELEMETRY_ALL_FIELDS = (1ULL << TELEMETRY_FIELD_COUNT) - 1;
+
+inline const TelemetryFieldInfo &telemetryFieldInfo(uint8_t field) {
+  static const TelemetryFieldInfo fields[TELEMETRY_FIELD_COUNT] = {
+      {"state", TELEMETRY_STRING},
+      {"temps.current", TELEMETRY_TENTHS},
+      {"temps.setpoint", TELEMETRY_TENTHS},
+      {"temps.fan", TELEMETRY_TENTHS},
+      {"temps.ror", TELEMETRY_TENTHS},
+      {"control.heater", TELEMETRY_INT},
+      {"control.pidTrim", TELEMETRY_TENTHS},
+      {"control.feedforward", TELEMETRY_TENTHS},
+      {"control.pwmFan", TELEMETRY_INT},
+      {"control.bdcFan", TELEMETRY_INT},
+      {"control.scheduleEnabled", TELEMETRY_BOOL},
+      {"control.activeBand", TELEMETRY_INT},
+      {"control.mode", TELEMETRY_STRING},
+      {"control.mpcActive", TELEMETRY_BOOL},
+      {"control.smithActive", TELEMETRY_BOOL},
+      {"profile.progress", TELEMETRY_INT},
+      {"profile.setpointCount", TELEMETRY_INT},
+      {"profile.finalTemp", TELEMETRY_INT},
+      {"safety.badReadings", TELEMETRY_INT},
+      {"safety.lastRejectedReason", TELEMETRY_STRING},
+      {"fault.code", TELEMETRY_STRING},
+      {"fault.message", TELEMETRY_STRING},
+      {"fault.canClear", TELEMETRY_BOOL},
+      {"memory.heapFree", TELEMETRY_INT},
+      {"memory.heapSize", TELEMETRY_INT},
+  };
+  return fields[field];
+}
+
+// One second of state, flattened. `values` holds what a change is judged
+// on: the integer, tenths, 0/1, or a CRC-32 of the text. `strings` points
+// at the snapshot's text, so encode before the snapshot goes away.
+struct TelemetryFrame {
+  static constexpr int32_t MISSING = INT32_MIN;  // NaN tenths; sent as null
+
+  uint32_t seq = 0;
+  unsigned long timestamp = 0;
+  int32_t values[TELEMETRY_FIELD_COUNT] = {};
+  const char *strings[TELEMETRY_FIELD_COUNT] = {};
+};
+
+inline int32_t telemetryTenths(double value) {
+  if (!isfinite(value) || fabs(value) > 2.0e8) {
+    return TelemetryFrame::MISSING;
+  }
+  return static_cast<int32_t>(lround(value * 10.0));
+}
+
+inline void captureTelemetryFrame(const SystemStateSnapshot &state, TelemetryFrame &frame) {
+  frame.timestamp = state.timestamp;
+  int32_t *v = frame.values;
+  const char **s = frame.strings;
+  s[TF_STATE] = state.state;
+  v[TF_TEMP_CURRENT] = telemetryTenths(state.currentTemp);
+  v[TF_TEMP_SETPOINT] = telemetryTenths(state.setpointTemp);
+  v[TF_TEMP_FAN] = telemetryTenths(state.fanTemp);
+  v[TF_TEMP_ROR] = telemetryTenths(state.rateOfRise);
+  v[TF_HEATER] = state.heater;
+  v[TF_PID_TRIM] = telemetryTenths(state.pidTrim);
+  v[TF_FEEDFORWARD] = telemetryTenths(state.feedforward);
+  v[TF_PWM_FAN] = state.pwmFan;
+  v[TF_BDC_FAN] = state.bdcFan;
+  v[TF_SCHEDULE_ENABLED] = state.scheduleEnabled ? 1 : 0;
+  v[TF_ACTIVE_BAND] = state.activeBand;
+  s[TF_HEATER_MODE] = state.heaterMode;
+  v[TF_MPC_ACTIVE] = state.mpcActive ? 1 : 0;
+  v[TF_SMITH_ACTIVE] = state.smithActive ? 1 : 0;
+  v[TF_PROGRESS] = state.progress;
+  v[TF_SETPOINT_COUNT] = state.setpointCount;
+  v[TF_FINAL_TEMP] = state.finalTemp;
+  v[TF_BAD_READINGS] = state.badReadings;
+  s[TF_LAST_REJECTED_REASON] = state.lastRejectedReason;
+  s[TF_FAULT_CODE] = state.faultCode;
+  s[TF_FAULT_MESSAGE] = state.faultMessage;
+  v[TF_FAULT_CAN_CLEAR] = state.faultCanClear ? 1 : 0;
+  v[TF_HEAP_FREE] = static_cast<int32_t>(state.heapFree);
+  v[TF_HEAP_SIZE] = static_cast<int32_t>(state.heapSize);
+
+  for (uint8_t field = 0; field < TELEMETRY_FIELD_COUNT; field++) {
+    if (telemetryFieldInfo(field).type == TELEMETRY_STRING) {
+      const char *text = s[field] ? s[field] : "";
+      s[field] = text;
+      v[field] = static_cast<int32_t>(crc32(reinterpret_cast<const uint8_t *>(text), strlen(text)));
+    }
+  }
+}
+
+// Remembers the last frame broadcast and reports which fields moved
+class TelemetryDeltaTracker {
+ public:
+  // Bit per field that differs from the previous frame; every field on
+  // the first call.
+  uint32_t update(const TelemetryFrame &frame) {
+    uint32_t changed = 0;
+    for (uint8_t field = 0; field < TELEMETRY_FIELD_COUNT; field++) {
+      if (!hasLast || frame.values[field] != last[field]) {
+        changed |= 1UL << field;
+      }
+      last[field] = frame.values[field];
+    }
+    hasLast = true;
+    return changed;
+  }
+
+  void reset() { hasLast = false; }
+
+ private:
+  int32_t last[TELEMETRY_FIELD_COUNT] = {};
+  bool hasLast = false;
+};
+
+inline uint8_t telemetryFieldCount(uint32_t fields) {
+  uint8_t count = 0;
+  for (; fields; fields &= fields - 1) count++;
+  return count;
+}
+
+inline void writeTelemetryValue(JsonWriter &json, const TelemetryFrame &frame, uint8_t field) {
+  const TelemetryFieldInfo &info = telemetryFieldInfo(field);
+  int32_t value = frame.values[field];
+  switch (info.type) {
+    case TELEMETRY_TENTHS:
+      json.fieldFixed(info.name, value == TelemetryFrame::MISSING ? NAN : value / 10.0, 1);
+      break;
+    case TELEMETRY_BOOL: json.fieldBool(info.name, value != 0); break;
+    case TELEMETRY_STRING: json.fieldString(info.name, frame.strings[field]); break;
+    default: json.fieldInt(info.name, value); break;
+  }
+}
+
+inline void writeTelemetryValue(PackWriter &pack, const TelemetryFrame &frame, uint8_t field) {
+  int32_t value = frame.values[field];
+  pack.writeUInt(field);
+  switch (telemetryFieldInfo(field).type) {
+    case TELEMETRY_TENTHS:
+      if (value == TelemetryFrame::MISSING) {
+        pack.writeNull();
+      } else {
+        pack.writeFloat(static_cast<float>(value) / 10.0f);
+      }
+      break;
+    case TELEMETRY_BOOL: pack.writeBool(value != 0); break;
+    case TELEMETRY_STRING: pack.writeString(frame.strings[field]); break;
+    default: pack.writeInt(value); break;
+  }
+}
+
+// Encodes `fields` of `frame` as a keyframe or delta. Returns the length,
+// or 0 if it did not fit.
+inline size_t encodeTelemetryFrame(const TelemetryFrame &frame, uint32_t fields, bool keyframe,
+                                   TelemetryEncoding encoding, uint8_t *out, size_t capacity) {
+  if (keyframe) fields = TELEMETRY_ALL_FIELDS;
+  if (encoding == TELEMETRY_JSON) {
+    JsonWriter json(reinterpret_cast<char *>(out), capacity);
+    json.beginObject();
+    json.fieldString("t", keyframe ? "k" : "d");
+    json.fieldUInt("seq", frame.seq);
+    json.fieldUInt("ts", frame.timestamp);
+    json.beginObject("f");
+    for (uint8_t field = 0; field < TELEMETRY_FIELD_COUNT; field++) {
+      if (fields & (1UL << field)) writeTelemetryValue(json, frame, field);
+    }
+    json.endObject();
+    json.endObject();
+    return json.overflowed() ? 0 : json.length();
+  }
+
+  PackWriter pack(encoding == TELEMETRY_CBOR ? PackWriter::FORMAT_CBOR : PackWriter::FORMAT_MSGPACK, out, capacity);
+  pack.beginMap(4);
+  pack.writeString("t");
+  pack.writeString(keyframe ? "k" : "d");
+  pack.writeString("seq");
+  pack.writeUInt(frame.seq);
+  pack.writeString("ts");
+  pack.writeUInt(static_cast<uint32_t>(frame.timestamp));
+  pack.writeString("f");
+  pack.beginMap(telemetryFieldCount(fields));
+  for (uint8_t field = 0; field < TELEMETRY_FIELD_COUNT; field++) {
+    if (fields & (1UL << field)) writeTelemetryValue(pack, frame, field);
+  }
+  return pack.overflowed() ? 0 : pack.length();
+}
+
+// Reply to the telemetry command:
+// {"telemetry":{"mode","encoding","keyframeInterval","fields":[names]}}
+inline size_t writeTelemetryAck(bool delta, TelemetryEncoding encoding, char *out, size_t capacity) {
+  JsonWriter json(out, capacity);
+  json.beginObject();
+  json.beginObject("telemetry");
+  json.fieldString("mode", delta ? "delta" : "full");
+  if (delta) {
+    json.fieldString("encoding", telemetryEncodingName(encoding));
+    json.fieldUInt("keyframeInterval", TELEMETRY_KEYFRAME_INTERVAL);
+    json.beginArray("fields");
+    for (uint8_t field = 0; field < TELEMETRY_FIELD_COUNT; field++) {
+      json.elementString(telemetryFieldInfo(field).name);
+    }
+    json.endArray();
+  }
+  json.endObject();
+  json.endObject();
+  return json.overflowed() ? 0 : json.length();
+}
+
+// Clients on the telemetry stream. Commands arrive on the web server task
+// and broadcasts run from loop(), so the broadcast works from a copy.
+class TelemetrySubscribers {
+ public:
+  static constexpr size_t MAX_SUBSCRIBERS = 8;
+
+  struct Subscriber {
+    uint32_t clientId;
+    TelemetryEncoding encoding;
+    bool needsKeyframe;
+  };
+
+  // False when every slot is taken
+  bool subscribe(uint32_t clientId, TelemetryEncoding encoding) {
+    Lock lock;
+    int index = find(clientId);
+    if (index < 0) {
+      if (count >= MAX_SUBSCRIBERS) return false;
+      index = static_cast<int>(count++);
+    }
+    subscribers[index] = Subscriber{clientId, encoding, true};
+    return true;
+  }
+
+  void unsubscribe(uint32_t clientId) {
+    Lock lock;
+    int index = find(clientId);
+    if (index < 0) return;
+    subscribers[index] = subscribers[--count];
+  }
+
+  bool requestKeyframe(uint32_t clientId) {
+    Lock lock;
+    int index = find(clientId);
+    if (index < 0) return false;
+    subscribers[index].needsKeyframe = true;
+    return true;
+  }
+
+  // Copies the subscribers into `out` and clears their keyframe requests
+  size_t take(Subscriber *out) {
+    Lock lock;
+    for (size_t i = 0; i < count; i++) {
+      out[i] = subscribers[i];
+      subscribers[i].needsKeyframe = false;
+    }
+    return count;
+  }
+
+  size_t size() {
+    Lock lock;
+    return count;
+  }
+
+ private:
+  using Lock = StaticMutexLock<TelemetrySubscribers>;
+
+  Subscriber subscribers[MAX_SUBSCRIBERS] = {};
+  size_t count = 0;
+
+  int find(uint32_t clientId) const {
+    for (size_t i = 0; i < count; i++) {
+      if (subscribers[i].clientId == clientId) return static_cast<int>(i);
+    }
+    return -1;
+  }
+};
+
+#endif // TELEMETRY_STREAM_HPP
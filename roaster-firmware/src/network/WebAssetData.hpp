@@ -0,0 +1,1346 @@
+// Generated by tools/embed-web-assets.py from web/. Do not edit;
+// change the page and rerun the script (./tools/firmware.sh build does).
+
+#ifndef WEB_ASSET_DATA_HPP
+#define WEB_ASSET_DATA_HPP
+
+#include "WebAssets.hpp"
+
+// web/console.html: 27016 bytes, 6599 gzipped
+static const uint8_t WEB_ASSET_CONSOLE_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x3d, 0x69, 0x77, 0xdb, 0x46, 0x92, 0xdf, 0xe7, 0x57,
+  0x74, 0x38, 0x76, 0x48, 0x26, 0x3c, 0x40, 0x8a, 0x94, 0x75, 0x51, 0x19, 0x59, 0xb6, 0x27, 0xde, 0xf8, 0x1a, 0xcb, 0xde,
+  0x4c, 0x36, 0x2f, 0x6f, 0x0c, 0x02, 0x4d, 0x12, 0x63, 0x10, 0x60, 0x00, 0xd0, 0x94, 0xc6, 0xa3, 0xff, 0x34, 0x5f, 0xf6,
+  0x0f, 0xcc, 0x2f, 0xdb, 0xaa, 0xbe, 0xd0, 0xdd, 0x68, 0x90, 0x94, 0x8f, 0xb7, 0x6f, 0xdf, 0xda, 0x89, 0x04, 0xf6, 0x51,
+  0x5d, 0x5d, 0x77, 0x55, 0x37, 0xe8, 0xb3, 0x6f, 0x1e, 0xbd, 0xbc, 0x7c, 0xf3, 0xcb, 0xab, 0xc7, 0x64, 0x51, 0x2c, 0xe3,
+  0xf3, 0x3f, 0x9c, 0xe1, 0x2f, 0x12, 0xfb, 0xc9, 0x7c, 0xd2, 0xa0, 0x49, 0x03, 0x1b, 0xa8, 0x1f, 0x9e, 0xff, 0x81, 0x90,
+  0xb3, 0x25, 0x2d, 0x7c, 0x12, 0x2c, 0xfc, 0x2c, 0xa7, 0xc5, 0xa4, 0xf1, 0xf6, 0xcd, 0x93, 0xee, 0x51, 0xa3, 0xec, 0x48,
+  0xfc, 0x25, 0x9d, 0x34, 0x3e, 0x44, 0x74, 0xb3, 0x4a, 0xb3, 0xa2, 0x41, 0x82, 0x34, 0x29, 0x68, 0x02, 0x03, 0x37, 0x51,
+  0x58, 0x2c, 0x26, 0x21, 0xfd, 0x10, 0x05, 0xb4, 0xcb, 0x3e, 0x74, 0x48, 0x94, 0x44, 0x45, 0xe4, 0xc7, 0xdd, 0x3c, 0xf0,
+  0x63, 0x3a, 0x19, 0xf4, 0x3c, 0x0e, 0xa8, 0x88, 0x8a, 0x98, 0x9e, 0xbf, 0x4e, 0xfd, 0xbc, 0xa0, 0x19, 0x79, 0x44, 0xa7,
+  0xeb, 0x39, 0xb9, 0x4c, 0x93, 0x3c, 0x8d, 0xe9, 0x59, 0x9f, 0x77, 0xe2, 0xb0, 0xbc, 0xb8, 0xe1, 0x4f, 0x84, 0x7c, 0x47,
+  0x3e, 0x92, 0xa5, 0x9f, 0xcd, 0xa3, 0xe4, 0x84, 0x78, 0xa7, 0x64, 0xe5, 0x87, 0x61, 0x94, 0xcc, 0xd9, 0xf3, 0x34, 0xbd,
+  0xee, 0xe6, 0xd1, 0x3f, 0xd8, 0xc7, 0x69, 0x9a, 0x85, 0x34, 0xeb, 0x42, 0xd3, 0x29, 0xb9, 0x65, 0x13, 0xa7, 0x69, 0x78,
+  0x43, 0x3e, 0xb2, 0x47, 0x42, 0x66, 0x80, 0x6b, 0x77, 0xe6, 0x2f, 0xa3, 0xf8, 0xe6, 0x84, 0x34, 0xaf, 0xe8, 0x3c, 0xa5,
+  0xe4, 0xed, 0xd3, 0x66, 0x87, 0x3c, 0x85, 0x3d, 0x64, 0x1d, 0xd2, 0xf5, 0x57, 0xab, 0x98, 0x76, 0xf3, 0x1b, 0xc0, 0x6b,
+  0xd9, 0x21, 0xb9, 0x9f, 0xe4, 0xdd, 0x9c, 0x66, 0xd1, 0xec, 0x54, 0x00, 0x98, 0xfa, 0xc1, 0xfb, 0x79, 0x96, 0xae, 0x93,
+  0xf0, 0x84, 0xfc, 0xf1, 0x80, 0xfd, 0x91, 0x5d, 0x41, 0x1a, 0xa7, 0x19, 0xb4, 0x3e, 0x61, 0x7f, 0x64, 0xab, 0x42, 0x74,
+  0xe8, 0xad, 0xae, 0x65, 0x63, 0x1c, 0x25, 0xb4, 0xbb, 0xa0, 0xd1, 0x7c, 0x51, 0x9c, 0x90, 0x41, 0x6f, 0xcc, 0xdb, 0x39,
+  0xbe, 0xbd, 0x22, 0x5d, 0x25, 0xfe, 0x07, 0x85, 0xf2, 0xd2, 0xbf, 0xe6, 0xc4, 0x84, 0x91, 0x23, 0x4f, 0x03, 0xa2, 0xa8,
+  0x41, 0xfc, 0x75, 0x91, 0x1a, 0xf0, 0xd5, 0xa2, 0x83, 0x51, 0xd9, 0x18, 0x46, 0xf9, 0x2a, 0xf6, 0x61, 0xdf, 0xb3, 0x98,
+  0xaa, 0x46, 0x7c, 0xee, 0x6e, 0x32, 0x7f, 0x75, 0x42, 0xf0, 0xa7, 0x6c, 0x9e, 0x63, 0xc3, 0x40, 0x83, 0x68, 0xec, 0x7b,
+  0xf8, 0x08, 0xff, 0xaa, 0x2e, 0x49, 0xf2, 0xa2, 0x48, 0x97, 0xb0, 0xcf, 0xd5, 0x35, 0x01, 0x3e, 0x46, 0x21, 0xf9, 0xe3,
+  0x68, 0x34, 0x92, 0x83, 0xfc, 0x38, 0x9a, 0x27, 0xdd, 0x08, 0xa8, 0x9a, 0x9f, 0x90, 0x80, 0x22, 0xb5, 0x1d, 0x9b, 0xee,
+  0xc6, 0xe9, 0x3c, 0x55, 0x3b, 0x77, 0x22, 0x5c, 0x0b, 0xc8, 0x81, 0x34, 0xa7, 0x50, 0x37, 0xe3, 0x74, 0x46, 0x2a, 0x9d,
+  0xea, 0x72, 0xb0, 0x11, 0x0c, 0x38, 0xf6, 0x3c, 0xa3, 0x1d, 0x64, 0x89, 0x9a, 0xfc, 0x92, 0xac, 0xf5, 0xbc, 0xe3, 0xe3,
+  0x72, 0x4f, 0x05, 0xbd, 0x2e, 0xba, 0x45, 0x06, 0x32, 0x32, 0x4b, 0x33, 0xd8, 0xf9, 0x7a, 0xb5, 0xa2, 0x59, 0xe0, 0xe7,
+  0x54, 0xb1, 0x99, 0x16, 0x80, 0x5e, 0x37, 0x5f, 0xf9, 0x01, 0xe7, 0x86, 0x84, 0x68, 0x72, 0xda, 0xaf, 0xee, 0x38, 0x4a,
+  0x98, 0x88, 0xec, 0xb9, 0xf1, 0xbf, 0xaf, 0xf3, 0x22, 0x9a, 0xdd, 0x74, 0x85, 0x26, 0xda, 0xdd, 0x4b, 0xa0, 0x81, 0x94,
+  0x20, 0xcf, 0x29, 0x25, 0xc8, 0xb3, 0xc1, 0xa1, 0xc6, 0x6d, 0xce, 0xd2, 0xcc, 0x0f, 0xa3, 0x75, 0x8e, 0x3a, 0xe6, 0x94,
+  0xfe, 0x0b, 0xfc, 0x6b, 0x93, 0xe8, 0x92, 0xfd, 0x31, 0x48, 0x14, 0xd2, 0x20, 0xcd, 0xfc, 0x22, 0x4a, 0x41, 0x58, 0x93,
+  0x34, 0xa1, 0x4e, 0x26, 0x3c, 0x28, 0x99, 0xb0, 0x93, 0xae, 0x1a, 0x97, 0x74, 0x01, 0x67, 0x53, 0x22, 0xbe, 0x8e, 0xd7,
+  0x1b, 0xe6, 0x4e, 0x5a, 0x9f, 0x2c, 0xd2, 0x0f, 0x60, 0x72, 0x3e, 0x9a, 0x7b, 0x19, 0xb1, 0x3f, 0xa7, 0xba, 0x0e, 0x9f,
+  0xda, 0x33, 0x7b, 0x7e, 0x50, 0x44, 0x1f, 0xa8, 0x3d, 0x55, 0xc8, 0x84, 0x9a, 0x3a, 0x9b, 0xcd, 0xd4, 0xd4, 0x95, 0x3f,
+  0xa7, 0x77, 0x55, 0xe4, 0x8a, 0xba, 0xce, 0xb3, 0x28, 0x54, 0x22, 0x0e, 0xcf, 0x5d, 0x10, 0x01, 0xe8, 0x29, 0x28, 0xf0,
+  0x3b, 0x5e, 0x2f, 0x13, 0x60, 0x10, 0x70, 0x18, 0xa0, 0xb7, 0xbc, 0x0e, 0x19, 0xcc, 0xb2, 0xb6, 0xa9, 0x0f, 0x47, 0x96,
+  0xd0, 0xa1, 0x95, 0x47, 0x02, 0xec, 0xab, 0xd8, 0x26, 0xcf, 0x84, 0x64, 0x00, 0x4d, 0x4e, 0xc8, 0xa8, 0xd4, 0x74, 0x53,
+  0x31, 0x4a, 0x9b, 0x37, 0x72, 0x2f, 0xbe, 0x18, 0x98, 0x16, 0x59, 0x68, 0xdc, 0x51, 0x49, 0x93, 0x3a, 0x05, 0xd5, 0xa9,
+  0xbc, 0xaf, 0xb8, 0x08, 0x33, 0x20, 0x0d, 0x54, 0x0d, 0x41, 0x7a, 0xf9, 0x7a, 0xca, 0x3c, 0x8f, 0x42, 0x4d, 0xae, 0x75,
+  0x71, 0x71, 0xb1, 0x43, 0xf2, 0x3e, 0xcd, 0x52, 0x69, 0x0a, 0x57, 0x63, 0x86, 0x0d, 0x2a, 0x4c, 0xd3, 0x38, 0x34, 0x10,
+  0xcf, 0x0b, 0xbf, 0x58, 0xe7, 0xdd, 0xa9, 0x1f, 0x6a, 0x52, 0xf6, 0x89, 0x26, 0x84, 0x61, 0x74, 0xe8, 0xb0, 0x0d, 0xc8,
+  0x64, 0xb4, 0x0f, 0x6e, 0x47, 0xc0, 0xfe, 0xd8, 0xf2, 0x32, 0x70, 0x7a, 0x80, 0x3a, 0x9b, 0xa2, 0x93, 0x74, 0x58, 0x23,
+  0x00, 0xfb, 0x1b, 0x07, 0x93, 0x34, 0x61, 0x5a, 0x28, 0xc2, 0x08, 0xd5, 0xd3, 0x64, 0x4c, 0x3a, 0xe0, 0xa3, 0x5a, 0xc3,
+  0x37, 0xf6, 0xee, 0xbb, 0x4d, 0xdf, 0x6c, 0x7a, 0x3c, 0x56, 0x28, 0xf9, 0x49, 0xb4, 0x14, 0xe6, 0x6d, 0xb5, 0x8e, 0x73,
+  0x4a, 0x86, 0x39, 0xa1, 0x80, 0x51, 0x17, 0x84, 0x2e, 0x5d, 0x17, 0xc0, 0x89, 0x19, 0x86, 0x41, 0x06, 0x86, 0x7f, 0x7a,
+  0x4f, 0x6f, 0x66, 0x19, 0x44, 0x52, 0xb9, 0x98, 0x23, 0xd1, 0xf4, 0xee, 0x77, 0xd0, 0x4a, 0xdf, 0x07, 0x33, 0x93, 0xa2,
+  0xdf, 0x28, 0x80, 0x95, 0x03, 0x69, 0x50, 0x08, 0x62, 0xa4, 0xf7, 0x78, 0x10, 0x3b, 0x88, 0x3e, 0xb1, 0x73, 0xb4, 0x10,
+  0x55, 0x61, 0xd8, 0xc3, 0x86, 0x64, 0x74, 0x45, 0xfd, 0xa2, 0x85, 0x26, 0xa8, 0x3b, 0x8b, 0x8a, 0x8e, 0x34, 0x2a, 0x07,
+  0xe8, 0x08, 0xb9, 0x61, 0xd9, 0x61, 0x59, 0x98, 0xb5, 0x3b, 0x27, 0xdf, 0x75, 0x34, 0x4c, 0xce, 0x31, 0x70, 0xab, 0xfa,
+  0x21, 0xcf, 0x98, 0x18, 0xf8, 0x59, 0xf8, 0x85, 0x0d, 0xd2, 0xc8, 0x65, 0x8d, 0x3c, 0x0b, 0x61, 0x5c, 0xb7, 0x6b, 0xea,
+  0xbc, 0x2e, 0x8d, 0x87, 0x35, 0xd2, 0x78, 0x54, 0x4a, 0xa3, 0x65, 0x5a, 0xf4, 0x29, 0x0e, 0x4b, 0xf5, 0x49, 0x66, 0x42,
+  0x93, 0xce, 0xfd, 0x64, 0xbf, 0xdc, 0xd5, 0xc9, 0xc9, 0x94, 0xc2, 0x48, 0xdd, 0xa2, 0x89, 0x00, 0xa1, 0xd9, 0x3c, 0x35,
+  0xd5, 0x62, 0x54, 0x55, 0x0b, 0x23, 0x20, 0x70, 0x78, 0xbc, 0xad, 0x7a, 0x2d, 0x70, 0x81, 0x84, 0x21, 0x8b, 0x82, 0x6e,
+  0x96, 0x6e, 0xb6, 0x47, 0x75, 0x95, 0x08, 0x06, 0x63, 0x26, 0xda, 0x9d, 0xd2, 0x62, 0x43, 0x69, 0x52, 0x0d, 0x58, 0x80,
+  0x93, 0x5a, 0x54, 0x62, 0x06, 0xa0, 0x2e, 0xf3, 0x53, 0x41, 0xe7, 0x24, 0x86, 0xd4, 0xa3, 0x1b, 0x2c, 0xa2, 0x58, 0x93,
+  0x3c, 0x13, 0x4e, 0x29, 0x65, 0xe6, 0xec, 0xd8, 0x9f, 0xd2, 0x78, 0x5f, 0x27, 0x71, 0xf0, 0xa5, 0x2c, 0x9a, 0x58, 0xfc,
+  0x83, 0x1f, 0xaf, 0x2d, 0x69, 0xdd, 0x1e, 0xc6, 0xba, 0x44, 0xd2, 0xcc, 0x50, 0xcc, 0x9c, 0xe8, 0x32, 0x5d, 0x67, 0x11,
+  0xb8, 0xc3, 0x17, 0x74, 0x03, 0x69, 0xd1, 0x32, 0x4d, 0x52, 0xc6, 0x8a, 0x5a, 0x5c, 0x7a, 0x31, 0xa8, 0x80, 0x53, 0x7f,
+  0x0e, 0x86, 0xdb, 0x03, 0x68, 0x17, 0xb0, 0x8d, 0x9f, 0x25, 0x15, 0xd2, 0xce, 0xbc, 0xa3, 0xa3, 0x83, 0x2d, 0x18, 0xd0,
+  0x2c, 0x4b, 0xb3, 0xea, 0xac, 0xa3, 0xf1, 0x60, 0x74, 0x6c, 0xcc, 0x9a, 0xfb, 0xeb, 0x39, 0x65, 0x32, 0xe6, 0x83, 0x6b,
+  0x2c, 0xa7, 0xac, 0x52, 0x19, 0x36, 0x66, 0x14, 0x8c, 0x22, 0x04, 0x79, 0x96, 0x76, 0xa0, 0x41, 0xae, 0xa8, 0xc7, 0xd0,
+  0x11, 0xc2, 0x21, 0xb5, 0x2d, 0x15, 0x60, 0x8b, 0xda, 0x5e, 0xc8, 0x09, 0x50, 0xb5, 0x19, 0xe8, 0x9a, 0x1c, 0x2f, 0x51,
+  0xf5, 0xa7, 0x20, 0xe4, 0xeb, 0x42, 0xa1, 0xca, 0x2c, 0xa0, 0xe6, 0xb0, 0x62, 0x3a, 0x2b, 0x8c, 0x06, 0x4d, 0xc4, 0xd8,
+  0x23, 0x9a, 0xff, 0x56, 0x77, 0x8c, 0x0e, 0x07, 0x7f, 0xb6, 0x4f, 0xef, 0x10, 0x91, 0x3d, 0xd8, 0x12, 0x91, 0x19, 0xd8,
+  0x9b, 0xca, 0xc2, 0x44, 0x9d, 0x19, 0x3c, 0xdb, 0xd4, 0x49, 0x28, 0x47, 0xd3, 0xe3, 0xd1, 0x31, 0xdd, 0xa1, 0x49, 0xc2,
+  0xea, 0xb2, 0x1d, 0x57, 0x9d, 0x50, 0xa2, 0x2d, 0xf8, 0xc9, 0xd1, 0x8a, 0x91, 0x1b, 0x19, 0x0b, 0x40, 0x8a, 0xea, 0x10,
+  0xa1, 0x2f, 0x1e, 0x16, 0x39, 0x10, 0xe0, 0x29, 0x84, 0x14, 0x17, 0x23, 0x85, 0xc0, 0x9c, 0x66, 0x16, 0xa7, 0x9b, 0xee,
+  0x8d, 0x23, 0xcf, 0xdd, 0x4f, 0xb7, 0x6b, 0xa8, 0xad, 0xed, 0x1a, 0x18, 0x96, 0x95, 0xa5, 0x14, 0x85, 0x20, 0x8a, 0xfc,
+  0x51, 0x55, 0x15, 0x86, 0x0e, 0x13, 0x5d, 0xd9, 0xa5, 0xd3, 0x19, 0xf0, 0xe8, 0x62, 0x58, 0x89, 0xca, 0xb8, 0x44, 0x1f,
+  0x28, 0x32, 0x32, 0x29, 0x5e, 0xf9, 0x19, 0xe0, 0xb5, 0xb3, 0x4c, 0x61, 0x6f, 0xa3, 0xf7, 0xe8, 0xf1, 0xc3, 0xb7, 0x7f,
+  0xc6, 0x5c, 0xae, 0x84, 0xdd, 0xb5, 0x84, 0xb0, 0x3a, 0xe9, 0xe9, 0x8b, 0x27, 0x2f, 0x6b, 0xe6, 0xc8, 0x34, 0xb0, 0x32,
+  0xe7, 0xe7, 0x8b, 0xd7, 0x2f, 0x6a, 0xe6, 0x08, 0xc3, 0x56, 0x9d, 0xf3, 0xf8, 0xf5, 0xeb, 0x97, 0xaf, 0xeb, 0x26, 0x71,
+  0xbb, 0x66, 0x6c, 0x35, 0x9b, 0x4f, 0xfd, 0xd6, 0x70, 0x74, 0xd4, 0x21, 0x47, 0x83, 0x0e, 0x79, 0x70, 0xd0, 0x81, 0xc0,
+  0x70, 0xd0, 0x36, 0x00, 0x17, 0xd1, 0x72, 0x6b, 0x66, 0xa3, 0x05, 0x67, 0x47, 0x9e, 0x83, 0xf9, 0x31, 0xfd, 0xa0, 0xe9,
+  0x95, 0x36, 0x7a, 0xec, 0xed, 0xb2, 0x11, 0x36, 0x14, 0x45, 0xfb, 0x2d, 0xf4, 0xe6, 0x03, 0x05, 0xbd, 0xb7, 0xd0, 0x98,
+  0x8f, 0x13, 0x34, 0xde, 0x42, 0x57, 0x3e, 0x4e, 0xd2, 0xd5, 0xa6, 0xa5, 0x36, 0x10, 0x22, 0xf2, 0x5c, 0xcf, 0xda, 0x6b,
+  0x7c, 0x26, 0x88, 0x2b, 0xc6, 0xe5, 0x46, 0xdc, 0x05, 0x9b, 0xcf, 0xd2, 0x38, 0xdf, 0x1e, 0xe9, 0x54, 0x84, 0xdb, 0x0e,
+  0x21, 0x87, 0x3b, 0xb2, 0x42, 0xb1, 0xda, 0xb4, 0x48, 0xaa, 0xaa, 0x58, 0x2d, 0xe4, 0x38, 0x8a, 0x1c, 0x5b, 0x82, 0x69,
+  0x47, 0xcc, 0x5a, 0xa7, 0xb9, 0xc1, 0x3a, 0xcb, 0x71, 0xec, 0x2a, 0x8d, 0x74, 0x3b, 0x5e, 0x93, 0x20, 0x7f, 0x72, 0xa9,
+  0x67, 0x6b, 0x4d, 0x07, 0x68, 0x20, 0xcb, 0x39, 0xae, 0xfd, 0x8e, 0xd9, 0x1f, 0x7b, 0x86, 0x2a, 0xe3, 0xec, 0x0e, 0x6d,
+  0xeb, 0x5c, 0xdb, 0x6c, 0x1d, 0xc7, 0x5c, 0xfc, 0x15, 0x14, 0x96, 0x54, 0xf1, 0x5c, 0x0a, 0x76, 0x4e, 0xfa, 0xa4, 0x6b,
+  0x08, 0xc7, 0x9f, 0x96, 0x34, 0x8c, 0x7c, 0xd2, 0xd2, 0x6a, 0x40, 0x0f, 0x0e, 0xc1, 0x68, 0xb6, 0x15, 0x00, 0x33, 0x71,
+  0xab, 0xcd, 0xd2, 0x20, 0x0d, 0x93, 0xd8, 0xc9, 0x94, 0xd0, 0x51, 0x54, 0x31, 0x9d, 0xb8, 0x26, 0x51, 0xb7, 0xdb, 0x71,
+  0x1a, 0xa1, 0xea, 0xb7, 0xb5, 0x80, 0x58, 0x2b, 0x9d, 0xd7, 0xb8, 0x24, 0x85, 0x85, 0x55, 0xb6, 0xae, 0x19, 0x5e, 0x4d,
+  0x6a, 0x2c, 0x00, 0x66, 0x09, 0xd8, 0x19, 0x30, 0xd9, 0x85, 0x5d, 0xaf, 0xec, 0xd8, 0x51, 0x09, 0x35, 0xe5, 0xb3, 0x1e,
+  0x09, 0xad, 0x24, 0xab, 0x74, 0x1d, 0xfe, 0x06, 0x7e, 0x1c, 0xb4, 0x30, 0x03, 0xef, 0xe2, 0x06, 0xda, 0x1a, 0x3e, 0x95,
+  0xcc, 0xd6, 0xa1, 0x96, 0x9e, 0x4e, 0x85, 0x9a, 0xaa, 0x87, 0xc5, 0xd3, 0x8e, 0xfc, 0x68, 0x64, 0xc8, 0x3a, 0xe4, 0xc3,
+  0xda, 0xb9, 0x65, 0x41, 0xab, 0x84, 0x22, 0x2c, 0x94, 0x6a, 0x28, 0xf3, 0x21, 0xd5, 0x54, 0x75, 0xf4, 0x5b, 0x58, 0xb6,
+  0xe7, 0x7c, 0x66, 0xc7, 0xc2, 0x28, 0xa3, 0x01, 0x57, 0x64, 0x2e, 0xcd, 0x25, 0x31, 0x8c, 0x14, 0x98, 0x0d, 0xce, 0x0b,
+  0x3f, 0x2b, 0x2a, 0xcb, 0x49, 0x3f, 0x66, 0x2c, 0x66, 0x3a, 0x26, 0x37, 0x2f, 0x14, 0x04, 0x57, 0x48, 0x6d, 0x2a, 0xcb,
+  0xc8, 0xa5, 0x2c, 0x67, 0x7d, 0x71, 0x12, 0x75, 0xd6, 0xe7, 0x87, 0x64, 0x67, 0xa8, 0x1a, 0xec, 0x88, 0x0a, 0xa5, 0x25,
+  0x80, 0x64, 0x32, 0x9f, 0x34, 0xb8, 0xec, 0x34, 0xf8, 0x79, 0xd5, 0x59, 0x18, 0x59, 0x1d, 0x4c, 0xb2, 0x45, 0x2f, 0x9e,
+  0x6d, 0x7d, 0x98, 0x73, 0xe1, 0x9e, 0x34, 0x86, 0xa3, 0x86, 0xc8, 0x02, 0xf8, 0x33, 0x9e, 0xad, 0x3d, 0x4c, 0xaf, 0x27,
+  0x0d, 0x8f, 0x78, 0x80, 0x11, 0xc1, 0xb6, 0x59, 0x14, 0xc7, 0x93, 0x06, 0x1a, 0xeb, 0x06, 0xb9, 0x5e, 0xc6, 0x09, 0x80,
+  0x5d, 0x14, 0xc5, 0xea, 0xa4, 0xdf, 0xdf, 0x6c, 0x36, 0xbd, 0xcd, 0x41, 0x2f, 0xcd, 0xe6, 0xfd, 0xa1, 0xe7, 0x79, 0x7d,
+  0x00, 0xac, 0x56, 0x81, 0x75, 0x56, 0x3e, 0x98, 0xa9, 0x70, 0xd2, 0x78, 0x3e, 0xea, 0x8d, 0x3b, 0x03, 0x8f, 0x5c, 0x0e,
+  0xf1, 0xf7, 0x98, 0x1c, 0x77, 0x06, 0x0f, 0x40, 0xf6, 0xf0, 0xe7, 0xe5, 0x60, 0x8c, 0xbf, 0x86, 0x03, 0xde, 0x33, 0x38,
+  0x16, 0x23, 0x07, 0x0f, 0xe0, 0x01, 0x3e, 0x0f, 0x3a, 0x07, 0xe4, 0x08, 0xfe, 0xbf, 0x1c, 0xc3, 0x8f, 0x43, 0xd6, 0x26,
+  0x80, 0xfd, 0x97, 0x44, 0x4c, 0x58, 0xce, 0x06, 0xe9, 0xbb, 0x96, 0x66, 0x63, 0xff, 0x82, 0x8b, 0x8d, 0x00, 0x7a, 0xe7,
+  0xb8, 0x41, 0x72, 0x10, 0xc4, 0xf7, 0x14, 0xe6, 0xf1, 0x20, 0x4d, 0x36, 0x74, 0x05, 0x45, 0x00, 0x13, 0x73, 0xcb, 0x4e,
+  0xb0, 0xb0, 0x85, 0x23, 0xf2, 0x97, 0xa3, 0xce, 0xd0, 0x03, 0xed, 0xea, 0x0c, 0x87, 0x1a, 0x58, 0x89, 0x8e, 0x09, 0x76,
+  0x68, 0x02, 0x15, 0x9d, 0x58, 0x27, 0x0d, 0xfc, 0xd5, 0xa4, 0xc1, 0xbc, 0x40, 0xcd, 0x5a, 0x88, 0xfc, 0x31, 0xec, 0x61,
+  0xd0, 0x19, 0x82, 0x29, 0x38, 0xe8, 0x0c, 0x0f, 0xbe, 0xea, 0x6a, 0x63, 0xb6, 0xb5, 0xc1, 0x88, 0xed, 0xed, 0xf0, 0x2b,
+  0xec, 0xed, 0x0c, 0xe5, 0x44, 0x7e, 0x90, 0x07, 0xb1, 0x97, 0xdc, 0x40, 0x70, 0x01, 0xee, 0x83, 0x04, 0x0b, 0x59, 0xf6,
+  0xa5, 0x24, 0x73, 0xdf, 0x09, 0xd2, 0x9a, 0xd1, 0xd9, 0xa4, 0xd1, 0x6f, 0x9c, 0xab, 0x43, 0x5b, 0x5f, 0x0d, 0x15, 0x7d,
+  0xab, 0x2c, 0x05, 0x7c, 0x68, 0xe3, 0xfc, 0x15, 0x7f, 0xc8, 0x5d, 0x63, 0xa2, 0x10, 0xfa, 0x9f, 0x3e, 0x72, 0x74, 0xad,
+  0x57, 0x21, 0x38, 0xbe, 0xc6, 0xf9, 0x5b, 0xf6, 0xdb, 0x31, 0x80, 0x9f, 0xd1, 0xc2, 0xfe, 0xde, 0x37, 0xce, 0xaf, 0xd8,
+  0xf3, 0x33, 0x78, 0x16, 0x03, 0xcf, 0xfa, 0xa0, 0x70, 0xec, 0x41, 0x53, 0x43, 0xac, 0x4f, 0x3a, 0xb4, 0x93, 0x9b, 0xcb,
+  0x52, 0x31, 0x17, 0x83, 0xba, 0x83, 0x69, 0xe8, 0x91, 0x83, 0xb4, 0xf9, 0xd2, 0xcc, 0xea, 0x4a, 0x07, 0x69, 0x49, 0xa2,
+  0xfa, 0xb5, 0x32, 0xbd, 0x36, 0xc6, 0x3d, 0x2a, 0x4c, 0x8b, 0xc6, 0x39, 0xf0, 0x06, 0x7a, 0xaa, 0x43, 0xa3, 0x90, 0x8f,
+  0xa3, 0x6f, 0x20, 0x6c, 0x6a, 0x9c, 0x3f, 0x4b, 0x7d, 0xf4, 0x02, 0xbd, 0x5e, 0xcf, 0x9e, 0x50, 0xf9, 0xac, 0xa6, 0xaf,
+  0x57, 0x68, 0x40, 0x91, 0xac, 0xf8, 0xfb, 0x84, 0x74, 0xbb, 0xce, 0xb1, 0xe7, 0xcf, 0x80, 0x00, 0x84, 0xd3, 0xfe, 0x44,
+  0x9b, 0x8e, 0x55, 0xb3, 0xb7, 0x82, 0x33, 0x6a, 0xaa, 0x09, 0x41, 0x97, 0x1b, 0xfe, 0x68, 0xb1, 0x01, 0x23, 0x1b, 0x07,
+  0x1b, 0xd0, 0xc5, 0x35, 0x5c, 0xf4, 0x2d, 0xeb, 0x99, 0x8d, 0xf3, 0x87, 0x14, 0x10, 0x79, 0x03, 0x51, 0x11, 0xcd, 0x80,
+  0x5c, 0x19, 0xd5, 0x16, 0x13, 0x93, 0x98, 0xa1, 0x9e, 0x34, 0xcc, 0xd8, 0xbb, 0x36, 0x2e, 0x28, 0xb3, 0x55, 0x5e, 0x51,
+  0x34, 0x78, 0x08, 0x06, 0x1a, 0xf7, 0x8c, 0x41, 0xd8, 0x9f, 0xd1, 0x6f, 0x34, 0x94, 0xbd, 0xf6, 0x3c, 0xcd, 0x60, 0xe3,
+  0x07, 0xd3, 0x62, 0x7b, 0xec, 0x7f, 0x93, 0xd7, 0x41, 0x94, 0x05, 0x31, 0x25, 0x01, 0x8c, 0x19, 0xe0, 0x8c, 0xe0, 0x46,
+  0x3c, 0x64, 0x93, 0xc6, 0xb1, 0xe7, 0xd2, 0x5d, 0xd0, 0xf4, 0x51, 0x55, 0xcd, 0x07, 0xc3, 0x46, 0xdf, 0x00, 0xcc, 0x6c,
+  0x86, 0xc4, 0xf3, 0x22, 0x0b, 0xdc, 0xa0, 0xd6, 0x59, 0xdc, 0xfa, 0x23, 0xdb, 0x09, 0x46, 0xf2, 0xb0, 0xf9, 0xb6, 0x03,
+  0x70, 0x8d, 0xd1, 0x30, 0xd7, 0xc3, 0x90, 0x9d, 0xc8, 0x5d, 0xc0, 0x26, 0x8e, 0xc1, 0x52, 0xf3, 0xba, 0x4e, 0x12, 0x2c,
+  0x52, 0xd8, 0xcd, 0x32, 0x0a, 0x43, 0xe0, 0x55, 0xe9, 0x55, 0x27, 0x8d, 0x83, 0xc3, 0x86, 0x9e, 0x02, 0x4c, 0x1a, 0x78,
+  0x96, 0xa5, 0x5c, 0x07, 0x84, 0xd7, 0x0d, 0xb5, 0x83, 0xff, 0x44, 0xdf, 0xcc, 0x85, 0x0b, 0xa1, 0x6e, 0x5d, 0x7a, 0x30,
+  0xd8, 0x63, 0xed, 0xc1, 0xa1, 0x5a, 0x08, 0xd2, 0xdd, 0xc6, 0xf9, 0x93, 0x7d, 0x00, 0x1f, 0xec, 0x03, 0xf8, 0xa0, 0xe2,
+  0xfc, 0xe4, 0x26, 0xde, 0x60, 0x4d, 0x14, 0x34, 0x94, 0xff, 0xe6, 0x5a, 0x56, 0x59, 0x34, 0xa4, 0xb3, 0x5c, 0x6f, 0x80,
+  0x26, 0x24, 0xbc, 0x9f, 0x49, 0x16, 0x95, 0xd2, 0x27, 0x1a, 0xc0, 0xf3, 0x0f, 0x40, 0xc4, 0xee, 0x03, 0x8e, 0xe2, 0xf7,
+  0xf5, 0x90, 0x21, 0x8d, 0x2d, 0x43, 0xd6, 0x62, 0x02, 0x64, 0x57, 0x68, 0xd2, 0x15, 0x49, 0x67, 0x33, 0x76, 0x95, 0x07,
+  0x07, 0x0a, 0x05, 0xc1, 0x76, 0x51, 0x53, 0x00, 0xf4, 0xc7, 0x1e, 0xe4, 0xb6, 0xac, 0x49, 0x1e, 0x2d, 0x0d, 0x0c, 0xcf,
+  0xe4, 0x02, 0x36, 0xae, 0x85, 0xc6, 0x72, 0xa8, 0x3b, 0x42, 0xe3, 0xbb, 0x70, 0x80, 0xbb, 0xbc, 0x84, 0xa0, 0xc6, 0xdb,
+  0x05, 0xee, 0xac, 0x6f, 0xd2, 0xce, 0xa0, 0x74, 0xdf, 0x24, 0xb5, 0xe1, 0xfa, 0xaa, 0x16, 0x44, 0x98, 0x9d, 0x32, 0xb6,
+  0xad, 0x33, 0xec, 0xfa, 0x79, 0x00, 0xc8, 0x95, 0xb0, 0x4c, 0x6e, 0xdb, 0x6b, 0x4e, 0x61, 0x01, 0x28, 0x17, 0x97, 0x99,
+  0x9f, 0xe0, 0x2c, 0x94, 0xf8, 0x7f, 0xff, 0xeb, 0x49, 0xad, 0x29, 0xfd, 0x3c, 0xdc, 0x5e, 0x83, 0xc1, 0x06, 0x4a, 0x93,
+  0xd7, 0x51, 0x4e, 0xef, 0x88, 0x1f, 0xd8, 0x59, 0xfa, 0x72, 0x86, 0x13, 0x05, 0x8a, 0x7d, 0x08, 0xb0, 0xf7, 0xb0, 0xf8,
+  0x9f, 0x60, 0xdc, 0x45, 0xf4, 0x41, 0x5e, 0xae, 0x8b, 0xd5, 0xba, 0xa8, 0x35, 0xed, 0x5b, 0x4c, 0x76, 0x65, 0x54, 0x79,
+  0x2b, 0x09, 0xb3, 0x2f, 0xd3, 0x22, 0xdf, 0xc1, 0x5b, 0x98, 0xa7, 0x51, 0xae, 0x0b, 0x05, 0x96, 0xe2, 0x6d, 0xe1, 0xc5,
+  0x8f, 0x14, 0x28, 0x9a, 0x55, 0x5d, 0xfc, 0x4e, 0x4e, 0x2c, 0xd8, 0x44, 0x4e, 0x1c, 0xe4, 0xc5, 0x7d, 0x47, 0x98, 0xa0,
+  0xd3, 0xcc, 0x26, 0x35, 0xab, 0x8c, 0x2b, 0x15, 0xd3, 0x2f, 0xd0, 0xc9, 0x92, 0x32, 0x4b, 0x7e, 0x54, 0x2d, 0xf9, 0x84,
+  0x2c, 0xc0, 0xe8, 0xc1, 0x7e, 0xed, 0xbd, 0x21, 0xcc, 0x12, 0xa1, 0x87, 0x7e, 0xa6, 0x80, 0x1a, 0x47, 0x19, 0x46, 0x65,
+  0x85, 0x6b, 0x67, 0x77, 0x2e, 0xd4, 0xb3, 0x75, 0xec, 0x85, 0x74, 0xde, 0x91, 0xa5, 0xba, 0x0e, 0x11, 0x6a, 0xde, 0x3e,
+  0x95, 0x09, 0x3f, 0x02, 0xd0, 0x8b, 0x3f, 0xbc, 0xdc, 0xe2, 0xf5, 0x0e, 0xf2, 0x53, 0x0c, 0x90, 0xec, 0x7d, 0x9a, 0x0d,
+  0xf6, 0xc7, 0xff, 0x0b, 0x72, 0xf1, 0xea, 0xe7, 0xe7, 0x04, 0x6c, 0xc8, 0x27, 0x08, 0xc6, 0x6a, 0xb3, 0x84, 0x89, 0x5a,
+  0x40, 0xf6, 0xbf, 0x26, 0x11, 0x60, 0xcc, 0x3e, 0x4f, 0x1c, 0xb8, 0x27, 0xea, 0xc8, 0x42, 0xdc, 0x57, 0x14, 0x87, 0x6d,
+  0x96, 0x74, 0x2b, 0x9f, 0x1e, 0x3e, 0xba, 0x74, 0xf3, 0x69, 0x07, 0x97, 0xa6, 0x61, 0x20, 0xb8, 0x44, 0xfe, 0xfd, 0xdf,
+  0x79, 0x35, 0x62, 0xd7, 0xad, 0xdd, 0x17, 0x32, 0xa8, 0x2c, 0x8d, 0x21, 0x22, 0xff, 0xfa, 0x4c, 0x7b, 0xfa, 0x85, 0x55,
+  0x61, 0x9b, 0x22, 0x64, 0xe9, 0x3c, 0xa3, 0x79, 0x7e, 0x67, 0x0a, 0x8b, 0x8c, 0x53, 0xce, 0x77, 0xda, 0xc8, 0x2d, 0xa2,
+  0xb0, 0x5b, 0x1b, 0xd8, 0x89, 0x76, 0x55, 0x1b, 0xc8, 0x7e, 0x36, 0x45, 0xa0, 0xc8, 0x70, 0xfb, 0x5c, 0x2d, 0x41, 0xe5,
+  0x50, 0xea, 0xb2, 0x5b, 0x4b, 0xc6, 0xf9, 0xa9, 0x75, 0x1a, 0xe1, 0xbc, 0x76, 0x52, 0x9f, 0x26, 0xd9, 0x65, 0xfd, 0x6a,
+  0x41, 0xdf, 0x28, 0x96, 0x57, 0x54, 0xb2, 0x4e, 0xbc, 0x3f, 0x2f, 0xac, 0xb9, 0xa2, 0x05, 0x3b, 0x7e, 0xc8, 0xef, 0x18,
+  0xd3, 0xe4, 0x62, 0xde, 0x25, 0x90, 0xb9, 0xa8, 0xda, 0xcd, 0x2f, 0x17, 0x12, 0x46, 0x89, 0x1f, 0x13, 0x9e, 0x04, 0xdc,
+  0x35, 0x2c, 0xc4, 0xa9, 0xfb, 0x04, 0x86, 0x9f, 0x65, 0x20, 0xae, 0xfc, 0x19, 0x2d, 0x6e, 0x88, 0x9f, 0x84, 0x84, 0x97,
+  0x50, 0xbe, 0xd8, 0xd6, 0x1f, 0xfa, 0x21, 0x79, 0x4d, 0x59, 0x7d, 0xe2, 0xae, 0xdc, 0x99, 0xfa, 0xa1, 0x9c, 0xf9, 0x15,
+  0x79, 0xc3, 0x0a, 0x1c, 0xaf, 0xe9, 0xdf, 0x69, 0x70, 0x57, 0xd6, 0x60, 0x0d, 0x84, 0x4f, 0xa4, 0x88, 0x68, 0x9e, 0x26,
+  0x5f, 0x53, 0x84, 0x32, 0x4a, 0x09, 0x84, 0x8c, 0x77, 0x4d, 0x2b, 0x20, 0x36, 0x5b, 0xe1, 0x5c, 0xe6, 0x6f, 0x7e, 0x7a,
+  0xf8, 0x95, 0xb0, 0x43, 0xc4, 0xc8, 0x5b, 0x3c, 0x2f, 0xfd, 0x04, 0xf4, 0xd8, 0x3c, 0x87, 0x91, 0xde, 0x53, 0xb8, 0x49,
+  0x79, 0x0a, 0xb7, 0x53, 0xce, 0x9f, 0xe1, 0x81, 0x9f, 0x56, 0x36, 0x22, 0x97, 0x0b, 0x3f, 0x2b, 0x6a, 0xc9, 0xc0, 0x3d,
+  0x81, 0xb6, 0x99, 0xc0, 0x4f, 0x3e, 0xf8, 0xb9, 0xca, 0xc7, 0xd9, 0x6c, 0x55, 0x0d, 0x3a, 0xaa, 0x54, 0x83, 0x84, 0x61,
+  0xd7, 0x8f, 0xae, 0xca, 0x88, 0xca, 0xe3, 0xde, 0xe1, 0xac, 0xcf, 0x81, 0x7e, 0xc5, 0x5d, 0xf3, 0xea, 0xe5, 0xb3, 0x14,
+  0x35, 0xb0, 0x66, 0xa7, 0xf2, 0x44, 0x48, 0xdf, 0xec, 0x74, 0x0d, 0x6e, 0x4c, 0xf1, 0x0e, 0xcf, 0x99, 0x65, 0xd5, 0x37,
+  0x4d, 0x82, 0x38, 0x0a, 0xde, 0xa3, 0x75, 0x8a, 0xc1, 0x2d, 0x20, 0xe4, 0x56, 0xf3, 0xe2, 0xd9, 0xb3, 0x66, 0xbb, 0x71,
+  0x7e, 0x11, 0xc7, 0x67, 0x7d, 0x3e, 0x75, 0x1b, 0xac, 0x1a, 0x20, 0xec, 0x60, 0x1e, 0xc1, 0x3c, 0xc6, 0xbb, 0x5c, 0xf9,
+  0x67, 0x40, 0xc2, 0xab, 0x00, 0x08, 0xe8, 0x67, 0x3f, 0x4b, 0xb8, 0xf1, 0xf9, 0x64, 0x50, 0x78, 0xfb, 0x00, 0x41, 0x3d,
+  0x4d, 0x66, 0xe9, 0x67, 0x80, 0x61, 0xb7, 0x1d, 0x10, 0x0e, 0xe3, 0xc7, 0x1d, 0x01, 0x05, 0x31, 0x44, 0x00, 0x0c, 0x0e,
+  0x00, 0xb8, 0xc4, 0x0f, 0xe4, 0x11, 0x77, 0xe4, 0x77, 0x04, 0x54, 0xa4, 0xf3, 0x79, 0x4c, 0x2f, 0xd6, 0x45, 0x7a, 0x15,
+  0x00, 0xc7, 0x63, 0x84, 0x87, 0x9f, 0xba, 0x39, 0xfb, 0xa8, 0x17, 0x79, 0x7d, 0x35, 0xe8, 0xaa, 0x60, 0x95, 0xde, 0x97,
+  0x2f, 0x54, 0xa5, 0xd7, 0x5c, 0xb3, 0x56, 0xae, 0x8c, 0x4b, 0x52, 0xc2, 0x6c, 0xa6, 0xf3, 0x4b, 0xd5, 0xe2, 0x8e, 0xc0,
+  0xca, 0xb3, 0x43, 0x24, 0x7d, 0x7d, 0xbc, 0x28, 0xcf, 0x01, 0x1b, 0xe7, 0x9e, 0x77, 0xc2, 0xfe, 0xdb, 0x11, 0x2b, 0x96,
+  0xe7, 0x84, 0x1c, 0x30, 0xfe, 0xdc, 0x63, 0x8a, 0xb8, 0x0b, 0xa2, 0x4e, 0x39, 0x48, 0x9c, 0xfa, 0x21, 0x0d, 0x7b, 0xe4,
+  0x09, 0x2d, 0x82, 0x05, 0x48, 0x17, 0x09, 0xfd, 0xc2, 0x77, 0xd6, 0xdf, 0xb7, 0x46, 0xf3, 0xd5, 0x07, 0xf6, 0xb2, 0x5b,
+  0x90, 0x45, 0x2b, 0x51, 0xb8, 0x8a, 0x69, 0x41, 0x4a, 0x36, 0x90, 0x09, 0x44, 0x75, 0x6b, 0x71, 0x27, 0x02, 0xbb, 0x00,
+  0xb9, 0x27, 0x4c, 0xc2, 0xa0, 0x87, 0x29, 0x60, 0xd9, 0xb5, 0xc9, 0x01, 0xd9, 0x84, 0x39, 0x27, 0xe8, 0x9c, 0xf9, 0xb1,
+  0xbc, 0x4b, 0xd1, 0xef, 0x93, 0xc7, 0x40, 0xdb, 0x88, 0xe6, 0x24, 0xa3, 0x01, 0x05, 0x85, 0x0e, 0x49, 0x9e, 0xc2, 0x88,
+  0x8c, 0xf9, 0xff, 0x62, 0x41, 0xc5, 0x9d, 0x0e, 0x52, 0xa4, 0x64, 0x85, 0xab, 0xf6, 0xfd, 0x55, 0xd4, 0x87, 0xa5, 0x72,
+  0x32, 0xcb, 0xd2, 0xe5, 0x1f, 0xc4, 0x05, 0x62, 0x70, 0x9b, 0xcf, 0x2f, 0xfe, 0xfa, 0xb7, 0x67, 0x2f, 0xff, 0xfc, 0xb7,
+  0xc7, 0x2f, 0xde, 0xbc, 0x7e, 0xfa, 0xf8, 0x0a, 0xd6, 0x19, 0xc8, 0x2b, 0x1d, 0x02, 0x3b, 0xb9, 0xd2, 0x84, 0xfc, 0xfa,
+  0x9b, 0xd1, 0x71, 0xc9, 0x97, 0x98, 0xe0, 0xd9, 0x2c, 0x6b, 0x9f, 0xad, 0x13, 0x76, 0x2a, 0x4c, 0xf0, 0x02, 0x88, 0x5f,
+  0xf0, 0x73, 0x89, 0x56, 0x4e, 0x61, 0xa5, 0x30, 0x6f, 0xeb, 0x37, 0x97, 0x61, 0xe1, 0x05, 0x4c, 0x7c, 0xee, 0x17, 0x8b,
+  0x1e, 0xc4, 0xdf, 0x69, 0x26, 0x47, 0x91, 0x3e, 0x39, 0x38, 0xc4, 0xda, 0x81, 0x31, 0x76, 0x69, 0x8e, 0x55, 0x83, 0xef,
+  0xf3, 0xc1, 0x30, 0xe9, 0xd0, 0x9e, 0x82, 0xf8, 0x96, 0xc3, 0x0e, 0xd5, 0xf1, 0x71, 0x46, 0xc1, 0x69, 0x24, 0xe4, 0xdd,
+  0xbd, 0x8f, 0x8b, 0xdb, 0x05, 0xb9, 0xf7, 0x71, 0x79, 0xbb, 0x84, 0x9f, 0xf9, 0x6d, 0xfe, 0x4e, 0xde, 0xf1, 0x30, 0xb7,
+  0xc2, 0xcf, 0xae, 0x78, 0x44, 0xc5, 0x54, 0xa8, 0x85, 0x72, 0x52, 0x6e, 0x26, 0x4c, 0x83, 0xf5, 0x12, 0x04, 0xbd, 0x07,
+  0x71, 0xe1, 0xe3, 0x98, 0xe2, 0xe3, 0xc3, 0x9b, 0xa7, 0x61, 0xab, 0xa9, 0x0e, 0x77, 0x9a, 0xed, 0x1e, 0xd6, 0x8b, 0x2f,
+  0x79, 0x1c, 0x0e, 0x68, 0x31, 0x41, 0x63, 0xdd, 0xe4, 0x9f, 0xff, 0x24, 0xcd, 0x6e, 0x57, 0x5d, 0xe0, 0xae, 0x05, 0xc6,
+  0x8f, 0x7a, 0x2a, 0x90, 0x9a, 0xf2, 0xe8, 0xa7, 0x49, 0xbe, 0x37, 0x89, 0xce, 0xd6, 0xe0, 0xb3, 0x70, 0x91, 0x92, 0x3a,
+  0xb5, 0x4b, 0x94, 0xc7, 0x41, 0x95, 0x65, 0x12, 0xba, 0x21, 0x8f, 0x70, 0xeb, 0xd0, 0x91, 0x3e, 0x4b, 0xf1, 0xf5, 0xcf,
+  0x37, 0x00, 0xf8, 0x0a, 0xe4, 0x22, 0x99, 0xb7, 0xda, 0x82, 0xfb, 0x4c, 0x2c, 0x39, 0x04, 0x52, 0x68, 0xfe, 0x99, 0x9d,
+  0xd3, 0x1b, 0xbc, 0x01, 0xd9, 0xc4, 0x8b, 0x7e, 0xe8, 0xc4, 0x25, 0x39, 0x70, 0x42, 0xfe, 0x43, 0x4f, 0xf4, 0x30, 0x94,
+  0x2d, 0x7e, 0x8a, 0x38, 0xdf, 0x31, 0x49, 0x76, 0x19, 0xb3, 0x6a, 0xf7, 0xa9, 0x0e, 0x26, 0x2a, 0xdb, 0x64, 0x12, 0xc6,
+  0xd2, 0xb5, 0x96, 0x86, 0x61, 0x7b, 0x2f, 0x88, 0x3c, 0x31, 0xa8, 0x32, 0x48, 0x9e, 0x1a, 0x20, 0x83, 0x34, 0xf8, 0xfa,
+  0x6e, 0xd4, 0x02, 0x5c, 0xd4, 0xd8, 0xf1, 0x94, 0x8e, 0x40, 0x87, 0x8c, 0x59, 0x31, 0x0d, 0xa8, 0xfb, 0xdc, 0xbf, 0x66,
+  0xa4, 0xc5, 0x16, 0x48, 0x24, 0xc4, 0xbc, 0x5d, 0xf8, 0x89, 0xb2, 0x74, 0x05, 0xb9, 0x96, 0x4e, 0x44, 0x18, 0x24, 0xa5,
+  0xb1, 0x0d, 0xb8, 0x36, 0x01, 0x7c, 0xd3, 0xe4, 0x40, 0xc6, 0x74, 0x5d, 0x9f, 0x03, 0x2d, 0x3b, 0x89, 0x53, 0xd6, 0x9c,
+  0xab, 0xeb, 0x17, 0x37, 0x2b, 0x9a, 0xce, 0x38, 0xe0, 0x09, 0x10, 0x2b, 0x59, 0x2f, 0xa7, 0x34, 0x6b, 0x92, 0x1f, 0xb0,
+  0x09, 0x44, 0xed, 0x49, 0x74, 0x4d, 0xc3, 0xd6, 0xa0, 0x4d, 0x4e, 0x0c, 0xbc, 0xb0, 0x6a, 0xdd, 0x74, 0x08, 0x9d, 0x08,
+  0x80, 0x20, 0xed, 0xce, 0x72, 0xd3, 0xd4, 0xb0, 0xe2, 0xe6, 0xab, 0xc0, 0x62, 0x32, 0xdf, 0xbf, 0x98, 0xf5, 0x43, 0x8f,
+  0x8f, 0xe2, 0xda, 0x02, 0x16, 0x65, 0x38, 0x1e, 0x93, 0xef, 0xd0, 0x18, 0xee, 0x16, 0x00, 0xbd, 0x9a, 0x5b, 0xd9, 0x65,
+  0xb9, 0x38, 0x60, 0x7f, 0xbf, 0xb9, 0x27, 0xb0, 0x87, 0x7e, 0x06, 0x90, 0x58, 0xf0, 0xd9, 0xe3, 0x99, 0x7f, 0x2d, 0x24,
+  0x63, 0xab, 0xbc, 0x7e, 0x28, 0xf9, 0xa4, 0xf6, 0x26, 0x9a, 0xab, 0x6a, 0x05, 0x6c, 0xaf, 0xd0, 0x45, 0x0c, 0xbe, 0x13,
+  0x09, 0xf8, 0x9c, 0xca, 0xe6, 0x79, 0xf3, 0xe9, 0x1e, 0x12, 0xea, 0xda, 0xb0, 0x40, 0xce, 0xb5, 0xdb, 0x5a, 0x50, 0xbc,
+  0x34, 0x57, 0x23, 0xeb, 0x8a, 0x1e, 0x7c, 0x94, 0x21, 0xf0, 0x58, 0xc9, 0x73, 0x49, 0x95, 0xa8, 0x44, 0x11, 0x59, 0xee,
+  0x31, 0xc9, 0x2d, 0x1a, 0x25, 0xc1, 0xc5, 0xe0, 0x1f, 0x7a, 0xaa, 0x63, 0x2f, 0x9b, 0x64, 0x55, 0xbb, 0xaa, 0x64, 0x94,
+  0xd0, 0x0c, 0x52, 0x98, 0x28, 0x00, 0x01, 0x11, 0x8b, 0x2d, 0x4b, 0xc8, 0x61, 0x4d, 0xc5, 0x4e, 0xad, 0xd1, 0x22, 0xbd,
+  0x7b, 0x45, 0x7d, 0x7c, 0x0d, 0x86, 0xe7, 0x20, 0x2f, 0xa0, 0xc0, 0xe6, 0x7c, 0xa2, 0xbf, 0xa5, 0xb4, 0xd3, 0x71, 0xea,
+  0x15, 0x1d, 0xb7, 0xf3, 0x54, 0x64, 0x36, 0xc6, 0xee, 0xed, 0x4d, 0x55, 0x41, 0xa6, 0x46, 0x4c, 0x14, 0x78, 0x35, 0xd0,
+  0x61, 0x1a, 0x0d, 0x26, 0x68, 0x75, 0x0e, 0xe5, 0xe0, 0x59, 0x3d, 0x06, 0x44, 0x4d, 0xeb, 0xaa, 0xea, 0x9f, 0xd6, 0xfb,
+  0x38, 0xde, 0xc6, 0x3f, 0x6d, 0x60, 0xc9, 0x3f, 0x63, 0xb6, 0xb5, 0x15, 0xad, 0xcf, 0x3d, 0x9c, 0x05, 0xc7, 0x2f, 0x7c,
+  0x08, 0x10, 0xc0, 0xf4, 0xea, 0x69, 0x3d, 0xfa, 0xaa, 0x96, 0x8e, 0xf6, 0x39, 0x19, 0x03, 0x4b, 0x9b, 0x84, 0xbd, 0x9c,
+  0x83, 0xcc, 0x34, 0x3b, 0x87, 0xac, 0x13, 0x5f, 0xf7, 0xe1, 0x8c, 0x6e, 0x5b, 0xc4, 0xa9, 0x16, 0x59, 0x6c, 0x1a, 0x39,
+  0x46, 0x20, 0xc1, 0xf1, 0xda, 0x83, 0x25, 0xed, 0xd5, 0x91, 0xdb, 0xc9, 0x56, 0x1d, 0x5f, 0x52, 0xcf, 0x05, 0xcb, 0x22,
+  0x62, 0x75, 0xc8, 0xd6, 0xc9, 0xdb, 0x49, 0xea, 0xd8, 0xe5, 0x37, 0xcc, 0xed, 0xe1, 0x36, 0x77, 0xd0, 0x50, 0xd6, 0x80,
+  0x5c, 0x1e, 0x6c, 0x49, 0x97, 0x69, 0x76, 0xc3, 0x1c, 0x18, 0x1f, 0x23, 0x5d, 0xd8, 0xc0, 0x1b, 0x8e, 0xac, 0xb0, 0x18,
+  0xc7, 0x5c, 0x45, 0xff, 0xa0, 0x92, 0x03, 0xfa, 0x5c, 0xd6, 0x0e, 0x73, 0x07, 0xd5, 0x29, 0xac, 0xbe, 0x63, 0xad, 0x3d,
+  0x20, 0x5d, 0xb2, 0x03, 0x01, 0x09, 0xb5, 0x7d, 0x07, 0x4f, 0xca, 0x20, 0xb8, 0xbc, 0x28, 0x07, 0x8d, 0x96, 0xfa, 0xa7,
+  0x87, 0xcd, 0x1a, 0x14, 0xb7, 0x0b, 0x83, 0x1a, 0x56, 0xca, 0x80, 0x36, 0xd3, 0xb1, 0x22, 0xdf, 0xb6, 0x61, 0x02, 0xf5,
+  0x09, 0xdb, 0xd9, 0x5d, 0x02, 0x38, 0x27, 0x47, 0x9e, 0xa9, 0x40, 0x7a, 0xdf, 0xa1, 0x57, 0xe5, 0xbd, 0x61, 0x29, 0xdd,
+  0x61, 0x35, 0x7e, 0xa7, 0x4b, 0x61, 0x44, 0x8e, 0xac, 0x94, 0x65, 0x46, 0x8e, 0x8e, 0x38, 0xd3, 0x9d, 0xe0, 0xb0, 0xb2,
+  0x04, 0xe6, 0x87, 0x76, 0x9a, 0x56, 0xbe, 0x1e, 0xb5, 0x4d, 0xcb, 0xb4, 0x7a, 0x40, 0x53, 0x97, 0x38, 0xde, 0xd4, 0x8b,
+  0x20, 0x8b, 0xcd, 0x7e, 0x7c, 0xf3, 0xfc, 0x19, 0x12, 0xca, 0x76, 0x04, 0xb8, 0x6a, 0x0f, 0x92, 0x97, 0xc7, 0x7e, 0xb0,
+  0x40, 0x14, 0xc8, 0xe4, 0x5c, 0xbb, 0xcf, 0x1b, 0xcd, 0x48, 0xab, 0x4c, 0x91, 0x99, 0xbe, 0x60, 0x92, 0x4c, 0xbe, 0xfd,
+  0x16, 0x27, 0xf6, 0x78, 0x25, 0x00, 0x9b, 0xd5, 0xa0, 0xb6, 0xc8, 0xf1, 0xca, 0x3b, 0xc9, 0xea, 0x81, 0x6f, 0x89, 0x97,
+  0x25, 0xb4, 0xed, 0x04, 0x19, 0x46, 0x56, 0x62, 0x47, 0xad, 0x26, 0x64, 0xf1, 0x4d, 0xed, 0x42, 0x38, 0x7f, 0x8d, 0xc7,
+  0xe0, 0x75, 0x59, 0xdc, 0x40, 0x4e, 0x2b, 0x3c, 0x6a, 0x57, 0x64, 0x69, 0x98, 0x96, 0x47, 0xe1, 0x0c, 0x6c, 0x83, 0x24,
+  0x10, 0xf8, 0x52, 0x93, 0x54, 0x99, 0xeb, 0xeb, 0x24, 0x7c, 0xb7, 0xbb, 0x98, 0x72, 0xef, 0x23, 0xfe, 0xbe, 0xdd, 0xbb,
+  0x96, 0x72, 0xef, 0xa3, 0xda, 0xc5, 0x2d, 0xce, 0x2e, 0x3f, 0xdd, 0xa5, 0xb6, 0xc2, 0xe7, 0x89, 0x8f, 0x95, 0x99, 0xef,
+  0xdc, 0xf4, 0x11, 0x32, 0xe2, 0xaf, 0x56, 0x34, 0x09, 0x2f, 0xf1, 0x2d, 0xde, 0x16, 0xdb, 0xb2, 0x22, 0xc1, 0x6d, 0x69,
+  0x0c, 0x51, 0x1a, 0xca, 0x5a, 0x4a, 0x5b, 0x93, 0x93, 0x12, 0x10, 0x2f, 0x82, 0xbd, 0x49, 0x31, 0x4d, 0xb4, 0x5b, 0x7f,
+  0x64, 0x95, 0x5b, 0xfb, 0x52, 0xb8, 0xac, 0xa9, 0x5c, 0x84, 0x61, 0xce, 0x8a, 0x27, 0x54, 0x94, 0x3c, 0xb0, 0x56, 0x42,
+  0x7c, 0x26, 0xa1, 0x44, 0xbe, 0x4c, 0x04, 0xc9, 0x4a, 0x59, 0x4c, 0x81, 0x10, 0x67, 0x05, 0x1c, 0xa6, 0xa6, 0x4a, 0xf1,
+  0xad, 0x30, 0x95, 0x32, 0x8b, 0x05, 0xac, 0x70, 0x02, 0x5e, 0xe0, 0x8a, 0xfe, 0x4e, 0x26, 0x5a, 0x6d, 0x05, 0x48, 0x9d,
+  0xcc, 0x21, 0xee, 0xfa, 0x41, 0x6b, 0xfb, 0xb5, 0xda, 0xdd, 0x25, 0x83, 0xdf, 0x20, 0xe4, 0xf9, 0x9d, 0x68, 0xd7, 0xe1,
+  0x11, 0x64, 0x46, 0xd9, 0x1d, 0x7b, 0xbb, 0x4a, 0xc4, 0xc9, 0xc5, 0x03, 0x5f, 0x5e, 0xaa, 0x39, 0x93, 0xab, 0xeb, 0x94,
+  0xb3, 0x4b, 0x3c, 0x8c, 0x14, 0xe2, 0xfe, 0x4e, 0x0c, 0x3a, 0xa7, 0xa0, 0x9f, 0x92, 0xa8, 0xc8, 0xc1, 0xa4, 0xfc, 0x0e,
+  0x3f, 0xb0, 0x85, 0x9d, 0x9e, 0x96, 0x60, 0xd4, 0xbe, 0xb4, 0xd7, 0x26, 0x74, 0xcc, 0xca, 0xb2, 0x57, 0x79, 0x89, 0x5f,
+  0x04, 0x41, 0xfc, 0xcd, 0x76, 0x07, 0x45, 0xe4, 0x78, 0xbe, 0x0b, 0x46, 0x72, 0xf0, 0x2d, 0xbf, 0xfe, 0xd6, 0xde, 0x69,
+  0x30, 0x18, 0x9d, 0xce, 0xcb, 0xfd, 0x6a, 0xa0, 0x57, 0xeb, 0x9c, 0xcd, 0x33, 0x04, 0xcc, 0x98, 0x6c, 0xd1, 0xfd, 0xdc,
+  0xae, 0x92, 0xb9, 0xc9, 0xd7, 0xcb, 0x57, 0x71, 0x14, 0x50, 0xfc, 0xea, 0x16, 0x17, 0xef, 0x6c, 0x18, 0x36, 0x2d, 0xf4,
+  0x8a, 0x9a, 0xc6, 0xb4, 0xed, 0xa8, 0xa1, 0xe5, 0x13, 0xe4, 0x03, 0xc2, 0x28, 0x72, 0xeb, 0x08, 0x9a, 0x06, 0x5e, 0xcc,
+  0x6f, 0x3b, 0x75, 0xa0, 0x2c, 0xe0, 0x95, 0x35, 0x6f, 0x66, 0x05, 0x34, 0x11, 0xd6, 0xca, 0x95, 0x86, 0xd1, 0x53, 0xd6,
+  0xf4, 0xf7, 0x35, 0xcd, 0x6e, 0xae, 0x68, 0x0c, 0x71, 0x4e, 0x9a, 0x5d, 0xc4, 0x71, 0xab, 0x59, 0xbe, 0x4e, 0x87, 0x2f,
+  0x6d, 0x35, 0x4b, 0xe6, 0xe1, 0x81, 0x84, 0xc1, 0x3c, 0x7c, 0xa7, 0x8b, 0x19, 0x96, 0x67, 0x51, 0x5e, 0xf4, 0x78, 0x9d,
+  0xbb, 0xd5, 0xe4, 0x67, 0x16, 0xcd, 0x0e, 0xeb, 0xd6, 0xbc, 0x74, 0x8f, 0xed, 0x36, 0xff, 0x39, 0x2a, 0x16, 0x12, 0x4d,
+  0x20, 0x02, 0x7f, 0xe4, 0x15, 0x05, 0xe9, 0x2a, 0xac, 0x89, 0xa2, 0x33, 0x8e, 0x9b, 0x6d, 0x87, 0x10, 0x6c, 0x23, 0x98,
+  0x4d, 0x28, 0xad, 0xa6, 0xaf, 0x93, 0xa8, 0x5a, 0x33, 0x25, 0xfb, 0x7a, 0x4f, 0xd3, 0x59, 0x6e, 0x2b, 0xa9, 0xd7, 0x98,
+  0x7e, 0x74, 0x49, 0x8a, 0xa0, 0x3b, 0x4a, 0x77, 0x18, 0xdb, 0xc8, 0xf3, 0x80, 0x3d, 0x8b, 0xec, 0x00, 0x5e, 0x41, 0x6f,
+  0xd6, 0xbb, 0x02, 0x71, 0xb2, 0xc1, 0x09, 0x04, 0xfa, 0xdf, 0x42, 0x4c, 0xa4, 0x5d, 0xdd, 0x44, 0x71, 0xcc, 0xac, 0x24,
+  0xe4, 0xac, 0x53, 0x1a, 0xa7, 0x9b, 0xb6, 0x3a, 0x94, 0xc0, 0x12, 0x7a, 0xd3, 0x4d, 0xeb, 0xea, 0xb1, 0x87, 0x22, 0xb9,
+  0x51, 0x5f, 0xff, 0xa6, 0xfc, 0xb4, 0x93, 0xf6, 0xd6, 0xf9, 0x48, 0x25, 0xee, 0xd4, 0x00, 0x43, 0x90, 0xf6, 0xf2, 0x05,
+  0x8b, 0xd0, 0x5e, 0x3e, 0x79, 0x62, 0xa2, 0x08, 0x06, 0xf3, 0x8d, 0x5d, 0xf1, 0x04, 0x65, 0x4c, 0x42, 0x8a, 0x64, 0x76,
+  0xc5, 0x5b, 0xbc, 0xca, 0x57, 0xb0, 0x20, 0x6d, 0xe9, 0x5f, 0xb3, 0xf8, 0xcc, 0x8a, 0xbc, 0xf0, 0xed, 0x49, 0x40, 0x42,
+  0x0b, 0xbc, 0x97, 0x51, 0xc2, 0xa6, 0x40, 0x64, 0x2d, 0xe6, 0x74, 0xc8, 0xc0, 0x0a, 0xf0, 0xfd, 0x04, 0x68, 0x84, 0x09,
+  0x79, 0x39, 0xfb, 0x3b, 0x32, 0x7c, 0xe0, 0xa1, 0xf3, 0x38, 0x18, 0xb3, 0x2a, 0x62, 0x17, 0x1e, 0xfe, 0xfd, 0x2f, 0x3c,
+  0x1a, 0xe0, 0x0f, 0x2d, 0xe8, 0x86, 0x5f, 0x7e, 0x16, 0xb4, 0xcd, 0x82, 0x1f, 0x64, 0x78, 0x7e, 0x82, 0x42, 0xdc, 0xe2,
+  0x50, 0xbf, 0xe3, 0x68, 0xbc, 0x7a, 0xca, 0x92, 0x8b, 0x23, 0xcf, 0x59, 0x81, 0xe2, 0xd7, 0x4c, 0xfe, 0xaa, 0x1f, 0x24,
+  0x98, 0x5d, 0xbf, 0xb8, 0xba, 0xf8, 0x3b, 0xa9, 0xd0, 0x73, 0xec, 0x86, 0xca, 0x34, 0x1d, 0x81, 0x4a, 0xf0, 0xdf, 0xcb,
+  0x29, 0x02, 0xa9, 0x20, 0xcd, 0x5b, 0xb8, 0xb1, 0x12, 0x49, 0x8e, 0xa3, 0x7d, 0x2c, 0x80, 0x70, 0x7e, 0x51, 0x70, 0x7e,
+  0xa9, 0xc0, 0xc9, 0x81, 0xc6, 0x7b, 0xc0, 0x01, 0xde, 0xee, 0xc2, 0x46, 0x90, 0xaf, 0x3a, 0x71, 0xd7, 0xf2, 0xf6, 0x44,
+  0x2b, 0x01, 0xce, 0xe6, 0xf4, 0x22, 0x0b, 0x4c, 0x16, 0x9f, 0x13, 0xaf, 0xf7, 0x00, 0x93, 0xf4, 0x81, 0x1e, 0x1b, 0x98,
+  0xe2, 0xe4, 0xb3, 0xc2, 0xce, 0xbb, 0xe7, 0x78, 0xdc, 0xc1, 0xa8, 0x79, 0x2b, 0x9f, 0x7e, 0xb9, 0x25, 0x17, 0xf0, 0xcc,
+  0x31, 0xb9, 0xd5, 0x9e, 0x3c, 0x8c, 0x0b, 0xc5, 0x82, 0xb7, 0x00, 0xfb, 0xde, 0x47, 0xdc, 0xf7, 0x2d, 0xff, 0xfd, 0xcb,
+  0xed, 0xbb, 0xbd, 0x4a, 0xe3, 0x30, 0x17, 0x2b, 0x7b, 0xb4, 0xb8, 0x28, 0x40, 0xfb, 0xa7, 0x6b, 0x30, 0x46, 0xcd, 0x10,
+  0x8c, 0x39, 0x22, 0xd4, 0xde, 0xa6, 0x46, 0x65, 0x86, 0x23, 0xc4, 0x07, 0x3f, 0x83, 0x31, 0xf3, 0x61, 0x1b, 0xe5, 0xb7,
+  0x50, 0x2c, 0x57, 0xf9, 0x09, 0x58, 0x59, 0xf9, 0x1e, 0xa1, 0xcc, 0x78, 0x8c, 0x46, 0x16, 0x6b, 0xeb, 0x0d, 0xa0, 0x3e,
+  0xaf, 0xc4, 0xa8, 0xc1, 0xd0, 0xc3, 0x85, 0x87, 0xf8, 0xb2, 0x21, 0xe0, 0x96, 0x13, 0xbf, 0x80, 0x9d, 0xe6, 0x10, 0x98,
+  0xc7, 0xb4, 0xcf, 0x4f, 0x90, 0x38, 0x8e, 0xa7, 0xce, 0xc4, 0x89, 0x27, 0x5d, 0x85, 0x91, 0x6d, 0xd9, 0x9a, 0x9c, 0xa4,
+  0x1b, 0xe3, 0x14, 0x45, 0x49, 0x84, 0xdc, 0x10, 0x2f, 0xa8, 0xf3, 0xc0, 0xa4, 0xd0, 0x8f, 0x04, 0xca, 0x11, 0x6a, 0x5f,
+  0x7c, 0x94, 0x5a, 0xca, 0x01, 0x0b, 0x37, 0xcb, 0x47, 0xc1, 0xc2, 0x8e, 0x64, 0xf2, 0x27, 0x4a, 0x57, 0x24, 0x4d, 0xe2,
+  0x1b, 0x16, 0x1d, 0x95, 0xb4, 0xd0, 0x02, 0x0d, 0x1b, 0x33, 0x15, 0x08, 0x95, 0x1d, 0x6a, 0x9a, 0x11, 0x85, 0x5b, 0xf3,
+  0xf2, 0x45, 0x34, 0x2b, 0xf4, 0x64, 0xc6, 0xb5, 0xa1, 0x2d, 0x83, 0xf8, 0x5e, 0xac, 0x01, 0xb7, 0x56, 0x21, 0x31, 0xf3,
+  0x37, 0x9c, 0x0b, 0x35, 0x3e, 0x5a, 0x1b, 0x60, 0x27, 0xb7, 0xfc, 0x2e, 0xc8, 0x64, 0xbb, 0x00, 0xb3, 0xb9, 0x4d, 0x4b,
+  0x8f, 0x83, 0xe2, 0x1a, 0xd5, 0x98, 0x01, 0xc0, 0x59, 0xcc, 0x65, 0x5c, 0x43, 0xf6, 0x38, 0x0c, 0xed, 0xa1, 0xb2, 0xa6,
+  0x2a, 0x06, 0xb3, 0x8f, 0x76, 0xfd, 0x02, 0xd3, 0x92, 0x72, 0xc8, 0xc2, 0x48, 0x53, 0x4a, 0xce, 0xf1, 0x4b, 0x03, 0x7c,
+  0x90, 0x04, 0x50, 0x5c, 0xf7, 0xf0, 0xcd, 0x95, 0x2b, 0x2c, 0xdf, 0x62, 0xc4, 0x20, 0xbe, 0xb1, 0xa4, 0xac, 0x90, 0x88,
+  0x01, 0xaf, 0x21, 0x1e, 0xc3, 0xd0, 0x14, 0xfe, 0x13, 0xdf, 0xe7, 0xca, 0x57, 0xb1, 0x05, 0x64, 0x0b, 0xfb, 0xcf, 0xc8,
+  0xd0, 0x4e, 0xae, 0x4b, 0xdc, 0x9e, 0x44, 0x49, 0x88, 0x3a, 0xd4, 0x07, 0xc1, 0xc0, 0xb3, 0x48, 0x82, 0x5f, 0x13, 0x2b,
+  0xbd, 0x9f, 0xf2, 0x4e, 0x71, 0xcc, 0xce, 0xde, 0x58, 0x64, 0xd4, 0xeb, 0xf5, 0xac, 0x85, 0x3a, 0xc4, 0x68, 0x53, 0x22,
+  0xf2, 0x9b, 0x75, 0x1c, 0x1c, 0x25, 0xe2, 0x18, 0x50, 0xb9, 0x45, 0x98, 0xa7, 0x60, 0xb7, 0xd1, 0xd7, 0x59, 0xfe, 0x45,
+  0xf8, 0x4b, 0x35, 0xc5, 0xbf, 0xb6, 0xa6, 0x7c, 0x5f, 0x99, 0x82, 0x18, 0xbd, 0x06, 0xc7, 0x87, 0x54, 0x95, 0xd3, 0xbb,
+  0x72, 0xed, 0xea, 0xfe, 0x1f, 0x81, 0x94, 0xb1, 0x37, 0xfd, 0x35, 0xba, 0xf3, 0x77, 0xb0, 0x4a, 0xd6, 0x8c, 0x46, 0x23,
+  0x83, 0x2f, 0x78, 0x29, 0xf4, 0x67, 0x21, 0x1d, 0x83, 0xf2, 0xfb, 0x15, 0x32, 0x8c, 0x61, 0x0b, 0x12, 0xb1, 0x5c, 0x0a,
+  0x7e, 0x9d, 0x4d, 0xc8, 0x08, 0x7e, 0x7f, 0xff, 0xbd, 0x95, 0xf0, 0x02, 0x92, 0x58, 0xc7, 0x68, 0x09, 0xf1, 0xe9, 0x93,
+  0x11, 0x16, 0xda, 0x22, 0x4d, 0x91, 0x60, 0x8d, 0x29, 0x9d, 0x47, 0xc9, 0x2b, 0xd8, 0xb4, 0xa1, 0x61, 0xd0, 0xb1, 0x84,
+  0xf4, 0xed, 0x4d, 0x8a, 0x22, 0x71, 0x63, 0xf5, 0x20, 0x5a, 0xd0, 0x23, 0xc4, 0xc4, 0xee, 0xe5, 0x9b, 0xaa, 0x55, 0x47,
+  0x49, 0x0a, 0x75, 0x2a, 0x8b, 0xd0, 0xb6, 0xd0, 0x84, 0xdf, 0x7b, 0xad, 0x25, 0xcb, 0x50, 0xef, 0x00, 0x98, 0xcf, 0xa0,
+  0xef, 0x91, 0x0f, 0xb6, 0xed, 0xd7, 0x71, 0x87, 0x8c, 0x7f, 0x6b, 0xeb, 0xdd, 0x8e, 0xad, 0xba, 0xec, 0x8d, 0xcc, 0x3e,
+  0x84, 0xd5, 0x8e, 0xda, 0x66, 0x0e, 0xc2, 0x09, 0x8b, 0xda, 0xdd, 0x8a, 0x80, 0xa6, 0x2d, 0x87, 0xc9, 0x43, 0x01, 0x6b,
+  0x23, 0xad, 0x0d, 0x5d, 0xd6, 0x79, 0x22, 0x58, 0xd2, 0x25, 0x7c, 0x95, 0x52, 0x70, 0x30, 0x74, 0x52, 0x92, 0x85, 0x20,
+  0x4c, 0x5d, 0xe7, 0xfa, 0x17, 0xb1, 0x04, 0xc5, 0x6b, 0xeb, 0x7c, 0xba, 0x36, 0x39, 0x41, 0xf1, 0x8b, 0x06, 0x35, 0x66,
+  0x19, 0xdd, 0xb7, 0x06, 0x59, 0x6c, 0x86, 0x55, 0x28, 0xf9, 0x5b, 0xbb, 0x46, 0x9c, 0xf5, 0x7a, 0xe3, 0x4e, 0x36, 0xe2,
+  0x3d, 0xe6, 0x5a, 0x36, 0x1e, 0xec, 0xcd, 0x27, 0x6e, 0x71, 0xfe, 0xbf, 0xf3, 0xc8, 0x62, 0x04, 0xbb, 0xa3, 0x59, 0x6f,
+  0xf2, 0x2f, 0x2e, 0x2e, 0x4c, 0x7b, 0x9f, 0xf2, 0xdb, 0x07, 0xec, 0xcb, 0x2a, 0xd4, 0x77, 0x43, 0x19, 0x43, 0xd0, 0x59,
+  0x5d, 0xe0, 0xbd, 0x71, 0x56, 0xcf, 0xa4, 0xb3, 0xa2, 0xe2, 0x30, 0xf0, 0xee, 0x4a, 0x4b, 0x2b, 0xf8, 0xab, 0x34, 0x45,
+  0x1c, 0x81, 0x81, 0xfa, 0x41, 0xfa, 0x31, 0x6e, 0xef, 0x9c, 0x27, 0x89, 0xaa, 0xcf, 0x53, 0xb4, 0x1f, 0x9b, 0x4e, 0xdb,
+  0xcf, 0x6f, 0x92, 0x40, 0xab, 0x43, 0xe0, 0xe5, 0x2c, 0x7e, 0xed, 0xa6, 0xb4, 0x7d, 0xe6, 0x17, 0x52, 0x88, 0xfc, 0x41,
+  0x14, 0xe2, 0x30, 0x65, 0xdb, 0xf8, 0x51, 0xc1, 0x67, 0xb6, 0x9a, 0xac, 0x54, 0x97, 0xf3, 0xd4, 0xce, 0x96, 0x81, 0x90,
+  0x87, 0x92, 0x7c, 0xbc, 0x04, 0xd0, 0xfb, 0x7b, 0x9e, 0x26, 0xba, 0xa9, 0xac, 0xb9, 0x00, 0xa4, 0xd8, 0x08, 0xee, 0x18,
+  0x56, 0x22, 0x2d, 0x56, 0xdb, 0xb7, 0x0d, 0x74, 0x1a, 0x8b, 0xaf, 0xb4, 0x6b, 0x35, 0xd9, 0x6d, 0x48, 0x8e, 0x16, 0xde,
+  0x36, 0x63, 0x38, 0x9d, 0x00, 0x31, 0xf8, 0x3c, 0x67, 0x39, 0xc6, 0x45, 0x0c, 0xab, 0xd6, 0x60, 0xd2, 0x02, 0x6b, 0x98,
+  0x30, 0x6c, 0x43, 0xf0, 0xf5, 0x78, 0x16, 0xc9, 0x2e, 0xd3, 0xbc, 0x38, 0x25, 0x9b, 0x05, 0x2c, 0x86, 0xdf, 0xad, 0x13,
+  0xe5, 0xec, 0xbb, 0xe4, 0x00, 0xb7, 0x25, 0x4b, 0xc3, 0x41, 0x37, 0xb1, 0xde, 0x99, 0xe0, 0x3b, 0xb3, 0x78, 0x4f, 0x4c,
+  0xfb, 0x1a, 0x0d, 0xe1, 0x84, 0x56, 0x3c, 0xff, 0x64, 0x5f, 0xd3, 0x0e, 0x4f, 0x67, 0xe8, 0x89, 0xf0, 0xc9, 0x74, 0x46,
+  0x3b, 0xd8, 0xf0, 0x4e, 0x55, 0x4c, 0x7f, 0x00, 0x29, 0x9a, 0x40, 0xf6, 0xf7, 0x2d, 0x24, 0x3a, 0x01, 0x9d, 0xb0, 0x82,
+  0x31, 0xaf, 0x7a, 0xdd, 0xbe, 0xd3, 0x88, 0x7e, 0x37, 0x16, 0x91, 0x4a, 0xc5, 0x55, 0xef, 0x43, 0x65, 0xfd, 0x86, 0x9f,
+  0x53, 0xa5, 0x19, 0xa8, 0xf3, 0x34, 0xa3, 0xfe, 0xfb, 0x72, 0xc0, 0xed, 0x67, 0x32, 0x12, 0x77, 0xb5, 0x83, 0x8f, 0xc0,
+  0x96, 0x9f, 0xe9, 0xf4, 0x2a, 0x0d, 0xde, 0x53, 0x76, 0xa0, 0x92, 0xf0, 0x2f, 0x4f, 0xd1, 0xee, 0xf9, 0x61, 0x7a, 0xb0,
+  0x96, 0xe5, 0x0a, 0x5e, 0xd2, 0x15, 0xe3, 0xd8, 0x97, 0xd9, 0x7f, 0xf0, 0xe3, 0xca, 0x08, 0x64, 0x17, 0xac, 0x5f, 0xdb,
+  0x8f, 0x78, 0xbd, 0xaa, 0x19, 0x63, 0xd5, 0xb0, 0xf8, 0x4a, 0x0a, 0xc5, 0x4a, 0x98, 0xbc, 0xca, 0xd2, 0x22, 0x0d, 0x52,
+  0x9c, 0xbf, 0x81, 0x28, 0x2f, 0xdd, 0xf4, 0xe2, 0x34, 0x60, 0xdf, 0x92, 0xdb, 0x2b, 0xbb, 0xb0, 0xa2, 0x86, 0xdf, 0x62,
+  0x02, 0xc4, 0xc0, 0x52, 0xc9, 0x26, 0xc7, 0x87, 0x13, 0x7c, 0x38, 0xb1, 0x4e, 0xeb, 0x36, 0xf9, 0xdb, 0x0c, 0x61, 0xbd,
+  0xbb, 0xf7, 0x51, 0x4e, 0xbf, 0xed, 0xf7, 0xef, 0x7d, 0xb4, 0x61, 0x2f, 0x40, 0x76, 0x6f, 0xfb, 0x0a, 0xad, 0x77, 0x96,
+  0x6d, 0xe4, 0x54, 0x03, 0x61, 0x2f, 0x11, 0x67, 0x90, 0xdb, 0x95, 0x71, 0x3d, 0xb0, 0x80, 0x20, 0x1f, 0xe8, 0x2d, 0x1c,
+  0x7e, 0x04, 0x59, 0x0b, 0xc4, 0x6a, 0x35, 0x2b, 0x3c, 0xa2, 0xa1, 0x6e, 0x34, 0xcc, 0xdb, 0x98, 0x7a, 0x35, 0xbb, 0xae,
+  0xf8, 0xd9, 0x6a, 0x6a, 0x5f, 0x5e, 0xac, 0x6e, 0xb7, 0x94, 0x6f, 0x05, 0xb9, 0x1c, 0xa7, 0x76, 0x36, 0x02, 0x62, 0x73,
+  0x85, 0xaf, 0x55, 0x0b, 0x4e, 0x83, 0x16, 0xc3, 0x1e, 0x4a, 0x24, 0x41, 0x97, 0x15, 0x9e, 0x86, 0x67, 0xb2, 0x24, 0xc3,
+  0xd2, 0x53, 0x4c, 0x21, 0x64, 0x57, 0x65, 0xa8, 0xae, 0x37, 0xdb, 0x04, 0x4c, 0x57, 0x1c, 0x55, 0x9a, 0xb6, 0xc5, 0x6d,
+  0xdb, 0xc2, 0xae, 0xe1, 0xfa, 0xe2, 0xdb, 0xa4, 0xb7, 0x8a, 0x80, 0x4e, 0x32, 0x9e, 0x23, 0x29, 0xfd, 0x61, 0xb9, 0x7f,
+  0x66, 0xa0, 0x5a, 0xd1, 0x2d, 0x07, 0xa2, 0x58, 0x24, 0x4d, 0xd7, 0x85, 0x63, 0xac, 0x8e, 0xe5, 0x76, 0x2d, 0x35, 0xac,
+  0x8b, 0x4b, 0x28, 0xe5, 0x91, 0x12, 0xc8, 0x25, 0x58, 0x67, 0xac, 0x1b, 0x18, 0xc2, 0x69, 0xda, 0x76, 0xcb, 0x24, 0xfe,
+  0xc7, 0xd5, 0xcb, 0x17, 0xbd, 0x15, 0xfe, 0xb3, 0x1e, 0x7c, 0x6e, 0xaf, 0x62, 0xf7, 0xb4, 0x47, 0x24, 0xcb, 0x82, 0x06,
+  0xef, 0x71, 0xfb, 0x51, 0xd1, 0xcc, 0xb9, 0xf7, 0xe1, 0xa0, 0xc0, 0x96, 0xb1, 0x73, 0x15, 0xfc, 0x60, 0x59, 0x4d, 0xed,
+  0xa2, 0x2a, 0x9e, 0x33, 0x80, 0xc4, 0xd2, 0x19, 0x44, 0x32, 0xa1, 0x49, 0xaf, 0x9d, 0x2e, 0x92, 0x5b, 0x57, 0x16, 0x0c,
+  0x29, 0xa8, 0x6c, 0xc9, 0xad, 0x40, 0xb7, 0x99, 0xf4, 0x92, 0xf3, 0xf5, 0x56, 0xbb, 0xc6, 0x6e, 0x23, 0xc9, 0x50, 0x99,
+  0x4a, 0x3d, 0x12, 0x5c, 0xa8, 0xda, 0xf0, 0x1d, 0xdc, 0xe3, 0x5f, 0x55, 0x3b, 0x51, 0x4b, 0x3b, 0x0d, 0x8b, 0x58, 0xbb,
+  0x5c, 0x8d, 0x35, 0x38, 0xfc, 0x85, 0x6b, 0x85, 0x20, 0x4e, 0x99, 0x2b, 0xdd, 0xd3, 0x6a, 0x85, 0x51, 0xbe, 0x87, 0xe1,
+  0x32, 0x0e, 0x08, 0x3f, 0xcb, 0x72, 0xf1, 0xf7, 0xbd, 0x6b, 0x2c, 0xd7, 0x13, 0xc8, 0xad, 0xd9, 0x0b, 0x90, 0xf2, 0x0a,
+  0x7a, 0x59, 0x0a, 0x10, 0x2e, 0x79, 0xab, 0x99, 0xaa, 0x1a, 0x1f, 0xc8, 0x58, 0x94, 0xf5, 0x28, 0xc3, 0x42, 0xf6, 0x05,
+  0xeb, 0x5e, 0xbb, 0xce, 0x2a, 0x7d, 0xb3, 0xd3, 0x2c, 0xb9, 0x0d, 0x4d, 0x65, 0x31, 0x94, 0xc3, 0x0e, 0xbe, 0xf0, 0xe3,
+  0x5e, 0x4b, 0xdf, 0xf9, 0x1b, 0x50, 0x5b, 0xd8, 0x73, 0x69, 0x81, 0xfc, 0x19, 0x1e, 0x97, 0x8d, 0xe5, 0x75, 0x74, 0x13,
+  0xc1, 0x1d, 0xc6, 0xc8, 0x65, 0x61, 0x00, 0x39, 0x69, 0x9e, 0x6c, 0xd7, 0xcd, 0xee, 0x0a, 0x7b, 0xf5, 0x12, 0x5c, 0x06,
+  0x24, 0x4f, 0xf9, 0x3f, 0xe6, 0xc3, 0x5e, 0x83, 0xe0, 0xe1, 0x80, 0x16, 0x6a, 0x9f, 0x96, 0x2d, 0x3c, 0xde, 0x3c, 0x2d,
+  0x0b, 0xb4, 0x7c, 0x77, 0x72, 0x6f, 0x1f, 0x22, 0xbf, 0x54, 0x25, 0x59, 0xab, 0xb5, 0xa2, 0x89, 0x72, 0xf2, 0x15, 0x3b,
+  0x36, 0x66, 0x61, 0xa7, 0x74, 0x6a, 0x7e, 0x8e, 0x12, 0x19, 0x33, 0x49, 0x69, 0xb1, 0x73, 0xa1, 0x29, 0x55, 0x87, 0x46,
+  0x40, 0xa1, 0x8a, 0x53, 0xce, 0xf9, 0x21, 0xc5, 0x27, 0x09, 0xc8, 0xa7, 0x31, 0xfb, 0xac, 0x2f, 0x5f, 0xe7, 0x38, 0xeb,
+  0xf3, 0xef, 0x8a, 0x3b, 0xeb, 0xf3, 0x7f, 0x77, 0xe9, 0x7f, 0x00, 0x5e, 0x27, 0x0a, 0xdf, 0x88, 0x69, 0x00, 0x00,
+};
+static const WebAsset WEB_ASSET_CONSOLE = {"/console", "text/html", WEB_ASSET_CONSOLE_GZ, sizeof(WEB_ASSET_CONSOLE_GZ), "\"bf78944d9b5868ad\""};
+
+// web/pid.html: 21766 bytes, 5591 gzipped
+static const uint8_t WEB_ASSET_PID_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x5c, 0x7b, 0x77, 0xda, 0x48, 0x96, 0xff, 0x3f, 0x9f,
+  0xa2, 0x42, 0x66, 0x1a, 0xe8, 0x20, 0x10, 0x18, 0x1c, 0x07, 0x0c, 0xbd, 0x8e, 0x3b, 0xde, 0xce, 0x76, 0xd2, 0xf1, 0xc4,
+  0xee, 0xee, 0xb3, 0xdb, 0xdb, 0x67, 0x52, 0x48, 0x05, 0xa8, 0x2d, 0x24, 0x1d, 0x49, 0xd8, 0x66, 0x33, 0xfe, 0xee, 0x7b,
+  0x6f, 0x3d, 0xa4, 0x2a, 0x3d, 0x30, 0x76, 0x9c, 0x5d, 0x67, 0x06, 0xa4, 0x7a, 0xdd, 0x5b, 0xf7, 0xf1, 0xab, 0x7b, 0xab,
+  0x8a, 0x3e, 0x7e, 0xfe, 0xe3, 0xc7, 0xd3, 0xcb, 0xff, 0x3c, 0x7f, 0x4b, 0x56, 0xe9, 0xda, 0x9f, 0x3d, 0x3b, 0xc6, 0x2f,
+  0xe2, 0xd3, 0x60, 0x39, 0x6d, 0xb0, 0xa0, 0x81, 0x05, 0x8c, 0xba, 0xb3, 0x67, 0x84, 0x1c, 0xaf, 0x59, 0x4a, 0x89, 0xb3,
+  0xa2, 0x71, 0xc2, 0xd2, 0x69, 0xe3, 0xd7, 0xcb, 0x33, 0xeb, 0xa8, 0x91, 0x57, 0x04, 0x74, 0xcd, 0xa6, 0x8d, 0x6b, 0x8f,
+  0xdd, 0x44, 0x61, 0x9c, 0x36, 0x88, 0x13, 0x06, 0x29, 0x0b, 0xa0, 0xe1, 0x8d, 0xe7, 0xa6, 0xab, 0xa9, 0xcb, 0xae, 0x3d,
+  0x87, 0x59, 0xfc, 0xa5, 0x43, 0xbc, 0xc0, 0x4b, 0x3d, 0xea, 0x5b, 0x89, 0x43, 0x7d, 0x36, 0xed, 0x77, 0x6d, 0x31, 0x50,
+  0xea, 0xa5, 0x3e, 0x9b, 0x9d, 0xbf, 0xfb, 0x91, 0xfc, 0x1e, 0xc6, 0x57, 0x0b, 0x3f, 0xbc, 0x39, 0xee, 0x89, 0x32, 0xac,
+  0x4d, 0xd2, 0xad, 0x78, 0x22, 0xe4, 0x7b, 0xf2, 0x85, 0xac, 0x69, 0xbc, 0xf4, 0x82, 0x31, 0xb1, 0x27, 0x24, 0xa2, 0xae,
+  0xeb, 0x05, 0x4b, 0xfe, 0x3c, 0x0f, 0x6f, 0xad, 0xc4, 0xfb, 0x1f, 0xfe, 0x3a, 0x0f, 0x63, 0x97, 0xc5, 0x16, 0x14, 0x4d,
+  0xc8, 0x1d, 0xef, 0x38, 0x0f, 0xdd, 0x2d, 0xf4, 0x5d, 0x00, 0x73, 0xd6, 0x82, 0xae, 0x3d, 0x7f, 0x3b, 0x26, 0xcd, 0x0b,
+  0xb6, 0x0c, 0x19, 0xf9, 0xf5, 0x5d, 0xb3, 0x43, 0xde, 0x01, 0xd3, 0x71, 0x87, 0x58, 0x34, 0x8a, 0x7c, 0x66, 0x25, 0xdb,
+  0x24, 0x65, 0xeb, 0x0e, 0x49, 0x68, 0x90, 0x58, 0x09, 0x8b, 0xbd, 0x05, 0x8c, 0x4f, 0x9d, 0xab, 0x65, 0x1c, 0x6e, 0x02,
+  0x77, 0x4c, 0x5e, 0x1c, 0xf0, 0xbf, 0x09, 0x4c, 0xd6, 0x0f, 0x63, 0x78, 0x3f, 0xe3, 0x7f, 0x1a, 0x43, 0x03, 0x3b, 0x02,
+  0xda, 0xbe, 0x17, 0x30, 0x6b, 0xc5, 0xbc, 0xe5, 0x2a, 0x1d, 0x93, 0x7e, 0x77, 0xa4, 0xb8, 0xe9, 0xa6, 0x61, 0x14, 0xd0,
+  0x6b, 0x3e, 0x99, 0x5b, 0x21, 0x1b, 0xa8, 0xef, 0xdb, 0xbc, 0x53, 0x36, 0x3f, 0x42, 0x37, 0x69, 0x28, 0x47, 0xca, 0x06,
+  0xee, 0x0f, 0xf1, 0xd5, 0xf5, 0x92, 0xc8, 0xa7, 0xdb, 0xf1, 0xc2, 0x67, 0xf0, 0x86, 0x9f, 0xd6, 0x4d, 0x4c, 0xa3, 0x31,
+  0x7e, 0x4c, 0xc8, 0x12, 0x9e, 0xfa, 0xbc, 0x9b, 0xc6, 0xf4, 0x8b, 0xc1, 0x8f, 0xf8, 0x6f, 0x92, 0x0b, 0x27, 0x4d, 0xc3,
+  0xf5, 0x78, 0x10, 0xdd, 0x92, 0x24, 0xf4, 0x3d, 0x97, 0xbc, 0x18, 0x0e, 0x87, 0x13, 0x42, 0x7d, 0x6f, 0x19, 0x58, 0x1e,
+  0x4c, 0x3f, 0x19, 0x3b, 0x0c, 0xa5, 0x52, 0x60, 0xda, 0xf2, 0xc3, 0x65, 0x08, 0x9c, 0x9b, 0x2c, 0x54, 0x75, 0xcb, 0xd9,
+  0x10, 0x53, 0xb2, 0x62, 0x2e, 0x08, 0x9c, 0xd5, 0x44, 0x68, 0xe2, 0x46, 0x88, 0xe6, 0xb5, 0x6d, 0xcb, 0x02, 0x50, 0x20,
+  0x1b, 0x8b, 0x19, 0x0b, 0xd1, 0xbe, 0xb0, 0xed, 0xd7, 0xaf, 0x91, 0xaf, 0x94, 0xdd, 0xa6, 0x56, 0x1a, 0x83, 0x42, 0x16,
+  0x61, 0xbc, 0x1e, 0x6f, 0xa2, 0x88, 0xc5, 0x0e, 0x4d, 0x18, 0x08, 0x99, 0xa5, 0x40, 0xce, 0x4a, 0x22, 0xea, 0xa0, 0x84,
+  0xfa, 0xd1, 0x6d, 0x51, 0xcc, 0x54, 0x63, 0xd7, 0x0b, 0xb8, 0x52, 0xea, 0xb9, 0xfe, 0x6b, 0x93, 0xa4, 0xde, 0x62, 0x6b,
+  0x49, 0x3b, 0xce, 0xca, 0xd7, 0x30, 0x01, 0xa1, 0x29, 0xa9, 0x27, 0xa5, 0x92, 0x3e, 0x8a, 0xb0, 0x7f, 0xc8, 0xc5, 0x2d,
+  0x44, 0x1b, 0x53, 0xd7, 0xdb, 0x24, 0x63, 0xdb, 0x94, 0xff, 0xc1, 0x09, 0xfe, 0xcb, 0x26, 0x76, 0xca, 0xff, 0xe4, 0xc4,
+  0x5c, 0xe6, 0x84, 0x31, 0x4d, 0xbd, 0x30, 0x18, 0x07, 0x61, 0xc0, 0x4c, 0xf1, 0xbc, 0x42, 0xf1, 0xd4, 0xcf, 0x3f, 0x17,
+  0x9c, 0xb0, 0x0d, 0xde, 0xc8, 0xe3, 0x63, 0x11, 0xbb, 0x3b, 0x48, 0x4a, 0xd2, 0x18, 0xaf, 0xc2, 0x6b, 0x16, 0x83, 0x4c,
+  0x74, 0xee, 0x86, 0xfc, 0x2f, 0xe3, 0x8e, 0x5b, 0x73, 0xa1, 0x5f, 0x97, 0x3a, 0xa9, 0x77, 0xcd, 0x0a, 0x1d, 0x95, 0x82,
+  0x64, 0xc7, 0xc5, 0x62, 0x91, 0x75, 0x8c, 0xe8, 0x92, 0xed, 0x63, 0xe3, 0xb9, 0x3d, 0x93, 0x65, 0xec, 0xb9, 0x13, 0xfe,
+  0x69, 0x81, 0x56, 0xa0, 0x2c, 0x65, 0xa0, 0x09, 0x7f, 0xb3, 0x0e, 0x92, 0x31, 0xaa, 0x00, 0xc6, 0x6a, 0xd9, 0x1d, 0xd2,
+  0x5f, 0xc4, 0x6d, 0x61, 0x60, 0x52, 0xf2, 0x92, 0xa2, 0x43, 0x63, 0xd7, 0xe4, 0x8f, 0x14, 0xec, 0x7e, 0x4c, 0x84, 0x80,
+  0xa5, 0xaa, 0x60, 0x6e, 0x63, 0x32, 0x2c, 0xf8, 0x40, 0xc1, 0x8b, 0xf5, 0xd9, 0xcc, 0xc8, 0xf7, 0x1d, 0x90, 0xc8, 0x4d,
+  0x88, 0x5c, 0xe1, 0x1b, 0xce, 0x2f, 0xb3, 0x0c, 0xc4, 0x21, 0xd1, 0x7a, 0xd5, 0xef, 0x90, 0xd5, 0x20, 0x43, 0x2b, 0x41,
+  0xc7, 0xce, 0x01, 0x83, 0x8b, 0xa9, 0xa0, 0x53, 0x52, 0x54, 0xaa, 0xd4, 0x3f, 0x39, 0x32, 0xfd, 0xc3, 0x60, 0x6b, 0xd5,
+  0x57, 0xb0, 0x26, 0xeb, 0xb8, 0x0d, 0x18, 0xdd, 0xb9, 0x7b, 0x89, 0xd6, 0x3e, 0x9d, 0x33, 0x5f, 0xf3, 0x06, 0x32, 0xf7,
+  0x43, 0xe7, 0x2a, 0xd7, 0x07, 0xb7, 0x65, 0x9b, 0x0c, 0x73, 0x07, 0x24, 0x2f, 0x4e, 0x4e, 0x4e, 0x0c, 0xea, 0xfd, 0x83,
+  0x12, 0x85, 0x79, 0xe8, 0xbb, 0x3b, 0xa7, 0x23, 0xa8, 0x7b, 0x41, 0xb4, 0x49, 0x81, 0xba, 0x32, 0x06, 0xdb, 0xfe, 0xbb,
+  0x8e, 0x6c, 0x83, 0xb2, 0x0b, 0x09, 0x60, 0x17, 0x7a, 0xeb, 0x17, 0xb4, 0x64, 0x2a, 0x99, 0xff, 0x19, 0x80, 0x5c, 0xc9,
+  0xa3, 0xc6, 0xc8, 0x78, 0x11, 0x3a, 0x9b, 0x04, 0xd8, 0x09, 0x37, 0x29, 0x62, 0x42, 0xc1, 0x32, 0xd4, 0x48, 0xca, 0xbe,
+  0xe5, 0x3a, 0xb2, 0x01, 0xd4, 0x0c, 0x0a, 0x7a, 0x15, 0x7e, 0x57, 0x33, 0xab, 0x61, 0x3e, 0xab, 0x02, 0x05, 0x6d, 0x8e,
+  0x06, 0xa7, 0xdc, 0xdf, 0x9d, 0x4d, 0x9c, 0x20, 0xfd, 0x28, 0xf4, 0x04, 0xfe, 0xec, 0x90, 0x6e, 0x9d, 0xc7, 0x0b, 0x66,
+  0xc7, 0xa0, 0x6c, 0x3a, 0xf7, 0x19, 0x3a, 0x46, 0x88, 0x20, 0x99, 0x6e, 0xb1, 0xd9, 0x70, 0x94, 0x13, 0x09, 0xc2, 0xd4,
+  0xa2, 0x3e, 0x2c, 0xbb, 0xcc, 0xcd, 0xcd, 0x3d, 0xf6, 0x60, 0x8e, 0xdb, 0xa2, 0x37, 0x99, 0xee, 0x4e, 0x4c, 0x7f, 0x17,
+  0x5d, 0xaa, 0xf0, 0x05, 0x3b, 0xbe, 0x3a, 0x39, 0x38, 0xcc, 0xda, 0x26, 0x80, 0x78, 0x81, 0x5b, 0x41, 0xc0, 0x04, 0x22,
+  0x93, 0x40, 0xd6, 0xa9, 0x9a, 0xc4, 0x88, 0xff, 0xe5, 0xb8, 0xc5, 0x62, 0x08, 0x36, 0xca, 0x14, 0x4e, 0x4f, 0x6d, 0xdb,
+  0xb6, 0xab, 0x29, 0xa8, 0x3e, 0xd5, 0x04, 0x4e, 0x0e, 0x44, 0x4f, 0xd9, 0x18, 0xc4, 0x86, 0xf8, 0xb6, 0xdb, 0x51, 0x74,
+  0x43, 0x39, 0xaa, 0xf1, 0x1c, 0x39, 0x5e, 0x1c, 0xde, 0xe8, 0xbe, 0xb9, 0x13, 0x0b, 0x63, 0x16, 0x31, 0x9a, 0xb6, 0x0e,
+  0x4c, 0x2c, 0xd4, 0xf1, 0x4a, 0x81, 0xd4, 0x03, 0x47, 0x44, 0x40, 0xb6, 0x16, 0x5e, 0xda, 0x51, 0x70, 0x3b, 0x38, 0x82,
+  0x51, 0x05, 0x99, 0x4a, 0xcc, 0x15, 0x56, 0x66, 0x3d, 0x82, 0xf9, 0x41, 0xa7, 0x00, 0xe9, 0x95, 0xf3, 0x48, 0x52, 0x9a,
+  0x6e, 0x12, 0x0b, 0x87, 0xfa, 0xea, 0xb9, 0xf4, 0x2b, 0xe6, 0x62, 0x17, 0xb5, 0x64, 0xcc, 0x0e, 0x62, 0xdc, 0xd8, 0x73,
+  0x4a, 0x6b, 0x8a, 0x84, 0x9b, 0x3a, 0x6c, 0x2a, 0x80, 0x9a, 0x31, 0x96, 0xa5, 0x40, 0xb8, 0xd6, 0x6e, 0x78, 0x9f, 0x1d,
+  0xfe, 0x5e, 0x88, 0x78, 0xc0, 0x99, 0xed, 0x21, 0x5b, 0xef, 0xb2, 0x2c, 0x49, 0xf9, 0x9a, 0xfa, 0x1b, 0xdd, 0x62, 0xb9,
+  0xe5, 0x97, 0x16, 0x96, 0xf2, 0xe2, 0xa1, 0x4b, 0xc7, 0x58, 0x6e, 0x21, 0x29, 0x48, 0x8b, 0x60, 0x78, 0x58, 0x08, 0x3c,
+  0x1f, 0x2b, 0x2d, 0x31, 0xb8, 0x43, 0x83, 0x6b, 0x9a, 0x14, 0x17, 0x0d, 0x15, 0x53, 0x0f, 0x0e, 0x6d, 0x3d, 0x1c, 0x56,
+  0xcb, 0x99, 0x1c, 0xc1, 0x67, 0x4b, 0x16, 0x18, 0x46, 0x23, 0xc2, 0x3e, 0xa1, 0xf7, 0xa3, 0x92, 0xde, 0xed, 0x9d, 0xcb,
+  0xde, 0xe0, 0xb1, 0xcb, 0x9e, 0xe2, 0x03, 0xf4, 0x15, 0xe8, 0xcc, 0xd4, 0x86, 0xa2, 0x44, 0x8f, 0xa0, 0x05, 0x68, 0x94,
+  0x47, 0x1a, 0x8f, 0xe7, 0x0c, 0x08, 0x0a, 0x75, 0x8a, 0x50, 0x95, 0x34, 0x1a, 0xf9, 0x32, 0xc4, 0xbb, 0x29, 0x39, 0x1d,
+  0x54, 0x2f, 0xad, 0x45, 0x56, 0x2a, 0xc5, 0x87, 0x61, 0xdf, 0x86, 0xfa, 0x1a, 0xbd, 0x02, 0xae, 0x8f, 0x6c, 0x2d, 0x58,
+  0x54, 0x9d, 0x20, 0x57, 0xe4, 0x4b, 0x57, 0x5d, 0x37, 0x95, 0x31, 0x89, 0x6e, 0x29, 0x2e, 0x50, 0x45, 0x25, 0xe7, 0x0b,
+  0xb1, 0x4f, 0xa3, 0x04, 0x54, 0xa0, 0x9e, 0xea, 0xdd, 0x15, 0x73, 0xcc, 0x14, 0x35, 0xce, 0x95, 0xc2, 0x65, 0x3a, 0x06,
+  0x77, 0x59, 0xa4, 0xba, 0x91, 0xd9, 0x9a, 0x30, 0x64, 0x16, 0x54, 0x32, 0x49, 0x5d, 0xf1, 0xc3, 0x9d, 0xa8, 0x9d, 0xae,
+  0x8a, 0xae, 0x7c, 0x5f, 0x58, 0xa7, 0xdb, 0x93, 0xc2, 0xb8, 0x35, 0x2c, 0xbf, 0x66, 0x20, 0x27, 0xea, 0x8d, 0x81, 0x45,
+  0xe3, 0x7f, 0x5b, 0x33, 0xd7, 0xa3, 0xa4, 0xa5, 0x85, 0xd5, 0x43, 0x84, 0xb5, 0x36, 0xf9, 0xc2, 0xeb, 0x55, 0xb2, 0x2b,
+  0x5f, 0x48, 0xc1, 0xbd, 0x64, 0xf1, 0x9d, 0xfc, 0xce, 0x52, 0xd1, 0xdd, 0xcd, 0x49, 0x6e, 0x8b, 0xd5, 0x03, 0xc8, 0xb4,
+  0x30, 0x6b, 0xae, 0x6b, 0x32, 0x2b, 0x34, 0xf2, 0x40, 0x30, 0xc0, 0xac, 0xa2, 0x98, 0x74, 0x29, 0x0f, 0xc8, 0x1a, 0xe8,
+  0x82, 0xa9, 0x67, 0x02, 0x33, 0xbd, 0xbc, 0x0b, 0xf8, 0x15, 0xb4, 0x86, 0x7f, 0x0e, 0xf5, 0x9d, 0xd6, 0xc8, 0xfe, 0x3b,
+  0xb1, 0x70, 0x02, 0x6d, 0x8d, 0x1f, 0x3d, 0x72, 0xaf, 0x16, 0x80, 0x30, 0x97, 0x4a, 0x3e, 0xaa, 0xa4, 0x29, 0x12, 0x90,
+  0x8a, 0xa1, 0x0e, 0x2b, 0x1a, 0xc3, 0x92, 0xd9, 0x51, 0xcf, 0xf9, 0x2a, 0x9a, 0x15, 0x69, 0x0b, 0x5f, 0x56, 0x96, 0x2d,
+  0xea, 0xb9, 0x5e, 0xaa, 0x57, 0x40, 0x58, 0xe2, 0x4a, 0xf4, 0x14, 0x1e, 0x66, 0x7d, 0xcd, 0xc5, 0xf4, 0x5e, 0x55, 0x4b,
+  0x2f, 0x2d, 0x77, 0x17, 0xb8, 0x91, 0x95, 0x63, 0xe8, 0x84, 0x9b, 0x38, 0x16, 0xc8, 0x9f, 0xe7, 0x77, 0xb9, 0x55, 0xac,
+  0x00, 0xe1, 0xf8, 0xc2, 0xc5, 0xc3, 0x6d, 0xbe, 0x5d, 0x61, 0x10, 0xc1, 0xcf, 0xe3, 0x9e, 0xdc, 0xf1, 0x39, 0xee, 0x89,
+  0x3d, 0xa8, 0x63, 0x34, 0x68, 0xbe, 0x15, 0x84, 0x3a, 0x76, 0x7c, 0x9a, 0x24, 0xd3, 0x86, 0xd0, 0x78, 0x43, 0xec, 0x0b,
+  0x1d, 0xbb, 0x5e, 0xa1, 0x82, 0xdb, 0xa3, 0xac, 0xc5, 0x3d, 0xa4, 0xeb, 0xa5, 0x30, 0xc9, 0x69, 0x63, 0x30, 0x6c, 0x48,
+  0x5c, 0x14, 0xcf, 0xb8, 0x75, 0xf5, 0x26, 0xbc, 0x9d, 0x36, 0x6c, 0xc8, 0x7c, 0x06, 0x43, 0x82, 0x65, 0x0b, 0xcf, 0xf7,
+  0xa7, 0x0d, 0x8c, 0xd6, 0x1b, 0xe4, 0x76, 0xed, 0x07, 0x30, 0xec, 0x2a, 0x4d, 0xa3, 0x71, 0xaf, 0x77, 0x73, 0x73, 0xd3,
+  0xbd, 0x39, 0xe8, 0x86, 0xf1, 0xb2, 0x37, 0x80, 0x58, 0xb0, 0x07, 0x03, 0x67, 0x54, 0x80, 0x4e, 0x44, 0x01, 0x0f, 0xdc,
+  0x69, 0xe3, 0xc3, 0xb0, 0x3b, 0xea, 0xf4, 0x6d, 0x72, 0x3a, 0xc0, 0xef, 0x11, 0x79, 0xdd, 0xe9, 0xbf, 0x02, 0x8b, 0xc1,
+  0xcf, 0xd3, 0xfe, 0x08, 0xbf, 0x06, 0x7d, 0x51, 0xd3, 0x7f, 0x2d, 0x5b, 0xf6, 0x5f, 0xc1, 0x03, 0xbc, 0xf7, 0x3b, 0x07,
+  0xe4, 0x08, 0xfe, 0x7f, 0x3a, 0x82, 0x8f, 0x43, 0x5e, 0x26, 0x07, 0xfb, 0x2f, 0xc5, 0x98, 0x8c, 0xc2, 0x1b, 0xa4, 0x57,
+  0x45, 0x9a, 0xb7, 0xfd, 0x07, 0x12, 0x1b, 0xc2, 0xe8, 0x9d, 0xd7, 0x0d, 0x92, 0xa4, 0x71, 0x78, 0xc5, 0xa0, 0x9f, 0xc8,
+  0x85, 0x55, 0x81, 0x25, 0x25, 0x02, 0x9c, 0x98, 0x53, 0xae, 0x1c, 0x16, 0xa6, 0x70, 0x44, 0xfe, 0x71, 0xd4, 0x19, 0xd8,
+  0xe0, 0x13, 0x9d, 0xc1, 0x40, 0x1b, 0x56, 0xb1, 0x63, 0x0e, 0x3b, 0x30, 0x07, 0x95, 0x95, 0xb8, 0xd0, 0x38, 0x34, 0x9a,
+  0x36, 0xf8, 0x4a, 0x50, 0x43, 0x0b, 0x99, 0x7f, 0x0d, 0x73, 0xe8, 0x77, 0x06, 0xe0, 0xc0, 0x07, 0x9d, 0xc1, 0xc1, 0x37,
+  0xa5, 0x36, 0xe2, 0x53, 0xeb, 0x0f, 0xf9, 0xdc, 0x0e, 0xbf, 0xc1, 0xdc, 0x8e, 0xd1, 0x4e, 0xd4, 0xcb, 0xa7, 0x90, 0x26,
+  0x00, 0x6e, 0xe4, 0x14, 0xb0, 0x24, 0x0e, 0x7d, 0x61, 0xc0, 0x3d, 0xb0, 0x60, 0x69, 0xcb, 0x94, 0xac, 0x62, 0xb6, 0x98,
+  0x36, 0x7a, 0x8d, 0x19, 0x34, 0x81, 0x55, 0x89, 0x1d, 0xf7, 0x68, 0xb1, 0x2e, 0x8a, 0x43, 0x60, 0x80, 0x35, 0x66, 0xe7,
+  0xe2, 0x21, 0xd1, 0xdb, 0x48, 0x4f, 0x10, 0xfb, 0x35, 0x8d, 0xac, 0x8b, 0xe7, 0x36, 0x70, 0x93, 0xb5, 0x62, 0xb4, 0x4d,
+  0xe4, 0x02, 0x7a, 0x34, 0x66, 0xbf, 0xf2, 0xef, 0x8a, 0x06, 0x62, 0x47, 0x14, 0xe6, 0x77, 0xd5, 0x98, 0x5d, 0xf0, 0xe7,
+  0xf7, 0xf0, 0x2c, 0x1b, 0x1e, 0xf7, 0xc0, 0xe1, 0xf8, 0x83, 0xe6, 0x86, 0xb8, 0x5d, 0x52, 0xe1, 0x9d, 0x08, 0x90, 0xb9,
+  0x5b, 0xae, 0xfa, 0x85, 0x5d, 0x5f, 0x28, 0x50, 0x75, 0x91, 0xea, 0x82, 0x69, 0x56, 0x63, 0x76, 0x12, 0x45, 0xfe, 0x16,
+  0x56, 0x90, 0x00, 0x62, 0x11, 0x40, 0x28, 0x2f, 0x48, 0x00, 0x7f, 0x62, 0xe6, 0xa4, 0xfe, 0xb6, 0x43, 0xc2, 0x98, 0xc4,
+  0x9b, 0x00, 0xd6, 0x62, 0x06, 0xaa, 0x60, 0x91, 0x15, 0xb3, 0x24, 0x02, 0xd1, 0x31, 0x82, 0xa3, 0xa7, 0x9b, 0x00, 0x30,
+  0x98, 0xdc, 0x48, 0x22, 0x5d, 0x72, 0x09, 0xcd, 0xa0, 0x10, 0x54, 0x80, 0xdb, 0xbd, 0x1e, 0x4b, 0x20, 0x2f, 0x66, 0x01,
+  0x20, 0x46, 0x18, 0xf1, 0xee, 0x62, 0x7f, 0x20, 0x21, 0x34, 0x25, 0x03, 0x82, 0xd0, 0xca, 0x62, 0x40, 0x62, 0x88, 0x61,
+  0xe6, 0x34, 0x70, 0x93, 0x0e, 0x68, 0x1e, 0x2a, 0xcf, 0x3e, 0x9e, 0xff, 0x78, 0x49, 0xd6, 0xa1, 0xcb, 0x7c, 0x28, 0x82,
+  0x0a, 0xbe, 0xcc, 0x6c, 0x10, 0x85, 0x13, 0x72, 0xf1, 0xee, 0xc3, 0x29, 0xa7, 0xcd, 0x19, 0xed, 0x1e, 0xf7, 0xa2, 0x6c,
+  0x5a, 0x9a, 0x2c, 0x00, 0xec, 0x75, 0xec, 0xc8, 0x2c, 0x40, 0xbe, 0x8b, 0x3c, 0x01, 0x62, 0x88, 0x69, 0xe3, 0x2a, 0x6a,
+  0xcc, 0x7e, 0x8e, 0x8e, 0x7b, 0xbc, 0xc8, 0x68, 0x24, 0xf6, 0x54, 0x3c, 0x97, 0xb7, 0x21, 0xe9, 0x36, 0x02, 0x9b, 0x0d,
+  0x36, 0xeb, 0x39, 0x8b, 0x1b, 0x7c, 0x2e, 0x00, 0x6b, 0x5d, 0xbb, 0x6f, 0x1a, 0x7e, 0xcf, 0xa0, 0xb4, 0x93, 0xae, 0x07,
+  0x74, 0xbd, 0x7b, 0xe8, 0x7a, 0xdf, 0x80, 0x2e, 0xd8, 0xc8, 0xcf, 0xee, 0x3d, 0x74, 0xdd, 0xc7, 0xd0, 0x35, 0x5f, 0xe4,
+  0x76, 0x8e, 0x32, 0x59, 0xb1, 0x7f, 0xd1, 0x20, 0x61, 0xe0, 0xf8, 0x9e, 0x73, 0x05, 0x1e, 0x84, 0x46, 0x77, 0xee, 0xb9,
+  0xad, 0xb6, 0x32, 0x40, 0x54, 0xea, 0x6f, 0x98, 0x46, 0x81, 0xc3, 0x89, 0xde, 0x35, 0x06, 0xcb, 0x79, 0x14, 0x4b, 0x78,
+  0x63, 0xf6, 0x3e, 0xa4, 0x18, 0x07, 0xe0, 0x86, 0x4b, 0x0c, 0x91, 0x0d, 0x8e, 0xd2, 0xed, 0xe6, 0x66, 0x21, 0x99, 0x2a,
+  0x2f, 0x65, 0x62, 0xb5, 0x6f, 0x54, 0x19, 0x8f, 0xe1, 0x48, 0xe8, 0x4a, 0x03, 0xee, 0x4a, 0x97, 0xdc, 0xd8, 0xc1, 0x91,
+  0x06, 0x5a, 0x9d, 0x26, 0xd9, 0x05, 0x0d, 0x00, 0x56, 0x20, 0x32, 0x9e, 0x8b, 0xfd, 0x66, 0x72, 0x06, 0x49, 0xc9, 0xf9,
+  0xef, 0x1f, 0x48, 0xcb, 0xb6, 0x06, 0xa3, 0x51, 0xbb, 0x24, 0x73, 0x4d, 0xe2, 0xd8, 0xb7, 0x20, 0x72, 0x9e, 0x51, 0x02,
+  0x1c, 0x8e, 0x46, 0xa6, 0xc8, 0x91, 0x51, 0x21, 0x00, 0x16, 0x7d, 0x8c, 0x90, 0x50, 0xd2, 0xa8, 0x53, 0x76, 0x4a, 0x37,
+  0xa7, 0x8d, 0xd9, 0x77, 0xf0, 0x35, 0x39, 0x4e, 0x36, 0xf3, 0x99, 0x03, 0x68, 0x09, 0x5f, 0xc0, 0x99, 0x93, 0x82, 0x63,
+  0xb7, 0xec, 0xee, 0x81, 0x75, 0xd0, 0xb5, 0x3b, 0x04, 0x37, 0xa8, 0x62, 0x32, 0x05, 0xa7, 0x03, 0x5f, 0xa4, 0xcb, 0x25,
+  0x78, 0x79, 0x02, 0x00, 0xd7, 0xde, 0x6d, 0x27, 0x7c, 0xf8, 0x02, 0xdb, 0x10, 0xf8, 0xa1, 0xa1, 0xc0, 0xaa, 0x02, 0x51,
+  0xf4, 0xb4, 0x01, 0xa3, 0xe7, 0xd6, 0xd3, 0xcf, 0x66, 0x65, 0x77, 0x47, 0xf7, 0x19, 0xb0, 0xd2, 0x46, 0x1e, 0xbe, 0x99,
+  0xd3, 0x94, 0x06, 0x26, 0x6d, 0x21, 0x4e, 0x4f, 0x20, 0x1c, 0x42, 0xe8, 0x79, 0xc3, 0xcb, 0x1b, 0xaa, 0x7b, 0xb6, 0xb1,
+  0xa5, 0xd9, 0x9e, 0xd1, 0x1e, 0x0d, 0xf0, 0x13, 0x20, 0xdc, 0x05, 0xa2, 0xdb, 0x27, 0x1d, 0xdd, 0x94, 0xc2, 0x4d, 0x63,
+  0x2c, 0x12, 0x87, 0x34, 0xda, 0x61, 0x7e, 0x0d, 0x75, 0xb5, 0xe9, 0xa5, 0x11, 0x37, 0xdb, 0x03, 0x75, 0xa2, 0x76, 0x11,
+  0xc1, 0x78, 0xb0, 0xaa, 0x96, 0x6e, 0x51, 0x48, 0x15, 0x5e, 0xb1, 0x66, 0xe9, 0x2a, 0x74, 0x7f, 0xe1, 0xb0, 0x7e, 0x59,
+  0x82, 0x6c, 0x81, 0xcc, 0x30, 0xfb, 0xb9, 0xe7, 0x43, 0xa0, 0x5d, 0x07, 0xc3, 0xa4, 0xd5, 0x7f, 0x35, 0xea, 0x90, 0xc1,
+  0xab, 0xd1, 0x59, 0xbb, 0x93, 0x01, 0x39, 0x2c, 0x58, 0x8c, 0xa6, 0xbc, 0x3f, 0x8b, 0x3a, 0x24, 0xc6, 0x73, 0x15, 0x68,
+  0x8b, 0x0b, 0x43, 0x8e, 0xf1, 0x8a, 0x94, 0x44, 0x72, 0x0a, 0x5f, 0x71, 0x92, 0x5a, 0x22, 0x23, 0x8c, 0x7c, 0x88, 0xb9,
+  0x5d, 0x88, 0x3b, 0xad, 0xd4, 0x5b, 0x33, 0x01, 0xf0, 0x12, 0xdf, 0xc3, 0x35, 0xd8, 0x54, 0x19, 0xdd, 0x09, 0x8a, 0x09,
+  0xf7, 0x56, 0x3c, 0x57, 0xb8, 0x14, 0x2c, 0x45, 0x30, 0xea, 0x02, 0xd9, 0x70, 0x42, 0x48, 0x2a, 0x83, 0xa5, 0xbe, 0x02,
+  0x98, 0x86, 0xa3, 0x05, 0xf9, 0xa6, 0xe5, 0x68, 0x6d, 0xc4, 0xee, 0x4d, 0x63, 0x56, 0x2e, 0x13, 0x7b, 0x49, 0xb0, 0xaa,
+  0xaf, 0x20, 0xbd, 0x14, 0x92, 0xaf, 0x68, 0xc4, 0xcd, 0x59, 0x88, 0x9e, 0x4a, 0x8d, 0xf2, 0x0e, 0x8d, 0x99, 0x65, 0xc9,
+  0x4e, 0xbd, 0x22, 0x18, 0x3f, 0x8c, 0x7c, 0x1c, 0x72, 0x67, 0x7c, 0x10, 0x07, 0xb2, 0xcf, 0x93, 0x31, 0x71, 0x21, 0x77,
+  0x1c, 0x1e, 0xc2, 0x84, 0xea, 0xf3, 0x64, 0x4c, 0xbc, 0x61, 0x09, 0x47, 0xf7, 0xdd, 0x4c, 0x10, 0x9e, 0xef, 0x17, 0xe4,
+  0x81, 0x06, 0xf0, 0x34, 0x5c, 0x18, 0xe3, 0x22, 0x47, 0xef, 0x35, 0xe6, 0x4e, 0xb7, 0x8e, 0xff, 0x20, 0x53, 0xc1, 0x5e,
+  0x4f, 0x26, 0x9f, 0x8f, 0x9b, 0x14, 0xdc, 0xe8, 0x41, 0xf4, 0x65, 0x97, 0x5a, 0x16, 0x76, 0xa0, 0x72, 0x0e, 0x39, 0x99,
+  0xc2, 0x37, 0x6b, 0xbe, 0xc4, 0xcf, 0x7e, 0x09, 0x55, 0x5c, 0x88, 0x81, 0xa3, 0xc0, 0x09, 0xe6, 0x92, 0x2d, 0x4b, 0xbb,
+  0x3b, 0x06, 0xe4, 0x7b, 0x92, 0xa6, 0x9f, 0xca, 0x0d, 0x4a, 0x9d, 0xc8, 0x29, 0x6f, 0xa5, 0xf2, 0xcd, 0x57, 0x87, 0xb6,
+  0x96, 0x70, 0xc2, 0x0b, 0x4c, 0x40, 0x74, 0xaa, 0x13, 0xa3, 0xc8, 0xd3, 0x0d, 0x32, 0x98, 0xc2, 0xe2, 0xf6, 0x61, 0x1e,
+  0xd9, 0x43, 0x18, 0x0c, 0x31, 0x09, 0xff, 0x26, 0x97, 0x00, 0x8e, 0xb0, 0x68, 0x42, 0x83, 0x1d, 0x7d, 0x92, 0xcc, 0xd6,
+  0x73, 0x4f, 0x29, 0x76, 0xb9, 0x47, 0xb4, 0x7c, 0x03, 0xc0, 0x68, 0x9f, 0x62, 0x86, 0x2e, 0x56, 0x18, 0xb4, 0xab, 0x4b,
+  0x6c, 0xf0, 0x13, 0x14, 0xc1, 0x22, 0x5b, 0x60, 0x25, 0x8d, 0x67, 0xd0, 0x7a, 0x26, 0xcd, 0x0f, 0x9e, 0xf0, 0xed, 0xc3,
+  0xc9, 0xdb, 0xec, 0xf9, 0xe3, 0x35, 0x8b, 0x93, 0x55, 0x18, 0xa6, 0x79, 0x49, 0xe2, 0x40, 0x8e, 0xc5, 0x31, 0x35, 0xc9,
+  0x0a, 0x2f, 0x40, 0x53, 0xf9, 0x00, 0xdc, 0xd5, 0xf0, 0xb9, 0x07, 0xe3, 0x1b, 0x13, 0x49, 0xd5, 0xfd, 0x95, 0x9c, 0x03,
+  0xbe, 0x2f, 0x66, 0xf2, 0xfa, 0x06, 0x8a, 0x2a, 0x39, 0x45, 0xb8, 0xf7, 0x51, 0x3c, 0xd3, 0xc6, 0x61, 0xbe, 0x4c, 0x73,
+  0xb7, 0x45, 0xdb, 0x01, 0xa4, 0xa7, 0xd2, 0x58, 0x52, 0xb7, 0x8a, 0xba, 0xda, 0xb2, 0xc8, 0x0a, 0x74, 0xd1, 0xe9, 0xd9,
+  0x9e, 0x7a, 0xcc, 0x63, 0xc0, 0xe3, 0xc4, 0x89, 0xbd, 0x28, 0x15, 0xf5, 0x10, 0x17, 0x80, 0xd3, 0x72, 0xbb, 0x3b, 0x15,
+  0x96, 0x36, 0x25, 0x6e, 0xe8, 0x6c, 0xd6, 0x10, 0x46, 0x76, 0x97, 0x2c, 0x7d, 0xeb, 0x33, 0x7c, 0x7c, 0xb3, 0x7d, 0xe7,
+  0xb6, 0x9a, 0x86, 0x01, 0x36, 0xe5, 0x46, 0x97, 0x3e, 0x42, 0x7a, 0x0b, 0xdd, 0xb5, 0xc1, 0x70, 0x04, 0x4c, 0x43, 0xd9,
+  0x6d, 0xda, 0x6a, 0x0e, 0x5c, 0xb3, 0x0b, 0xe4, 0x8b, 0xef, 0x30, 0x8a, 0x7a, 0xe7, 0x22, 0xd1, 0x3f, 0x9a, 0x57, 0x51,
+  0xb3, 0x43, 0x9a, 0x57, 0x1e, 0xff, 0x74, 0x9b, 0x7f, 0x8a, 0xb6, 0x3e, 0x4b, 0x09, 0x4f, 0x7a, 0xd2, 0xcb, 0x98, 0x3a,
+  0xec, 0x82, 0xae, 0x23, 0xc8, 0x46, 0xb1, 0x83, 0xd6, 0x40, 0x0d, 0x95, 0xfc, 0xe8, 0xc5, 0xe9, 0x16, 0x2a, 0x17, 0xd4,
+  0x4f, 0x58, 0x5e, 0x9f, 0x6c, 0xa2, 0x08, 0x17, 0x03, 0x00, 0xc1, 0x42, 0x0b, 0xde, 0x64, 0xb1, 0x09, 0x1c, 0xbe, 0xb2,
+  0xe2, 0x86, 0x2a, 0x4d, 0x7f, 0xe1, 0x51, 0x5c, 0x8b, 0x63, 0x45, 0x07, 0x02, 0x93, 0x25, 0xae, 0xe2, 0x53, 0x32, 0xc8,
+  0x77, 0x40, 0x63, 0x06, 0x81, 0x42, 0x40, 0x44, 0xc3, 0xae, 0x97, 0x9c, 0xe1, 0xc5, 0x23, 0x26, 0x7a, 0xb4, 0xc9, 0x0f,
+  0x22, 0xc0, 0xeb, 0xa6, 0xe1, 0x99, 0x77, 0xcb, 0xdc, 0x96, 0x18, 0xa1, 0x4d, 0xc6, 0xa4, 0x69, 0x59, 0xcd, 0x89, 0xdc,
+  0x88, 0x32, 0x29, 0xcf, 0xbd, 0xc0, 0x3d, 0x57, 0xb3, 0x68, 0xe5, 0x94, 0x34, 0x21, 0x75, 0x81, 0xbb, 0xb7, 0xd4, 0x59,
+  0xb5, 0x3c, 0x97, 0x4c, 0x67, 0xda, 0x3e, 0x99, 0x10, 0xa7, 0x88, 0x48, 0xeb, 0xb5, 0xe7, 0xb9, 0xda, 0xce, 0x24, 0x6f,
+  0xdc, 0xa5, 0xae, 0xfb, 0xf6, 0x1a, 0xea, 0xdf, 0x7b, 0x10, 0xce, 0x40, 0x54, 0xd4, 0x6a, 0xf2, 0x72, 0x50, 0x00, 0x70,
+  0x60, 0x90, 0x80, 0x1e, 0x0b, 0xd2, 0x7a, 0x5e, 0x94, 0x63, 0xdb, 0x68, 0x42, 0xca, 0x7a, 0x48, 0xe3, 0x0d, 0x9b, 0x68,
+  0x4d, 0xee, 0xb2, 0xe7, 0xbb, 0x8c, 0x1b, 0xf5, 0x54, 0x14, 0x09, 0x00, 0x4a, 0x2e, 0x91, 0x00, 0x4c, 0xe8, 0x67, 0x88,
+  0xb8, 0xf8, 0xb7, 0x27, 0xbf, 0xdd, 0x9c, 0x7e, 0x85, 0x86, 0x75, 0xda, 0xb5, 0x26, 0x0d, 0x46, 0xd7, 0xee, 0x8a, 0x45,
+  0x73, 0x5a, 0xd2, 0xa7, 0x20, 0x8a, 0x0a, 0x95, 0x26, 0x21, 0x0b, 0x32, 0xcd, 0x0e, 0xb8, 0x52, 0x9b, 0xf7, 0x53, 0xf1,
+  0xee, 0xa3, 0xe2, 0x15, 0xa9, 0x78, 0x39, 0x95, 0x83, 0x7d, 0xa9, 0xb8, 0xf7, 0x51, 0x71, 0x8b, 0x54, 0xdc, 0xda, 0xb9,
+  0xd4, 0xbb, 0x4c, 0x8d, 0xaa, 0xb5, 0xda, 0xa2, 0x26, 0xdd, 0x98, 0xde, 0x70, 0xef, 0x3d, 0xf7, 0xe1, 0x63, 0x15, 0xfa,
+  0x80, 0xdf, 0xad, 0x35, 0x0c, 0x4e, 0x97, 0x2c, 0x57, 0xa1, 0x82, 0x90, 0x2e, 0x80, 0x27, 0x8d, 0x3f, 0x31, 0x27, 0xc5,
+  0x73, 0x5b, 0xf8, 0x9f, 0x0e, 0x28, 0xf2, 0xa2, 0x9f, 0x5e, 0x24, 0xd6, 0xbe, 0xcc, 0x9c, 0xb2, 0x61, 0x70, 0x03, 0xed,
+  0x02, 0x77, 0x7a, 0x81, 0xb9, 0xe6, 0x0b, 0xdb, 0xed, 0xf7, 0xfb, 0xaf, 0x9a, 0x95, 0xad, 0x9e, 0x9a, 0xd6, 0xd1, 0xfc,
+  0xf5, 0xf0, 0x35, 0xab, 0xa0, 0x05, 0x50, 0x88, 0x0d, 0xf0, 0xc8, 0x87, 0x9c, 0xc4, 0x1e, 0xf5, 0xcb, 0x6d, 0x10, 0x2b,
+  0x4f, 0xf0, 0x60, 0x09, 0x1b, 0x8a, 0x63, 0x8a, 0x6a, 0xa6, 0x2f, 0x11, 0x54, 0xa5, 0x10, 0x2b, 0xf8, 0x26, 0x3d, 0x32,
+  0xa8, 0xe2, 0x1d, 0xcb, 0x6b, 0x1c, 0x2e, 0x86, 0xa8, 0x80, 0xc5, 0x5c, 0x51, 0xad, 0x44, 0xe0, 0x6c, 0xae, 0x9d, 0x4a,
+  0x0c, 0x3e, 0x89, 0x63, 0xba, 0x05, 0x1b, 0xe3, 0xdf, 0x79, 0x9f, 0x1f, 0x88, 0x7c, 0x04, 0x8b, 0x42, 0x98, 0x7e, 0xa6,
+  0xe3, 0x94, 0xe0, 0x6e, 0x5a, 0xe6, 0x78, 0x62, 0x34, 0x93, 0xdc, 0x4e, 0x2b, 0xa6, 0x60, 0x36, 0x8c, 0xa8, 0xfb, 0x9e,
+  0x2d, 0xb0, 0xe5, 0x68, 0x50, 0xaa, 0xf9, 0x24, 0x07, 0xe9, 0x1f, 0x95, 0xaa, 0x2e, 0x21, 0x53, 0xab, 0xac, 0x78, 0xc3,
+  0xcf, 0xec, 0xa0, 0xee, 0x60, 0x98, 0xb3, 0x5e, 0x67, 0x9b, 0xd2, 0x46, 0x9e, 0xd4, 0x06, 0x8b, 0x63, 0x3e, 0xd3, 0x10,
+  0xb8, 0xac, 0x86, 0xae, 0xcf, 0x82, 0x65, 0xba, 0xd2, 0xa1, 0xb8, 0xd2, 0xdf, 0x9a, 0x18, 0x92, 0x62, 0x61, 0x1e, 0x5c,
+  0x34, 0xb5, 0x15, 0x41, 0x2c, 0x69, 0xf9, 0x69, 0x89, 0x21, 0x95, 0x35, 0xbd, 0xbd, 0xc4, 0x6c, 0x75, 0x5a, 0x61, 0x06,
+  0xdd, 0x98, 0xb9, 0x1b, 0xb0, 0x18, 0x3c, 0x30, 0xfc, 0x4d, 0x2c, 0x99, 0x42, 0xfb, 0x7c, 0x09, 0xf9, 0x40, 0xd3, 0x55,
+  0x17, 0xaf, 0x46, 0xe4, 0xb5, 0x12, 0x7f, 0x44, 0xa3, 0x2e, 0xe3, 0x47, 0xae, 0xee, 0x05, 0xdf, 0xa1, 0x00, 0xdb, 0xf9,
+  0xd7, 0xbf, 0x88, 0x0d, 0x09, 0xb7, 0xdd, 0x36, 0xf5, 0xa2, 0xe5, 0xe7, 0x62, 0x7b, 0xac, 0x9a, 0x97, 0x05, 0x94, 0x7d,
+  0xa0, 0x91, 0x1c, 0x1c, 0x19, 0xf8, 0xc3, 0x24, 0x27, 0x22, 0x5b, 0x0c, 0x68, 0x31, 0xad, 0x37, 0xeb, 0x54, 0x04, 0x2b,
+  0x6a, 0xff, 0x6c, 0xa3, 0x5e, 0xc0, 0xfd, 0x5a, 0x05, 0x28, 0x2d, 0x68, 0xa4, 0xc4, 0xd9, 0xde, 0x0a, 0xb9, 0xcc, 0xb5,
+  0xb1, 0x09, 0xe8, 0x35, 0xf5, 0x7c, 0x0c, 0xe2, 0xf6, 0xd1, 0x0a, 0xc6, 0x34, 0x6b, 0x2f, 0x40, 0x46, 0x41, 0x0e, 0x42,
+  0xc6, 0x5e, 0xd0, 0xea, 0x76, 0xbb, 0x25, 0x6e, 0xb2, 0xc1, 0x78, 0x1f, 0xd0, 0xa3, 0xde, 0x07, 0xf4, 0xb2, 0xb3, 0x4f,
+  0x81, 0xc6, 0xc2, 0x0f, 0xc3, 0x18, 0x14, 0x2d, 0x4b, 0x2d, 0x32, 0x6a, 0x03, 0x9c, 0xc0, 0xc7, 0xf7, 0x64, 0x94, 0x75,
+  0x31, 0x49, 0x38, 0xcc, 0xf3, 0xb9, 0x69, 0xf0, 0xc2, 0x97, 0x66, 0x0f, 0x4d, 0x8c, 0xaa, 0xc5, 0xf1, 0x54, 0x11, 0xd5,
+  0xe5, 0x97, 0x0f, 0xaa, 0x68, 0xbf, 0x24, 0x7d, 0xbb, 0xc6, 0x58, 0x23, 0x3f, 0x4c, 0x7f, 0x97, 0x20, 0x23, 0xc0, 0xc6,
+  0xca, 0x40, 0xc2, 0xca, 0x40, 0x61, 0x52, 0xea, 0xf3, 0x93, 0x42, 0x1c, 0x09, 0x3d, 0x96, 0x42, 0x09, 0x2b, 0x47, 0x05,
+  0xb3, 0xd7, 0xed, 0x59, 0x88, 0xfb, 0x85, 0x7c, 0x23, 0x07, 0x4c, 0x4d, 0x11, 0x79, 0x49, 0x5a, 0xd2, 0x66, 0x5a, 0x58,
+  0x25, 0x6d, 0x1a, 0xe6, 0xad, 0x3b, 0x03, 0xfa, 0x53, 0x87, 0xf4, 0xdb, 0x28, 0x8a, 0x8c, 0x63, 0x73, 0xf8, 0xad, 0x1c,
+  0x9e, 0xcf, 0x7c, 0xa6, 0xb8, 0x81, 0xd1, 0xfb, 0xc0, 0x52, 0x4e, 0x82, 0xcb, 0xca, 0xca, 0xc5, 0xd6, 0xcb, 0xa5, 0x99,
+  0x97, 0x66, 0x74, 0x7e, 0x92, 0x10, 0x5a, 0xc4, 0x20, 0x71, 0xc4, 0x94, 0x63, 0xd5, 0xa0, 0x3f, 0x38, 0x84, 0x88, 0xbd,
+  0x84, 0x55, 0x78, 0x06, 0xa5, 0xa4, 0xdb, 0x57, 0xb5, 0x0b, 0xdc, 0x47, 0x45, 0x03, 0xc3, 0x5b, 0x5a, 0x53, 0xbc, 0xfa,
+  0x81, 0x0f, 0xa0, 0xcb, 0x21, 0x7f, 0x7a, 0xf9, 0xb2, 0x5d, 0x0a, 0x57, 0x31, 0x64, 0xc8, 0x67, 0xa4, 0xc9, 0xbf, 0x47,
+  0x86, 0xc8, 0x2b, 0x74, 0xcb, 0xdd, 0x20, 0xa3, 0x3e, 0x67, 0x4b, 0x2f, 0x38, 0x07, 0x31, 0xb6, 0xda, 0x15, 0xb5, 0xeb,
+  0xf0, 0x9a, 0x5d, 0x86, 0x2d, 0xa9, 0x87, 0x0e, 0xd9, 0x56, 0x35, 0xc2, 0x09, 0x40, 0x23, 0xcd, 0x32, 0xb8, 0x3d, 0xd4,
+  0xb4, 0x16, 0x62, 0xc9, 0xa9, 0xdd, 0x3d, 0xfb, 0xca, 0xa5, 0xbf, 0xbf, 0xe7, 0xd2, 0xcf, 0x2f, 0x31, 0x34, 0xbf, 0x42,
+  0xc0, 0x7c, 0xff, 0x1d, 0x95, 0x04, 0x93, 0xc4, 0xc6, 0x20, 0xd7, 0x49, 0xa1, 0x09, 0xdf, 0x34, 0x29, 0x39, 0x56, 0x85,
+  0xf5, 0xa0, 0x3e, 0x70, 0xb8, 0xc9, 0xc3, 0x95, 0x08, 0x15, 0xc3, 0x0a, 0xb9, 0x66, 0x11, 0xcc, 0xe7, 0xbf, 0x7d, 0x31,
+  0xb2, 0xae, 0x8c, 0x27, 0x5c, 0x03, 0xee, 0xce, 0x3e, 0x77, 0x34, 0xdf, 0x3d, 0xd2, 0x95, 0x54, 0xd6, 0xc4, 0xae, 0xd0,
+  0x29, 0x13, 0xa0, 0xb8, 0xc1, 0x20, 0x64, 0x28, 0x9f, 0x85, 0x18, 0xc5, 0x4b, 0x95, 0x24, 0xd1, 0x89, 0x7f, 0x93, 0x61,
+  0x75, 0xab, 0xca, 0x87, 0xd5, 0x74, 0xc5, 0x10, 0x45, 0x21, 0xdd, 0x0a, 0x21, 0x29, 0x68, 0xc8, 0xe1, 0xa9, 0xae, 0xd7,
+  0xbd, 0x32, 0xca, 0x18, 0xe2, 0x32, 0x4a, 0x40, 0x46, 0xb7, 0x9d, 0x1c, 0xb5, 0xfa, 0x76, 0x59, 0x46, 0x46, 0x28, 0x7e,
+  0xc1, 0x62, 0x8f, 0x25, 0x2d, 0x7e, 0xf7, 0xa7, 0x43, 0xa8, 0xe3, 0x40, 0x10, 0x19, 0xc6, 0xc6, 0xbc, 0xf7, 0xf3, 0x37,
+  0x13, 0x33, 0xf8, 0x78, 0x35, 0x0e, 0xa7, 0x10, 0x63, 0x90, 0xd7, 0xf3, 0xbc, 0x1c, 0xcf, 0x20, 0x98, 0x5b, 0xcc, 0x2d,
+  0x48, 0xe5, 0xd2, 0x2e, 0xb3, 0xdf, 0x7c, 0x69, 0xd7, 0x73, 0x4f, 0x21, 0x6a, 0x33, 0xf9, 0x69, 0xa9, 0xa9, 0xc9, 0x3e,
+  0xed, 0xf6, 0xa4, 0x98, 0xd0, 0x56, 0x67, 0xf0, 0xc5, 0xb4, 0xd6, 0x5c, 0x85, 0xcd, 0x3c, 0x56, 0xd7, 0x32, 0xae, 0x07,
+  0x35, 0x71, 0xcd, 0xa4, 0xd4, 0x01, 0x7d, 0x07, 0x11, 0x5e, 0xd2, 0x2c, 0xb1, 0x26, 0x65, 0x53, 0xe4, 0xa5, 0x08, 0x76,
+  0xb7, 0x26, 0x70, 0xf1, 0xd4, 0x2d, 0x93, 0x6a, 0x29, 0xfd, 0x26, 0x0c, 0xc4, 0x5c, 0x37, 0xa2, 0x44, 0xc6, 0xd2, 0x88,
+  0x55, 0x49, 0xbb, 0x60, 0xb2, 0x92, 0xc7, 0x5a, 0xec, 0xcc, 0x47, 0xca, 0xec, 0x52, 0x33, 0xc7, 0xe6, 0x8b, 0xd1, 0x11,
+  0x3d, 0x5c, 0x2c, 0x9a, 0x2a, 0x7e, 0x44, 0x15, 0x57, 0x44, 0x6d, 0x93, 0xaa, 0xae, 0x8b, 0x81, 0xe3, 0x1c, 0xda, 0x55,
+  0x5d, 0xcd, 0xa0, 0xce, 0x48, 0x7c, 0x68, 0xb2, 0x0d, 0x9c, 0xdc, 0x35, 0xfc, 0x90, 0xba, 0xfc, 0x2c, 0x36, 0x9b, 0x4d,
+  0x1a, 0x6f, 0xcb, 0xb0, 0xca, 0x43, 0x4f, 0x7a, 0x43, 0xbd, 0x94, 0x2c, 0x58, 0x0a, 0x06, 0xd9, 0xec, 0xd1, 0xc8, 0xc3,
+  0xdb, 0x0f, 0x7a, 0xe0, 0x26, 0x1a, 0xf3, 0xd8, 0x4e, 0xb5, 0x86, 0x9e, 0xdd, 0xbf, 0x92, 0x30, 0xd0, 0x05, 0x62, 0xec,
+  0x71, 0x60, 0xeb, 0xee, 0x15, 0x00, 0x9f, 0x78, 0xf0, 0xd4, 0x83, 0xbe, 0x71, 0x53, 0x9b, 0xfc, 0x8b, 0x83, 0x9e, 0x66,
+  0x9b, 0xa3, 0xe0, 0xa9, 0xb8, 0xe7, 0x86, 0x38, 0x78, 0x9a, 0x1f, 0x09, 0xf3, 0x19, 0x32, 0xb7, 0x9b, 0x81, 0xe2, 0x1d,
+  0x71, 0x28, 0xcc, 0x80, 0xb4, 0x98, 0x11, 0xac, 0x3e, 0x94, 0xc4, 0x19, 0x44, 0xae, 0x60, 0x6e, 0x69, 0xc8, 0x09, 0x70,
+  0x4a, 0xd7, 0x22, 0x12, 0x6e, 0x16, 0x6f, 0x5f, 0x55, 0xc9, 0x3d, 0x3f, 0x04, 0xcf, 0xb7, 0x02, 0xb8, 0xf4, 0xae, 0x22,
+  0x8e, 0x9c, 0x71, 0xc2, 0xce, 0x60, 0xe0, 0xb4, 0xb5, 0xc7, 0x26, 0x4e, 0x21, 0x6b, 0xb8, 0xf2, 0xf6, 0x1d, 0xc1, 0xab,
+  0x1b, 0xc1, 0xdd, 0x77, 0x04, 0xb7, 0x34, 0x42, 0x25, 0xc2, 0x5c, 0x45, 0x3c, 0x1e, 0x2c, 0x97, 0x7b, 0x35, 0xe5, 0x6e,
+  0xfb, 0xab, 0x94, 0xf3, 0x16, 0x97, 0x41, 0xc2, 0x4f, 0x0f, 0x49, 0x00, 0x5d, 0xf1, 0xb6, 0x79, 0xae, 0x21, 0x22, 0x6f,
+  0xcf, 0x72, 0x1d, 0xe0, 0x41, 0x62, 0xb3, 0x3e, 0xf7, 0x78, 0x24, 0x03, 0x27, 0x72, 0x68, 0x79, 0x29, 0x21, 0x23, 0xf0,
+  0x50, 0xe7, 0xea, 0xe0, 0x45, 0x70, 0x7e, 0xb2, 0x3b, 0x26, 0xcd, 0xf3, 0x8f, 0x17, 0x97, 0x4d, 0x5c, 0xf3, 0xf0, 0x28,
+  0x20, 0x19, 0x43, 0x55, 0x53, 0x92, 0xb4, 0x2e, 0xb7, 0x11, 0x6b, 0x42, 0x13, 0x7e, 0x64, 0xeb, 0xf0, 0xdd, 0xfd, 0x1e,
+  0xba, 0x5d, 0x93, 0xdc, 0x75, 0xf8, 0xd5, 0xd5, 0x31, 0xf9, 0x8f, 0x8b, 0x8f, 0xbf, 0x20, 0x3a, 0x01, 0x57, 0xde, 0x62,
+  0xdb, 0xfa, 0x42, 0xd0, 0xe9, 0xd0, 0xdf, 0x40, 0xdb, 0x77, 0x6d, 0x03, 0xe5, 0xf6, 0xf4, 0x63, 0x54, 0x35, 0x77, 0xd6,
+  0xf0, 0xca, 0x04, 0xc3, 0x07, 0x3b, 0xf8, 0x23, 0x24, 0x8c, 0xea, 0x14, 0x07, 0xd4, 0x2e, 0x3f, 0x48, 0x4e, 0xe8, 0xb5,
+  0xee, 0xe5, 0x95, 0xb0, 0xff, 0x15, 0x4e, 0x4e, 0xd5, 0x45, 0x15, 0x83, 0xc4, 0xb7, 0x82, 0x94, 0x0a, 0x6a, 0x06, 0x98,
+  0x60, 0x18, 0x21, 0x2e, 0xa2, 0x7d, 0xe0, 0xc6, 0x81, 0xbd, 0xf1, 0x70, 0xfe, 0x9f, 0xea, 0x14, 0xbe, 0x39, 0xa9, 0x44,
+  0x9d, 0xc2, 0xf5, 0x87, 0x02, 0xf4, 0x2c, 0x68, 0xa0, 0xfc, 0xfe, 0x5d, 0xb0, 0xc3, 0xeb, 0xa1, 0x5d, 0xe6, 0xf6, 0xe8,
+  0xbe, 0x83, 0xd1, 0xa8, 0xb0, 0x6f, 0x41, 0x37, 0xa7, 0x7b, 0x22, 0x08, 0x36, 0x35, 0x06, 0xb3, 0xbb, 0x23, 0x3d, 0x79,
+  0xdf, 0xc4, 0x3e, 0x8c, 0xf4, 0x99, 0x3b, 0x84, 0x23, 0x6f, 0xd8, 0x30, 0x0b, 0x5c, 0xe3, 0x07, 0xe0, 0x62, 0x0a, 0x21,
+  0x22, 0x0d, 0xee, 0xbe, 0x13, 0x1e, 0x32, 0x35, 0x24, 0x80, 0x57, 0x5f, 0xfe, 0xe9, 0x40, 0x0b, 0xa4, 0x70, 0xf7, 0x79,
+  0xf2, 0x58, 0x4f, 0xbe, 0x40, 0x91, 0xa1, 0x27, 0x97, 0x2e, 0x54, 0x20, 0x72, 0x3c, 0xd8, 0xb5, 0x61, 0x3e, 0x65, 0x9f,
+  0x2e, 0x85, 0x18, 0xe8, 0x6d, 0x45, 0xa7, 0x7a, 0x04, 0xe7, 0x65, 0x86, 0x55, 0x98, 0xa4, 0x5b, 0x31, 0xb9, 0xff, 0xec,
+  0x4b, 0x9e, 0xf0, 0xee, 0x49, 0x23, 0xde, 0x04, 0x45, 0xe1, 0xe0, 0x9f, 0xb8, 0x0f, 0xa9, 0x9d, 0x66, 0xb6, 0x0a, 0x36,
+  0x6b, 0x00, 0x02, 0xae, 0xaa, 0xca, 0x52, 0x2f, 0xf8, 0x0c, 0x5b, 0xb5, 0xf5, 0x62, 0xf7, 0xb6, 0xbd, 0xd3, 0xf7, 0xa5,
+  0x65, 0xde, 0xa6, 0x06, 0xa4, 0xf1, 0x43, 0xba, 0xaf, 0x03, 0xa2, 0xdc, 0x6b, 0xb9, 0x6c, 0xa5, 0x10, 0x40, 0xb5, 0x90,
+  0xf7, 0x00, 0xb9, 0xff, 0x03, 0xb4, 0xd0, 0xe9, 0xee, 0x17, 0x7d, 0x14, 0x6f, 0x22, 0x65, 0x7c, 0x3c, 0x3c, 0xd2, 0xe2,
+  0x23, 0xe1, 0x75, 0x9c, 0x47, 0xbb, 0x44, 0xb3, 0xec, 0xdc, 0x3d, 0xc1, 0x60, 0xf3, 0x1e, 0x57, 0xd9, 0x4f, 0xa7, 0x0f,
+  0x9d, 0x93, 0x70, 0x3e, 0xf2, 0x03, 0x69, 0x8a, 0xeb, 0x58, 0x52, 0x5a, 0x3e, 0x7a, 0x0d, 0x9e, 0x16, 0xe5, 0x82, 0x17,
+  0x15, 0x25, 0xc9, 0xcb, 0x20, 0x48, 0x8e, 0xf3, 0xdd, 0x77, 0xc8, 0xe1, 0xd7, 0xf8, 0xf2, 0x4b, 0x90, 0x73, 0xbd, 0x39,
+  0xdd, 0xe7, 0x2a, 0x3b, 0x1c, 0xe5, 0xc9, 0x2d, 0xb1, 0x46, 0x20, 0x77, 0xf7, 0x24, 0x20, 0x05, 0xf6, 0x1e, 0x95, 0x8a,
+  0x98, 0xf6, 0xc3, 0xf7, 0xfc, 0x1f, 0x91, 0x9a, 0xe8, 0xa7, 0x41, 0x3c, 0x4c, 0x51, 0x67, 0x3a, 0xb0, 0x32, 0xfd, 0xf1,
+  0xe7, 0x3d, 0x82, 0xdb, 0xff, 0xac, 0x62, 0xf7, 0xe6, 0x78, 0xdd, 0xbe, 0xf8, 0x5d, 0x95, 0x38, 0x33, 0x41, 0x96, 0xe1,
+  0xb5, 0xb8, 0xbe, 0x8b, 0x7b, 0x25, 0x3b, 0xae, 0x3a, 0x14, 0xaf, 0x9b, 0xe4, 0xc4, 0x79, 0xd7, 0xae, 0x17, 0x04, 0x2c,
+  0xfe, 0xe9, 0xf2, 0xc3, 0x7b, 0xd4, 0xba, 0xba, 0x7c, 0xf2, 0x06, 0xa2, 0xaf, 0xec, 0xea, 0x88, 0xb8, 0x34, 0x23, 0x5f,
+  0x7e, 0x8e, 0x48, 0x2b, 0x8a, 0x43, 0xdc, 0x8e, 0x68, 0x67, 0x85, 0xfc, 0x4a, 0x2a, 0x24, 0xd1, 0x7a, 0xc9, 0x8a, 0xa5,
+  0xd4, 0x2c, 0xfb, 0xf4, 0xe1, 0xe2, 0x6d, 0xf5, 0x7d, 0x94, 0xfb, 0x4f, 0x84, 0x4b, 0x97, 0xb4, 0xca, 0x16, 0x8b, 0x3c,
+  0x27, 0xcd, 0xc9, 0x9e, 0x66, 0xa9, 0x7c, 0xea, 0x09, 0xec, 0x52, 0xb9, 0xd0, 0x83, 0x0d, 0x53, 0x1e, 0x49, 0xe1, 0xc5,
+  0x49, 0xd4, 0x20, 0x9a, 0xa6, 0x78, 0x01, 0xc3, 0xfc, 0x72, 0x97, 0xed, 0x6c, 0xef, 0xf6, 0xde, 0xe2, 0x55, 0x59, 0x10,
+  0x4c, 0xf6, 0x3b, 0xf6, 0x29, 0x79, 0xfe, 0x9c, 0x0f, 0x2b, 0x57, 0xef, 0x3d, 0xf0, 0xb3, 0xea, 0xfe, 0x6b, 0x61, 0xc8,
+  0x07, 0x8e, 0x68, 0xdc, 0xa4, 0x2c, 0xa9, 0x8d, 0x0f, 0x16, 0x61, 0x15, 0xce, 0x3a, 0xbf, 0x56, 0xb2, 0xdf, 0x90, 0xf2,
+  0x6a, 0x64, 0x69, 0xd4, 0xe2, 0x3e, 0xa3, 0xa0, 0x22, 0x5b, 0x9f, 0xb3, 0x18, 0xf7, 0x54, 0xf9, 0x96, 0xe3, 0xdf, 0x3f,
+  0x3f, 0x80, 0x9c, 0xba, 0x0e, 0x56, 0x22, 0x57, 0x4c, 0x75, 0xb9, 0x16, 0xbb, 0xf2, 0x0e, 0xbb, 0xea, 0x85, 0xa7, 0xc9,
+  0x45, 0xbe, 0x2a, 0x1b, 0xe2, 0x46, 0xec, 0xdd, 0xd9, 0x67, 0xe3, 0x96, 0xcd, 0x7e, 0xe2, 0xc0, 0x9d, 0x9b, 0xbd, 0x58,
+  0xc3, 0x6b, 0x7c, 0xeb, 0x35, 0xe2, 0xa2, 0x2b, 0xae, 0x85, 0x7c, 0x06, 0xbf, 0xae, 0xe4, 0xcd, 0x68, 0xd9, 0x21, 0x83,
+  0xf6, 0x1d, 0xf9, 0xd9, 0xbb, 0xbf, 0x29, 0x64, 0x84, 0x07, 0xd8, 0xd4, 0xbd, 0xbf, 0xa9, 0xcb, 0x47, 0xcd, 0xa7, 0xfb,
+  0xac, 0x3e, 0xb6, 0x6c, 0x3f, 0x40, 0x18, 0x88, 0x14, 0x55, 0x76, 0x21, 0x45, 0x1e, 0x22, 0x8c, 0x43, 0xd0, 0xcc, 0x51,
+  0x83, 0xe7, 0x28, 0x77, 0xa4, 0x47, 0x54, 0x35, 0x0c, 0x41, 0xfd, 0xac, 0x6a, 0x80, 0xa9, 0x46, 0x39, 0x43, 0x96, 0x2e,
+  0xb0, 0x67, 0x14, 0x50, 0xb8, 0xa5, 0x59, 0xc6, 0x2f, 0x39, 0xdc, 0xd3, 0x04, 0xf1, 0x9f, 0x2b, 0x83, 0x78, 0x2f, 0x20,
+  0xca, 0x09, 0xba, 0xe4, 0x54, 0x89, 0x80, 0xec, 0x14, 0x4a, 0xb8, 0xa8, 0x95, 0x8a, 0xb8, 0x5f, 0xde, 0x25, 0xff, 0xbd,
+  0xb1, 0x0f, 0x4e, 0x87, 0x00, 0xb4, 0xfc, 0x77, 0x08, 0xe3, 0x6a, 0x95, 0x63, 0xca, 0x26, 0x7e, 0xa8, 0xc0, 0xed, 0xbb,
+  0xfb, 0xb9, 0x14, 0xd9, 0x67, 0x82, 0x55, 0x7c, 0x3c, 0x91, 0x64, 0x05, 0xfd, 0x88, 0x26, 0x09, 0xcc, 0x15, 0x22, 0x40,
+  0xf1, 0xc4, 0xc3, 0xbe, 0x39, 0x5e, 0xf4, 0x5d, 0xe0, 0x6f, 0xd0, 0xbe, 0xa5, 0xd8, 0x95, 0xfc, 0x2a, 0x59, 0xc8, 0x84,
+  0xde, 0xbc, 0x1b, 0xf3, 0xfd, 0xac, 0xff, 0x6f, 0x4f, 0xec, 0x40, 0x74, 0x4e, 0x03, 0x82, 0xab, 0x75, 0x75, 0x17, 0xac,
+  0x3e, 0xf3, 0xd2, 0x4f, 0x6b, 0xfc, 0x61, 0x00, 0x74, 0x38, 0xd3, 0x75, 0x29, 0xfc, 0x63, 0x2f, 0xd4, 0x81, 0x20, 0xfa,
+  0xb9, 0x79, 0xf9, 0xaa, 0x78, 0x44, 0x60, 0xec, 0x39, 0x55, 0x4a, 0xa1, 0x72, 0xbe, 0x15, 0x33, 0xab, 0x3b, 0x06, 0x28,
+  0x58, 0x9e, 0x4f, 0x93, 0xf4, 0x6d, 0x1c, 0xe3, 0x69, 0xf5, 0x14, 0x8f, 0xde, 0x54, 0x92, 0xd0, 0x7c, 0x2a, 0x27, 0xcf,
+  0x47, 0xfc, 0x86, 0xb9, 0x7a, 0x9e, 0xdb, 0x90, 0x4f, 0x20, 0x84, 0x6b, 0x06, 0xa1, 0x8d, 0xfc, 0x7d, 0x05, 0xf1, 0x12,
+  0xb9, 0xc9, 0x54, 0xb1, 0xad, 0x56, 0x21, 0x06, 0xd0, 0x51, 0xa1, 0xe4, 0x39, 0x0a, 0x06, 0x7f, 0xcc, 0xf9, 0x64, 0x32,
+  0x59, 0xf0, 0x54, 0xe3, 0x5b, 0x3a, 0xa0, 0xa0, 0x80, 0xc0, 0x64, 0x4e, 0xa6, 0x0a, 0x85, 0x9e, 0x66, 0x4e, 0x9e, 0xeb,
+  0x33, 0x63, 0x53, 0xb1, 0x10, 0xf4, 0x89, 0x5f, 0xe6, 0x4c, 0x89, 0xb4, 0xea, 0xb9, 0x02, 0xd5, 0x3f, 0xf2, 0xcb, 0x3a,
+  0x73, 0x3c, 0xfb, 0x99, 0x77, 0xf9, 0x86, 0x77, 0x29, 0x68, 0x8c, 0xc3, 0x1b, 0xec, 0x2e, 0x00, 0x78, 0x4d, 0x23, 0xd1,
+  0x5a, 0xe7, 0x5d, 0xde, 0xec, 0xfd, 0x2c, 0x6f, 0x69, 0xcf, 0xfe, 0xf6, 0x65, 0x0e, 0xb1, 0xbe, 0xcb, 0x6e, 0xef, 0xc4,
+  0x4d, 0x6c, 0x5e, 0x64, 0x78, 0xf7, 0x1c, 0x30, 0x3a, 0x86, 0x99, 0xe6, 0x67, 0xd6, 0xf5, 0x2d, 0x65, 0x0a, 0xf0, 0xef,
+  0xd4, 0x0b, 0x3a, 0x64, 0xd8, 0xde, 0x35, 0xa6, 0xb7, 0x66, 0xf8, 0xeb, 0xdc, 0x94, 0xca, 0xc8, 0xa6, 0xbe, 0x29, 0xfe,
+  0x98, 0x48, 0x9d, 0x44, 0xef, 0x68, 0xb6, 0xd0, 0xb1, 0x47, 0x35, 0x2b, 0xdc, 0x3c, 0x2f, 0x83, 0xe8, 0x9c, 0xef, 0x57,
+  0x57, 0xa3, 0xe6, 0x9c, 0x6f, 0x61, 0x57, 0xc3, 0x24, 0xd4, 0x09, 0x5c, 0xcc, 0x2f, 0xb0, 0xeb, 0x46, 0xb3, 0x4f, 0x48,
+  0x62, 0xde, 0xa2, 0x07, 0x63, 0xd1, 0x73, 0x2e, 0xd4, 0xa4, 0xcc, 0x26, 0x61, 0x65, 0xe0, 0x6f, 0x7f, 0x41, 0x14, 0xd8,
+  0x6a, 0x36, 0xf9, 0x35, 0xd6, 0xd2, 0x25, 0xfb, 0x57, 0x15, 0x97, 0xec, 0xd1, 0x0c, 0xaa, 0x6e, 0xda, 0x3f, 0xf6, 0x7c,
+  0x6c, 0x77, 0xc8, 0xde, 0x0c, 0x17, 0x0b, 0x3c, 0x61, 0x7d, 0x48, 0x68, 0x5a, 0xeb, 0x28, 0x0f, 0x18, 0xeb, 0xde, 0x64,
+  0xa7, 0x70, 0xf4, 0xfe, 0x15, 0x39, 0x8e, 0x7e, 0xdc, 0x6c, 0x64, 0xe6, 0xd5, 0x29, 0xbe, 0xfa, 0xd5, 0x2a, 0xdf, 0xa1,
+  0xc0, 0xcd, 0x32, 0x6e, 0x15, 0x85, 0x9b, 0xf0, 0xf2, 0x12, 0xbf, 0x3a, 0x9b, 0xcd, 0x5f, 0xab, 0xb7, 0x79, 0x6a, 0xb7,
+  0x78, 0x60, 0x51, 0xe4, 0xff, 0x11, 0x4e, 0x00, 0x86, 0x96, 0x79, 0xbb, 0x7d, 0xd7, 0x9e, 0x51, 0xed, 0x70, 0xb0, 0xde,
+  0xf7, 0x47, 0xb6, 0xb8, 0x69, 0x71, 0xdc, 0x53, 0xbf, 0xa8, 0x38, 0xee, 0x89, 0xdf, 0x65, 0x1c, 0xf7, 0xc4, 0x7f, 0xf5,
+  0xf4, 0x7f, 0x01, 0x5c, 0x42, 0x1c, 0x51, 0x06, 0x55, 0x00, 0x00,
+};
+static const WebAsset WEB_ASSET_PID = {"/pid", "text/html", WEB_ASSET_PID_GZ, sizeof(WEB_ASSET_PID_GZ), "\"0027aa542c2d99c1\""};
+
+// web/profile.html: 48283 bytes, 10939 gzipped
+static const uint8_t WEB_ASSET_PROFILE_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdb, 0x76, 0xdb, 0x48, 0x92, 0xe0, 0xbb, 0xbf,
+  0x22, 0xad, 0x9e, 0x6a, 0x82, 0x36, 0x49, 0x91, 0xd4, 0xa5, 0x64, 0x4a, 0x54, 0xad, 0x4b, 0xb6, 0xa7, 0xbc, 0x6d, 0xbb,
+  0x3c, 0x96, 0xdc, 0x5b, 0x5e, 0x1f, 0x9f, 0x2d, 0x88, 0x00, 0x45, 0xb4, 0x48, 0x82, 0x0b, 0x80, 0x92, 0x58, 0xb6, 0x1f,
+  0xf6, 0x71, 0xdf, 0xf7, 0x43, 0xf6, 0x1b, 0xf6, 0x53, 0xf6, 0x4b, 0x36, 0x22, 0xf2, 0x82, 0xbc, 0x01, 0xa4, 0x64, 0xd5,
+  0xf6, 0xcc, 0x39, 0xae, 0x9e, 0xb1, 0x40, 0x64, 0x66, 0x64, 0x66, 0x64, 0xdc, 0x33, 0x32, 0x71, 0xf4, 0xf0, 0xd9, 0xaf,
+  0x27, 0x67, 0x1f, 0xde, 0x3e, 0x67, 0x93, 0x62, 0x36, 0x3d, 0x7e, 0x70, 0x84, 0x7f, 0xd8, 0x34, 0x9c, 0x5f, 0x0c, 0xb7,
+  0xe2, 0xf9, 0x16, 0xbe, 0x88, 0xc3, 0xe8, 0xf8, 0x01, 0x63, 0x47, 0xb3, 0xb8, 0x08, 0xd9, 0x68, 0x12, 0x66, 0x79, 0x5c,
+  0x0c, 0xb7, 0xde, 0x9f, 0xbd, 0x68, 0x1f, 0x6c, 0xb1, 0xed, 0xb2, 0x68, 0x1e, 0xce, 0xe2, 0xe1, 0xd6, 0x55, 0x12, 0x5f,
+  0x2f, 0xd2, 0xac, 0xd8, 0x62, 0xa3, 0x74, 0x5e, 0xc4, 0x73, 0xa8, 0x7a, 0x9d, 0x44, 0xc5, 0x64, 0x18, 0xc5, 0x57, 0xc9,
+  0x28, 0x6e, 0xd3, 0x8f, 0x16, 0x4b, 0xe6, 0x49, 0x91, 0x84, 0xd3, 0x76, 0x3e, 0x0a, 0xa7, 0xf1, 0xb0, 0xd7, 0xe9, 0x4a,
+  0x50, 0x45, 0x52, 0x4c, 0xe3, 0xe3, 0x77, 0x69, 0x98, 0x17, 0xec, 0x6d, 0x96, 0x8e, 0x93, 0x69, 0xcc, 0x9e, 0x47, 0x49,
+  0x91, 0x66, 0x47, 0xdb, 0xbc, 0x0c, 0x6b, 0xe5, 0xc5, 0x8a, 0x3f, 0x31, 0xf6, 0x88, 0x7d, 0x66, 0xe7, 0xe9, 0x4d, 0x3b,
+  0x4f, 0xfe, 0x48, 0xe6, 0x17, 0x03, 0x78, 0xce, 0xa2, 0x38, 0x6b, 0xc3, 0xab, 0x43, 0xf6, 0x95, 0x6a, 0x9c, 0xa7, 0xd1,
+  0x0a, 0x2a, 0x8d, 0x61, 0x3c, 0xed, 0x71, 0x38, 0x4b, 0xa6, 0xab, 0x01, 0x6b, 0x9c, 0xc6, 0x17, 0x69, 0xcc, 0xde, 0xbf,
+  0x6c, 0xb4, 0xd8, 0x4b, 0x18, 0x67, 0xd6, 0x62, 0xed, 0x70, 0xb1, 0x98, 0xc6, 0xed, 0x7c, 0x95, 0x17, 0xf1, 0xac, 0xc5,
+  0xf2, 0x70, 0x9e, 0xb7, 0xf3, 0x38, 0x4b, 0xc6, 0x87, 0xec, 0x3c, 0x1c, 0x5d, 0x5e, 0x64, 0xe9, 0x72, 0x1e, 0x0d, 0xfe,
+  0xb2, 0x43, 0xff, 0x1d, 0xc2, 0xf4, 0xa6, 0x69, 0x36, 0xf8, 0xcb, 0x0b, 0xfa, 0xef, 0x90, 0xcd, 0xc2, 0xec, 0x22, 0x99,
+  0x0f, 0xba, 0x87, 0x6c, 0x11, 0x46, 0x11, 0x8e, 0xa4, 0x2b, 0xfb, 0xef, 0x14, 0xe9, 0x62, 0x1e, 0x5e, 0xc1, 0x10, 0x66,
+  0xe1, 0x0d, 0x47, 0xc0, 0x80, 0xf5, 0x7a, 0xdd, 0xee, 0xe2, 0x46, 0xb5, 0x63, 0x5d, 0x16, 0x2e, 0x8b, 0xb4, 0x6c, 0xcd,
+  0x7a, 0xbb, 0x58, 0x1c, 0x25, 0xf9, 0x62, 0x1a, 0xae, 0x06, 0xe3, 0x69, 0x0c, 0xbf, 0xf0, 0xdf, 0xf6, 0x75, 0x16, 0x2e,
+  0x06, 0xf8, 0xcf, 0x21, 0xbb, 0x80, 0xa7, 0x1e, 0x81, 0xd1, 0x47, 0xd8, 0x7f, 0x86, 0xff, 0x3b, 0x2c, 0x31, 0x51, 0x14,
+  0xe9, 0x6c, 0xd0, 0x5f, 0xdc, 0xb0, 0x3c, 0x9d, 0x26, 0x11, 0xfb, 0xcb, 0xee, 0xee, 0xee, 0x21, 0x0b, 0xa7, 0xc9, 0xc5,
+  0xbc, 0x9d, 0xc0, 0x5c, 0xf3, 0xc1, 0x28, 0x46, 0x14, 0x58, 0xe3, 0x6d, 0x4f, 0xd3, 0x8b, 0x14, 0x06, 0x6d, 0x0e, 0xc1,
+  0xd7, 0xac, 0x1c, 0x06, 0x9f, 0x4d, 0x3b, 0x4b, 0x2e, 0x26, 0xc5, 0x80, 0x4f, 0x88, 0xd0, 0x7e, 0x1d, 0xd3, 0x9b, 0x27,
+  0xdd, 0xae, 0x78, 0x01, 0xab, 0x15, 0x0f, 0xfa, 0xd4, 0x46, 0x20, 0xb2, 0xdb, 0x7d, 0xf2, 0x04, 0xc7, 0x55, 0xc4, 0x37,
+  0x45, 0xbb, 0xc8, 0x00, 0xfb, 0xe3, 0x34, 0x9b, 0x0d, 0x96, 0x8b, 0x45, 0x9c, 0x8d, 0xc2, 0x3c, 0x3e, 0x64, 0xd3, 0xb8,
+  0x80, 0xee, 0xda, 0xf9, 0x22, 0x1c, 0x21, 0x86, 0x7a, 0x8b, 0x1b, 0x1b, 0xc3, 0xa1, 0x36, 0xdc, 0x64, 0x3e, 0x4d, 0xe6,
+  0x71, 0xbb, 0x7a, 0xd4, 0xff, 0x58, 0xe6, 0x45, 0x32, 0x5e, 0xb5, 0x05, 0x9d, 0xaa, 0xf7, 0x33, 0x98, 0x00, 0x5f, 0x24,
+  0xb1, 0x44, 0x72, 0x49, 0x7a, 0x88, 0xc2, 0xde, 0x3e, 0xa1, 0x9b, 0xa3, 0x36, 0x0b, 0xa3, 0x64, 0x99, 0xe3, 0x4a, 0x1b,
+  0x14, 0xf2, 0x14, 0xff, 0xa7, 0x26, 0x76, 0x42, 0xff, 0x89, 0x89, 0x45, 0xf1, 0x28, 0xcd, 0xc2, 0x22, 0x49, 0xe7, 0x83,
+  0x79, 0x3a, 0x8f, 0x4d, 0xf4, 0xfc, 0x88, 0xe8, 0xa9, 0x9e, 0x7f, 0x89, 0x38, 0x4e, 0x1b, 0x54, 0x29, 0x21, 0x58, 0xac,
+  0xdb, 0xe9, 0xe7, 0x0e, 0x36, 0x06, 0x93, 0xf4, 0x2a, 0xce, 0x90, 0x3f, 0xb4, 0xd1, 0xed, 0xd2, 0x7f, 0x3a, 0xfd, 0x3a,
+  0xed, 0x3a, 0xe1, 0xa8, 0x48, 0xae, 0x62, 0xab, 0xa1, 0x5c, 0x20, 0xd1, 0x70, 0x3c, 0x1e, 0xab, 0x86, 0x88, 0xc2, 0x10,
+  0xb0, 0x9d, 0xdd, 0x96, 0xc6, 0xf7, 0xb5, 0x35, 0x44, 0x41, 0x43, 0x10, 0x3c, 0x34, 0x1f, 0x25, 0x59, 0x3c, 0xa2, 0x99,
+  0x42, 0xef, 0xcb, 0xd9, 0x5c, 0xd0, 0x5c, 0x5f, 0xa3, 0x39, 0x41, 0xe6, 0x3a, 0xc8, 0x49, 0x4f, 0xb2, 0x3d, 0x61, 0x8d,
+  0xf5, 0x77, 0x35, 0x7a, 0xa3, 0xf1, 0x97, 0x5c, 0xbb, 0x06, 0xed, 0x3a, 0x01, 0x6b, 0x93, 0xce, 0xd2, 0x69, 0xee, 0x8c,
+  0x18, 0x87, 0x76, 0xb0, 0x30, 0xd8, 0x95, 0x71, 0x7e, 0xd5, 0xc9, 0x90, 0x59, 0x4c, 0x27, 0xc0, 0xb5, 0x11, 0xdd, 0x8b,
+  0x6a, 0x98, 0x3a, 0x31, 0xd6, 0xb1, 0xbd, 0x24, 0xaf, 0xba, 0x21, 0xd4, 0x8d, 0xa0, 0xb3, 0xc8, 0x12, 0xc0, 0xce, 0x8a,
+  0xa4, 0x2b, 0x11, 0x3b, 0x50, 0xc7, 0x80, 0xed, 0x96, 0x52, 0x44, 0xd2, 0x83, 0x68, 0x7d, 0x5e, 0xcc, 0xa1, 0xae, 0x1a,
+  0x1e, 0x56, 0xec, 0x3b, 0xa2, 0x49, 0x12, 0x9f, 0x31, 0x46, 0x87, 0x99, 0x2c, 0xd1, 0x3a, 0x5a, 0x66, 0x39, 0xfc, 0x5e,
+  0xa4, 0x09, 0x1f, 0xae, 0xcd, 0x07, 0xb7, 0x60, 0xa1, 0xeb, 0x09, 0xcc, 0x9c, 0x24, 0x48, 0x0c, 0x9d, 0x73, 0x8c, 0xe8,
+  0x6c, 0x14, 0x4e, 0xa7, 0x26, 0x2b, 0xc1, 0xac, 0xbc, 0x5c, 0xb4, 0x47, 0xff, 0x19, 0xd5, 0xbc, 0x4c, 0xd3, 0xa7, 0xff,
+  0xf4, 0x7a, 0x3a, 0x62, 0x37, 0xe3, 0x2e, 0xad, 0x91, 0x77, 0x2c, 0xdd, 0xee, 0x8f, 0x4f, 0x77, 0xf6, 0x8d, 0xea, 0x11,
+  0x28, 0x70, 0xa7, 0xde, 0xc9, 0x49, 0xb7, 0xdb, 0xed, 0x56, 0x76, 0xc1, 0xdb, 0x78, 0x7b, 0x78, 0xba, 0xc3, 0x5b, 0x8a,
+  0xda, 0xc9, 0x7c, 0xb1, 0x2c, 0xf4, 0xc5, 0x76, 0x69, 0x51, 0x4c, 0x5b, 0xac, 0x73, 0xcf, 0xd2, 0x3d, 0xeb, 0x56, 0xdc,
+  0x5e, 0x61, 0x4d, 0x24, 0xef, 0x75, 0xed, 0x25, 0x3f, 0x4f, 0xa7, 0x91, 0x39, 0xb4, 0xc1, 0x38, 0x1d, 0x2d, 0x91, 0x2f,
+  0xd3, 0x65, 0x81, 0x4a, 0xc0, 0xa4, 0x33, 0x4b, 0xdf, 0x88, 0x86, 0x17, 0x19, 0x8c, 0xae, 0xe4, 0x3a, 0xfc, 0x09, 0x5c,
+  0x07, 0xff, 0xb6, 0x81, 0x55, 0xe0, 0x15, 0x90, 0x0d, 0x17, 0x3d, 0xc0, 0xb9, 0x59, 0xbc, 0x88, 0xc3, 0x22, 0x40, 0x61,
+  0xd6, 0x1e, 0x27, 0x45, 0x0b, 0xc7, 0x07, 0x62, 0x2f, 0xd8, 0x41, 0x82, 0x6f, 0xb1, 0xde, 0x38, 0x6b, 0x36, 0x85, 0x84,
+  0xd2, 0x05, 0xdc, 0x28, 0xcc, 0x22, 0x9b, 0x3c, 0x7c, 0x3c, 0xab, 0xf1, 0xdb, 0xae, 0x85, 0x38, 0x85, 0x71, 0x07, 0xee,
+  0xa4, 0x4f, 0xb2, 0x97, 0x8b, 0x33, 0x90, 0xb4, 0x7c, 0x4d, 0x34, 0x44, 0x1e, 0xd8, 0xb2, 0x6f, 0x33, 0x89, 0x77, 0xa0,
+  0xad, 0xfb, 0x05, 0xf0, 0xcb, 0x84, 0xa4, 0xc9, 0x82, 0x48, 0x64, 0x91, 0x0a, 0xbe, 0xc9, 0x62, 0x40, 0x10, 0x10, 0x3f,
+  0x30, 0x98, 0x54, 0x9c, 0x3f, 0x1c, 0x32, 0x24, 0xa4, 0xf1, 0x34, 0xbd, 0x1e, 0x5c, 0x25, 0x79, 0x72, 0x3e, 0x8d, 0xab,
+  0xc9, 0xc1, 0x43, 0x39, 0x72, 0xa6, 0xbb, 0xda, 0x44, 0xcd, 0xfe, 0xf3, 0xab, 0x0b, 0x6d, 0xc1, 0xce, 0xa7, 0xe9, 0xe8,
+  0x12, 0x26, 0x95, 0x2e, 0x47, 0x93, 0x76, 0x38, 0xd2, 0x34, 0x2c, 0x6f, 0xfc, 0x17, 0x6a, 0x0c, 0x0d, 0xf4, 0x11, 0x22,
+  0x5d, 0x4d, 0xf8, 0x3c, 0x77, 0xb8, 0xaa, 0x12, 0x3d, 0x85, 0x37, 0x09, 0xd2, 0x4f, 0x0e, 0xf2, 0xf0, 0x32, 0x26, 0x6e,
+  0x3f, 0x14, 0x3f, 0x24, 0x1d, 0x1a, 0x84, 0x83, 0x44, 0xa6, 0x55, 0x27, 0xfb, 0xb0, 0xa2, 0x7a, 0xbe, 0x68, 0x5b, 0xb5,
+  0x25, 0xd1, 0x1b, 0x0d, 0x00, 0x00, 0x98, 0xbe, 0x53, 0x63, 0x0a, 0x9d, 0x71, 0x38, 0xb7, 0x1b, 0x77, 0xbb, 0x7b, 0x5d,
+  0xa7, 0x71, 0xdf, 0x68, 0x2c, 0x8a, 0xa2, 0x30, 0x07, 0xdb, 0x3d, 0x03, 0x54, 0xed, 0xb5, 0xf6, 0xf4, 0xe1, 0x90, 0x5c,
+  0x45, 0x45, 0x89, 0x4d, 0x14, 0x5b, 0xc8, 0x0e, 0x88, 0x54, 0x6c, 0xe8, 0x42, 0x22, 0x03, 0x4a, 0xcf, 0x6b, 0x50, 0xae,
+  0x80, 0x77, 0xf2, 0x78, 0x0a, 0xea, 0x3b, 0x8e, 0x54, 0x2f, 0xe6, 0x9c, 0x1d, 0x66, 0x94, 0x0d, 0x4b, 0x99, 0xaa, 0xf5,
+  0x78, 0x0e, 0x64, 0x61, 0xa0, 0xc4, 0x9e, 0x80, 0x8e, 0x11, 0xdf, 0x04, 0x7a, 0xeb, 0x27, 0x90, 0xa2, 0x8d, 0x59, 0xac,
+  0x06, 0xdd, 0xce, 0xbe, 0xdb, 0x95, 0x12, 0x91, 0xb2, 0x56, 0xcf, 0xad, 0xb3, 0xc9, 0x94, 0xf9, 0x38, 0x6b, 0x80, 0xac,
+  0x9f, 0xfe, 0x34, 0xbe, 0x88, 0xe7, 0x91, 0x61, 0xe5, 0x70, 0xc6, 0x17, 0x8c, 0xfe, 0xf4, 0xe9, 0x53, 0x65, 0x20, 0xa1,
+  0x3c, 0x39, 0x70, 0x7d, 0x0a, 0x14, 0x53, 0x7d, 0x47, 0xa8, 0xee, 0xd7, 0xeb, 0x51, 0xd9, 0x7d, 0x92, 0x17, 0xb7, 0x31,
+  0xd8, 0x0e, 0x34, 0x16, 0xcb, 0xd2, 0xeb, 0x8d, 0x9d, 0x0b, 0xcb, 0x9a, 0xe2, 0x7a, 0x9b, 0xc3, 0x99, 0x86, 0xe7, 0xf1,
+  0xd4, 0x44, 0xc0, 0x8e, 0x8d, 0x80, 0x5b, 0x18, 0x08, 0xa5, 0xa6, 0xf9, 0x51, 0x93, 0x07, 0xa4, 0x55, 0x3e, 0x16, 0xab,
+  0x05, 0x38, 0xb8, 0xa3, 0x49, 0x3c, 0xba, 0x04, 0xef, 0x72, 0xeb, 0x93, 0x12, 0x26, 0x1c, 0x7d, 0x42, 0x90, 0x08, 0xa7,
+  0xc6, 0xb2, 0x59, 0xc2, 0x11, 0xce, 0xa7, 0x42, 0xf7, 0xe4, 0x8b, 0x64, 0x3e, 0x37, 0x4c, 0x5f, 0xe1, 0xbc, 0x08, 0xa1,
+  0x26, 0xc8, 0x76, 0x57, 0xeb, 0x85, 0xff, 0x10, 0xf2, 0x54, 0x73, 0xed, 0x48, 0x52, 0x95, 0x0a, 0xc4, 0xee, 0xd0, 0x54,
+  0xbc, 0x7b, 0x28, 0x03, 0xc3, 0x39, 0x58, 0x16, 0xb4, 0x52, 0x38, 0x0c, 0xb0, 0x7e, 0xf6, 0x73, 0x86, 0x9d, 0x87, 0x19,
+  0x4c, 0x7b, 0x8c, 0x7e, 0x7a, 0xac, 0x48, 0x68, 0x1a, 0x8f, 0x0b, 0x7d, 0x11, 0xff, 0xd3, 0x65, 0xbc, 0x1a, 0x67, 0xe0,
+  0xf7, 0xe7, 0x8c, 0x1a, 0x7f, 0x06, 0x5e, 0xc2, 0x7f, 0x14, 0x66, 0xb3, 0xb4, 0x00, 0xcd, 0x19, 0xec, 0xec, 0x77, 0xa3,
+  0xf8, 0x02, 0x74, 0xe2, 0x57, 0x29, 0x8d, 0xa3, 0xf8, 0x7c, 0x79, 0xf1, 0x72, 0x3e, 0x4e, 0x75, 0x35, 0x32, 0x4e, 0x6e,
+  0xe2, 0x08, 0xf9, 0x51, 0xba, 0x93, 0xdc, 0x8f, 0x74, 0x3c, 0xdc, 0xec, 0xe2, 0x3c, 0x0c, 0xba, 0x2d, 0xfa, 0x5f, 0xe7,
+  0xc9, 0x5e, 0xd3, 0xa7, 0x58, 0xa4, 0xb1, 0xe3, 0x98, 0x1a, 0xa6, 0xd1, 0xa2, 0x07, 0x05, 0x66, 0xe9, 0x3c, 0x25, 0xd3,
+  0xd0, 0xd0, 0x9b, 0x3d, 0xee, 0x63, 0x48, 0xa7, 0x66, 0x97, 0x1b, 0x20, 0x7f, 0xb4, 0x93, 0x79, 0x14, 0xdf, 0xa0, 0x1e,
+  0xe9, 0x96, 0x1c, 0xc5, 0x85, 0x07, 0x56, 0x9e, 0x28, 0x36, 0xc2, 0xda, 0x52, 0x13, 0xb6, 0x57, 0xc2, 0x29, 0x16, 0x74,
+  0xd1, 0x8e, 0xaf, 0x80, 0x2a, 0x72, 0x53, 0x51, 0x29, 0xd4, 0x74, 0x84, 0xde, 0x74, 0xb5, 0x9c, 0x83, 0xc4, 0x45, 0x16,
+  0x6b, 0xea, 0xdf, 0xb1, 0xa7, 0x88, 0x98, 0x24, 0xe5, 0x74, 0xf6, 0x4c, 0x3b, 0x18, 0xda, 0xb6, 0x39, 0x47, 0x5d, 0x03,
+  0xae, 0x38, 0x87, 0x9d, 0x67, 0x71, 0x78, 0xd9, 0xc6, 0xdf, 0x9e, 0xce, 0x50, 0x82, 0xcd, 0x51, 0xf7, 0x2a, 0x07, 0xb7,
+  0x6b, 0x60, 0x41, 0x0c, 0xd2, 0xf4, 0xcb, 0x0e, 0x2c, 0x73, 0x84, 0x98, 0x74, 0xad, 0x80, 0xa1, 0x4e, 0xdb, 0x39, 0x17,
+  0x25, 0xe5, 0x0c, 0x91, 0x22, 0x98, 0xb6, 0x96, 0x07, 0x6b, 0x42, 0x20, 0x9a, 0x9f, 0xee, 0xb7, 0x40, 0xbc, 0xdd, 0x4d,
+  0x76, 0x4c, 0x93, 0x6a, 0x9f, 0x77, 0x6a, 0xb1, 0x94, 0x4d, 0x2a, 0x6b, 0xe7, 0x44, 0xc2, 0xa4, 0x3d, 0x4b, 0xa3, 0x70,
+  0xda, 0xf6, 0x98, 0x84, 0xbd, 0xfd, 0xde, 0xb9, 0xdf, 0x74, 0xde, 0xe9, 0xee, 0xec, 0xef, 0x44, 0xf6, 0xa4, 0x0c, 0xaf,
+  0x90, 0x0b, 0x1f, 0x4e, 0xa9, 0x20, 0xca, 0x82, 0xbd, 0x2e, 0x59, 0xa4, 0xa3, 0x70, 0x3a, 0x0a, 0x80, 0x54, 0xaf, 0xae,
+  0x59, 0x9b, 0xed, 0x00, 0xe1, 0xa3, 0x7d, 0x2a, 0x58, 0x78, 0x16, 0x47, 0x49, 0xc8, 0x02, 0xcd, 0x6d, 0xdf, 0x3d, 0x80,
+  0x46, 0x4d, 0xf6, 0x99, 0xca, 0x65, 0xf8, 0x4c, 0xfc, 0x60, 0xa5, 0xf3, 0xae, 0xac, 0x4c, 0x51, 0xf4, 0x55, 0xfc, 0x55,
+  0xe1, 0x2e, 0xb7, 0x89, 0x5e, 0x9d, 0x91, 0x64, 0x67, 0x07, 0x95, 0x00, 0x44, 0xfc, 0x49, 0x55, 0x97, 0x41, 0x05, 0xb4,
+  0xdc, 0xd4, 0x4b, 0x23, 0xe0, 0x04, 0xab, 0xa3, 0x0a, 0xec, 0xe8, 0x8e, 0x74, 0xb7, 0x55, 0x05, 0x2d, 0x2e, 0xd0, 0xab,
+  0x1e, 0x04, 0x86, 0x94, 0xca, 0x26, 0xa0, 0x81, 0xa0, 0x36, 0xfc, 0x8f, 0x10, 0x0a, 0xe2, 0x13, 0xd0, 0x09, 0x6d, 0x9b,
+  0xda, 0x78, 0x94, 0xfe, 0xd0, 0x07, 0x63, 0x20, 0x80, 0x91, 0x3c, 0xf3, 0x8e, 0xc3, 0x87, 0x4d, 0x2d, 0xb6, 0x52, 0x8f,
+  0x50, 0xd9, 0x02, 0xa3, 0x1e, 0x3e, 0xe8, 0xfd, 0x2a, 0xe8, 0x18, 0xc4, 0x68, 0x59, 0x2f, 0x78, 0x10, 0x40, 0xbd, 0x05,
+  0x65, 0xad, 0x9e, 0xa5, 0xcd, 0x61, 0xa0, 0x45, 0x53, 0xf8, 0x4c, 0x68, 0x7c, 0x55, 0x6e, 0x44, 0x3d, 0x40, 0x78, 0xc4,
+  0xc5, 0x68, 0x52, 0x35, 0x10, 0x11, 0xfe, 0x38, 0x66, 0x8f, 0xec, 0x11, 0xe5, 0xc6, 0x4b, 0xb4, 0x1e, 0xf4, 0xdf, 0x62,
+  0x50, 0xc7, 0x18, 0x0e, 0xae, 0xa3, 0x18, 0xd5, 0x9f, 0xf0, 0x61, 0xd7, 0x2c, 0x5c, 0x1d, 0x04, 0xee, 0x31, 0x96, 0xd4,
+  0xec, 0xf7, 0x15, 0xc1, 0x19, 0xf4, 0xb4, 0x34, 0xfc, 0x28, 0x05, 0x42, 0x39, 0x4c, 0x6c, 0x92, 0x44, 0x51, 0x3c, 0xb7,
+  0x1b, 0x0a, 0x5b, 0xa7, 0x76, 0xcc, 0xb2, 0xae, 0xae, 0x61, 0x55, 0x03, 0x0a, 0xe1, 0x90, 0x06, 0x52, 0xaf, 0x04, 0xe7,
+  0x98, 0x9c, 0x49, 0x7a, 0xde, 0x7a, 0x27, 0xe4, 0xb8, 0xf5, 0x56, 0x13, 0x1b, 0xa4, 0xc4, 0x8c, 0x02, 0xa1, 0x71, 0xd8,
+  0xee, 0xde, 0xd5, 0xc4, 0xbf, 0x00, 0x86, 0x18, 0xf4, 0x90, 0xf7, 0xbe, 0x4d, 0xb2, 0xf8, 0xef, 0xd1, 0xb6, 0x08, 0xff,
+  0x1f, 0x6d, 0xf3, 0xcd, 0x89, 0x23, 0x14, 0x51, 0xb4, 0x2f, 0x80, 0x1c, 0x3b, 0x9a, 0x86, 0x79, 0x3e, 0xdc, 0xe2, 0xfc,
+  0xbb, 0xc5, 0x37, 0x09, 0x8e, 0xa2, 0xc4, 0x2a, 0x20, 0xe9, 0x22, 0x4a, 0x71, 0x43, 0x01, 0x9c, 0x49, 0xbe, 0x4f, 0xb1,
+  0xd5, 0x3f, 0xd8, 0x12, 0x56, 0x16, 0x7f, 0xc6, 0x1d, 0x8d, 0x9f, 0xd3, 0x9b, 0xe1, 0x16, 0x0a, 0xbc, 0xfe, 0x2e, 0xfc,
+  0xdf, 0x16, 0x99, 0xf4, 0xc3, 0x2d, 0x9c, 0xf1, 0x16, 0xbb, 0x99, 0x4d, 0xe7, 0x00, 0x76, 0x52, 0x14, 0x8b, 0xc1, 0xf6,
+  0xf6, 0xf5, 0xf5, 0x75, 0xe7, 0x7a, 0xa7, 0x93, 0x66, 0x17, 0xdb, 0x7d, 0xd0, 0x8a, 0xdb, 0x00, 0x58, 0xf5, 0x02, 0xfd,
+  0x2c, 0xc2, 0x62, 0xc2, 0xa2, 0xe1, 0xd6, 0xeb, 0xdd, 0xce, 0x5e, 0xab, 0xd7, 0x65, 0x27, 0x7d, 0xfc, 0xbb, 0xc7, 0x9e,
+  0xb4, 0x7a, 0x3f, 0x02, 0x6a, 0xf1, 0xdf, 0x93, 0xde, 0x1e, 0xfe, 0xe9, 0xf7, 0x78, 0x49, 0xef, 0x89, 0xa8, 0xd9, 0xfb,
+  0x11, 0x1e, 0xe0, 0x77, 0xaf, 0xb5, 0xc3, 0x0e, 0xe0, 0xff, 0x4f, 0xf6, 0xe0, 0x9f, 0x7d, 0x7a, 0x27, 0x80, 0xfd, 0x57,
+  0x39, 0x30, 0xa1, 0x9c, 0xc4, 0x9e, 0x8a, 0xdd, 0x35, 0xd5, 0xfd, 0x37, 0xec, 0x6c, 0x17, 0xa0, 0xb7, 0x9e, 0x6c, 0x09,
+  0x9f, 0x04, 0xda, 0x71, 0xbd, 0xb9, 0x65, 0xf8, 0x4b, 0xc3, 0x2d, 0x18, 0x89, 0x39, 0x65, 0x2f, 0x58, 0x98, 0xc2, 0x01,
+  0xfb, 0xb7, 0x83, 0x56, 0x1f, 0xd4, 0x42, 0xb7, 0xd5, 0xef, 0x6b, 0x60, 0xe5, 0x70, 0x4c, 0xb0, 0x7d, 0x13, 0xa8, 0x28,
+  0x44, 0x5b, 0x65, 0x14, 0x2e, 0x86, 0x5b, 0xa4, 0x0f, 0x2b, 0xfa, 0xc2, 0xc1, 0x3f, 0x81, 0x39, 0xf4, 0x5a, 0x7d, 0x10,
+  0xc7, 0x3b, 0xad, 0xfe, 0xce, 0x9f, 0xda, 0xdb, 0x1e, 0x4d, 0xad, 0xb7, 0x4b, 0x73, 0xdb, 0xff, 0x13, 0xe6, 0x76, 0x84,
+  0x74, 0x22, 0x7f, 0xd0, 0xe6, 0x17, 0x08, 0x86, 0x13, 0x2e, 0xf8, 0x38, 0x01, 0x6f, 0x03, 0x05, 0x0b, 0x5a, 0x0e, 0xd9,
+  0x24, 0x8b, 0xc7, 0xc3, 0xad, 0xed, 0xad, 0x63, 0xa8, 0x02, 0xc6, 0x41, 0x7c, 0xb4, 0x1d, 0xaa, 0x32, 0x41, 0xe5, 0xdc,
+  0x75, 0xdc, 0x92, 0x55, 0x17, 0x7c, 0x2b, 0x6d, 0xeb, 0x58, 0xec, 0xa9, 0xe5, 0x7a, 0x13, 0x59, 0x27, 0x89, 0xa0, 0xfc,
+  0xe5, 0x33, 0x4f, 0xd1, 0x72, 0x11, 0x81, 0x54, 0xdb, 0x3a, 0x7e, 0x4f, 0x7f, 0x3d, 0x15, 0xf8, 0xae, 0x19, 0xcc, 0xef,
+  0x72, 0xeb, 0xf8, 0x94, 0x9e, 0x5f, 0xc1, 0xb3, 0xa8, 0x78, 0xb4, 0x0d, 0x0c, 0x47, 0x0f, 0x1a, 0x1b, 0x2a, 0xbd, 0xe6,
+  0x61, 0x51, 0xbe, 0x15, 0x50, 0x72, 0xe7, 0xa4, 0x57, 0xb1, 0x23, 0x08, 0x05, 0xb2, 0x8e, 0x05, 0xba, 0xd4, 0x25, 0x22,
+  0x74, 0xaa, 0x73, 0x21, 0x77, 0xce, 0x59, 0x02, 0x8b, 0x2b, 0x10, 0x93, 0xbf, 0x02, 0x57, 0x76, 0x4b, 0x02, 0x20, 0xd9,
+  0x84, 0xab, 0x06, 0x62, 0x66, 0xb8, 0x45, 0x6a, 0xbf, 0xa7, 0xfb, 0x86, 0x7d, 0x32, 0xeb, 0xb7, 0x58, 0x3a, 0x1f, 0x4d,
+  0x30, 0x6a, 0x0a, 0xe8, 0x06, 0xa1, 0xfa, 0x2a, 0x0d, 0x23, 0x31, 0xc0, 0xa0, 0xb9, 0x75, 0x0c, 0x6b, 0x4a, 0xdd, 0x68,
+  0xfd, 0x9e, 0x2f, 0x41, 0x86, 0xce, 0x65, 0x2f, 0xe7, 0xc5, 0x9c, 0x40, 0x4c, 0x93, 0xd1, 0x25, 0x0c, 0x1a, 0x4c, 0xee,
+  0x22, 0x7e, 0x13, 0x5f, 0x63, 0x5b, 0xf8, 0x73, 0xb4, 0xcd, 0x6b, 0xbb, 0xcd, 0x71, 0xd8, 0xb4, 0xbc, 0x50, 0xff, 0x67,
+  0x84, 0x51, 0xc2, 0x53, 0x93, 0x2d, 0xe1, 0xca, 0x9a, 0xa7, 0x22, 0x20, 0x81, 0xe0, 0x9f, 0x8a, 0x77, 0x76, 0x1f, 0x1a,
+  0x95, 0xd5, 0x60, 0xd4, 0xc0, 0x24, 0xf7, 0x05, 0x70, 0x48, 0xe0, 0xf2, 0x66, 0x60, 0x63, 0x09, 0x0c, 0xbc, 0x01, 0xaf,
+  0xd0, 0xc1, 0xa0, 0x30, 0x9d, 0x47, 0x4f, 0xa2, 0x5e, 0xf4, 0xc4, 0x30, 0x9d, 0xf7, 0x75, 0x2b, 0x16, 0xcd, 0x31, 0xc0,
+  0x01, 0xba, 0x35, 0x7c, 0xb9, 0xa7, 0x80, 0xd9, 0x38, 0x42, 0xb9, 0x8f, 0xbd, 0x6d, 0x88, 0xd0, 0x7c, 0x92, 0x5e, 0xbf,
+  0x8b, 0x71, 0x57, 0xfa, 0x59, 0x12, 0x82, 0xb4, 0xc7, 0x89, 0xf3, 0xdf, 0xf5, 0xa8, 0xcd, 0xc3, 0x2b, 0x1b, 0xad, 0x3a,
+  0x54, 0x28, 0x2d, 0x17, 0x19, 0x7d, 0x9e, 0x10, 0x5c, 0xb4, 0xe8, 0xf8, 0x14, 0xde, 0x57, 0xc3, 0xd5, 0x56, 0x88, 0x87,
+  0xd9, 0x35, 0x88, 0x11, 0x2c, 0x8c, 0xb9, 0x3c, 0xcf, 0xe8, 0xcd, 0x26, 0xd0, 0x34, 0x30, 0x20, 0x50, 0x52, 0x6c, 0xfc,
+  0x1e, 0xfe, 0xde, 0xb2, 0x69, 0x16, 0xf3, 0xa6, 0xef, 0xe2, 0x5b, 0x37, 0x8d, 0x6f, 0x70, 0xb3, 0xff, 0x3f, 0x9f, 0xfe,
+  0xfa, 0x06, 0x01, 0x3c, 0xa7, 0x5f, 0xb7, 0x04, 0x11, 0xa5, 0xa3, 0xe5, 0x0c, 0x08, 0xa7, 0x73, 0x11, 0x17, 0xcf, 0xa7,
+  0x31, 0x3e, 0xfe, 0xbc, 0x7a, 0x19, 0x05, 0x8d, 0x64, 0x86, 0xd0, 0x5e, 0x00, 0xa6, 0x1b, 0xcd, 0x0e, 0x55, 0xc6, 0x3e,
+  0x5e, 0xce, 0x2a, 0xfa, 0xe0, 0x16, 0x1d, 0xae, 0x60, 0xd9, 0x70, 0x8b, 0xf1, 0xa0, 0x0d, 0xc9, 0x3e, 0x0a, 0xc2, 0x2c,
+  0x40, 0xab, 0xe3, 0x46, 0x7f, 0x32, 0xa2, 0xa0, 0xc7, 0xf6, 0x3f, 0xf2, 0x74, 0xae, 0xe8, 0x54, 0xf7, 0xe3, 0x0d, 0xe9,
+  0x5c, 0x0a, 0x5f, 0xfe, 0xe8, 0x48, 0x2c, 0xb4, 0xfe, 0xb6, 0xbc, 0x9c, 0x03, 0xa6, 0x8d, 0xce, 0x30, 0x93, 0xfe, 0xf1,
+  0x19, 0x18, 0x89, 0x71, 0x16, 0x16, 0x4b, 0x70, 0xda, 0x4f, 0xe3, 0x82, 0x62, 0x01, 0x20, 0x8f, 0xa1, 0xa4, 0xac, 0x66,
+  0x80, 0xd6, 0xac, 0xc5, 0x2d, 0x9a, 0x20, 0xbd, 0x3a, 0xb1, 0x04, 0xa8, 0xd6, 0x52, 0xd5, 0x41, 0x29, 0xa4, 0xb1, 0xb4,
+  0xc5, 0xe1, 0x66, 0x3f, 0xdc, 0x84, 0x36, 0x81, 0xe5, 0x8b, 0x70, 0x7e, 0x4c, 0xff, 0x4a, 0x14, 0x09, 0x16, 0xde, 0x3b,
+  0x08, 0xf7, 0xc7, 0x63, 0xe0, 0xd2, 0xff, 0xfb, 0xbf, 0xfe, 0x07, 0xf0, 0x25, 0x56, 0x63, 0xfa, 0xbc, 0x82, 0xff, 0xf3,
+  0xbf, 0x5f, 0x34, 0x45, 0xc1, 0x46, 0x00, 0xc3, 0x9d, 0x1f, 0x7b, 0xe3, 0x1f, 0x09, 0xe0, 0xff, 0x94, 0x00, 0x5f, 0x40,
+  0xad, 0xd3, 0x45, 0x1c, 0x47, 0x2c, 0xf8, 0xc1, 0x01, 0x56, 0x33, 0x13, 0xe9, 0x31, 0xa8, 0x75, 0xb5, 0x22, 0xa0, 0xe6,
+  0x1c, 0xeb, 0x68, 0x13, 0x04, 0xd2, 0x5b, 0x5c, 0x1e, 0x12, 0x9a, 0x51, 0xc4, 0xe8, 0x87, 0x4b, 0x7b, 0x6b, 0xf9, 0x6b,
+  0x06, 0xa6, 0xbd, 0xce, 0xe1, 0xef, 0xe8, 0x0d, 0x93, 0xaf, 0xbc, 0x10, 0xb9, 0xb5, 0x6f, 0x51, 0x26, 0xc5, 0x49, 0x3d,
+  0x61, 0x52, 0xf4, 0xa5, 0xf7, 0xed, 0xa9, 0x19, 0x4c, 0x91, 0xcf, 0xc3, 0xc5, 0xf3, 0x39, 0x09, 0x2b, 0xc9, 0x15, 0x2a,
+  0x94, 0xc9, 0xe8, 0x09, 0xf0, 0x5c, 0x2a, 0x34, 0xae, 0xf1, 0x4f, 0xa1, 0x11, 0x90, 0x68, 0x01, 0x52, 0x39, 0x47, 0x71,
+  0xb7, 0x7d, 0xcc, 0xf0, 0x95, 0x3e, 0xcc, 0x6d, 0x1a, 0xa7, 0xb9, 0xc8, 0xa5, 0x7a, 0xa5, 0x30, 0xd7, 0x22, 0x9d, 0x12,
+  0xb3, 0xbd, 0x4e, 0xa3, 0xd8, 0xd6, 0xb1, 0x76, 0x8f, 0x2f, 0xf5, 0x06, 0xd8, 0x25, 0x25, 0xfd, 0x0c, 0xb7, 0x7e, 0x01,
+  0x87, 0xaf, 0x98, 0xc4, 0x2c, 0x13, 0xc6, 0x11, 0xe2, 0x2f, 0x67, 0xe7, 0x71, 0x71, 0x1d, 0xc7, 0x73, 0x56, 0x68, 0xa4,
+  0x97, 0x4b, 0x96, 0xb2, 0x71, 0x91, 0x2e, 0x28, 0xac, 0x73, 0x15, 0x4e, 0x97, 0x00, 0x90, 0xc7, 0x38, 0xb7, 0x8e, 0x5f,
+  0xd1, 0xdf, 0xa3, 0x6d, 0x5e, 0x5a, 0xdb, 0x64, 0x31, 0x9a, 0x24, 0xa0, 0xfd, 0x4e, 0x67, 0x69, 0x0a, 0x96, 0x61, 0xf0,
+  0xf6, 0xe4, 0x97, 0x97, 0x6f, 0x9b, 0xbe, 0x96, 0x1e, 0xd5, 0xbf, 0x9e, 0xef, 0xce, 0x92, 0x19, 0xf0, 0x4d, 0xde, 0x04,
+  0x94, 0xb0, 0xdf, 0xda, 0xb8, 0x03, 0x75, 0x68, 0xb2, 0xd4, 0x0b, 0x2a, 0x42, 0xdf, 0x8c, 0x7d, 0x10, 0xe5, 0xc8, 0x21,
+  0xc0, 0x1b, 0xf8, 0x9e, 0x1c, 0x39, 0x51, 0xc0, 0x42, 0xf0, 0x85, 0xd1, 0xb7, 0x24, 0x44, 0x1c, 0xb2, 0x28, 0x0b, 0x2f,
+  0xf8, 0x73, 0x8e, 0x11, 0xda, 0x18, 0xac, 0x27, 0x53, 0xd5, 0x57, 0xea, 0x7d, 0x57, 0x7a, 0x49, 0x9a, 0x95, 0xbc, 0x50,
+  0x25, 0xb6, 0x70, 0x6f, 0xc0, 0x95, 0x4c, 0xa2, 0x10, 0xdc, 0x77, 0x10, 0x4d, 0x9c, 0x72, 0xe4, 0xbc, 0x25, 0x25, 0x69,
+  0x34, 0xbb, 0x28, 0xb0, 0xd0, 0x26, 0x19, 0x4e, 0xbc, 0xf3, 0xe5, 0xec, 0x1c, 0xe5, 0x21, 0x58, 0x65, 0xe0, 0x9a, 0x21,
+  0xab, 0xc7, 0x60, 0x58, 0xf7, 0x90, 0x46, 0x2d, 0x64, 0xd7, 0x74, 0x0d, 0xe8, 0x45, 0xbc, 0xfa, 0xbb, 0x86, 0xc2, 0xcd,
+  0xba, 0x06, 0x5f, 0x77, 0xb8, 0xb5, 0xd7, 0xbd, 0xe3, 0x20, 0xc4, 0x1a, 0x7a, 0xc7, 0x00, 0x65, 0xb7, 0x18, 0x42, 0x6f,
+  0xed, 0x10, 0x6a, 0x65, 0x1d, 0x68, 0xc5, 0x15, 0x2d, 0x2a, 0x5a, 0xd7, 0x24, 0xf1, 0xf0, 0x8d, 0x47, 0xd3, 0x56, 0x90,
+  0x8e, 0x7a, 0x2c, 0x95, 0xa4, 0xd2, 0x46, 0x05, 0xb2, 0xad, 0x92, 0xc7, 0x76, 0xc4, 0x5f, 0xa6, 0xa8, 0x69, 0x41, 0x7f,
+  0x37, 0x77, 0x64, 0x7d, 0x60, 0xd4, 0x32, 0x2f, 0x55, 0xa4, 0x1f, 0xa3, 0xc5, 0xfa, 0x86, 0x89, 0x0c, 0x9d, 0x8a, 0x54,
+  0xae, 0x9b, 0x76, 0x3e, 0x09, 0xa3, 0xf4, 0x7a, 0xd0, 0xc5, 0x60, 0x1e, 0x65, 0x09, 0x31, 0x63, 0x8b, 0x61, 0xa7, 0x69,
+  0x87, 0xf8, 0x65, 0xf8, 0x1f, 0x5d, 0xfc, 0x43, 0xa5, 0x64, 0xf5, 0x09, 0xd3, 0x6a, 0xbd, 0xc6, 0xe8, 0x46, 0xe5, 0xac,
+  0x51, 0x1d, 0x75, 0x0f, 0x79, 0xb0, 0xa5, 0x2b, 0xe7, 0xdd, 0x55, 0xd8, 0xe8, 0x56, 0xef, 0x79, 0xfc, 0xe8, 0x0c, 0xe8,
+  0x36, 0x09, 0x6e, 0x72, 0xf0, 0x3b, 0x7c, 0xf0, 0x8e, 0x2d, 0x63, 0x47, 0x66, 0x34, 0x3f, 0x6c, 0x87, 0xe6, 0x46, 0x45,
+  0x67, 0x28, 0x97, 0x2d, 0x0d, 0xcb, 0x33, 0x0f, 0xf6, 0xed, 0x4c, 0x03, 0x2b, 0x0b, 0x01, 0xf1, 0x35, 0xd9, 0x51, 0x40,
+  0x4b, 0x7a, 0x27, 0xb8, 0x2f, 0x75, 0x32, 0xc7, 0x60, 0x7a, 0x85, 0x57, 0x66, 0xec, 0xe3, 0xbb, 0x29, 0x60, 0xba, 0xf9,
+  0x86, 0x73, 0xf3, 0xe9, 0xd1, 0x72, 0x6f, 0xd1, 0x46, 0x15, 0x85, 0x34, 0x41, 0x2a, 0xeb, 0xfa, 0xb4, 0xde, 0x7b, 0x9b,
+  0xa6, 0x79, 0xfc, 0x52, 0xad, 0x39, 0x72, 0xcf, 0x49, 0x38, 0x1f, 0xc5, 0xd3, 0x8d, 0x7c, 0x02, 0xd7, 0x6b, 0x83, 0x81,
+  0x8c, 0x93, 0x6c, 0x66, 0x42, 0xfc, 0xf5, 0x6f, 0x35, 0x0e, 0x9b, 0x8f, 0xfb, 0xf2, 0x51, 0x96, 0x2c, 0x84, 0x16, 0x02,
+  0x88, 0xe0, 0x40, 0xbf, 0x7e, 0xfa, 0xdb, 0x7f, 0x7b, 0xfb, 0xeb, 0xcb, 0x37, 0x67, 0xa7, 0x6c, 0xc8, 0xfa, 0x4f, 0x80,
+  0x4b, 0xb6, 0xb7, 0xd9, 0x0b, 0xe8, 0xe9, 0x3a, 0x04, 0x15, 0x33, 0x49, 0xa7, 0x51, 0xce, 0x80, 0x2e, 0x4a, 0x25, 0xca,
+  0x12, 0x18, 0xd2, 0x12, 0xf9, 0x88, 0xd4, 0x2f, 0x98, 0xd6, 0x30, 0xc0, 0xa4, 0x00, 0x7c, 0x86, 0x59, 0xc1, 0x75, 0x0a,
+  0xdf, 0x87, 0x8d, 0x0b, 0xad, 0xd1, 0x90, 0x7d, 0xfc, 0x74, 0xa8, 0xbd, 0xe7, 0x2a, 0xe3, 0x25, 0x92, 0x1d, 0x94, 0xb5,
+  0x7b, 0x65, 0x99, 0xe9, 0x35, 0xbe, 0x8c, 0xa0, 0xb8, 0xd1, 0xa8, 0x2a, 0x46, 0xa7, 0xd2, 0xaa, 0x60, 0x18, 0x18, 0x58,
+  0xc6, 0xf5, 0x7a, 0x83, 0x26, 0x26, 0x7f, 0xb0, 0x34, 0x63, 0x0d, 0xd2, 0xde, 0x0d, 0x4c, 0xec, 0xbd, 0x02, 0xed, 0x75,
+  0x9d, 0x80, 0x0a, 0xc7, 0x19, 0x09, 0x1f, 0x53, 0x01, 0xe4, 0x81, 0x13, 0x6b, 0x3c, 0x0c, 0xa1, 0x9d, 0x65, 0xc0, 0x8e,
+  0xb8, 0x75, 0x36, 0x9a, 0x28, 0xcf, 0x14, 0x74, 0xad, 0x18, 0xe2, 0x74, 0x25, 0x9a, 0xfa, 0x21, 0x79, 0x86, 0x3e, 0x09,
+  0xf3, 0xf7, 0x73, 0x1a, 0xcd, 0x09, 0x99, 0x40, 0x88, 0xb6, 0x71, 0x38, 0xcd, 0x45, 0x14, 0x95, 0x2f, 0x18, 0x99, 0xf1,
+  0x6f, 0xb9, 0x24, 0x83, 0xf2, 0xcf, 0x22, 0x36, 0xbb, 0xdb, 0x6d, 0xc9, 0xd0, 0x2d, 0x3e, 0x52, 0x60, 0xb7, 0x0f, 0x0f,
+  0x32, 0x4a, 0xbb, 0xdb, 0x65, 0x5f, 0x1d, 0x30, 0xa7, 0xc0, 0x82, 0x04, 0x43, 0x44, 0x6c, 0x0f, 0xba, 0xd0, 0x42, 0x05,
+  0x69, 0xbb, 0xaa, 0x09, 0xcc, 0xf5, 0x19, 0x46, 0x8f, 0x19, 0x37, 0x5c, 0xa3, 0x72, 0x21, 0xaf, 0x70, 0x0c, 0xf3, 0xe5,
+  0x74, 0xaa, 0xad, 0x90, 0xda, 0x9f, 0xb0, 0x4b, 0x26, 0x60, 0x01, 0xa4, 0xd9, 0xca, 0x22, 0x06, 0x74, 0x36, 0x4f, 0x0b,
+  0xc4, 0x64, 0xf9, 0xbe, 0xa4, 0xcd, 0x5f, 0x5e, 0x9e, 0x9e, 0xfd, 0xfa, 0xee, 0x03, 0x94, 0x01, 0x67, 0xeb, 0x85, 0xa7,
+  0x6f, 0x9e, 0xbe, 0xa5, 0xb1, 0xc7, 0xdc, 0x86, 0x1d, 0xb0, 0x22, 0x5b, 0xc6, 0x30, 0x73, 0x30, 0x10, 0x06, 0xac, 0xb7,
+  0xd7, 0x22, 0x1b, 0x70, 0xc0, 0xf6, 0xe4, 0x24, 0xa8, 0x2f, 0xd4, 0x3a, 0x68, 0x42, 0xbc, 0x4e, 0xe6, 0xcb, 0x82, 0x10,
+  0x7c, 0xa0, 0x91, 0x4e, 0x8e, 0x11, 0x1b, 0x8e, 0x57, 0x0d, 0xef, 0x58, 0x54, 0xc8, 0x86, 0xee, 0xac, 0x4a, 0xc1, 0xfe,
+  0x2e, 0x06, 0xfd, 0x73, 0x15, 0xab, 0x1a, 0x54, 0x65, 0xbc, 0x9c, 0xf3, 0xdd, 0x43, 0x0c, 0x3f, 0x9c, 0x21, 0x98, 0x60,
+  0x16, 0xe7, 0x79, 0x78, 0x01, 0x63, 0xbd, 0x04, 0xb9, 0x8b, 0x34, 0x90, 0xcc, 0xc7, 0x69, 0xa3, 0xdc, 0x60, 0xe3, 0x13,
+  0x04, 0x5b, 0x7f, 0xc8, 0x2a, 0x7d, 0x61, 0x1a, 0x50, 0x43, 0x6d, 0x34, 0x25, 0x63, 0x16, 0x3c, 0x8c, 0xa7, 0x4d, 0xc0,
+  0x26, 0xd8, 0x86, 0x6a, 0xa3, 0x20, 0x9e, 0x76, 0x50, 0x62, 0x9e, 0x70, 0x29, 0x06, 0xf0, 0x44, 0xd7, 0xb2, 0x1c, 0x16,
+  0xf6, 0x14, 0x39, 0x38, 0xe6, 0xe2, 0x19, 0xa7, 0x7e, 0xbe, 0xa2, 0x61, 0x19, 0x43, 0xa1, 0x42, 0x44, 0x56, 0x19, 0x92,
+  0xc7, 0x21, 0x0f, 0x58, 0x43, 0xf8, 0x7d, 0x8d, 0x96, 0x2a, 0xc8, 0x97, 0xe0, 0x54, 0xe7, 0x39, 0x96, 0xed, 0x8c, 0xcf,
+  0x9f, 0xec, 0x75, 0xb5, 0x32, 0x90, 0x29, 0x73, 0x2c, 0x18, 0x77, 0x0f, 0x0e, 0x76, 0x62, 0xad, 0x20, 0xce, 0x32, 0x50,
+  0x0e, 0x58, 0x72, 0xb0, 0xd7, 0xdb, 0x7d, 0xd2, 0x90, 0x21, 0x7e, 0x6d, 0x1e, 0x24, 0xaf, 0x3b, 0x5c, 0x5f, 0x9f, 0xe0,
+  0x78, 0x10, 0x71, 0x42, 0xd3, 0x37, 0x3c, 0xf5, 0x6e, 0x4e, 0x49, 0x87, 0x63, 0xad, 0x6a, 0x35, 0xee, 0x36, 0x14, 0xfa,
+  0x00, 0x9b, 0xd1, 0xb6, 0xb5, 0x5b, 0x43, 0xe4, 0xe7, 0x60, 0x8d, 0x5e, 0x43, 0x43, 0x24, 0xba, 0x83, 0x64, 0x8b, 0xf3,
+  0xd4, 0x0e, 0x76, 0x95, 0x84, 0x9a, 0x2d, 0x01, 0x08, 0x03, 0x69, 0x58, 0x37, 0xcc, 0xdf, 0xa9, 0x06, 0x25, 0xd4, 0xa2,
+  0xd6, 0xfc, 0x97, 0xcf, 0x1c, 0xeb, 0x1f, 0x71, 0x35, 0x3e, 0xb1, 0x2f, 0x5f, 0xc4, 0x2a, 0x74, 0x10, 0xf3, 0x5f, 0x5b,
+  0xac, 0x7a, 0x52, 0xbf, 0xeb, 0x44, 0x51, 0x12, 0x6e, 0x13, 0x14, 0x0c, 0xc8, 0x3e, 0x7c, 0x4e, 0x97, 0x85, 0x5e, 0x20,
+  0xeb, 0x1b, 0x44, 0x0e, 0x63, 0x91, 0x55, 0x83, 0x26, 0x1b, 0x1e, 0x6b, 0x6b, 0xef, 0x43, 0x45, 0xb7, 0x51, 0x6e, 0xf5,
+  0xb8, 0x4d, 0xbd, 0xf8, 0x45, 0x43, 0x05, 0x24, 0x29, 0xcc, 0x05, 0x14, 0x8c, 0x1a, 0x04, 0xfc, 0x04, 0xcb, 0x59, 0xfe,
+  0xfe, 0xea, 0x61, 0x22, 0x4d, 0x07, 0x92, 0x2f, 0xd8, 0x62, 0x51, 0x3c, 0x0e, 0x97, 0xd3, 0xe2, 0xef, 0xe8, 0x95, 0x91,
+  0x4c, 0x2d, 0x79, 0x89, 0xf3, 0x03, 0x9b, 0xc7, 0xd7, 0x18, 0x2b, 0x9e, 0x25, 0x79, 0x1c, 0x04, 0x19, 0xe7, 0x53, 0x6b,
+  0x56, 0x9c, 0xd4, 0xc9, 0xe4, 0xa8, 0x63, 0xbc, 0x92, 0xdd, 0x1b, 0xda, 0x36, 0x2f, 0x6f, 0x4c, 0xc3, 0x79, 0x5e, 0xdb,
+  0xbc, 0x34, 0x95, 0xdc, 0xe6, 0xdc, 0xf0, 0x59, 0xd7, 0x98, 0xa6, 0xaf, 0x37, 0x2e, 0x77, 0xf3, 0x78, 0xf7, 0x16, 0xcb,
+  0xd3, 0xdb, 0x43, 0x8d, 0x71, 0xa1, 0x79, 0xe7, 0x4a, 0xa0, 0x4a, 0xc7, 0x9c, 0xb6, 0x57, 0x87, 0xfd, 0xb8, 0x0b, 0x86,
+  0x46, 0x50, 0xc3, 0xd3, 0xaf, 0x4f, 0x02, 0x0a, 0x1c, 0x7b, 0x6a, 0xa3, 0x7d, 0x41, 0xe9, 0xb8, 0x7c, 0xba, 0xe8, 0x99,
+  0x8a, 0xf8, 0x00, 0x8e, 0xbb, 0x86, 0x88, 0x34, 0xbf, 0x85, 0x4f, 0x82, 0xb2, 0x7a, 0x03, 0x0d, 0x13, 0xb2, 0x80, 0xc3,
+  0xd3, 0x4b, 0x80, 0xaa, 0x7a, 0x1a, 0x91, 0x99, 0xc3, 0xf9, 0x05, 0xc6, 0x80, 0x7b, 0x08, 0x68, 0x39, 0xb0, 0xcb, 0x78,
+  0x65, 0xe1, 0x2a, 0x9d, 0xc3, 0x3b, 0xe0, 0x51, 0xb4, 0x26, 0x82, 0xd8, 0x1d, 0x0b, 0x70, 0x59, 0xdc, 0x81, 0x2a, 0x6c,
+  0x38, 0x04, 0x24, 0x11, 0x14, 0x8d, 0x00, 0x05, 0xcb, 0x74, 0x16, 0x19, 0xe5, 0xf6, 0x3c, 0xe3, 0x08, 0x37, 0x47, 0x4d,
+  0x04, 0x60, 0x9b, 0x77, 0x7a, 0x85, 0xaf, 0xc0, 0x40, 0x79, 0xec, 0x74, 0x95, 0x8f, 0xc2, 0x45, 0x7c, 0xfb, 0xbe, 0x6c,
+  0xd3, 0xd4, 0xe8, 0xa9, 0x44, 0x99, 0xe2, 0xc8, 0x0a, 0x5e, 0x74, 0xe0, 0x58, 0x0a, 0xec, 0x4e, 0xac, 0x54, 0x41, 0x7a,
+  0x5c, 0x56, 0x68, 0x72, 0xcd, 0xa1, 0xb9, 0xa6, 0xa1, 0x9c, 0xac, 0xc2, 0x00, 0x15, 0x72, 0xf3, 0xb0, 0x96, 0x62, 0x4b,
+  0xad, 0x5e, 0xee, 0x2d, 0x5b, 0x13, 0x76, 0x17, 0xc9, 0x9a, 0xf2, 0x9d, 0x38, 0x98, 0x37, 0x95, 0x1c, 0xa9, 0xf1, 0x67,
+  0xa7, 0x00, 0x37, 0x20, 0xb0, 0xea, 0xfd, 0x7b, 0xc2, 0x2a, 0x8d, 0xf2, 0x9b, 0xd1, 0xca, 0xe3, 0x7c, 0xc2, 0x2c, 0x7e,
+  0xc6, 0x47, 0xa7, 0x61, 0xb6, 0x72, 0xa2, 0xae, 0x2b, 0xd0, 0x68, 0x5a, 0xb2, 0xcf, 0xe3, 0x2d, 0x80, 0x22, 0x6d, 0x38,
+  0x3b, 0x49, 0x0a, 0x09, 0x95, 0x9d, 0x89, 0x4d, 0x20, 0xe8, 0x41, 0xee, 0xf0, 0x00, 0xf8, 0x87, 0x8e, 0xc5, 0xee, 0xe7,
+  0x14, 0xf0, 0xe5, 0x2e, 0x45, 0x3d, 0x6d, 0x62, 0x3e, 0x73, 0x1f, 0x6d, 0x58, 0x39, 0x16, 0x3f, 0x5e, 0xaa, 0x7b, 0x38,
+  0xdd, 0x00, 0xbe, 0x66, 0xd6, 0x6e, 0xd4, 0x81, 0x63, 0xf9, 0xdb, 0x1c, 0x31, 0x83, 0x15, 0x8f, 0xff, 0x55, 0x3a, 0x13,
+  0x0e, 0x43, 0x28, 0x67, 0xa0, 0x5e, 0x2b, 0x9a, 0xfb, 0x17, 0x96, 0x59, 0xab, 0xc1, 0x90, 0xf6, 0xad, 0x39, 0x0f, 0xee,
+  0x45, 0x8c, 0x68, 0xc1, 0xcb, 0xba, 0xd8, 0xc9, 0xcf, 0x18, 0x2a, 0x01, 0xab, 0xf6, 0x64, 0x9a, 0x40, 0x5f, 0xef, 0x0c,
+  0xa5, 0x80, 0x7a, 0x28, 0x9c, 0x4e, 0x31, 0xa4, 0x92, 0x83, 0x13, 0x17, 0xcf, 0x19, 0x4c, 0x1f, 0xd4, 0x0d, 0x9b, 0xa7,
+  0xe4, 0xb9, 0x16, 0xb8, 0xc6, 0x2b, 0x65, 0xb3, 0xe1, 0x50, 0xb0, 0x93, 0x0e, 0xf9, 0x4a, 0x24, 0x80, 0xbb, 0x48, 0x4c,
+  0xf4, 0x8e, 0xfb, 0x4c, 0xfc, 0x65, 0xd3, 0xb1, 0x29, 0xae, 0xad, 0x81, 0x8d, 0x68, 0x34, 0xff, 0x85, 0xe0, 0x90, 0x5d,
+  0x57, 0x16, 0xa5, 0xe3, 0x31, 0x74, 0xad, 0x8a, 0xae, 0xc1, 0xf6, 0x4b, 0xaf, 0x3b, 0x94, 0x0d, 0xac, 0x5e, 0x1e, 0x74,
+  0xbb, 0xb6, 0xe5, 0x30, 0xf1, 0xf6, 0xf0, 0x0b, 0x1f, 0x95, 0xb7, 0x8b, 0xb2, 0xec, 0x75, 0x58, 0x4c, 0x3a, 0x74, 0x5a,
+  0x05, 0xbd, 0x3f, 0xfa, 0x35, 0x9e, 0xa6, 0x69, 0x16, 0x5c, 0xb3, 0x47, 0xac, 0xdb, 0xd9, 0x6b, 0x6a, 0x0c, 0x2e, 0xb0,
+  0xac, 0x1c, 0xc6, 0xeb, 0xd2, 0x5d, 0x9c, 0xb4, 0x84, 0x27, 0x2a, 0xbd, 0xcf, 0xd2, 0x21, 0xbd, 0x2e, 0xdd, 0xd0, 0x89,
+  0xa6, 0x56, 0x4c, 0xb1, 0x96, 0xcc, 0xc5, 0x90, 0x86, 0x68, 0x0e, 0x9a, 0x32, 0x2f, 0xbc, 0x0a, 0x93, 0x29, 0x32, 0x1d,
+  0xc7, 0xc1, 0x90, 0x69, 0x0b, 0xd1, 0x66, 0xbb, 0x3a, 0xb5, 0x58, 0x55, 0x8f, 0x00, 0xda, 0xbe, 0xb1, 0x24, 0xba, 0xff,
+  0xdc, 0x21, 0x7b, 0x1d, 0xaa, 0xec, 0x1e, 0xfa, 0xcb, 0x33, 0x39, 0xa2, 0xaa, 0x0a, 0x7c, 0x5e, 0x46, 0x0d, 0xa1, 0xab,
+  0xeb, 0x7b, 0xdc, 0xed, 0xae, 0xe9, 0xb1, 0xb2, 0x82, 0xea, 0x71, 0xd7, 0x49, 0xf1, 0x52, 0x3e, 0xbd, 0xa4, 0x51, 0xdf,
+  0xda, 0x62, 0x16, 0xa8, 0x89, 0xa4, 0x16, 0x52, 0x54, 0xb9, 0xca, 0x25, 0x14, 0x49, 0xd5, 0x25, 0x18, 0xb5, 0x4a, 0x1a,
+  0x30, 0x6d, 0x2d, 0x88, 0x5e, 0xc8, 0x7e, 0x2f, 0xc1, 0x09, 0x86, 0x2d, 0x05, 0x9b, 0x90, 0x2c, 0x61, 0xbe, 0x9a, 0x8f,
+  0x4a, 0x49, 0x82, 0x79, 0xe5, 0x9a, 0xf4, 0x08, 0xaf, 0xc3, 0xa4, 0x20, 0xe1, 0xfc, 0x56, 0xcb, 0xc7, 0x30, 0x98, 0x17,
+  0x7d, 0x75, 0x11, 0x52, 0x29, 0xa3, 0x2f, 0xe3, 0x92, 0x56, 0x74, 0xa2, 0x30, 0x43, 0x38, 0x3a, 0x39, 0x00, 0xa0, 0xe7,
+  0xf3, 0x1c, 0xb7, 0x53, 0x30, 0xf6, 0x23, 0x0c, 0x51, 0x70, 0xcb, 0x60, 0xdc, 0x63, 0x7c, 0xce, 0xe9, 0xbd, 0xd9, 0x8d,
+  0xc5, 0x7c, 0x79, 0xbd, 0xa7, 0xae, 0x27, 0x94, 0xe8, 0x66, 0x3b, 0x0e, 0x0c, 0x9b, 0xfe, 0xf5, 0xaf, 0x08, 0x41, 0x58,
+  0xe4, 0x0f, 0x41, 0x82, 0xd4, 0x8c, 0x96, 0x1b, 0xc6, 0x53, 0x65, 0xbe, 0x5b, 0x55, 0x35, 0x7b, 0xf7, 0x81, 0x35, 0x48,
+  0xb0, 0xc7, 0x17, 0xd8, 0x80, 0xf0, 0x3a, 0xc6, 0x8c, 0xcb, 0xa0, 0xb1, 0x1d, 0x2e, 0x12, 0x99, 0x08, 0xb4, 0xdd, 0x60,
+  0x8f, 0x59, 0x3c, 0x1f, 0xa5, 0x51, 0xfc, 0xfe, 0xdd, 0xcb, 0x13, 0x90, 0xeb, 0x60, 0x1b, 0xcc, 0x0b, 0x07, 0x75, 0xd6,
+  0x04, 0x10, 0x6c, 0x27, 0xbd, 0x34, 0xc7, 0xc8, 0x7b, 0x04, 0xdd, 0x12, 0xaa, 0x1e, 0xa9, 0x1e, 0x6e, 0xad, 0x9b, 0xd6,
+  0xa6, 0x1e, 0x20, 0xc4, 0xfa, 0x9d, 0xf2, 0x05, 0x48, 0x26, 0x19, 0x0d, 0x52, 0x75, 0xcd, 0xbd, 0x40, 0x6a, 0x60, 0x84,
+  0xfb, 0x0c, 0xd8, 0x9e, 0x40, 0x22, 0x6f, 0x11, 0x55, 0xd7, 0x12, 0x41, 0x39, 0xaa, 0x37, 0x97, 0xd6, 0x42, 0x43, 0xaf,
+  0xaf, 0x29, 0x5a, 0xfd, 0x75, 0x9d, 0x2a, 0xd5, 0x6b, 0xbc, 0x93, 0x2e, 0xf6, 0x0b, 0x70, 0x46, 0xd5, 0x5e, 0xbf, 0xe1,
+  0xa9, 0x54, 0x89, 0x11, 0xa0, 0xd4, 0x97, 0x63, 0x50, 0x4e, 0x16, 0x31, 0xb6, 0x88, 0x4b, 0x88, 0x4a, 0xc1, 0x38, 0x05,
+  0xbc, 0xc3, 0xba, 0xe1, 0xd2, 0xd0, 0x51, 0x1c, 0x54, 0x65, 0xf1, 0x6c, 0x51, 0xac, 0xfe, 0x14, 0x92, 0xe5, 0xfb, 0x9c,
+  0x39, 0xc8, 0xb4, 0xf9, 0x05, 0x70, 0xff, 0xb1, 0xa9, 0xfb, 0x4a, 0x36, 0x76, 0x72, 0xa1, 0x3c, 0xb3, 0x35, 0xe4, 0x3d,
+  0x6d, 0x4d, 0xd7, 0x8e, 0x50, 0xdb, 0xbc, 0x36, 0xad, 0x05, 0xde, 0xb4, 0x29, 0x40, 0x74, 0xe4, 0x3e, 0xf6, 0x90, 0xe2,
+  0x85, 0x1d, 0x11, 0x2b, 0x5c, 0x6b, 0xed, 0x19, 0x99, 0x26, 0x20, 0x78, 0x9f, 0xa3, 0x3b, 0x85, 0xd8, 0x88, 0x41, 0x87,
+  0x82, 0xe5, 0x49, 0xf6, 0x54, 0x03, 0x94, 0x1f, 0x79, 0x8e, 0x2f, 0x55, 0xed, 0xe6, 0xe1, 0x03, 0x25, 0xf6, 0xfe, 0xfb,
+  0x32, 0xce, 0x8b, 0xa7, 0xf2, 0x30, 0xcd, 0x0b, 0x3c, 0x15, 0xe3, 0x78, 0xb2, 0xc2, 0xbe, 0xb1, 0x8d, 0x28, 0x13, 0x8d,
+  0x9e, 0x70, 0x0a, 0xb6, 0xf3, 0x35, 0x03, 0x52, 0x8e, 0xe2, 0x8c, 0x5e, 0x05, 0x4d, 0x0a, 0xad, 0xe8, 0x3e, 0xaf, 0x43,
+  0x52, 0xcc, 0x6a, 0xe0, 0x2e, 0x4b, 0x39, 0x21, 0x61, 0x8a, 0xb8, 0xc8, 0x00, 0xd6, 0x86, 0xde, 0x01, 0x19, 0x81, 0x13,
+  0x50, 0xb1, 0x07, 0xa8, 0x1b, 0x12, 0x9e, 0x7e, 0x2d, 0x47, 0xd3, 0xd2, 0x10, 0xae, 0x32, 0x50, 0x7d, 0x01, 0x6b, 0xbc,
+  0x8b, 0x41, 0x26, 0x26, 0xc8, 0x62, 0x2c, 0xbc, 0x00, 0x53, 0x07, 0xa3, 0x31, 0xc0, 0x12, 0xcf, 0xcf, 0xc2, 0x0b, 0x3c,
+  0xd2, 0xc4, 0x96, 0x22, 0xad, 0x20, 0xe2, 0x8c, 0x01, 0x63, 0xc3, 0x6c, 0x01, 0x8c, 0x3a, 0x87, 0x39, 0x0b, 0xc1, 0xe4,
+  0xd8, 0x7d, 0x70, 0x1b, 0x71, 0x99, 0xc3, 0x7c, 0x3f, 0xb3, 0x51, 0x08, 0xf4, 0x35, 0x40, 0x3f, 0xaa, 0x4d, 0x8f, 0x0d,
+  0x35, 0x85, 0x4d, 0x85, 0xe0, 0x37, 0xb0, 0x23, 0x72, 0x20, 0x19, 0x86, 0xbf, 0x9c, 0xbd, 0x7e, 0xa5, 0xed, 0x24, 0x30,
+  0xcf, 0x8e, 0x05, 0x09, 0x34, 0x21, 0x37, 0x0c, 0x91, 0x56, 0xb5, 0x25, 0x21, 0x8a, 0xb9, 0x8c, 0x95, 0xfd, 0x73, 0x99,
+  0xdc, 0xec, 0x8c, 0xd3, 0xec, 0x39, 0x4c, 0x37, 0x58, 0xf8, 0x02, 0x68, 0x20, 0x14, 0xf4, 0xb9, 0xf0, 0x2c, 0x46, 0x31,
+  0x9d, 0xa0, 0xc1, 0x45, 0x86, 0x2e, 0x53, 0xe0, 0x8d, 0x52, 0x67, 0x0b, 0x43, 0x38, 0x63, 0x89, 0xe9, 0xce, 0x2d, 0xb8,
+  0x50, 0x7e, 0xcc, 0x82, 0x85, 0x9c, 0xcd, 0x4f, 0xac, 0xc1, 0x02, 0x4a, 0x5f, 0x8c, 0x9b, 0x0d, 0x36, 0xc0, 0xd8, 0x9f,
+  0x09, 0x01, 0x67, 0x00, 0x1c, 0xc4, 0x5b, 0x4a, 0x10, 0xa6, 0x48, 0x93, 0xc0, 0x9a, 0x5e, 0x74, 0xd8, 0x2d, 0x10, 0xef,
+  0x98, 0x7a, 0x35, 0x07, 0xb7, 0x2a, 0x99, 0x46, 0x01, 0x74, 0x62, 0x50, 0xb0, 0xb1, 0xb2, 0x45, 0x98, 0xc1, 0x6a, 0xd2,
+  0x1a, 0x38, 0xfa, 0x08, 0xb0, 0x59, 0xa1, 0xbf, 0x29, 0x70, 0x2b, 0x5a, 0x5a, 0xc6, 0xca, 0x59, 0xb6, 0xc2, 0x8c, 0x0d,
+  0x19, 0x31, 0x03, 0x12, 0xe7, 0x15, 0x1d, 0xdb, 0x04, 0x9d, 0xa2, 0x31, 0xba, 0x3f, 0xb6, 0xd7, 0x87, 0x67, 0x40, 0x32,
+  0x16, 0xd0, 0xd6, 0x05, 0x94, 0x75, 0x0f, 0xe1, 0xcf, 0x91, 0x47, 0x9e, 0xc3, 0xfb, 0xc7, 0x8f, 0x9b, 0x4e, 0xa8, 0x4b,
+  0xab, 0xf8, 0x31, 0xf9, 0x24, 0x97, 0x0e, 0xcc, 0x16, 0x6d, 0xc0, 0xcc, 0x31, 0x58, 0xec, 0x1d, 0xbf, 0xe4, 0xd0, 0xac,
+  0x23, 0x47, 0xaa, 0xfb, 0xbf, 0xe2, 0x98, 0x01, 0x9e, 0x3c, 0x33, 0x6a, 0x7f, 0x7d, 0xe0, 0x3e, 0x49, 0xe5, 0x28, 0xe7,
+  0x1c, 0x60, 0x58, 0xf1, 0x3a, 0x06, 0x01, 0x0d, 0x34, 0x22, 0x86, 0xdb, 0x54, 0x81, 0x62, 0xc4, 0x20, 0x29, 0x4b, 0x53,
+  0x10, 0xf3, 0xa6, 0x1b, 0x2b, 0x37, 0xef, 0xc4, 0xba, 0x95, 0x9a, 0xdc, 0x42, 0x5e, 0x25, 0xe0, 0x5a, 0xa8, 0xca, 0xae,
+  0xe3, 0xe6, 0x84, 0xcc, 0xdb, 0xfd, 0x99, 0x36, 0x81, 0xab, 0x82, 0x03, 0xfe, 0xba, 0x96, 0xa7, 0x7e, 0x27, 0x19, 0xc4,
+  0x9b, 0xe2, 0x8e, 0x75, 0x4d, 0x53, 0x2d, 0x35, 0xd9, 0xf2, 0xec, 0xa1, 0xa1, 0xbd, 0x63, 0xa5, 0x06, 0xc3, 0xe7, 0x1f,
+  0xd1, 0x4e, 0x84, 0x30, 0x78, 0x35, 0xe3, 0xff, 0x19, 0x0f, 0xc2, 0x20, 0x18, 0x75, 0xb0, 0x5a, 0xdb, 0x82, 0x0d, 0xa7,
+  0x40, 0x35, 0x91, 0xb1, 0x01, 0xcb, 0x18, 0xdd, 0x69, 0x51, 0x06, 0x6f, 0x02, 0xbd, 0x13, 0x8f, 0xd9, 0xed, 0xc7, 0xa5,
+  0x0c, 0x2a, 0xe4, 0x6e, 0xb8, 0x33, 0xbc, 0xa1, 0xcc, 0xa5, 0xa1, 0xbb, 0xcb, 0xf8, 0x88, 0xed, 0x77, 0x69, 0xff, 0x19,
+  0x44, 0xd9, 0x55, 0x9c, 0x15, 0x9c, 0x83, 0xa1, 0x59, 0x94, 0x9b, 0x5e, 0xd2, 0x67, 0xf4, 0x83, 0xcf, 0xc8, 0x77, 0x46,
+  0x70, 0x03, 0x09, 0x94, 0x6e, 0x94, 0xf8, 0x20, 0xdf, 0xc3, 0xc3, 0x5e, 0xb9, 0x39, 0xeb, 0x5f, 0xed, 0x2a, 0x43, 0x53,
+  0x0d, 0x9a, 0x16, 0xe0, 0x29, 0x9e, 0xff, 0xef, 0x24, 0x39, 0xfd, 0x0d, 0x94, 0xf1, 0xdd, 0x44, 0xd9, 0xa4, 0x7e, 0x49,
+  0x4a, 0x15, 0xd1, 0x0d, 0xdf, 0x7a, 0x4d, 0x45, 0x67, 0x9a, 0xaf, 0xd8, 0xa1, 0xf4, 0x21, 0x0a, 0xbc, 0xb6, 0x34, 0x58,
+  0xb3, 0x70, 0x11, 0xe4, 0xa4, 0x38, 0x40, 0x17, 0xe2, 0x5e, 0x2d, 0x76, 0xa5, 0xb9, 0x8b, 0x72, 0xfd, 0x09, 0x39, 0x0a,
+  0x1c, 0xb8, 0x99, 0xbd, 0x7e, 0xe9, 0xc2, 0x82, 0x27, 0x0a, 0xcf, 0xaa, 0xd3, 0xc7, 0x0c, 0x0a, 0x35, 0x8f, 0xd3, 0xdd,
+  0xe4, 0x55, 0xcd, 0x7a, 0x02, 0xc4, 0x28, 0x4e, 0xa6, 0x81, 0xec, 0x65, 0x1b, 0x96, 0xa7, 0x59, 0xb1, 0xde, 0x86, 0xa1,
+  0xa2, 0xaf, 0xb8, 0xda, 0xe3, 0xae, 0x0f, 0x6a, 0x55, 0xc5, 0xb2, 0x3c, 0x78, 0xe4, 0x05, 0x15, 0x3a, 0xdd, 0x67, 0x4c,
+  0x49, 0x43, 0x80, 0x36, 0xe1, 0xfd, 0x1a, 0xf7, 0xcd, 0x69, 0xd0, 0xa8, 0x3e, 0x88, 0xd4, 0x68, 0x35, 0xf0, 0xdf, 0xd2,
+  0xa4, 0xb8, 0xba, 0x40, 0x0f, 0xec, 0x69, 0x51, 0x64, 0xc9, 0x39, 0xf4, 0x16, 0x34, 0xc8, 0xaf, 0x07, 0x5b, 0xc7, 0x0a,
+  0x2d, 0xd4, 0xb4, 0xe0, 0x41, 0x03, 0xa3, 0x09, 0x7f, 0x55, 0xd3, 0x46, 0x9c, 0xa8, 0x82, 0x46, 0xbf, 0xf3, 0xad, 0x4f,
+  0xab, 0xbb, 0xaf, 0xc6, 0x2b, 0x0e, 0xee, 0xeb, 0xef, 0x26, 0xc0, 0xfa, 0xdd, 0xdb, 0xb2, 0x8a, 0x0c, 0x8d, 0xd8, 0xc1,
+  0x92, 0xc7, 0xac, 0xb1, 0xb8, 0xf1, 0xd4, 0x57, 0x41, 0x10, 0x27, 0x2e, 0x62, 0xb6, 0x28, 0x17, 0x50, 0x37, 0x0e, 0x00,
+  0x8e, 0x6d, 0x12, 0xc0, 0xab, 0x77, 0x3c, 0x8c, 0x86, 0x9d, 0xac, 0x0f, 0x52, 0x82, 0x5e, 0xa3, 0xb0, 0x1b, 0x88, 0xb5,
+  0x3f, 0xe2, 0x2c, 0x6d, 0xb1, 0xcb, 0x38, 0x5e, 0x08, 0xba, 0xc4, 0x0d, 0x7b, 0x4a, 0x5c, 0x11, 0xe4, 0x11, 0x95, 0xa3,
+  0x3c, 0x64, 0x27, 0x67, 0xaf, 0x51, 0xf3, 0x53, 0x84, 0x13, 0x6a, 0x4d, 0xa7, 0xc2, 0x5d, 0x81, 0xca, 0x69, 0x06, 0x1d,
+  0x02, 0x95, 0xe4, 0xba, 0xe7, 0xc4, 0xc7, 0x65, 0xc7, 0x37, 0xe5, 0xeb, 0xaa, 0x10, 0x27, 0xee, 0x7c, 0x17, 0x98, 0x6a,
+  0x01, 0x7e, 0x1e, 0xe8, 0x57, 0xc0, 0x3e, 0x8c, 0x02, 0x83, 0x27, 0xe9, 0x35, 0x83, 0xd5, 0x05, 0xba, 0x24, 0xb5, 0x1c,
+  0x9e, 0x83, 0x8b, 0x54, 0x8e, 0x5a, 0x73, 0x04, 0x6a, 0xfc, 0x24, 0x1f, 0xd5, 0x3b, 0x3e, 0x4e, 0xd3, 0xd1, 0x8d, 0x42,
+  0x2b, 0xe1, 0x9a, 0x95, 0xd2, 0xda, 0x14, 0x30, 0x37, 0xa7, 0x78, 0xcf, 0x20, 0xd4, 0xb8, 0xc1, 0x8e, 0xdc, 0x08, 0x1d,
+  0x98, 0x98, 0x37, 0xac, 0xcd, 0xce, 0x51, 0xf4, 0x9c, 0x35, 0x41, 0x42, 0x04, 0xe7, 0x28, 0x3f, 0xce, 0xb4, 0x77, 0x8f,
+  0x58, 0x60, 0xd3, 0x50, 0xdb, 0x03, 0xa9, 0xed, 0x89, 0xef, 0x59, 0x83, 0x59, 0xc9, 0xc1, 0xac, 0xd4, 0x60, 0x74, 0x3a,
+  0x6b, 0x7b, 0x03, 0x80, 0x6d, 0x16, 0xac, 0xe4, 0x68, 0x3e, 0x94, 0x23, 0xfc, 0xa0, 0xbd, 0x33, 0x46, 0xe8, 0x07, 0x56,
+  0xa4, 0x0b, 0x3f, 0xfc, 0x92, 0x6a, 0x4b, 0x6b, 0x71, 0xd8, 0x3d, 0x4c, 0x8e, 0x86, 0x7b, 0x87, 0x96, 0x5d, 0x28, 0x26,
+  0x21, 0x59, 0x44, 0x07, 0xfd, 0x98, 0x25, 0x8f, 0xbe, 0x61, 0x0c, 0xdb, 0x7b, 0x76, 0xa0, 0xfb, 0x62, 0x7a, 0x77, 0x51,
+  0x87, 0xb9, 0x5f, 0xba, 0x77, 0x70, 0x31, 0xb5, 0xc4, 0xd0, 0x4d, 0x4f, 0x8a, 0x2d, 0x7d, 0x05, 0xf1, 0xe6, 0x26, 0xbb,
+  0xe6, 0x0a, 0x6b, 0xae, 0x6a, 0x61, 0xf5, 0x5d, 0xa9, 0x59, 0x41, 0x0b, 0x1e, 0xf0, 0xfd, 0x75, 0xe0, 0x29, 0x57, 0x10,
+  0xe6, 0x24, 0x2f, 0x1b, 0x82, 0x79, 0x91, 0x38, 0xd1, 0x65, 0xcf, 0xc5, 0xb4, 0x8a, 0x35, 0x6e, 0x9e, 0x62, 0x4e, 0xf8,
+  0x3d, 0x21, 0x92, 0x80, 0x6d, 0x8a, 0x49, 0x5f, 0xe5, 0x55, 0xcf, 0xa3, 0x2d, 0x2a, 0xa9, 0xb2, 0xa6, 0xd3, 0x5b, 0xa0,
+  0xdc, 0x3b, 0x8e, 0xfe, 0xfd, 0x8c, 0x43, 0xae, 0x0d, 0x26, 0xde, 0xfb, 0xd6, 0x85, 0xda, 0x28, 0x08, 0x66, 0x02, 0xd1,
+  0x0d, 0x4f, 0xd7, 0x27, 0xc3, 0x08, 0x43, 0x8d, 0x71, 0x96, 0x9b, 0xfe, 0x24, 0x14, 0x50, 0x14, 0xf4, 0x8a, 0x36, 0x81,
+  0x85, 0x59, 0xf9, 0x1c, 0x8c, 0xca, 0x15, 0xfc, 0x50, 0x76, 0x53, 0xd0, 0x43, 0x83, 0x11, 0x46, 0xd3, 0xb4, 0x99, 0xb8,
+  0xe0, 0x2e, 0x5f, 0x81, 0x3b, 0x23, 0x5c, 0xa4, 0xe1, 0x8f, 0xc7, 0x43, 0x03, 0xb2, 0xcb, 0xdd, 0xe8, 0x84, 0x70, 0x99,
+  0x19, 0x14, 0x9e, 0xb4, 0x17, 0x4a, 0xde, 0xbb, 0x27, 0xb6, 0x44, 0x68, 0x3e, 0x72, 0xba, 0x01, 0x54, 0x7a, 0xca, 0xee,
+  0x42, 0x3d, 0xfe, 0x4e, 0xfa, 0x35, 0x9d, 0x6c, 0x4e, 0x1a, 0x20, 0xf3, 0xf6, 0xea, 0x3b, 0xe2, 0x67, 0x7f, 0x01, 0xa0,
+  0x4a, 0x5f, 0xf3, 0x77, 0xaa, 0x1f, 0x20, 0xc6, 0xda, 0x3d, 0x1d, 0x4b, 0x36, 0x51, 0x61, 0x7b, 0x5f, 0x7a, 0x8b, 0xb4,
+  0xcf, 0xcf, 0xe3, 0x6f, 0x90, 0x9c, 0x18, 0x85, 0xd1, 0x3b, 0x27, 0x70, 0x36, 0xfa, 0x04, 0xf6, 0x7c, 0x65, 0xab, 0xdb,
+  0x60, 0xaf, 0x77, 0xb0, 0xa6, 0x27, 0xba, 0x50, 0x25, 0x9c, 0x8f, 0x26, 0x69, 0x86, 0x68, 0x99, 0x25, 0x51, 0x44, 0xd9,
+  0x54, 0xde, 0xca, 0x2a, 0xd5, 0x9c, 0x30, 0xd8, 0x5b, 0x37, 0x0b, 0x3c, 0xa3, 0x4d, 0x2b, 0x73, 0x70, 0xfe, 0x64, 0xf7,
+  0x49, 0xec, 0x56, 0x37, 0x03, 0x52, 0x41, 0xc1, 0x9d, 0x07, 0xd0, 0x61, 0x2f, 0x30, 0x87, 0x3f, 0x00, 0xd3, 0x08, 0xcc,
+  0xc2, 0x59, 0xa3, 0x7a, 0xa1, 0x08, 0x4c, 0xd3, 0xde, 0xba, 0x33, 0xed, 0x81, 0xfb, 0x14, 0xcf, 0xab, 0xdb, 0x88, 0xe7,
+  0x55, 0xad, 0x78, 0xd6, 0x14, 0x76, 0x3d, 0xf8, 0xfe, 0x6d, 0xc0, 0xdf, 0x41, 0xea, 0xae, 0xee, 0x20, 0x75, 0x57, 0x35,
+  0x52, 0x97, 0x6f, 0xba, 0xae, 0xb8, 0xec, 0x45, 0x51, 0x39, 0xc6, 0xe3, 0x88, 0x74, 0xd0, 0xf0, 0x07, 0x77, 0x65, 0xde,
+  0x09, 0x87, 0xe0, 0xfe, 0x96, 0x87, 0x20, 0x56, 0xae, 0xd1, 0x7a, 0x6d, 0x56, 0x09, 0x64, 0x83, 0xb5, 0xf3, 0xf6, 0xdd,
+  0xbf, 0x8f, 0xbe, 0xef, 0xba, 0xb0, 0x3e, 0x60, 0x1b, 0xad, 0xee, 0x3b, 0xc3, 0xb6, 0x36, 0x97, 0x58, 0x5b, 0x51, 0xce,
+  0xc9, 0x79, 0x79, 0x46, 0x0e, 0x81, 0xde, 0xce, 0xd8, 0x05, 0x68, 0x6f, 0x47, 0x6a, 0x67, 0x9c, 0x0e, 0xe4, 0x04, 0x09,
+  0xd8, 0xdb, 0xbd, 0x6e, 0x17, 0x04, 0xc2, 0x9e, 0xa3, 0x21, 0x57, 0x7f, 0x27, 0x75, 0x6d, 0xd4, 0x81, 0xc7, 0x3d, 0x7e,
+  0x8e, 0x40, 0x46, 0x85, 0xc8, 0x51, 0x2b, 0x52, 0x4a, 0x5c, 0x67, 0x19, 0xee, 0x56, 0xb0, 0xa0, 0xdb, 0xc6, 0xfa, 0xb3,
+  0x70, 0x41, 0x07, 0xf5, 0xba, 0x6d, 0xdc, 0x5b, 0xb7, 0xd5, 0xef, 0xfd, 0x09, 0xf6, 0xc2, 0x23, 0xd4, 0x37, 0xa1, 0x03,
+  0x10, 0x7a, 0x07, 0xa8, 0xc4, 0x3c, 0x72, 0x9f, 0x3b, 0x37, 0x01, 0x62, 0xa0, 0x59, 0xd3, 0x93, 0x12, 0xbc, 0xfc, 0xdc,
+  0x6f, 0xc3, 0x03, 0x4d, 0x13, 0xe5, 0x96, 0x24, 0xb7, 0xf7, 0x09, 0xc4, 0xf2, 0x80, 0x24, 0xfe, 0xa1, 0xa1, 0x85, 0x8e,
+  0x1d, 0x9d, 0xe9, 0xda, 0xc7, 0x3c, 0x48, 0x6b, 0x05, 0xbe, 0x8e, 0x1d, 0x8f, 0x57, 0x3f, 0x86, 0x89, 0xfc, 0x6c, 0xad,
+  0x08, 0x5d, 0x14, 0x72, 0xe7, 0x45, 0xc1, 0xd6, 0x86, 0xe2, 0x01, 0x72, 0x8c, 0x86, 0xfa, 0x36, 0x34, 0x8c, 0x80, 0xce,
+  0x9a, 0x82, 0xbd, 0x77, 0x81, 0x20, 0x73, 0x86, 0x87, 0x75, 0x46, 0xcb, 0xf3, 0x64, 0xc4, 0x7e, 0x89, 0xb3, 0x59, 0x52,
+  0x60, 0x52, 0x74, 0x16, 0x5e, 0xcf, 0x71, 0x77, 0x0b, 0x37, 0x09, 0xc0, 0xcb, 0x4e, 0xc0, 0xb0, 0x43, 0xf4, 0xfc, 0x1c,
+  0xff, 0x91, 0xc4, 0x99, 0xbd, 0x21, 0x3c, 0x4d, 0x17, 0x14, 0x29, 0xb3, 0x8e, 0xcf, 0x60, 0x9a, 0x29, 0x3f, 0x27, 0xc3,
+  0x7e, 0x62, 0xf4, 0x70, 0x4a, 0x35, 0xf5, 0x58, 0xe1, 0xc0, 0xc8, 0xf1, 0xd3, 0x36, 0xf5, 0xd5, 0x46, 0x51, 0x90, 0x2f,
+  0x5a, 0x49, 0x73, 0x78, 0xec, 0x26, 0x09, 0xdc, 0x0c, 0x85, 0x55, 0x29, 0xa2, 0x81, 0x4d, 0x20, 0x98, 0xe1, 0xaa, 0x7c,
+  0x05, 0x78, 0x36, 0xf3, 0x7b, 0x31, 0x49, 0x51, 0x05, 0x21, 0x58, 0x84, 0x96, 0xeb, 0xef, 0xaf, 0xd9, 0xbf, 0x7c, 0xbe,
+  0xc1, 0x18, 0xd1, 0xea, 0xeb, 0xef, 0x87, 0x32, 0xae, 0xa6, 0x6d, 0x0e, 0xa8, 0x65, 0xc9, 0xe2, 0x2b, 0x9e, 0xd9, 0xce,
+  0xc7, 0xf7, 0x31, 0x69, 0xf7, 0x8c, 0x14, 0x83, 0x32, 0x99, 0x4a, 0x06, 0x27, 0xdb, 0xd4, 0x88, 0x9e, 0xed, 0x61, 0x3c,
+  0x14, 0x38, 0xfb, 0xf2, 0x85, 0x3d, 0x0c, 0x38, 0x91, 0x94, 0x43, 0x62, 0xaf, 0x36, 0x1c, 0xd3, 0xa8, 0xa7, 0x99, 0xd6,
+  0xaa, 0x2f, 0x20, 0xdd, 0xc9, 0xf6, 0x0e, 0x20, 0x63, 0xd4, 0x43, 0xbf, 0x7a, 0xa5, 0x17, 0xa3, 0x70, 0x78, 0x2c, 0x16,
+  0x8c, 0x66, 0xf0, 0x08, 0xab, 0xba, 0xd3, 0x18, 0xf5, 0x35, 0xc8, 0xe5, 0x7c, 0x04, 0xdc, 0xbe, 0x06, 0x57, 0x20, 0x1a,
+  0x0a, 0x25, 0x54, 0x17, 0xa6, 0x98, 0xd6, 0x09, 0x9e, 0x4b, 0xe8, 0xd1, 0xc4, 0x60, 0x68, 0xf4, 0xa7, 0xcf, 0x7f, 0xf5,
+  0xe9, 0x97, 0x9a, 0x72, 0xb9, 0x0b, 0xd2, 0xd4, 0xaf, 0x3d, 0x03, 0x69, 0x69, 0x32, 0x75, 0x04, 0x4c, 0x1f, 0xd5, 0x57,
+  0x91, 0xb2, 0x5f, 0xdc, 0x94, 0x5b, 0x67, 0x05, 0x63, 0xeb, 0x8a, 0x24, 0xef, 0x17, 0x4a, 0x01, 0xd0, 0x8d, 0xb9, 0x01,
+  0x7d, 0x68, 0x82, 0x91, 0x78, 0xfd, 0x41, 0x89, 0x56, 0x5d, 0xf4, 0xa2, 0x2a, 0xb8, 0x4a, 0xf2, 0x65, 0x38, 0x4d, 0xfe,
+  0xe0, 0xd9, 0x25, 0x1e, 0x25, 0x70, 0xef, 0x8c, 0x0e, 0x40, 0x9f, 0x19, 0xbc, 0xfe, 0x4d, 0xdc, 0xe4, 0x52, 0x05, 0xc0,
+  0xa7, 0x2a, 0x7c, 0x07, 0x64, 0x81, 0x77, 0xcb, 0xf2, 0x1b, 0x15, 0x28, 0x0c, 0x5f, 0xea, 0xa4, 0x53, 0x2f, 0x7a, 0x08,
+  0x33, 0x0e, 0x4c, 0xc5, 0xb1, 0x0a, 0xb8, 0xd1, 0x31, 0x4e, 0x09, 0xa9, 0x27, 0x48, 0x80, 0x6f, 0xbb, 0x3f, 0x19, 0xec,
+  0x3a, 0x30, 0x39, 0xa5, 0xe9, 0xa7, 0x1b, 0x81, 0x69, 0x0f, 0xe9, 0x20, 0xec, 0xb5, 0x15, 0x25, 0x01, 0xc9, 0xeb, 0x92,
+  0xeb, 0x28, 0x48, 0x40, 0x70, 0x35, 0xc3, 0x26, 0xeb, 0x20, 0x18, 0xef, 0xee, 0x14, 0x31, 0x4a, 0xb2, 0x91, 0x75, 0x32,
+  0xc4, 0x9e, 0x0b, 0xf9, 0x59, 0xe6, 0x2a, 0x37, 0x35, 0x1d, 0xe7, 0xd4, 0xd7, 0x74, 0xb0, 0x14, 0xa8, 0x75, 0xf5, 0xd1,
+  0xa5, 0xda, 0xaf, 0xeb, 0xbf, 0x64, 0x46, 0x42, 0x07, 0xa6, 0x8d, 0xd1, 0xc2, 0x1a, 0x5b, 0x96, 0x3f, 0x35, 0xd4, 0xb6,
+  0x5c, 0x63, 0xd0, 0x68, 0x34, 0x0d, 0x80, 0x6e, 0x0a, 0xc9, 0x2c, 0x5d, 0xe6, 0x31, 0x9e, 0xb0, 0xc0, 0x2c, 0x92, 0xb8,
+  0x89, 0x9b, 0x43, 0x78, 0x9a, 0xf4, 0x59, 0x16, 0x5e, 0x04, 0x31, 0xe0, 0x78, 0x4d, 0x73, 0xba, 0xaf, 0x99, 0x5a, 0x54,
+  0xb4, 0x6f, 0xb1, 0xcf, 0x0b, 0x18, 0x76, 0x72, 0x15, 0x0f, 0xf8, 0x5e, 0xf8, 0xd7, 0x35, 0x10, 0xe9, 0xd0, 0x2d, 0xa5,
+  0xb4, 0x20, 0x2c, 0x9a, 0x09, 0xbf, 0xf6, 0xc3, 0x18, 0x8b, 0x4d, 0x3b, 0xa3, 0x0a, 0xd1, 0x63, 0xda, 0x9f, 0xfc, 0x76,
+  0x6a, 0x94, 0x2e, 0x78, 0x0b, 0xc3, 0x05, 0x86, 0xf0, 0xb9, 0x30, 0x8a, 0x38, 0xbb, 0x59, 0xdc, 0xe6, 0x91, 0x3a, 0x27,
+  0xf7, 0x4a, 0x60, 0x9b, 0x8a, 0x05, 0x9d, 0xc9, 0x4e, 0x6e, 0x49, 0x95, 0xbe, 0x26, 0x1a, 0x61, 0x96, 0x72, 0x63, 0x4d,
+  0x23, 0xa4, 0xce, 0xbd, 0x66, 0xfd, 0x50, 0x34, 0x66, 0xbf, 0x1b, 0x85, 0x7a, 0x80, 0x62, 0x12, 0x09, 0x3f, 0x24, 0x0f,
+  0x03, 0x48, 0xec, 0xba, 0x1b, 0x13, 0x34, 0xe8, 0x20, 0x1f, 0x4d, 0x57, 0x00, 0xa9, 0x22, 0x6b, 0x1d, 0x4a, 0x2d, 0x65,
+  0x57, 0xc0, 0xbd, 0x1b, 0x71, 0x23, 0x30, 0x5f, 0x9e, 0xcb, 0xa6, 0xdb, 0x03, 0xdc, 0x03, 0xd2, 0xfc, 0x25, 0xbe, 0x4b,
+  0xc1, 0xb7, 0x08, 0xf8, 0xd6, 0x45, 0x5b, 0x6c, 0x5c, 0x6c, 0xbb, 0x0e, 0xd4, 0x9f, 0xec, 0xe3, 0xdc, 0x97, 0xf3, 0xa2,
+  0xa2, 0x46, 0xdf, 0xe0, 0xbc, 0x10, 0xa6, 0xc0, 0x75, 0x61, 0x2f, 0x6e, 0xe9, 0xbb, 0x78, 0x4f, 0x69, 0x3b, 0x07, 0x28,
+  0x8d, 0xf5, 0x56, 0xcb, 0xe4, 0xe6, 0xe7, 0x98, 0x7b, 0x96, 0x0b, 0xd3, 0x6e, 0xfe, 0xb4, 0x36, 0x83, 0x92, 0xdf, 0xd4,
+  0xd2, 0x68, 0xaa, 0xdc, 0x2e, 0x21, 0x16, 0x36, 0x69, 0x08, 0x3a, 0xca, 0x6a, 0x08, 0x6f, 0x36, 0x68, 0x08, 0x8c, 0x61,
+  0xb6, 0x93, 0x52, 0xac, 0xcc, 0x45, 0x77, 0xb2, 0x0e, 0xb9, 0x45, 0x6e, 0xe1, 0xc8, 0xe0, 0xb2, 0x2b, 0xe4, 0x78, 0x85,
+  0x28, 0xb0, 0xc0, 0xab, 0x4e, 0xd7, 0x41, 0x51, 0x5e, 0xa4, 0x8b, 0xb7, 0x59, 0xba, 0x08, 0x2f, 0xc4, 0x75, 0x45, 0x87,
+  0x9e, 0x6c, 0xb0, 0xd3, 0xbf, 0xff, 0x2b, 0xdf, 0xfc, 0x35, 0x32, 0x03, 0x54, 0x99, 0x3f, 0xc3, 0xa2, 0x76, 0x37, 0x33,
+  0x99, 0x5f, 0xe1, 0x09, 0xf9, 0xd5, 0xdb, 0x84, 0xb6, 0x33, 0x83, 0x8d, 0xb7, 0x10, 0xb1, 0x05, 0xed, 0x1d, 0xde, 0x7d,
+  0x8f, 0x0e, 0x77, 0x19, 0x9d, 0x9d, 0xc7, 0xc7, 0xe2, 0x49, 0x0e, 0x73, 0xb1, 0xcc, 0x27, 0xbf, 0xf0, 0xd3, 0xff, 0x81,
+  0x9e, 0xc0, 0x68, 0xd3, 0x9c, 0x31, 0x2b, 0x98, 0xee, 0x09, 0xee, 0x54, 0xe7, 0xbe, 0x73, 0x97, 0xc2, 0xd4, 0xa2, 0x2d,
+  0xf3, 0xdf, 0xa0, 0x42, 0xdc, 0x21, 0x71, 0x09, 0xfe, 0xd8, 0x4f, 0xe5, 0xf3, 0xc7, 0xee, 0xa7, 0x8e, 0xac, 0x32, 0x80,
+  0xd7, 0xe2, 0xf9, 0xd0, 0x0b, 0xe5, 0xc3, 0x7a, 0x28, 0x1f, 0x34, 0x28, 0x1f, 0x4c, 0xbb, 0x5d, 0x9c, 0x8c, 0x51, 0xab,
+  0xb8, 0x6e, 0x63, 0x5f, 0xac, 0xba, 0x76, 0x78, 0xe2, 0xaf, 0x7f, 0x65, 0x0f, 0xb5, 0xc3, 0x44, 0xbe, 0x94, 0x7a, 0xcc,
+  0x31, 0xb8, 0xdb, 0x41, 0x2a, 0x13, 0xc6, 0xbb, 0xf2, 0xb0, 0x14, 0x80, 0xfb, 0x49, 0x3c, 0x54, 0x0d, 0x99, 0x0d, 0x68,
+  0x76, 0x87, 0x46, 0xda, 0xb0, 0x02, 0xf0, 0xce, 0x28, 0xfa, 0xea, 0x1c, 0x3b, 0x98, 0x22, 0x5e, 0x25, 0xfa, 0xda, 0xfc,
+  0xe4, 0x0e, 0x50, 0x93, 0x9e, 0x0a, 0x2c, 0x52, 0x9f, 0x56, 0x03, 0x5e, 0xbd, 0x3c, 0x21, 0x64, 0x11, 0x04, 0x5d, 0x91,
+  0xe6, 0xa1, 0x85, 0xba, 0x03, 0xaf, 0x62, 0xff, 0x23, 0x1d, 0x71, 0xfe, 0xe1, 0x04, 0x15, 0xc4, 0xae, 0xd7, 0xe5, 0xe8,
+  0x27, 0x64, 0xaa, 0x00, 0x1a, 0x76, 0x56, 0x4d, 0x1e, 0xd3, 0x33, 0x62, 0x75, 0xe3, 0x0c, 0x18, 0x48, 0xf3, 0x16, 0x65,
+  0xec, 0x8e, 0x7b, 0x4c, 0xba, 0x0a, 0xd6, 0x00, 0x8b, 0xc4, 0xa5, 0x32, 0xa7, 0x09, 0x53, 0x9a, 0x78, 0x15, 0x43, 0xf5,
+  0x6a, 0x82, 0xb6, 0xb4, 0xc4, 0x86, 0xa2, 0xe6, 0x9a, 0x24, 0x6a, 0x66, 0x89, 0xf8, 0x2a, 0x64, 0x2e, 0x51, 0xa4, 0xdb,
+  0x29, 0xdb, 0xc6, 0x41, 0xc5, 0x12, 0xa2, 0x22, 0x37, 0xae, 0x59, 0x7c, 0xc6, 0x0e, 0xbe, 0x07, 0x15, 0x88, 0x7f, 0x6e,
+  0xd7, 0x70, 0x89, 0x57, 0xb0, 0x2c, 0x17, 0x1b, 0x37, 0x22, 0xa6, 0xbc, 0x4b, 0x6f, 0x9c, 0x9b, 0xe7, 0x91, 0xd9, 0x5d,
+  0x89, 0x16, 0xd5, 0xba, 0xc2, 0x9c, 0xf3, 0xf5, 0xb9, 0xae, 0x8d, 0x3d, 0xb9, 0x9a, 0xfa, 0xf6, 0xbc, 0x5a, 0xf4, 0x3d,
+  0x2d, 0xdd, 0xb4, 0xd3, 0x5c, 0xe2, 0x75, 0x70, 0xac, 0x69, 0x3a, 0x46, 0x40, 0xe9, 0x1d, 0xfd, 0x89, 0xda, 0x0d, 0xd9,
+  0xe5, 0x7d, 0x8e, 0x37, 0xf4, 0xa5, 0x05, 0xc3, 0xd7, 0x68, 0x2a, 0x62, 0x55, 0x1a, 0xeb, 0x68, 0x75, 0x8f, 0xda, 0x0f,
+  0x35, 0xc0, 0x8d, 0xd4, 0x7e, 0xf4, 0xe0, 0x49, 0xc5, 0xb1, 0x14, 0xdd, 0x2d, 0x53, 0x76, 0x94, 0x9e, 0xd3, 0x73, 0x80,
+  0x84, 0x9e, 0x3b, 0xfb, 0xae, 0x8e, 0xbf, 0xab, 0xe3, 0xff, 0x20, 0xea, 0xf8, 0x37, 0xa5, 0x8e, 0x7f, 0x93, 0xea, 0x18,
+  0x89, 0xfe, 0xf0, 0xf6, 0x8a, 0x5b, 0xa5, 0x33, 0xf2, 0x7b, 0x98, 0x6e, 0x48, 0x7d, 0xff, 0xd6, 0x72, 0xf5, 0x78, 0x85,
+  0x6b, 0x62, 0x28, 0x7f, 0x68, 0x8d, 0x90, 0x3a, 0x37, 0xd4, 0x9e, 0x1e, 0x57, 0xff, 0x0c, 0x4b, 0xa0, 0x70, 0x8c, 0x80,
+  0xdf, 0xc8, 0x08, 0xb8, 0x69, 0x5a, 0x15, 0x57, 0x95, 0xd6, 0x82, 0xd3, 0x27, 0x9e, 0x45, 0xe3, 0x47, 0x54, 0xac, 0x73,
+  0x68, 0x44, 0x64, 0x71, 0x27, 0x9f, 0x24, 0xe3, 0xe2, 0x6f, 0xf1, 0xca, 0x3a, 0x68, 0xa7, 0x5a, 0xf9, 0x68, 0x2f, 0x2f,
+  0x24, 0x2c, 0x7b, 0x6f, 0x42, 0x94, 0xaf, 0x54, 0xb9, 0xe6, 0x3c, 0x91, 0xbf, 0x69, 0x0e, 0x1c, 0x33, 0x18, 0x72, 0x12,
+  0x6f, 0xb9, 0x41, 0x53, 0xd6, 0xfc, 0x56, 0x58, 0x6d, 0x45, 0xd5, 0x56, 0x3e, 0xfa, 0x2a, 0x2a, 0x6d, 0x1c, 0xca, 0xdb,
+  0x2e, 0x9a, 0xc2, 0x7e, 0x7a, 0x95, 0xcc, 0x12, 0xca, 0x7f, 0xef, 0x77, 0x45, 0x8a, 0x12, 0x66, 0x2b, 0xf5, 0xbb, 0x2a,
+  0x77, 0xa9, 0x8c, 0x77, 0xad, 0xaa, 0x40, 0xee, 0x21, 0x44, 0x03, 0xcf, 0xe6, 0x71, 0x5e, 0xd0, 0x33, 0x23, 0x79, 0x1a,
+  0x92, 0x47, 0xdb, 0x42, 0x9e, 0x39, 0x35, 0xec, 0x3e, 0xf0, 0x6e, 0x24, 0x15, 0xe6, 0xc1, 0x0d, 0xbf, 0x21, 0x56, 0xf0,
+  0xfc, 0xf6, 0xa2, 0xc2, 0x4e, 0x23, 0x5b, 0x10, 0x84, 0xbe, 0x2f, 0x72, 0x9f, 0xa7, 0x59, 0x11, 0x04, 0x61, 0xeb, 0xbc,
+  0x39, 0x3c, 0x0e, 0x09, 0x50, 0xfb, 0xdc, 0x0e, 0xd0, 0x6f, 0x7a, 0x3e, 0x74, 0x33, 0xa3, 0x8f, 0x74, 0x2f, 0x41, 0x64,
+  0xe6, 0xfd, 0xac, 0x8c, 0x3e, 0xad, 0x11, 0x2d, 0x29, 0x75, 0x18, 0x03, 0x90, 0xdf, 0xcd, 0xc3, 0xef, 0xe6, 0xa1, 0x65,
+  0x1e, 0x96, 0x97, 0x5c, 0x1b, 0xa7, 0x45, 0xdc, 0x7d, 0xf1, 0xa1, 0x76, 0x7d, 0x24, 0xee, 0x7d, 0x96, 0x57, 0xdc, 0x35,
+  0x5e, 0x87, 0x37, 0xf2, 0x82, 0xe1, 0x2c, 0xc6, 0xb3, 0x91, 0xd0, 0x63, 0x03, 0xef, 0x7f, 0x6b, 0x34, 0xdd, 0xed, 0x50,
+  0xaf, 0x3d, 0x52, 0x27, 0xe7, 0xa4, 0xa4, 0x76, 0x86, 0xf4, 0x53, 0x29, 0x25, 0x4a, 0xee, 0xb4, 0x6b, 0xb5, 0x7b, 0x9f,
+  0xe4, 0x2e, 0x6b, 0x5e, 0xb4, 0xf0, 0x82, 0x88, 0x2e, 0x6a, 0x55, 0x25, 0x01, 0xae, 0x27, 0x78, 0x8c, 0x28, 0xd0, 0xf9,
+  0x77, 0x16, 0x5b, 0xa7, 0x56, 0xe8, 0xc4, 0x9b, 0x71, 0x50, 0xb7, 0xd0, 0x4f, 0xab, 0x14, 0x3a, 0x6c, 0x53, 0xae, 0xf3,
+  0x1c, 0x7a, 0x2c, 0xe0, 0x47, 0xcd, 0xd6, 0x74, 0x42, 0x10, 0x9a, 0xe2, 0x18, 0x9c, 0xff, 0xb4, 0xb4, 0x57, 0xd4, 0x6b,
+  0x81, 0xbb, 0xcf, 0xe2, 0x52, 0xc4, 0x42, 0xde, 0x89, 0xa8, 0xc9, 0xf5, 0x3e, 0x65, 0xa3, 0x48, 0xc9, 0x4e, 0xde, 0x28,
+  0xb9, 0x9b, 0xf4, 0x8d, 0xa3, 0x52, 0x01, 0x97, 0xc3, 0xc4, 0xb5, 0x82, 0x61, 0x36, 0xdd, 0x92, 0xf5, 0x52, 0xce, 0x36,
+  0x31, 0x9d, 0xe5, 0x6b, 0xb3, 0x9e, 0xba, 0xb2, 0xc8, 0x27, 0x6b, 0x36, 0x13, 0x92, 0x5e, 0x11, 0xa9, 0x0b, 0x48, 0x63,
+  0x1c, 0x95, 0x07, 0x7f, 0xcc, 0x3b, 0xda, 0x2d, 0x56, 0xd0, 0x27, 0x72, 0xe4, 0x1e, 0x8b, 0xaa, 0xb0, 0xb0, 0x15, 0xaa,
+  0xf0, 0xd2, 0xd4, 0xd8, 0x04, 0xd3, 0x62, 0xbd, 0x4a, 0x44, 0xb5, 0xff, 0x24, 0xb4, 0x38, 0x9c, 0x6f, 0x5d, 0xf9, 0x7c,
+  0xbb, 0x49, 0x4b, 0xae, 0x5c, 0x84, 0x19, 0x5e, 0x0c, 0x56, 0x04, 0x1b, 0x46, 0x87, 0xbf, 0x7c, 0x69, 0x74, 0x1b, 0xad,
+  0x5e, 0xc9, 0x28, 0x04, 0x88, 0xeb, 0xd3, 0x8d, 0x60, 0x69, 0x01, 0x63, 0x07, 0x96, 0xda, 0xdf, 0xda, 0x10, 0x98, 0x16,
+  0x44, 0x76, 0x60, 0x3d, 0xb8, 0x95, 0x91, 0xe1, 0xe2, 0x8c, 0x1f, 0xaa, 0x01, 0xae, 0x2f, 0xe8, 0xa2, 0x0f, 0x23, 0xab,
+  0x48, 0x93, 0x9d, 0x2f, 0x34, 0xa0, 0xb3, 0x25, 0xba, 0xbf, 0xb1, 0x04, 0xce, 0x60, 0x40, 0x0d, 0xba, 0x2d, 0xb3, 0xe1,
+  0xe4, 0x90, 0xd6, 0x48, 0xd1, 0x73, 0x72, 0x9c, 0xfd, 0x4e, 0xb4, 0x21, 0xb7, 0x94, 0xbd, 0xc5, 0x5b, 0x90, 0x73, 0x8b,
+  0xd6, 0x5b, 0x8b, 0xc9, 0x17, 0xe0, 0x00, 0x97, 0x4d, 0xf9, 0x1a, 0xd5, 0xb5, 0xfe, 0xc0, 0x65, 0x8e, 0x01, 0xe0, 0x43,
+  0xb3, 0x76, 0x77, 0xc1, 0xc0, 0x99, 0xda, 0x69, 0x50, 0x32, 0xb1, 0xb4, 0xc0, 0x64, 0xde, 0xca, 0x90, 0xe9, 0x82, 0x4f,
+  0xdf, 0xbd, 0x1c, 0x5a, 0xb1, 0x36, 0xdd, 0x9c, 0x84, 0x4a, 0xcd, 0x7b, 0x96, 0x62, 0xe3, 0x64, 0xce, 0xdf, 0xf2, 0xa3,
+  0xf1, 0x0b, 0x5a, 0x70, 0x4d, 0x56, 0xfe, 0xb3, 0x65, 0xda, 0x68, 0x9a, 0xce, 0x63, 0xe3, 0x30, 0xa8, 0x74, 0xc0, 0x7c,
+  0x07, 0x34, 0x03, 0xa9, 0x37, 0x04, 0xea, 0xa5, 0xf6, 0x10, 0x68, 0xd7, 0x75, 0x85, 0x8e, 0xf3, 0xaf, 0xe5, 0xb7, 0x24,
+  0x55, 0xc7, 0x06, 0x69, 0x42, 0xaf, 0xe2, 0x26, 0x60, 0xae, 0x4c, 0xec, 0x51, 0x41, 0x73, 0x64, 0x1d, 0x59, 0x47, 0x25,
+  0xe1, 0x69, 0xd7, 0x01, 0x37, 0x15, 0x04, 0xf2, 0x9d, 0xf8, 0xb1, 0x30, 0xe3, 0x1a, 0x61, 0x7b, 0x04, 0xfc, 0x6b, 0x38,
+  0xe2, 0xea, 0x0c, 0x0b, 0xb4, 0x79, 0xb0, 0xb5, 0x84, 0x54, 0x39, 0x3c, 0xfd, 0xda, 0x1a, 0x35, 0x95, 0x74, 0x11, 0x50,
+  0x91, 0x23, 0xb9, 0xad, 0x65, 0x77, 0x0e, 0xb0, 0xd9, 0x7a, 0x47, 0x1b, 0x68, 0x39, 0x14, 0xff, 0x50, 0xd7, 0xe1, 0x51,
+  0x1f, 0xa8, 0x36, 0xad, 0xbb, 0x0f, 0xd5, 0x77, 0xd4, 0xd8, 0xfc, 0x26, 0x88, 0x12, 0x69, 0x86, 0xa3, 0x3b, 0x64, 0x0f,
+  0x1f, 0x6e, 0x76, 0x99, 0x8b, 0xbc, 0xb2, 0xc5, 0x4f, 0xc1, 0xfa, 0xe7, 0x85, 0xac, 0xf3, 0xd7, 0xe2, 0x82, 0x87, 0x8a,
+  0x2b, 0xff, 0x96, 0x73, 0x2c, 0x8f, 0x1a, 0xa6, 0xe4, 0x59, 0x84, 0x2b, 0xba, 0x3d, 0x07, 0x6d, 0x24, 0x2c, 0x6f, 0x99,
+  0xf9, 0x8f, 0xda, 0xc1, 0xe5, 0xd2, 0x14, 0x12, 0x12, 0x75, 0x9a, 0x62, 0x50, 0x12, 0xef, 0x95, 0xfd, 0x19, 0x1e, 0x83,
+  0x8f, 0x38, 0xa6, 0x4e, 0x5e, 0xa0, 0x5f, 0x95, 0x8c, 0x57, 0x81, 0x80, 0xdc, 0x62, 0xfc, 0x00, 0x74, 0xbf, 0xf9, 0x09,
+  0x2d, 0x76, 0xbc, 0xc4, 0x7e, 0xc0, 0x1a, 0xf6, 0xf7, 0x86, 0xdc, 0x7b, 0x43, 0xc2, 0x9a, 0x3b, 0x34, 0xc2, 0x52, 0xf4,
+  0x87, 0x1d, 0xfc, 0xdc, 0x1a, 0xd4, 0x7d, 0xff, 0xee, 0x95, 0xa8, 0xf6, 0xeb, 0xf9, 0x3f, 0x60, 0x55, 0xe1, 0x77, 0x80,
+  0x43, 0xd4, 0x6a, 0x62, 0x3a, 0x82, 0x98, 0xac, 0x3c, 0xcd, 0xdf, 0xc6, 0xdc, 0x08, 0x71, 0xa5, 0x46, 0x83, 0x6e, 0x26,
+  0x29, 0x2f, 0x06, 0x91, 0x1f, 0x58, 0x92, 0x2f, 0xb0, 0x87, 0x2c, 0xbe, 0x4a, 0x2f, 0xb5, 0x1e, 0x78, 0xf7, 0xb5, 0xb7,
+  0xb6, 0xd8, 0x37, 0xe4, 0x04, 0xb1, 0xbd, 0x6e, 0x74, 0x66, 0x9f, 0x62, 0x7d, 0x14, 0xac, 0xeb, 0xd0, 0x35, 0x03, 0x1f,
+  0xbb, 0x9f, 0x8c, 0xdd, 0x51, 0x7c, 0x69, 0x9b, 0x1b, 0x45, 0xb6, 0x72, 0x22, 0x90, 0xb8, 0x95, 0x5e, 0xde, 0xdb, 0x02,
+  0x8d, 0x68, 0x73, 0xdd, 0x0d, 0x03, 0xa5, 0xe7, 0xff, 0x80, 0x6a, 0xb4, 0x66, 0x64, 0x14, 0x04, 0x58, 0xcd, 0x8e, 0x06,
+  0x9a, 0xa7, 0xe3, 0xa1, 0x49, 0x79, 0x3d, 0x15, 0x58, 0xe4, 0xc5, 0x04, 0xbf, 0x39, 0x8a, 0x04, 0xf0, 0x1c, 0xf5, 0x71,
+  0xd0, 0x78, 0x39, 0xa7, 0x2b, 0x68, 0x08, 0xea, 0x80, 0xcd, 0x12, 0x70, 0xce, 0xc0, 0xc7, 0x56, 0x4d, 0xdc, 0xa4, 0x1b,
+  0xbc, 0x8f, 0x79, 0x4e, 0xcc, 0x61, 0xc0, 0x36, 0x44, 0xb0, 0x1e, 0xb8, 0x21, 0x61, 0xec, 0x8d, 0x88, 0xa0, 0x93, 0xd0,
+  0xd2, 0xcd, 0x7a, 0x9a, 0xd4, 0x0b, 0x58, 0xee, 0x42, 0xe6, 0xe3, 0x7c, 0xf9, 0x42, 0x79, 0x3c, 0xf8, 0x7d, 0x6a, 0x0c,
+  0x31, 0xd3, 0xdf, 0x66, 0x4b, 0x07, 0x5f, 0xba, 0x06, 0xde, 0x80, 0x8b, 0x32, 0x9e, 0x84, 0xfc, 0x07, 0x80, 0x78, 0xa9,
+  0x6e, 0xd3, 0x84, 0xc2, 0x34, 0xad, 0x50, 0xbd, 0xe7, 0xa5, 0xc3, 0x92, 0xf5, 0xbf, 0x7c, 0xa1, 0x22, 0x82, 0xa8, 0x65,
+  0x01, 0x36, 0x91, 0x20, 0x80, 0x27, 0x05, 0x46, 0xde, 0xd0, 0x77, 0x4e, 0x60, 0x51, 0x5e, 0xd0, 0x97, 0xc8, 0x55, 0xb6,
+  0x11, 0x5a, 0x55, 0xbe, 0x32, 0xb4, 0x3d, 0x2a, 0xca, 0x64, 0xc7, 0xf6, 0x9d, 0x66, 0x62, 0x59, 0x0c, 0x91, 0x4b, 0x97,
+  0x28, 0x9a, 0xef, 0x8f, 0x0d, 0xe7, 0xb7, 0x92, 0x1a, 0xe4, 0xb2, 0xc2, 0x9a, 0x2f, 0xe7, 0x46, 0x22, 0x8a, 0xd7, 0x5e,
+  0x33, 0xef, 0x44, 0x93, 0x5d, 0x6e, 0x12, 0x40, 0x72, 0xee, 0x47, 0x43, 0xa2, 0xaa, 0xba, 0x1e, 0xad, 0xe6, 0x2b, 0x0b,
+  0xca, 0x4f, 0x05, 0x59, 0x95, 0x8e, 0x89, 0x34, 0xb9, 0x68, 0xc5, 0x5c, 0x70, 0x2e, 0xe0, 0x1a, 0x4d, 0xff, 0xbd, 0x69,
+  0xb2, 0xae, 0x1d, 0x96, 0xf2, 0x39, 0x32, 0x95, 0xd1, 0xa4, 0x6f, 0x0c, 0x84, 0x29, 0x39, 0x72, 0xa5, 0x6e, 0x03, 0x2f,
+  0x6f, 0x66, 0x04, 0x99, 0x3b, 0x9a, 0xb0, 0x00, 0x0c, 0xe8, 0x0a, 0xd3, 0x9b, 0x0b, 0x2a, 0xa0, 0xe1, 0x84, 0x3e, 0x29,
+  0x40, 0x97, 0xe2, 0x65, 0x59, 0x47, 0xde, 0xd8, 0xef, 0x37, 0xbd, 0xfd, 0x92, 0xcf, 0xf8, 0x30, 0x60, 0x7d, 0x20, 0x45,
+  0xe5, 0xb3, 0x6b, 0x23, 0xc1, 0xa4, 0x41, 0x30, 0xfa, 0x81, 0x00, 0xc4, 0x9d, 0x6e, 0x3c, 0x99, 0xad, 0x3a, 0x88, 0xe2,
+  0x6a, 0x34, 0xd5, 0x8f, 0xa3, 0xd6, 0x70, 0x91, 0x06, 0x55, 0xaa, 0xf2, 0xbd, 0x50, 0x95, 0x2d, 0x26, 0x6f, 0x6e, 0x51,
+  0x11, 0x26, 0xf3, 0xc6, 0xd5, 0x7c, 0xa1, 0xcb, 0x68, 0x9b, 0xa4, 0x74, 0x0c, 0xdf, 0xf5, 0xf6, 0x41, 0x07, 0x26, 0x2a,
+  0xd1, 0x59, 0x5c, 0x4c, 0xd2, 0x68, 0xd0, 0x78, 0xfb, 0xfe, 0x0c, 0xaf, 0x60, 0xa3, 0x4f, 0x83, 0xe6, 0x83, 0xcf, 0x0d,
+  0x91, 0x42, 0xd5, 0x3e, 0x03, 0xc2, 0x6d, 0x0c, 0x5c, 0x25, 0xfb, 0xb5, 0x45, 0x9f, 0x2e, 0x1f, 0x30, 0xbf, 0xaa, 0x6e,
+  0xea, 0x57, 0x09, 0xd8, 0x37, 0xa5, 0x6d, 0x76, 0x1f, 0x98, 0x1a, 0xd9, 0xaf, 0xa7, 0x7f, 0xde, 0xd0, 0x6e, 0x75, 0xbf,
+  0x18, 0xe9, 0x31, 0xba, 0xc4, 0x8b, 0x2e, 0x69, 0xd4, 0x09, 0x0c, 0x6f, 0x31, 0x34, 0x08, 0x9d, 0x5f, 0xf6, 0x45, 0x14,
+  0x2e, 0x4c, 0xa6, 0xcb, 0x39, 0xa6, 0x30, 0x36, 0x4b, 0xb2, 0x77, 0x89, 0xae, 0xf2, 0x92, 0x45, 0x92, 0x98, 0x56, 0xe9,
+  0xe1, 0x83, 0x4d, 0x2f, 0x5d, 0x74, 0x6b, 0xe8, 0x3e, 0x94, 0x75, 0x01, 0xa3, 0x7b, 0x33, 0x5c, 0x87, 0x18, 0x1d, 0xf9,
+  0x1c, 0x75, 0xc6, 0x88, 0x7f, 0x14, 0x97, 0x4f, 0x0d, 0xdc, 0x6b, 0x9a, 0x33, 0xee, 0x41, 0x80, 0xf1, 0x02, 0x38, 0x2b,
+  0x3f, 0xde, 0x82, 0x57, 0xc3, 0x0d, 0x60, 0xe1, 0x50, 0x3e, 0xd8, 0x4e, 0xbf, 0x8f, 0xc4, 0xbd, 0xf7, 0x06, 0xe9, 0x21,
+  0x41, 0xc3, 0x42, 0x61, 0xf7, 0x40, 0xff, 0x68, 0xa8, 0x6d, 0x4b, 0xb6, 0x74, 0x69, 0xce, 0xc8, 0x9a, 0x37, 0x04, 0x9b,
+  0xfc, 0x50, 0x2e, 0xff, 0xd8, 0x0d, 0xde, 0x8e, 0x05, 0xd6, 0x22, 0x92, 0x21, 0x05, 0x66, 0xc5, 0x47, 0x3b, 0x1a, 0xc6,
+  0x65, 0x81, 0x52, 0x58, 0x5a, 0xd7, 0x53, 0x55, 0xc1, 0xc4, 0xcb, 0x3e, 0xc6, 0x1a, 0x6a, 0x29, 0x96, 0x54, 0xca, 0xab,
+  0xf5, 0x17, 0x5c, 0x56, 0x41, 0x16, 0xd4, 0xe9, 0x97, 0x56, 0xae, 0x84, 0x70, 0x27, 0xa3, 0xe7, 0xf0, 0x57, 0x7d, 0x53,
+  0xe0, 0x3e, 0xee, 0xc5, 0x24, 0x06, 0xd3, 0x6e, 0x67, 0x75, 0xc8, 0xbf, 0xea, 0xd6, 0xae, 0x12, 0x27, 0x78, 0x79, 0x6e,
+  0xad, 0x3d, 0xed, 0x7e, 0xc4, 0xd6, 0xbc, 0xd1, 0xc9, 0x23, 0x85, 0x75, 0xc4, 0xba, 0x37, 0x9f, 0xd7, 0x31, 0x37, 0xff,
+  0x0e, 0x0d, 0xaa, 0x0e, 0xb2, 0x52, 0x39, 0xf9, 0x5a, 0x9f, 0xe0, 0x68, 0xf0, 0xd1, 0xc8, 0x2f, 0x31, 0x03, 0x4d, 0x56,
+  0xa8, 0x15, 0xfb, 0x63, 0x35, 0x02, 0x2c, 0x14, 0xa9, 0x1e, 0x86, 0x3e, 0xf7, 0xcd, 0x9f, 0x11, 0x02, 0x96, 0x96, 0x90,
+  0x1b, 0xa2, 0x75, 0x9d, 0x57, 0x70, 0x1b, 0xa5, 0x28, 0x00, 0xd7, 0x28, 0xbf, 0x6f, 0xbd, 0x52, 0xb7, 0x4e, 0xa9, 0x31,
+  0x4b, 0xab, 0x31, 0x5b, 0x77, 0xb0, 0x6f, 0x52, 0x1e, 0x9b, 0xdf, 0xcd, 0x5b, 0xa3, 0x38, 0xc4, 0x82, 0xdf, 0x5d, 0x75,
+  0x3c, 0xa8, 0xbd, 0x7c, 0x57, 0x2c, 0x80, 0x69, 0x27, 0x3a, 0x57, 0xee, 0xae, 0xbb, 0x20, 0xfa, 0xdf, 0x0b, 0x47, 0x7b,
+  0xc5, 0x5a, 0x46, 0x18, 0x44, 0x39, 0xc9, 0xd1, 0x27, 0x69, 0xce, 0x23, 0xba, 0xd6, 0x9b, 0xac, 0xe4, 0x6f, 0x70, 0x90,
+  0xe8, 0x6f, 0x8a, 0x19, 0x7d, 0x9b, 0xed, 0xea, 0xdc, 0xd8, 0x7b, 0x7f, 0x97, 0x05, 0x26, 0xde, 0x2b, 0xfd, 0x88, 0xdc,
+  0xb8, 0xd1, 0xa0, 0xbe, 0xc2, 0x65, 0x33, 0xbe, 0xfe, 0x79, 0x2e, 0xfd, 0x9e, 0x48, 0x19, 0x44, 0xa6, 0x8b, 0xd3, 0x9e,
+  0x4f, 0x6b, 0x22, 0x27, 0xf8, 0xc1, 0x60, 0xed, 0xb6, 0x33, 0xd9, 0xa2, 0x43, 0x67, 0x46, 0xe4, 0xed, 0xa7, 0xe2, 0x75,
+  0xc3, 0xad, 0x46, 0x43, 0x6f, 0x20, 0xcd, 0x9d, 0x5a, 0x75, 0xe4, 0xf9, 0x52, 0x45, 0xc7, 0xf5, 0x69, 0x41, 0xbe, 0x2f,
+  0x57, 0xa8, 0x9d, 0x23, 0x1d, 0x88, 0x79, 0x97, 0x98, 0x1c, 0x48, 0xb3, 0x4e, 0xd6, 0xdd, 0x55, 0x2a, 0x25, 0x8e, 0x1f,
+  0xfc, 0xb0, 0xbc, 0xdc, 0xdb, 0xd8, 0x9d, 0x50, 0x3a, 0x9e, 0x64, 0xea, 0x42, 0xca, 0xfd, 0x6a, 0x3d, 0xb2, 0xb9, 0xd4,
+  0xd9, 0xfc, 0x3e, 0xf0, 0xdb, 0xdd, 0x06, 0x5e, 0xe7, 0x86, 0x6e, 0x72, 0x4f, 0xf8, 0xed, 0x6e, 0x09, 0xf7, 0x0a, 0xac,
+  0x6f, 0x74, 0x6b, 0xeb, 0xee, 0xfb, 0xbc, 0x85, 0x98, 0x98, 0x0a, 0x0e, 0xda, 0x5c, 0x4a, 0xb0, 0x71, 0x32, 0x0f, 0xa7,
+  0x53, 0x97, 0xd0, 0x04, 0x39, 0xd6, 0xd1, 0xb9, 0xce, 0x2a, 0xb6, 0x70, 0xe5, 0xaf, 0x9b, 0x12, 0x8c, 0x48, 0xca, 0x30,
+  0x54, 0x90, 0xff, 0x73, 0x7c, 0x6b, 0x24, 0x97, 0xc0, 0x90, 0x67, 0xe3, 0xf6, 0x4f, 0x12, 0x5d, 0x46, 0xf4, 0x39, 0xd0,
+  0x6f, 0x6f, 0xfd, 0x55, 0x5c, 0x93, 0xdb, 0xfd, 0x24, 0x2f, 0x95, 0x75, 0x4b, 0x8c, 0xfb, 0x89, 0x9b, 0x26, 0x25, 0x09,
+  0xa1, 0x68, 0xf1, 0xdf, 0x5b, 0x0c, 0x09, 0xa8, 0x4f, 0x15, 0x84, 0x1a, 0x03, 0x56, 0x45, 0x06, 0xee, 0x59, 0x4c, 0xdc,
+  0xc6, 0x07, 0xb1, 0xe4, 0x88, 0x93, 0xa6, 0x66, 0xc4, 0x6b, 0xa9, 0x9e, 0x1d, 0xaf, 0x35, 0x88, 0x58, 0xd0, 0x3f, 0x2e,
+  0xb4, 0x6e, 0x7e, 0x50, 0xc3, 0xbc, 0x08, 0x8b, 0x65, 0x4e, 0x27, 0xa7, 0xf0, 0x1d, 0xc2, 0x71, 0xa8, 0xb9, 0x4c, 0x39,
+  0xac, 0xce, 0x91, 0xfc, 0x26, 0xdb, 0xa8, 0x62, 0x80, 0xb6, 0x7d, 0xf4, 0x9e, 0xdb, 0x47, 0x4c, 0x0c, 0xaf, 0x56, 0x76,
+  0xae, 0xbd, 0xcd, 0x5b, 0x17, 0x54, 0xbe, 0x0b, 0xac, 0x0d, 0x39, 0x65, 0x86, 0xe7, 0x3c, 0xb2, 0xaf, 0xf2, 0x93, 0x12,
+  0x5e, 0x19, 0xe8, 0xf4, 0xe7, 0x18, 0xc9, 0xf7, 0xfc, 0xd1, 0x09, 0xb1, 0x46, 0xe5, 0x02, 0xc9, 0xd5, 0x31, 0x75, 0x47,
+  0xa9, 0x38, 0xbe, 0x7c, 0xc1, 0xdd, 0x40, 0x57, 0x5d, 0xd8, 0xba, 0xc2, 0x90, 0xda, 0x55, 0x52, 0x78, 0xbd, 0xd5, 0xe9,
+  0xb1, 0xf6, 0x24, 0xab, 0x48, 0x5a, 0x70, 0xd7, 0xc8, 0xbd, 0x09, 0xbc, 0xf9, 0x2d, 0xb6, 0xa0, 0xe8, 0xf0, 0xde, 0xac,
+  0xc1, 0x08, 0x44, 0xcd, 0xff, 0x17, 0x89, 0xca, 0x6c, 0xc1, 0x27, 0x79, 0xf5, 0xc1, 0x3d, 0x89, 0x2e, 0x5d, 0x58, 0x3d,
+  0x7b, 0xfe, 0xea, 0xf9, 0xd9, 0x73, 0x5d, 0x5c, 0xa9, 0x0f, 0x9a, 0x08, 0x51, 0x82, 0xfe, 0xe8, 0x6e, 0xf7, 0x89, 0xc5,
+  0xe2, 0x27, 0xe1, 0x1c, 0x2f, 0x34, 0xe5, 0x48, 0xb1, 0x3e, 0xc6, 0x51, 0x67, 0x05, 0xad, 0xa3, 0x1d, 0x85, 0xcc, 0xfe,
+  0xed, 0xb1, 0x29, 0xdc, 0x95, 0x3e, 0xea, 0x99, 0x9a, 0x78, 0x14, 0x56, 0x59, 0xff, 0xed, 0x98, 0x7a, 0x53, 0x63, 0xed,
+  0x47, 0x3d, 0xea, 0x28, 0x89, 0xdb, 0xe3, 0x6f, 0xe2, 0x6b, 0x87, 0x88, 0xd6, 0x45, 0x19, 0x4e, 0xa8, 0x25, 0x7b, 0xc3,
+  0xbf, 0xe3, 0x29, 0x22, 0x0d, 0x0d, 0xfd, 0xa7, 0x37, 0xbc, 0x50, 0x11, 0x3c, 0xb8, 0x4b, 0xe4, 0x40, 0x53, 0x21, 0x22,
+  0x52, 0x80, 0x2e, 0x9b, 0x1e, 0xdd, 0x33, 0x03, 0x06, 0x2d, 0xe3, 0xb3, 0x94, 0x9a, 0xac, 0x19, 0xa8, 0xcf, 0x50, 0xb7,
+  0x7c, 0x9f, 0xc2, 0x19, 0xb0, 0x8f, 0xc6, 0x7e, 0x9a, 0xcc, 0xc2, 0xe8, 0xca, 0xfc, 0x8b, 0xbe, 0x38, 0x35, 0xa6, 0xe7,
+  0xe9, 0xb5, 0xbc, 0x4d, 0x7a, 0x07, 0xaa, 0xd1, 0xce, 0xde, 0xa6, 0x8d, 0x76, 0xfb, 0xaa, 0xd1, 0xee, 0xc6, 0x3d, 0xd1,
+  0xfe, 0xa3, 0x68, 0xb4, 0xbb, 0xeb, 0x34, 0xd2, 0xda, 0x7c, 0x72, 0x3f, 0x30, 0x79, 0x5f, 0xbe, 0xba, 0xee, 0xa9, 0x37,
+  0x1a, 0x95, 0x97, 0x21, 0xde, 0x2a, 0x96, 0xcf, 0xec, 0x60, 0xfe, 0x3f, 0x35, 0x22, 0x53, 0x1a, 0x1d, 0x1a, 0x46, 0x2b,
+  0xf6, 0x11, 0xd7, 0x79, 0x53, 0x62, 0x30, 0xe5, 0xcb, 0xda, 0x8f, 0x2d, 0xc9, 0xda, 0x7f, 0xfe, 0xf7, 0x96, 0x4c, 0x0b,
+  0xa5, 0xde, 0x77, 0xab, 0xfc, 0x1e, 0x93, 0x1d, 0x79, 0xdf, 0x44, 0x75, 0x57, 0x6b, 0xd8, 0x6f, 0x15, 0xcf, 0xa6, 0x90,
+  0x76, 0xbe, 0x23, 0x71, 0xc7, 0x2f, 0xa7, 0xb8, 0xdf, 0x4f, 0xa9, 0xda, 0x6f, 0xa9, 0xfe, 0xa2, 0x4a, 0xf5, 0x3e, 0x8b,
+  0xa1, 0x33, 0xaa, 0xbe, 0x77, 0xe2, 0x55, 0x2c, 0xeb, 0x46, 0xb1, 0x4e, 0xbf, 0x98, 0x46, 0xb9, 0xf9, 0xbc, 0xa9, 0x17,
+  0x5d, 0xe9, 0x47, 0x7b, 0x2d, 0x34, 0x8e, 0x6a, 0x61, 0x9f, 0xb9, 0x28, 0xa9, 0xd8, 0x1f, 0x71, 0x3e, 0xa6, 0xa4, 0x1b,
+  0x09, 0x5c, 0x5d, 0xdd, 0x32, 0x46, 0xea, 0xd9, 0x23, 0xd9, 0xd0, 0xe4, 0xa3, 0x19, 0xdc, 0xdd, 0xe0, 0xfb, 0x27, 0x66,
+  0x74, 0x39, 0x92, 0x66, 0x06, 0x76, 0x9b, 0xb6, 0xa9, 0x61, 0xde, 0x47, 0x87, 0x5f, 0xb2, 0x8d, 0xad, 0x6b, 0xe9, 0xe4,
+  0x53, 0xa9, 0x57, 0x4d, 0x6d, 0x1f, 0xaf, 0xf9, 0x5c, 0xae, 0xd6, 0x01, 0x18, 0x1b, 0x96, 0x21, 0x81, 0x7a, 0x45, 0x53,
+  0x2b, 0x46, 0xed, 0xba, 0xef, 0x6f, 0x98, 0x73, 0xd2, 0x2f, 0xda, 0xb0, 0x1d, 0x91, 0x5b, 0x0c, 0xac, 0x63, 0x7e, 0x70,
+  0xd7, 0x9b, 0x40, 0x51, 0x9d, 0xe5, 0xbd, 0xbd, 0xcd, 0xfe, 0x46, 0xdf, 0x36, 0xe5, 0xf7, 0xd6, 0x05, 0x2f, 0xb6, 0xf3,
+  0x26, 0x9d, 0xc9, 0xc5, 0x0b, 0x02, 0x67, 0x29, 0x14, 0x61, 0x9a, 0x01, 0xbf, 0x45, 0x50, 0x7c, 0x4e, 0x6e, 0x76, 0x8d,
+  0x17, 0x0b, 0x66, 0xcb, 0x39, 0x7e, 0xad, 0x9b, 0xdf, 0x39, 0x28, 0x41, 0xd1, 0x42, 0x04, 0x2f, 0xb2, 0xa4, 0xc8, 0x47,
+  0x93, 0xf6, 0x49, 0x98, 0x4d, 0x41, 0x5f, 0x35, 0x3b, 0xec, 0x5d, 0xbc, 0x20, 0x66, 0x22, 0xc3, 0x20, 0x67, 0x98, 0xe9,
+  0xce, 0xbf, 0x53, 0x04, 0x7c, 0x05, 0x86, 0x32, 0xcc, 0x2a, 0x25, 0x80, 0x1d, 0x2b, 0x43, 0x54, 0xbb, 0x5b, 0x70, 0x81,
+  0xb7, 0x0a, 0x5a, 0x1f, 0x57, 0x11, 0xb9, 0x76, 0x3c, 0x15, 0x6b, 0xa1, 0x52, 0x27, 0x28, 0x3b, 0x68, 0x1a, 0xd8, 0xe9,
+  0xde, 0x80, 0x03, 0x82, 0x85, 0x11, 0x99, 0x09, 0x58, 0x26, 0x93, 0x5e, 0x8b, 0x45, 0xf0, 0x37, 0xea, 0xf9, 0xb7, 0xfd,
+  0xb0, 0x5e, 0xd0, 0x7f, 0x34, 0xe9, 0xe2, 0xc5, 0x7b, 0xbd, 0xe6, 0xa3, 0xa8, 0x8b, 0x37, 0xe5, 0x75, 0x1f, 0x61, 0xfd,
+  0x6d, 0x04, 0xc1, 0xdf, 0x5b, 0xca, 0xb8, 0x5b, 0xe6, 0x06, 0x51, 0x7a, 0x53, 0x9e, 0x5c, 0xcc, 0x03, 0x18, 0x3a, 0xe6,
+  0x76, 0x97, 0x2f, 0xa2, 0x6e, 0x53, 0x7d, 0xb6, 0xb6, 0x6b, 0x42, 0x30, 0x2a, 0xd9, 0xcd, 0x7a, 0x94, 0xb7, 0x44, 0x2f,
+  0xc2, 0xf3, 0x1c, 0xe1, 0x1e, 0x97, 0xbf, 0x76, 0x1e, 0xe9, 0x60, 0xf1, 0x97, 0x73, 0xa1, 0x42, 0xae, 0x9d, 0x61, 0x2a,
+  0xb3, 0x36, 0xe8, 0xe8, 0xb7, 0x7e, 0xdc, 0x4d, 0x1e, 0x76, 0xa1, 0xf7, 0x47, 0x6c, 0x61, 0x1c, 0xc6, 0xd0, 0x65, 0x0e,
+  0xb6, 0x8e, 0xe9, 0x23, 0x4d, 0x54, 0xb7, 0xec, 0x4f, 0x40, 0xc0, 0xb2, 0xc7, 0xac, 0x67, 0xc2, 0x80, 0x19, 0xc0, 0xaf,
+  0x8f, 0x50, 0xf6, 0x58, 0x1e, 0xba, 0x39, 0x96, 0x6f, 0x3e, 0x89, 0xcc, 0x2d, 0x2c, 0x7c, 0xec, 0xfb, 0xa2, 0xed, 0xc7,
+  0x4f, 0x2d, 0xf2, 0xf4, 0xf5, 0xb8, 0xaf, 0xba, 0x6e, 0xe8, 0x52, 0x0d, 0x04, 0x1e, 0x8f, 0x10, 0x08, 0x3c, 0xd0, 0xcd,
+  0x43, 0x6c, 0xc2, 0xf3, 0x61, 0xb1, 0x9b, 0x4b, 0xd5, 0x6d, 0x9b, 0xba, 0xbd, 0x14, 0x9d, 0x1e, 0xb2, 0x88, 0x57, 0xd2,
+  0x6a, 0xf1, 0x2b, 0x10, 0x65, 0x2d, 0x4a, 0x1c, 0xdb, 0x66, 0x93, 0x8f, 0x93, 0xf2, 0xd4, 0x90, 0xb1, 0xaf, 0x43, 0x89,
+  0xc4, 0x7a, 0x06, 0x0f, 0x62, 0x8b, 0xcd, 0x3e, 0xd2, 0xa0, 0x3e, 0xa1, 0xc8, 0xc1, 0x24, 0x46, 0x78, 0x81, 0x53, 0x55,
+  0x3f, 0xcb, 0xf6, 0xea, 0xa3, 0x50, 0x93, 0x32, 0xa3, 0xac, 0x67, 0xda, 0x06, 0x1a, 0x30, 0x49, 0xd1, 0xc1, 0x04, 0xc0,
+  0x00, 0x41, 0x7f, 0xec, 0x21, 0x72, 0xe8, 0x39, 0xfa, 0x88, 0x23, 0x33, 0x9a, 0x89, 0x2e, 0xb5, 0x46, 0xda, 0x2c, 0x5a,
+  0xfa, 0xa4, 0xfa, 0x04, 0x20, 0xd2, 0x4b, 0xb5, 0x9f, 0x7d, 0x13, 0xb0, 0x81, 0xfc, 0x1e, 0x47, 0xfc, 0x44, 0x7d, 0x2e,
+  0xec, 0xd2, 0xfe, 0x5c, 0x98, 0x60, 0x93, 0x8f, 0x97, 0x00, 0xb6, 0x64, 0x15, 0xf8, 0xfd, 0xc9, 0xc7, 0x38, 0xbc, 0x9e,
+  0xc3, 0x06, 0x50, 0x1b, 0x08, 0x1d, 0x8f, 0x36, 0x27, 0x73, 0xfb, 0xdb, 0x60, 0xe2, 0xf3, 0xca, 0x3d, 0x18, 0x0d, 0x30,
+  0x2f, 0xc2, 0x05, 0x36, 0x25, 0x30, 0x2d, 0x76, 0x8d, 0x76, 0x9a, 0x78, 0x47, 0x85, 0xd6, 0x5d, 0x9f, 0x0a, 0xbb, 0x8f,
+  0x71, 0x38, 0x2c, 0x00, 0x28, 0x8f, 0xa1, 0x11, 0xf1, 0xfb, 0x75, 0x6f, 0x5b, 0x8c, 0x1a, 0x5f, 0x6d, 0xd3, 0x18, 0x0e,
+  0xd7, 0x7c, 0x81, 0x4c, 0x32, 0x96, 0x60, 0x03, 0x3b, 0x5d, 0x47, 0x30, 0xe5, 0xec, 0x7b, 0x5a, 0xf3, 0xf7, 0xb4, 0xe6,
+  0xef, 0x69, 0xcd, 0xdf, 0xd3, 0x9a, 0xbf, 0xa7, 0x35, 0x7f, 0x4f, 0x6b, 0xfe, 0x8f, 0x91, 0xd6, 0x0c, 0xb6, 0x3e, 0xcf,
+  0x57, 0x29, 0x93, 0x41, 0xda, 0x6c, 0x89, 0x3b, 0x90, 0x6e, 0x2a, 0x1a, 0x7e, 0x77, 0x37, 0x0e, 0x23, 0xd5, 0xd0, 0xbc,
+  0xf4, 0xa3, 0xe6, 0x2d, 0xff, 0xfc, 0x3b, 0xf6, 0x7f, 0xb4, 0x9d, 0x8f, 0xb2, 0x64, 0x51, 0x1c, 0x3f, 0x38, 0xda, 0xc6,
+  0x20, 0x1a, 0xfe, 0x9d, 0x14, 0xb3, 0xe9, 0xf1, 0x83, 0xff, 0x07, 0xe9, 0xc2, 0x33, 0xc1, 0x9b, 0xbc, 0x00, 0x00,
+};
+static const WebAsset WEB_ASSET_PROFILE = {"/profile", "text/html", WEB_ASSET_PROFILE_GZ, sizeof(WEB_ASSET_PROFILE_GZ), "\"42bf5a7a3775d27c\""};
+
+// web/systemlink.html: 10426 bytes, 3145 gzipped
+static const uint8_t WEB_ASSET_SYSTEMLINK_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5a, 0xff, 0x73, 0xda, 0x46, 0x16, 0xff, 0x3d, 0x7f,
+  0xc5, 0x0b, 0xb9, 0x0e, 0x70, 0x23, 0x09, 0x49, 0x60, 0x83, 0x05, 0xb8, 0x75, 0xdc, 0x66, 0xce, 0x77, 0x49, 0x9b, 0xd6,
+  0xc9, 0x75, 0x7a, 0x37, 0x9d, 0xc9, 0x22, 0x2d, 0xa0, 0x5a, 0x48, 0x1a, 0x69, 0x31, 0xa6, 0xa9, 0xff, 0xf7, 0x7b, 0xfb,
+  0x45, 0xd2, 0x4a, 0x08, 0x9b, 0xb6, 0x57, 0x3c, 0xc1, 0xd2, 0xee, 0xdb, 0xb7, 0xef, 0xeb, 0xe7, 0xbd, 0x5d, 0x67, 0xf6,
+  0xf2, 0xeb, 0xef, 0xae, 0x3f, 0xfc, 0xf4, 0xfe, 0x1b, 0x58, 0xb3, 0x4d, 0x74, 0xf9, 0x62, 0xc6, 0x7f, 0x41, 0x44, 0xe2,
+  0xd5, 0xbc, 0x43, 0xe3, 0x0e, 0x1f, 0xa0, 0x24, 0xb8, 0x7c, 0x01, 0x30, 0xdb, 0x50, 0x46, 0xc0, 0x5f, 0x93, 0x2c, 0xa7,
+  0x6c, 0xde, 0xf9, 0xf8, 0xe1, 0x8d, 0x39, 0xe9, 0xc0, 0xa0, 0x9a, 0x8a, 0xc9, 0x86, 0xce, 0x3b, 0xf7, 0x21, 0xdd, 0xa5,
+  0x49, 0xc6, 0x3a, 0xe0, 0x27, 0x31, 0xa3, 0x31, 0x92, 0xee, 0xc2, 0x80, 0xad, 0xe7, 0x01, 0xbd, 0x0f, 0x7d, 0x6a, 0x8a,
+  0x17, 0x03, 0xc2, 0x38, 0x64, 0x21, 0x89, 0xcc, 0xdc, 0x27, 0x11, 0x9d, 0x3b, 0x96, 0x5d, 0xb0, 0x62, 0x21, 0x8b, 0xe8,
+  0xe5, 0xed, 0x3e, 0x67, 0x74, 0xf3, 0x36, 0x8c, 0xef, 0xe0, 0x3a, 0x89, 0x97, 0xe1, 0x6a, 0x9b, 0x11, 0x16, 0x26, 0xf1,
+  0x6c, 0x20, 0xe7, 0x39, 0x65, 0xce, 0xf6, 0xf2, 0x09, 0xe0, 0xef, 0xf0, 0x19, 0x16, 0xc9, 0x83, 0x99, 0x87, 0xbf, 0x86,
+  0xf1, 0xca, 0xc3, 0xe7, 0x2c, 0xa0, 0x99, 0x89, 0x43, 0x53, 0x78, 0x14, 0x14, 0x8b, 0x24, 0xd8, 0x23, 0xd1, 0x12, 0x65,
+  0x32, 0x97, 0x64, 0x13, 0x46, 0x7b, 0x0f, 0xba, 0xb7, 0x74, 0x95, 0x50, 0xf8, 0x78, 0xd3, 0x35, 0xe0, 0x06, 0x65, 0xcd,
+  0x0c, 0x30, 0x49, 0x9a, 0x46, 0xd4, 0xcc, 0xc5, 0xf6, 0x06, 0xe4, 0x24, 0xce, 0xcd, 0x9c, 0x66, 0xe1, 0x72, 0x0a, 0x0b,
+  0xe2, 0xdf, 0xad, 0xb2, 0x64, 0x1b, 0x07, 0x1e, 0xbc, 0x1a, 0x8a, 0xcf, 0x14, 0x75, 0x8c, 0x92, 0x0c, 0xdf, 0xdf, 0x88,
+  0xcf, 0x14, 0x36, 0x24, 0x5b, 0x85, 0xb1, 0x07, 0xf6, 0x14, 0x52, 0x12, 0x04, 0x42, 0x18, 0x77, 0x94, 0xa2, 0x18, 0x9b,
+  0x30, 0x36, 0xd7, 0x34, 0x5c, 0xad, 0x99, 0x07, 0x8e, 0x6d, 0xdf, 0xaf, 0x0b, 0xc9, 0x2c, 0x96, 0xa4, 0x31, 0xb9, 0x47,
+  0xe1, 0x36, 0xe4, 0x41, 0x9a, 0x07, 0x29, 0x90, 0x44, 0xac, 0x2a, 0xf8, 0x01, 0xd9, 0xb2, 0x04, 0x5c, 0x31, 0x58, 0x72,
+  0x76, 0x04, 0xe7, 0x20, 0xcc, 0xd3, 0x88, 0xec, 0xbd, 0x65, 0x44, 0xf1, 0x8d, 0x7f, 0x9b, 0xbb, 0x8c, 0xa4, 0x1e, 0xff,
+  0x9a, 0xc2, 0x0a, 0x9f, 0x1c, 0xb1, 0x4c, 0x53, 0xe0, 0x95, 0xfb, 0x35, 0xff, 0x99, 0x56, 0x86, 0x62, 0x2c, 0xd9, 0x78,
+  0x6e, 0xfa, 0x00, 0x79, 0x12, 0x85, 0x01, 0xbc, 0x1a, 0x8d, 0x46, 0x53, 0x20, 0x51, 0xb8, 0x8a, 0xcd, 0x10, 0x4d, 0x91,
+  0x7b, 0x3e, 0xe5, 0x16, 0x6a, 0x08, 0x6d, 0x46, 0xc9, 0x2a, 0x41, 0xc9, 0xeb, 0x22, 0xb4, 0x2d, 0xab, 0xc4, 0x90, 0x2a,
+  0x99, 0x99, 0x30, 0x05, 0xd7, 0x6a, 0x2a, 0xbd, 0xb2, 0x93, 0xc6, 0xb9, 0xb0, 0x6d, 0x35, 0x80, 0xce, 0xa4, 0x9e, 0xd4,
+  0x58, 0x9a, 0xf9, 0x95, 0x6d, 0x5f, 0x5c, 0x70, 0xb9, 0x18, 0x7d, 0x60, 0x26, 0xcb, 0xd0, 0x39, 0xcb, 0x24, 0xdb, 0x78,
+  0xdb, 0x34, 0xa5, 0x99, 0x4f, 0x72, 0x3a, 0x85, 0x88, 0x32, 0xdc, 0xce, 0xcc, 0x53, 0xe2, 0x73, 0x0b, 0x39, 0xe9, 0x43,
+  0xd3, 0xcc, 0x44, 0x13, 0x37, 0x8c, 0xa3, 0x30, 0xa6, 0xe6, 0x71, 0xa9, 0x7f, 0xd9, 0xe6, 0x2c, 0x5c, 0xee, 0x4d, 0x15,
+  0xca, 0xe5, 0x38, 0x77, 0xa6, 0xf4, 0x94, 0xf2, 0x53, 0xe1, 0x12, 0x87, 0x9b, 0xd0, 0x39, 0x17, 0xe6, 0x96, 0xa6, 0xcd,
+  0x48, 0x10, 0x6e, 0x73, 0xcf, 0xae, 0xdb, 0x7f, 0x78, 0xc5, 0x7f, 0x4a, 0xc5, 0xae, 0xc5, 0x47, 0x29, 0x16, 0x50, 0x3f,
+  0x91, 0xd1, 0xee, 0xc5, 0x49, 0x4c, 0xeb, 0xe6, 0x19, 0x73, 0xf3, 0x1c, 0xd7, 0xbf, 0x32, 0x9c, 0x8c, 0x0d, 0x41, 0x14,
+  0x0a, 0x5e, 0x60, 0x5b, 0x6e, 0x7e, 0x60, 0x0d, 0x6f, 0x9d, 0xdc, 0xd3, 0x8c, 0xa7, 0x8f, 0x26, 0xdd, 0x48, 0x7c, 0x4a,
+  0xe9, 0x44, 0x64, 0x37, 0xd6, 0x59, 0xc4, 0x67, 0xe1, 0x3d, 0x6d, 0x2c, 0x2c, 0x1c, 0xa4, 0x16, 0x2e, 0x97, 0xcb, 0x72,
+  0x61, 0xbe, 0xa6, 0x51, 0x04, 0x9f, 0xc5, 0x0b, 0xb4, 0x84, 0x7a, 0x39, 0xa1, 0x07, 0x7c, 0x31, 0x5a, 0xcb, 0x3d, 0x15,
+  0xbb, 0xc5, 0x94, 0x30, 0xb3, 0x07, 0xc2, 0x54, 0xb5, 0x31, 0x13, 0x65, 0xf5, 0x60, 0x54, 0xc5, 0xb4, 0x92, 0x4e, 0x10,
+  0x29, 0xa9, 0xd6, 0x34, 0x4b, 0x4a, 0xa1, 0xea, 0x19, 0xdb, 0xba, 0xb5, 0xf8, 0x34, 0xb6, 0x51, 0xc9, 0x03, 0x4e, 0x3d,
+  0x7b, 0xb4, 0x6d, 0xd6, 0x8e, 0xa6, 0x78, 0xa1, 0x9f, 0x0d, 0x93, 0x6a, 0x97, 0xca, 0x6f, 0xe0, 0x6a, 0xc3, 0x0d, 0x47,
+  0x43, 0xe5, 0x69, 0x7d, 0x9d, 0x0a, 0x0d, 0xe0, 0xa9, 0xa3, 0x2b, 0x97, 0x6f, 0x17, 0x02, 0x2d, 0xcb, 0xcd, 0x0b, 0xb4,
+  0xba, 0xba, 0xba, 0x6a, 0xd9, 0xd8, 0xd1, 0xb4, 0x16, 0x79, 0x51, 0xc2, 0x95, 0x75, 0xd6, 0xba, 0xdf, 0x22, 0x89, 0x82,
+  0xda, 0x86, 0x2a, 0x4d, 0x9e, 0x36, 0x68, 0x91, 0x7c, 0xb0, 0xca, 0xc2, 0xa0, 0x18, 0xe4, 0xf0, 0x20, 0xd1, 0xad, 0xc6,
+  0x8f, 0x64, 0x41, 0xc9, 0xac, 0x8e, 0xbf, 0x32, 0x7f, 0x9e, 0x88, 0x81, 0x6a, 0xef, 0x56, 0xae, 0x6b, 0xb7, 0xd5, 0x25,
+  0x3c, 0x7f, 0xdb, 0x4c, 0xf3, 0x87, 0x7d, 0x32, 0x69, 0xf8, 0x84, 0x2b, 0x5d, 0xee, 0xdc, 0x6e, 0x0a, 0x7c, 0x36, 0x11,
+  0x85, 0x70, 0x86, 0x51, 0x44, 0x9e, 0x68, 0xbb, 0x89, 0x73, 0x0f, 0x32, 0x9a, 0x52, 0xc2, 0x7a, 0x3c, 0x2b, 0xcc, 0x65,
+  0xc8, 0x0c, 0x8e, 0x41, 0x98, 0x45, 0x3d, 0xf7, 0x1c, 0xf5, 0x33, 0xc0, 0x59, 0x66, 0xfd, 0x7e, 0xcd, 0x9a, 0x02, 0x85,
+  0xb4, 0xad, 0x23, 0xb2, 0xa0, 0xd1, 0xe1, 0xd6, 0x8b, 0x28, 0xf1, 0xef, 0xea, 0xd9, 0x57, 0x46, 0x74, 0x7b, 0x80, 0x3a,
+  0xc3, 0x6a, 0xb8, 0x25, 0xa2, 0x7e, 0x9f, 0x7d, 0xc6, 0x75, 0xfb, 0x84, 0x71, 0xba, 0x65, 0xff, 0x65, 0xfb, 0x14, 0x3b,
+  0x09, 0xce, 0xa8, 0xf3, 0xb3, 0x71, 0x30, 0x9e, 0x92, 0x3c, 0xdf, 0xa1, 0xc7, 0x3b, 0x3f, 0x97, 0xda, 0x14, 0x50, 0x62,
+  0xdb, 0x5f, 0x1c, 0xf8, 0x5f, 0x42, 0xb2, 0x9e, 0xd1, 0x2a, 0x5a, 0xda, 0xf2, 0x15, 0x1a, 0xb0, 0x0d, 0xf6, 0x09, 0x38,
+  0xa0, 0x35, 0x01, 0xcf, 0xa4, 0xd5, 0x93, 0xe9, 0x23, 0x74, 0xf4, 0x96, 0x89, 0xbf, 0xcd, 0x4b, 0xc5, 0x92, 0x2d, 0xe3,
+  0xa9, 0xd8, 0x0a, 0x6f, 0xc5, 0xb6, 0x2d, 0xb0, 0xc6, 0x92, 0xd5, 0x4a, 0xcb, 0xfb, 0xd2, 0xd9, 0xa2, 0xd2, 0xa9, 0x41,
+  0xbd, 0xde, 0x81, 0x2a, 0x6c, 0xb5, 0xf8, 0x39, 0x92, 0x0a, 0xcf, 0xab, 0xf3, 0x6c, 0x0c, 0xd4, 0xa5, 0x14, 0x7a, 0x37,
+  0x5d, 0xe9, 0x6a, 0x35, 0xa1, 0xc0, 0x21, 0x7d, 0x8c, 0xf8, 0x5c, 0xe4, 0xa7, 0x6c, 0xc0, 0x0b, 0x54, 0x12, 0xe7, 0x4f,
+  0x1b, 0xe1, 0x50, 0xd3, 0xb2, 0x7d, 0x02, 0xd1, 0x3f, 0x3d, 0x67, 0x2c, 0xd5, 0x5d, 0x6e, 0x31, 0x61, 0x62, 0x03, 0xcb,
+  0xa2, 0x7c, 0x2a, 0x37, 0xc5, 0x76, 0x92, 0x12, 0xb4, 0x83, 0xdf, 0xea, 0xc2, 0xfa, 0x98, 0xbf, 0xcd, 0x72, 0xae, 0x4c,
+  0x9a, 0x84, 0xba, 0x33, 0x6a, 0xdd, 0x5e, 0xcd, 0x06, 0xc7, 0x42, 0xb5, 0x30, 0x0a, 0x2f, 0xbf, 0xba, 0x43, 0xb4, 0xc6,
+  0xa2, 0xb6, 0x71, 0x7b, 0x42, 0x9e, 0x9a, 0xc9, 0x87, 0x61, 0x51, 0x4b, 0x15, 0xd5, 0x4b, 0x14, 0x2c, 0xb5, 0x7e, 0xa4,
+  0x22, 0x93, 0xad, 0xc9, 0x81, 0x3d, 0x65, 0x6f, 0x52, 0x59, 0xb5, 0xad, 0x57, 0x81, 0x57, 0x67, 0xe2, 0x33, 0xad, 0xad,
+  0xb4, 0xd2, 0x2c, 0x44, 0x2c, 0xdb, 0x57, 0x6b, 0x8b, 0x91, 0xf6, 0x72, 0x72, 0x18, 0x3e, 0xf5, 0x55, 0x4d, 0x49, 0xea,
+  0xe3, 0xc7, 0x78, 0x8e, 0xaf, 0x86, 0xe7, 0x05, 0xcf, 0x13, 0xd4, 0xd2, 0x4d, 0x24, 0x0d, 0x2e, 0x1e, 0x79, 0x19, 0xf8,
+  0xa9, 0x67, 0x22, 0x5a, 0x95, 0xf8, 0x9e, 0xf0, 0xf6, 0x96, 0xed, 0x79, 0x4b, 0x77, 0x71, 0x56, 0x0b, 0xfa, 0xa7, 0xb4,
+  0xe4, 0x40, 0x42, 0x32, 0x73, 0xc5, 0xe3, 0x05, 0x23, 0xb8, 0xe7, 0x0c, 0xcf, 0x02, 0xba, 0x32, 0x30, 0x4e, 0x5c, 0x7f,
+  0x31, 0x3e, 0xc3, 0x07, 0x7f, 0x34, 0x19, 0x0e, 0xc7, 0xfd, 0x66, 0x1c, 0xb9, 0xae, 0x33, 0xb1, 0xeb, 0xa9, 0x9b, 0x63,
+  0x28, 0xc5, 0xc1, 0xb1, 0x9d, 0xb2, 0xd5, 0x82, 0xf4, 0xdc, 0x33, 0x64, 0x59, 0x7d, 0xd9, 0x96, 0x3d, 0x39, 0xe0, 0xbc,
+  0x1c, 0xe2, 0xe1, 0x72, 0x71, 0x1c, 0x98, 0x25, 0xa3, 0x91, 0x8b, 0x3c, 0xec, 0x21, 0x16, 0x39, 0x67, 0xcc, 0x19, 0x39,
+  0xa3, 0x7e, 0x5d, 0x18, 0x46, 0x98, 0x86, 0x99, 0xfa, 0x49, 0x4b, 0x6f, 0x3c, 0x8a, 0x4d, 0x83, 0x85, 0x4f, 0x16, 0xe7,
+  0x4f, 0xc6, 0xb0, 0x62, 0x2c, 0x8e, 0xb5, 0x27, 0xe0, 0xc7, 0xe4, 0x59, 0xfc, 0x28, 0xf6, 0xc6, 0xad, 0x27, 0x17, 0xf6,
+  0x29, 0x7b, 0xaf, 0x43, 0xad, 0x91, 0x7a, 0x7e, 0xf9, 0xf0, 0xf9, 0xde, 0x4d, 0x15, 0x77, 0xd1, 0x15, 0x4f, 0xea, 0xbb,
+  0x7d, 0xb5, 0xa1, 0x41, 0x48, 0xa0, 0xa7, 0xb5, 0xe5, 0xe7, 0x23, 0x44, 0x9a, 0x7e, 0xe5, 0x5e, 0x79, 0x7e, 0x6e, 0x1c,
+  0x3d, 0x1f, 0xd5, 0xac, 0xe8, 0xa3, 0x0d, 0xad, 0x01, 0xd4, 0x08, 0x27, 0x3a, 0x21, 0xef, 0x84, 0x0f, 0x9a, 0x5d, 0x35,
+  0x7b, 0x54, 0x94, 0xd1, 0xe4, 0x69, 0x51, 0xec, 0x9a, 0x28, 0xc5, 0x71, 0x5a, 0xbd, 0x37, 0x3a, 0x81, 0x69, 0x39, 0x2c,
+  0x5c, 0xa7, 0x79, 0xae, 0xc1, 0x40, 0x1d, 0x6d, 0x4b, 0xf2, 0x96, 0x16, 0x03, 0xea, 0x67, 0xd9, 0x0a, 0x80, 0xe1, 0xe0,
+  0xe0, 0xd8, 0x28, 0xb0, 0x47, 0x9b, 0xcb, 0xa6, 0x16, 0x44, 0x93, 0x80, 0x87, 0x16, 0x52, 0xe3, 0x8f, 0x4f, 0x22, 0xbf,
+  0x77, 0x66, 0x7f, 0x01, 0x26, 0x57, 0xa0, 0xaf, 0xc9, 0x53, 0x9e, 0x4b, 0x75, 0x61, 0x1a, 0xad, 0x90, 0xad, 0x5b, 0x41,
+  0x97, 0xc3, 0x6d, 0x91, 0xa3, 0xee, 0x58, 0xa3, 0xd1, 0x93, 0xeb, 0xbc, 0xcf, 0x0f, 0x57, 0x6b, 0xe7, 0x9e, 0xfa, 0x11,
+  0x67, 0xd4, 0xb2, 0x53, 0xad, 0x33, 0x3e, 0xda, 0x06, 0x63, 0x9f, 0x7b, 0xb0, 0xb2, 0xa8, 0xf4, 0x97, 0xfc, 0x1e, 0xe8,
+  0x29, 0x87, 0x95, 0x2b, 0x6a, 0x89, 0x5d, 0x64, 0xb1, 0xdd, 0x14, 0x8a, 0x7f, 0xcf, 0x06, 0xea, 0x9a, 0x69, 0x36, 0x90,
+  0x17, 0x61, 0x33, 0x1e, 0x7e, 0xe2, 0xfe, 0x89, 0xfb, 0xc7, 0x8f, 0xb0, 0x19, 0xc5, 0x56, 0x55, 0x78, 0xab, 0x23, 0x2f,
+  0xa3, 0x66, 0x41, 0xd8, 0x98, 0x10, 0xb1, 0xa4, 0x66, 0xf9, 0xc5, 0xd5, 0xfd, 0x4a, 0x4a, 0x37, 0xef, 0xb8, 0xa3, 0x8e,
+  0x6a, 0x6f, 0xe4, 0x33, 0xbf, 0x3d, 0x7b, 0x9d, 0x3c, 0xcc, 0x3b, 0xfc, 0x30, 0xe2, 0x8e, 0x80, 0x8f, 0x2d, 0xc3, 0x28,
+  0x9a, 0x77, 0x78, 0xc1, 0xee, 0xc0, 0xc3, 0x26, 0x8a, 0x91, 0xed, 0x9a, 0xb1, 0xd4, 0x1b, 0x0c, 0x76, 0xbb, 0x9d, 0xb5,
+  0x1b, 0x5a, 0x49, 0xb6, 0x1a, 0xb8, 0xb6, 0x6d, 0x0f, 0x90, 0x71, 0xb9, 0x0b, 0xee, 0x93, 0x12, 0xb6, 0x86, 0x60, 0xde,
+  0x79, 0x37, 0xb2, 0xce, 0x0c, 0xc7, 0x86, 0x6b, 0x97, 0xff, 0x3e, 0x83, 0x0b, 0xc3, 0x19, 0xa3, 0xb7, 0xf9, 0xf7, 0xb5,
+  0x73, 0xc6, 0x7f, 0xb9, 0x8e, 0x9c, 0x71, 0x2e, 0x14, 0xa5, 0x33, 0xc6, 0x07, 0x7c, 0x77, 0x8c, 0x21, 0x4c, 0xf0, 0xdf,
+  0xf5, 0x19, 0x7e, 0x9d, 0x8b, 0x31, 0xc5, 0xec, 0x3f, 0x85, 0x60, 0xaa, 0x78, 0xaa, 0xfb, 0xbb, 0xe6, 0xd6, 0x82, 0xf6,
+  0x7b, 0xbe, 0xd9, 0x08, 0xb9, 0x1b, 0x17, 0x1d, 0xc8, 0x59, 0x96, 0xdc, 0x61, 0x1b, 0xaf, 0xce, 0xf1, 0xc5, 0x80, 0xa9,
+  0x2c, 0x82, 0x92, 0xd4, 0x55, 0x6e, 0x65, 0x8b, 0x2a, 0x4c, 0xe0, 0xfb, 0x89, 0xe1, 0xe2, 0x91, 0xcd, 0x36, 0x5c, 0x57,
+  0x63, 0x5b, 0x88, 0x53, 0x67, 0xeb, 0xd6, 0x99, 0xaa, 0x49, 0x0e, 0x95, 0x3e, 0x49, 0xe7, 0x1d, 0x51, 0xb8, 0x8e, 0xec,
+  0xc5, 0x85, 0xbf, 0x40, 0x1d, 0x1c, 0xc3, 0xc5, 0xe4, 0x1b, 0x1a, 0xee, 0xf0, 0x2f, 0xdd, 0xed, 0x4c, 0xa8, 0xe6, 0x8c,
+  0x84, 0x6e, 0xe7, 0x7f, 0x81, 0x6e, 0x33, 0x1e, 0x27, 0xc5, 0xcb, 0x0f, 0x09, 0xc9, 0x11, 0x98, 0xf8, 0x2d, 0x2b, 0x2e,
+  0x8b, 0x64, 0x00, 0x0f, 0x30, 0x82, 0x55, 0x2c, 0x13, 0x58, 0x67, 0x74, 0x39, 0xef, 0x0c, 0x3a, 0x97, 0x48, 0x82, 0x55,
+  0x99, 0xce, 0x06, 0xa4, 0x39, 0x97, 0x66, 0x09, 0x0a, 0x40, 0x3b, 0x97, 0xef, 0xe5, 0x43, 0xde, 0x46, 0x13, 0x06, 0x38,
+  0x7f, 0xf3, 0x75, 0xcb, 0xd4, 0x36, 0x0d, 0x30, 0xc7, 0x3b, 0x97, 0x1f, 0xc5, 0x6f, 0x9d, 0x40, 0x65, 0x91, 0xbc, 0x6b,
+  0xea, 0x14, 0xf4, 0xf2, 0x76, 0x16, 0xf5, 0xbb, 0xeb, 0x68, 0x17, 0xc5, 0x6a, 0xdd, 0x6c, 0x80, 0x09, 0x27, 0x1e, 0xb4,
+  0x34, 0x14, 0x97, 0x4f, 0x2d, 0xe9, 0xc9, 0xd1, 0xad, 0xca, 0xcb, 0xb5, 0x53, 0x63, 0x87, 0xaf, 0xc5, 0x8c, 0xce, 0x4a,
+  0x5d, 0xaa, 0x08, 0x7b, 0x88, 0x8b, 0x69, 0x8a, 0xfd, 0x18, 0x07, 0x20, 0x12, 0x41, 0xba, 0x5d, 0x44, 0x61, 0x8e, 0xa5,
+  0x7b, 0x05, 0x2c, 0x81, 0x6f, 0x6f, 0xa0, 0xe2, 0x67, 0xc1, 0x87, 0x35, 0x85, 0x4c, 0x99, 0xdb, 0x27, 0x31, 0xf6, 0x07,
+  0x78, 0x9e, 0xc0, 0x6a, 0x7d, 0x4f, 0x81, 0x91, 0x55, 0x0e, 0xc1, 0x36, 0xe3, 0x0b, 0x89, 0x24, 0x02, 0x82, 0x7d, 0xb1,
+  0xe2, 0x87, 0x63, 0x8c, 0xe2, 0x50, 0x46, 0xf3, 0x6d, 0xc4, 0xf8, 0xe5, 0xb9, 0x1f, 0x6d, 0x03, 0x49, 0xec, 0xc0, 0x3f,
+  0x7e, 0x55, 0x2b, 0xb0, 0x5d, 0xf4, 0x29, 0x5c, 0xdf, 0xfe, 0xdb, 0x80, 0xdd, 0x9a, 0xc6, 0xc0, 0x8a, 0x0d, 0x81, 0x1f,
+  0x99, 0x69, 0x8e, 0x0b, 0x73, 0x64, 0x94, 0x61, 0x95, 0x40, 0x3b, 0x07, 0x06, 0x24, 0x19, 0xd0, 0x2c, 0x4b, 0xb2, 0x9c,
+  0x9f, 0x33, 0x2d, 0xdd, 0xed, 0xf2, 0xf1, 0xc0, 0x5e, 0xaa, 0x0c, 0x74, 0xda, 0x0c, 0xc3, 0x0b, 0x83, 0x8e, 0x3e, 0x35,
+  0x14, 0xe4, 0x07, 0x3d, 0x6d, 0x12, 0xa7, 0xe5, 0xa9, 0x2f, 0x0c, 0xf8, 0x9f, 0x19, 0xc8, 0x22, 0xa2, 0x18, 0xa1, 0xf2,
+  0x78, 0xef, 0xaf, 0xa9, 0x7f, 0xb7, 0x48, 0x1e, 0x6a, 0xf9, 0x21, 0xae, 0xfb, 0xb3, 0x24, 0x5e, 0x5d, 0x7e, 0x23, 0xa8,
+  0x35, 0xc3, 0x6a, 0x46, 0xe7, 0x60, 0x2d, 0x88, 0x2a, 0x29, 0x2a, 0x9d, 0x0e, 0x7c, 0x1f, 0x72, 0x45, 0x7e, 0xe4, 0x86,
+  0x52, 0x12, 0x18, 0x95, 0xc5, 0xd0, 0x45, 0x5b, 0xb4, 0x98, 0x18, 0xf0, 0x0b, 0x3f, 0x07, 0x70, 0xf5, 0xfe, 0x06, 0xee,
+  0xe8, 0x5e, 0xf8, 0x46, 0x46, 0x21, 0x6a, 0x80, 0x06, 0xc1, 0x66, 0x9c, 0x3b, 0xbc, 0xe9, 0x51, 0xcc, 0x3b, 0x64, 0xc4,
+  0x79, 0x28, 0x62, 0xb4, 0x3c, 0x06, 0x0a, 0xa4, 0x18, 0xc7, 0xe1, 0x43, 0xcd, 0xc3, 0x7e, 0x82, 0x95, 0x8e, 0xa2, 0x57,
+  0x94, 0xc7, 0xa4, 0xab, 0x73, 0xab, 0xa6, 0x80, 0xee, 0x96, 0xa7, 0x8d, 0xbf, 0x76, 0x79, 0x78, 0x22, 0x00, 0xc8, 0x3f,
+  0x9a, 0xe0, 0x6b, 0xab, 0x0d, 0x78, 0x91, 0xad, 0xbb, 0xa5, 0x66, 0x2e, 0x31, 0x22, 0xef, 0x8d, 0xf0, 0x40, 0x82, 0x79,
+  0x98, 0x86, 0x1f, 0x33, 0xcc, 0x23, 0x6e, 0x86, 0xd7, 0x78, 0x0e, 0x84, 0x8f, 0x3f, 0xbc, 0x9d, 0x0d, 0x04, 0x41, 0x63,
+  0x51, 0xe5, 0x5d, 0xb5, 0x06, 0xb4, 0x3b, 0x1d, 0xc0, 0x9a, 0xee, 0xd3, 0x75, 0x12, 0xa1, 0x75, 0x64, 0x2d, 0xcb, 0xb1,
+  0x98, 0x05, 0xf4, 0xde, 0x44, 0x62, 0x2b, 0x0a, 0x97, 0xd4, 0xdf, 0xfb, 0x88, 0x22, 0x58, 0xf3, 0x45, 0x61, 0xb7, 0xe2,
+  0x10, 0x1b, 0x90, 0x4d, 0x33, 0x20, 0x06, 0x0d, 0x59, 0x9f, 0x96, 0x7d, 0x97, 0x64, 0x77, 0xfc, 0xcf, 0x02, 0xf4, 0x06,
+  0x35, 0xfe, 0xb1, 0x78, 0x01, 0x0e, 0x48, 0x4f, 0x2b, 0xa0, 0x2f, 0x3c, 0xae, 0xc5, 0x79, 0xe0, 0xdb, 0xe3, 0xe1, 0x05,
+  0x35, 0xe9, 0xc8, 0x21, 0xe6, 0x68, 0xec, 0x2f, 0x4d, 0x32, 0x1c, 0xd9, 0xe6, 0xc8, 0xf1, 0x83, 0x61, 0xe0, 0xfb, 0xce,
+  0xe8, 0xc2, 0xfe, 0x73, 0x0a, 0xc8, 0x10, 0xe2, 0xd2, 0xcb, 0xd8, 0x87, 0x77, 0x32, 0x98, 0x9e, 0xd7, 0xa0, 0x5c, 0x79,
+  0x5c, 0xfc, 0xe1, 0xf8, 0x3c, 0x70, 0xc7, 0x34, 0x30, 0x9d, 0x60, 0xe2, 0x9a, 0xa3, 0xc0, 0x5f, 0x98, 0x8b, 0x80, 0xa2,
+  0x0e, 0xf6, 0x78, 0x61, 0x8f, 0x2f, 0x46, 0xfe, 0x64, 0x12, 0xfc, 0x39, 0xf1, 0xd1, 0xb5, 0xff, 0xa2, 0x7b, 0x19, 0x3b,
+  0xf8, 0x70, 0x42, 0xd8, 0x70, 0x72, 0x68, 0x5c, 0xf9, 0xd5, 0xa5, 0x7e, 0xcf, 0x33, 0x15, 0x31, 0x30, 0xa6, 0xbb, 0x32,
+  0x35, 0x31, 0x0d, 0x33, 0x2a, 0xa8, 0x64, 0xe2, 0xb1, 0x84, 0x27, 0x6e, 0xb3, 0x93, 0x68, 0x05, 0x03, 0x6d, 0xe3, 0x5b,
+  0x26, 0x2a, 0xd2, 0xb7, 0x49, 0xc9, 0x57, 0x32, 0xb2, 0x0e, 0xb5, 0x6e, 0x20, 0xcc, 0x1f, 0xcb, 0x57, 0x6d, 0x8a, 0xf7,
+  0xa6, 0xf5, 0x9c, 0xc4, 0xe8, 0x8b, 0x2f, 0xdf, 0x16, 0xa8, 0xe2, 0x95, 0x50, 0x58, 0xf8, 0xd5, 0xf2, 0xd7, 0x64, 0xb3,
+  0xa0, 0xd9, 0x07, 0xec, 0x96, 0x4b, 0x08, 0x34, 0x0e, 0xc9, 0x18, 0x9e, 0x56, 0x28, 0x7b, 0x8e, 0x4a, 0xe0, 0x8f, 0xd0,
+  0xff, 0x59, 0x2a, 0x2c, 0xf7, 0x2b, 0x04, 0xaa, 0xbc, 0x24, 0xc4, 0x07, 0x2e, 0xeb, 0x81, 0xf0, 0x3f, 0x08, 0x34, 0xc3,
+  0x32, 0xb4, 0x8f, 0x12, 0x12, 0x78, 0xa0, 0x1a, 0x06, 0xe0, 0xba, 0x62, 0xcd, 0x27, 0x86, 0x42, 0x3d, 0x2c, 0x43, 0x98,
+  0xe8, 0xd4, 0x00, 0xc2, 0x18, 0xc1, 0x42, 0x10, 0xf0, 0x6a, 0x26, 0xeb, 0x5a, 0x93, 0xf5, 0x89, 0x86, 0x56, 0x67, 0x03,
+  0xdd, 0xd6, 0xea, 0x8a, 0x4e, 0x11, 0xa8, 0x1b, 0x93, 0x0e, 0x86, 0x88, 0x1f, 0x85, 0xfe, 0x1d, 0xa6, 0x0b, 0xb9, 0xa7,
+  0xb2, 0xb6, 0xf7, 0xfa, 0x98, 0x6c, 0xf8, 0xd6, 0xfc, 0x1b, 0xb4, 0xe4, 0x70, 0x94, 0x65, 0x79, 0x39, 0xa2, 0x31, 0x45,
+  0x3c, 0x23, 0xd9, 0x95, 0x88, 0x2d, 0xce, 0xf5, 0x9a, 0xbf, 0xc2, 0xad, 0x0c, 0xce, 0x32, 0x25, 0x0e, 0xf8, 0x96, 0x1d,
+  0x90, 0xda, 0x40, 0xe3, 0x5c, 0xb6, 0x65, 0xaf, 0x89, 0x7f, 0xc7, 0xa3, 0xbe, 0xd9, 0x9e, 0x35, 0x4d, 0xa4, 0xf7, 0x30,
+  0xe2, 0xc2, 0x44, 0xc6, 0xbb, 0x7a, 0xbe, 0x3c, 0xac, 0xfe, 0xba, 0x59, 0x67, 0xb9, 0x9f, 0x85, 0x29, 0x93, 0xf3, 0x24,
+  0xdf, 0xc7, 0x3e, 0x2c, 0xb7, 0xb1, 0xb0, 0x2d, 0x70, 0x97, 0x16, 0xf6, 0xd2, 0x6e, 0x2c, 0x62, 0xf4, 0xa7, 0xba, 0x99,
+  0x99, 0x43, 0x90, 0xf8, 0xdb, 0x0d, 0x16, 0x4a, 0x0b, 0x03, 0xf0, 0x9b, 0x88, 0xf2, 0xc7, 0xd7, 0xfb, 0x9b, 0xa0, 0xd7,
+  0x95, 0x14, 0xdd, 0xf2, 0x0c, 0x2b, 0xdf, 0x2d, 0x0e, 0x51, 0xd7, 0xea, 0x32, 0x61, 0x0e, 0xdd, 0xb7, 0xb8, 0x05, 0x6f,
+  0x77, 0x7c, 0xdd, 0x0f, 0x96, 0x65, 0x75, 0xab, 0x7b, 0xc5, 0xbd, 0x76, 0x9e, 0x93, 0x9b, 0x63, 0x64, 0xa6, 0xf8, 0x40,
+  0x91, 0x01, 0xd9, 0x91, 0x90, 0xc1, 0x92, 0x32, 0x7f, 0xdd, 0xeb, 0x0e, 0x30, 0xc5, 0xb5, 0x1e, 0xb2, 0xab, 0x9d, 0x9f,
+  0xe5, 0x42, 0x1e, 0x91, 0xe5, 0xa2, 0x82, 0x8b, 0xf5, 0x4b, 0x9e, 0xc4, 0x3d, 0x8d, 0xf6, 0xa8, 0x4a, 0xaa, 0x9b, 0xe8,
+  0xf6, 0x2d, 0xd1, 0xca, 0xa0, 0x83, 0xe7, 0xf0, 0xf2, 0x25, 0x67, 0x6a, 0xa9, 0xa9, 0x13, 0x98, 0xc8, 0xb2, 0x89, 0x3c,
+  0xee, 0x49, 0xb4, 0xe5, 0x2a, 0x88, 0xf5, 0x72, 0x14, 0x7e, 0xfb, 0x0d, 0xba, 0xdd, 0x13, 0x98, 0x68, 0xa5, 0xab, 0xc9,
+  0x49, 0x9b, 0x3a, 0x99, 0x5d, 0x91, 0xfc, 0x4d, 0x5e, 0xc5, 0xf8, 0xc9, 0x8c, 0x34, 0x8c, 0x45, 0x5e, 0x75, 0x5f, 0x0b,
+  0x8e, 0x6b, 0x92, 0xcb, 0x5c, 0xd1, 0x90, 0xe4, 0x4b, 0xf8, 0xa4, 0xe5, 0x0b, 0x87, 0xe4, 0xbf, 0x7d, 0x2e, 0x8c, 0x82,
+  0x94, 0xef, 0x48, 0xce, 0x4d, 0x2d, 0x44, 0x78, 0xfc, 0xa4, 0xad, 0xf3, 0xa0, 0x7b, 0x08, 0xe3, 0x9a, 0x94, 0xed, 0x11,
+  0x57, 0x12, 0x3c, 0x62, 0xaf, 0x8e, 0x61, 0x03, 0x3d, 0xd1, 0x29, 0xf7, 0xb5, 0x28, 0x6b, 0x5f, 0xf8, 0x86, 0x20, 0xb0,
+  0x05, 0x3c, 0x21, 0x79, 0x5e, 0xe8, 0x7d, 0x6a, 0x3d, 0x78, 0xbb, 0xcd, 0xbb, 0x86, 0xb6, 0xd4, 0xd2, 0xa0, 0x48, 0x00,
+  0x08, 0xea, 0x89, 0x7b, 0x2c, 0x49, 0x94, 0xd3, 0x66, 0xaa, 0x29, 0x6c, 0xc5, 0xe9, 0x4a, 0x42, 0x15, 0x6e, 0xde, 0xef,
+  0x88, 0x55, 0xa3, 0x5c, 0x2c, 0x63, 0xcd, 0x3b, 0x35, 0x44, 0x2d, 0x86, 0x40, 0xda, 0xeb, 0x57, 0xeb, 0xb5, 0x08, 0xf3,
+  0x7e, 0x57, 0x88, 0x1e, 0x70, 0x2a, 0xe2, 0xcb, 0x3b, 0x3d, 0x34, 0x0f, 0x78, 0xc8, 0x20, 0xf1, 0x9e, 0x8b, 0xc9, 0xa3,
+  0xeb, 0x35, 0xfc, 0xf6, 0xa0, 0xf0, 0x45, 0xe1, 0xc1, 0xe9, 0x8b, 0xbf, 0x02, 0xf5, 0x4a, 0x8f, 0x7f, 0x09, 0x5d, 0x51,
+  0x2f, 0x38, 0x02, 0xaa, 0x38, 0xe6, 0xd8, 0xc7, 0x23, 0x1b, 0xab, 0xd3, 0x11, 0x5c, 0xfc, 0x3f, 0x00, 0xa3, 0xa1, 0xad,
+  0x04, 0x5e, 0xab, 0xd7, 0x09, 0xfa, 0xa0, 0xfb, 0xfe, 0xbb, 0xdb, 0x0f, 0x5d, 0x43, 0x9b, 0xe1, 0x17, 0x63, 0x34, 0xc3,
+  0xc6, 0xe4, 0x33, 0x0a, 0x2a, 0xc5, 0x37, 0x3f, 0x60, 0xdf, 0xd6, 0x45, 0x62, 0xfe, 0xff, 0xa9, 0x42, 0x5f, 0xc8, 0x35,
+  0xe0, 0x08, 0xda, 0x85, 0x47, 0x7d, 0x29, 0xbf, 0x4c, 0xf3, 0xe0, 0x9f, 0xb7, 0xdf, 0x7d, 0x6b, 0x61, 0x0b, 0x81, 0xaa,
+  0x84, 0xcb, 0x7d, 0x4f, 0x85, 0x72, 0xbf, 0xa4, 0x7b, 0xec, 0x97, 0xfa, 0x00, 0x84, 0x4b, 0xe8, 0xbd, 0x2c, 0x51, 0x39,
+  0xb9, 0xeb, 0xd7, 0xa4, 0x94, 0x1a, 0x6e, 0xb0, 0x29, 0x21, 0x2b, 0x7a, 0x08, 0xe2, 0xdc, 0xc2, 0x3a, 0x88, 0x1f, 0x31,
+  0xfd, 0x27, 0x51, 0xf5, 0x97, 0x22, 0x95, 0x3d, 0xc4, 0x19, 0xc5, 0xef, 0xf1, 0x93, 0xbe, 0x32, 0xa3, 0x6c, 0x9b, 0xc5,
+  0xd5, 0xc8, 0xe3, 0x8b, 0x53, 0x91, 0x4f, 0x03, 0xd0, 0xee, 0x73, 0x48, 0xa4, 0x47, 0x41, 0x03, 0xff, 0xc4, 0x14, 0x07,
+  0x33, 0x1e, 0x09, 0xb5, 0x16, 0x45, 0x00, 0x47, 0x0d, 0xe5, 0xa4, 0x1d, 0xf4, 0x52, 0xfd, 0x47, 0x01, 0x4e, 0x33, 0xcd,
+  0x11, 0x10, 0x2b, 0xe1, 0xab, 0xd6, 0xf4, 0x94, 0x8c, 0x35, 0x50, 0x63, 0xd9, 0x96, 0xf6, 0x6b, 0x7f, 0x22, 0x6b, 0x4a,
+  0x88, 0x6d, 0x9f, 0xea, 0x3c, 0xb0, 0x3d, 0x12, 0x37, 0xaf, 0x78, 0x9a, 0x15, 0xff, 0x53, 0xf1, 0x7f, 0x43, 0xa6, 0x89,
+  0xdb, 0xba, 0x28, 0x00, 0x00,
+};
+static const WebAsset WEB_ASSET_SYSTEMLINK = {"/systemlink", "text/html", WEB_ASSET_SYSTEMLINK_GZ, sizeof(WEB_ASSET_SYSTEMLINK_GZ), "\"90cdb22fbc1d3bb2\""};
+
+// 107491 bytes of pages in 26274 bytes of flash
+
+#endif // WEB_ASSET_DATA_HPP
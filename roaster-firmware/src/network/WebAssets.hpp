@@ -0,0 +1,49 @@
+#ifndef WEB_ASSETS_HPP
+#define WEB_ASSETS_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef ROASTER_HOST_BUILD
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+#endif
+
+// A page of the embedded web UI, gzipped at build time from web/ by
+// tools/embed-web-assets.py into WebAssetData.hpp. The bytes are served
+// from flash as they are with Content-Encoding: gzip, and `etag` (a hash of
+// the page, quotes included) lets a browser revalidate its cached copy and
+// get a 304 instead of the page.
+struct WebAsset {
+  const char *path;
+  const char *contentType;
+  const uint8_t *data;
+  size_t length;
+  const char *etag;
+};
+
+// True when an If-None-Match header names `etag`. The header is a comma
+// separated list of entity tags or "*"; If-None-Match compares weakly, so
+// a W/ prefix is ignored.
+inline bool webAssetETagMatches(const char *ifNoneMatch, const char *etag) {
+  if (ifNoneMatch == nullptr || etag == nullptr) return false;
+  size_t etagLength = strlen(etag);
+  const char *p = ifNoneMatch;
+  while (*p) {
+    while (*p == ' ' || *p == '\t' || *p == ',') p++;
+    if (*p == '\0') break;
+    const char *end = p;
+    while (*end && *end != ',') end++;
+    const char *last = end;
+    while (last > p && (last[-1] == ' ' || last[-1] == '\t')) last--;
+    if (last - p == 1 && *p == '*') return true;
+    if (last - p > 2 && p[0] == 'W' && p[1] == '/') p += 2;
+    if (static_cast<size_t>(last - p) == etagLength && memcmp(p, etag, etagLength) == 0) return true;
+    p = end;
+  }
+  return false;
+}
+
+#endif // WEB_ASSETS_HPP
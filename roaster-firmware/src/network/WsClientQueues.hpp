@@ -0,0 +1,215 @@
+#ifndef WS_CLIENT_QUEUES_HPP
+#define WS_CLIENT_QUEUES_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../support/SharedFrameBuffer.hpp"
+#include "../support/StaticMutex.hpp"
+
+// Bounded outgoing queues in front of each WebSocket client. AsyncWebSocket
+// queues every message a client is handed until it is sent, so a phone on
+// weak WiFi holds one frame per broadcast (and its TCP buffers) for as long
+// as it lags. Instead, broadcasts offer frames here and loop() moves them
+// to the client only while its AsyncWebSocket queue is shorter than
+// WS_MAX_IN_FLIGHT.
+//
+// Periodic frames keep one slot per kind: a newer state, telemetry or push
+// frame replaces the unsent one, which counts as a drop. Events such as
+// {"pushMessage":"startRoasting"} are queued in order and never dropped; a
+// client that lets WS_MAX_QUEUED_EVENTS pile up is reported so it can be
+// disconnected, and gets fresh state when it reconnects.
+
+static constexpr size_t WS_MAX_IN_FLIGHT = 4;
+static constexpr size_t WS_MAX_QUEUED_EVENTS = 8;
+
+// One pending slot each, sent in this order after any events
+enum WsFrameKind : uint8_t {
+  WS_FRAME_STATE,
+  WS_FRAME_TELEMETRY,
+  WS_FRAME_ARTISAN,
+  WS_FRAME_LOGS,
+  WS_FRAME_KIND_COUNT,
+};
+
+class WsClientQueues {
+ public:
+  // AsyncWebSocket's own default limit (DEFAULT_MAX_WS_CLIENTS)
+  static constexpr size_t MAX_CLIENTS = 8;
+
+  struct Message {
+    SharedFrameBuffer::Frame frame;
+    bool binary = false;
+  };
+
+  struct ClientStats {
+    uint32_t clientId;
+    uint8_t pending;       // Events plus filled slots waiting here
+    uint8_t maxPending;
+    uint32_t sent;
+    uint32_t dropped;      // Periodic frames replaced before they went out
+    uint32_t events;
+  };
+
+  // Registers a client as it connects, so broadcasts reach it through
+  // clientIds() without walking AsyncWebSocket's own list. False when no
+  // slot is left for it.
+  bool add(uint32_t clientId) {
+    Lock lock;
+    return findOrAdd(clientId) != nullptr;
+  }
+
+  // Copies the ids of the registered clients into `out` (MAX_CLIENTS entries)
+  size_t clientIds(uint32_t *out) {
+    Lock lock;
+    for (size_t i = 0; i < count; i++) out[i] = clients[i].stats.clientId;
+    return count;
+  }
+
+  // Replaces the unsent frame of `kind`, if any. Returns true when one was
+  // replaced, which for telemetry deltas means the client needs a keyframe.
+  // False also when no slot is left for a new client.
+  bool offerLatest(uint32_t clientId, WsFrameKind kind, const SharedFrameBuffer::Frame &frame, bool binary = false) {
+    Lock lock;
+    Client *client = findOrAdd(clientId);
+    if (client == nullptr) return false;
+    Message &slot = client->latest[kind];
+    bool replaced = static_cast<bool>(slot.frame);
+    if (replaced) client->stats.dropped++;
+    slot.frame = frame;
+    slot.binary = binary;
+    notePending(*client);
+    return replaced;
+  }
+
+  bool hasPending(uint32_t clientId, WsFrameKind kind) {
+    Lock lock;
+    Client *client = find(clientId);
+    return client != nullptr && static_cast<bool>(client->latest[kind].frame);
+  }
+
+  // False when the client already has WS_MAX_QUEUED_EVENTS waiting (or no
+  // slot is left for it); the event is not queued and the caller should
+  // disconnect the client rather than lose it silently.
+  bool offerEvent(uint32_t clientId, const SharedFrameBuffer::Frame &frame) {
+    Lock lock;
+    Client *client = findOrAdd(clientId);
+    if (client == nullptr || client->eventCount >= WS_MAX_QUEUED_EVENTS) return false;
+    size_t tail = (client->eventHead + client->eventCount) % WS_MAX_QUEUED_EVENTS;
+    client->events[tail].frame = frame;
+    client->events[tail].binary = false;
+    client->eventCount++;
+    client->stats.events++;
+    notePending(*client);
+    return true;
+  }
+
+  // The next message for the client, events first; false when nothing waits
+  bool pop(uint32_t clientId, Message &out) {
+    Lock lock;
+    Client *client = find(clientId);
+    if (client == nullptr) return false;
+    if (client->eventCount > 0) {
+      out = client->events[client->eventHead];
+      client->events[client->eventHead].frame.reset();
+      client->eventHead = (client->eventHead + 1) % WS_MAX_QUEUED_EVENTS;
+      client->eventCount--;
+      client->stats.sent++;
+      return true;
+    }
+    for (uint8_t kind = 0; kind < WS_FRAME_KIND_COUNT; kind++) {
+      if (client->latest[kind].frame) {
+        out = client->latest[kind];
+        client->latest[kind].frame.reset();
+        client->stats.sent++;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Frees everything queued for a client that disconnected
+  void remove(uint32_t clientId) {
+    Lock lock;
+    for (size_t i = 0; i < count; i++) {
+      if (clients[i].stats.clientId != clientId) continue;
+      clients[i] = Client();
+      if (i != --count) {
+        clients[i] = clients[count];
+        clients[count] = Client();
+      }
+      return;
+    }
+  }
+
+  // Drops every client `isConnected(clientId)` says is gone. A broadcast
+  // that checked a client just before its disconnect event can offer to it
+  // after remove() ran, which would hold the frames and the slot for good.
+  // AsyncWebSocket never reuses an id, so a stale one is safe to drop. The
+  // check runs outside the lock, as it takes AsyncWebSocket's own.
+  template <typename IsConnected>
+  size_t prune(IsConnected isConnected) {
+    uint32_t ids[MAX_CLIENTS];
+    size_t idCount = clientIds(ids);
+    size_t removed = 0;
+    for (size_t i = 0; i < idCount; i++) {
+      if (isConnected(ids[i])) continue;
+      remove(ids[i]);
+      removed++;
+    }
+    return removed;
+  }
+
+  // Copies per-client counters into `out` (MAX_CLIENTS entries)
+  size_t snapshot(ClientStats *out) {
+    Lock lock;
+    for (size_t i = 0; i < count; i++) {
+      out[i] = clients[i].stats;
+      out[i].pending = pendingCount(clients[i]);
+    }
+    return count;
+  }
+
+ private:
+  struct Client {
+    ClientStats stats = {};
+    Message latest[WS_FRAME_KIND_COUNT];
+    Message events[WS_MAX_QUEUED_EVENTS];
+    size_t eventHead = 0;
+    size_t eventCount = 0;
+  };
+
+  using Lock = StaticMutexLock<WsClientQueues>;
+
+  Client clients[MAX_CLIENTS];
+  size_t count = 0;
+
+  Client *find(uint32_t clientId) {
+    for (size_t i = 0; i < count; i++) {
+      if (clients[i].stats.clientId == clientId) return &clients[i];
+    }
+    return nullptr;
+  }
+
+  Client *findOrAdd(uint32_t clientId) {
+    Client *client = find(clientId);
+    if (client != nullptr || count >= MAX_CLIENTS) return client;
+    client = &clients[count++];
+    client->stats.clientId = clientId;
+    return client;
+  }
+
+  static uint8_t pendingCount(const Client &client) {
+    size_t pending = client.eventCount;
+    for (uint8_t kind = 0; kind < WS_FRAME_KIND_COUNT; kind++) {
+      if (client.latest[kind].frame) pending++;
+    }
+    return static_cast<uint8_t>(pending);
+  }
+
+  static void notePending(Client &client) {
+    uint8_t pending = pendingCount(client);
+    if (pending > client.stats.maxPending) client.stats.maxPending = pending;
+  }
+};
+
+#endif // WS_CLIENT_QUEUES_HPP
@@ -0,0 +1,232 @@
+#ifndef CONTROL_TASK_HPP
+#define CONTROL_TASK_HPP
+
+#include <Arduino.h>
+
+#ifndef ROASTER_HOST_BUILD
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <esp_task_wdt.h>
+#endif
+
+// Set to 0 to fall back to polling the control cycle from loop().
+#ifndef ROASTER_CONTROL_TASK_ENABLED
+#define ROASTER_CONTROL_TASK_ENABLED 1
+#endif
+
+// Release-time bookkeeping for a fixed-period task. Releases sit on a fixed
+// grid (start + n * period) so a late cycle does not push every later cycle
+// back. A cycle that starts more than a whole period late skips the missed
+// releases instead of bursting to catch up, which is what a control loop
+// wants: one fresh sample is worth more than several stale ones.
+//
+// All arithmetic is in wrapping 32-bit microseconds, matching micros() on the
+// ESP32.
+class PeriodicSchedule {
+public:
+    struct Stats {
+        uint32_t cycles;
+        uint32_t skippedReleases;
+        uint32_t overruns;
+        uint32_t lastLatenessUs;
+        uint32_t maxLatenessUs;
+        uint32_t lastExecutionUs;
+        uint32_t maxExecutionUs;
+    };
+
+    void start(uint32_t nowUs, uint32_t newPeriodUs) {
+        periodUs = newPeriodUs > 0 ? newPeriodUs : 1;
+        nextReleaseUs = nowUs;
+        stats = {};
+    }
+
+    bool isDue(uint32_t nowUs) const {
+        return static_cast<int32_t>(nowUs - nextReleaseUs) >= 0;
+    }
+
+    uint32_t microsUntilDue(uint32_t nowUs) const {
+        int32_t remaining = static_cast<int32_t>(nextReleaseUs - nowUs);
+        return remaining > 0 ? static_cast<uint32_t>(remaining) : 0;
+    }
+
+    // Marks the start of the cycle for the pending release and advances to the
+    // next one. Returns the release time the cycle belongs to.
+    uint32_t beginCycle(uint32_t nowUs) {
+        uint32_t releaseUs = nextReleaseUs;
+        uint32_t latenessUs = isDue(nowUs) ? nowUs - releaseUs : 0;
+        uint32_t missed = latenessUs / periodUs;
+
+        stats.cycles++;
+        stats.skippedReleases += missed;
+        stats.lastLatenessUs = latenessUs;
+        if (latenessUs > stats.maxLatenessUs) {
+            stats.maxLatenessUs = latenessUs;
+        }
+        nextReleaseUs = releaseUs + (missed + 1) * periodUs;
+        return releaseUs;
+    }
+
+    void endCycle(uint32_t startUs, uint32_t endUs) {
+        uint32_t executionUs = endUs - startUs;
+        stats.lastExecutionUs = executionUs;
+        if (executionUs > stats.maxExecutionUs) {
+            stats.maxExecutionUs = executionUs;
+        }
+        if (executionUs > periodUs) {
+            stats.overruns++;
+        }
+    }
+
+    uint32_t getPeriodUs() const { return periodUs; }
+    uint32_t getNextReleaseUs() const { return nextReleaseUs; }
+    Stats getStats() const { return stats; }
+
+private:
+    uint32_t periodUs = 1;
+    uint32_t nextReleaseUs = 0;
+    Stats stats = {};
+};
+
+// Serializes access to the control state (roasterState, heaterPID, outputs)
+// between the control task, loop(), and web handlers. Recursive so handlers
+// can call helpers that take it again. A no-op on the single-threaded host
+// build.
+class ControlLock {
+public:
+    ControlLock() { acquire(); }
+    ~ControlLock() { release(); }
+
+    ControlLock(const ControlLock &) = delete;
+    ControlLock &operator=(const ControlLock &) = delete;
+
+    static void acquire() {
+#ifndef ROASTER_HOST_BUILD
+        xSemaphoreTakeRecursive(handle(), portMAX_DELAY);
+#endif
+    }
+
+    static void release() {
+#ifndef ROASTER_HOST_BUILD
+        xSemaphoreGiveRecursive(handle());
+#endif
+    }
+
+private:
+#ifndef ROASTER_HOST_BUILD
+    static SemaphoreHandle_t handle() {
+        static SemaphoreHandle_t mutex = xSemaphoreCreateRecursiveMutex();
+        return mutex;
+    }
+#endif
+};
+
+// Fixed-period control task. On the ESP32 it runs as a FreeRTOS task pinned to
+// the application core (WiFi and the SystemLink worker live on core 0) at a
+// priority above loopTask, so LVGL rendering and WebSocket work in loop() can
+// no longer delay sensor reads, safety checks, or the PID step. Each cycle
+// holds ControlLock and feeds the task watchdog.
+//
+// When built without threading (host tests, or ROASTER_CONTROL_TASK_ENABLED=0)
+// the same schedule is driven by calling runIfDue() from a polling loop.
+class ControlTask {
+public:
+    typedef void (*CycleFunction)(unsigned long now);
+
+    struct Config {
+        const char *name = "control";
+        uint32_t periodMs = 125;
+        uint32_t stackBytes = 8192;
+        uint8_t priority = 5;   // loopTask runs at 1
+        int8_t core = 1;        // APP_CPU; WiFi is pinned to core 0
+        bool threaded = ROASTER_CONTROL_TASK_ENABLED != 0;
+    };
+
+    bool begin(const Config &newConfig, CycleFunction newCycle) {
+        if (running || newCycle == nullptr) {
+            return false;
+        }
+
+        config = newConfig;
+        cycle = newCycle;
+        schedule.start(static_cast<uint32_t>(micros()), config.periodMs * 1000UL);
+        running = true;
+
+#ifdef ROASTER_HOST_BUILD
+        config.threaded = false;
+#else
+        if (config.threaded) {
+            BaseType_t created = xTaskCreatePinnedToCore(taskEntry,
+                                                         config.name,
+                                                         config.stackBytes,
+                                                         this,
+                                                         config.priority,
+                                                         &taskHandle,
+                                                         config.core);
+            if (created != pdPASS) {
+                config.threaded = false;
+                taskHandle = nullptr;
+                return false;
+            }
+        }
+#endif
+        return true;
+    }
+
+    // Runs one cycle when the next release is due. Returns true if it ran.
+    bool runIfDue() {
+        if (!running || !schedule.isDue(static_cast<uint32_t>(micros()))) {
+            return false;
+        }
+        runCycle();
+        return true;
+    }
+
+    bool isRunning() const { return running; }
+    bool isThreaded() const { return running && config.threaded; }
+    uint32_t getPeriodMs() const { return config.periodMs; }
+    // Release time (micros) of the cycle running now, or of the last one
+    uint32_t getCurrentReleaseUs() const { return currentReleaseUs; }
+    PeriodicSchedule::Stats getStats() const { return schedule.getStats(); }
+
+private:
+    Config config;
+    CycleFunction cycle = nullptr;
+    PeriodicSchedule schedule;
+    bool running = false;
+    uint32_t currentReleaseUs = 0;
+
+    void runCycle() {
+        uint32_t startUs = static_cast<uint32_t>(micros());
+        currentReleaseUs = schedule.beginCycle(startUs);
+        {
+            ControlLock lock;
+            cycle(millis());
+        }
+        schedule.endCycle(startUs, static_cast<uint32_t>(micros()));
+    }
+
+#ifndef ROASTER_HOST_BUILD
+    TaskHandle_t taskHandle = nullptr;
+
+    static void taskEntry(void *parameter) {
+        ControlTask *self = static_cast<ControlTask *>(parameter);
+        esp_task_wdt_add(nullptr);
+
+        while (true) {
+            uint32_t waitUs = self->schedule.microsUntilDue(static_cast<uint32_t>(micros()));
+            if (waitUs > 0) {
+                // vTaskDelay can wake up to one tick early; the loop re-checks.
+                TickType_t ticks = pdMS_TO_TICKS((waitUs + 999UL) / 1000UL);
+                vTaskDelay(ticks > 0 ? ticks : 1);
+                continue;
+            }
+
+            self->runCycle();
+            esp_task_wdt_reset();
+        }
+    }
+#endif
+};
+
+#endif // CONTROL_TASK_HPP
@@ -0,0 +1,435 @@
+#ifndef PREFERENCES_JOURNAL_HPP
+#define PREFERENCES_JOURNAL_HPP
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <string.h>
+#include <vector>
+#include "../support/StaticMutex.hpp"
+
+// Write-behind cache in front of the settings namespace. Each put through
+// Preferences is its own NVS commit and blocks the caller on flash, so puts
+// here only update a RAM shadow. loop() writes the changed keys in one batch
+// once the oldest one has waited flushDelayMs (flushIfDue()). A put that
+// replaces a value still waiting, or that matches what flash already holds,
+// costs no flash write at all.
+//
+// Reads see pending values first. Values read or flushed once stay cached,
+// which is how an unchanged write is recognised. Callers that cannot afford
+// to lose a write to a reset (boot-loop counter, calibration results) call
+// flush() straight after it.
+//
+// Keys are typed like NVS: read a key back with the getter matching the put
+// that wrote it. A getter of another type goes to Preferences.
+class PreferencesJournal {
+public:
+    static constexpr uint32_t DEFAULT_FLUSH_DELAY_MS = 2000;
+    // NVS key limit; longer keys go straight to Preferences (which rejects them)
+    static constexpr size_t MAX_KEY_LENGTH = 15;
+    // Past this many distinct keys, new keys are written through uncached
+    static constexpr size_t MAX_ENTRIES = 64;
+
+    struct Stats {
+        uint32_t writes;            // put and remove calls
+        uint32_t coalesced;         // replaced a value that was still pending
+        uint32_t unchanged;         // matched the value flash already holds
+        uint32_t flashWrites;       // puts and removes that reached Preferences
+        uint32_t failedFlashWrites;
+        uint32_t flushes;           // batches written
+        uint32_t forcedFlushes;     // flush() calls from callers
+    };
+
+    explicit PreferencesJournal(Preferences &prefs, uint32_t flushDelayMs = DEFAULT_FLUSH_DELAY_MS)
+        : prefs(prefs), flushDelayMs(flushDelayMs) {}
+
+    size_t putBool(const char *key, bool value) {
+        uint8_t raw = value ? 1 : 0;
+        return stage(key, TYPE_BOOL, &raw, sizeof(raw)) ? 1 : 0;
+    }
+
+    size_t putInt(const char *key, int32_t value) {
+        return stage(key, TYPE_INT, &value, sizeof(value)) ? sizeof(value) : 0;
+    }
+
+    size_t putUInt(const char *key, uint32_t value) {
+        return stage(key, TYPE_UINT, &value, sizeof(value)) ? sizeof(value) : 0;
+    }
+
+    size_t putDouble(const char *key, double value) {
+        return stage(key, TYPE_DOUBLE, &value, sizeof(value)) ? sizeof(value) : 0;
+    }
+
+    size_t putString(const char *key, const String &value) {
+        // Stored with its NUL so the shadow reads back as a C string
+        return stage(key, TYPE_STRING, value.c_str(), value.length() + 1) ? value.length() : 0;
+    }
+
+    size_t putString(const char *key, const char *value) {
+        return putString(key, String(value ? value : ""));
+    }
+
+    size_t putBytes(const char *key, const void *value, size_t length) {
+        return stage(key, TYPE_BYTES, value, length) ? length : 0;
+    }
+
+    bool remove(const char *key) {
+        return stage(key, TYPE_REMOVED, nullptr, 0);
+    }
+
+    bool getBool(const char *key, bool defaultValue = false) {
+        uint8_t fallback = defaultValue ? 1 : 0;
+        return getNumber(key, TYPE_BOOL, fallback,
+                         [this](const char *k, uint8_t d) { return (uint8_t)(prefs.getBool(k, d != 0) ? 1 : 0); }) != 0;
+    }
+
+    int32_t getInt(const char *key, int32_t defaultValue = 0) {
+        return getNumber(key, TYPE_INT, defaultValue, [this](const char *k, int32_t d) { return prefs.getInt(k, d); });
+    }
+
+    uint32_t getUInt(const char *key, uint32_t defaultValue = 0) {
+        return getNumber(key, TYPE_UINT, defaultValue, [this](const char *k, uint32_t d) { return prefs.getUInt(k, d); });
+    }
+
+    double getDouble(const char *key, double defaultValue = NAN) {
+        return getNumber(key, TYPE_DOUBLE, defaultValue, [this](const char *k, double d) { return prefs.getDouble(k, d); });
+    }
+
+    String getString(const char *key, const String &defaultValue = String()) {
+        {
+            Lock lock;
+            int index = find(key);
+            if (index >= 0 && entries[index].type == TYPE_REMOVED) {
+                return defaultValue;
+            }
+            if (index >= 0 && entries[index].type == TYPE_STRING) {
+                return String(reinterpret_cast<const char *>(entries[index].value.data()));
+            }
+        }
+        if (!prefs.isKey(key)) {
+            return defaultValue;
+        }
+        String value = prefs.getString(key, defaultValue);
+        remember(key, TYPE_STRING, value.c_str(), value.length() + 1);
+        return value;
+    }
+
+    size_t getBytesLength(const char *key) {
+        {
+            Lock lock;
+            int index = find(key);
+            if (index >= 0 && entries[index].type == TYPE_REMOVED) {
+                return 0;
+            }
+            if (index >= 0 && entries[index].type == TYPE_BYTES) {
+                return entries[index].value.size();
+            }
+        }
+        return prefs.getBytesLength(key);
+    }
+
+    size_t getBytes(const char *key, void *buffer, size_t maxLength) {
+        {
+            Lock lock;
+            int index = find(key);
+            if (index >= 0 && entries[index].type == TYPE_REMOVED) {
+                return 0;
+            }
+            if (index >= 0 && entries[index].type == TYPE_BYTES) {
+                const std::vector<uint8_t> &value = entries[index].value;
+                if (value.size() > maxLength) {
+                    return 0;
+                }
+                memcpy(buffer, value.data(), value.size());
+                return value.size();
+            }
+        }
+        size_t length = prefs.getBytes(key, buffer, maxLength);
+        if (length > 0) {
+            remember(key, TYPE_BYTES, buffer, length);
+        }
+        return length;
+    }
+
+    bool isKey(const char *key) {
+        {
+            Lock lock;
+            int index = find(key);
+            if (index >= 0 && (entries[index].dirty || entries[index].type == TYPE_REMOVED)) {
+                return entries[index].type != TYPE_REMOVED;
+            }
+        }
+        return prefs.isKey(key);
+    }
+
+    // Writes everything pending now. False if any write failed; those keys
+    // stay pending for the next flush.
+    bool flush() {
+        {
+            Lock lock;
+            stats.forcedFlushes++;
+        }
+        return writePending();
+    }
+
+    // Called from loop(): flushes once the oldest pending write is due.
+    bool flushIfDue() {
+        {
+            Lock lock;
+            if (pending == 0 || millis() - firstPendingMs < flushDelayMs) {
+                return true;
+            }
+        }
+        return writePending();
+    }
+
+    size_t pendingCount() {
+        Lock lock;
+        return pending;
+    }
+
+    Stats getStats() {
+        Lock lock;
+        return stats;
+    }
+
+    // Flash writes a put-per-commit caller would have made and this did not
+    uint32_t writesAvoided() {
+        Lock lock;
+        return stats.coalesced + stats.unchanged;
+    }
+
+    void resetStats() {
+        Lock lock;
+        stats = {};
+    }
+
+private:
+    enum Type : uint8_t {
+        TYPE_BOOL,
+        TYPE_INT,
+        TYPE_UINT,
+        TYPE_DOUBLE,
+        TYPE_STRING,
+        TYPE_BYTES,
+        TYPE_REMOVED,
+    };
+
+    struct Entry {
+        char key[MAX_KEY_LENGTH + 1];
+        Type type;
+        bool dirty;
+        uint32_t version; // Bumped per put, so a flush only settles what it wrote
+        std::vector<uint8_t> value;
+    };
+
+    // Puts arrive from loop(), the web server and the SystemLink worker
+    using Lock = StaticMutexLock<PreferencesJournal>;
+
+    Preferences &prefs;
+    uint32_t flushDelayMs;
+    std::vector<Entry> entries;
+    size_t pending = 0;
+    uint32_t firstPendingMs = 0;
+    Stats stats = {};
+
+    int find(const char *key) const {
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (strcmp(entries[i].key, key) == 0) return (int)i;
+        }
+        return -1;
+    }
+
+    static bool sameValue(const Entry &entry, Type type, const void *data, size_t length) {
+        return entry.type == type && entry.value.size() == length &&
+               (length == 0 || memcmp(entry.value.data(), data, length) == 0);
+    }
+
+    // Adds a new entry under the lock; -1 when the key cannot be cached
+    int addEntry(const char *key) {
+        if (strlen(key) > MAX_KEY_LENGTH || entries.size() >= MAX_ENTRIES) {
+            return -1;
+        }
+        entries.push_back(Entry{});
+        strcpy(entries.back().key, key);
+        return (int)entries.size() - 1;
+    }
+
+    bool stage(const char *key, Type type, const void *data, size_t length) {
+        if (key == nullptr) {
+            return false;
+        }
+        {
+            Lock lock;
+            stats.writes++;
+            int index = find(key);
+            if (index >= 0) {
+                Entry &entry = entries[index];
+                if (sameValue(entry, type, data, length)) {
+                    // Pending already, or what flash holds
+                    if (entry.dirty) {
+                        stats.coalesced++;
+                    } else {
+                        stats.unchanged++;
+                    }
+                    return true;
+                }
+                if (entry.dirty) {
+                    stats.coalesced++;
+                }
+            } else {
+                index = addEntry(key);
+            }
+
+            if (index >= 0) {
+                Entry &entry = entries[index];
+                entry.type = type;
+                const uint8_t *bytes = static_cast<const uint8_t *>(data);
+                entry.value.assign(bytes, bytes + length);
+                entry.version++;
+                if (!entry.dirty) {
+                    entry.dirty = true;
+                    if (pending++ == 0) {
+                        firstPendingMs = millis();
+                    }
+                }
+                return true;
+            }
+        }
+        // Not cacheable: straight through, as Preferences would
+        return writeThrough(key, type, data, length);
+    }
+
+    // Caches a value just read from Preferences, unless a put got there first
+    void remember(const char *key, Type type, const void *data, size_t length) {
+        Lock lock;
+        int index = find(key);
+        if (index >= 0 && entries[index].dirty) {
+            return;
+        }
+        if (index < 0) {
+            index = addEntry(key);
+            if (index < 0) return;
+        }
+        Entry &entry = entries[index];
+        entry.type = type;
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        entry.value.assign(bytes, bytes + length);
+    }
+
+    // Copies a cached value of this type; `removed` when the key is known gone
+    bool readCached(const char *key, Type type, void *out, size_t length, bool &removed) {
+        Lock lock;
+        int index = find(key);
+        removed = index >= 0 && entries[index].type == TYPE_REMOVED;
+        if (index < 0 || entries[index].type != type || entries[index].value.size() != length) {
+            return false;
+        }
+        memcpy(out, entries[index].value.data(), length);
+        return true;
+    }
+
+    template <typename T, typename Reader>
+    T getNumber(const char *key, Type type, T defaultValue, Reader read) {
+        T value;
+        bool removed = false;
+        if (readCached(key, type, static_cast<void *>(&value), sizeof(value), removed)) {
+            return value;
+        }
+        if (removed || !prefs.isKey(key)) {
+            return defaultValue;
+        }
+        value = read(key, defaultValue);
+        remember(key, type, &value, sizeof(value));
+        return value;
+    }
+
+    bool writeThrough(const char *key, Type type, const void *data, size_t length) {
+        bool ok = false;
+        switch (type) {
+            case TYPE_BOOL:
+                ok = prefs.putBool(key, *static_cast<const uint8_t *>(data) != 0) > 0;
+                break;
+            case TYPE_INT: {
+                int32_t value;
+                memcpy(&value, data, sizeof(value));
+                ok = prefs.putInt(key, value) > 0;
+                break;
+            }
+            case TYPE_UINT: {
+                uint32_t value;
+                memcpy(&value, data, sizeof(value));
+                ok = prefs.putUInt(key, value) > 0;
+                break;
+            }
+            case TYPE_DOUBLE: {
+                double value;
+                memcpy(&value, data, sizeof(value));
+                ok = prefs.putDouble(key, value) > 0;
+                break;
+            }
+            case TYPE_STRING:
+                // putString returns the length, so 0 for "" even on success
+                ok = prefs.putString(key, static_cast<const char *>(data)) > 0 || length <= 1;
+                break;
+            case TYPE_BYTES:
+                ok = prefs.putBytes(key, data, length) == length;
+                break;
+            case TYPE_REMOVED:
+                if (!prefs.isKey(key)) {
+                    // Already gone: nothing to commit
+                    Lock lock;
+                    stats.unchanged++;
+                    return true;
+                }
+                ok = prefs.remove(key);
+                break;
+        }
+        Lock lock;
+        stats.flashWrites++;
+        if (!ok) stats.failedFlashWrites++;
+        return ok;
+    }
+
+    bool writePending() {
+        struct Pending {
+            size_t index;
+            uint32_t version;
+            Entry entry;
+        };
+        std::vector<Pending> batch;
+        {
+            Lock lock;
+            for (size_t i = 0; i < entries.size(); i++) {
+                if (entries[i].dirty) {
+                    batch.push_back(Pending{i, entries[i].version, entries[i]});
+                }
+            }
+            if (batch.empty()) {
+                return true;
+            }
+            stats.flushes++;
+        }
+
+        // Flash writes happen outside the lock so puts from other tasks
+        // never wait on a commit.
+        bool ok = true;
+        for (const Pending &item : batch) {
+            const Entry &entry = item.entry;
+            bool written = writeThrough(entry.key, entry.type, entry.value.data(), entry.value.size());
+            ok = ok && written;
+            Lock lock;
+            Entry &current = entries[item.index];
+            if (written && current.dirty && current.version == item.version) {
+                current.dirty = false;
+                pending--;
+            }
+        }
+        if (!ok) {
+            Lock lock;
+            firstPendingMs = millis(); // Retry after another delay, not every pass
+        }
+        return ok;
+    }
+};
+
+#endif // PREFERENCES_JOURNAL_HPP
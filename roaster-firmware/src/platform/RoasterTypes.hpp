@@ -18,6 +18,14 @@ enum RoasterState
   CALIBRATING = 5
 };
 
+// Heater control strategy while roasting
+enum HeaterControlMode
+{
+  HEATER_MODE_PID = 0,  // Band-scheduled PID trim plus model feedforward
+  HEATER_MODE_MPC = 1,  // Model-predictive control on the calibrated band models
+  HEATER_MODE_SMITH = 2 // Band PID around a Smith predictor that removes the dead time
+};
+
 // ============================================================================
 // SAFETY LIMITS
 // ============================================================================
@@ -34,6 +42,11 @@ enum RoasterState
 #define MAX_TEMP_JUMP 40.0        // Max allowed change in temp between readings (F)
 #define SENSOR_FAULT_TEMP 600.0   // Thermocouple reads ~2048°F when disconnected
 
+// Bean rate-of-rise (RoR) least-squares window
+#define ROR_WINDOW_DEFAULT_SECONDS 30
+#define ROR_WINDOW_MIN_SECONDS 5
+#define ROR_WINDOW_MAX_SECONDS 60  // 240 samples at 4 Hz
+
 // Timing limits
 #define MAX_COOLING_TIME 300000  // 5 minutes in milliseconds
 
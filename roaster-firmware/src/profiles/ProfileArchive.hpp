@@ -0,0 +1,279 @@
+#ifndef PROFILE_ARCHIVE_HPP
+#define PROFILE_ARCHIVE_HPP
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <time.h>
+#include <vector>
+#include "ProfileManager.hpp"
+#include "../support/DebugLog.hpp"
+#include "../support/TarStream.hpp"
+
+// Bulk profile transfer as a tar of JSON files, one per profile, in the
+// same shape as roast-profiles/*.json and GET /api/profile/:id. Both
+// directions hold a single profile in RAM at a time, so the size of the
+// library only costs flash.
+
+// Streams every saved profile as <name>-<id>.json. read() fills the buffer
+// an AsyncWebServer chunked response hands it and returns 0 at the end.
+class ProfileArchiveExporter {
+public:
+    explicit ProfileArchiveExporter(ProfileManager& manager)
+        : manager(manager), ids(manager.getProfileIds()), mtime(static_cast<uint32_t>(time(nullptr))) {}
+
+    size_t read(uint8_t* out, size_t maxLen) {
+        size_t written = 0;
+        while (written < maxLen && segment != SEGMENT_DONE) {
+            size_t available = segmentLength() - offset;
+            if (available == 0) {
+                nextSegment();
+                continue;
+            }
+            size_t step = min(available, maxLen - written);
+            if (segment == SEGMENT_HEADER) {
+                memcpy(out + written, header + offset, step);
+            } else if (segment == SEGMENT_BODY) {
+                memcpy(out + written, body.c_str() + offset, step);
+            } else {
+                memset(out + written, 0, step);
+            }
+            offset += step;
+            written += step;
+        }
+        return written;
+    }
+
+    size_t exportedCount() const { return exported; }
+
+    // Lowercase letters and digits with single dashes between words, then
+    // the id so two profiles with the same name stay apart.
+    static String fileNameFor(const String& name, const String& id) {
+        String slug;
+        for (size_t i = 0; i < name.length() && slug.length() < MAX_SLUG_LENGTH; i++) {
+            char c = name[i];
+            if (isalnum(static_cast<unsigned char>(c))) {
+                slug += static_cast<char>(tolower(static_cast<unsigned char>(c)));
+            } else if (slug.length() > 0 && !slug.endsWith("-")) {
+                slug += "-";
+            }
+        }
+        while (slug.endsWith("-")) {
+            slug.remove(slug.length() - 1);
+        }
+        if (slug.length() == 0) {
+            slug = "profile";
+        }
+        return slug + "-" + id + ".json";
+    }
+
+private:
+    static constexpr size_t MAX_SLUG_LENGTH = 48;
+
+    enum Segment : uint8_t {
+        SEGMENT_START,
+        SEGMENT_HEADER,
+        SEGMENT_BODY,
+        SEGMENT_PADDING,
+        SEGMENT_TRAILER,
+        SEGMENT_DONE,
+    };
+
+    ProfileManager& manager;
+    std::vector<String> ids;
+    size_t next = 0;
+    size_t exported = 0;
+    uint32_t mtime;
+    Segment segment = SEGMENT_START;
+    size_t offset = 0;
+    uint8_t header[TAR_BLOCK_SIZE];
+    String body;
+
+    size_t segmentLength() const {
+        switch (segment) {
+            case SEGMENT_HEADER: return TAR_BLOCK_SIZE;
+            case SEGMENT_BODY: return body.length();
+            case SEGMENT_PADDING: return tarPadding(body.length());
+            case SEGMENT_TRAILER: return 2 * TAR_BLOCK_SIZE;
+            default: return 0;
+        }
+    }
+
+    void nextSegment() {
+        offset = 0;
+        switch (segment) {
+            case SEGMENT_START:
+            case SEGMENT_PADDING:
+                segment = loadNext() ? SEGMENT_HEADER : SEGMENT_TRAILER;
+                break;
+            case SEGMENT_HEADER:
+                segment = SEGMENT_BODY;
+                break;
+            case SEGMENT_BODY:
+                segment = SEGMENT_PADDING;
+                break;
+            default:
+                segment = SEGMENT_DONE;
+                break;
+        }
+    }
+
+    // Renders the next profile that still exists into `body` and `header`
+    bool loadNext() {
+        while (next < ids.size()) {
+            const String& id = ids[next++];
+            String name;
+            int finalTarget = 0;
+            bool active = false;
+            if (!manager.getProfileSummary(id, name, finalTarget, active)) {
+                continue; // Deleted since the export started
+            }
+            body = manager.getProfile(id);
+            if (body.startsWith("{\"error\"")) {
+                LOG_WARNF("Export skipped unreadable profile %s", id.c_str());
+                continue;
+            }
+            if (!tarWriteHeader(header, fileNameFor(name, id).c_str(), body.length(), mtime)) {
+                continue;
+            }
+            exported++;
+            return true;
+        }
+        body = String();
+        return false;
+    }
+};
+
+// Reads an uploaded tar as it arrives and saves each .json member as a
+// profile. A file whose "id" is a saved profile replaces that profile;
+// otherwise one with the same "name" is replaced, and anything else is
+// added. Other members (directories, pax records, ._ resource forks from
+// macOS tar) are skipped.
+class ProfileArchiveImporter {
+public:
+    static constexpr size_t MAX_REPORTED_ERRORS = 8;
+
+    explicit ProfileArchiveImporter(ProfileManager& manager) : manager(manager) {}
+
+    bool feed(const uint8_t* data, size_t length) {
+        return reader.feed(data, length, *this);
+    }
+
+    bool succeeded() const { return reader.complete() && !reader.failed(); }
+
+    // {"ok", "imported", "updated", "failed", "skipped", "errors": [{"file", "error"}]}
+    String resultJson() const {
+        DynamicJsonDocument doc(384 + errors.size() * (TarReader::MAX_NAME_LENGTH + 64));
+        doc["ok"] = succeeded();
+        if (reader.failed()) {
+            doc["error"] = "invalid_archive";
+        } else if (!reader.complete()) {
+            doc["error"] = "truncated_archive";
+        }
+        doc["imported"] = imported;
+        doc["updated"] = updated;
+        doc["failed"] = failed;
+        doc["skipped"] = skipped;
+        JsonArray list = doc.createNestedArray("errors");
+        for (const auto& entry : errors) {
+            JsonObject obj = list.createNestedObject();
+            obj["file"] = entry.file;
+            obj["error"] = entry.error;
+        }
+        String out;
+        serializeJson(doc, out);
+        return out;
+    }
+
+    int importedCount() const { return imported; }
+    int updatedCount() const { return updated; }
+    int failedCount() const { return failed; }
+
+    // TarReader sink
+    bool beginFile(const char* name, uint32_t size) {
+        String path(name);
+        int slash = path.lastIndexOf('/');
+        String base = slash >= 0 ? path.substring(slash + 1) : path;
+        if (!base.endsWith(".json") || base.startsWith(".")) {
+            skipped++;
+            return false;
+        }
+        if (size > ProfileManager::MAX_PROFILE_JSON_BYTES) {
+            recordFailure(path, "payload_too_large");
+            return false;
+        }
+        current = String();
+        if (!current.reserve(size + 1)) {
+            recordFailure(path, "out_of_memory");
+            return false;
+        }
+        currentName = path;
+        return true;
+    }
+
+    void fileData(const uint8_t* data, size_t length) {
+        current.concat(reinterpret_cast<const char*>(data), length);
+    }
+
+    void endFile() {
+        esp_task_wdt_reset();
+        saveCurrent();
+        current = String();
+    }
+
+private:
+    struct ImportError {
+        String file;
+        String error;
+    };
+
+    ProfileManager& manager;
+    TarReader reader;
+    String current;
+    String currentName;
+    int imported = 0;
+    int updated = 0;
+    int failed = 0;
+    int skipped = 0;
+    std::vector<ImportError> errors;
+
+    void recordFailure(const String& file, const char* error) {
+        failed++;
+        LOG_WARNF("Import of %s failed: %s", file.c_str(), error);
+        if (errors.size() < MAX_REPORTED_ERRORS) {
+            errors.push_back(ImportError{file, error});
+        }
+    }
+
+    void saveCurrent() {
+        String target;
+        {
+            // Only the two keys that pick the profile to replace
+            StaticJsonDocument<32> filter;
+            filter["id"] = true;
+            filter["name"] = true;
+            StaticJsonDocument<256> keys;
+            if (deserializeJson(keys, current, DeserializationOption::Filter(filter))) {
+                recordFailure(currentName, "invalid_json");
+                return;
+            }
+            String id = keys["id"] | "";
+            String name = keys["name"] | "Unnamed";
+            if (id.length() > 0 && id.length() <= ProfileIdIndex::MAX_ID_LENGTH && manager.profileExists(id)) {
+                target = id;
+            } else {
+                target = manager.findProfileIdByName(name);
+            }
+        }
+
+        ProfileOperationResult result = manager.saveProfile(current, target);
+        if (!result.success) {
+            recordFailure(currentName, result.error.c_str());
+        } else if (target.length() > 0) {
+            updated++;
+        } else {
+            imported++;
+        }
+    }
+};
+
+#endif // PROFILE_ARCHIVE_HPP
@@ -5,6 +5,7 @@
 #include <ArduinoJson.h>
 #include "../display/DisplayAdapter.hpp"
 #include "../platform/RoasterTypes.hpp"
+#include "../platform/ControlTask.hpp"
 #include "RoastProfile.hpp"
 #include "../support/DebugLog.hpp"
 #include <vector>
@@ -14,8 +15,8 @@
 
 extern RoastProfile profile;  // Profile configuration from main firmware
 extern Preferences preferences;  // NVS preferences from main firmware
-extern uint8_t profileBuffer[200];
 extern int finalTempOverride;  // Final temperature override from the active UI
+extern RoasterState roasterState;  // Swapping mid-roast keeps the roast clock
 
 // Forward declarations for helper functions
 std::vector<String> splitNames(const String& csv);
@@ -53,6 +54,27 @@ String generateProfileId() {
 String profileDataKey(const String& id) { return String("pf_") + id; }
 String profileMetaKey(const String& id) { return String("pm_") + id; }
 
+// Encodes `source` (v2, variable length) into `blob`.
+bool encodeProfileData(const RoastProfile& source, std::vector<uint8_t>& blob) {
+  blob.resize(source.getFlattenedSize());
+  return source.flattenProfile(blob.data(), blob.size()) == blob.size();
+}
+
+size_t writeProfileData(const String& id, const RoastProfile& source) {
+  std::vector<uint8_t> blob;
+  if (!encodeProfileData(source, blob)) return 0;
+  return preferences.putBytes(profileDataKey(id).c_str(), blob.data(), blob.size());
+}
+
+// Reads a stored profile of either format version; 0 if missing or corrupt.
+size_t readProfileData(const String& id, RoastProfile& out) {
+  size_t len = preferences.getBytesLength(profileDataKey(id).c_str());
+  if (len == 0) return 0;
+  std::vector<uint8_t> blob(len);
+  if (preferences.getBytes(profileDataKey(id).c_str(), blob.data(), blob.size()) != len) return 0;
+  return out.unflattenProfile(blob.data(), blob.size()) ? len : 0;
+}
+
 std::vector<String> getProfileIds() {
   String csv = preferences.getString(PROFILE_IDS_CSV, "");
   return splitNames(csv);
@@ -134,12 +156,15 @@ String getActiveProfileData() {
   DynamicJsonDocument doc(1024);
   JsonArray arr = doc["setpoints"].to<JsonArray>();
   
-  for (int i = 0; i < profile.getSetpointCount(); i++) {
-    auto sp = profile.getSetpoint(i);
-    JsonObject spObj = arr.add<JsonObject>();
-    spObj["time"] = sp.time / 1000;  // Convert milliseconds to seconds
-    spObj["temp"] = sp.temp;
-    spObj["fanSpeed"] = sp.fanSpeed;
+  {
+    ControlLock controlLock;  // A web handler can swap the profile meanwhile
+    for (int i = 0; i < profile.getSetpointCount(); i++) {
+      auto sp = profile.getSetpoint(i);
+      JsonObject spObj = arr.add<JsonObject>();
+      spObj["time"] = sp.time / 1000;  // Convert milliseconds to seconds
+      spObj["temp"] = sp.temp;
+      spObj["fanSpeed"] = sp.fanSpeed;
+    }
   }
   
   doc["activeName"] = preferences.getString("profile_active", "");
@@ -236,10 +261,10 @@ void ensureDefaultProfile() {
     uint32_t timeMs = spObj["time"].as<uint32_t>() * 1000UL;
     uint32_t temp = spObj["temp"].as<uint32_t>();
     uint32_t fan  = spObj["fanSpeed"].as<uint32_t>();
-    tempProfile.addSetpoint(timeMs, temp, fan);
+    tempProfile.appendSetpoint(timeMs, temp, fan);
   }
-  tempProfile.flattenProfile(profileBuffer);
-  preferences.putBytes(profileDataKey(defaultId).c_str(), profileBuffer, sizeof(profileBuffer));
+  tempProfile.finishSetpoints();
+  writeProfileData(defaultId, tempProfile);
   saveProfileMeta(defaultId, "Default");
   ids.push_back(defaultId);
   setProfileIds(ids);
@@ -267,15 +292,15 @@ bool reloadActiveProfile() {
     }
   }
 
-  uint8_t buf[200];
-  size_t readLen = preferences.getBytes(profileDataKey(activeId).c_str(), buf, sizeof(buf));
+  RoastProfile loaded;
+  size_t readLen = readProfileData(activeId, loaded);
   LOG_DEBUGF("reloadActiveProfile: Read %d bytes from key '%s'", readLen, profileDataKey(activeId).c_str());
   if (readLen == 0) {
     auto ids = getProfileIds();
     if (!ids.empty()) {
       activeId = ids.front();
       setActiveProfileId(activeId);
-      readLen = preferences.getBytes(profileDataKey(activeId).c_str(), buf, sizeof(buf));
+      readLen = readProfileData(activeId, loaded);
       LOG_WARNF("Active profile not found, fell back to id=%s readLen=%d", activeId.c_str(), (int)readLen);
       if (readLen == 0) return false;
     } else {
@@ -285,9 +310,16 @@ bool reloadActiveProfile() {
   }
 
   // Load into global profile object
-  profile.unflattenProfile(buf);
-  int count = profile.getSetpointCount();
-  finalTempOverride = profile.getFinalTargetTemp();
+  int count;
+  {
+    ControlLock controlLock;
+    if (roasterState == ROASTING) {
+      loaded.continueFrom(profile);
+    }
+    profile = std::move(loaded);
+    count = profile.getSetpointCount();
+    finalTempOverride = profile.getFinalTargetTemp();
+  }
   // Removed direct display writes from here to prevent setup-time blocking.
 
   String activeName;
@@ -296,6 +328,7 @@ bool reloadActiveProfile() {
             activeId.c_str(), activeName.c_str(), count, finalTempOverride);
 
   for (int i = 0; i < min(count, 3); i++) {
+    ControlLock controlLock;
     auto sp = profile.getSetpoint(i);
     LOG_DEBUGF("  Setpoint %d: time=%dms, temp=%d, fan=%d", i, sp.time, sp.temp, sp.fanSpeed);
   }
@@ -307,31 +340,53 @@ bool reloadActiveProfile() {
  * Scales time (x-axis) and temperature (y-axis) to fit waveform dimensions
  */
 void plotProfileOnWaveform() {
-  int count = profile.getSetpointCount();
-  if (count < 2) {
-    LOG_WARN("plotProfileOnWaveform: Profile has fewer than 2 setpoints, skipping plot");
-    return;
-  }
-  
-  // Get final time (last setpoint time in milliseconds)
-  auto finalSetpoint = profile.getSetpoint(count - 1);
-  uint32_t maxTime = finalSetpoint.time;
-  uint32_t maxTemp = finalSetpoint.temp;
-  
-  LOG_INFOF("plotProfileOnWaveform: Plotting %d setpoints, duration=%dms, maxTemp=%d", 
-            count, maxTime, maxTemp);
-  
   // The waveform renderer uses a 480x170 logical plot area.
   // Component ID is 2, channel 0
   const int WAVEFORM_WIDTH = 480;  // Number of data points to send (matches pixel width)
   const int WAVEFORM_HEIGHT = 170; // Y-axis range (0-170 pixels)
-  
-  // Safety: ensure temp doesn't exceed waveform range
-  if (maxTemp == 0) {
-    LOG_WARN("plotProfileOnWaveform: maxTemp is 0, cannot plot");
-    return;
+
+  // Sample the curve under ControlLock with a cursor of our own, then do
+  // the slow display writes after releasing it
+  uint8_t scaledPoints[WAVEFORM_WIDTH];
+  int count;
+  uint32_t maxTime;
+  uint32_t maxTemp;
+  {
+    ControlLock controlLock;
+    count = profile.getSetpointCount();
+    if (count < 2) {
+      LOG_WARN("plotProfileOnWaveform: Profile has fewer than 2 setpoints, skipping plot");
+      return;
+    }
+
+    // Get final time (last setpoint time in milliseconds)
+    auto finalSetpoint = profile.getSetpoint(count - 1);
+    maxTime = finalSetpoint.time;
+    maxTemp = finalSetpoint.temp;
+
+    // Safety: ensure temp doesn't exceed waveform range
+    if (maxTemp == 0) {
+      LOG_WARN("plotProfileOnWaveform: maxTemp is 0, cannot plot");
+      return;
+    }
+
+    uint16_t cursor = 0;
+    for (int i = 0; i < WAVEFORM_WIDTH; i++) {
+      // Calculate time for this x position (reverse: maxTime to 0)
+      // This fixes the inverted x-axis so profile renders left-to-right
+      uint32_t timeAtX = (maxTime * (WAVEFORM_WIDTH - 1 - i)) / WAVEFORM_WIDTH;
+
+      // Scale temperature to waveform height (0-170) using wider intermediates
+      uint32_t interpolatedTemp = profile.getTargetTempAtTime(timeAtX, cursor);
+      uint32_t scaledTemp32 = ((uint32_t)interpolatedTemp * (uint32_t)WAVEFORM_HEIGHT) / (uint32_t)maxTemp;
+      if (scaledTemp32 > (uint32_t)WAVEFORM_HEIGHT) scaledTemp32 = (uint32_t)WAVEFORM_HEIGHT;
+      scaledPoints[i] = (uint8_t)scaledTemp32;
+    }
   }
   
+  LOG_INFOF("plotProfileOnWaveform: Plotting %d setpoints, duration=%dms, maxTemp=%d", 
+            count, maxTime, maxTemp);
+  
   // Clear the waveform (component-specific, not whole page)
   displayClearProfileWaveform();
   delay(50);  // Give the display pipeline time to process the clear.
@@ -343,27 +398,16 @@ void plotProfileOnWaveform() {
     // Yield every 16 points to service watchdog and network
     if ((i & 0x0F) == 0) yield();
     
-    // Calculate time for this x position (reverse: maxTime to 0)
-    // This fixes the inverted x-axis so profile renders left-to-right
-    uint32_t timeAtX = (maxTime * (WAVEFORM_WIDTH - 1 - i)) / WAVEFORM_WIDTH;
-    
-    // Get interpolated temperature at this time
-    uint32_t interpolatedTemp = profile.getTargetTempAtTime(timeAtX);
-    
-    // Scale temperature to waveform height (0-170) using wider intermediates
-    uint32_t scaledTemp32 = ((uint32_t)interpolatedTemp * (uint32_t)WAVEFORM_HEIGHT) / (uint32_t)maxTemp;
-    if (scaledTemp32 > (uint32_t)WAVEFORM_HEIGHT) scaledTemp32 = (uint32_t)WAVEFORM_HEIGHT;
-    
     // Send to waveform: add <componentID>,<channel>,<value>
     // Component ID 2 = s0, channel 0
-    displayAddProfileWaveformPoint(scaledTemp32);
+    displayAddProfileWaveformPoint(scaledPoints[i]);
     
     // No delay needed - yield() at loop start is sufficient
     pointsSent++;
     
     // Log sample points for debugging
     if (i < 5 || i % 100 == 0) {
-      LOG_DEBUGF("  Point %d: time=%dms, temp=%d, scaled=%lu", i, timeAtX, interpolatedTemp, (unsigned long)scaledTemp32);
+      LOG_DEBUGF("  Point %d: scaled=%u", i, (unsigned)scaledPoints[i]);
     }
   }
   
@@ -378,7 +422,12 @@ void plotProfileOnWaveform() {
  * Called when the active profile page is entered.
  */
 void onProfileActivePageEnter() {
-  if (profile.getSetpointCount() < 2) {
+  int count;
+  {
+    ControlLock controlLock;
+    count = profile.getSetpointCount();
+  }
+  if (count < 2) {
     LOG_WARN("onProfileActivePageEnter: Profile has fewer than 2 setpoints, skipping plot");
     return;
   }
@@ -435,8 +484,8 @@ String getProfileById(const String& id) {
     return output;
   }
 
-  uint8_t buf[200];
-  size_t readLen = preferences.getBytes(profileDataKey(id).c_str(), buf, sizeof(buf));
+  RoastProfile tempProfile;
+  size_t readLen = readProfileData(id, tempProfile);
   if (readLen == 0) {
     doc["error"] = "not_found";
     LOG_WARNF("Profile not found: id=%s", id.c_str());
@@ -445,8 +494,6 @@ String getProfileById(const String& id) {
     return output;
   }
 
-  RoastProfile tempProfile;
-  tempProfile.unflattenProfile(buf);
 
   String name;
   loadProfileMeta(id, name);
@@ -466,6 +513,7 @@ String getProfileById(const String& id) {
   doc["id"] = id;
   doc["name"] = name;
   doc["active"] = (id == getActiveProfileId());
+  doc["interpolation"] = tempProfile.getInterpolationMode() == RoastProfile::INTERPOLATION_PCHIP ? "pchip" : "linear";
 
   LOG_DEBUGF("Loaded profile id=%s name='%s' with %d setpoints", id.c_str(), name.c_str(), tempProfile.getSetpointCount());
 
@@ -533,7 +581,11 @@ String saveProfileById(const String& id, const JsonDocument& requestDoc, bool al
       responseDoc["error"] = "setpoint_out_of_bounds";
       String output; serializeJson(responseDoc, output); return output;
     }
-    tempProfile.addSetpoint(timeMs, temp, fan);
+    tempProfile.appendSetpoint(timeMs, temp, fan);
+  }
+  tempProfile.finishSetpoints();
+  if (requestDoc["interpolation"] == "pchip") {
+    tempProfile.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
   }
 
   bool exists = profileExists(id);
@@ -543,16 +595,13 @@ String saveProfileById(const String& id, const JsonDocument& requestDoc, bool al
     String output; serializeJson(responseDoc, output); return output;
   }
 
-  tempProfile.flattenProfile(profileBuffer);
-  // Compute actual serialized length to minimize NVS usage
-  size_t serializedLen = 5 + (size_t)tempProfile.getSetpointCount() * 12; // header + per-setpoint bytes
-  uint8_t localBuffer[200]; // Use local buffer to avoid race conditions with global profileBuffer
-  if (serializedLen > sizeof(localBuffer)) serializedLen = sizeof(localBuffer);
-  
-  tempProfile.flattenProfile(localBuffer);
+  // Local buffer sized to the encoded profile to minimize NVS usage
+  std::vector<uint8_t> localBuffer;
+  encodeProfileData(tempProfile, localBuffer);
+  size_t serializedLen = localBuffer.size();
 
   LOG_DEBUGF("saveProfileById: Writing %d bytes to NVS (Heap: %d)", serializedLen, ESP.getFreeHeap());
-  size_t written = preferences.putBytes(profileDataKey(id).c_str(), localBuffer, serializedLen);
+  size_t written = preferences.putBytes(profileDataKey(id).c_str(), localBuffer.data(), serializedLen);
   
   if (written == 0) {
     LOG_WARNF("NVS write failed for %s, retrying", profileDataKey(id).c_str());
@@ -560,7 +609,7 @@ String saveProfileById(const String& id, const JsonDocument& requestDoc, bool al
     // Simple retry without closing/opening namespace to avoid race conditions
     for (int attempt = 1; attempt <= 3 && written == 0; attempt++) {
       preferences.remove(profileDataKey(id).c_str());
-      written = preferences.putBytes(profileDataKey(id).c_str(), localBuffer, serializedLen);
+      written = preferences.putBytes(profileDataKey(id).c_str(), localBuffer.data(), serializedLen);
       LOG_WARNF("Retry %d wrote %d bytes", attempt, (int)written);
     }
     
@@ -585,7 +634,7 @@ String saveProfileById(const String& id, const JsonDocument& requestDoc, bool al
            setProfileIds(ids);
            
            // Try write again
-           written = preferences.putBytes(profileDataKey(id).c_str(), localBuffer, serializedLen);
+           written = preferences.putBytes(profileDataKey(id).c_str(), localBuffer.data(), serializedLen);
            LOG_INFOF("Write after cleanup: %d bytes", (int)written);
         }
       }
@@ -614,10 +663,9 @@ String saveProfileById(const String& id, const JsonDocument& requestDoc, bool al
   LOG_INFOF("Saved profile id=%s name='%s' (%d bytes)", id.c_str(), profileName.c_str(), (int)written);
 
   if (activate) {
-    profile.clearSetpoints();
-    for (int i = 0; i < tempProfile.getSetpointCount(); i++) {
-      auto sp = tempProfile.getSetpoint(i);
-      profile.addSetpoint(sp.time, sp.temp, sp.fanSpeed);
+    {
+      ControlLock controlLock;
+      profile = tempProfile;
     }
     setActiveProfileId(id);
     LOG_INFOF("Activated profile id=%s name='%s'", id.c_str(), profileName.c_str());
@@ -664,8 +712,8 @@ String activateProfileById(const String& id) {
     String output; serializeJson(responseDoc, output); return output;
   }
 
-  uint8_t buf[200];
-  size_t readLen = preferences.getBytes(profileDataKey(id).c_str(), buf, sizeof(buf));
+  RoastProfile loaded;
+  size_t readLen = readProfileData(id, loaded);
   if (readLen == 0) {
     responseDoc["ok"] = false;
     responseDoc["error"] = "profile_not_found";
@@ -673,8 +721,14 @@ String activateProfileById(const String& id) {
     String output; serializeJson(responseDoc, output); return output;
   }
 
-  profile.unflattenProfile(buf);
-  finalTempOverride = profile.getFinalTargetTemp();
+  {
+    ControlLock controlLock;
+    if (roasterState == ROASTING) {
+      loaded.continueFrom(profile);
+    }
+    profile = std::move(loaded);
+    finalTempOverride = profile.getFinalTargetTemp();
+  }
   displaySetFinalTargetTemp(finalTempOverride);
   setActiveProfileId(id);
 
@@ -751,9 +805,7 @@ String createNewProfile(const String& name) {
   tempProfile.addSetpoint(150000, 300, 100);
   tempProfile.addSetpoint(300000, 380, 100);
   tempProfile.addSetpoint(480000, 430, 95);
-  tempProfile.flattenProfile(profileBuffer);
-
-  preferences.putBytes(profileDataKey(id).c_str(), profileBuffer, sizeof(profileBuffer));
+  writeProfileData(id, tempProfile);
   saveProfileMeta(id, profileName);
 
   auto ids = getProfileIds();
@@ -0,0 +1,331 @@
+#ifndef PROFILE_ID_INDEX_HPP
+#define PROFILE_ID_INDEX_HPP
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <string.h>
+#include <vector>
+#include "../support/Crc32.hpp"
+#include "../support/DebugLog.hpp"
+
+// Saved profile ids in creation order, stored in NVS as fixed-size records
+// instead of one comma-joined string. `Store` is Preferences or anything with
+// the same blob/string calls (the LittleFS FileStore in ProfileStore.hpp). Records live in pages of
+// RECORDS_PER_PAGE, each its own blob with a CRC, so appending an id or
+// tombstoning one rewrites a single page plus the small header rather than
+// the whole list. Tombstones are squeezed out once they make up a page's
+// worth and at least half of the records, and on load.
+//
+//   "pidx"        header: version, bank, record count (LE16), CRC-32 (LE)
+//   "pidx_<b><n>" page n of bank b ('a' or 'b'): records, then CRC-32 (LE)
+//   record        id (MAX_ID_LENGTH bytes, NUL padded), state byte
+//
+// Compaction writes the live records into the other bank and then flips the
+// bank in the header, so a reset part way through leaves the old list
+// intact. An append that resets before the header write is simply lost.
+// Pages past the header's record count are ignored, as is anything a page
+// holds beyond it.
+template <typename Store>
+class BasicProfileIdIndex {
+public:
+    static constexpr uint8_t VERSION = 1;
+    // pf_<id> has to fit the 15-character NVS key limit
+    static constexpr size_t MAX_ID_LENGTH = 12;
+    static constexpr size_t RECORDS_PER_PAGE = 16;
+    static constexpr uint16_t MAX_RECORDS = 1024;
+
+    explicit BasicProfileIdIndex(Store &store) : store(store) {}
+
+    // Reads the index, importing the old profile_ids string the first time.
+    // A page that fails its CRC is dropped with a warning; the profiles it
+    // listed stay in NVS but are no longer listed.
+    void load() {
+        records.clear();
+        bank = 0;
+        loaded = true;
+
+        uint8_t header[HEADER_SIZE];
+        if (store.getBytesLength(HEADER_KEY) != HEADER_SIZE ||
+            store.getBytes(HEADER_KEY, header, HEADER_SIZE) != HEADER_SIZE) {
+            migrateCsv();
+            return;
+        }
+        if (header[0] != VERSION || header[1] > 1 || readLe32(header + 4) != crc32(header, 4)) {
+            LOG_WARN("Profile index header is corrupt; starting empty");
+            return;
+        }
+
+        bank = header[1];
+        uint16_t count = readLe16(header + 2);
+        if (count > MAX_RECORDS) {
+            LOG_WARN("Profile index header is corrupt; starting empty");
+            return;
+        }
+        bool dropped = false;
+        for (size_t page = 0; page * RECORDS_PER_PAGE < count; page++) {
+            size_t wanted = min(RECORDS_PER_PAGE, count - page * RECORDS_PER_PAGE);
+            if (!readPage(page, wanted)) {
+                LOG_WARNF("Profile index page %d is corrupt; dropping it", (int)page);
+                dropped = true;
+            }
+        }
+        if (dropped || tombstoneCount() > 0) {
+            compact();
+        }
+    }
+
+    // Live ids, oldest first
+    std::vector<String> ids() {
+        ensureLoaded();
+        std::vector<String> out;
+        out.reserve(records.size());
+        for (const auto &record : records) {
+            if (record.live) out.push_back(record.id);
+        }
+        return out;
+    }
+
+    bool contains(const String &id) {
+        ensureLoaded();
+        return findLive(id) >= 0;
+    }
+
+    size_t liveCount() {
+        ensureLoaded();
+        return records.size() - tombstoneCount();
+    }
+
+    size_t tombstoneCount() const {
+        size_t count = 0;
+        for (const auto &record : records) {
+            if (!record.live) count++;
+        }
+        return count;
+    }
+
+    // Oldest live id, or "" when there is none (eviction order)
+    String oldest() {
+        ensureLoaded();
+        for (const auto &record : records) {
+            if (record.live) return record.id;
+        }
+        return String();
+    }
+
+    // Adds `id` at the end; true if it is listed afterwards.
+    bool append(const String &id) {
+        ensureLoaded();
+        if (id.length() == 0 || id.length() > MAX_ID_LENGTH) {
+            return false;
+        }
+        if (findLive(id) >= 0) {
+            return true;
+        }
+        if (records.size() >= MAX_RECORDS) {
+            compact();
+            if (records.size() >= MAX_RECORDS) return false;
+        }
+        records.push_back(Record{id, true});
+        if (!writePage(bank, (records.size() - 1) / RECORDS_PER_PAGE) || !writeHeader(bank)) {
+            records.pop_back();
+            return false;
+        }
+        return true;
+    }
+
+    // Tombstones `id`; true if it was listed.
+    bool remove(const String &id) {
+        ensureLoaded();
+        int position = findLive(id);
+        if (position < 0) {
+            return false;
+        }
+        records[position].live = false;
+        if (!writePage(bank, position / RECORDS_PER_PAGE)) {
+            records[position].live = true;
+            return false;
+        }
+        size_t tombstones = tombstoneCount();
+        if (tombstones >= RECORDS_PER_PAGE && tombstones * 2 >= records.size()) {
+            compact();
+        }
+        return true;
+    }
+
+    // Rewrites the live records, in order, into the other bank.
+    bool compact() {
+        ensureLoaded();
+        std::vector<Record> live;
+        for (const auto &record : records) {
+            if (record.live) live.push_back(record);
+        }
+        size_t oldPages = pageCount(records.size());
+        std::vector<Record> previous;
+        previous.swap(records);
+        records.swap(live);
+
+        uint8_t target = bank ^ 1;
+        for (size_t page = 0; page < pageCount(records.size()); page++) {
+            if (!writePage(target, page)) {
+                records.swap(previous);
+                return false;
+            }
+        }
+        if (!writeHeader(target)) {
+            records.swap(previous);
+            return false;
+        }
+        for (size_t page = 0; page < oldPages; page++) {
+            store.remove(pageKey(bank, page).c_str());
+        }
+        bank = target;
+        LOG_INFOF("Profile index compacted: %d -> %d records", (int)previous.size(), (int)records.size());
+        return true;
+    }
+
+    // Drops every record and the stored index.
+    void clear() {
+        ensureLoaded();
+        for (uint8_t b = 0; b < 2; b++) {
+            for (size_t page = 0; page < pageCount(MAX_RECORDS); page++) {
+                String key = pageKey(b, page);
+                if (!store.isKey(key.c_str())) break;
+                store.remove(key.c_str());
+            }
+        }
+        store.remove(HEADER_KEY);
+        store.remove(LEGACY_KEY);
+        records.clear();
+        bank = 0;
+    }
+
+private:
+    static constexpr const char *HEADER_KEY = "pidx";
+    static constexpr const char *LEGACY_KEY = "profile_ids";
+    static constexpr size_t HEADER_SIZE = 8;
+    static constexpr size_t RECORD_SIZE = MAX_ID_LENGTH + 1;
+    static constexpr uint8_t STATE_LIVE = 1;
+    static constexpr uint8_t STATE_TOMBSTONE = 0;
+
+    struct Record {
+        String id;
+        bool live;
+    };
+
+    Store &store;
+    std::vector<Record> records;
+    uint8_t bank = 0;
+    bool loaded = false;
+
+    void ensureLoaded() {
+        if (!loaded) load();
+    }
+
+    static size_t pageCount(size_t recordCount) {
+        return (recordCount + RECORDS_PER_PAGE - 1) / RECORDS_PER_PAGE;
+    }
+
+    static String pageKey(uint8_t b, size_t page) {
+        String key = "pidx_";
+        key += b ? 'b' : 'a';
+        key += (unsigned int)page;
+        return key;
+    }
+
+    static uint16_t readLe16(const uint8_t *in) {
+        return (uint16_t)(in[0] | (in[1] << 8));
+    }
+
+    static uint32_t readLe32(const uint8_t *in) {
+        return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+    }
+
+    static void writeLe32(uint8_t *out, uint32_t value) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            *out++ = (uint8_t)(value >> shift);
+        }
+    }
+
+    int findLive(const String &id) const {
+        for (size_t i = 0; i < records.size(); i++) {
+            if (records[i].live && records[i].id == id) return (int)i;
+        }
+        return -1;
+    }
+
+    bool writeHeader(uint8_t targetBank) {
+        uint8_t header[HEADER_SIZE];
+        header[0] = VERSION;
+        header[1] = targetBank;
+        header[2] = (uint8_t)records.size();
+        header[3] = (uint8_t)(records.size() >> 8);
+        writeLe32(header + 4, crc32(header, 4));
+        return store.putBytes(HEADER_KEY, header, HEADER_SIZE) == HEADER_SIZE;
+    }
+
+    bool writePage(uint8_t targetBank, size_t page) {
+        uint8_t blob[RECORDS_PER_PAGE * RECORD_SIZE + 4];
+        size_t first = page * RECORDS_PER_PAGE;
+        size_t count = min(RECORDS_PER_PAGE, records.size() - first);
+        memset(blob, 0, sizeof(blob));
+        for (size_t i = 0; i < count; i++) {
+            const Record &record = records[first + i];
+            uint8_t *out = blob + i * RECORD_SIZE;
+            memcpy(out, record.id.c_str(), record.id.length());
+            out[MAX_ID_LENGTH] = record.live ? STATE_LIVE : STATE_TOMBSTONE;
+        }
+        size_t length = count * RECORD_SIZE;
+        writeLe32(blob + length, crc32(blob, length));
+        return store.putBytes(pageKey(targetBank, page).c_str(), blob, length + 4) == length + 4;
+    }
+
+    bool readPage(size_t page, size_t wanted) {
+        String key = pageKey(bank, page);
+        size_t length = store.getBytesLength(key.c_str());
+        uint8_t blob[RECORDS_PER_PAGE * RECORD_SIZE + 4];
+        if (length < 4 || length > sizeof(blob) || (length - 4) % RECORD_SIZE != 0 ||
+            (length - 4) / RECORD_SIZE < wanted || store.getBytes(key.c_str(), blob, length) != length ||
+            readLe32(blob + length - 4) != crc32(blob, length - 4)) {
+            return false;
+        }
+        for (size_t i = 0; i < wanted; i++) {
+            const uint8_t *in = blob + i * RECORD_SIZE;
+            char id[MAX_ID_LENGTH + 1] = {};
+            memcpy(id, in, MAX_ID_LENGTH);
+            records.push_back(Record{String(id), in[MAX_ID_LENGTH] == STATE_LIVE && id[0] != '\0'});
+        }
+        return true;
+    }
+
+    // One-time import of the comma-joined list earlier firmware kept under
+    // profile_ids. The string is only removed once the index is written.
+    void migrateCsv() {
+        String csv = store.getString(LEGACY_KEY, "");
+        if (csv.length() == 0) {
+            return;
+        }
+        int start = 0;
+        while (start <= (int)csv.length()) {
+            int comma = csv.indexOf(',', start);
+            String token = csv.substring(start, comma < 0 ? csv.length() : comma);
+            token.trim();
+            if (token.length() > 0 && token.length() <= MAX_ID_LENGTH && findLive(token) < 0 &&
+                records.size() < MAX_RECORDS) {
+                records.push_back(Record{token, true});
+            }
+            if (comma < 0) break;
+            start = comma + 1;
+        }
+        for (size_t page = 0; page < pageCount(records.size()); page++) {
+            if (!writePage(bank, page)) return;
+        }
+        if (writeHeader(bank)) {
+            store.remove(LEGACY_KEY);
+            LOG_INFOF("Migrated %d profile ids to the binary index", (int)records.size());
+        }
+    }
+};
+
+typedef BasicProfileIdIndex<Preferences> ProfileIdIndex;
+
+#endif // PROFILE_ID_INDEX_HPP
@@ -6,12 +6,17 @@
 #include <Preferences.h>
 #include <vector>
 #include "RoastProfile.hpp"
+#include "ProfileIdIndex.hpp"
+#include "ProfileStore.hpp"
 #include "../support/DebugLog.hpp"
 #include "../platform/RoasterTypes.hpp"
+#include "../platform/ControlTask.hpp"
+#include "../support/StaticMutex.hpp"
 
 // Forward declarations
 extern RoastProfile profile;
-extern Preferences preferences;
+extern RoasterState roasterState;
+extern ProfileStore &profileStore;
 
 struct ProfileOperationResult {
     bool success;
@@ -19,6 +24,15 @@ struct ProfileOperationResult {
     String error;
 };
 
+// One saved profile as the list views show it
+struct ProfileSummary {
+    String id;
+    String name;
+    int finalTarget;
+    int setpointCount;
+    bool active;
+};
+
 class ProfileManager {
 private:
     // Helpers
@@ -43,78 +57,262 @@ private:
         return base32_64(r).substring(0, 8);
     }
 
-    std::vector<String> splitNames(const String& csv) {
-        std::vector<String> names;
-        int start = 0;
-        while (true) {
-            int idx = csv.indexOf(',', start);
-            if (idx == -1) {
-                String token = csv.substring(start);
-                token.trim();
-                if (token.length() > 0) names.push_back(token);
-                break;
-            }
-            String token = csv.substring(start, idx);
-            token.trim();
-            if (token.length() > 0) names.push_back(token);
-            start = idx + 1;
+    // Profile blobs are variable length, so size the read from the store
+    // instead of using a fixed buffer.
+    bool readProfileBlob(const String& id, std::vector<uint8_t>& blob) {
+        size_t len = profileStore.getBytesLength(profileDataKey(id).c_str());
+        if (len == 0) {
+            return false;
         }
-        return names;
+        blob.resize(len);
+        return profileStore.getBytes(profileDataKey(id).c_str(), blob.data(), blob.size()) == len;
     }
 
-    String joinNames(const std::vector<String>& names) {
-        String out;
-        for (size_t i = 0; i < names.size(); i++) {
-            out += names[i];
-            if (i + 1 < names.size()) out += ",";
+    bool encodeProfile(const RoastProfile& source, std::vector<uint8_t>& blob) {
+        blob.resize(source.getFlattenedSize());
+        return source.flattenProfile(blob.data(), blob.size()) == blob.size();
+    }
+
+    // Replaces the global profile under ControlLock, so the control task
+    // never interpolates over setpoints that are being reallocated. During a
+    // roast the new profile takes over the running clock instead of jumping
+    // to the end of its curve.
+    void installActiveProfile(RoastProfile& loaded) {
+        ControlLock controlLock;
+        if (roasterState == ROASTING) {
+            loaded.continueFrom(profile);
+        }
+        profile = std::move(loaded);
+    }
+
+    // In-RAM index of the saved profiles, built from the store once and then kept
+    // in step by every call that writes a profile, so listing is a walk over
+    // memory instead of a meta and data read per profile. The generation
+    // changes on every edit and backs the ETag of GET /api/profiles.
+    //
+    // Web handlers (async_tcp task) and the display (loop()) both use it.
+    // Recursive like ControlLock so the helpers below can nest.
+    using IndexLock = RecursiveStaticMutexLock<ProfileManager>;
+
+    // Saved ids in creation order, persisted as the binary "pidx" records
+    BasicProfileIdIndex<ProfileStore> idIndex{profileStore};
+
+    std::vector<ProfileSummary> profileIndex;
+    String indexActiveId;
+    uint32_t indexGeneration = 0;
+    bool indexLoaded = false;
+
+    void ensureIndex() {
+        IndexLock lock;
+        if (!indexLoaded) {
+            rebuildIndex();
         }
-        return out;
+    }
+
+    void touchIndex() {
+        indexGeneration++;
+    }
+
+    ProfileSummary* findIndexEntry(const String& id) {
+        for (auto& entry : profileIndex) {
+            if (entry.id == id) return &entry;
+        }
+        return nullptr;
+    }
+
+    void indexUpsert(const String& id, const String& name, const RoastProfile& source) {
+        IndexLock lock;
+        ensureIndex();
+        ProfileSummary* entry = findIndexEntry(id);
+        if (entry == nullptr) {
+            profileIndex.push_back(ProfileSummary{id, "", 0, 0, id == indexActiveId});
+            entry = &profileIndex.back();
+        }
+        entry->name = name.length() > 0 ? name : id;
+        entry->finalTarget = static_cast<int>(source.getFinalTargetTemp());
+        entry->setpointCount = source.getSetpointCount();
+        touchIndex();
+    }
+
+    void indexRemove(const String& id) {
+        IndexLock lock;
+        ensureIndex();
+        for (auto it = profileIndex.begin(); it != profileIndex.end(); ) {
+            if (it->id == id) it = profileIndex.erase(it);
+            else ++it;
+        }
+        touchIndex();
     }
 
 public:
+    // Largest profile JSON accepted over HTTP: MAX_SETPOINTS setpoints with
+    // fractional times, plus the name.
+    static constexpr size_t MAX_PROFILE_JSON_BYTES = RoastProfile::MAX_SETPOINTS * 56 + 512;
+
+    // JsonDocument capacity for a profile with `setpointCount` setpoints
+    static size_t profileJsonCapacity(size_t setpointCount) { return 512 + setpointCount * 64; }
+
     ProfileManager() {}
 
+    // Reads every profile's meta and data once. Called at boot; any later
+    // access builds it on demand if that has not happened yet.
+    void rebuildIndex() {
+        IndexLock lock;
+        profileIndex.clear();
+        indexActiveId = profileStore.getString("active_id", "");
+        for (const auto& id : getProfileIds()) {
+            RoastProfile stored;
+            if (!readProfile(id, stored)) {
+                continue;
+            }
+            String name;
+            if (!loadProfileMeta(id, name) || name.length() == 0) {
+                name = id;
+            }
+            profileIndex.push_back(ProfileSummary{id, name, static_cast<int>(stored.getFinalTargetTemp()),
+                                                  stored.getSetpointCount(), id == indexActiveId});
+        }
+        // Start from a random value so an ETag from before a reboot never
+        // matches the rebuilt list.
+        if (!indexLoaded) {
+            indexGeneration = esp_random();
+        }
+        indexLoaded = true;
+        touchIndex();
+        LOG_INFOF("Profile index built: %d profiles", (int)profileIndex.size());
+    }
+
+    uint32_t getIndexGeneration() {
+        IndexLock lock;
+        ensureIndex();
+        return indexGeneration;
+    }
+
+    // Copy of the index in list order
+    std::vector<ProfileSummary> getProfileSummaries() {
+        IndexLock lock;
+        ensureIndex();
+        return profileIndex;
+    }
+
+    // Id of the first saved profile called `name`, or "" if there is none
+    String findProfileIdByName(const String& name) {
+        IndexLock lock;
+        ensureIndex();
+        for (const auto& entry : profileIndex) {
+            if (entry.name == name) return entry.id;
+        }
+        return String();
+    }
+
+#if ROASTER_PROFILE_STORE == ROASTER_PROFILE_STORE_LITTLEFS
+    // First boot with the LittleFS store: copies the profiles earlier
+    // firmware kept in NVS across, then removes them from NVS once every one
+    // has been copied. Does nothing once the file store lists a profile.
+    void migrateFromNvs(Preferences& nvs) {
+        IndexLock lock;
+        if (!idIndex.ids().empty()) {
+            return;
+        }
+        ProfileIdIndex legacy(nvs);
+        std::vector<String> ids = legacy.ids();
+        if (ids.empty()) {
+            return;
+        }
+
+        size_t moved = 0;
+        for (const auto& id : ids) {
+            esp_task_wdt_reset();
+            size_t len = nvs.getBytesLength(profileDataKey(id).c_str());
+            std::vector<uint8_t> blob(len);
+            if (len == 0 || nvs.getBytes(profileDataKey(id).c_str(), blob.data(), len) != len ||
+                profileStore.putBytes(profileDataKey(id).c_str(), blob.data(), len) != len) {
+                LOG_WARNF("Could not move profile %s to LittleFS", id.c_str());
+                continue;
+            }
+            String meta = nvs.getString(profileMetaKey(id).c_str(), "");
+            if (meta.length() > 0) {
+                profileStore.putString(profileMetaKey(id).c_str(), meta);
+            }
+            idIndex.append(id);
+            moved++;
+        }
+        String activeId = nvs.getString("active_id", "");
+        if (idIndex.contains(activeId)) {
+            profileStore.putString("active_id", activeId);
+        }
+
+        if (moved == ids.size()) {
+            for (const auto& id : ids) {
+                nvs.remove(profileDataKey(id).c_str());
+                nvs.remove(profileMetaKey(id).c_str());
+            }
+            legacy.clear();
+            nvs.remove("active_id");
+        }
+        indexLoaded = false;
+        LOG_INFOF("Moved %d of %d profiles from NVS to LittleFS", (int)moved, (int)ids.size());
+    }
+#endif
+
+    // Reads and decodes a stored profile. Profiles still in the v1 layout are
+    // rewritten as v2 the first time they are read.
     bool readProfile(const String& id, RoastProfile& profileOut) {
         if (id.length() == 0) {
             return false;
         }
 
-        uint8_t buffer[200];
-        size_t len = preferences.getBytes(profileDataKey(id).c_str(), buffer, sizeof(buffer));
-        if (len == 0) {
+        std::vector<uint8_t> blob;
+        if (!readProfileBlob(id, blob)) {
+            return false;
+        }
+        if (!profileOut.unflattenProfile(blob.data(), blob.size())) {
+            LOG_WARNF("Profile %s is corrupt (%d bytes)", id.c_str(), (int)blob.size());
             return false;
         }
 
-        profileOut.unflattenProfile(buffer);
+        if (profileOut.getProfileVersion() < RoastProfile::FORMAT_VERSION) {
+            size_t oldLen = blob.size();
+            if (encodeProfile(profileOut, blob) &&
+                profileStore.putBytes(profileDataKey(id).c_str(), blob.data(), blob.size()) > 0) {
+                LOG_INFOF("Migrated profile %s to v%d (%d -> %d bytes)", id.c_str(), RoastProfile::FORMAT_VERSION,
+                          (int)oldLen, (int)blob.size());
+            }
+        }
         return true;
     }
 
+    // Saved ids, oldest first
     std::vector<String> getProfileIds() {
-        String csv = preferences.getString("profile_ids", "");
-        return splitNames(csv);
-    }
-
-    void setProfileIds(const std::vector<String>& ids) {
-        preferences.putString("profile_ids", joinNames(ids));
+        IndexLock lock;
+        return idIndex.ids();
     }
 
     String getActiveProfileId() {
-        String id = preferences.getString("active_id", "");
-        LOG_DEBUGF("getActiveProfileId returning: %s", id.c_str());
-        return id;
+        IndexLock lock;
+        ensureIndex();
+        return indexActiveId;
     }
 
     void setActiveProfileId(const String& id) {
-        size_t written = preferences.putString("active_id", id);
+        size_t written = profileStore.putString("active_id", id);
         if (written == 0) {
-            LOG_ERRORF("Failed to write active_id to NVS! (Key len: %d)", String("active_id").length());
+            LOG_ERRORF("Failed to write active_id to the profile store! (Key len: %d)", String("active_id").length());
         } else {
             LOG_DEBUGF("Set active_id to %s (written %d bytes)", id.c_str(), written);
         }
+
+        IndexLock lock;
+        ensureIndex();
+        indexActiveId = id;
+        for (auto& entry : profileIndex) {
+            entry.active = (entry.id == id);
+        }
+        touchIndex();
     }
 
     bool loadProfileMeta(const String& id, String& nameOut) {
-        String metaStr = preferences.getString(profileMetaKey(id).c_str(), "");
+        String metaStr = profileStore.getString(profileMetaKey(id).c_str(), "");
         if (metaStr.length() == 0) return false;
         
         DynamicJsonDocument metaDoc(256);
@@ -131,11 +329,11 @@ public:
         metaDoc["name"] = name;
         String out;
         serializeJson(metaDoc, out);
-        preferences.putString(profileMetaKey(id).c_str(), out);
+        profileStore.putString(profileMetaKey(id).c_str(), out);
     }
 
     bool profileExists(const String& id) {
-        return preferences.isKey(profileDataKey(id).c_str());
+        return profileStore.isKey(profileDataKey(id).c_str());
     }
 
     // Save a profile from a JSON string
@@ -147,10 +345,10 @@ public:
         { // Scope for DynamicJsonDocument to ensure destruction before return
             // 1. Parse JSON
             // Calculate size: body length + overhead. 
-            // For small profiles, 4096 is overkill. 
+            // Capped at what a full MAX_SETPOINTS profile needs.
             // JSON object overhead is roughly 16 bytes per element + string storage.
             size_t capacity = jsonBody.length() * 2 + 512;
-            if (capacity > 4096) capacity = 4096;
+            if (capacity > profileJsonCapacity(RoastProfile::MAX_SETPOINTS)) capacity = profileJsonCapacity(RoastProfile::MAX_SETPOINTS);
             
             LOG_DEBUGF("Allocating JSON doc: %d bytes", capacity);
             DynamicJsonDocument doc(capacity);
@@ -180,98 +378,114 @@ public:
             RoastProfile tempProfile;
             tempProfile.clearSetpoints();
             JsonArray setpoints = doc["setpoints"];
+            if (setpoints.size() >= static_cast<size_t>(RoastProfile::MAX_SETPOINTS)) {
+                LOG_ERRORF("Too many setpoints (%d)", (int)setpoints.size());
+                result.error = "too_many_setpoints";
+                return result;
+            }
             
             for (JsonObject sp : setpoints) {
-                uint32_t time = sp["time"].as<uint32_t>() * 1000;
+                // Fractional seconds keep the resolution of dense imported curves
+                double seconds = sp["time"].as<double>();
                 uint32_t temp = sp["temp"].as<uint32_t>();
                 uint32_t fan = sp["fanSpeed"].as<uint32_t>();
                 
-                if (!tempProfile.validateSetpoint(temp, fan)) {
+                if (!(seconds >= 0.0 && seconds < 4294967.0) || !tempProfile.validateSetpoint(temp, fan)) {
                     LOG_ERROR("Setpoint out of bounds");
                     result.error = "setpoint_out_of_bounds";
                     return result;
                 }
-                tempProfile.addSetpoint(time, temp, fan);
+                tempProfile.appendSetpoint(static_cast<uint32_t>(lround(seconds * 1000.0)), temp, fan);
             }
+            tempProfile.finishSetpoints();
             LOG_DEBUGF("Parsed %d setpoints", tempProfile.getSetpointCount());
 
+            // Optional "interpolation": "linear" (default) or "pchip"
+            String interpolation = doc["interpolation"] | "linear";
+            if (interpolation == "pchip") {
+                tempProfile.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+            } else if (interpolation != "linear") {
+                LOG_ERRORF("Unknown interpolation '%s'", interpolation.c_str());
+                result.error = "invalid_interpolation";
+                return result;
+            }
+
             // 5. Serialize to binary buffer
-            uint8_t buffer[200];
-            tempProfile.flattenProfile(buffer);
-            size_t len = 5 + (tempProfile.getSetpointCount() * 12);
-            if (len > sizeof(buffer)) len = sizeof(buffer);
-
-            // 6. Write to NVS
-            LOG_DEBUG("Writing to NVS...");
-            esp_task_wdt_reset(); // Pet watchdog before NVS op
-            size_t written = preferences.putBytes(profileDataKey(id).c_str(), buffer, len);
+            std::vector<uint8_t> buffer;
+            if (!encodeProfile(tempProfile, buffer)) {
+                result.error = "encode_failed";
+                return result;
+            }
+            const size_t len = buffer.size();
+
+            // 6. Write to the profile store
+            LOG_DEBUG("Writing profile blob...");
+            esp_task_wdt_reset(); // Pet watchdog before the store write
+            size_t written = profileStore.putBytes(profileDataKey(id).c_str(), buffer.data(), len);
             
             if (written == 0) {
                 LOG_WARN("First write failed, retrying...");
                 // Retry logic
                 for (int i = 0; i < 3; i++) {
                     esp_task_wdt_reset();
-                    preferences.remove(profileDataKey(id).c_str());
-                    written = preferences.putBytes(profileDataKey(id).c_str(), buffer, len);
+                    profileStore.remove(profileDataKey(id).c_str());
+                    written = profileStore.putBytes(profileDataKey(id).c_str(), buffer.data(), len);
                     if (written > 0) break;
                 }
                 
                 if (written == 0) {
                     LOG_WARN("Retries failed, attempting cleanup...");
-                    // Emergency cleanup: delete oldest profile
-                    auto ids = getProfileIds();
-                    if (!ids.empty()) {
-                        String victim = ids.front();
-                        if (victim != id) {
-                            LOG_WARNF("Deleting %s to free space", victim.c_str());
-                            preferences.remove(profileDataKey(victim).c_str());
-                            preferences.remove(profileMetaKey(victim).c_str());
-                            
-                            // Remove from list
-                            for (auto it = ids.begin(); it != ids.end(); ) {
-                                if (*it == victim) it = ids.erase(it);
-                                else ++it;
-                            }
-                            setProfileIds(ids);
-                            
-                            // Final try
-                            esp_task_wdt_reset();
-                            written = preferences.putBytes(profileDataKey(id).c_str(), buffer, len);
+                    // Emergency cleanup: delete the oldest profile that is
+                    // neither this one nor the active one
+                    String victim;
+                    String activeId = getActiveProfileId();
+                    for (const auto& candidate : getProfileIds()) {
+                        if (candidate != id && candidate != activeId) {
+                            victim = candidate;
+                            break;
+                        }
+                    }
+                    if (victim.length() > 0) {
+                        LOG_WARNF("Deleting %s to free space", victim.c_str());
+                        profileStore.remove(profileDataKey(victim).c_str());
+                        profileStore.remove(profileMetaKey(victim).c_str());
+                        {
+                            IndexLock lock;
+                            idIndex.remove(victim);
                         }
+                        indexRemove(victim);
+                        
+                        // Final try
+                        esp_task_wdt_reset();
+                        written = profileStore.putBytes(profileDataKey(id).c_str(), buffer.data(), len);
                     }
                 }
             }
 
             if (written == 0) {
-                LOG_ERROR("NVS write completely failed");
+                LOG_ERROR("Profile write completely failed");
                 result.error = "nvs_write_failed";
                 return result;
             }
-            LOG_DEBUG("NVS write successful");
+            LOG_DEBUG("Profile write successful");
 
             // 7. Save Metadata
             String name = doc["name"] | "Unnamed";
             saveProfileMeta(id, name);
+            indexUpsert(id, name, tempProfile);
 
-            // 8. Update ID list
-            auto ids = getProfileIds();
-            bool found = false;
-            for (const auto& existing : ids) {
-                if (existing == id) { found = true; break; }
-            }
-            if (!found) {
-                ids.push_back(id);
-                setProfileIds(ids);
+            // 8. Update ID list (no-op if already listed)
+            {
+                IndexLock lock;
+                if (!idIndex.append(id)) {
+                    LOG_WARNF("Failed to add %s to the profile index", id.c_str());
+                }
             }
 
             // 9. Activate if requested
             if (doc["activate"] | false) {
                 LOG_DEBUG("Activating profile...");
-                profile.clearSetpoints();
-                for (int i = 0; i < tempProfile.getSetpointCount(); i++) {
-                    auto sp = tempProfile.getSetpoint(i);
-                    profile.addSetpoint(sp.time, sp.temp, sp.fanSpeed);
-                }
+                installActiveProfile(tempProfile);
                 setActiveProfileId(id);
             }
             
@@ -284,25 +498,26 @@ public:
 
     // Load a profile into the global 'profile' object
     bool loadProfile(const String& id) {
-        if (!readProfile(id, profile)) {
+        RoastProfile loaded;
+        if (!readProfile(id, loaded)) {
             return false;
         }
 
+        installActiveProfile(loaded);
         return true;
     }
 
     bool getProfileSummary(const String& id, String& nameOut, int& finalTargetOut, bool& activeOut) {
-        RoastProfile tempProfile;
-        if (!readProfile(id, tempProfile)) {
+        IndexLock lock;
+        ensureIndex();
+        const ProfileSummary* entry = findIndexEntry(id);
+        if (entry == nullptr) {
             return false;
         }
 
-        if (!loadProfileMeta(id, nameOut) || nameOut.length() == 0) {
-            nameOut = id;
-        }
-
-        finalTargetOut = static_cast<int>(tempProfile.getFinalTargetTemp());
-        activeOut = (id == getActiveProfileId());
+        nameOut = entry->name;
+        finalTargetOut = entry->finalTarget;
+        activeOut = entry->active;
         return true;
     }
 
@@ -317,21 +532,27 @@ public:
 
         tempProfile.setFinalTargetTemp(finalTarget);
 
-        uint8_t buffer[200];
-        tempProfile.flattenProfile(buffer);
-        size_t len = 5 + (static_cast<size_t>(tempProfile.getSetpointCount()) * 12);
-        if (len > sizeof(buffer)) {
-            len = sizeof(buffer);
-        }
-
-        size_t written = preferences.putBytes(profileDataKey(id).c_str(), buffer, len);
+        std::vector<uint8_t> buffer;
+        size_t written = encodeProfile(tempProfile, buffer)
+                             ? profileStore.putBytes(profileDataKey(id).c_str(), buffer.data(), buffer.size())
+                             : 0;
         if (written == 0) {
             result.error = "nvs_write_failed";
             return result;
         }
 
+        {
+            IndexLock lock;
+            ensureIndex();
+            ProfileSummary* entry = findIndexEntry(id);
+            if (entry != nullptr) {
+                entry->finalTarget = static_cast<int>(tempProfile.getFinalTargetTemp());
+                touchIndex();
+            }
+        }
+
         if (id == getActiveProfileId()) {
-            profile = tempProfile;
+            installActiveProfile(tempProfile);
         }
 
         result.success = true;
@@ -346,9 +567,8 @@ public:
             return result;
         }
 
-        uint8_t buffer[200];
-        size_t len = preferences.getBytes(profileDataKey(sourceId).c_str(), buffer, sizeof(buffer));
-        if (len == 0) {
+        std::vector<uint8_t> buffer;
+        if (!readProfileBlob(sourceId, buffer)) {
             result.error = "not_found";
             return result;
         }
@@ -365,7 +585,7 @@ public:
         String duplicateId = generateId();
         result.id = duplicateId;
 
-        size_t written = preferences.putBytes(profileDataKey(duplicateId).c_str(), buffer, len);
+        size_t written = profileStore.putBytes(profileDataKey(duplicateId).c_str(), buffer.data(), buffer.size());
         if (written == 0) {
             result.error = "nvs_write_failed";
             return result;
@@ -373,31 +593,36 @@ public:
 
         saveProfileMeta(duplicateId, duplicateName);
 
-        auto ids = getProfileIds();
-        ids.push_back(duplicateId);
-        setProfileIds(ids);
+        {
+            IndexLock lock;
+            idIndex.append(duplicateId);
+            ensureIndex();
+            ProfileSummary* source = findIndexEntry(sourceId);
+            profileIndex.push_back(ProfileSummary{duplicateId, duplicateName, source ? source->finalTarget : 0,
+                                                  source ? source->setpointCount : 0, false});
+            touchIndex();
+        }
 
         result.success = true;
         return result;
     }
 
-    // Get JSON list of profiles
+    // Get JSON list of profiles, straight from the index
     String getProfilesList() {
-        DynamicJsonDocument doc(2048);
+        IndexLock lock;
+        ensureIndex();
+        DynamicJsonDocument doc(512 + profileIndex.size() * 160);
+        doc["active"] = indexActiveId; // Add active ID to root
+        doc["generation"] = indexGeneration;
         JsonArray arr = doc.createNestedArray("profiles");
         
-        String activeId = getActiveProfileId();
-        doc["active"] = activeId; // Add active ID to root
-        auto ids = getProfileIds();
-        
-        for (const auto& id : ids) {
-            String name;
-            if (loadProfileMeta(id, name)) {
-                JsonObject obj = arr.createNestedObject();
-                obj["id"] = id;
-                obj["name"] = name;
-                obj["active"] = (id == activeId);
-            }
+        for (const auto& entry : profileIndex) {
+            JsonObject obj = arr.createNestedObject();
+            obj["id"] = entry.id;
+            obj["name"] = entry.name;
+            obj["active"] = entry.active;
+            obj["finalTarget"] = entry.finalTarget;
+            obj["setpoints"] = entry.setpointCount;
         }
         
         String out;
@@ -407,30 +632,31 @@ public:
 
     // Get JSON for a specific profile
     String getProfile(const String& id) {
-        DynamicJsonDocument doc(1024);
+        RoastProfile temp;
+        bool found = readProfile(id, temp);
+        DynamicJsonDocument doc(profileJsonCapacity(temp.getSetpointCount()));
         
-        if (!profileExists(id)) {
+        if (!found) {
             doc["error"] = "not_found";
         } else {
-            uint8_t buffer[200];
-            preferences.getBytes(profileDataKey(id).c_str(), buffer, sizeof(buffer));
-            
-            RoastProfile temp;
-            temp.unflattenProfile(buffer);
-            
             String name;
             loadProfileMeta(id, name);
             
             doc["id"] = id;
             doc["name"] = name;
             doc["active"] = (id == getActiveProfileId());
+            doc["interpolation"] = temp.getInterpolationMode() == RoastProfile::INTERPOLATION_PCHIP ? "pchip" : "linear";
             
             JsonArray arr = doc.createNestedArray("setpoints");
             for (int i = 0; i < temp.getSetpointCount(); i++) {
                 auto sp = temp.getSetpoint(i);
                 if (sp.time == 0 && sp.temp == 0 && sp.fanSpeed == 0) continue;
                 JsonObject obj = arr.createNestedObject();
-                obj["time"] = sp.time / 1000;
+                if (sp.time % 1000 == 0) {
+                    obj["time"] = sp.time / 1000;
+                } else {
+                    obj["time"] = sp.time / 1000.0;
+                }
                 obj["temp"] = sp.temp;
                 obj["fanSpeed"] = sp.fanSpeed;
             }
@@ -448,14 +674,13 @@ public:
             return false;
         }
         
-        uint8_t buffer[200];
-        size_t len = preferences.getBytes(profileDataKey(id).c_str(), buffer, sizeof(buffer));
-        if (len == 0) {
+        RoastProfile loaded;
+        if (!readProfile(id, loaded)) {
             LOG_WARN("activateProfile: Failed to read profile data");
             return false;
         }
         
-        profile.unflattenProfile(buffer);
+        installActiveProfile(loaded);
         setActiveProfileId(id);
         LOG_INFOF("Profile %s activated successfully", id.c_str());
         return true;
@@ -474,34 +699,39 @@ public:
             return result;
         }
         
-        preferences.remove(profileDataKey(id).c_str());
-        preferences.remove(profileMetaKey(id).c_str());
+        profileStore.remove(profileDataKey(id).c_str());
+        profileStore.remove(profileMetaKey(id).c_str());
         
-        auto ids = getProfileIds();
-        for (auto it = ids.begin(); it != ids.end(); ) {
-            if (*it == id) it = ids.erase(it);
-            else ++it;
+        {
+            IndexLock lock;
+            idIndex.remove(id);
         }
-        setProfileIds(ids);
+        indexRemove(id);
         
         result.success = true;
         return result;
     }
 
     void deleteAllProfiles() {
-        auto ids = getProfileIds();
-        for (const auto& id : ids) {
-            preferences.remove(profileDataKey(id).c_str());
-            preferences.remove(profileMetaKey(id).c_str());
+        {
+            IndexLock lock;
+            for (const auto& id : idIndex.ids()) {
+                profileStore.remove(profileDataKey(id).c_str());
+                profileStore.remove(profileMetaKey(id).c_str());
+            }
+            idIndex.clear();
+            profileStore.remove("active_id");
+            profileIndex.clear();
+            indexActiveId = "";
+            indexLoaded = true;
+            touchIndex();
         }
-        preferences.remove("profile_ids");
-        preferences.remove("active_id");
+        ControlLock controlLock;
         profile.clearSetpoints();
     }
     
     void ensureDefault() {
-        auto ids = getProfileIds();
-        if (ids.empty()) {
+        if (getProfileIds().empty()) {
             LOG_INFO("Creating default profile...");
             String defaultJson = "{\"name\":\"Default\",\"activate\":true,\"setpoints\":[{\"time\":0,\"temp\":200,\"fanSpeed\":100},{\"time\":150,\"temp\":300,\"fanSpeed\":100},{\"time\":300,\"temp\":380,\"fanSpeed\":100},{\"time\":480,\"temp\":430,\"fanSpeed\":95}]}";
             saveProfile(defaultJson);
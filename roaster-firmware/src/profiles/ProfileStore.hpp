@@ -0,0 +1,140 @@
+#ifndef PROFILE_STORE_HPP
+#define PROFILE_STORE_HPP
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Where ProfileManager keeps profile blobs, their meta, the id index and the
+// active id. NVS is the default and needs no partition; LittleFS suits large
+// libraries but needs a firmware built with a partition scheme that has a
+// filesystem (tools/roaster-cli.sh does this for ROASTER_PROFILE_STORE=littlefs).
+#define ROASTER_PROFILE_STORE_NVS 1
+#define ROASTER_PROFILE_STORE_LITTLEFS 2
+
+#ifndef ROASTER_PROFILE_STORE
+#define ROASTER_PROFILE_STORE ROASTER_PROFILE_STORE_NVS
+#endif
+
+#if ROASTER_PROFILE_STORE == ROASTER_PROFILE_STORE_LITTLEFS
+
+#include <FS.h>
+#include <LittleFS.h>
+#include <vector>
+
+// The subset of the Preferences API ProfileManager uses, one file per key in
+// a directory on LittleFS. Writes go to a temporary file that is renamed
+// over the key, so a reset mid-write leaves the previous value.
+class FileStore {
+public:
+    // Mounts LittleFS (formatting it on first use) and opens /<name>.
+    bool begin(const char *name, bool readOnly = false) {
+        if (!LittleFS.begin(true)) {
+            return false;
+        }
+        directory = String("/") + name;
+        if (!LittleFS.exists(directory) && !LittleFS.mkdir(directory)) {
+            return false;
+        }
+        writable = !readOnly;
+        mounted = true;
+        return true;
+    }
+
+    void end() {
+        mounted = false;
+    }
+
+    size_t getBytesLength(const char *key) {
+        File file = open(key);
+        if (!file) return 0;
+        size_t length = file.size();
+        file.close();
+        return length;
+    }
+
+    // Like Preferences, reads nothing when the value does not fit.
+    size_t getBytes(const char *key, void *buffer, size_t maxLength) {
+        File file = open(key);
+        if (!file) return 0;
+        size_t length = file.size();
+        size_t read = length <= maxLength ? file.read(static_cast<uint8_t *>(buffer), length) : 0;
+        file.close();
+        return read;
+    }
+
+    size_t putBytes(const char *key, const void *value, size_t length) {
+        if (!mounted || !writable) return 0;
+        String target = path(key);
+        String temporary = target + ".tmp";
+        File file = LittleFS.open(temporary, FILE_WRITE);
+        if (!file) return 0;
+        size_t written = file.write(static_cast<const uint8_t *>(value), length);
+        file.close();
+        if (written != length || !LittleFS.rename(temporary, target)) {
+            LittleFS.remove(temporary);
+            return 0;
+        }
+        return length;
+    }
+
+    String getString(const char *key, const String defaultValue = String()) {
+        File file = open(key);
+        if (!file) return defaultValue;
+        String value = file.readString();
+        file.close();
+        return value;
+    }
+
+    // Returns the string length, so 0 for "" even when it was written
+    size_t putString(const char *key, const String &value) {
+        return putBytes(key, value.c_str(), value.length());
+    }
+
+    bool remove(const char *key) {
+        return mounted && writable && LittleFS.remove(path(key));
+    }
+
+    bool isKey(const char *key) {
+        return mounted && LittleFS.exists(path(key));
+    }
+
+    bool clear() {
+        if (!mounted || !writable) return false;
+        std::vector<String> paths;
+        File dir = LittleFS.open(directory);
+        for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+            if (!entry.isDirectory()) paths.push_back(String(entry.path()));
+            entry.close();
+        }
+        dir.close();
+        bool ok = true;
+        for (const auto &entry : paths) {
+            ok = LittleFS.remove(entry) && ok;
+        }
+        return ok;
+    }
+
+private:
+    String directory;
+    bool mounted = false;
+    bool writable = false;
+
+    String path(const char *key) const {
+        return directory + "/" + key;
+    }
+
+    File open(const char *key) {
+        if (!mounted || !isKey(key)) return File();
+        return LittleFS.open(path(key), FILE_READ);
+    }
+};
+
+typedef FileStore ProfileStore;
+
+#else
+
+typedef Preferences ProfileStore;
+
+#endif
+
+#endif // PROFILE_STORE_HPP
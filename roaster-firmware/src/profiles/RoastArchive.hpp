@@ -0,0 +1,893 @@
+#ifndef ROAST_ARCHIVE_HPP
+#define ROAST_ARCHIVE_HPP
+
+#include <Arduino.h>
+#include <algorithm>
+#include <vector>
+#include "../support/Crc32.hpp"
+#include "../support/JsonWriter.hpp"
+#include "../support/Varint.hpp"
+#include "../support/StaticMutex.hpp"
+
+#ifndef ROASTER_HOST_BUILD
+#include <FS.h>
+#include <LittleFS.h>
+#endif
+
+// Completed roasts kept on flash, one file per roast, whether or not a
+// SystemLink server is configured. A file is a fixed-size header followed by
+// the 1 Hz sample stream:
+//
+//   header   ROAST_ARCHIVE_HEADER_SIZE bytes, little-endian, see
+//            encodeRoastArchiveHeader(), ending in a CRC-32 of itself
+//   samples  per sample: varint seconds since the previous sample, then
+//            zigzag varint deltas of bean, target, heater, fan temperature
+//            and fan speed (tenths) from the previous sample
+//
+// A 15 minute roast is about 5 KB. The header is written when the roast
+// starts and rewritten when it ends; samples are appended in
+// ROAST_ARCHIVE_FLUSH_BYTES chunks in between, so a reset mid-roast loses
+// at most that much and the roast is kept as "interrupted" at the next boot.
+//
+// Opt-in with ROASTER_ROAST_ARCHIVE=1 (tools/roaster-cli.sh then picks a
+// partition scheme with a filesystem); otherwise begin() is never called and
+// nothing is recorded.
+#ifndef ROASTER_ROAST_ARCHIVE
+#define ROASTER_ROAST_ARCHIVE 0
+#endif
+
+static constexpr uint8_t ROAST_ARCHIVE_VERSION = 1;
+static constexpr size_t ROAST_ARCHIVE_PROFILE_ID_MAX = 16;
+static constexpr size_t ROAST_ARCHIVE_PROFILE_NAME_MAX = 64;
+static constexpr size_t ROAST_ARCHIVE_REASON_MAX = 32;
+static constexpr size_t ROAST_ARCHIVE_HEADER_SIZE =
+    4 + 4 + 6 * 4 + 3 * 4 + 4 + ROAST_ARCHIVE_PROFILE_ID_MAX + ROAST_ARCHIVE_PROFILE_NAME_MAX +
+    ROAST_ARCHIVE_REASON_MAX + 4;
+// Seconds, then five 16-bit deltas of at most three bytes each
+static constexpr size_t ROAST_ARCHIVE_MAX_SAMPLE_BYTES = 5 + 5 * 3;
+static constexpr size_t ROAST_ARCHIVE_FLUSH_BYTES = 256;
+// Two hours at 1 Hz; later samples are dropped and the roast flagged truncated
+static constexpr uint32_t ROAST_ARCHIVE_MAX_SAMPLES = 7200;
+
+static constexpr uint8_t ROAST_ARCHIVE_FLAG_TRUNCATED = 0x01;
+
+enum RoastArchiveOutcome : uint8_t {
+    ROAST_ARCHIVE_RECORDING = 0,
+    ROAST_ARCHIVE_PASSED,
+    ROAST_ARCHIVE_TERMINATED,
+    ROAST_ARCHIVE_ERRORED,
+    ROAST_ARCHIVE_INTERRUPTED,  // Still recording when the controller reset
+};
+
+inline const char* roastArchiveOutcomeName(uint8_t outcome) {
+    switch (outcome) {
+        case ROAST_ARCHIVE_RECORDING: return "recording";
+        case ROAST_ARCHIVE_PASSED: return "passed";
+        case ROAST_ARCHIVE_TERMINATED: return "terminated";
+        case ROAST_ARCHIVE_ERRORED: return "errored";
+        case ROAST_ARCHIVE_INTERRUPTED: return "interrupted";
+        default: return "unknown";
+    }
+}
+
+// One 1 Hz sample in the units of the SystemLink trace: tenths of a degree F
+// and tenths of the 0-255 heater and fan commands.
+struct RoastArchiveSample {
+    uint32_t elapsedSeconds;
+    int16_t beanTenthsF;
+    int16_t targetTenthsF;
+    int16_t heaterTenths;
+    int16_t fanTempTenthsF;
+    int16_t fanTenths;
+};
+
+struct RoastArchiveHeader {
+    uint32_t id = 0;
+    uint8_t outcome = ROAST_ARCHIVE_RECORDING;
+    uint8_t flags = 0;
+    uint32_t startedAt = 0;         // Unix time, 0 when the clock was not set
+    uint32_t durationSeconds = 0;
+    uint32_t sampleCount = 0;
+    uint32_t streamBytes = 0;       // Sample bytes after the header
+    uint32_t streamCrc = 0;         // CRC-32 of those bytes
+    uint32_t finalTargetTempF = 0;
+    float kp = 0;
+    float ki = 0;
+    float kd = 0;
+    char profileId[ROAST_ARCHIVE_PROFILE_ID_MAX] = {};
+    char profileName[ROAST_ARCHIVE_PROFILE_NAME_MAX] = {};
+    char reason[ROAST_ARCHIVE_REASON_MAX] = {};
+};
+
+inline void roastArchiveCopyString(char* out, size_t capacity, const char* value) {
+    if (capacity == 0) return;
+    size_t length = value != nullptr ? strnlen(value, capacity - 1) : 0;
+    if (length > 0) memcpy(out, value, length);
+    memset(out + length, 0, capacity - length);
+}
+
+inline void encodeRoastArchiveHeader(const RoastArchiveHeader& header, uint8_t* out) {
+    uint8_t* p = out;
+    auto put32 = [&p](uint32_t value) {
+        for (uint8_t shift = 0; shift < 32; shift += 8) {
+            *p++ = static_cast<uint8_t>(value >> shift);
+        }
+    };
+    auto putFloat = [&put32](float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        put32(bits);
+    };
+    *p++ = 'R';
+    *p++ = 'O';
+    *p++ = 'A';
+    *p++ = 'S';
+    *p++ = ROAST_ARCHIVE_VERSION;
+    *p++ = header.outcome;
+    *p++ = header.flags;
+    *p++ = 0;
+    put32(header.id);
+    put32(header.startedAt);
+    put32(header.durationSeconds);
+    put32(header.sampleCount);
+    put32(header.streamBytes);
+    put32(header.streamCrc);
+    putFloat(header.kp);
+    putFloat(header.ki);
+    putFloat(header.kd);
+    put32(header.finalTargetTempF);
+    memcpy(p, header.profileId, ROAST_ARCHIVE_PROFILE_ID_MAX);
+    p += ROAST_ARCHIVE_PROFILE_ID_MAX;
+    memcpy(p, header.profileName, ROAST_ARCHIVE_PROFILE_NAME_MAX);
+    p += ROAST_ARCHIVE_PROFILE_NAME_MAX;
+    memcpy(p, header.reason, ROAST_ARCHIVE_REASON_MAX);
+    p += ROAST_ARCHIVE_REASON_MAX;
+    put32(crc32(out, p - out));
+}
+
+// Fails on a wrong magic, version or CRC, which is also what a header torn
+// by a concurrent rewrite looks like.
+inline bool decodeRoastArchiveHeader(const uint8_t* in, size_t length, RoastArchiveHeader& header) {
+    if (length < ROAST_ARCHIVE_HEADER_SIZE || memcmp(in, "ROAS", 4) != 0 || in[4] != ROAST_ARCHIVE_VERSION) {
+        return false;
+    }
+    const uint8_t* p = in;
+    auto get32 = [&p]() {
+        uint32_t value = 0;
+        for (uint8_t shift = 0; shift < 32; shift += 8) {
+            value |= static_cast<uint32_t>(*p++) << shift;
+        }
+        return value;
+    };
+    auto getFloat = [&get32]() {
+        uint32_t bits = get32();
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    };
+    p = in + ROAST_ARCHIVE_HEADER_SIZE - 4;
+    if (get32() != crc32(in, ROAST_ARCHIVE_HEADER_SIZE - 4)) {
+        return false;
+    }
+    p = in + 5;
+    header.outcome = *p++;
+    header.flags = *p++;
+    p++;
+    header.id = get32();
+    header.startedAt = get32();
+    header.durationSeconds = get32();
+    header.sampleCount = get32();
+    header.streamBytes = get32();
+    header.streamCrc = get32();
+    header.kp = getFloat();
+    header.ki = getFloat();
+    header.kd = getFloat();
+    header.finalTargetTempF = get32();
+    memcpy(header.profileId, p, ROAST_ARCHIVE_PROFILE_ID_MAX);
+    p += ROAST_ARCHIVE_PROFILE_ID_MAX;
+    memcpy(header.profileName, p, ROAST_ARCHIVE_PROFILE_NAME_MAX);
+    p += ROAST_ARCHIVE_PROFILE_NAME_MAX;
+    memcpy(header.reason, p, ROAST_ARCHIVE_REASON_MAX);
+    header.profileId[ROAST_ARCHIVE_PROFILE_ID_MAX - 1] = '\0';
+    header.profileName[ROAST_ARCHIVE_PROFILE_NAME_MAX - 1] = '\0';
+    header.reason[ROAST_ARCHIVE_REASON_MAX - 1] = '\0';
+    return true;
+}
+
+// Delta coding of the sample stream. Both sides start from an all-zero
+// previous sample, so the first sample is stored whole.
+class RoastSampleCodec {
+public:
+    // Writes one sample (at most ROAST_ARCHIVE_MAX_SAMPLE_BYTES) and returns
+    // the byte after it. Samples must not go back in time.
+    uint8_t* encode(const RoastArchiveSample& sample, uint8_t* out) {
+        uint32_t seconds = sample.elapsedSeconds > previous.elapsedSeconds
+                               ? sample.elapsedSeconds - previous.elapsedSeconds
+                               : 0;
+        out = writeVarint(out, seconds);
+        out = writeVarint(out, zigzagEncode((int64_t)sample.beanTenthsF - previous.beanTenthsF));
+        out = writeVarint(out, zigzagEncode((int64_t)sample.targetTenthsF - previous.targetTenthsF));
+        out = writeVarint(out, zigzagEncode((int64_t)sample.heaterTenths - previous.heaterTenths));
+        out = writeVarint(out, zigzagEncode((int64_t)sample.fanTempTenthsF - previous.fanTempTenthsF));
+        out = writeVarint(out, zigzagEncode((int64_t)sample.fanTenths - previous.fanTenths));
+        uint32_t elapsed = previous.elapsedSeconds + seconds;
+        previous = sample;
+        previous.elapsedSeconds = elapsed;
+        return out;
+    }
+
+    // Reads one sample and advances `cursor` past it. Leaves `cursor` where it
+    // was when the sample is incomplete, so the caller can read more and
+    // retry.
+    bool decode(const uint8_t*& cursor, const uint8_t* end, RoastArchiveSample& sample) {
+        const uint8_t* p = cursor;
+        uint64_t values[6];
+        for (uint64_t& value : values) {
+            if (!readVarint(p, end, value)) return false;
+        }
+        sample.elapsedSeconds = previous.elapsedSeconds + static_cast<uint32_t>(values[0]);
+        sample.beanTenthsF = static_cast<int16_t>(previous.beanTenthsF + zigzagDecode(values[1]));
+        sample.targetTenthsF = static_cast<int16_t>(previous.targetTenthsF + zigzagDecode(values[2]));
+        sample.heaterTenths = static_cast<int16_t>(previous.heaterTenths + zigzagDecode(values[3]));
+        sample.fanTempTenthsF = static_cast<int16_t>(previous.fanTempTenthsF + zigzagDecode(values[4]));
+        sample.fanTenths = static_cast<int16_t>(previous.fanTenths + zigzagDecode(values[5]));
+        previous = sample;
+        cursor = p;
+        return true;
+    }
+
+private:
+    RoastArchiveSample previous = {};
+};
+
+// Where the archive keeps its files. LittleFsRoastFiles on the device; the
+// tests use one in RAM.
+class RoastArchiveFiles {
+public:
+    virtual ~RoastArchiveFiles() {}
+    virtual bool begin() = 0;
+    // Ids of every roast file, in no particular order
+    virtual void list(std::vector<uint32_t>& ids) = 0;
+    virtual size_t size(uint32_t id) = 0;
+    virtual size_t read(uint32_t id, size_t offset, uint8_t* out, size_t length) = 0;
+    // Replaces the file
+    virtual bool create(uint32_t id, const uint8_t* data, size_t length) = 0;
+    virtual bool append(uint32_t id, const uint8_t* data, size_t length) = 0;
+    // Overwrites bytes of an existing file in place
+    virtual bool overwrite(uint32_t id, size_t offset, const uint8_t* data, size_t length) = 0;
+    virtual bool remove(uint32_t id) = 0;
+};
+
+// Reads a roast file a window at a time: the header, then samples one by
+// one, so a roast of any length needs the same few hundred bytes.
+class RoastArchiveReader {
+public:
+    static constexpr size_t WINDOW_SIZE = 256;
+
+    // False when the file is missing or its header does not check out. A
+    // roast still recording is read up to what has been flushed.
+    bool open(RoastArchiveFiles& storage, uint32_t id) {
+        files = &storage;
+        roastId = id;
+        uint8_t raw[ROAST_ARCHIVE_HEADER_SIZE];
+        if (files->read(id, 0, raw, sizeof(raw)) != sizeof(raw) || !decodeRoastArchiveHeader(raw, sizeof(raw), header)) {
+            return false;
+        }
+        size_t fileSize = files->size(id);
+        streamEnd = header.outcome == ROAST_ARCHIVE_RECORDING || header.outcome == ROAST_ARCHIVE_INTERRUPTED
+                        ? fileSize
+                        : std::min(fileSize, ROAST_ARCHIVE_HEADER_SIZE + static_cast<size_t>(header.streamBytes));
+        fileOffset = ROAST_ARCHIVE_HEADER_SIZE;
+        windowStart = 0;
+        windowLength = 0;
+        consumedBytes = 0;
+        crc = 0;
+        codec = RoastSampleCodec();
+        return true;
+    }
+
+    const RoastArchiveHeader& getHeader() const { return header; }
+
+    // False at the end of the stream, and at a truncated or corrupt sample
+    bool next(RoastArchiveSample& sample) {
+        if (windowLength - windowStart < ROAST_ARCHIVE_MAX_SAMPLE_BYTES) {
+            refill();
+        }
+        const uint8_t* cursor = window + windowStart;
+        const uint8_t* start = cursor;
+        if (!codec.decode(cursor, window + windowLength, sample)) {
+            return false;
+        }
+        size_t used = cursor - start;
+        crc = crc32Update(crc, start, used);
+        windowStart += used;
+        consumedBytes += used;
+        return true;
+    }
+
+    // Bytes of complete samples read so far, and their CRC-32
+    size_t consumed() const { return consumedBytes; }
+    uint32_t consumedCrc() const { return crc; }
+
+private:
+    RoastArchiveFiles* files = nullptr;
+    uint32_t roastId = 0;
+    RoastArchiveHeader header;
+    RoastSampleCodec codec;
+    uint8_t window[WINDOW_SIZE];
+    size_t windowStart = 0;
+    size_t windowLength = 0;
+    size_t fileOffset = 0;
+    size_t streamEnd = 0;
+    size_t consumedBytes = 0;
+    uint32_t crc = 0;
+
+    void refill() {
+        size_t remaining = windowLength - windowStart;
+        memmove(window, window + windowStart, remaining);
+        windowStart = 0;
+        windowLength = remaining;
+        if (fileOffset >= streamEnd) return;
+        size_t want = std::min(WINDOW_SIZE - windowLength, streamEnd - fileOffset);
+        size_t got = files->read(roastId, fileOffset, window + windowLength, want);
+        fileOffset += got;
+        windowLength += got;
+        if (got < want) {
+            streamEnd = fileOffset;  // Shrunk or removed under us
+        }
+    }
+};
+
+// Records the current roast and keeps the newest roasts within `maxRoasts`
+// files and `maxBytes` of flash, removing the oldest first. Recording is
+// driven from loop(); listing and export run on the web server task, so the
+// id index is guarded by a lock.
+class RoastArchive {
+public:
+    static constexpr size_t DEFAULT_MAX_ROASTS = 40;
+    static constexpr size_t DEFAULT_MAX_BYTES = 384 * 1024;
+
+    struct Entry {
+        uint32_t id;
+        uint32_t bytes;
+    };
+
+    RoastArchive(RoastArchiveFiles& files, size_t maxRoasts = DEFAULT_MAX_ROASTS, size_t maxBytes = DEFAULT_MAX_BYTES)
+        : files(files), maxRoasts(maxRoasts), maxBytes(maxBytes) {}
+
+    // Indexes the saved roasts and closes out any that were still recording
+    // when the controller reset. False when there is no storage, in which
+    // case nothing is recorded.
+    bool begin() {
+        available = files.begin();
+        if (!available) return false;
+        std::vector<uint32_t> ids;
+        files.list(ids);
+        std::sort(ids.begin(), ids.end());
+        std::vector<Entry> found;
+        for (uint32_t id : ids) {
+            recoverIfInterrupted(id);
+            found.push_back(Entry{id, static_cast<uint32_t>(files.size(id))});
+        }
+        Lock lock;
+        entries = found;
+        nextId = entries.empty() ? 1 : entries.back().id + 1;
+        return true;
+    }
+
+    bool isAvailable() const { return available; }
+    bool isRecording() const { return recording; }
+    // Safe from other tasks, unlike isRecording(); 0 when not recording
+    uint32_t currentId() {
+        Lock lock;
+        return recordingId;
+    }
+    size_t getMaxRoasts() const { return maxRoasts; }
+    size_t getMaxBytes() const { return maxBytes; }
+    RoastArchiveFiles& storage() { return files; }
+
+    // Starts a new roast file from `info` (profile, gains, start time),
+    // making room for it first. A roast still recording is finished as
+    // interrupted.
+    bool startRoast(const RoastArchiveHeader& info) {
+        if (!available) return false;
+        if (recording) finishRoast(ROAST_ARCHIVE_INTERRUPTED, "restarted");
+
+        header = info;
+        header.outcome = ROAST_ARCHIVE_RECORDING;
+        header.flags = 0;
+        header.durationSeconds = 0;
+        header.sampleCount = 0;
+        header.streamBytes = 0;
+        header.streamCrc = 0;
+        header.reason[0] = '\0';
+        {
+            Lock lock;
+            header.id = nextId++;
+        }
+        enforceRetention(1, ROAST_ARCHIVE_HEADER_SIZE);
+
+        uint8_t raw[ROAST_ARCHIVE_HEADER_SIZE];
+        encodeRoastArchiveHeader(header, raw);
+        if (!files.create(header.id, raw, sizeof(raw))) {
+            return false;
+        }
+        {
+            Lock lock;
+            entries.push_back(Entry{header.id, static_cast<uint32_t>(ROAST_ARCHIVE_HEADER_SIZE)});
+            recordingId = header.id;
+        }
+        codec = RoastSampleCodec();
+        pendingLength = 0;
+        recording = true;
+        return true;
+    }
+
+    void recordSample(const RoastArchiveSample& sample) {
+        if (!recording) return;
+        if (header.sampleCount >= ROAST_ARCHIVE_MAX_SAMPLES) {
+            header.flags |= ROAST_ARCHIVE_FLAG_TRUNCATED;
+            return;
+        }
+        uint8_t* end = codec.encode(sample, pending + pendingLength);
+        size_t length = end - (pending + pendingLength);
+        header.streamCrc = crc32Update(header.streamCrc, pending + pendingLength, length);
+        pendingLength += length;
+        header.streamBytes += length;
+        header.sampleCount++;
+        header.durationSeconds = sample.elapsedSeconds;
+        if (pendingLength >= ROAST_ARCHIVE_FLUSH_BYTES) {
+            flush();
+        }
+    }
+
+    // Keeps the most serious outcome seen, like the SystemLink record:
+    // errored over terminated over passed.
+    void noteOutcome(RoastArchiveOutcome outcome, const char* reason) {
+        if (!recording || outcome == ROAST_ARCHIVE_RECORDING || outcome < header.outcome) return;
+        header.outcome = outcome;
+        if (reason != nullptr && reason[0] != '\0') {
+            roastArchiveCopyString(header.reason, sizeof(header.reason), reason);
+        }
+    }
+
+    // Writes the last samples and the final header. A roast that ends with
+    // no outcome noted counts as passed.
+    bool finishRoast(RoastArchiveOutcome outcome, const char* reason) {
+        if (!recording) return false;
+        noteOutcome(outcome, reason);
+        if (header.outcome == ROAST_ARCHIVE_RECORDING) {
+            header.outcome = ROAST_ARCHIVE_PASSED;
+            roastArchiveCopyString(header.reason, sizeof(header.reason), reason);
+        }
+        recording = false;
+        bool ok = flush();
+        uint8_t raw[ROAST_ARCHIVE_HEADER_SIZE];
+        encodeRoastArchiveHeader(header, raw);
+        ok = files.overwrite(header.id, 0, raw, sizeof(raw)) && ok;
+        {
+            Lock lock;
+            recordingId = 0;
+        }
+        enforceRetention(0, 0);
+        return ok;
+    }
+
+    // Oldest first
+    std::vector<Entry> snapshot() {
+        Lock lock;
+        return entries;
+    }
+
+    size_t totalBytes() {
+        Lock lock;
+        size_t total = 0;
+        for (const Entry& entry : entries) total += entry.bytes;
+        return total;
+    }
+
+    // The roast being recorded cannot be removed. Called from web handlers
+    // while loop() starts and finishes roasts, so the check is made under
+    // the lock against recordingId rather than `recording` and `header`.
+    bool remove(uint32_t id) {
+        {
+            Lock lock;
+            if (id == recordingId) return false;
+            auto it = std::find_if(entries.begin(), entries.end(), [id](const Entry& entry) { return entry.id == id; });
+            if (it == entries.end()) return false;
+            entries.erase(it);
+        }
+        return files.remove(id);
+    }
+
+    bool contains(uint32_t id) {
+        Lock lock;
+        for (const Entry& entry : entries) {
+            if (entry.id == id) return true;
+        }
+        return false;
+    }
+
+private:
+    using Lock = StaticMutexLock<RoastArchive>;
+
+    RoastArchiveFiles& files;
+    size_t maxRoasts;
+    size_t maxBytes;
+    bool available = false;
+    bool recording = false;
+    uint32_t recordingId = 0;    // Under Lock: the file startRoast created until finishRoast has written it
+    std::vector<Entry> entries;  // Oldest first
+    uint32_t nextId = 1;
+    RoastArchiveHeader header;
+    RoastSampleCodec codec;
+    uint8_t pending[ROAST_ARCHIVE_FLUSH_BYTES + ROAST_ARCHIVE_MAX_SAMPLE_BYTES];
+    size_t pendingLength = 0;
+
+    bool flush() {
+        if (pendingLength == 0) return true;
+        bool ok = files.append(header.id, pending, pendingLength);
+        if (!ok) {
+            // Keep going; the header still counts what was recorded, and the
+            // reader stops at the end of what made it to flash.
+            header.flags |= ROAST_ARCHIVE_FLAG_TRUNCATED;
+        }
+        pendingLength = 0;
+        Lock lock;
+        for (Entry& entry : entries) {
+            if (entry.id == header.id) entry.bytes = static_cast<uint32_t>(files.size(header.id));
+        }
+        return ok;
+    }
+
+    // Removes the oldest roasts until `extraRoasts` more files of
+    // `extraBytes` would fit. The newest roast is kept even when it alone is
+    // over the byte budget.
+    void enforceRetention(size_t extraRoasts, size_t extraBytes) {
+        while (true) {
+            uint32_t victim = 0;
+            {
+                Lock lock;
+                size_t total = extraBytes;
+                for (const Entry& entry : entries) total += entry.bytes;
+                bool over = entries.size() + extraRoasts > maxRoasts || total > maxBytes;
+                if (!over || entries.empty() || (extraRoasts == 0 && entries.size() == 1)) return;
+                victim = entries.front().id;
+                entries.erase(entries.begin());
+            }
+            files.remove(victim);
+        }
+    }
+
+    // A roast still marked recording at boot was cut off by a reset. Count
+    // what made it to flash and mark it interrupted.
+    void recoverIfInterrupted(uint32_t id) {
+        RoastArchiveReader reader;
+        if (!reader.open(files, id) || reader.getHeader().outcome != ROAST_ARCHIVE_RECORDING) {
+            return;
+        }
+        RoastArchiveHeader recovered = reader.getHeader();
+        RoastArchiveSample sample;
+        uint32_t count = 0;
+        while (reader.next(sample)) {
+            count++;
+            recovered.durationSeconds = sample.elapsedSeconds;
+        }
+        recovered.outcome = ROAST_ARCHIVE_INTERRUPTED;
+        recovered.sampleCount = count;
+        recovered.streamBytes = static_cast<uint32_t>(reader.consumed());
+        recovered.streamCrc = reader.consumedCrc();
+        roastArchiveCopyString(recovered.reason, sizeof(recovered.reason), "controller_reset");
+        uint8_t raw[ROAST_ARCHIVE_HEADER_SIZE];
+        encodeRoastArchiveHeader(recovered, raw);
+        files.overwrite(id, 0, raw, sizeof(raw));
+    }
+};
+
+// Writes `tenths` as a decimal with one place and a whole number without
+// one, as JsonWriter prints: -15 as "-1.5", 2550 as "255"
+inline size_t roastArchiveFormatTenths(char* out, size_t capacity, int32_t tenths) {
+    uint32_t magnitude = tenths < 0 ? 0u - static_cast<uint32_t>(tenths) : static_cast<uint32_t>(tenths);
+    const char* sign = tenths < 0 ? "-" : "";
+    unsigned long whole = magnitude / 10;
+    unsigned long fraction = magnitude % 10;
+    int written = fraction == 0 ? snprintf(out, capacity, "%s%lu", sign, whole)
+                                : snprintf(out, capacity, "%s%lu.%lu", sign, whole, fraction);
+    return written > 0 ? std::min(static_cast<size_t>(written), capacity - 1) : 0;
+}
+
+// Streams one roast as CSV or JSON. read() fills the buffer an
+// AsyncWebServer chunked response hands it and returns 0 at the end; only
+// the reader's window and one rendered row are held at a time.
+class RoastArchiveExporter {
+public:
+    enum Format : uint8_t {
+        FORMAT_CSV,
+        FORMAT_JSON,
+    };
+
+    static constexpr const char* CSV_COLUMNS = "seconds,bean_f,target_f,heater,fan_temp_f,fan";
+
+    RoastArchiveExporter(RoastArchiveFiles& files, uint32_t id, Format format) : format(format) {
+        opened = reader.open(files, id);
+    }
+
+    bool isOpen() const { return opened; }
+    const RoastArchiveHeader& getHeader() const { return reader.getHeader(); }
+    size_t exportedSamples() const { return samples; }
+
+    size_t read(uint8_t* out, size_t maxLen) {
+        size_t written = 0;
+        while (written < maxLen) {
+            if (offset == textLength && !produce()) {
+                break;
+            }
+            size_t step = std::min(textLength - offset, maxLen - written);
+            memcpy(out + written, text + offset, step);
+            offset += step;
+            written += step;
+        }
+        return written;
+    }
+
+private:
+    enum Stage : uint8_t {
+        STAGE_PREAMBLE,
+        STAGE_ROWS,
+        STAGE_DONE,
+    };
+
+    RoastArchiveReader reader;
+    Format format;
+    bool opened = false;
+    Stage stage = STAGE_PREAMBLE;
+    size_t samples = 0;
+    // Fits the JSON preamble with a profile name of escaped control characters
+    char text[512];
+    size_t textLength = 0;
+    size_t offset = 0;
+
+    bool produce() {
+        offset = 0;
+        textLength = 0;
+        if (!opened || stage == STAGE_DONE) {
+            return false;
+        }
+        if (stage == STAGE_PREAMBLE) {
+            renderPreamble();
+            stage = STAGE_ROWS;
+            return true;
+        }
+        RoastArchiveSample sample;
+        if (reader.next(sample)) {
+            renderRow(sample);
+        } else {
+            if (format == FORMAT_JSON) {
+                textLength = static_cast<size_t>(snprintf(text, sizeof(text), "]}"));
+            }
+            stage = STAGE_DONE;
+        }
+        return true;
+    }
+
+    void renderPreamble() {
+        if (format == FORMAT_CSV) {
+            textLength = static_cast<size_t>(snprintf(text, sizeof(text), "%s\n", CSV_COLUMNS));
+            return;
+        }
+        const RoastArchiveHeader& header = reader.getHeader();
+        JsonWriter json(text, sizeof(text));
+        json.beginObject();
+        json.fieldUInt("id", header.id);
+        json.fieldString("profileId", header.profileId);
+        json.fieldString("profileName", header.profileName);
+        json.fieldString("outcome", roastArchiveOutcomeName(header.outcome));
+        json.fieldString("reason", header.reason);
+        json.fieldUInt("startedAt", header.startedAt);
+        json.fieldUInt("durationSeconds", header.durationSeconds);
+        json.fieldUInt("sampleCount", header.sampleCount);
+        json.fieldBool("truncated", (header.flags & ROAST_ARCHIVE_FLAG_TRUNCATED) != 0);
+        json.fieldUInt("finalTargetTempF", header.finalTargetTempF);
+        json.fieldFixed("kp", header.kp, 4);
+        json.fieldFixed("ki", header.ki, 4);
+        json.fieldFixed("kd", header.kd, 4);
+        json.beginArray("columns");
+        json.elementString("seconds");
+        json.elementString("beanTempF");
+        json.elementString("targetTempF");
+        json.elementString("heater");
+        json.elementString("fanTempF");
+        json.elementString("fan");
+        json.endArray();
+        json.beginArray("samples");
+        textLength = json.length();
+    }
+
+    // "12,201.5,203,180.5,310.2,255\n" or "[12,201.5,203,180.5,310.2,255]"
+    void renderRow(const RoastArchiveSample& sample) {
+        size_t used = 0;
+        if (format == FORMAT_JSON) {
+            if (samples > 0) text[used++] = ',';
+            text[used++] = '[';
+        }
+        used += snprintf(text + used, sizeof(text) - used, "%lu", static_cast<unsigned long>(sample.elapsedSeconds));
+        const int16_t values[] = {sample.beanTenthsF, sample.targetTenthsF, sample.heaterTenths,
+                                  sample.fanTempTenthsF, sample.fanTenths};
+        for (int16_t value : values) {
+            text[used++] = ',';
+            used += roastArchiveFormatTenths(text + used, sizeof(text) - used, value);
+        }
+        if (format == FORMAT_JSON) {
+            text[used++] = ']';
+        } else {
+            text[used++] = '\n';
+        }
+        textLength = used;
+        samples++;
+    }
+};
+
+// Streams the roast index, newest first, as
+//   {"roasts":[{header fields, "bytes":n}, ...],"bytes":n,"maxRoasts":n,"maxBytes":n}
+// reading one header at a time.
+class RoastArchiveListing {
+public:
+    explicit RoastArchiveListing(RoastArchive& archive) : archive(archive), entries(archive.snapshot()) {}
+
+    size_t read(uint8_t* out, size_t maxLen) {
+        size_t written = 0;
+        while (written < maxLen) {
+            if (offset == textLength && !produce()) {
+                break;
+            }
+            size_t step = std::min(textLength - offset, maxLen - written);
+            memcpy(out + written, text + offset, step);
+            offset += step;
+            written += step;
+        }
+        return written;
+    }
+
+    size_t listedCount() const { return listed; }
+
+private:
+    RoastArchive& archive;
+    std::vector<RoastArchive::Entry> entries;
+    size_t next = 0;
+    size_t listed = 0;
+    bool started = false;
+    bool finished = false;
+    char text[512];
+    size_t textLength = 0;
+    size_t offset = 0;
+
+    bool produce() {
+        offset = 0;
+        textLength = 0;
+        if (finished) return false;
+        if (!started) {
+            started = true;
+            textLength = static_cast<size_t>(snprintf(text, sizeof(text), "{\"roasts\":["));
+            return true;
+        }
+        while (next < entries.size()) {
+            const RoastArchive::Entry& entry = entries[entries.size() - 1 - next++];
+            RoastArchiveReader reader;
+            if (!reader.open(archive.storage(), entry.id)) {
+                continue;  // Removed since the listing started
+            }
+            renderEntry(reader.getHeader(), archive.storage().size(entry.id));
+            return true;
+        }
+        finished = true;
+        textLength = static_cast<size_t>(snprintf(text, sizeof(text), "],\"bytes\":%lu,\"maxRoasts\":%lu,\"maxBytes\":%lu}",
+                                                  static_cast<unsigned long>(archive.totalBytes()),
+                                                  static_cast<unsigned long>(archive.getMaxRoasts()),
+                                                  static_cast<unsigned long>(archive.getMaxBytes())));
+        return true;
+    }
+
+    void renderEntry(const RoastArchiveHeader& header, size_t bytes) {
+        size_t used = 0;
+        if (listed > 0) text[used++] = ',';
+        JsonWriter json(text + used, sizeof(text) - used);
+        json.beginObject();
+        json.fieldUInt("id", header.id);
+        json.fieldString("profileId", header.profileId);
+        json.fieldString("profileName", header.profileName);
+        json.fieldString("outcome", roastArchiveOutcomeName(header.outcome));
+        json.fieldString("reason", header.reason);
+        json.fieldUInt("startedAt", header.startedAt);
+        json.fieldUInt("durationSeconds", header.durationSeconds);
+        json.fieldUInt("sampleCount", header.sampleCount);
+        json.fieldBool("truncated", (header.flags & ROAST_ARCHIVE_FLAG_TRUNCATED) != 0);
+        json.fieldUInt("finalTargetTempF", header.finalTargetTempF);
+        json.fieldFixed("kp", header.kp, 4);
+        json.fieldFixed("ki", header.ki, 4);
+        json.fieldFixed("kd", header.kd, 4);
+        json.fieldUInt("bytes", bytes);
+        json.endObject();
+        textLength = used + json.length();
+        listed++;
+    }
+};
+
+#ifndef ROASTER_HOST_BUILD
+
+// Roast files as /roasts/<id>.bin on LittleFS. Needs a partition scheme with
+// a filesystem; on a no_fs build begin() fails and nothing is recorded.
+class LittleFsRoastFiles : public RoastArchiveFiles {
+public:
+    bool begin() override {
+        if (!LittleFS.begin(true)) {
+            return false;
+        }
+        return LittleFS.exists(DIRECTORY) || LittleFS.mkdir(DIRECTORY);
+    }
+
+    void list(std::vector<uint32_t>& ids) override {
+        File dir = LittleFS.open(DIRECTORY);
+        if (!dir) return;
+        for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+            const char* name = entry.name();
+            char* end = nullptr;
+            unsigned long id = strtoul(name, &end, 10);
+            if (!entry.isDirectory() && end != name && strcmp(end, ".bin") == 0 && id > 0) {
+                ids.push_back(static_cast<uint32_t>(id));
+            }
+            entry.close();
+        }
+        dir.close();
+    }
+
+    size_t size(uint32_t id) override {
+        File file = LittleFS.open(path(id), FILE_READ);
+        if (!file) return 0;
+        size_t length = file.size();
+        file.close();
+        return length;
+    }
+
+    size_t read(uint32_t id, size_t offset, uint8_t* out, size_t length) override {
+        File file = LittleFS.open(path(id), FILE_READ);
+        if (!file) return 0;
+        size_t got = file.seek(offset) ? file.read(out, length) : 0;
+        file.close();
+        return got;
+    }
+
+    bool create(uint32_t id, const uint8_t* data, size_t length) override {
+        return writeWith(id, FILE_WRITE, 0, data, length);
+    }
+
+    bool append(uint32_t id, const uint8_t* data, size_t length) override {
+        return writeWith(id, FILE_APPEND, 0, data, length);
+    }
+
+    bool overwrite(uint32_t id, size_t offset, const uint8_t* data, size_t length) override {
+        return writeWith(id, "r+", offset, data, length);
+    }
+
+    bool remove(uint32_t id) override {
+        return LittleFS.remove(path(id));
+    }
+
+private:
+    static constexpr const char* DIRECTORY = "/roasts";
+
+    static String path(uint32_t id) {
+        return String(DIRECTORY) + "/" + String(static_cast<unsigned long>(id)) + ".bin";
+    }
+
+    bool writeWith(uint32_t id, const char* mode, size_t offset, const uint8_t* data, size_t length) {
+        File file = LittleFS.open(path(id), mode);
+        if (!file) return false;
+        bool ok = (offset == 0 || file.seek(offset)) && file.write(data, length) == length;
+        file.close();
+        return ok;
+    }
+};
+
+#endif
+
+#endif // ROAST_ARCHIVE_HPP
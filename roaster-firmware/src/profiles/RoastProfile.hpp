@@ -2,10 +2,25 @@
 #define ROAST_PROFILE_HPP
 
 #include <stdio.h>
+#include <vector>
+#include "../support/Crc32.hpp"
+#include "../support/Varint.hpp"
 
 // NOTE: All temperature values in this file are in Fahrenheit (°F)
 class RoastProfile
 {
+public:
+    static constexpr uint8_t FORMAT_VERSION = 2;
+    static constexpr int32_t MAX_SETPOINTS = 300;
+
+    // How temperature is interpolated between setpoints. Fan speed is always
+    // linear.
+    enum InterpolationMode : uint8_t
+    {
+        INTERPOLATION_LINEAR = 0,
+        INTERPOLATION_PCHIP = 1 // Monotone cubic (Fritsch-Carlson)
+    };
+
 private:
     typedef struct
     {
@@ -13,10 +28,70 @@ private:
         uint32_t temp;      // Temperature in Fahrenheit (°F)
         uint32_t fanSpeed;  // Fan speed (0-100%)
     } Setpoint;
-    Setpoint _setpoints[10];    // Create an array of Setpoints with size 10
+    std::vector<Setpoint> _setpoints; // Grows up to MAX_SETPOINTS
     int32_t _setpointCount = 0; // Keep track of how many setpoints are in the array
     uint32_t _startTime = 0;    // Keep track of when the profile started
-    uint8_t _profileVersion = 1; // Profile data structure version for future compatibility
+    uint8_t _profileVersion = FORMAT_VERSION; // Format the profile was last loaded from
+    InterpolationMode _interpolation = INTERPOLATION_LINEAR;
+
+    // Trajectory compiled from the setpoints whenever they change. Entry i
+    // describes the segment that ends at setpoint i, with each channel as
+    // intercept + slope * elapsed over twice the span, so the interpolated
+    // value is an integer divide instead of the double expression. Entry 0
+    // only carries the search key.
+    enum SegmentMath : uint8_t
+    {
+        SEGMENT_NARROW = 0, // 32-bit numerators, precomputed channels
+        SEGMENT_WIDE = 1,   // 64-bit numerators computed per lookup
+        SEGMENT_LEGACY = 2  // Repeated time or out-of-range values
+    };
+    typedef struct
+    {
+        uint32_t intercept; // 2 * start * span + span
+        int32_t slope;      // 2 * (end - start)
+    } SegmentChannel;
+    typedef struct
+    {
+        uint32_t searchTime; // Running max of setpoint times, so lookups can bisect
+        uint32_t reciprocal; // (2^32 - 1) / (2 * span)
+        SegmentChannel temp;
+        SegmentChannel fan;
+        SegmentMath math;
+    } Segment;
+    std::vector<Segment> _segments;
+    // Temperature cubic for each segment in PCHIP mode, indexed like
+    // _segments, as y = ((c3 * t + c2) * t + c1) * t + c0 over t = elapsed *
+    // invSpan in [0, 1]. Segments with invSpan 0 (repeated or out-of-order
+    // times, out-of-range values) stay linear. Empty in linear mode.
+    typedef struct
+    {
+        float c0;
+        float c1;
+        float c2;
+        float c3;
+        float invSpan;
+    } CubicSegment;
+    std::vector<CubicSegment> _cubics;
+    // Segment of the last lookup. Only a hint: every use is checked against
+    // the table, so a stale value from a concurrent reader costs a search.
+    mutable uint16_t _cursor = 0;
+
+    void compileTrajectory();
+    void compileCubics();
+    bool isCubicSpan(int index) const;
+    int findSetpointIndex(uint32_t time, bool inclusive, uint16_t &cursor) const;
+    bool isPastTime(int index, uint32_t time, bool inclusive) const;
+    uint32_t evaluateTemp(uint32_t currentTime, uint16_t &cursor) const;
+    static int32_t interpolateChannel(const Segment &segment, const SegmentChannel &channel, uint32_t elapsed,
+                                      uint32_t span, uint32_t startValue, uint32_t endValue);
+    static int32_t interpolateDouble(uint32_t startValue, uint32_t endValue, uint32_t elapsed, uint32_t span);
+
+    static constexpr uint8_t FLAG_TIME_UNIT = 0x03;
+    static constexpr uint8_t FLAG_PCHIP = 0x04;
+
+    uint8_t chooseTimeUnit() const;
+    bool unflattenVersion1(const uint8_t *buffer, size_t length);
+    bool unflattenVersion2(const uint8_t *buffer, size_t length);
 
 public:
     // Constructor
@@ -25,11 +100,21 @@ public:
     // Start the profile
     void startProfile(uint32_t currentTemp, uint32_t tickTime);
 
+    // Start from the clock and starting temperature of a profile that is
+    // already running, so a profile swapped in mid-roast keeps the elapsed time
+    void continueFrom(const RoastProfile &running);
+
     // Calculate targetTemp based on current time
     uint32_t getTargetTemp(uint32_t tickTime) const;
 
+    // The same, with a caller-owned cursor, for lookups away from the current
+    // time (the prediction horizon) that must not pull the shared cursor off
+    // the control loop's segment. Start a cursor at 0.
+    uint32_t getTargetTemp(uint32_t tickTime, uint16_t &cursor) const;
+
     // Calculate targetTemp at absolute time (no start offset)
     uint32_t getTargetTempAtTime(uint32_t timeMs) const;
+    uint32_t getTargetTempAtTime(uint32_t timeMs, uint16_t &cursor) const;
 
     // Get final targetTemp
     uint32_t getFinalTargetTemp() const;
@@ -50,17 +135,35 @@ public:
     // Add a setpoint to the array
     void addSetpoint(uint32_t time, uint32_t temp, uint32_t fanSpeed);
 
+    // Bulk loading: appendSetpoint() skips the trajectory rebuild that
+    // addSetpoint() does per call, so a loader calls finishSetpoints() once
+    // after the last one. Lookups are not valid in between.
+    void appendSetpoint(uint32_t time, uint32_t temp, uint32_t fanSpeed);
+    void finishSetpoints();
+
     // Get the setpoint at index
     Setpoint getSetpoint(int index) const;
     
     // Validate setpoint values are within safe bounds
     bool validateSetpoint(uint32_t temp, uint32_t fanSpeed) const;
 
-    // Flatten the profile into a byte array
-    void flattenProfile(uint8_t *buffer);
+    // Bytes flattenProfile() needs for the current setpoints
+    size_t getFlattenedSize() const;
 
-    // Unflatten the profile from a byte array
-    void unflattenProfile(uint8_t *buffer);
+    // Flatten the profile into a byte array; returns the bytes written, or 0
+    // if `capacity` is too small
+    size_t flattenProfile(uint8_t *buffer, size_t capacity) const;
+
+    // Unflatten the profile from a byte array; leaves the profile unchanged
+    // and returns false if the data is truncated, corrupt or out of range
+    bool unflattenProfile(const uint8_t *buffer, size_t length);
+
+    // Format version of the last unflattened data (FORMAT_VERSION if none)
+    uint8_t getProfileVersion() const;
+
+    // Temperature interpolation between setpoints; stored with the profile
+    void setInterpolationMode(InterpolationMode mode);
+    InterpolationMode getInterpolationMode() const;
 };
 
 RoastProfile::RoastProfile()
@@ -74,72 +177,68 @@ void RoastProfile::startProfile(uint32_t currentTemp, uint32_t tickTime)
     // startTime = (tickTime == 0) ? millis() : tickTime;
     _setpoints[0].temp = currentTemp;
     _setpoints[0].fanSpeed = (_setpointCount > 1) ? _setpoints[1].fanSpeed : 100;
+    compileTrajectory();
 }
 
-uint32_t RoastProfile::getTargetTemp(uint32_t tickTime) const
+void RoastProfile::continueFrom(const RoastProfile &running)
 {
-    uint32_t currentTime = tickTime - _startTime;
-    for (int i = 0; i < _setpointCount; i++)
-    {
-        if (_setpoints[i].time > currentTime)
-        {
-            if (i == 0)
-            {
-                return _setpoints[i].temp;
-            }
-            else
-            {
-                uint32_t prevTemp = _setpoints[i - 1].temp;
-                uint32_t nextTemp = _setpoints[i].temp;
-                uint32_t prevTime = _setpoints[i - 1].time;
-                uint32_t nextTime = _setpoints[i].time;
+    startProfile(running._setpoints[0].temp, running._startTime);
+}
 
-                if (nextTime == prevTime) {
-                    return nextTemp;
-                }
+uint32_t RoastProfile::getTargetTemp(uint32_t tickTime) const
+{
+    return evaluateTemp(tickTime - _startTime, _cursor);
+}
 
-                double timeRatio = (double)(currentTime - prevTime) / (double)(nextTime - prevTime);
-                double result = (double)prevTemp + ((double)nextTemp - (double)prevTemp) * timeRatio;
-                int32_t out = (int32_t)lround(result);
-                if (out < 0) out = 0; if (out > 500) out = 500;
-                return (uint32_t)out;
-            }
-        }
-    }
-    return _setpoints[_setpointCount - 1].temp;
+uint32_t RoastProfile::getTargetTemp(uint32_t tickTime, uint16_t &cursor) const
+{
+    return evaluateTemp(tickTime - _startTime, cursor);
 }
 
 uint32_t RoastProfile::getTargetTempAtTime(uint32_t timeMs) const
 {
-    uint32_t currentTime = timeMs;
-    for (int i = 0; i < _setpointCount; i++)
+    return evaluateTemp(timeMs, _cursor);
+}
+
+uint32_t RoastProfile::getTargetTempAtTime(uint32_t timeMs, uint16_t &cursor) const
+{
+    return evaluateTemp(timeMs, cursor);
+}
+
+uint32_t RoastProfile::evaluateTemp(uint32_t currentTime, uint16_t &cursor) const
+{
+    int i = findSetpointIndex(currentTime, false, cursor);
+    if (i == _setpointCount)
     {
-        if (_setpoints[i].time > currentTime)
-        {
-            if (i == 0)
-            {
-                return _setpoints[i].temp;
-            }
-            else
-            {
-                uint32_t prevTemp = _setpoints[i - 1].temp;
-                uint32_t nextTemp = _setpoints[i].temp;
-                uint32_t prevTime = _setpoints[i - 1].time;
-                uint32_t nextTime = _setpoints[i].time;
+        return _setpoints[_setpointCount - 1].temp;
+    }
+    if (i == 0)
+    {
+        return _setpoints[i].temp;
+    }
 
-                if (nextTime == prevTime) {
-                    return nextTemp;
-                }
+    const Setpoint &start = _setpoints[i - 1];
+    const Setpoint &end = _setpoints[i];
+    if (end.time == start.time) {
+        return end.temp;
+    }
 
-                double timeRatio = (double)(currentTime - prevTime) / (double)(nextTime - prevTime);
-                double result = (double)prevTemp + ((double)nextTemp - (double)prevTemp) * timeRatio;
-                int32_t out = (int32_t)lround(result);
-                if (out < 0) out = 0; if (out > 500) out = 500;
-                return (uint32_t)out;
-            }
-        }
+    int32_t out;
+    if (!_cubics.empty() && _cubics[i].invSpan > 0.0f)
+    {
+        // The cursor keeps the segment lookup O(1) per tick, so the cubic
+        // costs three multiply-adds on top of the linear path.
+        const CubicSegment &cubic = _cubics[i];
+        float t = (float)(currentTime - start.time) * cubic.invSpan;
+        if (t > 1.0f) t = 1.0f;
+        out = (int32_t)lroundf(((cubic.c3 * t + cubic.c2) * t + cubic.c1) * t + cubic.c0);
+        if (out < 0) out = 0; if (out > 500) out = 500;
+        return (uint32_t)out;
     }
-    return _setpoints[_setpointCount - 1].temp;
+    out = interpolateChannel(_segments[i], _segments[i].temp, currentTime - start.time, end.time - start.time,
+                                     start.temp, end.temp);
+    if (out < 0) out = 0; if (out > 500) out = 500;
+    return (uint32_t)out;
 }
 
 uint32_t RoastProfile::getFinalTargetTemp() const
@@ -152,44 +251,40 @@ void RoastProfile::setFinalTargetTemp(uint32_t temp)
     if (_setpointCount == 0) return;
     uint32_t clamped = (temp > 500U) ? 500U : temp;
     _setpoints[_setpointCount - 1].temp = clamped;
+    compileTrajectory();
 }
 
 uint32_t RoastProfile::getTargetFanSpeed(uint32_t tickTime) const
 {
     uint32_t currentTime = tickTime - _startTime;
-    for (int i = 0; i < _setpointCount; i++)
+    // Fan segments end at the first setpoint at or after the current time
+    // (temperature uses the first one after it); both give the same value
+    // except where setpoints repeat a time.
+    int i = findSetpointIndex(currentTime, true, _cursor);
+    if (i == _setpointCount)
     {
-        if (_setpoints[i].time >= currentTime)
-        {
-            if (i == 0)
-            {
-                uint32_t pwm = ((uint64_t)_setpoints[i].fanSpeed * 255ULL) / 100ULL;
-                return (pwm > 255U) ? 255U : pwm;
-            }
-            else
-            {
-                uint32_t prevFanSpeed = _setpoints[i - 1].fanSpeed;
-                uint32_t nextFanSpeed = _setpoints[i].fanSpeed;
-                uint32_t prevTime = _setpoints[i - 1].time;
-                uint32_t nextTime = _setpoints[i].time;
-
-                if (nextTime == prevTime) {
-                    uint32_t pwm = ((uint64_t)nextFanSpeed * 255ULL) / 100ULL;
-                    return (pwm > 255U) ? 255U : pwm;
-                }
+        uint32_t pwm = ((uint64_t)_setpoints[_setpointCount - 1].fanSpeed * 255ULL) / 100ULL;
+        return (pwm > 255U) ? 255U : pwm;
+    }
+    if (i == 0)
+    {
+        uint32_t pwm = ((uint64_t)_setpoints[i].fanSpeed * 255ULL) / 100ULL;
+        return (pwm > 255U) ? 255U : pwm;
+    }
 
-                double timeRatio = (double)(currentTime - prevTime) / (double)(nextTime - prevTime);
-                double pct = (double)prevFanSpeed + ((double)nextFanSpeed - (double)prevFanSpeed) * timeRatio;
-                int32_t pctInt = (int32_t)lround(pct);
-                if (pctInt < 0) pctInt = 0; if (pctInt > 100) pctInt = 100;
-                uint32_t pwm = ((uint64_t)pctInt * 255ULL) / 100ULL;
-                if (pwm > 255U) pwm = 255U;
-                return pwm;
-            }
-        }
+    const Setpoint &start = _setpoints[i - 1];
+    const Setpoint &end = _setpoints[i];
+    if (end.time == start.time) {
+        uint32_t pwm = ((uint64_t)end.fanSpeed * 255ULL) / 100ULL;
+        return (pwm > 255U) ? 255U : pwm;
     }
-    uint32_t pwm = ((uint64_t)_setpoints[_setpointCount - 1].fanSpeed * 255ULL) / 100ULL;
-    return (pwm > 255U) ? 255U : pwm;
+
+    int32_t pctInt = interpolateChannel(_segments[i], _segments[i].fan, currentTime - start.time,
+                                        end.time - start.time, start.fanSpeed, end.fanSpeed);
+    if (pctInt < 0) pctInt = 0; if (pctInt > 100) pctInt = 100;
+    uint32_t pwm = ((uint64_t)pctInt * 255ULL) / 100ULL;
+    if (pwm > 255U) pwm = 255U;
+    return pwm;
 }
 
 uint32_t RoastProfile::getProfileProgress(uint32_t tickTime) const
@@ -213,25 +308,36 @@ int RoastProfile::getSetpointCount() const
 
 void RoastProfile::clearSetpoints()
 {
+    _setpoints.clear();
     _setpointCount = 0;
+    _cursor = 0;
     this->addSetpoint(0, 0, 0);
 }
 
 void RoastProfile::addSetpoint(uint32_t time, uint32_t temp, uint32_t fanSpeed)
 {
-    if (_setpointCount < 10)
+    appendSetpoint(time, temp, fanSpeed);
+    compileTrajectory();
+}
+
+void RoastProfile::appendSetpoint(uint32_t time, uint32_t temp, uint32_t fanSpeed)
+{
+    if (_setpointCount < MAX_SETPOINTS)
     {
         // Clamp values to safe ranges (uint32_t is always >= 0)
         temp = min(temp, (uint32_t)500);      // 0-500°F
         fanSpeed = min(fanSpeed, (uint32_t)100); // 0-100%
         
-        _setpoints[_setpointCount].time = time;
-        _setpoints[_setpointCount].temp = temp;
-        _setpoints[_setpointCount].fanSpeed = fanSpeed;
+        _setpoints.push_back({time, temp, fanSpeed});
         _setpointCount++;
     }
 }
 
+void RoastProfile::finishSetpoints()
+{
+    compileTrajectory();
+}
+
 bool RoastProfile::validateSetpoint(uint32_t temp, uint32_t fanSpeed) const
 {
     // Validate temperature (0-500°F) and fan speed (0-100%)
@@ -244,57 +350,465 @@ RoastProfile::Setpoint RoastProfile::getSetpoint(int index) const
     return _setpoints[index];
 }
 
-void RoastProfile::flattenProfile(uint8_t *buffer)
+// Version 2 layout. Each setpoint is stored as zigzag varint deltas from the
+// previous one (the first from zero), with times in the largest power-of-ten
+// unit of milliseconds that divides all of them, so a typical point takes 3-4
+// bytes instead of 12:
+//
+//   [0]      version (2)
+//   [1]      flags: bits 0-1 time unit as a power of ten (0-3: 1 ms to
+//            1 s), bit 2 PCHIP interpolation, the rest zero
+//   varint   setpoint count (1 to MAX_SETPOINTS)
+//   varints  count x (time delta, temp delta, fan delta)
+//   [4]      CRC-32 of everything before it, little-endian
+size_t RoastProfile::getFlattenedSize() const
 {
-    // Version byte at position 0 for future compatibility
-    buffer[0] = _profileVersion;
-    
-    // Setpoint count at positions 1-4
-    buffer[1] = (uint8_t)(_setpointCount >> 24);
-    buffer[2] = (uint8_t)(_setpointCount >> 16);
-    buffer[3] = (uint8_t)(_setpointCount >> 8);
-    buffer[4] = (uint8_t)(_setpointCount);
+    static const uint32_t units[4] = {1, 10, 100, 1000};
+    uint32_t unit = units[chooseTimeUnit()];
+    size_t size = 2 + varintSize(_setpointCount) + 4;
+    Setpoint previous = {0, 0, 0};
+    for (int i = 0; i < _setpointCount; i++)
+    {
+        const Setpoint &setpoint = _setpoints[i];
+        size += varintSize(zigzagEncode((int64_t)(setpoint.time / unit) - (int64_t)(previous.time / unit)));
+        size += varintSize(zigzagEncode((int64_t)setpoint.temp - (int64_t)previous.temp));
+        size += varintSize(zigzagEncode((int64_t)setpoint.fanSpeed - (int64_t)previous.fanSpeed));
+        previous = setpoint;
+    }
+    return size;
+}
 
+size_t RoastProfile::flattenProfile(uint8_t *buffer, size_t capacity) const
+{
+    size_t size = getFlattenedSize();
+    if (buffer == nullptr || capacity < size)
+    {
+        return 0;
+    }
+
+    static const uint32_t units[4] = {1, 10, 100, 1000};
+    uint8_t timeUnit = chooseTimeUnit();
+    uint32_t unit = units[timeUnit];
+    uint8_t *out = buffer;
+    *out++ = FORMAT_VERSION;
+    *out++ = timeUnit | (_interpolation == INTERPOLATION_PCHIP ? FLAG_PCHIP : 0);
+    out = writeVarint(out, _setpointCount);
+    Setpoint previous = {0, 0, 0};
     for (int i = 0; i < _setpointCount; i++)
     {
-        buffer[i * 12 + 5] = (uint8_t)(_setpoints[i].time >> 24);
-        buffer[i * 12 + 6] = (uint8_t)(_setpoints[i].time >> 16);
-        buffer[i * 12 + 7] = (uint8_t)(_setpoints[i].time >> 8);
-        buffer[i * 12 + 8] = (uint8_t)(_setpoints[i].time);
-        buffer[i * 12 + 9] = (uint8_t)(_setpoints[i].temp >> 24);
-        buffer[i * 12 + 10] = (uint8_t)(_setpoints[i].temp >> 16);
-        buffer[i * 12 + 11] = (uint8_t)(_setpoints[i].temp >> 8);
-        buffer[i * 12 + 12] = (uint8_t)(_setpoints[i].temp);
-        buffer[i * 12 + 13] = (uint8_t)(_setpoints[i].fanSpeed >> 24);
-        buffer[i * 12 + 14] = (uint8_t)(_setpoints[i].fanSpeed >> 16);
-        buffer[i * 12 + 15] = (uint8_t)(_setpoints[i].fanSpeed >> 8);
-        buffer[i * 12 + 16] = (uint8_t)(_setpoints[i].fanSpeed);
+        const Setpoint &setpoint = _setpoints[i];
+        out = writeVarint(out, zigzagEncode((int64_t)(setpoint.time / unit) - (int64_t)(previous.time / unit)));
+        out = writeVarint(out, zigzagEncode((int64_t)setpoint.temp - (int64_t)previous.temp));
+        out = writeVarint(out, zigzagEncode((int64_t)setpoint.fanSpeed - (int64_t)previous.fanSpeed));
+        previous = setpoint;
+    }
+    uint32_t crc = crc32(buffer, out - buffer);
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        *out++ = (uint8_t)(crc >> shift);
     }
+    return out - buffer;
 }
 
-void RoastProfile::unflattenProfile(uint8_t *buffer)
+bool RoastProfile::unflattenProfile(const uint8_t *buffer, size_t length)
 {
-    // Read and validate version byte
-    _profileVersion = buffer[0];
-    // For now, only support version 1
-    // In the future, could handle migration from old versions here
-    
+    if (buffer == nullptr || length == 0)
+    {
+        return false;
+    }
+    // Version 1 blobs (and the version 0 the first firmware wrote) are the
+    // fixed 12-byte layout; they load as-is and are written back as version 2
+    // the next time the profile is saved.
+    if (buffer[0] <= 1)
+    {
+        return unflattenVersion1(buffer, length);
+    }
+    if (buffer[0] == 2)
+    {
+        return unflattenVersion2(buffer, length);
+    }
+    return false;
+}
+
+uint8_t RoastProfile::getProfileVersion() const
+{
+    return _profileVersion;
+}
+
+void RoastProfile::setInterpolationMode(InterpolationMode mode)
+{
+    _interpolation = (mode == INTERPOLATION_PCHIP) ? INTERPOLATION_PCHIP : INTERPOLATION_LINEAR;
+    compileTrajectory();
+}
+
+RoastProfile::InterpolationMode RoastProfile::getInterpolationMode() const
+{
+    return _interpolation;
+}
+
+uint8_t RoastProfile::chooseTimeUnit() const
+{
+    static const uint32_t units[4] = {1, 10, 100, 1000};
+    uint8_t timeUnit = 3;
+    for (int i = 0; i < _setpointCount && timeUnit > 0; i++)
+    {
+        while (timeUnit > 0 && _setpoints[i].time % units[timeUnit] != 0)
+        {
+            timeUnit--;
+        }
+    }
+    return timeUnit;
+}
+
+bool RoastProfile::unflattenVersion1(const uint8_t *buffer, size_t length)
+{
+    if (length < 5)
+    {
+        return false;
+    }
     // Read setpoint count from positions 1-4
     uint64_t _tempSetpointCount = (static_cast<uint64_t>(buffer[1]) << 24) | (static_cast<uint64_t>(buffer[2]) << 16) | (static_cast<uint64_t>(buffer[3]) << 8) | (static_cast<uint64_t>(buffer[4]));
-    if (_tempSetpointCount <= 10 && _tempSetpointCount > 0)
+    if (_tempSetpointCount > (uint64_t)MAX_SETPOINTS || _tempSetpointCount == 0 || length < 5 + _tempSetpointCount * 12)
+    {
+        return false;
+    }
+
+    std::vector<Setpoint> setpoints(static_cast<size_t>(_tempSetpointCount));
+    for (size_t i = 0; i < setpoints.size(); i++)
+    {
+        uint32_t time = (static_cast<uint32_t>(buffer[i * 12 + 5]) << 24) | (static_cast<uint32_t>(buffer[i * 12 + 6]) << 16) | (static_cast<uint32_t>(buffer[i * 12 + 7]) << 8) | (static_cast<uint32_t>(buffer[i * 12 + 8]));
+        uint32_t temp = (static_cast<uint32_t>(buffer[i * 12 + 9]) << 24) | (static_cast<uint32_t>(buffer[i * 12 + 10]) << 16) | (static_cast<uint32_t>(buffer[i * 12 + 11]) << 8) | (static_cast<uint32_t>(buffer[i * 12 + 12]));
+        uint32_t fanSpeed = (static_cast<uint32_t>(buffer[i * 12 + 13]) << 24) | (static_cast<uint32_t>(buffer[i * 12 + 14]) << 16) | (static_cast<uint32_t>(buffer[i * 12 + 15]) << 8) | (static_cast<uint32_t>(buffer[i * 12 + 16]));
+        setpoints[i] = {time, temp, fanSpeed};
+    }
+
+    _setpoints.swap(setpoints);
+    _setpointCount = static_cast<int32_t>(_setpoints.size());
+    _profileVersion = 1;
+    _interpolation = INTERPOLATION_LINEAR;
+    compileTrajectory();
+    return true;
+}
+
+// Decodes straight from the stored bytes; the setpoints are only replaced
+// once the CRC, every varint and every value range have checked out.
+bool RoastProfile::unflattenVersion2(const uint8_t *buffer, size_t length)
+{
+    static const uint32_t units[4] = {1, 10, 100, 1000};
+    if (length < 2 + 1 + 4 || (buffer[1] & ~(FLAG_TIME_UNIT | FLAG_PCHIP)) != 0)
+    {
+        return false;
+    }
+    const uint8_t *end = buffer + length - 4;
+    uint32_t storedCrc = (uint32_t)end[0] | ((uint32_t)end[1] << 8) | ((uint32_t)end[2] << 16) | ((uint32_t)end[3] << 24);
+    if (crc32(buffer, length - 4) != storedCrc)
+    {
+        return false;
+    }
+
+    uint32_t unit = units[buffer[1] & FLAG_TIME_UNIT];
+    const uint8_t *cursor = buffer + 2;
+    uint64_t count = 0;
+    if (!readVarint(cursor, end, count) || count == 0 || count > (uint64_t)MAX_SETPOINTS)
+    {
+        return false;
+    }
+
+    std::vector<Setpoint> setpoints(static_cast<size_t>(count));
+    int64_t time = 0;
+    int64_t temp = 0;
+    int64_t fanSpeed = 0;
+    for (size_t i = 0; i < setpoints.size(); i++)
+    {
+        uint64_t timeDelta = 0;
+        uint64_t tempDelta = 0;
+        uint64_t fanDelta = 0;
+        if (!readVarint(cursor, end, timeDelta) || !readVarint(cursor, end, tempDelta) ||
+            !readVarint(cursor, end, fanDelta))
+        {
+            return false;
+        }
+        // Any valid delta is within +/-2^32, so this also keeps the running
+        // sums from overflowing on garbage.
+        if ((timeDelta | tempDelta | fanDelta) >> 34)
+        {
+            return false;
+        }
+        time += zigzagDecode(timeDelta);
+        temp += zigzagDecode(tempDelta);
+        fanSpeed += zigzagDecode(fanDelta);
+        if (time < 0 || time * unit > 0xFFFFFFFFLL || temp < 0 || temp > 0xFFFFFFFFLL || fanSpeed < 0 ||
+            fanSpeed > 0xFFFFFFFFLL)
+        {
+            return false;
+        }
+        setpoints[i] = {(uint32_t)(time * unit), (uint32_t)temp, (uint32_t)fanSpeed};
+    }
+    if (cursor != end)
+    {
+        return false;
+    }
+
+    _setpoints.swap(setpoints);
+    _setpointCount = static_cast<int32_t>(_setpoints.size());
+    _profileVersion = 2;
+    _interpolation = (buffer[1] & FLAG_PCHIP) ? INTERPOLATION_PCHIP : INTERPOLATION_LINEAR;
+    compileTrajectory();
+    return true;
+}
+
+void RoastProfile::compileTrajectory()
+{
+    _segments.resize(_setpointCount);
+    uint32_t searchTime = 0;
+    for (int i = 0; i < _setpointCount; i++)
+    {
+        Segment &segment = _segments[i];
+        searchTime = (i == 0 || _setpoints[i].time > searchTime) ? _setpoints[i].time : searchTime;
+        segment.searchTime = searchTime;
+        segment.reciprocal = 0;
+        segment.temp = {};
+        segment.fan = {};
+        segment.math = SEGMENT_LEGACY;
+        if (i == 0)
+        {
+            continue;
+        }
+
+        const Setpoint &start = _setpoints[i - 1];
+        const Setpoint &end = _setpoints[i];
+        uint64_t span = end.time - start.time;
+        uint64_t largest = max(max(start.temp, end.temp), max(start.fanSpeed, end.fanSpeed));
+        if (span == 0 || largest > 0xFFFFULL)
+        {
+            continue;
+        }
+        // Narrow needs the numerator, (2 * largest + 1) * span at most, and
+        // the divisor 2 * span both in 32 bits.
+        if ((2ULL * largest + 2ULL) * span > 0xFFFFFFFFULL)
+        {
+            segment.math = SEGMENT_WIDE;
+            continue;
+        }
+        segment.math = SEGMENT_NARROW;
+        segment.reciprocal = (uint32_t)(0xFFFFFFFFULL / (2ULL * span));
+        segment.temp.intercept = (uint32_t)(2ULL * start.temp * span + span);
+        segment.temp.slope = 2 * ((int32_t)end.temp - (int32_t)start.temp);
+        segment.fan.intercept = (uint32_t)(2ULL * start.fanSpeed * span + span);
+        segment.fan.slope = 2 * ((int32_t)end.fanSpeed - (int32_t)start.fanSpeed);
+    }
+    if (_cursor > _setpointCount)
+    {
+        _cursor = 0;
+    }
+    compileCubics();
+}
+
+bool RoastProfile::isCubicSpan(int index) const
+{
+    return index > 0 && index < _setpointCount && _setpoints[index].time > _setpoints[index - 1].time &&
+           _setpoints[index].temp <= 0xFFFF && _setpoints[index - 1].temp <= 0xFFFF;
+}
+
+// Monotone piecewise-cubic Hermite coefficients (Fritsch-Carlson, as in
+// SciPy's PchipInterpolator). Knot slopes are the weighted harmonic mean of
+// the neighbouring secants, or zero where the curve turns, so the cubic never
+// overshoots a setpoint and stays monotone wherever the setpoints are. Runs
+// of usable segments are treated as separate curves, with one-sided end
+// slopes at each run boundary.
+void RoastProfile::compileCubics()
+{
+    if (_interpolation != INTERPOLATION_PCHIP)
+    {
+        _cubics.clear();
+        return;
+    }
+    _cubics.assign(_setpointCount, CubicSegment{0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+
+    int runStart = 1;
+    while (runStart < _setpointCount)
     {
-        _setpointCount = static_cast<uint32_t>(_tempSetpointCount);
-        for (int i = 0; i < _setpointCount; i++)
+        if (!isCubicSpan(runStart))
+        {
+            runStart++;
+            continue;
+        }
+        int runEnd = runStart;
+        while (runEnd + 1 < _setpointCount && isCubicSpan(runEnd + 1))
         {
-            uint32_t time = (static_cast<uint32_t>(buffer[i * 12 + 5]) << 24) | (static_cast<uint32_t>(buffer[i * 12 + 6]) << 16) | (static_cast<uint32_t>(buffer[i * 12 + 7]) << 8) | (static_cast<uint32_t>(buffer[i * 12 + 8]));
-            uint32_t temp = (static_cast<uint32_t>(buffer[i * 12 + 9]) << 24) | (static_cast<uint32_t>(buffer[i * 12 + 10]) << 16) | (static_cast<uint32_t>(buffer[i * 12 + 11]) << 8) | (static_cast<uint32_t>(buffer[i * 12 + 12]));
-            uint32_t fanSpeed = (static_cast<uint32_t>(buffer[i * 12 + 13]) << 24) | (static_cast<uint32_t>(buffer[i * 12 + 14]) << 16) | (static_cast<uint32_t>(buffer[i * 12 + 15]) << 8) | (static_cast<uint32_t>(buffer[i * 12 + 16]));
+            runEnd++;
+        }
+
+        // Knots runStart - 1 .. runEnd; slopes in °F per ms.
+        int first = runStart - 1;
+        int knots = runEnd - first + 1;
+        auto width = [&](int k) { return (double)_setpoints[first + k + 1].time - (double)_setpoints[first + k].time; };
+        auto secant = [&](int k) {
+            return ((double)_setpoints[first + k + 1].temp - (double)_setpoints[first + k].temp) / width(k);
+        };
+        auto endSlope = [](double h0, double h1, double d0, double d1) {
+            double slope = ((2.0 * h0 + h1) * d0 - h0 * d1) / (h0 + h1);
+            if ((slope > 0.0) != (d0 > 0.0) || d0 == 0.0)
+            {
+                return 0.0;
+            }
+            if ((d0 > 0.0) != (d1 > 0.0) && fabs(slope) > fabs(3.0 * d0))
+            {
+                return 3.0 * d0;
+            }
+            return slope;
+        };
 
-            _setpoints[i].time = time;
-            _setpoints[i].temp = temp;
-            _setpoints[i].fanSpeed = fanSpeed;
+        double previousSlope = 0.0;
+        for (int k = 0; k < knots - 1; k++)
+        {
+            double h = width(k);
+            double d = secant(k);
+            double startSlope = previousSlope;
+            double nextSlope;
+            if (knots == 2)
+            {
+                startSlope = d;
+                nextSlope = d;
+            }
+            else
+            {
+                if (k == 0)
+                {
+                    startSlope = endSlope(h, width(1), d, secant(1));
+                }
+                if (k == knots - 2)
+                {
+                    nextSlope = endSlope(h, width(k - 1), d, secant(k - 1));
+                }
+                else
+                {
+                    double hNext = width(k + 1);
+                    double dNext = secant(k + 1);
+                    if (d == 0.0 || dNext == 0.0 || (d > 0.0) != (dNext > 0.0))
+                    {
+                        nextSlope = 0.0;
+                    }
+                    else
+                    {
+                        double w1 = 2.0 * hNext + h;
+                        double w2 = hNext + 2.0 * h;
+                        nextSlope = (w1 + w2) / (w1 / d + w2 / dNext);
+                    }
+                }
+            }
+            previousSlope = nextSlope;
+
+            double y0 = _setpoints[first + k].temp;
+            double delta = (double)_setpoints[first + k + 1].temp - y0;
+            double m0 = startSlope * h;
+            double m1 = nextSlope * h;
+            CubicSegment &cubic = _cubics[first + k + 1];
+            cubic.c0 = (float)y0;
+            cubic.c1 = (float)m0;
+            cubic.c2 = (float)(3.0 * delta - 2.0 * m0 - m1);
+            cubic.c3 = (float)(m0 + m1 - 2.0 * delta);
+            cubic.invSpan = (float)(1.0 / h);
         }
+        runStart = runEnd + 1;
     }
 }
 
+bool RoastProfile::isPastTime(int index, uint32_t time, bool inclusive) const
+{
+    return inclusive ? _segments[index].searchTime >= time : _segments[index].searchTime > time;
+}
+
+// Index of the first setpoint after `time` (at or after it when inclusive),
+// or _setpointCount when there is none: the same index the original linear
+// scan stopped at, including for setpoints added out of time order, because
+// the search runs over the running max of the setpoint times. Sequential
+// queries in either direction stay on or next to the cursor, so the control
+// loop and the display plot sweep cost O(1); anything else bisects.
+int RoastProfile::findSetpointIndex(uint32_t time, bool inclusive, uint16_t &cursor) const
+{
+    int hint = cursor;
+    const int candidates[3] = {hint, hint + 1, hint - 1};
+    for (int c = 0; c < 3; c++)
+    {
+        int index = candidates[c];
+        if (index < 0 || index > _setpointCount)
+        {
+            continue;
+        }
+        bool past = index == _setpointCount || isPastTime(index, time, inclusive);
+        if (past && (index == 0 || !isPastTime(index - 1, time, inclusive)))
+        {
+            cursor = (uint16_t)index;
+            return index;
+        }
+    }
+
+    int low = 0;
+    int high = _setpointCount;
+    while (low < high)
+    {
+        int mid = (low + high) / 2;
+        if (isPastTime(mid, time, inclusive))
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + 1;
+        }
+    }
+    cursor = (uint16_t)low;
+    return low;
+}
+
+// Rounds start + (end - start) * elapsed / span to nearest, which is what
+// lround() of the double expression returns everywhere except at an exact
+// .5, where the double rounding can land either side. Those ties go to the
+// double expression itself, so every result matches it bit for bit.
+int32_t RoastProfile::interpolateChannel(const Segment &segment, const SegmentChannel &channel, uint32_t elapsed,
+                                         uint32_t span, uint32_t startValue, uint32_t endValue)
+{
+    if (elapsed <= span)
+    {
+        if (segment.math == SEGMENT_NARROW)
+        {
+            // The true numerator lies in [0, 2^32), so wrapping arithmetic
+            // gives it exactly even when the slope is negative.
+            uint32_t numerator = channel.intercept + (uint32_t)channel.slope * elapsed;
+            uint32_t divisor = 2U * span;
+            // Multiply by the reciprocal instead of dividing; the estimate
+            // is at most two short of the quotient.
+            uint32_t quotient = (uint32_t)(((uint64_t)numerator * segment.reciprocal) >> 32);
+            uint32_t remainder = numerator - quotient * divisor;
+            while (remainder >= divisor)
+            {
+                quotient++;
+                remainder -= divisor;
+            }
+            if (remainder != 0)
+            {
+                return (int32_t)quotient;
+            }
+        }
+        else if (segment.math == SEGMENT_WIDE)
+        {
+            uint64_t numerator = 2ULL * ((uint64_t)startValue * (span - elapsed) + (uint64_t)endValue * elapsed) + span;
+            uint64_t divisor = 2ULL * span;
+            if (numerator % divisor != 0)
+            {
+                return (int32_t)(numerator / divisor);
+            }
+        }
+    }
+    return interpolateDouble(startValue, endValue, elapsed, span);
+}
+
+int32_t RoastProfile::interpolateDouble(uint32_t startValue, uint32_t endValue, uint32_t elapsed, uint32_t span)
+{
+    double timeRatio = (double)elapsed / (double)span;
+    double result = (double)startValue + ((double)endValue - (double)startValue) * timeRatio;
+    return (int32_t)lround(result);
+}
+
 #endif // ROAST_PROFILE_HPP
@@ -0,0 +1,188 @@
+#ifndef THERMOCOUPLE_ACQUISITION_HPP
+#define THERMOCOUPLE_ACQUISITION_HPP
+
+#include <Arduino.h>
+#include "ThermocoupleTransport.hpp"
+#include "../platform/RoasterTypes.hpp"
+#include "../support/RingBuffer.hpp"
+
+struct ThermocoupleSample {
+    uint32_t timestampUs;
+    uint16_t frame;
+    uint8_t channel;
+
+    bool isOpen() const { return (frame & 0x0004) != 0; }
+
+    double celsius() const { return static_cast<double>((frame >> 3) & 0x0FFF) * 0.25; }
+
+    // NAN for an open input, matching the old MAX6675 library readFarenheit().
+    double fahrenheit() const { return isOpen() ? NAN : celsius() * 9.0 / 5.0 + 32.0; }
+};
+
+// Non-blocking MAX6675 acquisition. poll() reads each channel only once its
+// conversion has had time to finish, so nothing ever waits on the converter.
+// Channel reads sit on a fixed grid (period apart, staggered between channels
+// so two reads never land in the same control cycle) and produce timestamped
+// raw samples into a ring buffer the consumer drains.
+class ThermocoupleAcquisition {
+public:
+    static constexpr uint8_t MAX_CHANNELS = 4;
+    static constexpr size_t QUEUE_DEPTH = 16;
+
+    struct Config {
+        uint32_t conversionUs = 220000; // MAX6675 worst-case conversion time
+        uint32_t periodUs = 250000;     // Per-channel sample period
+        uint32_t staggerUs = 125000;    // Offset between consecutive channels
+    };
+
+    struct Stats {
+        uint32_t samples;
+        uint32_t transportErrors;
+        uint32_t skippedReads;
+    };
+
+    bool begin(ThermocoupleTransport &newTransport, uint32_t nowUs) {
+        return begin(newTransport, nowUs, Config());
+    }
+
+    bool begin(ThermocoupleTransport &newTransport, uint32_t nowUs, const Config &newConfig) {
+        transport = &newTransport;
+        config = newConfig;
+        if (config.periodUs < config.conversionUs) {
+            config.periodUs = config.conversionUs;
+        }
+        channelCount = transport->getChannelCount();
+        if (channelCount > MAX_CHANNELS) {
+            channelCount = MAX_CHANNELS;
+        }
+        queue.clear();
+        stats = {};
+        if (!transport->begin()) {
+            transport = nullptr;
+            return false;
+        }
+        // begin() raised every CS, so each converter is mid-conversion now.
+        for (uint8_t channel = 0; channel < channelCount; channel++) {
+            lastReadUs[channel] = nowUs;
+            nextReadUs[channel] = nowUs + config.periodUs + channel * config.staggerUs;
+        }
+        return true;
+    }
+
+    // Reads every channel that is due and whose conversion is complete.
+    // Returns the number of samples queued.
+    uint8_t poll(uint32_t nowUs) {
+        if (transport == nullptr) {
+            return 0;
+        }
+
+        uint8_t produced = 0;
+        for (uint8_t channel = 0; channel < channelCount; channel++) {
+            if (static_cast<int32_t>(nowUs - nextReadUs[channel]) < 0 ||
+                nowUs - lastReadUs[channel] < config.conversionUs) {
+                continue;
+            }
+
+            uint32_t missed = (nowUs - nextReadUs[channel]) / config.periodUs;
+            stats.skippedReads += missed;
+            nextReadUs[channel] += (missed + 1) * config.periodUs;
+
+            uint16_t frame = 0;
+            if (!transport->readFrame(channel, frame)) {
+                stats.transportErrors++;
+                continue;
+            }
+            lastReadUs[channel] = nowUs;
+
+            ThermocoupleSample sample;
+            sample.timestampUs = nowUs;
+            sample.frame = frame;
+            sample.channel = channel;
+            queue.push(sample);
+            stats.samples++;
+            produced++;
+        }
+        return produced;
+    }
+
+    bool pop(ThermocoupleSample &sample) { return queue.pop(sample); }
+
+    size_t available() const { return queue.size(); }
+    uint32_t getOverflows() const { return queue.getOverflows(); }
+    uint8_t getChannelCount() const { return channelCount; }
+    const Config &getConfig() const { return config; }
+    Stats getStats() const { return stats; }
+
+private:
+    ThermocoupleTransport *transport = nullptr;
+    Config config;
+    uint8_t channelCount = 0;
+    uint32_t lastReadUs[MAX_CHANNELS] = {};
+    uint32_t nextReadUs[MAX_CHANNELS] = {};
+    RingBuffer<ThermocoupleSample, QUEUE_DEPTH> queue;
+    Stats stats = {};
+};
+
+// Range and spike rejection for one channel. The filter only classifies a
+// reading; fault counting and safety trips stay with the caller.
+class ThermocoupleFilter {
+public:
+    enum Verdict {
+        ACCEPTED,
+        OPEN_CIRCUIT,
+        RANGE_ERROR,
+        SPIKE
+    };
+
+    struct Config {
+        double minF = 0.0;
+        double maxF = SENSOR_FAULT_TEMP;
+        double maxJumpF = MAX_TEMP_JUMP;
+    };
+
+    ThermocoupleFilter() {}
+    explicit ThermocoupleFilter(const Config &config) : config(config) {}
+
+    // Classifies `reading`; accepted readings become the new reference for
+    // spike detection. Spike checks are skipped until a first reading has been
+    // accepted or when the caller disables them.
+    Verdict evaluate(double reading, bool filterSpikes) {
+        if (isnan(reading)) {
+            return OPEN_CIRCUIT;
+        }
+        if (reading < config.minF || reading > config.maxF) {
+            return RANGE_ERROR;
+        }
+        if (hasValid && filterSpikes && fabs(reading - lastValid) > config.maxJumpF) {
+            return SPIKE;
+        }
+        lastValid = reading;
+        hasValid = true;
+        return ACCEPTED;
+    }
+
+    void reset() {
+        hasValid = false;
+        lastValid = 0.0;
+    }
+
+    bool hasValidReading() const { return hasValid; }
+    double getLastValid() const { return lastValid; }
+
+    static const char *verdictName(Verdict verdict) {
+        switch (verdict) {
+            case ACCEPTED: return "ok";
+            case OPEN_CIRCUIT: return "open";
+            case RANGE_ERROR: return "range";
+            case SPIKE: return "spike";
+        }
+        return "unknown";
+    }
+
+private:
+    Config config;
+    bool hasValid = false;
+    double lastValid = 0.0;
+};
+
+#endif // THERMOCOUPLE_ACQUISITION_HPP
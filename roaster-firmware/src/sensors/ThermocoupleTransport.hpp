@@ -0,0 +1,132 @@
+#ifndef THERMOCOUPLE_TRANSPORT_HPP
+#define THERMOCOUPLE_TRANSPORT_HPP
+
+#include <Arduino.h>
+
+#ifndef ROASTER_HOST_BUILD
+#include <SPI.h>
+#endif
+
+// Moves raw 16-bit MAX6675 frames off the converters. The acquisition engine
+// only talks to this interface, so the same pipeline runs against the SPI
+// peripheral on the ESP32 and against recorded or synthetic streams on a host.
+//
+// MAX6675 frame layout: D14..D3 temperature in 0.25 C steps, D2 set when the
+// thermocouple input is open. Pulling CS low stops the running conversion;
+// releasing it starts the next one, which takes up to 220 ms.
+class ThermocoupleTransport {
+public:
+    virtual ~ThermocoupleTransport() {}
+
+    virtual bool begin() = 0;
+
+    // Clocks one frame out of the converter on `channel`. Returns false when
+    // the channel does not exist or the bus could not be used.
+    virtual bool readFrame(uint8_t channel, uint16_t &frame) = 0;
+
+    virtual uint8_t getChannelCount() const = 0;
+};
+
+#ifndef ROASTER_HOST_BUILD
+// MAX6675 converters sharing one hardware SPI bus (receive-only, one CS per
+// converter). A frame is a single 16-bit transfer, ~4 us at 4 MHz, so reads
+// no longer bit-bang the pins from the control task.
+class Max6675SpiTransport : public ThermocoupleTransport {
+public:
+    static constexpr uint8_t MAX_CHANNELS = 4;
+    static constexpr uint32_t CLOCK_HZ = 4000000; // MAX6675 tops out at 4.3 MHz
+
+    Max6675SpiTransport(int sckPin, int misoPin, const int *chipSelectPins, uint8_t channelCount)
+        : spi(HSPI), sckPin(sckPin), misoPin(misoPin), channelCount(channelCount > MAX_CHANNELS ? MAX_CHANNELS : channelCount) {
+        for (uint8_t channel = 0; channel < this->channelCount; channel++) {
+            csPins[channel] = chipSelectPins[channel];
+        }
+    }
+
+    bool begin() override {
+        for (uint8_t channel = 0; channel < channelCount; channel++) {
+            pinMode(csPins[channel], OUTPUT);
+            digitalWrite(csPins[channel], HIGH); // Starts the first conversion
+        }
+        spi.begin(sckPin, misoPin, -1, -1);
+        return true;
+    }
+
+    bool readFrame(uint8_t channel, uint16_t &frame) override {
+        if (channel >= channelCount) {
+            return false;
+        }
+        spi.beginTransaction(SPISettings(CLOCK_HZ, MSBFIRST, SPI_MODE0));
+        digitalWrite(csPins[channel], LOW);
+        frame = spi.transfer16(0);
+        digitalWrite(csPins[channel], HIGH);
+        spi.endTransaction();
+        return true;
+    }
+
+    uint8_t getChannelCount() const override { return channelCount; }
+
+private:
+    SPIClass spi;
+    int sckPin;
+    int misoPin;
+    int csPins[MAX_CHANNELS] = {};
+    uint8_t channelCount;
+};
+#endif
+
+// Serves frames from per-channel arrays, one frame per read, holding the last
+// frame once a stream runs out. Used for host tests and replaying recorded
+// sensor traces through the acquisition pipeline.
+class ReplayThermocoupleTransport : public ThermocoupleTransport {
+public:
+    static constexpr uint8_t MAX_CHANNELS = 4;
+
+    bool begin() override { return true; }
+
+    void setStream(uint8_t channel, const uint16_t *frames, size_t frameCount) {
+        if (channel >= MAX_CHANNELS) {
+            return;
+        }
+        streams[channel] = frames;
+        lengths[channel] = frameCount;
+        positions[channel] = 0;
+        if (channel >= channelCount) {
+            channelCount = channel + 1;
+        }
+    }
+
+    bool readFrame(uint8_t channel, uint16_t &frame) override {
+        if (channel >= channelCount || streams[channel] == nullptr || lengths[channel] == 0 || failNextRead) {
+            failNextRead = false;
+            return false;
+        }
+        size_t position = positions[channel] < lengths[channel] ? positions[channel] : lengths[channel] - 1;
+        frame = streams[channel][position];
+        positions[channel]++;
+        return true;
+    }
+
+    uint8_t getChannelCount() const override { return channelCount; }
+    size_t getReadCount(uint8_t channel) const { return channel < MAX_CHANNELS ? positions[channel] : 0; }
+    void failNext() { failNextRead = true; }
+
+    // Frame a MAX6675 would report for `fahrenheit`, or an open-input frame.
+    static uint16_t encodeFahrenheit(double fahrenheit) {
+        double celsius = (fahrenheit - 32.0) * 5.0 / 9.0;
+        long counts = lround(celsius * 4.0);
+        counts = constrain(counts, 0L, 4095L);
+        return static_cast<uint16_t>(counts << 3);
+    }
+
+    static constexpr uint16_t OPEN_FRAME = 0x0004;
+
+private:
+    const uint16_t *streams[MAX_CHANNELS] = {};
+    size_t lengths[MAX_CHANNELS] = {};
+    size_t positions[MAX_CHANNELS] = {};
+    uint8_t channelCount = 0;
+    bool failNextRead = false;
+};
+
+#endif // THERMOCOUPLE_TRANSPORT_HPP
@@ -2,6 +2,8 @@
 #define DEBUGLOG_HPP
 
 #include <Arduino.h>
+#include "JsonWriter.hpp"
+#include "StaticMutex.hpp"
 
 // Debug logging system with ring buffer for web console
 
@@ -15,6 +17,7 @@ enum LogLevel {
 
 // Log entry structure
 struct LogEntry {
+  uint32_t seq;  // 1, 2, 3... in logging order; clients resume from it
   unsigned long timestamp;
   LogLevel level;
   char message[160];  // Keep bounded but large enough for HTTP/API diagnostics
@@ -23,27 +26,37 @@ struct LogEntry {
 // Ring buffer for log entries
 class DebugLogger {
 private:
+  // log() runs on loop(), the control task and the web server, and readers
+  // walk the ring while it does; every access to the ring goes under this
+  using Lock = StaticMutexLock<DebugLogger>;
+
   static const int MAX_LOGS = 100;
   LogEntry logs[MAX_LOGS];
   int writeIndex;
   int count;
+  uint32_t latestSeq;
   
 public:
-  DebugLogger() : writeIndex(0), count(0) {}
+  DebugLogger() : writeIndex(0), count(0), latestSeq(0) {}
   
   // Add a log entry
   void log(LogLevel level, const char* message) {
-    logs[writeIndex].timestamp = millis();
-    logs[writeIndex].level = level;
-    strncpy(logs[writeIndex].message, message, 159);
-    logs[writeIndex].message[159] = '\0';  // Ensure null termination
-    
-    writeIndex = (writeIndex + 1) % MAX_LOGS;
-    if (count < MAX_LOGS) count++;
+    unsigned long timestamp = millis();
+    {
+      Lock lock;
+      logs[writeIndex].seq = latestSeq + 1;
+      logs[writeIndex].timestamp = timestamp;
+      logs[writeIndex].level = level;
+      snprintf(logs[writeIndex].message, sizeof(logs[writeIndex].message), "%s", message);
+      
+      writeIndex = (writeIndex + 1) % MAX_LOGS;
+      if (count < MAX_LOGS) count++;
+      latestSeq++;
+    }
     
     // Also print to Serial for debugging
     #ifdef DEBUG
-    printLogEntry(logs[(writeIndex - 1 + MAX_LOGS) % MAX_LOGS]);
+    Serial.printf("[%lu] %s: %s\n", timestamp, getLevelName(level), message);
     #endif
   }
   
@@ -66,45 +79,76 @@ public:
                   entry.message);
   }
   
-  // Get logs as JSON array
-  String getLogsJSON(int maxEntries = 50, bool wrapInObject = false) const {
-    String json = wrapInObject ? "{\"logs\":[" : "[";
-    
-    int entriesToReturn = min(maxEntries, count);
-    int startIndex = (writeIndex - entriesToReturn + MAX_LOGS) % MAX_LOGS;
-    
-    for (int i = 0; i < entriesToReturn; i++) {
-      int index = (startIndex + i) % MAX_LOGS;
-      
-      if (i > 0) json += ",";
-      
-      json += "{";
-      json += "\"timestamp\":" + String(logs[index].timestamp) + ",";
-      json += "\"level\":\"" + String(getLevelName(logs[index].level)) + "\",";
-      json += "\"message\":\"";
-      
-      // Escape special characters in message
-      for (int j = 0; j < 160 && logs[index].message[j] != '\0'; j++) {
-        char c = logs[index].message[j];
-        if (c == '"' || c == '\\') json += '\\';
-        json += c;
+  // Writes {"logs":[...],"cursor":n,"missed":n,"more":bool} with up to
+  // maxEntries entries whose seq is after `since`, oldest first, as many
+  // as fit in `capacity`. Pass the returned "cursor" as `since` next time;
+  // "more" says entries were left for that call and "missed" counts
+  // entries overwritten (or cleared) before they could be sent. since == 0 starts from
+  // the newest maxEntries. Returns the length, or 0 if not even the
+  // envelope fits; `cursorOut` gets the cursor written.
+  size_t writeLogsJSON(char *out, size_t capacity, uint32_t since, int maxEntries,
+                       uint32_t *cursorOut = nullptr) const {
+    // Room kept for closing the array and the trailing fields
+    static constexpr size_t ENVELOPE_TAIL = 64;
+    Lock lock;
+    uint32_t oldestSeq = latestSeq - static_cast<uint32_t>(count) + 1;
+    uint32_t missed = 0;
+    if (since == 0) {
+      uint32_t window = static_cast<uint32_t>(maxEntries > count ? count : maxEntries);
+      since = latestSeq - window;
+    } else if (since > latestSeq) {
+      since = latestSeq;  // Cursor from before a reboot
+    } else if (since + 1 < oldestSeq) {
+      missed = oldestSeq - since - 1;
+      since = oldestSeq - 1;
+    }
+
+    JsonWriter json(out, capacity);
+    json.beginObject();
+    json.beginArray("logs");
+    uint32_t cursor = since;
+    int written = 0;
+    while (cursor < latestSeq && written < maxEntries) {
+      const LogEntry &entry = logs[(writeIndex - static_cast<int>(latestSeq - cursor) + MAX_LOGS) % MAX_LOGS];
+      JsonWriter::Mark beforeEntry = json.mark();
+      json.beginObject();
+      json.fieldUInt("seq", entry.seq);
+      json.fieldUInt("timestamp", entry.timestamp);
+      json.fieldString("level", getLevelName(entry.level));
+      json.fieldString("message", entry.message);
+      json.endObject();
+      if (json.overflowed() || json.length() + ENVELOPE_TAIL > capacity) {
+        json.rewind(beforeEntry);
+        break;
       }
-      
-      json += "\"}";
+      cursor = entry.seq;
+      written++;
     }
-    
-    json += wrapInObject ? "]}" : "]";
-    return json;
+    json.endArray();
+    json.fieldUInt("cursor", cursor);
+    json.fieldUInt("missed", missed);
+    json.fieldBool("more", cursor < latestSeq);
+    json.endObject();
+    if (cursorOut) *cursorOut = cursor;
+    return json.overflowed() ? 0 : json.length();
+  }
+
+  // Seq of the newest entry; 0 before anything is logged
+  uint32_t getLatestSeq() const {
+    Lock lock;
+    return latestSeq;
   }
   
   // Clear all logs
   void clear() {
+    Lock lock;
     writeIndex = 0;
-    count = 0;
+    count = 0;  // latestSeq carries on so client cursors stay valid
   }
   
   // Get log count
   int getCount() const {
+    Lock lock;
     return count;
   }
 };
@@ -0,0 +1,86 @@
+#ifndef FIXED_POINT_HPP
+#define FIXED_POINT_HPP
+
+#include <stdint.h>
+
+// Signed Q16.16 fixed point: 16 integer bits (+/-32768) and a resolution of
+// 1/65536. Arithmetic saturates at the range limits instead of wrapping, so
+// an out-of-range intermediate clamps like the controller output would rather
+// than flipping sign. Conversions from double are explicit; keep them out of
+// hot loops on targets without a double-precision FPU.
+class Q16_16 {
+public:
+  static constexpr int FRACTION_BITS = 16;
+  static constexpr int32_t ONE = static_cast<int32_t>(1) << FRACTION_BITS;
+  static constexpr int32_t RAW_MAX = INT32_MAX;
+  static constexpr int32_t RAW_MIN = INT32_MIN;
+
+  constexpr Q16_16() : raw(0) {}
+  explicit constexpr Q16_16(int32_t value) : raw(saturate(static_cast<int64_t>(value) * ONE)) {}
+  explicit constexpr Q16_16(double value) : raw(fromDouble(value)) {}
+
+  static constexpr Q16_16 fromRaw(int32_t rawValue) { return Q16_16(rawValue, RawTag()); }
+
+  constexpr int32_t getRaw() const { return raw; }
+  constexpr double toDouble() const { return static_cast<double>(raw) / ONE; }
+  explicit constexpr operator double() const { return toDouble(); }
+  explicit constexpr operator float() const { return static_cast<float>(raw) / ONE; }
+
+  // Smallest positive step.
+  static constexpr Q16_16 epsilon() { return fromRaw(1); }
+  static constexpr Q16_16 maxValue() { return fromRaw(RAW_MAX); }
+  static constexpr Q16_16 minValue() { return fromRaw(RAW_MIN); }
+
+  constexpr Q16_16 operator-() const { return fromRaw(saturate(-static_cast<int64_t>(raw))); }
+
+  friend constexpr Q16_16 operator+(Q16_16 a, Q16_16 b) {
+    return fromRaw(saturate(static_cast<int64_t>(a.raw) + b.raw));
+  }
+
+  friend constexpr Q16_16 operator-(Q16_16 a, Q16_16 b) {
+    return fromRaw(saturate(static_cast<int64_t>(a.raw) - b.raw));
+  }
+
+  // Rounded to nearest; the 64-bit product cannot overflow.
+  friend constexpr Q16_16 operator*(Q16_16 a, Q16_16 b) {
+    return fromRaw(saturate((static_cast<int64_t>(a.raw) * b.raw + (ONE >> 1)) >> FRACTION_BITS));
+  }
+
+  // Division by zero saturates toward the sign of the dividend.
+  friend constexpr Q16_16 operator/(Q16_16 a, Q16_16 b) {
+    return b.raw == 0 ? (a.raw < 0 ? minValue() : maxValue())
+                      : fromRaw(saturate((static_cast<int64_t>(a.raw) * ONE) / b.raw));
+  }
+
+  Q16_16 &operator+=(Q16_16 other) { return *this = *this + other; }
+  Q16_16 &operator-=(Q16_16 other) { return *this = *this - other; }
+  Q16_16 &operator*=(Q16_16 other) { return *this = *this * other; }
+  Q16_16 &operator/=(Q16_16 other) { return *this = *this / other; }
+
+  friend constexpr bool operator==(Q16_16 a, Q16_16 b) { return a.raw == b.raw; }
+  friend constexpr bool operator!=(Q16_16 a, Q16_16 b) { return a.raw != b.raw; }
+  friend constexpr bool operator<(Q16_16 a, Q16_16 b) { return a.raw < b.raw; }
+  friend constexpr bool operator<=(Q16_16 a, Q16_16 b) { return a.raw <= b.raw; }
+  friend constexpr bool operator>(Q16_16 a, Q16_16 b) { return a.raw > b.raw; }
+  friend constexpr bool operator>=(Q16_16 a, Q16_16 b) { return a.raw >= b.raw; }
+
+private:
+  struct RawTag {};
+
+  constexpr Q16_16(int32_t rawValue, RawTag) : raw(rawValue) {}
+
+  static constexpr int32_t saturate(int64_t value) {
+    return value > RAW_MAX ? RAW_MAX : (value < RAW_MIN ? RAW_MIN : static_cast<int32_t>(value));
+  }
+
+  static constexpr int32_t fromDouble(double value) {
+    return value != value ? 0
+           : value >= 32768.0 ? RAW_MAX
+           : value <= -32768.0 ? RAW_MIN
+           : saturate(static_cast<int64_t>(value * ONE + (value >= 0.0 ? 0.5 : -0.5)));
+  }
+
+  int32_t raw;
+};
+
+#endif // FIXED_POINT_HPP
@@ -0,0 +1,248 @@
+#ifndef JSON_WRITER_HPP
+#define JSON_WRITER_HPP
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Appends compact JSON to a caller-owned buffer without touching the heap,
+// for payloads sent often enough that a JsonDocument and String per call
+// would churn it. Keys and nesting are the caller's job; the writer only
+// places commas, escapes strings and formats numbers. Once the buffer is
+// full further writes are dropped and overflowed() reports it. The buffer
+// is kept NUL terminated.
+//
+// Doubles are written fixed-point with trailing zeros trimmed, so 205.30
+// at one decimal reads "205.3" and 200.0 reads "200", as ArduinoJson
+// prints the same rounded values. NaN and infinities become null.
+class JsonWriter {
+ public:
+  static constexpr uint8_t MAX_DEPTH = 16;
+
+  JsonWriter(char *buffer, size_t capacity) : buffer(buffer), capacity(capacity) {
+    if (capacity > 0) buffer[0] = '\0';
+  }
+
+  // Without a name: the document itself, or an element of an array
+  void beginObject() {
+    separate();
+    open('{');
+  }
+  void beginObject(const char *name) {
+    key(name);
+    open('{');
+  }
+  void endObject() { close('}'); }
+
+  void beginArray() {
+    separate();
+    open('[');
+  }
+  void beginArray(const char *name) {
+    key(name);
+    open('[');
+  }
+  void endArray() { close(']'); }
+
+  void fieldInt(const char *name, long value) {
+    key(name);
+    writeInt(value);
+  }
+
+  void fieldUInt(const char *name, unsigned long value) {
+    key(name);
+    writeUInt(value);
+  }
+
+  void fieldBool(const char *name, bool value) {
+    key(name);
+    append(value ? "true" : "false");
+  }
+
+  void fieldString(const char *name, const char *value) {
+    key(name);
+    writeString(value ? value : "");
+  }
+
+  void fieldFixed(const char *name, double value, uint8_t decimals) {
+    key(name);
+    writeFixed(value, decimals);
+  }
+
+  // Array elements
+  void elementString(const char *value) {
+    separate();
+    writeString(value ? value : "");
+  }
+
+  void elementInt(long value) {
+    separate();
+    writeInt(value);
+  }
+
+  void elementFixed(double value, uint8_t decimals) {
+    separate();
+    writeFixed(value, decimals);
+  }
+
+  // A position to rewind() to, so a member that does not fit can be
+  // dropped whole and the payload closed with what did fit.
+  struct Mark {
+    size_t used;
+    uint8_t depth;
+    uint16_t hasMembers;
+  };
+
+  Mark mark() const { return Mark{used, depth, hasMembers}; }
+
+  void rewind(const Mark &position) {
+    used = position.used;
+    depth = position.depth;
+    hasMembers = position.hasMembers;
+    overflow = false;
+    if (capacity > 0) buffer[used] = '\0';
+  }
+
+  // Empties the buffer but keeps the nesting, so a document too big for
+  // one buffer can be sent a piece at a time: write, send length() bytes,
+  // reuseBuffer(), write on. The next member still gets its comma.
+  void reuseBuffer() {
+    used = 0;
+    overflow = false;
+    if (capacity > 0) buffer[0] = '\0';
+  }
+
+  size_t length() const { return used; }
+  bool overflowed() const { return overflow; }
+  const char *c_str() const { return buffer; }
+
+ private:
+  char *buffer;
+  size_t capacity;
+  size_t used = 0;
+  bool overflow = false;
+  uint8_t depth = 0;
+  // Bit per nesting level: something has been written at that level
+  uint16_t hasMembers = 0;
+
+  void append(const char *text, size_t length) {
+    if (overflow || used + length + 1 > capacity) {
+      overflow = true;
+      return;
+    }
+    memcpy(buffer + used, text, length);
+    used += length;
+    buffer[used] = '\0';
+  }
+
+  void append(const char *text) { append(text, strlen(text)); }
+
+  void appendChar(char c) { append(&c, 1); }
+
+  // Comma before every member but the first at this level
+  void separate() {
+    uint16_t bit = static_cast<uint16_t>(1u << depth);
+    if (hasMembers & bit) appendChar(',');
+    hasMembers |= bit;
+  }
+
+  void key(const char *name) {
+    separate();
+    writeString(name);
+    appendChar(':');
+  }
+
+  void open(char bracket) {
+    appendChar(bracket);
+    if (depth + 1 >= MAX_DEPTH) {
+      overflow = true;
+      return;
+    }
+    depth++;
+    hasMembers &= static_cast<uint16_t>(~(1u << depth));
+  }
+
+  void close(char bracket) {
+    if (depth > 0) depth--;
+    appendChar(bracket);
+  }
+
+  void writeUInt(unsigned long value) {
+    char digits[20];
+    size_t count = 0;
+    do {
+      digits[sizeof(digits) - 1 - count++] = static_cast<char>('0' + value % 10);
+      value /= 10;
+    } while (value > 0);
+    append(digits + sizeof(digits) - count, count);
+  }
+
+  void writeInt(long value) {
+    if (value < 0) {
+      appendChar('-');
+      writeUInt(0UL - static_cast<unsigned long>(value));
+    } else {
+      writeUInt(static_cast<unsigned long>(value));
+    }
+  }
+
+  void writeFixed(double value, uint8_t decimals) {
+    if (!isfinite(value)) {
+      append("null");
+      return;
+    }
+    if (decimals > 6) decimals = 6;
+    unsigned long scale = 1;
+    for (uint8_t i = 0; i < decimals; i++) scale *= 10;
+    double scaled = round(fabs(value) * scale);
+    if (scaled >= 4294967295.0) {
+      append("null");  // Past 32-bit fixed point; nothing here gets near it
+      return;
+    }
+    unsigned long magnitude = static_cast<unsigned long>(scaled);
+    unsigned long whole = magnitude / scale;
+    unsigned long fraction = magnitude % scale;
+    if (value < 0 && magnitude > 0) appendChar('-');
+    writeUInt(whole);
+    if (fraction == 0) return;
+
+    char digits[7];
+    size_t count = decimals;
+    for (size_t i = count; i-- > 0;) {
+      digits[i] = static_cast<char>('0' + fraction % 10);
+      fraction /= 10;
+    }
+    while (count > 0 && digits[count - 1] == '0') count--;
+    appendChar('.');
+    append(digits, count);
+  }
+
+  void writeString(const char *text) {
+    appendChar('"');
+    const char *run = text;
+    for (const char *p = text; *p; p++) {
+      unsigned char c = static_cast<unsigned char>(*p);
+      if (c >= 0x20 && c != '"' && c != '\\') continue;
+      append(run, static_cast<size_t>(p - run));
+      run = p + 1;
+      switch (c) {
+        case '"': append("\\\""); break;
+        case '\\': append("\\\\"); break;
+        case '\n': append("\\n"); break;
+        case '\r': append("\\r"); break;
+        case '\t': append("\\t"); break;
+        default: {
+          static const char hex[] = "0123456789abcdef";
+          char escaped[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0x0F]};
+          append(escaped, sizeof(escaped));
+          break;
+        }
+      }
+    }
+    append(run, strlen(run));
+    appendChar('"');
+  }
+};
+
+#endif // JSON_WRITER_HPP
@@ -0,0 +1,54 @@
+#ifndef LOG_CURSORS_HPP
+#define LOG_CURSORS_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The last log seq each WebSocket client has been sent, so a broadcast
+// carries only what is new to that client. Cursors are created the first
+// time a client is looked up and dropped by prune() once a broadcast no
+// longer sees the client, so only the broadcasting loop touches the table
+// and it needs no lock. A new cursor starts at 0, which DebugLogger reads
+// as "start from the recent backlog".
+class LogCursors {
+ public:
+  static constexpr size_t MAX_CLIENTS = 16;
+
+  // The cursor for `clientId`, or nullptr when every slot is taken
+  uint32_t *cursorFor(uint32_t clientId) {
+    for (size_t i = 0; i < count; i++) {
+      if (entries[i].clientId == clientId) {
+        entries[i].seen = true;
+        return &entries[i].cursor;
+      }
+    }
+    if (count >= MAX_CLIENTS) return nullptr;
+    entries[count] = Entry{clientId, 0, true};
+    return &entries[count++].cursor;
+  }
+
+  // Drops the clients not looked up since the previous prune()
+  void prune() {
+    size_t kept = 0;
+    for (size_t i = 0; i < count; i++) {
+      if (!entries[i].seen) continue;
+      entries[kept] = entries[i];
+      entries[kept++].seen = false;
+    }
+    count = kept;
+  }
+
+  size_t size() const { return count; }
+
+ private:
+  struct Entry {
+    uint32_t clientId;
+    uint32_t cursor;
+    bool seen;
+  };
+
+  Entry entries[MAX_CLIENTS] = {};
+  size_t count = 0;
+};
+
+#endif // LOG_CURSORS_HPP
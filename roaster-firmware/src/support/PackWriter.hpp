@@ -0,0 +1,156 @@
+#ifndef PACK_WRITER_HPP
+#define PACK_WRITER_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Writes the handful of CBOR (RFC 8949) or MessagePack types the binary
+// telemetry stream needs into a caller-owned buffer: maps with a known
+// number of entries, integers, float32, booleans and UTF-8 strings. Both
+// formats give integers and short strings the smallest header that fits,
+// so one writer covers both with a per-type header choice. Like
+// JsonWriter it never allocates and reports overflow instead of
+// truncating.
+class PackWriter {
+ public:
+  enum Format : uint8_t {
+    FORMAT_CBOR,
+    FORMAT_MSGPACK,
+  };
+
+  PackWriter(Format format, uint8_t *buffer, size_t capacity)
+      : format(format), buffer(buffer), capacity(capacity) {}
+
+  void beginMap(uint32_t entries) {
+    if (format == FORMAT_CBOR) {
+      cborHead(5, entries);
+    } else if (entries < 16) {
+      put(static_cast<uint8_t>(0x80 | entries));
+    } else if (entries <= 0xFFFF) {
+      put(0xDE);
+      putBE(entries, 2);
+    } else {
+      put(0xDF);
+      putBE(entries, 4);
+    }
+  }
+
+  void writeUInt(uint32_t value) {
+    if (format == FORMAT_CBOR) {
+      cborHead(0, value);
+    } else if (value < 0x80) {
+      put(static_cast<uint8_t>(value));
+    } else if (value <= 0xFF) {
+      put(0xCC);
+      put(static_cast<uint8_t>(value));
+    } else if (value <= 0xFFFF) {
+      put(0xCD);
+      putBE(value, 2);
+    } else {
+      put(0xCE);
+      putBE(value, 4);
+    }
+  }
+
+  void writeInt(int32_t value) {
+    if (value >= 0) {
+      writeUInt(static_cast<uint32_t>(value));
+      return;
+    }
+    if (format == FORMAT_CBOR) {
+      // Major type 1 encodes -1 - n
+      cborHead(1, static_cast<uint32_t>(-(value + 1)));
+    } else if (value >= -32) {
+      put(static_cast<uint8_t>(value));  // Negative fixint
+    } else if (value >= -128) {
+      put(0xD0);
+      put(static_cast<uint8_t>(value));
+    } else if (value >= -32768) {
+      put(0xD1);
+      putBE(static_cast<uint16_t>(value), 2);
+    } else {
+      put(0xD2);
+      putBE(static_cast<uint32_t>(value), 4);
+    }
+  }
+
+  void writeFloat(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    put(format == FORMAT_CBOR ? 0xFA : 0xCA);
+    putBE(bits, 4);
+  }
+
+  void writeBool(bool value) {
+    if (format == FORMAT_CBOR) {
+      put(value ? 0xF5 : 0xF4);
+    } else {
+      put(value ? 0xC3 : 0xC2);
+    }
+  }
+
+  void writeNull() { put(format == FORMAT_CBOR ? 0xF6 : 0xC0); }
+
+  void writeString(const char *text) {
+    size_t length = text ? strlen(text) : 0;
+    if (format == FORMAT_CBOR) {
+      cborHead(3, static_cast<uint32_t>(length));
+    } else if (length < 32) {
+      put(static_cast<uint8_t>(0xA0 | length));
+    } else if (length <= 0xFF) {
+      put(0xD9);
+      put(static_cast<uint8_t>(length));
+    } else {
+      put(0xDA);
+      putBE(static_cast<uint32_t>(length), 2);
+    }
+    putBytes(reinterpret_cast<const uint8_t *>(text), length);
+  }
+
+  size_t length() const { return used; }
+  bool overflowed() const { return overflow; }
+
+ private:
+  Format format;
+  uint8_t *buffer;
+  size_t capacity;
+  size_t used = 0;
+  bool overflow = false;
+
+  void put(uint8_t byte) { putBytes(&byte, 1); }
+
+  void putBytes(const uint8_t *data, size_t length) {
+    if (overflow || used + length > capacity) {
+      overflow = true;
+      return;
+    }
+    if (length > 0) memcpy(buffer + used, data, length);
+    used += length;
+  }
+
+  void putBE(uint32_t value, uint8_t bytes) {
+    for (uint8_t shift = bytes; shift-- > 0;) {
+      put(static_cast<uint8_t>(value >> (shift * 8)));
+    }
+  }
+
+  // Major type in the top three bits, then the shortest argument that fits
+  void cborHead(uint8_t major, uint32_t argument) {
+    uint8_t type = static_cast<uint8_t>(major << 5);
+    if (argument < 24) {
+      put(static_cast<uint8_t>(type | argument));
+    } else if (argument <= 0xFF) {
+      put(type | 24);
+      put(static_cast<uint8_t>(argument));
+    } else if (argument <= 0xFFFF) {
+      put(type | 25);
+      putBE(argument, 2);
+    } else {
+      put(type | 26);
+      putBE(argument, 4);
+    }
+  }
+};
+
+#endif // PACK_WRITER_HPP
@@ -0,0 +1,172 @@
+#ifndef PERF_STATS_HPP
+#define PERF_STATS_HPP
+
+#include <Arduino.h>
+
+// Fixed-bucket latency histograms for the loop() timers and the control task.
+// Each PerfChannel tracks two things for one periodic block:
+//   - lateness: how far past its scheduled release the block started
+//   - runtime:  how long the block ran
+// The loop() timers are re-armed when their block ends, so by default a
+// block is released one period after the previous one finished; its own
+// runtime never counts as lateness. Fixed-grid schedules (the control task)
+// pass the release time to start() instead.
+// Block runtime is timed with the CPU cycle counter; release times use
+// micros() because the 32-bit cycle counter wraps every ~18 s at 240 MHz.
+// Recording is a handful of integer ops and never allocates.
+
+namespace PerfClock {
+#ifdef ROASTER_HOST_BUILD
+inline uint32_t cycles() { return static_cast<uint32_t>(micros() * 240UL); }
+inline uint32_t cyclesPerMicro() { return 240; }
+#else
+inline uint32_t cycles() { return ESP.getCycleCount(); }
+inline uint32_t cyclesPerMicro() {
+  static uint32_t mhz = getCpuFrequencyMhz();
+  return mhz > 0 ? mhz : 1;
+}
+#endif
+}
+
+class LatencyHistogram {
+public:
+  // 1-2-5 upper bounds in microseconds; the last bucket is open-ended.
+  static constexpr uint8_t BUCKET_COUNT = 19;
+
+  static uint32_t bucketUpperBoundUs(uint8_t bucket) {
+    static const uint32_t bounds[BUCKET_COUNT - 1] = {
+      10, 20, 50, 100, 200, 500,
+      1000, 2000, 5000, 10000, 20000, 50000,
+      100000, 200000, 500000, 1000000, 2000000, 5000000
+    };
+    return bucket < BUCKET_COUNT - 1 ? bounds[bucket] : 0xFFFFFFFFUL;
+  }
+
+  void reset() {
+    for (uint8_t bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+      counts[bucket] = 0;
+    }
+    samples = 0;
+    maxUs = 0;
+    overruns = 0;
+  }
+
+  void record(uint32_t valueUs, uint32_t budgetUs) {
+    uint8_t bucket = 0;
+    while (bucket < BUCKET_COUNT - 1 && valueUs > bucketUpperBoundUs(bucket)) {
+      bucket++;
+    }
+    counts[bucket]++;
+    samples++;
+    if (valueUs > maxUs) {
+      maxUs = valueUs;
+    }
+    if (budgetUs > 0 && valueUs > budgetUs) {
+      overruns++;
+    }
+  }
+
+  // Upper bound of the bucket holding the requested percentile, clamped to the
+  // observed max so a single sample does not report a bucket edge.
+  uint32_t percentileUs(uint8_t percentile) const {
+    if (samples == 0) {
+      return 0;
+    }
+    uint32_t rank = static_cast<uint32_t>((static_cast<uint64_t>(samples) * percentile + 99) / 100);
+    if (rank == 0) {
+      rank = 1;
+    }
+    uint32_t seen = 0;
+    for (uint8_t bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+      seen += counts[bucket];
+      if (seen >= rank) {
+        uint32_t bound = bucketUpperBoundUs(bucket);
+        return bound < maxUs ? bound : maxUs;
+      }
+    }
+    return maxUs;
+  }
+
+  uint32_t getSamples() const { return samples; }
+  uint32_t getMaxUs() const { return maxUs; }
+  uint32_t getOverruns() const { return overruns; }
+  uint32_t getBucketCount(uint8_t bucket) const { return bucket < BUCKET_COUNT ? counts[bucket] : 0; }
+
+private:
+  uint32_t counts[BUCKET_COUNT] = {};
+  uint32_t samples = 0;
+  uint32_t maxUs = 0;
+  uint32_t overruns = 0;
+};
+
+class PerfChannel {
+public:
+  // periodMs of 0 means the block is not periodic (only runtime is tracked).
+  PerfChannel(const char *name, uint32_t periodMs) : name(name), periodUs(periodMs * 1000UL) {}
+
+  // Called when the block starts. Returns the cycle stamp for finish().
+  uint32_t start() {
+    if (periodUs > 0 && hasLastFinish) {
+      recordLateness(lastFinishUs + periodUs);
+    }
+    return PerfClock::cycles();
+  }
+
+  // For a block released on a fixed grid: releaseUs is the micros() time
+  // this run was scheduled for.
+  uint32_t start(uint32_t releaseUs) {
+    if (periodUs > 0) {
+      recordLateness(releaseUs);
+    }
+    return PerfClock::cycles();
+  }
+
+  void finish(uint32_t startCycles) {
+    uint32_t elapsedCycles = PerfClock::cycles() - startCycles;
+    runtime.record(elapsedCycles / PerfClock::cyclesPerMicro(), periodUs);
+    lastFinishUs = static_cast<uint32_t>(micros());
+    hasLastFinish = true;
+  }
+
+  void reset() {
+    lateness.reset();
+    runtime.reset();
+    hasLastFinish = false;
+  }
+
+  const char *getName() const { return name; }
+  uint32_t getPeriodUs() const { return periodUs; }
+  const LatencyHistogram &getLateness() const { return lateness; }
+  const LatencyHistogram &getRuntime() const { return runtime; }
+
+private:
+  const char *name;
+  uint32_t periodUs;
+  uint32_t lastFinishUs = 0;
+  bool hasLastFinish = false;
+  LatencyHistogram lateness;
+  LatencyHistogram runtime;
+
+  void recordLateness(uint32_t releaseUs) {
+    int32_t lateUs = static_cast<int32_t>(static_cast<uint32_t>(micros()) - releaseUs);
+    lateness.record(lateUs > 0 ? static_cast<uint32_t>(lateUs) : 0, periodUs);
+  }
+};
+
+// Times one block for a channel: `PerfScope scope(perfTick);`
+class PerfScope {
+public:
+  explicit PerfScope(PerfChannel &channel) : channel(channel), startCycles(channel.start()) {}
+  PerfScope(PerfChannel &channel, uint32_t releaseUs)
+      : channel(channel), startCycles(channel.start(releaseUs)) {}
+  ~PerfScope() { channel.finish(startCycles); }
+
+  PerfScope(const PerfScope &) = delete;
+  PerfScope &operator=(const PerfScope &) = delete;
+
+private:
+  PerfChannel &channel;
+  uint32_t startCycles;
+};
+
+#endif // PERF_STATS_HPP
@@ -0,0 +1,58 @@
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+
+#include <Arduino.h>
+
+// Fixed-capacity FIFO with no heap use. When full, push() drops the oldest
+// entry so the newest data always wins, and counts the drop. Not thread-safe:
+// producer and consumer must run on the same task or hold a shared lock.
+template <typename T, size_t Capacity>
+class RingBuffer {
+public:
+  static_assert(Capacity > 0, "RingBuffer capacity must be non-zero");
+
+  void push(const T &value) {
+    if (count == Capacity) {
+      tail = (tail + 1) % Capacity;
+      count--;
+      overflows++;
+    }
+    items[head] = value;
+    head = (head + 1) % Capacity;
+    count++;
+  }
+
+  bool pop(T &value) {
+    if (count == 0) {
+      return false;
+    }
+    value = items[tail];
+    tail = (tail + 1) % Capacity;
+    count--;
+    return true;
+  }
+
+  // index 0 is the oldest entry.
+  const T &peek(size_t index) const { return items[(tail + index) % Capacity]; }
+
+  void clear() {
+    head = 0;
+    tail = 0;
+    count = 0;
+  }
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  bool full() const { return count == Capacity; }
+  static constexpr size_t capacity() { return Capacity; }
+  uint32_t getOverflows() const { return overflows; }
+
+private:
+  T items[Capacity] = {};
+  size_t head = 0;
+  size_t tail = 0;
+  size_t count = 0;
+  uint32_t overflows = 0;
+};
+
+#endif // RING_BUFFER_HPP
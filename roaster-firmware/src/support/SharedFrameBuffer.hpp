@@ -0,0 +1,52 @@
+#ifndef SHARED_FRAME_BUFFER_HPP
+#define SHARED_FRAME_BUFFER_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <vector>
+
+// The payload buffer for a message that goes to every WebSocket client.
+// AsyncWebSocket::textAll() takes a std::shared_ptr<std::vector<uint8_t>>
+// (AsyncWebSocketSharedBuffer) and each client queue keeps a reference
+// until that client has sent it, so one buffer serves all clients. Once
+// every queue has let go, the next acquire() hands the same vector back
+// and its reserved capacity is reused. Only when a slow client still
+// holds the last frame is a new buffer allocated, and the old one is freed
+// when that client catches up.
+class SharedFrameBuffer {
+ public:
+  typedef std::shared_ptr<std::vector<uint8_t>> Frame;
+
+  explicit SharedFrameBuffer(size_t capacity) : capacity(capacity) { frame = allocate(); }
+
+  // A frame of `capacity` bytes to write into; resize() it to the
+  // payload length before sending.
+  Frame acquire() {
+    // use_count() can only drop while we look: the clients release frames,
+    // and nobody else takes new references to it.
+    if (frame.use_count() > 1) {
+      frame = allocate();
+      replacements++;
+    }
+    frame->resize(capacity);
+    return frame;
+  }
+
+  size_t getCapacity() const { return capacity; }
+  // New buffers allocated because a client still held the previous one
+  uint32_t replacementCount() const { return replacements; }
+
+ private:
+  size_t capacity;
+  Frame frame;
+  uint32_t replacements = 0;
+
+  Frame allocate() {
+    Frame fresh = std::make_shared<std::vector<uint8_t>>();
+    fresh->reserve(capacity);
+    return fresh;
+  }
+};
+
+#endif // SHARED_FRAME_BUFFER_HPP
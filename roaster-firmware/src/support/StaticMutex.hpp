@@ -0,0 +1,54 @@
+#ifndef STATIC_MUTEX_HPP
+#define STATIC_MUTEX_HPP
+
+#ifndef ROASTER_HOST_BUILD
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
+// Scoped lock on one FreeRTOS mutex per Tag, created on first use. A class
+// whose state is shared between tasks declares
+//
+//   using Lock = StaticMutexLock<ItsClass>;
+//
+// and takes `Lock lock;` around every access; all instances of the class
+// share the mutex. Recursive mutexes, as ControlLock uses, let helpers that
+// lock call each other. A no-op on the single-threaded host build.
+template <typename Tag, bool Recursive = false>
+class StaticMutexLock {
+ public:
+  StaticMutexLock() {
+#ifndef ROASTER_HOST_BUILD
+    if (Recursive) {
+      xSemaphoreTakeRecursive(handle(), portMAX_DELAY);
+    } else {
+      xSemaphoreTake(handle(), portMAX_DELAY);
+    }
+#endif
+  }
+  ~StaticMutexLock() {
+#ifndef ROASTER_HOST_BUILD
+    if (Recursive) {
+      xSemaphoreGiveRecursive(handle());
+    } else {
+      xSemaphoreGive(handle());
+    }
+#endif
+  }
+
+  StaticMutexLock(const StaticMutexLock &) = delete;
+  StaticMutexLock &operator=(const StaticMutexLock &) = delete;
+
+ private:
+#ifndef ROASTER_HOST_BUILD
+  static SemaphoreHandle_t handle() {
+    static SemaphoreHandle_t mutex = Recursive ? xSemaphoreCreateRecursiveMutex() : xSemaphoreCreateMutex();
+    return mutex;
+  }
+#endif
+};
+
+template <typename Tag>
+using RecursiveStaticMutexLock = StaticMutexLock<Tag, true>;
+
+#endif // STATIC_MUTEX_HPP
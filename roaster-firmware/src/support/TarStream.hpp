@@ -0,0 +1,234 @@
+#ifndef TAR_STREAM_HPP
+#define TAR_STREAM_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Just enough of the POSIX ustar format to move a directory of small files
+// through HTTP without holding the archive: a reader that takes the archive
+// in whatever chunks the network delivers, and the header and padding
+// helpers a writer needs. `tar cf` from GNU tar and bsdtar both produce
+// archives the reader accepts; pax and GNU long-name records are skipped.
+static constexpr size_t TAR_BLOCK_SIZE = 512;
+
+// Bytes of zero padding after a member of `size` bytes
+inline size_t tarPadding(uint32_t size) {
+  return (TAR_BLOCK_SIZE - size % TAR_BLOCK_SIZE) % TAR_BLOCK_SIZE;
+}
+
+inline void tarWriteOctal(uint8_t *field, size_t width, uint32_t value) {
+  // width - 1 digits, NUL terminated
+  field[width - 1] = '\0';
+  for (size_t index = width - 1; index-- > 0;) {
+    field[index] = static_cast<uint8_t>('0' + (value & 7));
+    value >>= 3;
+  }
+}
+
+inline uint32_t tarChecksum(const uint8_t *block) {
+  uint32_t sum = 0;
+  for (size_t index = 0; index < TAR_BLOCK_SIZE; index++) {
+    // The checksum field itself counts as spaces
+    sum += (index >= 148 && index < 156) ? ' ' : block[index];
+  }
+  return sum;
+}
+
+// Fills `block` with the header for a regular file. Fails for names over
+// 100 bytes; the prefix field is not used.
+inline bool tarWriteHeader(uint8_t *block, const char *name, uint32_t size, uint32_t mtime) {
+  size_t nameLength = strlen(name);
+  if (nameLength == 0 || nameLength > 100) {
+    return false;
+  }
+  memset(block, 0, TAR_BLOCK_SIZE);
+  memcpy(block, name, nameLength);
+  tarWriteOctal(block + 100, 8, 0644);  // mode
+  tarWriteOctal(block + 108, 8, 0);     // uid
+  tarWriteOctal(block + 116, 8, 0);     // gid
+  tarWriteOctal(block + 124, 12, size);
+  tarWriteOctal(block + 136, 12, mtime);
+  block[156] = '0';
+  memcpy(block + 257, "ustar", 6);
+  memcpy(block + 263, "00", 2);
+  // Six digits, NUL, space: the layout GNU tar writes
+  tarWriteOctal(block + 148, 7, tarChecksum(block));
+  block[155] = ' ';
+  return true;
+}
+
+// Feeds an archive through a sink, one member at a time. The sink provides
+//   bool beginFile(const char *name, uint32_t size)  false skips the member
+//   void fileData(const uint8_t *data, size_t length)
+//   void endFile()
+// and only sees regular files. Only the current header block is buffered.
+class TarReader {
+ public:
+  static constexpr size_t MAX_NAME_LENGTH = 255;
+
+  enum Error : uint8_t {
+    ERROR_NONE = 0,
+    ERROR_CHECKSUM,
+    ERROR_SIZE,
+  };
+
+  // Consumes `length` bytes; false once the archive is found to be corrupt,
+  // after which further input is ignored.
+  template <typename Sink>
+  bool feed(const uint8_t *data, size_t length, Sink &sink) {
+    while (length > 0 && state != STATE_FAILED) {
+      size_t step = 0;
+      switch (state) {
+        case STATE_HEADER:
+          step = length < TAR_BLOCK_SIZE - filled ? length : TAR_BLOCK_SIZE - filled;
+          memcpy(block + filled, data, step);
+          filled += step;
+          if (filled == TAR_BLOCK_SIZE) {
+            filled = 0;
+            parseHeader(sink);
+          }
+          break;
+        case STATE_DATA:
+          step = length < remaining ? length : remaining;
+          if (wanted) sink.fileData(data, step);
+          remaining -= step;
+          if (remaining == 0) finishMember(sink);
+          break;
+        case STATE_PADDING:
+          step = length < remaining ? length : remaining;
+          remaining -= step;
+          if (remaining == 0) state = STATE_HEADER;
+          break;
+        case STATE_END:
+        case STATE_FAILED:
+          step = length;
+          break;
+      }
+      data += step;
+      length -= step;
+    }
+    return state != STATE_FAILED;
+  }
+
+  // True at the end-of-archive marker, or between members when the archive
+  // stops without one.
+  bool complete() const {
+    return state == STATE_END || (state == STATE_HEADER && filled == 0 && members > 0);
+  }
+
+  bool failed() const { return state == STATE_FAILED; }
+  Error error() const { return lastError; }
+  uint32_t memberCount() const { return members; }
+
+  void reset() {
+    state = STATE_HEADER;
+    lastError = ERROR_NONE;
+    filled = 0;
+    remaining = 0;
+    members = 0;
+    wanted = false;
+  }
+
+ private:
+  enum State : uint8_t {
+    STATE_HEADER,
+    STATE_DATA,
+    STATE_PADDING,
+    STATE_END,
+    STATE_FAILED,
+  };
+
+  uint8_t block[TAR_BLOCK_SIZE];
+  char name[MAX_NAME_LENGTH + 1];
+  State state = STATE_HEADER;
+  Error lastError = ERROR_NONE;
+  size_t filled = 0;
+  uint32_t remaining = 0;
+  uint32_t padding = 0;
+  uint32_t members = 0;
+  bool wanted = false;
+
+  static bool readOctal(const uint8_t *field, size_t width, uint32_t &value) {
+    value = 0;
+    size_t index = 0;
+    while (index < width && field[index] == ' ') index++;
+    bool digits = false;
+    for (; index < width && field[index] >= '0' && field[index] <= '7'; index++) {
+      if (value > (UINT32_MAX >> 3)) return false;
+      value = (value << 3) | static_cast<uint32_t>(field[index] - '0');
+      digits = true;
+    }
+    // Anything after the digits must be a terminator
+    return digits && (index == width || field[index] == '\0' || field[index] == ' ');
+  }
+
+  void fail(Error error) {
+    state = STATE_FAILED;
+    lastError = error;
+  }
+
+  template <typename Sink>
+  void parseHeader(Sink &sink) {
+    bool empty = true;
+    for (size_t index = 0; index < TAR_BLOCK_SIZE && empty; index++) {
+      empty = block[index] == 0;
+    }
+    if (empty) {
+      state = STATE_END;
+      return;
+    }
+
+    uint32_t checksum = 0;
+    if (!readOctal(block + 148, 8, checksum) || checksum != tarChecksum(block)) {
+      fail(ERROR_CHECKSUM);
+      return;
+    }
+    uint32_t size = 0;
+    if (!readOctal(block + 124, 12, size)) {
+      fail(ERROR_SIZE);  // Base-256 sizes are for files over 8 GB
+      return;
+    }
+
+    members++;
+    remaining = size;
+    padding = static_cast<uint32_t>(tarPadding(size));
+    char type = static_cast<char>(block[156]);
+    wanted = false;
+    if (type == '0' || type == '\0') {
+      buildName();
+      wanted = sink.beginFile(name, size);
+    }
+    if (size == 0) {
+      finishMember(sink);
+    } else {
+      state = STATE_DATA;
+    }
+  }
+
+  template <typename Sink>
+  void finishMember(Sink &sink) {
+    if (wanted) sink.endFile();
+    wanted = false;
+    remaining = padding;
+    state = padding > 0 ? STATE_PADDING : STATE_HEADER;
+  }
+
+  // ustar splits long paths into prefix "/" name
+  void buildName() {
+    size_t length = 0;
+    bool ustar = memcmp(block + 257, "ustar", 5) == 0;
+    if (ustar && block[345] != '\0') {
+      for (size_t index = 0; index < 155 && block[345 + index] != '\0'; index++) {
+        name[length++] = static_cast<char>(block[345 + index]);
+      }
+      name[length++] = '/';
+    }
+    for (size_t index = 0; index < 100 && block[index] != '\0'; index++) {
+      name[length++] = static_cast<char>(block[index]);
+    }
+    name[length] = '\0';
+  }
+};
+
+#endif // TAR_STREAM_HPP
@@ -0,0 +1,52 @@
+#ifndef VARINT_HPP
+#define VARINT_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+// LEB128 varints (7 bits per byte, low group first, high bit set on all but
+// the last byte) as used by protobuf, with zigzag mapping for signed values
+// so small negative deltas stay one byte.
+inline uint64_t zigzagEncode(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t zigzagDecode(uint64_t value) {
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+inline size_t varintSize(uint64_t value) {
+  size_t size = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    size++;
+  }
+  return size;
+}
+
+// Writes `value` at `out` and returns the byte after it. The caller sizes the
+// buffer with varintSize().
+inline uint8_t *writeVarint(uint8_t *out, uint64_t value) {
+  while (value >= 0x80) {
+    *out++ = static_cast<uint8_t>(value) | 0x80;
+    value >>= 7;
+  }
+  *out++ = static_cast<uint8_t>(value);
+  return out;
+}
+
+// Reads one varint starting at `cursor` and advances past it. Fails without
+// reading past `end`, and on encodings longer than ten bytes.
+inline bool readVarint(const uint8_t *&cursor, const uint8_t *end, uint64_t &value) {
+  value = 0;
+  for (uint8_t shift = 0; shift < 64 && cursor < end; shift += 7) {
+    uint8_t byte = *cursor++;
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+#endif // VARINT_HPP
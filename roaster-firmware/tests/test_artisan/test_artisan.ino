@@ -0,0 +1,166 @@
+/**
+ * Artisan Stream Tests
+ *
+ * Tests for the Artisan getData replies and push frames on /WebSocket
+ * including:
+ * - Replies echo numeric and string ids, or leave out a missing one
+ * - Push frames carry the same data object plus a timestamp
+ * - Payloads that do not fit are reported instead of truncated
+ * - Push intervals are clamped and each subscriber runs on its own
+ * - Subscribers are dropped on request and when every slot is taken
+ */
+
+#include <AUnit.h>
+#include "../../src/network/ArtisanStream.hpp"
+
+using namespace aunit;
+
+static ArtisanReading sampleReading()
+{
+  ArtisanReading reading;
+  reading.bt = 385.264;
+  reading.st = 390.0;
+  reading.fs = 78;
+  reading.ft = 512.05;
+  reading.ror = -1.5;
+  return reading;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Payload Tests
+// ============================================================================
+
+test(Artisan_ReplyEchoesNumericId)
+{
+  char out[ARTISAN_JSON_CAPACITY];
+  ArtisanRequestId id;
+  id.present = true;
+  id.number = 48213;
+  size_t length = writeArtisanReply(sampleReading(), id, out, sizeof(out));
+  assertEqual(String("{\"id\":48213,\"data\":{\"bt\":385.26,\"st\":390,\"fs\":78,\"ft\":512.05,\"ror\":-1.5}}"),
+              String(out));
+  assertEqual(strlen(out), length);
+}
+
+test(Artisan_ReplyEchoesStringIdOrNone)
+{
+  char out[ARTISAN_JSON_CAPACITY];
+  ArtisanRequestId id;
+  writeArtisanReply(sampleReading(), id, out, sizeof(out));
+  assertEqual(String("{\"data\":{\"bt\":385.26,\"st\":390,\"fs\":78,\"ft\":512.05,\"ror\":-1.5}}"), String(out));
+
+  id.present = true;
+  id.text = "req-\"7\"";
+  writeArtisanReply(sampleReading(), id, out, sizeof(out));
+  assertTrue(strncmp(out, "{\"id\":\"req-\\\"7\\\"\",\"data\":{", 25) == 0);
+}
+
+test(Artisan_PushFrameCarriesTimestamp)
+{
+  char out[ARTISAN_JSON_CAPACITY];
+  writeArtisanPush(sampleReading(), 61250, out, sizeof(out));
+  assertEqual(String("{\"push\":\"data\",\"ts\":61250,\"data\":{\"bt\":385.26,\"st\":390,\"fs\":78,\"ft\":512.05,\"ror\":-1.5}}"),
+              String(out));
+}
+
+test(Artisan_OverflowIsReported)
+{
+  char out[40];
+  ArtisanRequestId id;
+  assertEqual((size_t)0, writeArtisanReply(sampleReading(), id, out, sizeof(out)));
+  assertEqual((size_t)0, writeArtisanPush(sampleReading(), 1, out, sizeof(out)));
+}
+
+// ============================================================================
+// Push Subscriber Tests
+// ============================================================================
+
+test(ArtisanPush_IntervalsAreClamped)
+{
+  assertEqual((uint32_t)0, ArtisanPushSubscribers::clampInterval(0));
+  assertEqual((uint32_t)0, ArtisanPushSubscribers::clampInterval(-5));
+  assertEqual(ARTISAN_PUSH_MIN_INTERVAL_MS, ArtisanPushSubscribers::clampInterval(10));
+  assertEqual((uint32_t)750, ArtisanPushSubscribers::clampInterval(750));
+  assertEqual(ARTISAN_PUSH_MAX_INTERVAL_MS, ArtisanPushSubscribers::clampInterval(600000));
+}
+
+test(ArtisanPush_EachSubscriberRunsOnItsOwnInterval)
+{
+  ArtisanPushSubscribers subscribers;
+  uint32_t due[ArtisanPushSubscribers::MAX_SUBSCRIBERS];
+  subscribers.subscribe(1, 250, 1000);
+  subscribers.subscribe(2, 1000, 1000);
+
+  // Both get a frame straight away
+  assertEqual((size_t)2, subscribers.takeDue(1000, due));
+  assertEqual((size_t)0, subscribers.takeDue(1100, due));
+
+  int fast = 0;
+  int slow = 0;
+  for (unsigned long now = 1010; now <= 3000; now += 10)
+  {
+    size_t count = subscribers.takeDue(now, due);
+    for (size_t i = 0; i < count; i++)
+    {
+      if (due[i] == 1)
+        fast++;
+      else
+        slow++;
+    }
+  }
+  // Due at 1250, 1500, ... 3000 and at 2000, 3000
+  assertEqual(8, fast);
+  assertEqual(2, slow);
+}
+
+test(ArtisanPush_LateLoopDoesNotBurst)
+{
+  ArtisanPushSubscribers subscribers;
+  uint32_t due[ArtisanPushSubscribers::MAX_SUBSCRIBERS];
+  subscribers.subscribe(5, 250, 0);
+  assertEqual((size_t)1, subscribers.takeDue(0, due));
+
+  // loop() stalled for two seconds: one frame, then back on the interval
+  assertEqual((size_t)1, subscribers.takeDue(2000, due));
+  assertEqual((size_t)0, subscribers.takeDue(2100, due));
+  assertEqual((size_t)1, subscribers.takeDue(2250, due));
+}
+
+test(ArtisanPush_UnsubscribeAndCapacity)
+{
+  ArtisanPushSubscribers subscribers;
+  uint32_t due[ArtisanPushSubscribers::MAX_SUBSCRIBERS];
+  for (uint32_t id = 0; id < ArtisanPushSubscribers::MAX_SUBSCRIBERS; id++)
+  {
+    assertTrue(subscribers.subscribe(id, 1000, 0));
+  }
+  assertFalse(subscribers.subscribe(99, 1000, 0));
+
+  // Changing the interval of a subscriber reuses its slot
+  assertTrue(subscribers.subscribe(3, 500, 0));
+  assertEqual(ArtisanPushSubscribers::MAX_SUBSCRIBERS, subscribers.size());
+
+  subscribers.unsubscribe(3);
+  subscribers.unsubscribe(42);
+  assertEqual(ArtisanPushSubscribers::MAX_SUBSCRIBERS - 1, subscribers.size());
+  size_t count = subscribers.takeDue(0, due);
+  assertEqual(ArtisanPushSubscribers::MAX_SUBSCRIBERS - 1, count);
+  for (size_t i = 0; i < count; i++)
+  {
+    assertTrue(due[i] != 3);
+  }
+  assertTrue(subscribers.subscribe(99, 1000, 0));
+}
@@ -0,0 +1,341 @@
+/**
+ * Chunked JSON Response Tests
+ *
+ * Tests for the streamed calibration and profile responses including:
+ * - JsonWriter separates anonymous array elements and keeps its nesting
+ *   across reuseBuffer()
+ * - The same document comes out whatever chunk size the server asks for
+ * - A full 500-sample calibration trace streams without touching the heap
+ * - A trace cleared while it is being sent ends the array early, still valid
+ * - The trace, status and profile payloads keep the layout the UI reads
+ */
+
+#include <AUnit.h>
+#include <new>
+#include <stdlib.h>
+#include "../../src/network/ChunkedJson.hpp"
+
+using namespace aunit;
+
+// Counts every operator new so the trace test can show that streaming
+// allocates nothing past the stream itself.
+static volatile uint32_t heapAllocations = 0;
+
+void *operator new(size_t size)
+{
+  heapAllocations++;
+  void *block = malloc(size ? size : 1);
+  if (block == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return block;
+}
+
+void operator delete(void *block) noexcept
+{
+  free(block);
+}
+
+void operator delete(void *block, size_t) noexcept
+{
+  free(block);
+}
+
+// Drains a stream the way beginChunkedResponse does, chunkSize bytes a call
+static String drain(ChunkedJsonStream &stream, size_t chunkSize)
+{
+  String out;
+  uint8_t chunk[1024];
+  size_t got;
+  while ((got = stream.read(chunk, chunkSize)) > 0)
+  {
+    for (size_t i = 0; i < got; i++)
+    {
+      out += static_cast<char>(chunk[i]);
+    }
+  }
+  return out;
+}
+
+static int occurrences(const String &text, const char *needle)
+{
+  int count = 0;
+  int from = 0;
+  int found;
+  while ((found = text.indexOf(needle, from)) >= 0)
+  {
+    count++;
+    from = found + 1;
+  }
+  return count;
+}
+
+// Runs the tuner through a stabilise phase and into a slow heat-up that
+// never settles, until the trace holds `samples` points.
+static void recordTrace(StepResponseTuner &tuner, uint16_t samples)
+{
+  tuner.start(100.0, 8.0, 0.46, 0.0, 180.0, 0.8);
+  for (int i = 0; i < 200 && String(tuner.getPhaseName()).startsWith("STABILIZE"); i++)
+  {
+    tuner.getOutput(100.0, 70.0, 180.0);
+    delay(250);
+  }
+  double temp = 100.0;
+  for (int i = 0; i < 2000 && tuner.isRunning() && tuner.getTraceSampleCount() < samples; i++)
+  {
+    temp += 0.02;
+    tuner.getOutput(temp, 70.0, 180.0);
+    delay(250);
+  }
+}
+
+static RoastProfile makeProfile(int points)
+{
+  RoastProfile profile;
+  for (int i = 1; i <= points; i++)
+  {
+    profile.addSetpoint(static_cast<uint32_t>(i) * 2000, 200 + i % 250, 50 + i % 50);
+  }
+  return profile;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial);
+  delay(1000);
+  TestRunner::setTimeout(60);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// JSON WRITER
+// ============================================================================
+
+test(ChunkedJson_WriterSeparatesAnonymousElements)
+{
+  char buffer[128];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.beginArray("rows");
+  json.beginObject();
+  json.fieldInt("a", 1);
+  json.endObject();
+  json.beginObject();
+  json.fieldInt("a", 2);
+  json.endObject();
+  json.beginArray();
+  json.elementInt(-3);
+  json.elementFixed(4.50, 2);
+  json.endArray();
+  json.endArray();
+  json.endObject();
+
+  assertFalse(json.overflowed());
+  assertEqual(String(json.c_str()), String("{\"rows\":[{\"a\":1},{\"a\":2},[-3,4.5]]}"));
+}
+
+test(ChunkedJson_ReuseBufferKeepsNesting)
+{
+  char buffer[32];
+  JsonWriter json(buffer, sizeof(buffer));
+  String out;
+
+  json.beginObject();
+  json.beginArray("v");
+  json.elementInt(1);
+  out += json.c_str();
+  json.reuseBuffer();
+  assertEqual((int)json.length(), 0);
+
+  json.elementInt(2);
+  json.endArray();
+  json.fieldBool("ok", true);
+  json.endObject();
+  out += json.c_str();
+
+  assertEqual(out, String("{\"v\":[1,2],\"ok\":true}"));
+}
+
+// ============================================================================
+// STREAMING
+// ============================================================================
+
+test(ChunkedJson_SameDocumentForAnyChunkSize)
+{
+  StepResponseTuner tuner;
+  recordTrace(tuner, 40);
+  assertTrue(tuner.getTraceSampleCount() >= 40);
+
+  StepTraceJsonStream whole(tuner);
+  String expected = drain(whole, 1024);
+  assertTrue(whole.done());
+
+  const size_t sizes[] = {1, 7, 64, 500};
+  for (size_t size : sizes)
+  {
+    StepTraceJsonStream stream(tuner);
+    assertEqual(drain(stream, size), expected);
+    assertFalse(stream.overflowed());
+  }
+}
+
+test(ChunkedJson_FullTraceStreamsWithoutHeap)
+{
+  StepResponseTuner tuner;
+  recordTrace(tuner, StepResponseTuner::MAX_SAMPLES);
+  uint16_t count = tuner.getTraceSampleCount();
+  assertTrue(count >= 400);
+
+  StepTraceJsonStream stream(tuner);
+  uint8_t chunk[1436];  // About one TCP segment, what the server asks for
+  size_t total = 0;
+  size_t got;
+  uint32_t before = heapAllocations;
+  while ((got = stream.read(chunk, sizeof(chunk))) > 0)
+  {
+    total += got;
+  }
+  uint32_t allocations = heapAllocations - before;
+
+  assertEqual(allocations, (uint32_t)0);
+  assertFalse(stream.overflowed());
+  // Many times the piece buffer went out through it
+  assertTrue(total > 20 * CHUNKED_JSON_PIECE_CAPACITY);
+}
+
+test(ChunkedJson_TraceClearedMidStreamEndsArray)
+{
+  StepResponseTuner tuner;
+  recordTrace(tuner, 60);
+  uint16_t count = tuner.getTraceSampleCount();
+  assertTrue(count >= 60);
+
+  StepTraceJsonStream stream(tuner);
+  uint8_t chunk[256];
+  String out;
+  size_t got = stream.read(chunk, sizeof(chunk));
+  for (size_t i = 0; i < got; i++)
+  {
+    out += static_cast<char>(chunk[i]);
+  }
+
+  // A new calibration starts while the response is still going out and
+  // records as many samples again
+  recordTrace(tuner, count);
+  assertTrue(tuner.getTraceSampleCount() >= count);
+  out += drain(stream, sizeof(chunk));
+
+  assertTrue(stream.done());
+  assertFalse(stream.overflowed());
+  assertTrue(out.endsWith("}]}"));
+  int sent = occurrences(out, "{\"elapsedSeconds\":");
+  assertTrue(sent > 0);
+  assertTrue(sent < (int)count);
+  assertEqual(occurrences(out, "},{"), sent - 1);
+}
+
+// ============================================================================
+// PAYLOADS
+// ============================================================================
+
+test(ChunkedJson_TraceLayout)
+{
+  StepResponseTuner tuner;
+  recordTrace(tuner, 12);
+  uint16_t count = tuner.getTraceSampleCount();
+
+  StepTraceJsonStream stream(tuner);
+  String out = drain(stream, 100);
+
+  assertTrue(out.startsWith("{\"running\":true,\"method\":\"step_response\",\"phase\":\""));
+  assertTrue(out.indexOf("\"bandIndex\":1,\"samples\":[{\"elapsedSeconds\":") > 0);
+  assertTrue(out.endsWith("}]}"));
+  assertEqual(occurrences(out, "{\"elapsedSeconds\":"), (int)count);
+  assertEqual(occurrences(out, "},{"), (int)count - 1);
+  assertTrue(out.indexOf(",\"phaseId\":") > 0);
+}
+
+test(ChunkedJson_EmptyTrace)
+{
+  StepResponseTuner tuner;
+  StepTraceJsonStream stream(tuner);
+  assertEqual(drain(stream, 64),
+              String("{\"running\":false,\"method\":\"step_response\",\"phase\":\"IDLE\","
+                     "\"bandIndex\":1,\"samples\":[]}"));
+}
+
+test(ChunkedJson_StatusLayout)
+{
+  StepResponseTuner idle;
+  StepStatusJsonStream idleStream(idle, 8.0, 0.46, 0.0);
+  String out = drain(idleStream, 64);
+  assertTrue(out.startsWith("{\"running\":false,\"complete\":false,\"phase\":\"IDLE\","
+                            "\"progressPercent\":0,\"sampleCount\":0,\"lastError\":\"none\","
+                            "\"method\":\"step_response\",\"model\":{\"valid\":false,"));
+  assertTrue(out.endsWith(",\"bands\":[],\"cycles\":[]}}"));
+
+  StepResponseTuner running;
+  recordTrace(running, 10);
+  StepResponseTuner::Summary summary = running.getSummary();
+  assertTrue(summary.totalBands > 0);
+
+  StepStatusJsonStream stream(running, 8.0, 0.46, 0.0);
+  out = drain(stream, 33);
+  assertFalse(stream.overflowed());
+  assertTrue(out.startsWith("{\"running\":true,\"complete\":false,"));
+  assertTrue(out.indexOf("\"bands\":[{\"index\":1,\"valid\":") > 0);
+  assertTrue(out.indexOf("\"cycles\":[{\"index\":1,\"valid\":") > 0);
+  assertEqual(occurrences(out, "{\"index\":"), 2 * (int)summary.totalBands);
+  // Gains in force are only reported once calibration completes
+  assertEqual(occurrences(out, ",\"kp\":8"), 0);
+  assertTrue(out.endsWith("]}}"));
+}
+
+test(ChunkedJson_ProfileLayout)
+{
+  RoastProfile profile;
+  profile.addSetpoint(30000, 300, 80);
+  profile.addSetpoint(90500, 400, 70);
+  profile.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+
+  ProfileJsonStream stream("p1", "Light \"City\"", true, std::move(profile));
+  assertEqual(drain(stream, 16),
+              String("{\"id\":\"p1\",\"name\":\"Light \\\"City\\\"\",\"active\":true,"
+                     "\"interpolation\":\"pchip\",\"setpoints\":["
+                     "{\"time\":30,\"temp\":300,\"fanSpeed\":80},"
+                     "{\"time\":90.5,\"temp\":400,\"fanSpeed\":70}]}"));
+}
+
+test(ChunkedJson_LargestProfileStreams)
+{
+  ProfileJsonStream stream("big", "Big", false,
+                           makeProfile(RoastProfile::MAX_SETPOINTS - 1));
+  String out = drain(stream, 1);
+
+  assertFalse(stream.overflowed());
+  assertTrue(out.startsWith("{\"id\":\"big\",\"name\":\"Big\",\"active\":false,"
+                            "\"interpolation\":\"linear\",\"setpoints\":[{\"time\":2,"));
+  assertEqual(occurrences(out, "{\"time\":"), (int)RoastProfile::MAX_SETPOINTS - 1);
+  assertTrue(out.endsWith("}]}"));
+}
+
+test(ChunkedJson_LongProfileNameFits)
+{
+  String name;
+  for (int i = 0; i < 200; i++)
+  {
+    name += '\x01';  // Worst case: every byte needs a \u escape
+  }
+  ProfileJsonStream stream("long", name, false, makeProfile(3));
+  String out = drain(stream, 256);
+
+  assertFalse(stream.overflowed());
+  assertEqual(occurrences(out, "\\u0001"), 200);
+  assertTrue(out.endsWith("}]}"));
+}
@@ -0,0 +1,204 @@
+/**
+ * Control Task Scheduling Tests
+ *
+ * Tests for the fixed-period control task scheduler including:
+ * - Releases stay on a fixed grid (no cumulative drift)
+ * - Late cycles skip missed releases instead of bursting
+ * - Overrun and lateness accounting
+ * - 32-bit micros() wraparound
+ * - Polled ControlTask cadence (same path loop() uses without the task)
+ */
+
+#include <AUnit.h>
+#include "../../src/platform/ControlTask.hpp"
+
+using namespace aunit;
+
+#define PERIOD_US 125000UL
+
+int cycleCount = 0;
+unsigned long cycleBusyMs = 0;
+
+void countingCycle(unsigned long now)
+{
+  (void)now;
+  cycleCount++;
+  if (cycleBusyMs > 0)
+  {
+    delay(cycleBusyMs);
+  }
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// PeriodicSchedule Tests
+// ============================================================================
+
+test(Schedule_FirstReleaseIsImmediate)
+{
+  PeriodicSchedule schedule;
+  schedule.start(1000, PERIOD_US);
+
+  assertTrue(schedule.isDue(1000));
+  assertEqual(0UL, (unsigned long)schedule.microsUntilDue(1000));
+}
+
+test(Schedule_ReleasesStayOnGrid)
+{
+  PeriodicSchedule schedule;
+  schedule.start(0, PERIOD_US);
+
+  // Start each cycle a little late; the next release must not move.
+  for (uint32_t cycle = 0; cycle < 8; cycle++)
+  {
+    uint32_t releaseUs = schedule.beginCycle(cycle * PERIOD_US + 3000);
+    assertEqual((unsigned long)(cycle * PERIOD_US), (unsigned long)releaseUs);
+    assertEqual((unsigned long)((cycle + 1) * PERIOD_US), (unsigned long)schedule.getNextReleaseUs());
+  }
+
+  PeriodicSchedule::Stats stats = schedule.getStats();
+  assertEqual(8UL, (unsigned long)stats.cycles);
+  assertEqual(0UL, (unsigned long)stats.skippedReleases);
+  assertEqual(3000UL, (unsigned long)stats.maxLatenessUs);
+}
+
+test(Schedule_SkipsMissedReleases)
+{
+  PeriodicSchedule schedule;
+  schedule.start(0, PERIOD_US);
+  schedule.beginCycle(0);
+
+  // Woken at 300ms: the 125ms release runs late, the 250ms one is skipped.
+  assertFalse(schedule.isDue(PERIOD_US - 1));
+  assertTrue(schedule.isDue(300000));
+  uint32_t releaseUs = schedule.beginCycle(300000);
+
+  assertEqual(PERIOD_US, (unsigned long)releaseUs);
+  assertEqual(3 * PERIOD_US, (unsigned long)schedule.getNextReleaseUs());
+  assertEqual(1UL, (unsigned long)schedule.getStats().skippedReleases);
+  assertEqual(175000UL, (unsigned long)schedule.getStats().lastLatenessUs);
+}
+
+test(Schedule_CountsOverruns)
+{
+  PeriodicSchedule schedule;
+  schedule.start(0, PERIOD_US);
+
+  schedule.beginCycle(0);
+  schedule.endCycle(0, 2000);
+  schedule.beginCycle(PERIOD_US);
+  schedule.endCycle(PERIOD_US, PERIOD_US + PERIOD_US + 500);
+
+  PeriodicSchedule::Stats stats = schedule.getStats();
+  assertEqual(1UL, (unsigned long)stats.overruns);
+  assertEqual(PERIOD_US + 500, (unsigned long)stats.maxExecutionUs);
+  assertEqual(PERIOD_US + 500, (unsigned long)stats.lastExecutionUs);
+}
+
+test(Schedule_HandlesMicrosWraparound)
+{
+  PeriodicSchedule schedule;
+  uint32_t startUs = 0xFFFFFFFFUL - 50000UL;
+  schedule.start(startUs, PERIOD_US);
+  schedule.beginCycle(startUs);
+
+  uint32_t nextUs = startUs + PERIOD_US; // Wrapped past zero
+  assertFalse(schedule.isDue(nextUs - 1));
+  assertEqual(1UL, (unsigned long)schedule.microsUntilDue(nextUs - 1));
+  assertTrue(schedule.isDue(nextUs));
+  schedule.beginCycle(nextUs);
+  assertEqual(0UL, (unsigned long)schedule.getStats().skippedReleases);
+}
+
+// ============================================================================
+// ControlTask Tests (polled mode)
+// ============================================================================
+
+test(ControlTask_PolledCadence)
+{
+  ControlTask task;
+  ControlTask::Config config;
+  config.threaded = false;
+  cycleCount = 0;
+  cycleBusyMs = 0;
+
+  assertTrue(task.begin(config, countingCycle));
+  assertFalse(task.isThreaded());
+
+  unsigned long startMs = millis();
+  while (millis() - startMs < 1000)
+  {
+    task.runIfDue();
+    delay(1);
+  }
+
+  assertEqual(8, cycleCount);
+  assertEqual(0UL, (unsigned long)task.getStats().skippedReleases);
+  assertLessOrEqual((unsigned long)task.getStats().maxLatenessUs, 2000UL);
+}
+
+test(ControlTask_SlowCycleSkipsInsteadOfBursting)
+{
+  ControlTask task;
+  ControlTask::Config config;
+  config.threaded = false;
+  cycleCount = 0;
+  cycleBusyMs = 300;
+
+  assertTrue(task.begin(config, countingCycle));
+  assertTrue(task.runIfDue());
+  cycleBusyMs = 0;
+
+  // The 300ms cycle covered the 125ms and 250ms releases: one late run, then
+  // back on the grid at 375ms rather than two back-to-back catch-up cycles.
+  assertTrue(task.runIfDue());
+  assertFalse(task.runIfDue());
+  assertEqual(2, cycleCount);
+
+  PeriodicSchedule::Stats stats = task.getStats();
+  assertEqual(1UL, (unsigned long)stats.overruns);
+  assertEqual(1UL, (unsigned long)stats.skippedReleases);
+}
+
+test(ControlTask_ReportsReleaseOfCurrentCycle)
+{
+  ControlTask task;
+  ControlTask::Config config;
+  config.threaded = false;
+  cycleCount = 0;
+  cycleBusyMs = 0;
+
+  uint32_t beganUs = static_cast<uint32_t>(micros());
+  assertTrue(task.begin(config, countingCycle));
+  delay(40);
+  assertTrue(task.runIfDue());
+  assertEqual((unsigned long)beganUs, (unsigned long)task.getCurrentReleaseUs());
+
+  // Released on the grid even when the poll comes late
+  delay(140);
+  assertTrue(task.runIfDue());
+  assertEqual((unsigned long)(beganUs + 125000UL), (unsigned long)task.getCurrentReleaseUs());
+}
+
+test(ControlTask_RejectsDoubleBegin)
+{
+  ControlTask task;
+  ControlTask::Config config;
+  config.threaded = false;
+
+  assertTrue(task.begin(config, countingCycle));
+  assertFalse(task.begin(config, countingCycle));
+  assertFalse(ControlTask().begin(config, nullptr));
+}
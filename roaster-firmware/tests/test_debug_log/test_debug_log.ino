@@ -0,0 +1,220 @@
+/**
+ * Debug Log Tests
+ *
+ * Tests for the incremental log stream behind /api/logs and the WebSocket
+ * log broadcast including:
+ * - Entries carry a seq that keeps counting across ring wrap and clear()
+ * - since returns only newer entries and a cursor to resume from
+ * - Entries lost to the ring before they were read are reported as missed
+ * - A full buffer ends on a whole entry and reports more
+ * - Per-client cursors are created on first use and pruned on disconnect
+ */
+
+#include <AUnit.h>
+#include "../../src/support/DebugLog.hpp"
+#include "../../src/support/LogCursors.hpp"
+
+using namespace aunit;
+
+static char json[8192];  // LOG_HTTP_CAPACITY, as /api/logs uses
+
+static void logNumbered(DebugLogger &logger, int first, int last)
+{
+  char message[32];
+  for (int i = first; i <= last; i++)
+  {
+    snprintf(message, sizeof(message), "entry %d", i);
+    logger.log(LOG_LEVEL_INFO, message);
+  }
+}
+
+static int countEntries(const char *text)
+{
+  int entries = 0;
+  for (const char *p = strstr(text, "\"seq\":"); p; p = strstr(p + 1, "\"seq\":"))
+  {
+    entries++;
+  }
+  return entries;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Sequence Tests
+// ============================================================================
+
+test(DebugLog_SeqCountsEveryEntry)
+{
+  DebugLogger logger;
+  assertEqual((uint32_t)0, logger.getLatestSeq());
+  logNumbered(logger, 1, 250);
+  assertEqual((uint32_t)250, logger.getLatestSeq());
+  assertEqual(100, logger.getCount());
+
+  logger.clear();
+  logger.log(LOG_LEVEL_WARN, "after clear");
+  assertEqual((uint32_t)251, logger.getLatestSeq());
+}
+
+test(DebugLog_EmptyLogWritesEmptyList)
+{
+  DebugLogger logger;
+  size_t length = logger.writeLogsJSON(json, sizeof(json), 0, 50);
+  assertEqual(String("{\"logs\":[],\"cursor\":0,\"missed\":0,\"more\":false}"), String(json));
+  assertEqual(strlen(json), length);
+}
+
+// ============================================================================
+// Cursor Tests
+// ============================================================================
+
+test(DebugLog_SinceZeroReturnsTheNewestEntries)
+{
+  DebugLogger logger;
+  logNumbered(logger, 1, 80);
+  uint32_t cursor = 0;
+  logger.writeLogsJSON(json, sizeof(json), 0, 5, &cursor);
+  assertEqual(5, countEntries(json));
+  assertEqual((uint32_t)80, cursor);
+  assertTrue(strstr(json, "{\"seq\":76,\"timestamp\":") != nullptr);
+  assertTrue(strstr(json, "\"missed\":0,\"more\":false") != nullptr);
+}
+
+test(DebugLog_SinceReturnsOnlyNewerEntries)
+{
+  DebugLogger logger;
+  logNumbered(logger, 1, 10);
+  uint32_t cursor = 0;
+  logger.writeLogsJSON(json, sizeof(json), 7, 50, &cursor);
+  assertEqual(3, countEntries(json));
+  assertTrue(strstr(json, "\"message\":\"entry 8\"") != nullptr);
+  assertTrue(strstr(json, "\"message\":\"entry 7\"") == nullptr);
+  assertEqual((uint32_t)10, cursor);
+
+  // Nothing new keeps the cursor where it was
+  logger.writeLogsJSON(json, sizeof(json), cursor, 50, &cursor);
+  assertEqual(0, countEntries(json));
+  assertEqual((uint32_t)10, cursor);
+
+  // A cursor from before a reboot resumes at the current end
+  logger.writeLogsJSON(json, sizeof(json), 5000, 50, &cursor);
+  assertEqual(0, countEntries(json));
+  assertEqual((uint32_t)10, cursor);
+}
+
+test(DebugLog_OverwrittenEntriesAreReportedAsMissed)
+{
+  DebugLogger logger;
+  logNumbered(logger, 1, 130);
+  uint32_t cursor = 0;
+  logger.writeLogsJSON(json, sizeof(json), 12, 100, &cursor);
+  // 13..30 were overwritten; 31..130 are still in the ring
+  assertTrue(strstr(json, "\"missed\":18") != nullptr);
+  assertTrue(strstr(json, "{\"seq\":31,") != nullptr);
+  assertEqual(100, countEntries(json));
+  assertEqual((uint32_t)130, cursor);
+}
+
+test(DebugLog_FullBufferStopsOnAWholeEntry)
+{
+  DebugLogger logger;
+  char message[160];
+  memset(message, 'x', sizeof(message) - 1);
+  message[sizeof(message) - 1] = '\0';
+  for (int i = 0; i < 10; i++)
+  {
+    logger.log(LOG_LEVEL_DEBUG, message);
+  }
+
+  char small[1200];
+  uint32_t cursor = 0;
+  size_t length = logger.writeLogsJSON(small, sizeof(small), 0, 50, &cursor);
+  assertTrue(length > 0);
+  assertEqual(strlen(small), length);
+  assertTrue(strstr(small, "\"more\":true") != nullptr);
+  int first = countEntries(small);
+  assertTrue(first >= 1);
+  assertEqual((uint32_t)first, cursor);
+
+  // Following the cursor picks up exactly where it stopped
+  int total = first;
+  for (int page = 0; page < 20 && cursor < logger.getLatestSeq(); page++)
+  {
+    assertTrue(logger.writeLogsJSON(small, sizeof(small), cursor, 50, &cursor) > 0);
+    total += countEntries(small);
+  }
+  assertEqual(10, total);
+  assertTrue(strstr(small, "\"more\":false") != nullptr);
+}
+
+test(DebugLog_MessagesAreEscaped)
+{
+  DebugLogger logger;
+  logger.log(LOG_LEVEL_ERROR, "path \"C:\\roast\"\tline\x01");
+  logger.writeLogsJSON(json, sizeof(json), 0, 1);
+  assertTrue(strstr(json, "\"level\":\"ERROR\",\"message\":\"path \\\"C:\\\\roast\\\"\\tline\\u0001\"") != nullptr);
+}
+
+// ============================================================================
+// Client Cursor Tests
+// ============================================================================
+
+test(LogCursors_NewClientsStartAtZero)
+{
+  LogCursors cursors;
+  uint32_t *first = cursors.cursorFor(3);
+  assertTrue(first != nullptr);
+  assertEqual((uint32_t)0, *first);
+  *first = 42;
+  assertEqual((uint32_t)42, *cursors.cursorFor(3));
+  assertEqual((uint32_t)0, *cursors.cursorFor(4));
+  assertEqual((size_t)2, cursors.size());
+}
+
+test(LogCursors_UnseenClientsArePruned)
+{
+  LogCursors cursors;
+  *cursors.cursorFor(1) = 10;
+  *cursors.cursorFor(2) = 20;
+  *cursors.cursorFor(3) = 30;
+  cursors.prune();
+  assertEqual((size_t)3, cursors.size());
+
+  // Client 2 disconnected before the next broadcast
+  cursors.cursorFor(1);
+  cursors.cursorFor(3);
+  cursors.prune();
+  assertEqual((size_t)2, cursors.size());
+  assertEqual((uint32_t)30, *cursors.cursorFor(3));
+  assertEqual((uint32_t)10, *cursors.cursorFor(1));
+
+  // A reconnect gets a new id and a fresh cursor
+  assertEqual((uint32_t)0, *cursors.cursorFor(2));
+}
+
+test(LogCursors_FullTableRefusesNewClients)
+{
+  LogCursors cursors;
+  for (uint32_t id = 0; id < LogCursors::MAX_CLIENTS; id++)
+  {
+    assertTrue(cursors.cursorFor(id) != nullptr);
+  }
+  assertTrue(cursors.cursorFor(100) == nullptr);
+  cursors.prune();
+  assertTrue(cursors.cursorFor(100) == nullptr);
+  cursors.prune();  // Only client 100 was seen, and it has no slot
+  assertEqual((size_t)0, cursors.size());
+  assertTrue(cursors.cursorFor(100) != nullptr);
+}
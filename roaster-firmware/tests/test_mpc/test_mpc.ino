@@ -0,0 +1,217 @@
+/**
+ * Model-Predictive Heater Controller Tests
+ *
+ * Tests for the band-model MPC heater mode including:
+ * - Horizon matrices built when bands load, and only for usable bands
+ * - Heater command stays within the 0-255 output limit
+ * - Steady state holds the command that balances the model
+ * - Ramp tracking through the band dead time on a matching plant
+ * - Disturbance estimate removes offset when the plant gain is wrong
+ */
+
+#include <AUnit.h>
+#include "../../src/control/PIDRuntimeController.hpp"
+
+using namespace aunit;
+
+#define AMBIENT_F 75.0
+#define HEATER_COEFF 0.020
+#define COOLING_COEFF 0.011
+#define DEAD_TIME_S 5.0
+
+// Discrete FOPDT plant on the 250 ms control step with its own delay line.
+struct DelayedPlant
+{
+  double temp = AMBIENT_F;
+  double heaterCoeff = HEATER_COEFF;
+  double queue[64] = {};
+  uint8_t delaySteps = static_cast<uint8_t>(DEAD_TIME_S / 0.25);
+  uint8_t index = 0;
+
+  void step(double command)
+  {
+    queue[index] = command;
+    double delayed = queue[(index + 64 - delaySteps) % 64];
+    index = (index + 1) % 64;
+    for (int substep = 0; substep < 5; substep++)
+    {
+      temp += 0.05 * (heaterCoeff * delayed - COOLING_COEFF * (temp - AMBIENT_F));
+    }
+  }
+};
+
+static void configure(ModelPredictiveController &mpc)
+{
+  mpc.clear();
+  mpc.configureBand(0, 0.0, COOLING_COEFF, HEATER_COEFF, DEAD_TIME_S);
+}
+
+// Runs `seconds` of closed loop against `plant` following `target(t)` and
+// returns the mean absolute error after `settleSeconds`.
+template <typename Target>
+static double runLoop(ModelPredictiveController &mpc, DelayedPlant &plant, double seconds, double settleSeconds,
+                      Target target)
+{
+  double reference[ModelPredictiveController::PREDICTION_POINTS];
+  double errorSum = 0.0;
+  uint32_t errorCount = 0;
+  for (uint32_t tick = 0; tick < seconds * 4; tick++)
+  {
+    double nowSeconds = tick * 0.25;
+    for (uint8_t point = 0; point < ModelPredictiveController::PREDICTION_POINTS; point++)
+    {
+      reference[point] = target(nowSeconds + mpc.getPointOffsetMs(0, point) / 1000.0);
+    }
+    double command = mpc.solve(0, plant.temp, AMBIENT_F, reference);
+    if (command < 0.0 || command > 255.0)
+    {
+      return 1e9;
+    }
+    mpc.recordCommand(command);
+    if (nowSeconds >= settleSeconds)
+    {
+      errorSum += fabs(plant.temp - target(nowSeconds));
+      errorCount++;
+    }
+    plant.step(command);
+  }
+  return errorCount > 0 ? errorSum / errorCount : 0.0;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Horizon Setup Tests
+// ============================================================================
+
+test(MPC_ConfiguresOnlyUsableBands)
+{
+  ModelPredictiveController mpc;
+  assertFalse(mpc.isBandReady(0));
+  assertTrue(mpc.configureBand(0, 0.0, COOLING_COEFF, HEATER_COEFF, DEAD_TIME_S));
+  assertFalse(mpc.configureBand(1, 0.0, COOLING_COEFF, 0.0, DEAD_TIME_S));
+  assertFalse(mpc.configureBand(Calibration::BAND_COUNT, 0.0, COOLING_COEFF, HEATER_COEFF, DEAD_TIME_S));
+  assertTrue(mpc.isBandReady(0));
+  assertFalse(mpc.isBandReady(1));
+  assertFalse(mpc.isBandReady(-1));
+
+  assertEqual(20, (int)mpc.getDelaySteps(0));
+  // First point sits one point spacing past the dead time.
+  assertEqual(7000UL, (unsigned long)mpc.getPointOffsetMs(0, 0));
+
+  mpc.clear();
+  assertFalse(mpc.isBandReady(0));
+  assertEqual(0.0, mpc.solve(0, 200.0, AMBIENT_F, nullptr));
+}
+
+test(MPC_RuntimeControllerBuildsHorizonsOnLoad)
+{
+  Calibration::CharacterizationSummary summary = {};
+  for (uint8_t index = 0; index < 2; index++)
+  {
+    Calibration::BandCharacterization &band = summary.bands[index];
+    band.valid = true;
+    band.targetTemp = 200.0 + 100.0 * index;
+    band.minTemp = 150.0 + 100.0 * index;
+    band.maxTemp = 250.0 + 100.0 * index;
+    band.coolingCoeff = COOLING_COEFF;
+    band.heaterCoeff = HEATER_COEFF;
+    band.deadTime = DEAD_TIME_S + index;
+  }
+
+  PIDRuntimeController runtime;
+  assertTrue(runtime.loadFromSummary(summary));
+  assertTrue(runtime.getPredictiveController().isBandReady(0));
+  assertTrue(runtime.getPredictiveController().isBandReady(1));
+  assertFalse(runtime.getPredictiveController().isBandReady(2));
+  assertEqual(24, (int)runtime.getPredictiveController().getDelaySteps(1));
+
+  runtime.clear();
+  assertFalse(runtime.getPredictiveController().isBandReady(0));
+}
+
+// ============================================================================
+// Solve Tests
+// ============================================================================
+
+test(MPC_RespectsOutputLimits)
+{
+  ModelPredictiveController mpc;
+  configure(mpc);
+  double hot[ModelPredictiveController::PREDICTION_POINTS];
+  double cold[ModelPredictiveController::PREDICTION_POINTS];
+  for (uint8_t point = 0; point < ModelPredictiveController::PREDICTION_POINTS; point++)
+  {
+    hot[point] = 900.0;
+    cold[point] = 0.0;
+  }
+  assertEqual(255.0, mpc.solve(0, 150.0, AMBIENT_F, hot));
+  mpc.recordCommand(255.0);
+  assertEqual(0.0, mpc.solve(0, 150.0, AMBIENT_F, cold));
+}
+
+test(MPC_HoldsSteadyState)
+{
+  ModelPredictiveController mpc;
+  configure(mpc);
+  const double command = 120.0;
+  double steady = AMBIENT_F + HEATER_COEFF / COOLING_COEFF * command;
+  double reference[ModelPredictiveController::PREDICTION_POINTS];
+  for (uint8_t point = 0; point < ModelPredictiveController::PREDICTION_POINTS; point++)
+  {
+    reference[point] = steady;
+  }
+  for (int tick = 0; tick < 64; tick++)
+  {
+    mpc.recordCommand(command);
+  }
+  assertNear(command, mpc.solve(0, steady, AMBIENT_F, reference), 1.0);
+  assertNear(steady, (double)mpc.getLastSolveStats().predictedTemp, 0.05);
+}
+
+test(MPC_TracksRampThroughDeadTime)
+{
+  ModelPredictiveController mpc;
+  configure(mpc);
+  DelayedPlant plant;
+  // 25F/min ramp from 150F after a short preheat plateau.
+  double mae = runLoop(mpc, plant, 480.0, 90.0, [](double t) { return t < 30.0 ? 150.0 : 150.0 + (t - 30.0) * 25.0 / 60.0; });
+  assertLess(mae, 0.5);
+  assertLessOrEqual((int)mpc.getLastSolveStats().sweeps, (int)ModelPredictiveController::MAX_SWEEPS);
+}
+
+test(MPC_DisturbanceEstimateRemovesOffset)
+{
+  ModelPredictiveController mpc;
+  configure(mpc);
+  DelayedPlant plant;
+  plant.heaterCoeff = HEATER_COEFF * 0.8; // Element weaker than calibrated
+  double mae = runLoop(mpc, plant, 900.0, 600.0, [](double) { return 300.0; });
+  assertLess(mae, 0.5);
+  assertLess((double)mpc.getDisturbance(), 0.0);
+}
+
+test(MPC_ResetClearsRoastState)
+{
+  ModelPredictiveController mpc;
+  configure(mpc);
+  DelayedPlant plant;
+  plant.heaterCoeff = HEATER_COEFF * 0.8;
+  runLoop(mpc, plant, 120.0, 0.0, [](double) { return 250.0; });
+  assertNotEqual(0.0f, mpc.getDisturbance());
+
+  mpc.reset();
+  assertEqual(0.0f, mpc.getDisturbance());
+  assertTrue(mpc.isBandReady(0));
+}
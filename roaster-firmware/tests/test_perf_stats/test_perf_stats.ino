@@ -0,0 +1,209 @@
+/**
+ * Timer Latency Histogram Tests
+ *
+ * Tests for the per-timer jitter and runtime histograms behind /api/perf:
+ * - Bucket placement on the 1-2-5 microsecond grid
+ * - p50/p99 from bucket counts, clamped to the observed max
+ * - Overrun counting against the timer period
+ * - Lateness measured from the scheduled release, so a slow block does not
+ *   make the next one look late
+ * - PerfScope runtime accounting
+ */
+
+#include <AUnit.h>
+#include "../../src/support/PerfStats.hpp"
+
+using namespace aunit;
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// LatencyHistogram Tests
+// ============================================================================
+
+test(Histogram_EmptyReportsZero)
+{
+  LatencyHistogram histogram;
+  assertEqual(0UL, (unsigned long)histogram.getSamples());
+  assertEqual(0UL, (unsigned long)histogram.percentileUs(50));
+  assertEqual(0UL, (unsigned long)histogram.percentileUs(99));
+}
+
+test(Histogram_PlacesValuesInBuckets)
+{
+  LatencyHistogram histogram;
+  histogram.record(0, 0);       // <= 10us
+  histogram.record(10, 0);      // <= 10us (bounds are inclusive)
+  histogram.record(11, 0);      // <= 20us
+  histogram.record(4500, 0);    // <= 5ms
+  histogram.record(9000000, 0); // overflow
+
+  assertEqual(2UL, (unsigned long)histogram.getBucketCount(0));
+  assertEqual(1UL, (unsigned long)histogram.getBucketCount(1));
+  assertEqual(1UL, (unsigned long)histogram.getBucketCount(8));
+  assertEqual(1UL, (unsigned long)histogram.getBucketCount(LatencyHistogram::BUCKET_COUNT - 1));
+  assertEqual(9000000UL, (unsigned long)histogram.getMaxUs());
+}
+
+test(Histogram_Percentiles)
+{
+  LatencyHistogram histogram;
+  for (int sample = 0; sample < 98; sample++)
+  {
+    histogram.record(150, 0); // <= 200us
+  }
+  histogram.record(1800, 0);  // <= 2ms
+  histogram.record(42000, 0); // <= 50ms, the max
+
+  assertEqual(200UL, (unsigned long)histogram.percentileUs(50));
+  assertEqual(2000UL, (unsigned long)histogram.percentileUs(99));
+  assertEqual(42000UL, (unsigned long)histogram.percentileUs(100));
+}
+
+test(Histogram_PercentileClampedToMax)
+{
+  LatencyHistogram histogram;
+  histogram.record(130, 0);
+  assertEqual(130UL, (unsigned long)histogram.percentileUs(50));
+  assertEqual(130UL, (unsigned long)histogram.percentileUs(99));
+}
+
+test(Histogram_CountsOverrunsAndResets)
+{
+  LatencyHistogram histogram;
+  histogram.record(4000, 5000);
+  histogram.record(5000, 5000);
+  histogram.record(5001, 5000);
+  histogram.record(90000, 0); // No budget, never an overrun
+  assertEqual(1UL, (unsigned long)histogram.getOverruns());
+
+  histogram.reset();
+  assertEqual(0UL, (unsigned long)histogram.getSamples());
+  assertEqual(0UL, (unsigned long)histogram.getOverruns());
+  assertEqual(0UL, (unsigned long)histogram.getMaxUs());
+}
+
+// ============================================================================
+// PerfChannel Tests
+// ============================================================================
+
+test(Channel_MeasuresLatenessFromIntervals)
+{
+  PerfChannel channel("tick", 5);
+
+  channel.finish(channel.start());
+  assertEqual(0UL, (unsigned long)channel.getLateness().getSamples());
+
+  delay(5);
+  channel.finish(channel.start());
+  delay(7);
+  channel.finish(channel.start());
+  delay(16);
+  channel.finish(channel.start());
+
+  const LatencyHistogram &lateness = channel.getLateness();
+  assertEqual(3UL, (unsigned long)lateness.getSamples());
+  assertEqual(11000UL, (unsigned long)lateness.getMaxUs());
+  assertEqual(1UL, (unsigned long)lateness.getOverruns()); // 11ms late > 5ms period
+  assertEqual(4UL, (unsigned long)channel.getRuntime().getSamples());
+}
+
+test(Channel_SlowBlockIsNotLateness)
+{
+  PerfChannel channel("stateMachine", 500);
+  {
+    PerfScope scope(channel);
+    delay(800);
+  }
+  // Re-armed when the block ended, so released 500ms after the finish
+  delay(500);
+  {
+    PerfScope scope(channel);
+  }
+  delay(530);
+  {
+    PerfScope scope(channel);
+  }
+
+  const LatencyHistogram &lateness = channel.getLateness();
+  assertEqual(2UL, (unsigned long)lateness.getSamples());
+  assertEqual(30000UL, (unsigned long)lateness.getMaxUs());
+  assertEqual(0UL, (unsigned long)lateness.getOverruns());
+  assertEqual(1UL, (unsigned long)channel.getRuntime().getOverruns());
+}
+
+test(Channel_FixedGridRelease)
+{
+  PerfChannel channel("control", 125);
+  uint32_t nowUs = static_cast<uint32_t>(micros());
+
+  channel.finish(channel.start(nowUs - 3000));
+  channel.finish(channel.start(nowUs + 1000)); // Early wake-up is not late
+  {
+    PerfScope scope(channel, nowUs - 200000);
+  }
+
+  const LatencyHistogram &lateness = channel.getLateness();
+  assertEqual(3UL, (unsigned long)lateness.getSamples());
+  assertEqual(200000UL, (unsigned long)lateness.getMaxUs());
+  assertEqual(1UL, (unsigned long)lateness.getOverruns());
+  assertEqual(1UL, (unsigned long)lateness.getBucketCount(0));
+}
+
+test(Channel_ScopeRecordsRuntime)
+{
+  PerfChannel channel("stateMachine", 500);
+  {
+    PerfScope scope(channel);
+    delayMicroseconds(1500);
+  }
+  {
+    PerfScope scope(channel);
+    delay(600);
+  }
+
+  const LatencyHistogram &runtime = channel.getRuntime();
+  assertEqual(2UL, (unsigned long)runtime.getSamples());
+  assertEqual(600000UL, (unsigned long)runtime.getMaxUs());
+  assertEqual(1UL, (unsigned long)runtime.getOverruns());
+  assertEqual(2000UL, (unsigned long)runtime.percentileUs(50));
+}
+
+test(Channel_UnscheduledTracksRuntimeOnly)
+{
+  PerfChannel channel("loop", 0);
+  for (int iteration = 0; iteration < 4; iteration++)
+  {
+    PerfScope scope(channel);
+    delay(20);
+  }
+  assertEqual(0UL, (unsigned long)channel.getLateness().getSamples());
+  assertEqual(4UL, (unsigned long)channel.getRuntime().getSamples());
+  assertEqual(0UL, (unsigned long)channel.getRuntime().getOverruns());
+}
+
+test(Channel_ResetForgetsLastStart)
+{
+  PerfChannel channel("wsBroadcast", 1000);
+  channel.finish(channel.start());
+  delay(1000);
+  channel.finish(channel.start());
+  assertEqual(1UL, (unsigned long)channel.getLateness().getSamples());
+
+  channel.reset();
+  delay(5000);
+  channel.finish(channel.start());
+  assertEqual(0UL, (unsigned long)channel.getLateness().getSamples());
+  assertEqual(1UL, (unsigned long)channel.getRuntime().getSamples());
+}
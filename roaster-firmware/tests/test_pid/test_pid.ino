@@ -6,11 +6,14 @@
  * - Response to setpoint changes
  * - Output clamping (0-255 range)
  * - Stability testing
+ * - Gain schedule saved as one blob, with per-key schedules migrated
+ *   (through the write-behind journal too, blob before removes)
  */
 
 #include <AUnit.h>
 #include "../../src/control/PIDController.hpp"
 #include "../../src/control/PIDRuntimeController.hpp"
+#include "../../src/platform/PreferencesJournal.hpp"
 
 using namespace aunit;
 
@@ -467,6 +470,7 @@ test(PID_TimeStep_NoUpdateTooSoon)
   // Output shouldn't change if called too soon
   // Note: This depends on AutoPID implementation
   // If it updates anyway, we'll just verify it's still valid
+  assertTrue(output1 >= 0 && output1 <= 255);
   assertTrue(output2 >= 0 && output2 <= 255);
 }
 
@@ -584,3 +588,156 @@ test(PID_RuntimeScheduler_SelectsBandsAndComputesFeedforward)
   assertEqual(11.0, highBand.kp);
   assertTrue(highBand.feedforward >= lowBand.feedforward);
 }
+
+// ============================================================================
+// Gain Schedule Persistence Tests
+// ============================================================================
+
+static Calibration::CharacterizationSummary twoBandSummary()
+{
+  Calibration::CharacterizationSummary summary = {};
+  summary.validBandCount = 2;
+  for (uint8_t index = 0; index < 2; index++)
+  {
+    Calibration::BandCharacterization &band = summary.bands[index * 2];
+    band.valid = true;
+    band.targetTemp = 225.0 + 100.0 * index;
+    band.minTemp = 180.0 + 100.0 * index;
+    band.maxTemp = 280.0 + 100.0 * index;
+    band.drift = -0.08 - 0.01 * index;
+    band.coolingCoeff = -0.010;
+    band.heaterCoeff = 0.005;
+    band.deadTime = 6.0 + index;
+    band.kp = 7.0 + index;
+    band.ki = 0.7;
+    band.kd = 2.0;
+  }
+  return summary;
+}
+
+static void resetSettings(Preferences &prefs)
+{
+  HostNvs::reset();
+  prefs.end();
+  prefs.begin("pid_test", false);
+}
+
+test(PID_RuntimeScheduler_SavesScheduleAsOneBlob)
+{
+  Preferences prefs;
+  resetSettings(prefs);
+  PIDRuntimeController saved;
+  assertTrue(saved.loadFromSummary(twoBandSummary()));
+  assertTrue(saved.saveToPreferences(prefs));
+  assertEqual((uint32_t)1, HostNvs::stats.writes);
+
+  HostNvs::stats = {};
+  PIDRuntimeController loaded;
+  assertTrue(loaded.loadFromPreferences(prefs));
+  assertEqual((uint32_t)0, HostNvs::stats.writes);
+  assertEqual((uint8_t)2, loaded.getValidBandCount());
+  assertFalse(loaded.getBand(1).valid);
+  assertEqual(8.0, loaded.getBand(2).kp);
+  assertEqual(-0.09, loaded.getBand(2).drift);
+  assertEqual(380.0, loaded.getBand(2).maxTemp);
+  assertEqual(0, loaded.decide(1000, 200.0, 225.0, 90.0).bandIndex);
+
+  loaded.clearPreferences(prefs);
+  assertFalse(loaded.isEnabled());
+  PIDRuntimeController cleared;
+  assertFalse(cleared.loadFromPreferences(prefs));
+}
+
+test(PID_RuntimeScheduler_CorruptBlobFallsBack)
+{
+  Preferences prefs;
+  resetSettings(prefs);
+  PIDRuntimeController saved;
+  saved.loadFromSummary(twoBandSummary());
+  saved.saveToPreferences(prefs);
+
+  uint8_t blob[512];
+  size_t length = prefs.getBytes("pid_bands", blob, sizeof(blob));
+  assertTrue(length > 16);
+  blob[length / 2] ^= 0x40;
+  prefs.putBytes("pid_bands", blob, length);
+
+  PIDRuntimeController loaded;
+  loaded.setFallbackGains(4.0, 0.4, 1.0);
+  assertFalse(loaded.loadFromPreferences(prefs));
+  assertEqual((uint8_t)0, loaded.getValidBandCount());
+  assertEqual(4.0, loaded.decide(1000, 200.0, 225.0, 90.0).kp);
+
+  // Wrong size, such as a blob from a build with another band count
+  prefs.putBytes("pid_bands", blob, length - 8);
+  assertFalse(loaded.loadFromPreferences(prefs));
+}
+
+// Layout written by older firmware
+static void writeLegacySchedule(Preferences &prefs)
+{
+  prefs.putBool("pid_sched", true);
+  const char *suffixes[] = {"tg", "mn", "mx", "dr", "cc", "hc", "dt", "kp", "ki", "kd"};
+  const double values[] = {300.0, 260.0, 340.0, -0.1, -0.012, 0.0045, 8.0, 11.0, 0.9, 4.0};
+  for (uint8_t band = 0; band < 2; band++)
+  {
+    char key[16];
+    snprintf(key, sizeof(key), "pb%uv", band);
+    prefs.putBool(key, true);
+    for (uint8_t field = 0; field < 10; field++)
+    {
+      snprintf(key, sizeof(key), "pb%u%s", band, suffixes[field]);
+      prefs.putDouble(key, values[field] + band);
+    }
+  }
+  prefs.putBool("pb2v", false);
+}
+
+test(PID_RuntimeScheduler_MigratesPerKeySchedule)
+{
+  Preferences prefs;
+  resetSettings(prefs);
+  writeLegacySchedule(prefs);
+
+  PIDRuntimeController migrated;
+  assertTrue(migrated.loadFromPreferences(prefs));
+  assertEqual((uint8_t)2, migrated.getValidBandCount());
+  assertEqual(12.0, migrated.getBand(1).kp);
+  assertEqual(341.0, migrated.getBand(1).maxTemp);
+  assertFalse(prefs.isKey("pid_sched"));
+  assertFalse(prefs.isKey("pb0kp"));
+  assertFalse(prefs.isKey("pb2v"));
+  assertTrue(prefs.isKey("pid_bands"));
+
+  PIDRuntimeController reloaded;
+  assertTrue(reloaded.loadFromPreferences(prefs));
+  assertEqual(12.0, reloaded.getBand(1).kp);
+}
+
+test(PID_RuntimeScheduler_JournalMigrationWritesBlobFirst)
+{
+  Preferences prefs;
+  resetSettings(prefs);
+  writeLegacySchedule(prefs);
+
+  PreferencesJournal journal(prefs);
+  PIDRuntimeController migrated;
+  assertTrue(migrated.loadFromPreferences(journal));
+  assertFalse(journal.isKey("pid_sched"));
+
+  // A reset now finds the blob on flash next to the old keys, not the old
+  // keys gone and the blob still pending
+  assertTrue(prefs.isKey("pid_bands"));
+  assertTrue(prefs.isKey("pid_sched"));
+  PreferencesJournal afterReset(prefs);
+  PIDRuntimeController rebooted;
+  assertTrue(rebooted.loadFromPreferences(afterReset));
+  assertEqual(12.0, rebooted.getBand(1).kp);
+
+  assertTrue(journal.flush());
+  assertFalse(prefs.isKey("pid_sched"));
+  assertFalse(prefs.isKey("pb1kd"));
+  PIDRuntimeController reloaded;
+  assertTrue(reloaded.loadFromPreferences(prefs));
+  assertEqual(12.0, reloaded.getBand(1).kp);
+}
@@ -0,0 +1,197 @@
+/**
+ * Preferences Journal Tests
+ *
+ * Tests for the write-behind cache in front of the settings namespace
+ * including:
+ * - Puts land in RAM and reach flash once the flush delay has passed
+ * - Repeated puts of a key coalesce into one flash write
+ * - Puts that match the stored value cost no flash write
+ * - Reads see pending values and removes before they are flushed
+ * - flush() writes everything pending at once
+ */
+
+#include <AUnit.h>
+#include <Preferences.h>
+#include "../../src/platform/PreferencesJournal.hpp"
+
+using namespace aunit;
+
+Preferences prefs;
+
+static void resetStore()
+{
+  HostNvs::reset();
+  prefs.end();
+  prefs.begin("journal_test", false);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Write-Behind Tests
+// ============================================================================
+
+test(Journal_PutsWaitForTheFlushDelay)
+{
+  resetStore();
+  PreferencesJournal journal(prefs, 2000);
+  journal.putInt("boot_count", 3);
+  journal.putDouble("kp", 8.5);
+  journal.putString("ssid", "roastery");
+  assertEqual((uint32_t)0, HostNvs::stats.writes);
+  assertEqual((size_t)3, journal.pendingCount());
+  assertFalse(prefs.isKey("kp"));
+
+  delay(1999);
+  journal.flushIfDue();
+  assertEqual((uint32_t)0, HostNvs::stats.writes);
+
+  delay(1);
+  assertTrue(journal.flushIfDue());
+  assertEqual((uint32_t)3, HostNvs::stats.writes);
+  assertEqual((size_t)0, journal.pendingCount());
+  assertEqual(3, prefs.getInt("boot_count", 0));
+  assertEqual(8.5, prefs.getDouble("kp", 0.0));
+  assertEqual(String("roastery"), prefs.getString("ssid", ""));
+}
+
+test(Journal_RepeatedPutsCoalesce)
+{
+  resetStore();
+  PreferencesJournal journal(prefs, 2000);
+  for (int i = 0; i < 33; i++)
+  {
+    journal.putDouble("kp", 1.0 + i);
+    journal.putDouble("ki", 0.1 * i);
+  }
+  assertEqual((size_t)2, journal.pendingCount());
+  assertTrue(journal.flush());
+  assertEqual((uint32_t)2, HostNvs::stats.writes);
+  assertEqual(33.0, prefs.getDouble("kp", 0.0));
+
+  PreferencesJournal::Stats stats = journal.getStats();
+  assertEqual((uint32_t)66, stats.writes);
+  assertEqual((uint32_t)64, stats.coalesced);
+  assertEqual((uint32_t)2, stats.flashWrites);
+  assertEqual((uint32_t)64, journal.writesAvoided());
+}
+
+test(Journal_UnchangedValuesAreNotRewritten)
+{
+  resetStore();
+  prefs.putInt("ror_window", 30);
+  prefs.putString("phase", "idle");
+  HostNvs::stats = {};
+
+  PreferencesJournal journal(prefs);
+  assertEqual(30, journal.getInt("ror_window", 15));
+  assertEqual(String("idle"), journal.getString("phase", ""));
+  journal.putInt("ror_window", 30);
+  journal.putString("phase", "idle");
+  assertEqual((size_t)0, journal.pendingCount());
+
+  // Flushed values are remembered too
+  journal.putBool("sl_active", true);
+  journal.flush();
+  journal.putBool("sl_active", true);
+  assertEqual((size_t)0, journal.pendingCount());
+  assertEqual((uint32_t)1, HostNvs::stats.writes);
+  assertEqual((uint32_t)3, journal.getStats().unchanged);
+}
+
+// ============================================================================
+// Read Tests
+// ============================================================================
+
+test(Journal_ReadsSeePendingValues)
+{
+  resetStore();
+  prefs.putUInt("sl_target", 400);
+  prefs.putString("sl_reason", "drop");
+  PreferencesJournal journal(prefs);
+
+  journal.putUInt("sl_target", 425);
+  journal.remove("sl_reason");
+  journal.putBool("pid_sched", true);
+  assertEqual((uint32_t)425, journal.getUInt("sl_target", 0));
+  assertEqual(String("none"), journal.getString("sl_reason", "none"));
+  assertFalse(journal.isKey("sl_reason"));
+  assertTrue(journal.isKey("pid_sched"));
+  assertTrue(journal.getBool("pid_sched", false));
+  assertTrue(prefs.isKey("sl_reason"));
+
+  // Missing keys fall back to the default without being cached as a value
+  assertEqual(-1, journal.getInt("sl_override", -1));
+  assertEqual(12.5, journal.getDouble("kd", 12.5));
+
+  journal.flush();
+  assertFalse(prefs.isKey("sl_reason"));
+  assertEqual((uint32_t)425, prefs.getUInt("sl_target", 0));
+  assertTrue(prefs.getBool("pid_sched", false));
+}
+
+test(Journal_RemovingAMissingKeyIsFree)
+{
+  resetStore();
+  PreferencesJournal journal(prefs);
+  journal.remove("pid_b0_kp");
+  journal.flush();
+  assertEqual((uint32_t)0, HostNvs::stats.removes);
+  assertEqual((uint32_t)0, journal.getStats().flashWrites);
+}
+
+test(Journal_LongKeysWriteThrough)
+{
+  resetStore();
+  PreferencesJournal journal(prefs);
+  journal.putInt("a_key_longer_than_15", 7);
+  assertEqual((uint32_t)1, HostNvs::stats.writes);
+  assertEqual((size_t)0, journal.pendingCount());
+}
+
+test(Journal_PutAfterFlushIsPendingAgain)
+{
+  resetStore();
+  PreferencesJournal journal(prefs, 500);
+  journal.putInt("heater_mode", 1);
+  journal.flush();
+  journal.putInt("heater_mode", 2);
+  assertEqual((size_t)1, journal.pendingCount());
+  assertEqual(1, prefs.getInt("heater_mode", 0));
+  delay(500);
+  journal.flushIfDue();
+  assertEqual(2, prefs.getInt("heater_mode", 0));
+  assertEqual((uint32_t)2, HostNvs::stats.writes);
+}
+
+test(Journal_BlobsAreCachedLikeOtherValues)
+{
+  resetStore();
+  PreferencesJournal journal(prefs);
+  const uint8_t first[] = {1, 2, 3, 4, 5};
+  const uint8_t second[] = {9, 8, 7};
+  journal.putBytes("pid_bands", first, sizeof(first));
+  journal.putBytes("pid_bands", second, sizeof(second));
+  assertEqual((size_t)3, journal.getBytesLength("pid_bands"));
+
+  uint8_t out[8] = {};
+  assertEqual((size_t)0, journal.getBytes("pid_bands", out, 2));
+  assertEqual((size_t)3, journal.getBytes("pid_bands", out, sizeof(out)));
+  assertEqual(0, memcmp(out, second, sizeof(second)));
+
+  journal.flush();
+  journal.putBytes("pid_bands", second, sizeof(second));
+  assertEqual((uint32_t)1, HostNvs::stats.writes);
+  assertEqual((size_t)3, prefs.getBytesLength("pid_bands"));
+}
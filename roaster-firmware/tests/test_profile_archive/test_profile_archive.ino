@@ -0,0 +1,264 @@
+/**
+ * Profile Archive Tests
+ *
+ * Tests for the streaming tar reader and writer behind bulk profile
+ * import/export including:
+ * - Headers written by the export read back with name, size and data intact
+ * - The same members whatever chunk sizes the archive arrives in
+ * - Directories, pax records and members the sink declines are skipped
+ * - Corrupt headers stop the import; truncated archives are not complete
+ */
+
+#include <AUnit.h>
+#include <vector>
+#include "../../src/support/TarStream.hpp"
+
+using namespace aunit;
+
+struct Member
+{
+  String name;
+  uint32_t size;
+  String data;
+  bool ended;
+};
+
+// Records every member it is offered; declines names ending in ".skip".
+struct RecordingSink
+{
+  std::vector<Member> members;
+
+  bool beginFile(const char *name, uint32_t size)
+  {
+    String memberName(name);
+    if (memberName.endsWith(".skip"))
+    {
+      return false;
+    }
+    members.push_back(Member{memberName, size, String(), false});
+    return true;
+  }
+
+  void fileData(const uint8_t *data, size_t length)
+  {
+    for (size_t i = 0; i < length; i++)
+    {
+      members.back().data += static_cast<char>(data[i]);
+    }
+  }
+
+  void endFile()
+  {
+    members.back().ended = true;
+  }
+};
+
+static void appendMember(std::vector<uint8_t> &archive, const char *name, const String &body, char type = '0')
+{
+  uint8_t header[TAR_BLOCK_SIZE];
+  tarWriteHeader(header, name, body.length(), 1700000000UL);
+  if (type != '0')
+  {
+    header[156] = static_cast<uint8_t>(type);
+    tarWriteOctal(header + 148, 7, tarChecksum(header));
+  }
+  archive.insert(archive.end(), header, header + TAR_BLOCK_SIZE);
+  archive.insert(archive.end(), body.c_str(), body.c_str() + body.length());
+  archive.insert(archive.end(), tarPadding(body.length()), 0);
+}
+
+static void appendEnd(std::vector<uint8_t> &archive)
+{
+  archive.insert(archive.end(), 2 * TAR_BLOCK_SIZE, 0);
+}
+
+static String repeated(char c, size_t count)
+{
+  String out;
+  for (size_t i = 0; i < count; i++)
+  {
+    out += c;
+  }
+  return out;
+}
+
+static std::vector<uint8_t> sampleArchive()
+{
+  std::vector<uint8_t> archive;
+  appendMember(archive, "roast-profiles/", "", '5');
+  appendMember(archive, "roast-profiles/ethiopia.json", "{\"name\":\"Ethiopia\",\"setpoints\":[]}");
+  appendMember(archive, "roast-profiles/empty.json", "");
+  appendMember(archive, "roast-profiles/block.json", repeated('b', TAR_BLOCK_SIZE));
+  appendMember(archive, "roast-profiles/notes.skip", repeated('s', 700));
+  appendMember(archive, "roast-profiles/long.json", repeated('l', 1300));
+  appendEnd(archive);
+  return archive;
+}
+
+static RecordingSink feedInChunks(const std::vector<uint8_t> &archive, size_t chunk, TarReader &reader)
+{
+  RecordingSink sink;
+  for (size_t offset = 0; offset < archive.size(); offset += chunk)
+  {
+    size_t length = min(chunk, archive.size() - offset);
+    reader.feed(archive.data() + offset, length, sink);
+  }
+  return sink;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Writer Tests
+// ============================================================================
+
+test(TarArchive_PaddingFillsTheLastBlock)
+{
+  assertEqual((size_t)0, tarPadding(0));
+  assertEqual((size_t)511, tarPadding(1));
+  assertEqual((size_t)0, tarPadding(512));
+  assertEqual((size_t)236, tarPadding(1300));
+}
+
+test(TarArchive_HeaderMatchesUstarLayout)
+{
+  uint8_t header[TAR_BLOCK_SIZE];
+  assertTrue(tarWriteHeader(header, "ethiopia-ABCD2345.json", 1300, 1700000000UL));
+  assertEqual(0, memcmp(header, "ethiopia-ABCD2345.json", 23));
+  assertEqual(0, memcmp(header + 124, "00000002424", 12)); // 1300 in octal
+  assertEqual(0, memcmp(header + 257, "ustar\0" "00", 8));
+  assertEqual('0', (char)header[156]);
+  assertEqual('\0', (char)header[154]);
+  assertEqual(' ', (char)header[155]);
+
+  unsigned long checksum = strtoul(reinterpret_cast<const char *>(header + 148), nullptr, 8);
+  assertEqual((unsigned long)tarChecksum(header), checksum);
+
+  assertFalse(tarWriteHeader(header, "", 0, 0));
+  assertFalse(tarWriteHeader(header, repeated('n', 101).c_str(), 0, 0));
+}
+
+// ============================================================================
+// Reader Tests
+// ============================================================================
+
+test(TarArchive_ReadsRegularFilesOnly)
+{
+  TarReader reader;
+  std::vector<uint8_t> archive = sampleArchive();
+  RecordingSink sink = feedInChunks(archive, archive.size(), reader);
+
+  assertTrue(reader.complete());
+  assertFalse(reader.failed());
+  assertEqual((uint32_t)6, reader.memberCount());
+  assertEqual((size_t)4, sink.members.size());
+  assertEqual(String("roast-profiles/ethiopia.json"), sink.members[0].name);
+  assertEqual(String("{\"name\":\"Ethiopia\",\"setpoints\":[]}"), sink.members[0].data);
+  assertEqual(String("roast-profiles/empty.json"), sink.members[1].name);
+  assertEqual((uint32_t)0, sink.members[1].size);
+  assertEqual(String(""), sink.members[1].data);
+  assertEqual(repeated('b', TAR_BLOCK_SIZE), sink.members[2].data);
+  assertEqual((uint32_t)1300, sink.members[3].size);
+  assertEqual(repeated('l', 1300), sink.members[3].data);
+  for (const auto &member : sink.members)
+  {
+    assertTrue(member.ended);
+  }
+}
+
+test(TarArchive_ChunkSizeDoesNotMatter)
+{
+  std::vector<uint8_t> archive = sampleArchive();
+  TarReader whole;
+  RecordingSink expected = feedInChunks(archive, archive.size(), whole);
+
+  const size_t chunks[] = {1, 7, 511, 512, 513, 1460};
+  for (size_t chunk : chunks)
+  {
+    TarReader reader;
+    RecordingSink sink = feedInChunks(archive, chunk, reader);
+    assertTrue(reader.complete());
+    assertEqual(expected.members.size(), sink.members.size());
+    for (size_t i = 0; i < sink.members.size(); i++)
+    {
+      assertEqual(expected.members[i].name, sink.members[i].name);
+      assertEqual(expected.members[i].data, sink.members[i].data);
+    }
+  }
+}
+
+test(TarArchive_JoinsUstarPrefix)
+{
+  std::vector<uint8_t> archive;
+  appendMember(archive, "house.json", "{}");
+  memcpy(archive.data() + 345, "library/2024", 12);
+  tarWriteOctal(archive.data() + 148, 7, tarChecksum(archive.data()));
+  appendEnd(archive);
+
+  TarReader reader;
+  RecordingSink sink = feedInChunks(archive, 64, reader);
+  assertEqual((size_t)1, sink.members.size());
+  assertEqual(String("library/2024/house.json"), sink.members[0].name);
+}
+
+test(TarArchive_SkipsPaxRecords)
+{
+  std::vector<uint8_t> archive;
+  appendMember(archive, "PaxHeader/a.json", "30 path=roast-profiles/a.json\n", 'x');
+  appendMember(archive, "roast-profiles/a.json", "{}");
+  appendEnd(archive);
+
+  TarReader reader;
+  RecordingSink sink = feedInChunks(archive, 100, reader);
+  assertTrue(reader.complete());
+  assertEqual((size_t)1, sink.members.size());
+  assertEqual(String("{}"), sink.members[0].data);
+}
+
+test(TarArchive_CorruptHeaderStopsReading)
+{
+  std::vector<uint8_t> archive = sampleArchive();
+  archive[TAR_BLOCK_SIZE + 10] ^= 0x01; // Name of the first file
+
+  TarReader reader;
+  RecordingSink sink = feedInChunks(archive, 256, reader);
+  assertTrue(reader.failed());
+  assertFalse(reader.complete());
+  assertEqual((int)TarReader::ERROR_CHECKSUM, (int)reader.error());
+  assertEqual((size_t)0, sink.members.size());
+
+  RecordingSink after;
+  assertFalse(reader.feed(archive.data(), archive.size(), after));
+  assertEqual((size_t)0, after.members.size());
+}
+
+test(TarArchive_TruncatedArchiveIsIncomplete)
+{
+  std::vector<uint8_t> archive = sampleArchive();
+  TarReader reader;
+  std::vector<uint8_t> cut(archive.begin(), archive.begin() + 3 * TAR_BLOCK_SIZE + 100);
+  feedInChunks(cut, cut.size(), reader);
+  assertFalse(reader.complete());
+  assertFalse(reader.failed());
+
+  // Stopping between members without the end marker is accepted
+  TarReader unterminated;
+  std::vector<uint8_t> members(archive.begin(), archive.end() - 2 * TAR_BLOCK_SIZE);
+  RecordingSink sink = feedInChunks(members, 1000, unterminated);
+  assertTrue(unterminated.complete());
+  assertEqual((size_t)4, sink.members.size());
+
+  unterminated.reset();
+  assertFalse(unterminated.complete());
+}
@@ -0,0 +1,244 @@
+/**
+ * Profile Id Index Tests
+ *
+ * Tests for the binary NVS index of saved profile ids including:
+ * - Append, tombstone delete and creation order across reloads
+ * - One page and the header written per append, one page per delete
+ * - Compaction once tombstones pile up, and on load
+ * - Corrupt pages and headers detected by their checksums
+ * - Migration from the comma-separated profile_ids string
+ */
+
+#include <AUnit.h>
+#include <Preferences.h>
+#include "../../src/profiles/ProfileIdIndex.hpp"
+
+using namespace aunit;
+
+Preferences prefs;
+
+static void resetStore()
+{
+  prefs.end();
+  prefs.begin("pidx_test", false);
+  prefs.clear();
+}
+
+static String idFor(int number)
+{
+  String id = "ID";
+  id += number;
+  return id;
+}
+
+static String joined(const std::vector<String> &ids)
+{
+  String out;
+  for (size_t i = 0; i < ids.size(); i++)
+  {
+    if (i > 0)
+      out += ",";
+    out += ids[i];
+  }
+  return out;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Append and Delete Tests
+// ============================================================================
+
+test(ProfileIndex_AppendsAndReloadsInOrder)
+{
+  resetStore();
+  ProfileIdIndex index(prefs);
+  assertEqual((size_t)0, index.liveCount());
+  assertTrue(index.append("AAAA1111"));
+  assertTrue(index.append("BBBB2222"));
+  assertTrue(index.append("AAAA1111")); // Already listed
+  assertTrue(index.append("CCCC3333"));
+  assertFalse(index.append(""));
+  assertFalse(index.append("THIRTEENCHARS"));
+  assertEqual(String("AAAA1111,BBBB2222,CCCC3333"), joined(index.ids()));
+
+  ProfileIdIndex reloaded(prefs);
+  assertEqual(String("AAAA1111,BBBB2222,CCCC3333"), joined(reloaded.ids()));
+  assertTrue(reloaded.contains("BBBB2222"));
+  assertFalse(reloaded.contains("DDDD4444"));
+  assertEqual(String("AAAA1111"), reloaded.oldest());
+}
+
+test(ProfileIndex_RemoveLeavesTombstone)
+{
+  resetStore();
+  ProfileIdIndex index(prefs);
+  for (int i = 0; i < 5; i++)
+  {
+    index.append(idFor(i));
+  }
+  assertTrue(index.remove("ID0"));
+  assertTrue(index.remove("ID3"));
+  assertFalse(index.remove("ID3"));
+  assertEqual((size_t)2, index.tombstoneCount());
+  assertEqual(String("ID1,ID2,ID4"), joined(index.ids()));
+  assertEqual(String("ID1"), index.oldest());
+
+  // Removed ids can come back, at the end
+  assertTrue(index.append("ID0"));
+  assertEqual(String("ID1,ID2,ID4,ID0"), joined(index.ids()));
+
+  // Load squeezes the tombstones out
+  ProfileIdIndex reloaded(prefs);
+  assertEqual(String("ID1,ID2,ID4,ID0"), joined(reloaded.ids()));
+  assertEqual((size_t)0, reloaded.tombstoneCount());
+}
+
+#ifdef ROASTER_HOST_BUILD
+test(ProfileIndex_WritesArePerPage)
+{
+  resetStore();
+  ProfileIdIndex index(prefs);
+  for (int i = 0; i < 40; i++)
+  {
+    index.append(idFor(i));
+  }
+
+  HostNvs::stats = {};
+  index.append("LATE");
+  assertEqual((uint32_t)2, HostNvs::stats.writes); // Last page + header
+
+  HostNvs::stats = {};
+  index.remove("ID7");
+  assertEqual((uint32_t)1, HostNvs::stats.writes); // Its page only
+}
+#endif
+
+// ============================================================================
+// Compaction Tests
+// ============================================================================
+
+test(ProfileIndex_CompactsWhenTombstonesDominate)
+{
+  resetStore();
+  ProfileIdIndex index(prefs);
+  for (int i = 0; i < 32; i++)
+  {
+    index.append(idFor(i));
+  }
+  for (int i = 0; i < 15; i++)
+  {
+    index.remove(idFor(i * 2));
+  }
+  assertEqual((size_t)15, index.tombstoneCount());
+  index.remove("ID30"); // 16 of 32: compacts
+  assertEqual((size_t)0, index.tombstoneCount());
+  assertEqual((size_t)16, index.liveCount());
+  assertEqual(String("ID1"), index.oldest());
+
+  ProfileIdIndex reloaded(prefs);
+  assertEqual(joined(index.ids()), joined(reloaded.ids()));
+  // The bank written before the flip is gone
+  assertFalse(prefs.isKey("pidx_a1"));
+  assertTrue(prefs.isKey("pidx_b0"));
+  assertFalse(prefs.isKey("pidx_b1"));
+}
+
+test(ProfileIndex_ClearDropsEverything)
+{
+  resetStore();
+  ProfileIdIndex index(prefs);
+  for (int i = 0; i < 20; i++)
+  {
+    index.append(idFor(i));
+  }
+  index.clear();
+  assertEqual((size_t)0, index.liveCount());
+  assertFalse(prefs.isKey("pidx"));
+  assertFalse(prefs.isKey("pidx_a0"));
+  assertFalse(prefs.isKey("pidx_a1"));
+
+  ProfileIdIndex reloaded(prefs);
+  assertEqual((size_t)0, reloaded.liveCount());
+}
+
+// ============================================================================
+// Integrity Tests
+// ============================================================================
+
+test(ProfileIndex_DropsCorruptPage)
+{
+  resetStore();
+  ProfileIdIndex index(prefs);
+  for (int i = 0; i < 20; i++)
+  {
+    index.append(idFor(i));
+  }
+  uint8_t page[256];
+  size_t length = prefs.getBytes("pidx_a0", page, sizeof(page));
+  page[3] ^= 0x20;
+  prefs.putBytes("pidx_a0", page, length);
+
+  ProfileIdIndex reloaded(prefs);
+  assertEqual((size_t)4, reloaded.liveCount());
+  assertEqual(String("ID16"), reloaded.oldest());
+}
+
+test(ProfileIndex_IgnoresCorruptHeader)
+{
+  resetStore();
+  ProfileIdIndex index(prefs);
+  index.append("AAAA1111");
+  uint8_t header[8];
+  prefs.getBytes("pidx", header, sizeof(header));
+  header[2] = 9; // Count no longer matches the CRC
+  prefs.putBytes("pidx", header, sizeof(header));
+
+  ProfileIdIndex reloaded(prefs);
+  assertEqual((size_t)0, reloaded.liveCount());
+}
+
+test(ProfileIndex_AppendLostBeforeHeaderWriteIsIgnored)
+{
+  resetStore();
+  ProfileIdIndex index(prefs);
+  index.append("AAAA1111");
+  uint8_t header[8];
+  prefs.getBytes("pidx", header, sizeof(header));
+  index.append("BBBB2222");
+  prefs.putBytes("pidx", header, sizeof(header)); // Reset before the header write
+
+  ProfileIdIndex reloaded(prefs);
+  assertEqual(String("AAAA1111"), joined(reloaded.ids()));
+  assertTrue(reloaded.append("CCCC3333"));
+  ProfileIdIndex again(prefs);
+  assertEqual(String("AAAA1111,CCCC3333"), joined(again.ids()));
+}
+
+// ============================================================================
+// Migration Tests
+// ============================================================================
+
+test(ProfileIndex_MigratesCsvList)
+{
+  resetStore();
+  prefs.putString("profile_ids", " AAAA1111, BBBB2222,,AAAA1111,CCCC3333 ");
+  ProfileIdIndex index(prefs);
+  assertEqual(String("AAAA1111,BBBB2222,CCCC3333"), joined(index.ids()));
+  assertFalse(prefs.isKey("profile_ids"));
+  assertTrue(prefs.isKey("pidx"));
+
+  ProfileIdIndex reloaded(prefs);
+  assertEqual(String("AAAA1111,BBBB2222,CCCC3333"), joined(reloaded.ids()));
+}
@@ -3,13 +3,19 @@
  * 
  * Tests for the RoastProfile class including:
  * - Setpoint interpolation accuracy
- * - Profile serialization/deserialization
+ * - Profile serialization/deserialization, including the compact v2 format
+ *   and migration from v1
+ * - Monotone cubic (PCHIP) interpolation mode
+ * - Look-ahead lookups with their own cursor
+ * - Bulk loading with a single trajectory compile
+ * - Continuing a running roast's clock after a profile swap
  * - Boundary conditions
  * - Profile state transitions
  */
 
 #include <AUnit.h>
 #include "../../src/profiles/RoastProfile.hpp"
+#include "../../src/support/Crc32.hpp"
 
 using namespace aunit;
 
@@ -51,13 +57,13 @@ test(Profile_AddSetpoint_MaxCapacity) {
   RoastProfile profile;
   profile.clearSetpoints();
   
-  // Try to add 11 setpoints (max is 10)
-  for (int i = 0; i < 11; i++) {
-    profile.addSetpoint(i * 10000, 100 + i * 10, 50);
+  // Try to add one more setpoint than fits
+  for (int i = 0; i < RoastProfile::MAX_SETPOINTS + 1; i++) {
+    profile.addSetpoint(i * 10000, 100 + i % 400, 50);
   }
   
-  // Should only have 10 setpoints (including the default one)
-  assertEqual(10, profile.getSetpointCount());
+  // Should only have MAX_SETPOINTS setpoints (including the default one)
+  assertEqual((int)RoastProfile::MAX_SETPOINTS, profile.getSetpointCount());
 }
 
 test(Profile_ClearSetpoints) {
@@ -247,6 +253,25 @@ test(Profile_GetProfileProgress_Complete) {
   assertEqual((uint32_t)100, progress);
 }
 
+test(Profile_ContinueFrom_KeepsRunningClock) {
+  RoastProfile running;
+  running.clearSetpoints();
+  running.addSetpoint(60000, 300, 50);
+  running.addSetpoint(120000, 400, 75);
+  running.startProfile(200, 10000);
+
+  RoastProfile swapped;
+  swapped.clearSetpoints();
+  swapped.addSetpoint(60000, 320, 60);
+  swapped.addSetpoint(120000, 420, 80);
+  swapped.continueFrom(running);
+
+  // Same start time and starting temperature, so 30 s in is halfway from 200
+  // to the new profile's first setpoint rather than the end of the curve
+  assertEqual((uint32_t)260, swapped.getTargetTemp(40000));
+  assertEqual((uint32_t)25, swapped.getProfileProgress(40000));
+}
+
 // ============================================================================
 // SERIALIZATION/DESERIALIZATION TESTS
 // ============================================================================
@@ -259,10 +284,11 @@ test(Profile_Serialization_RoundTrip) {
   profile1.addSetpoint(180000, 450, 90);
   
   uint8_t buffer[200];
-  profile1.flattenProfile(buffer);
+  size_t length = profile1.flattenProfile(buffer, sizeof(buffer));
+  assertEqual(profile1.getFlattenedSize(), length);
   
   RoastProfile profile2;
-  profile2.unflattenProfile(buffer);
+  assertTrue(profile2.unflattenProfile(buffer, length));
   
   // Verify setpoint count
   assertEqual(profile1.getSetpointCount(), profile2.getSetpointCount());
@@ -283,12 +309,12 @@ test(Profile_Serialization_EmptyProfile) {
   profile1.clearSetpoints();
   
   uint8_t buffer[200];
-  profile1.flattenProfile(buffer);
+  size_t length = profile1.flattenProfile(buffer, sizeof(buffer));
   
   RoastProfile profile2;
   profile2.clearSetpoints();
   profile2.addSetpoint(99999, 999, 99); // Add garbage
-  profile2.unflattenProfile(buffer);
+  assertTrue(profile2.unflattenProfile(buffer, length));
   
   // Should have 1 setpoint (the default 0,0,0)
   assertEqual(1, profile2.getSetpointCount());
@@ -307,7 +333,7 @@ test(Profile_Deserialization_InvalidData) {
   profile.addSetpoint(60000, 300, 50);
   int originalCount = profile.getSetpointCount();
   
-  profile.unflattenProfile(badBuffer);
+  assertFalse(profile.unflattenProfile(badBuffer, sizeof(badBuffer)));
   
   // Should not change when data is invalid
   assertEqual(originalCount, profile.getSetpointCount());
@@ -320,13 +346,14 @@ test(Profile_Deserialization_ZeroCount) {
   badBuffer[1] = 0;
   badBuffer[2] = 0;
   badBuffer[3] = 0;
+  badBuffer[4] = 0;
   
   RoastProfile profile;
   profile.clearSetpoints();
   profile.addSetpoint(60000, 300, 50);
   int originalCount = profile.getSetpointCount();
   
-  profile.unflattenProfile(badBuffer);
+  assertFalse(profile.unflattenProfile(badBuffer, sizeof(badBuffer)));
   
   // Should not change when count is 0
   assertEqual(originalCount, profile.getSetpointCount());
@@ -395,3 +422,615 @@ test(Profile_BoundaryCondition_MaxFanSpeed) {
   uint32_t fanSpeed = profile.getTargetFanSpeed(70000);
   assertEqual((uint32_t)255, fanSpeed);
 }
+
+// ============================================================================
+// COMPILED TRAJECTORY TESTS
+// ============================================================================
+
+// The linear-scan, double-precision lookups the compiled trajectory
+// replaced; every query must still return exactly what these do.
+static uint32_t referenceTemp(const RoastProfile &profile, uint32_t currentTime) {
+  int count = profile.getSetpointCount();
+  for (int i = 0; i < count; i++) {
+    if (profile.getSetpoint(i).time > currentTime) {
+      if (i == 0) {
+        return profile.getSetpoint(i).temp;
+      }
+      uint32_t prevTemp = profile.getSetpoint(i - 1).temp;
+      uint32_t nextTemp = profile.getSetpoint(i).temp;
+      uint32_t prevTime = profile.getSetpoint(i - 1).time;
+      uint32_t nextTime = profile.getSetpoint(i).time;
+      if (nextTime == prevTime) {
+        return nextTemp;
+      }
+      double timeRatio = (double)(currentTime - prevTime) / (double)(nextTime - prevTime);
+      double result = (double)prevTemp + ((double)nextTemp - (double)prevTemp) * timeRatio;
+      int32_t out = (int32_t)lround(result);
+      if (out < 0) out = 0;
+      if (out > 500) out = 500;
+      return (uint32_t)out;
+    }
+  }
+  return profile.getSetpoint(count - 1).temp;
+}
+
+static uint32_t fanPwm(uint32_t percent) {
+  uint32_t pwm = ((uint64_t)percent * 255ULL) / 100ULL;
+  return (pwm > 255U) ? 255U : pwm;
+}
+
+static uint32_t referenceFan(const RoastProfile &profile, uint32_t currentTime) {
+  int count = profile.getSetpointCount();
+  for (int i = 0; i < count; i++) {
+    if (profile.getSetpoint(i).time >= currentTime) {
+      if (i == 0) {
+        return fanPwm(profile.getSetpoint(i).fanSpeed);
+      }
+      uint32_t prevFanSpeed = profile.getSetpoint(i - 1).fanSpeed;
+      uint32_t nextFanSpeed = profile.getSetpoint(i).fanSpeed;
+      uint32_t prevTime = profile.getSetpoint(i - 1).time;
+      uint32_t nextTime = profile.getSetpoint(i).time;
+      if (nextTime == prevTime) {
+        return fanPwm(nextFanSpeed);
+      }
+      double timeRatio = (double)(currentTime - prevTime) / (double)(nextTime - prevTime);
+      double pct = (double)prevFanSpeed + ((double)nextFanSpeed - (double)prevFanSpeed) * timeRatio;
+      int32_t pctInt = (int32_t)lround(pct);
+      if (pctInt < 0) pctInt = 0;
+      if (pctInt > 100) pctInt = 100;
+      return fanPwm(pctInt);
+    }
+  }
+  return fanPwm(profile.getSetpoint(count - 1).fanSpeed);
+}
+
+// Writes `profile` in the fixed 12-byte-per-setpoint v1 layout that
+// firmware before the v2 format stored in NVS.
+static size_t writeVersion1(const RoastProfile &profile, uint8_t *out) {
+  uint32_t count = profile.getSetpointCount();
+  out[0] = 1;
+  for (int b = 0; b < 4; b++) out[1 + b] = (uint8_t)(count >> (24 - 8 * b));
+  for (uint32_t i = 0; i < count; i++) {
+    auto sp = profile.getSetpoint(i);
+    const uint32_t fields[3] = {sp.time, sp.temp, sp.fanSpeed};
+    for (int f = 0; f < 3; f++) {
+      for (int b = 0; b < 4; b++) out[5 + i * 12 + f * 4 + b] = (uint8_t)(fields[f] >> (24 - 8 * b));
+    }
+  }
+  return 5 + count * 12;
+}
+
+static bool sameSetpoints(const RoastProfile &a, const RoastProfile &b) {
+  if (a.getSetpointCount() != b.getSetpointCount()) return false;
+  for (int i = 0; i < a.getSetpointCount(); i++) {
+    auto x = a.getSetpoint(i);
+    auto y = b.getSetpoint(i);
+    if (x.time != y.time || x.temp != y.temp || x.fanSpeed != y.fanSpeed) return false;
+  }
+  return true;
+}
+
+// Artisan-style export: a point every 2 s through a 12 minute roast.
+static void addDenseCurve(RoastProfile &profile) {
+  profile.clearSetpoints();
+  for (int i = 1; i < RoastProfile::MAX_SETPOINTS; i++) {
+    uint32_t t = i * 2400UL;
+    uint32_t temp = 200 + (uint32_t)(230.0 * sqrt(t / 720000.0));
+    profile.addSetpoint(t, temp, 100 - i / 20);
+  }
+}
+
+static uint32_t nextRandom(uint32_t &state) {
+  state = state * 1664525UL + 1013904223UL;
+  return state >> 8;
+}
+
+// Compares every lookup against the reference at `times`, returning the
+// number of mismatches.
+static uint32_t countMismatches(const RoastProfile &profile, uint32_t startTime, const uint32_t *times, uint32_t count) {
+  uint32_t mismatches = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t t = times[i];
+    if (profile.getTargetTemp(t + startTime) != referenceTemp(profile, t)) mismatches++;
+    if (profile.getTargetTempAtTime(t) != referenceTemp(profile, t)) mismatches++;
+    if (profile.getTargetFanSpeed(t + startTime) != referenceFan(profile, t)) mismatches++;
+  }
+  return mismatches;
+}
+
+// Forward every 250 ms (control loop), backward across 480 columns (display
+// plot), every millisecond around each setpoint, then random access.
+static uint32_t sweepMismatches(const RoastProfile &profile, uint32_t startTime, uint32_t &seed) {
+  static uint32_t times[4000];
+  uint32_t mismatches = 0;
+  int count = profile.getSetpointCount();
+  uint32_t endTime = 0;
+  for (int i = 0; i < count; i++) {
+    endTime = max(endTime, profile.getSetpoint(i).time);
+  }
+  uint32_t span = endTime + 60000UL;
+
+  uint32_t n = 0;
+  for (uint32_t t = 0; t <= span && n < 4000; t += max(span / 3999UL, 1UL)) times[n++] = t;
+  mismatches += countMismatches(profile, startTime, times, n);
+
+  n = 0;
+  for (uint32_t x = 0; x < 480; x++) times[n++] = (endTime * (479 - x)) / 480;
+  mismatches += countMismatches(profile, startTime, times, n);
+
+  n = 0;
+  for (int i = 0; i < count && n + 9 <= 4000; i++) {
+    uint32_t at = profile.getSetpoint(i).time;
+    for (uint32_t d = 0; d < 9; d++) times[n++] = at + d - 4;
+  }
+  mismatches += countMismatches(profile, startTime, times, n);
+
+  n = 0;
+  while (n < 2000) times[n++] = nextRandom(seed) % (span + 1);
+  mismatches += countMismatches(profile, startTime, times, n);
+  return mismatches;
+}
+
+test(Profile_Trajectory_MatchesLinearScan_TypicalRoast) {
+  RoastProfile profile;
+  profile.clearSetpoints();
+  profile.addSetpoint(60000, 300, 90);
+  profile.addSetpoint(240000, 350, 80);
+  profile.addSetpoint(420000, 395, 70);
+  profile.addSetpoint(540000, 420, 65);
+  profile.addSetpoint(660000, 435, 60);
+  profile.startProfile(73, 12345);
+
+  uint32_t seed = 1;
+  assertEqual((uint32_t)0, sweepMismatches(profile, 12345, seed));
+}
+
+// Segments where the exact result is a .5 that the double expression
+// computes as x.4999..., so lround() goes down where exact arithmetic would
+// round up (2F -> 110F over 240 ms reads 60F at 130 ms, not 61F).
+test(Profile_Trajectory_MatchesLinearScan_RoundingTies) {
+  RoastProfile profile;
+  profile.clearSetpoints();
+  profile.addSetpoint(240, 110, 3);
+  profile.addSetpoint(264, 453, 99);
+  profile.addSetpoint(288, 51, 0);
+  profile.addSetpoint(400, 408, 100);
+  profile.addSetpoint(512, 44, 1);
+  profile.startProfile(2, 0);
+
+  assertEqual((uint32_t)60, profile.getTargetTemp(130));
+  assertEqual((uint32_t)218, profile.getTargetTemp(278));
+  assertEqual((uint32_t)219, profile.getTargetTemp(458));
+
+  uint32_t mismatches = 0;
+  for (uint32_t t = 0; t < 600; t++) {
+    if (profile.getTargetTemp(t) != referenceTemp(profile, t)) mismatches++;
+    if (profile.getTargetFanSpeed(t) != referenceFan(profile, t)) mismatches++;
+  }
+  assertEqual((uint32_t)0, mismatches);
+}
+
+test(Profile_Trajectory_MatchesLinearScan_RandomProfiles) {
+  uint32_t seed = 12345;
+  uint32_t mismatches = 0;
+  for (int round = 0; round < 60; round++) {
+    RoastProfile profile;
+    profile.clearSetpoints();
+    int count = 1 + (int)(nextRandom(seed) % 9);
+    uint32_t t = 0;
+    for (int i = 0; i < count; i++) {
+      // Mostly increasing, with repeated and out-of-order times mixed in
+      uint32_t r = nextRandom(seed) % 10;
+      if (r == 0) {
+        // Repeat the previous time
+      } else if (r == 1 && t > 30000) {
+        t -= nextRandom(seed) % 30000;
+      } else {
+        t += 1 + nextRandom(seed) % (round % 2 ? 300000UL : 999UL);
+      }
+      profile.addSetpoint(t, nextRandom(seed) % 501, nextRandom(seed) % 101);
+    }
+    uint32_t startTime = nextRandom(seed);
+    profile.startProfile(nextRandom(seed) % 200, startTime);
+    mismatches += sweepMismatches(profile, startTime, seed);
+  }
+  assertEqual((uint32_t)0, mismatches);
+}
+
+// unflattenProfile() does not clamp, so loaded values can exceed what
+// addSetpoint() allows; those segments take the double expression.
+test(Profile_Trajectory_MatchesLinearScan_UnclampedLoad) {
+  RoastProfile source;
+  source.clearSetpoints();
+  source.addSetpoint(30000, 250, 50);
+  source.addSetpoint(90000, 450, 100);
+  source.addSetpoint(4000000000UL, 500, 100);
+  writeVersion1(source, buffer);
+  // Patch setpoint 1 to 70000F / 300% and setpoint 2's time past 2^31
+  uint32_t hugeTemp = 70000;
+  buffer[1 * 12 + 9] = (uint8_t)(hugeTemp >> 24);
+  buffer[1 * 12 + 10] = (uint8_t)(hugeTemp >> 16);
+  buffer[1 * 12 + 11] = (uint8_t)(hugeTemp >> 8);
+  buffer[1 * 12 + 12] = (uint8_t)(hugeTemp);
+  buffer[1 * 12 + 16] = 44;
+  buffer[1 * 12 + 15] = 1;
+
+  RoastProfile profile;
+  assertTrue(profile.unflattenProfile(buffer, sizeof(buffer)));
+  assertEqual((uint32_t)70000, profile.getSetpoint(1).temp);
+
+  uint32_t seed = 99;
+  assertEqual((uint32_t)0, sweepMismatches(profile, 0, seed));
+}
+
+test(Profile_Trajectory_RecompilesOnChange) {
+  RoastProfile profile;
+  profile.clearSetpoints();
+  profile.addSetpoint(60000, 300, 50);
+  profile.addSetpoint(120000, 400, 100);
+  profile.startProfile(100, 0);
+  assertEqual((uint32_t)200, profile.getTargetTemp(30000));
+  assertEqual((uint32_t)350, profile.getTargetTemp(90000));
+
+  profile.setFinalTargetTemp(500);
+  assertEqual((uint32_t)400, profile.getTargetTemp(90000));
+
+  profile.startProfile(200, 1000);
+  assertEqual((uint32_t)250, profile.getTargetTemp(31000));
+
+  profile.clearSetpoints();
+  profile.addSetpoint(10000, 150, 20);
+  profile.startProfile(100, 0);
+  assertEqual((uint32_t)125, profile.getTargetTemp(5000));
+  assertEqual((uint32_t)150, profile.getTargetTemp(90000));
+}
+
+// ============================================================================
+// COMPACT ENCODING TESTS
+// ============================================================================
+
+test(Profile_Crc32_MatchesStandardCheckValue) {
+  const char *check = "123456789";
+  assertEqual((uint32_t)0xCBF43926UL, crc32((const uint8_t *)check, 9));
+  assertEqual((uint32_t)0xCBF43926UL, crc32Update(crc32((const uint8_t *)check, 4), (const uint8_t *)check + 4, 5));
+}
+
+test(Profile_Serialization_V2_IsCompact) {
+  RoastProfile profile;
+  profile.clearSetpoints();
+  profile.addSetpoint(60000, 300, 90);
+  profile.addSetpoint(240000, 350, 80);
+  profile.addSetpoint(420000, 395, 70);
+  profile.addSetpoint(660000, 435, 60);
+  // 5 setpoints: 12 bytes each in v1, 3-5 in v2
+  assertLessOrEqual(profile.getFlattenedSize(), (size_t)(2 + 1 + 5 * 5 + 4));
+  assertEqual(profile.getFlattenedSize(), profile.flattenProfile(buffer, sizeof(buffer)));
+  assertEqual((uint8_t)RoastProfile::FORMAT_VERSION, buffer[0]);
+  assertEqual((uint8_t)3, buffer[1]); // Whole seconds
+
+  RoastProfile dense;
+  addDenseCurve(dense);
+  // 3605 bytes in v1
+  assertLess(dense.getFlattenedSize(), (size_t)RoastProfile::MAX_SETPOINTS * 4);
+}
+
+test(Profile_Serialization_V2_DenseRoundTrip) {
+  RoastProfile source;
+  addDenseCurve(source);
+  assertEqual((int)RoastProfile::MAX_SETPOINTS, source.getSetpointCount());
+
+  static uint8_t blob[2048];
+  size_t length = source.flattenProfile(blob, sizeof(blob));
+  assertEqual(source.getFlattenedSize(), length);
+  assertEqual((size_t)0, source.flattenProfile(blob, length - 1));
+
+  RoastProfile loaded;
+  assertTrue(loaded.unflattenProfile(blob, length));
+  assertTrue(sameSetpoints(source, loaded));
+  assertEqual((uint8_t)2, loaded.getProfileVersion());
+
+  uint32_t seed = 7;
+  loaded.startProfile(75, 0);
+  assertEqual((uint32_t)0, sweepMismatches(loaded, 0, seed));
+}
+
+test(Profile_Serialization_V2_KeepsSubSecondTimes) {
+  RoastProfile source;
+  source.clearSetpoints();
+  source.addSetpoint(250, 210, 100);
+  source.addSetpoint(4750, 215, 100);
+  source.addSetpoint(9000, 212, 95);
+  size_t length = source.flattenProfile(buffer, sizeof(buffer));
+  assertEqual((uint8_t)1, buffer[1]); // 10 ms units
+
+  RoastProfile loaded;
+  assertTrue(loaded.unflattenProfile(buffer, length));
+  assertTrue(sameSetpoints(source, loaded));
+
+  // Times out of order and a single millisecond still round-trip
+  source.addSetpoint(3001, 500, 0);
+  source.addSetpoint(0, 0, 100);
+  length = source.flattenProfile(buffer, sizeof(buffer));
+  assertEqual((uint8_t)0, buffer[1]);
+  assertTrue(loaded.unflattenProfile(buffer, length));
+  assertTrue(sameSetpoints(source, loaded));
+}
+
+test(Profile_Serialization_V2_RejectsCorruptData) {
+  RoastProfile source;
+  source.clearSetpoints();
+  source.addSetpoint(60000, 300, 50);
+  source.addSetpoint(120000, 400, 75);
+  uint8_t blob[64] = {};
+  size_t length = source.flattenProfile(blob, sizeof(blob));
+
+  RoastProfile target;
+  target.clearSetpoints();
+  target.addSetpoint(30000, 250, 40);
+  RoastProfile original = target;
+
+  // Every single-bit flip and every truncation is caught
+  for (size_t i = 0; i < length; i++) {
+    for (int bit = 0; bit < 8; bit++) {
+      blob[i] ^= (uint8_t)(1 << bit);
+      assertFalse(target.unflattenProfile(blob, length));
+      blob[i] ^= (uint8_t)(1 << bit);
+    }
+  }
+  for (size_t cut = 0; cut < length; cut++) {
+    assertFalse(target.unflattenProfile(blob, cut));
+  }
+  assertFalse(target.unflattenProfile(nullptr, length));
+  assertTrue(sameSetpoints(original, target));
+  assertTrue(target.unflattenProfile(blob, length));
+}
+
+test(Profile_Serialization_V2_RejectsOversizedCount) {
+  // Well-formed and CRC-valid, but one setpoint more than a profile holds
+  uint8_t blob[2048];
+  uint8_t *out = blob;
+  *out++ = 2;
+  *out++ = 3;
+  out = writeVarint(out, RoastProfile::MAX_SETPOINTS + 1);
+  for (int i = 0; i < RoastProfile::MAX_SETPOINTS + 1; i++) {
+    *out++ = 2;
+    *out++ = 0;
+    *out++ = 0;
+  }
+  uint32_t crc = crc32(blob, out - blob);
+  for (int shift = 0; shift < 32; shift += 8) *out++ = (uint8_t)(crc >> shift);
+
+  RoastProfile target;
+  assertFalse(target.unflattenProfile(blob, out - blob));
+  assertEqual(1, target.getSetpointCount());
+}
+
+test(Profile_Serialization_MigratesVersion1) {
+  RoastProfile source;
+  source.clearSetpoints();
+  source.addSetpoint(60000, 300, 50);
+  source.addSetpoint(120000, 400, 75);
+  source.addSetpoint(180000, 450, 90);
+  size_t v1Length = writeVersion1(source, buffer);
+  assertEqual((size_t)(5 + 4 * 12), v1Length);
+
+  RoastProfile migrated;
+  assertTrue(migrated.unflattenProfile(buffer, v1Length));
+  assertEqual((uint8_t)1, migrated.getProfileVersion());
+  assertTrue(sameSetpoints(source, migrated));
+  // v1 blobs written into a zero-padded 200-byte buffer load too
+  assertTrue(migrated.unflattenProfile(buffer, sizeof(buffer)));
+  assertFalse(migrated.unflattenProfile(buffer, v1Length - 1));
+
+  // Saving again writes v2
+  uint8_t blob[64] = {};
+  size_t length = migrated.flattenProfile(blob, sizeof(blob));
+  assertEqual((uint8_t)2, blob[0]);
+  assertLess(length, v1Length);
+  RoastProfile reloaded;
+  assertTrue(reloaded.unflattenProfile(blob, length));
+  assertEqual((uint8_t)2, reloaded.getProfileVersion());
+  assertTrue(sameSetpoints(source, reloaded));
+
+  // Unknown future versions are refused
+  blob[0] = 3;
+  assertFalse(reloaded.unflattenProfile(blob, length));
+}
+
+// ============================================================================
+// PCHIP INTERPOLATION TESTS
+// ============================================================================
+
+// Drying plateau, Maillard ramp, a flat hold and a cool-down dip.
+static void addShapedCurve(RoastProfile &profile) {
+  profile.clearSetpoints();
+  profile.addSetpoint(60000, 300, 90);
+  profile.addSetpoint(120000, 310, 90);
+  profile.addSetpoint(240000, 380, 80);
+  profile.addSetpoint(360000, 420, 70);
+  profile.addSetpoint(420000, 420, 70);
+  profile.addSetpoint(480000, 400, 60);
+  profile.addSetpoint(600000, 440, 60);
+  profile.startProfile(150, 0);
+}
+
+test(Profile_Pchip_PassesThroughSetpoints) {
+  RoastProfile profile;
+  addShapedCurve(profile);
+  assertEqual((uint8_t)RoastProfile::INTERPOLATION_LINEAR, (uint8_t)profile.getInterpolationMode());
+  profile.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+  assertEqual((uint8_t)RoastProfile::INTERPOLATION_PCHIP, (uint8_t)profile.getInterpolationMode());
+  for (int i = 0; i < profile.getSetpointCount(); i++) {
+    auto sp = profile.getSetpoint(i);
+    assertEqual(sp.temp, profile.getTargetTemp(sp.time));
+  }
+  assertEqual((uint32_t)440, profile.getTargetTemp(900000));
+  // Fan speed stays linear
+  assertEqual(fanPwm(85), profile.getTargetFanSpeed(180000));
+
+  // Startup rewrites setpoint 0, and the cubic follows it
+  profile.startProfile(200, 5000);
+  assertEqual((uint32_t)200, profile.getTargetTemp(5000));
+}
+
+test(Profile_Pchip_MonotoneWithoutOvershoot) {
+  RoastProfile profile;
+  addShapedCurve(profile);
+  profile.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+  for (int i = 1; i < profile.getSetpointCount(); i++) {
+    auto start = profile.getSetpoint(i - 1);
+    auto end = profile.getSetpoint(i);
+    uint32_t low = min(start.temp, end.temp);
+    uint32_t high = max(start.temp, end.temp);
+    uint32_t previous = start.temp;
+    for (uint32_t t = start.time; t <= end.time; t += 250) {
+      uint32_t temp = profile.getTargetTemp(t);
+      assertTrue(temp >= low && temp <= high);
+      if (end.temp >= start.temp) {
+        assertMoreOrEqual(temp, previous);
+      } else {
+        assertLessOrEqual(temp, previous);
+      }
+      previous = temp;
+    }
+  }
+  // The flat hold stays flat
+  assertEqual((uint32_t)420, profile.getTargetTemp(390000));
+}
+
+test(Profile_Pchip_SmoothsSlopeAtSetpoints) {
+  RoastProfile linear;
+  addShapedCurve(linear);
+  RoastProfile pchip;
+  addShapedCurve(pchip);
+  pchip.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+
+  // Rate-of-rise change across each interior setpoint, in degrees per 10 s
+  int32_t linearJump = 0;
+  int32_t pchipJump = 0;
+  for (int i = 1; i + 1 < linear.getSetpointCount(); i++) {
+    uint32_t t = linear.getSetpoint(i).time;
+    int32_t linearLeft = (int32_t)linear.getTargetTemp(t) - (int32_t)linear.getTargetTemp(t - 10000);
+    int32_t linearRight = (int32_t)linear.getTargetTemp(t + 10000) - (int32_t)linear.getTargetTemp(t);
+    int32_t pchipLeft = (int32_t)pchip.getTargetTemp(t) - (int32_t)pchip.getTargetTemp(t - 10000);
+    int32_t pchipRight = (int32_t)pchip.getTargetTemp(t + 10000) - (int32_t)pchip.getTargetTemp(t);
+    linearJump += abs(linearRight - linearLeft);
+    pchipJump += abs(pchipRight - pchipLeft);
+  }
+  assertLess(pchipJump * 2, linearJump);
+}
+
+test(Profile_Pchip_SkipsRepeatedAndOutOfOrderTimes) {
+  RoastProfile profile;
+  profile.clearSetpoints();
+  profile.addSetpoint(60000, 300, 50);
+  profile.addSetpoint(60000, 320, 50);
+  profile.addSetpoint(120000, 400, 50);
+  profile.addSetpoint(90000, 350, 50);
+  profile.addSetpoint(180000, 450, 50);
+  profile.startProfile(100, 0);
+  profile.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+  assertEqual((uint32_t)320, profile.getTargetTemp(60000));
+  // Each usable run here is a single segment, so the cubics reduce to lines
+  assertEqual(referenceTemp(profile, 120000), profile.getTargetTemp(120000));
+  assertEqual(referenceTemp(profile, 150000), profile.getTargetTemp(150000));
+  assertEqual((uint32_t)450, profile.getTargetTemp(180000));
+  uint32_t previous = 0;
+  for (uint32_t t = 0; t <= 200000; t += 250) {
+    uint32_t temp = profile.getTargetTemp(t);
+    assertTrue(temp >= 100 && temp <= 450);
+    if (t < 60000) {
+      assertMoreOrEqual(temp, previous);
+    }
+    previous = temp;
+  }
+
+  // Back to linear matches the reference exactly
+  profile.setInterpolationMode(RoastProfile::INTERPOLATION_LINEAR);
+  uint32_t seed = 12;
+  assertEqual((uint32_t)0, sweepMismatches(profile, 0, seed));
+}
+
+test(Profile_Pchip_RoundTripsMode) {
+  RoastProfile source;
+  addShapedCurve(source);
+  source.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+  size_t length = source.flattenProfile(buffer, sizeof(buffer));
+  assertMore(length, (size_t)0);
+  assertEqual((uint8_t)(3 | 0x04), buffer[1]);
+
+  RoastProfile target;
+  assertTrue(target.unflattenProfile(buffer, length));
+  assertEqual((uint8_t)RoastProfile::INTERPOLATION_PCHIP, (uint8_t)target.getInterpolationMode());
+  target.startProfile(150, 0);
+  for (uint32_t t = 0; t <= 600000; t += 1000) {
+    assertEqual(source.getTargetTemp(t), target.getTargetTemp(t));
+  }
+
+  // Reserved flag bits are refused even with a valid CRC
+  buffer[1] |= 0x08;
+  uint32_t crc = crc32(buffer, length - 4);
+  for (int shift = 0; shift < 32; shift += 8) {
+    buffer[length - 4 + shift / 8] = (uint8_t)(crc >> shift);
+  }
+  assertFalse(target.unflattenProfile(buffer, length));
+
+  // Linear profiles and v1 blobs load as linear
+  RoastProfile linear;
+  addShapedCurve(linear);
+  length = linear.flattenProfile(buffer, sizeof(buffer));
+  assertTrue(target.unflattenProfile(buffer, length));
+  assertEqual((uint8_t)RoastProfile::INTERPOLATION_LINEAR, (uint8_t)target.getInterpolationMode());
+  target.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+  length = writeVersion1(linear, buffer);
+  assertTrue(target.unflattenProfile(buffer, length));
+  assertEqual((uint8_t)RoastProfile::INTERPOLATION_LINEAR, (uint8_t)target.getInterpolationMode());
+}
+
+test(Profile_CallerCursorMatchesSharedLookup) {
+  RoastProfile reference;
+  addShapedCurve(reference);
+  RoastProfile shaped;
+  addShapedCurve(shaped);
+  shaped.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+  reference.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+
+  // A control tick followed by a look-ahead sweep, as the MPC path does
+  uint16_t cursors[4] = {};
+  for (uint32_t t = 0; t <= 600000; t += 250) {
+    assertEqual(reference.getTargetTemp(t), shaped.getTargetTemp(t));
+    for (uint8_t point = 0; point < 4; point++) {
+      uint32_t ahead = t + (point + 1) * 45000UL;
+      assertEqual(reference.getTargetTempAtTime(ahead), shaped.getTargetTemp(ahead, cursors[point]));
+    }
+  }
+
+  // Stale or out-of-range cursors only cost a search
+  uint16_t stale = 60000;
+  assertEqual(reference.getTargetTemp(300000), shaped.getTargetTemp(300000, stale));
+  assertLess((int)stale, reference.getSetpointCount() + 1);
+}
+
+test(Profile_BulkAppendMatchesAddSetpoint) {
+  RoastProfile reference;
+  addShapedCurve(reference);
+  reference.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+
+  // The loaders' path: append everything, compile once
+  RoastProfile bulk;
+  bulk.clearSetpoints();
+  for (int i = 1; i < reference.getSetpointCount(); i++) {
+    auto sp = reference.getSetpoint(i);
+    bulk.appendSetpoint(sp.time, sp.temp, sp.fanSpeed);
+  }
+  bulk.setInterpolationMode(RoastProfile::INTERPOLATION_PCHIP);
+  bulk.finishSetpoints();
+  bulk.startProfile(150, 0);
+
+  assertEqual(reference.getSetpointCount(), bulk.getSetpointCount());
+  uint16_t cursor = 0;
+  for (uint32_t t = 0; t <= 620000; t += 1000) {
+    assertEqual(reference.getTargetTempAtTime(t), bulk.getTargetTempAtTime(t, cursor));
+    assertEqual(reference.getTargetFanSpeed(t), bulk.getTargetFanSpeed(t));
+  }
+}
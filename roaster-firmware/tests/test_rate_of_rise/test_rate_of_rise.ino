@@ -0,0 +1,220 @@
+/**
+ * Rate-of-Rise Estimator Tests
+ *
+ * Tests for the sliding-window least-squares RoR estimator including:
+ * - Exact slope on linear ramps, in °F/s and °F/min
+ * - Sample-count and time-window eviction
+ * - Noise rejection compared with two-point differencing
+ * - Agreement with a from-scratch least-squares fit over long runs
+ * - millis() wraparound and out-of-order samples
+ */
+
+#include <AUnit.h>
+#include "../../src/control/RateOfRiseEstimator.hpp"
+
+using namespace aunit;
+
+#define SAMPLE_MS 250UL
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// Reference slope (per second) over the last `count` points of y = f(i).
+static double bruteForceSlope(const double *times, const double *values, size_t count)
+{
+  double meanT = 0.0;
+  double meanY = 0.0;
+  for (size_t index = 0; index < count; index++)
+  {
+    meanT += times[index];
+    meanY += values[index];
+  }
+  meanT /= count;
+  meanY /= count;
+
+  double numerator = 0.0;
+  double denominator = 0.0;
+  for (size_t index = 0; index < count; index++)
+  {
+    numerator += (times[index] - meanT) * (values[index] - meanY);
+    denominator += (times[index] - meanT) * (times[index] - meanT);
+  }
+  return numerator / denominator;
+}
+
+// ============================================================================
+// Basic Slope Tests
+// ============================================================================
+
+test(RoR_InvalidUntilMinimumSamples)
+{
+  RateOfRiseEstimator estimator(30000);
+  assertFalse(estimator.isValid());
+  assertEqual(0.0, estimator.getRatePerMinute());
+
+  estimator.addSample(1000, 200.0);
+  estimator.addSample(1250, 200.5);
+  assertFalse(estimator.isValid());
+
+  estimator.addSample(1500, 201.0);
+  assertTrue(estimator.isValid());
+  assertNear(2.0, estimator.getRatePerSecond(), 1e-6);
+}
+
+test(RoR_ExactOnLinearRamp)
+{
+  RateOfRiseEstimator estimator(30000);
+  // 15°F/min = 0.25°F/s
+  for (uint32_t step = 0; step < 400; step++)
+  {
+    estimator.addSample(step * SAMPLE_MS, 150.0 + 0.25 * step * SAMPLE_MS / 1000.0);
+  }
+  assertNear(15.0, estimator.getRatePerMinute(), 0.01);
+  assertEqual(121, (int)estimator.getSampleCount()); // 30 s window, inclusive
+}
+
+test(RoR_FollowsSlopeChangeAfterWindow)
+{
+  RateOfRiseEstimator estimator(10000);
+  uint32_t nowMs = 0;
+  double temp = 300.0;
+  for (int step = 0; step < 80; step++, nowMs += SAMPLE_MS)
+  {
+    temp += 20.0 / 60.0 * SAMPLE_MS / 1000.0;
+    estimator.addSample(nowMs, temp);
+  }
+  assertNear(20.0, estimator.getRatePerMinute(), 0.05);
+
+  // Development phase: RoR drops to 8°F/min.
+  for (int step = 0; step < 20; step++, nowMs += SAMPLE_MS)
+  {
+    temp += 8.0 / 60.0 * SAMPLE_MS / 1000.0;
+    estimator.addSample(nowMs, temp);
+  }
+  double partial = estimator.getRatePerMinute();
+  assertMore(partial, 8.0);
+  assertLess(partial, 20.0);
+
+  for (int step = 0; step < 41; step++, nowMs += SAMPLE_MS)
+  {
+    temp += 8.0 / 60.0 * SAMPLE_MS / 1000.0;
+    estimator.addSample(nowMs, temp);
+  }
+  assertNear(8.0, estimator.getRatePerMinute(), 0.05);
+}
+
+test(RoR_RejectsQuantizationNoise)
+{
+  RateOfRiseEstimator estimator(30000);
+  double lastTemp = 0.0;
+  double worstTwoPoint = 0.0;
+  for (uint32_t step = 0; step < 200; step++)
+  {
+    // 12°F/min ramp with the MAX6675's ±0.45°F quantization jitter.
+    double temp = 250.0 + 0.2 * step * SAMPLE_MS / 1000.0 + ((step % 2) ? 0.45 : -0.45);
+    if (step > 0)
+    {
+      double twoPoint = (temp - lastTemp) / (SAMPLE_MS / 1000.0) * 60.0;
+      worstTwoPoint = max(worstTwoPoint, fabs(twoPoint - 12.0));
+    }
+    lastTemp = temp;
+    estimator.addSample(step * SAMPLE_MS, temp);
+  }
+  assertMore(worstTwoPoint, 100.0);
+  assertNear(12.0, estimator.getRatePerMinute(), 0.2);
+}
+
+// ============================================================================
+// Window and Numerical Tests
+// ============================================================================
+
+test(RoR_MatchesBruteForceOverLongRun)
+{
+  const uint32_t windowMs = 15000;
+  const size_t windowPoints = windowMs / SAMPLE_MS + 1;
+  RateOfRiseEstimator estimator(windowMs);
+  double times[windowPoints];
+  double values[windowPoints];
+
+  // Two hours of samples: many rebuild cycles with a curved, noisy trace.
+  const uint32_t steps = 2 * 60 * 60 * 4;
+  for (uint32_t step = 0; step < steps; step++)
+  {
+    double seconds = step * SAMPLE_MS / 1000.0;
+    double temp = 200.0 + 80.0 * sin(seconds / 300.0) + 0.25 * ((step * 7919) % 5);
+    estimator.addSample(step * SAMPLE_MS, temp);
+    times[step % windowPoints] = seconds;
+    values[step % windowPoints] = static_cast<float>(temp);
+  }
+
+  assertEqual((int)windowPoints, (int)estimator.getSampleCount());
+  double expected = bruteForceSlope(times, values, windowPoints);
+  assertNear(expected, estimator.getRatePerSecond(), 1e-6);
+}
+
+test(RoR_CapacityBoundsWindow)
+{
+  SlidingSlopeEstimator<8> estimator(60000);
+  for (uint32_t step = 0; step < 20; step++)
+  {
+    estimator.addSample(step * 1000, step < 12 ? 0.0 : (step - 12) * 2.0);
+  }
+  assertEqual(8, (int)estimator.getSampleCount());
+  assertNear(2.0, estimator.getRatePerSecond(), 1e-6);
+}
+
+test(RoR_ShrinkingWindowEvicts)
+{
+  RateOfRiseEstimator estimator(60000);
+  for (uint32_t step = 0; step <= 240; step++)
+  {
+    estimator.addSample(step * SAMPLE_MS, step < 200 ? 100.0 : 100.0 + (step - 200) * 0.25);
+  }
+  assertLess(estimator.getRatePerSecond(), 0.5);
+
+  estimator.setWindowMs(10000);
+  assertEqual(41, (int)estimator.getSampleCount());
+  assertNear(1.0, estimator.getRatePerSecond(), 1e-6);
+}
+
+test(RoR_HandlesMillisWraparound)
+{
+  RateOfRiseEstimator estimator(30000);
+  uint32_t startMs = 0xFFFFFFFFUL - 5000;
+  for (uint32_t step = 0; step < 80; step++)
+  {
+    estimator.addSample(startMs + step * SAMPLE_MS, 180.0 + 0.5 * step * SAMPLE_MS / 1000.0);
+  }
+  assertNear(30.0, estimator.getRatePerMinute(), 0.01);
+}
+
+test(RoR_IgnoresStaleSamplesAndResets)
+{
+  RateOfRiseEstimator estimator(30000);
+  estimator.addSample(1000, 200.0);
+  estimator.addSample(2000, 201.0);
+  estimator.addSample(3000, 202.0);
+  estimator.addSample(3000, 500.0); // Same timestamp
+  estimator.addSample(2500, 0.0);   // Backwards
+  assertEqual(3, (int)estimator.getSampleCount());
+  assertNear(1.0, estimator.getRatePerSecond(), 1e-6);
+
+  // A gap longer than the window starts over from the new sample.
+  estimator.addSample(60000, 150.0);
+  assertEqual(1, (int)estimator.getSampleCount());
+  assertFalse(estimator.isValid());
+
+  estimator.reset();
+  assertEqual(0, (int)estimator.getSampleCount());
+  assertEqual(0.0, estimator.getRatePerSecond());
+}
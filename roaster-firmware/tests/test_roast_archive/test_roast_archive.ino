@@ -0,0 +1,433 @@
+/**
+ * Roast Archive Tests
+ *
+ * Tests for the on-flash roast archive including:
+ * - Headers round-trip and a damaged header is rejected
+ * - The delta-coded sample stream decodes to what was recorded
+ * - Samples reach flash in chunks and the final header counts them
+ * - The most serious outcome noted during a roast is kept
+ * - Ring retention by roast count and by bytes, oldest first
+ * - A roast cut off by a reset is kept as interrupted
+ * - CSV and JSON exports stream in small chunks and match the samples
+ * - The listing is newest first
+ */
+
+#include <AUnit.h>
+#include <map>
+#include <string>
+#include "../../src/profiles/RoastArchive.hpp"
+
+using namespace aunit;
+
+// Roast files in RAM, counting writes so the tests can see flushes
+class MemoryRoastFiles : public RoastArchiveFiles
+{
+public:
+  std::map<uint32_t, std::vector<uint8_t>> files;
+  size_t appends = 0;
+  bool mounted = true;
+
+  bool begin() override { return mounted; }
+
+  void list(std::vector<uint32_t> &ids) override
+  {
+    for (const auto &file : files)
+      ids.push_back(file.first);
+  }
+
+  size_t size(uint32_t id) override
+  {
+    auto it = files.find(id);
+    return it == files.end() ? 0 : it->second.size();
+  }
+
+  size_t read(uint32_t id, size_t offset, uint8_t *out, size_t length) override
+  {
+    auto it = files.find(id);
+    if (it == files.end() || offset >= it->second.size())
+      return 0;
+    size_t got = std::min(length, it->second.size() - offset);
+    memcpy(out, it->second.data() + offset, got);
+    return got;
+  }
+
+  bool create(uint32_t id, const uint8_t *data, size_t length) override
+  {
+    files[id].assign(data, data + length);
+    return true;
+  }
+
+  bool append(uint32_t id, const uint8_t *data, size_t length) override
+  {
+    auto it = files.find(id);
+    if (it == files.end())
+      return false;
+    it->second.insert(it->second.end(), data, data + length);
+    appends++;
+    return true;
+  }
+
+  bool overwrite(uint32_t id, size_t offset, const uint8_t *data, size_t length) override
+  {
+    auto it = files.find(id);
+    if (it == files.end() || offset + length > it->second.size())
+      return false;
+    memcpy(it->second.data() + offset, data, length);
+    return true;
+  }
+
+  bool remove(uint32_t id) override { return files.erase(id) > 0; }
+};
+
+static RoastArchiveHeader roastInfo(const char *profileName)
+{
+  RoastArchiveHeader info;
+  roastArchiveCopyString(info.profileId, sizeof(info.profileId), "p1");
+  roastArchiveCopyString(info.profileName, sizeof(info.profileName), profileName);
+  info.startedAt = 1760000000;
+  info.finalTargetTempF = 430;
+  info.kp = 8.0f;
+  info.ki = 0.46f;
+  info.kd = 0.0f;
+  return info;
+}
+
+// A plausible roast curve: bean temperature rising, fan stepping down
+static RoastArchiveSample sampleAt(uint32_t second)
+{
+  RoastArchiveSample sample;
+  sample.elapsedSeconds = second;
+  sample.beanTenthsF = static_cast<int16_t>(700 + second * 4 - (second % 7));
+  sample.targetTenthsF = static_cast<int16_t>(720 + second * 4);
+  sample.heaterTenths = static_cast<int16_t>(1800 + (second % 5) * 15);
+  sample.fanTempTenthsF = static_cast<int16_t>(650 + second * 5);
+  sample.fanTenths = static_cast<int16_t>(2550 - (second / 60) * 100);
+  return sample;
+}
+
+static void recordRoast(RoastArchive &archive, uint32_t seconds, const char *name = "City Roast")
+{
+  archive.startRoast(roastInfo(name));
+  for (uint32_t second = 0; second < seconds; second++)
+    archive.recordSample(sampleAt(second));
+  archive.finishRoast(ROAST_ARCHIVE_PASSED, "final_target_reached");
+}
+
+template <typename Stream>
+static std::string drain(Stream &stream, size_t chunk)
+{
+  std::string text;
+  uint8_t buffer[64];
+  size_t got;
+  while ((got = stream.read(buffer, std::min(chunk, sizeof(buffer)))) > 0)
+    text.append(reinterpret_cast<char *>(buffer), got);
+  return text;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Format Tests
+// ============================================================================
+
+test(RoastArchive_HeaderRoundTripsAndChecksItself)
+{
+  RoastArchiveHeader header = roastInfo("Ethiopia Guji");
+  header.id = 42;
+  header.outcome = ROAST_ARCHIVE_TERMINATED;
+  header.sampleCount = 611;
+  roastArchiveCopyString(header.reason, sizeof(header.reason), "user_stop");
+  uint8_t raw[ROAST_ARCHIVE_HEADER_SIZE];
+  encodeRoastArchiveHeader(header, raw);
+
+  RoastArchiveHeader decoded;
+  assertTrue(decodeRoastArchiveHeader(raw, sizeof(raw), decoded));
+  assertEqual((uint32_t)42, decoded.id);
+  assertEqual((int)ROAST_ARCHIVE_TERMINATED, (int)decoded.outcome);
+  assertEqual((uint32_t)611, decoded.sampleCount);
+  assertEqual((uint32_t)430, decoded.finalTargetTempF);
+  assertNear(0.46, (double)decoded.ki, 1e-6);
+  assertEqual(String("Ethiopia Guji"), String(decoded.profileName));
+  assertEqual(String("user_stop"), String(decoded.reason));
+
+  raw[40] ^= 0x01;
+  assertFalse(decodeRoastArchiveHeader(raw, sizeof(raw), decoded));
+}
+
+test(RoastArchive_DeltaStreamDecodesExactly)
+{
+  RoastSampleCodec encoder;
+  uint8_t stream[64 * ROAST_ARCHIVE_MAX_SAMPLE_BYTES];
+  uint8_t *end = stream;
+  RoastArchiveSample extremes = {40000, -32768, 32767, 0, -1, 2550};
+  for (uint32_t second = 0; second < 60; second++)
+    end = encoder.encode(sampleAt(second), end);
+  uint8_t *before = end;
+  end = encoder.encode(extremes, end);
+  assertTrue((size_t)(end - before) <= ROAST_ARCHIVE_MAX_SAMPLE_BYTES);
+  // Slowly changing values cost a byte or two per field, not the 12 raw
+  assertTrue((size_t)(before - stream) <= 60 * 8);
+
+  RoastSampleCodec decoder;
+  const uint8_t *cursor = stream;
+  RoastArchiveSample sample;
+  for (uint32_t second = 0; second < 60; second++)
+  {
+    assertTrue(decoder.decode(cursor, end, sample));
+    RoastArchiveSample expected = sampleAt(second);
+    assertEqual(expected.elapsedSeconds, sample.elapsedSeconds);
+    assertEqual(expected.beanTenthsF, sample.beanTenthsF);
+    assertEqual(expected.fanTenths, sample.fanTenths);
+  }
+  // A sample cut short is left for a retry
+  const uint8_t *partial = cursor;
+  assertFalse(decoder.decode(partial, end - 1, sample));
+  assertTrue(partial == cursor);
+  assertTrue(decoder.decode(cursor, end, sample));
+  assertEqual((uint32_t)40000, sample.elapsedSeconds);
+  assertEqual((int16_t)-32768, sample.beanTenthsF);
+  assertEqual((int16_t)32767, sample.targetTenthsF);
+  assertTrue(cursor == end);
+}
+
+// ============================================================================
+// Recording Tests
+// ============================================================================
+
+test(RoastArchive_RecordsInChunksAndFinishesHeader)
+{
+  MemoryRoastFiles files;
+  RoastArchive archive(files);
+  assertTrue(archive.begin());
+  assertTrue(archive.startRoast(roastInfo("City Roast")));
+  uint32_t id = archive.currentId();
+  assertEqual((uint32_t)1, id);
+  assertEqual(ROAST_ARCHIVE_HEADER_SIZE, files.size(id));
+
+  for (uint32_t second = 0; second < 900; second++)
+    archive.recordSample(sampleAt(second));
+  // Appended a chunk at a time, not once a second
+  assertTrue(files.appends > 0);
+  assertTrue(files.appends < 900 / 20);
+
+  archive.noteOutcome(ROAST_ARCHIVE_PASSED, "final_target_reached");
+  assertTrue(archive.finishRoast(ROAST_ARCHIVE_RECORDING, "cooling_complete"));
+  assertFalse(archive.isRecording());
+
+  RoastArchiveReader reader;
+  assertTrue(reader.open(files, id));
+  const RoastArchiveHeader &header = reader.getHeader();
+  assertEqual((int)ROAST_ARCHIVE_PASSED, (int)header.outcome);
+  assertEqual(String("final_target_reached"), String(header.reason));
+  assertEqual((uint32_t)900, header.sampleCount);
+  assertEqual((uint32_t)899, header.durationSeconds);
+  assertEqual(files.size(id), ROAST_ARCHIVE_HEADER_SIZE + header.streamBytes);
+  // About 5 KB for a 15 minute roast
+  assertTrue(header.streamBytes < 6 * 1024);
+
+  RoastArchiveSample sample;
+  uint32_t count = 0;
+  while (reader.next(sample))
+  {
+    assertEqual(sampleAt(count).beanTenthsF, sample.beanTenthsF);
+    count++;
+  }
+  assertEqual((uint32_t)900, count);
+  assertEqual(header.streamCrc, reader.consumedCrc());
+}
+
+test(RoastArchive_KeepsMostSeriousOutcome)
+{
+  MemoryRoastFiles files;
+  RoastArchive archive(files);
+  archive.begin();
+  archive.startRoast(roastInfo("A"));
+  archive.noteOutcome(ROAST_ARCHIVE_TERMINATED, "user_stop");
+  archive.noteOutcome(ROAST_ARCHIVE_PASSED, "final_target_reached");
+  archive.finishRoast(ROAST_ARCHIVE_ERRORED, "bean_tc_fault");
+
+  RoastArchiveReader reader;
+  assertTrue(reader.open(files, 1));
+  assertEqual((int)ROAST_ARCHIVE_ERRORED, (int)reader.getHeader().outcome);
+  assertEqual(String("bean_tc_fault"), String(reader.getHeader().reason));
+}
+
+test(RoastArchive_WithoutStorageRecordsNothing)
+{
+  MemoryRoastFiles files;
+  files.mounted = false;
+  RoastArchive archive(files);
+  assertFalse(archive.begin());
+  assertFalse(archive.startRoast(roastInfo("A")));
+  archive.recordSample(sampleAt(0));
+  assertFalse(archive.finishRoast(ROAST_ARCHIVE_PASSED, "done"));
+  assertEqual((size_t)0, files.files.size());
+}
+
+// ============================================================================
+// Retention Tests
+// ============================================================================
+
+test(RoastArchive_RingKeepsNewestRoasts)
+{
+  MemoryRoastFiles files;
+  RoastArchive archive(files, 3);
+  archive.begin();
+  for (int roast = 0; roast < 5; roast++)
+    recordRoast(archive, 60);
+
+  std::vector<RoastArchive::Entry> entries = archive.snapshot();
+  assertEqual((size_t)3, entries.size());
+  assertEqual((uint32_t)3, entries[0].id);
+  assertEqual((uint32_t)5, entries[2].id);
+  assertEqual((size_t)3, files.files.size());
+  assertEqual((size_t)0, files.files.count(2));
+
+  // Ids keep counting up across a reboot
+  RoastArchive rebooted(files, 3);
+  rebooted.begin();
+  recordRoast(rebooted, 60);
+  assertEqual((uint32_t)6, rebooted.snapshot().back().id);
+  assertEqual((size_t)0, files.files.count(3));
+}
+
+test(RoastArchive_RingKeepsWithinByteBudget)
+{
+  MemoryRoastFiles files;
+  RoastArchive archive(files, 40, 2048);
+  archive.begin();
+  for (int roast = 0; roast < 6; roast++)
+    recordRoast(archive, 120);
+  assertTrue(archive.totalBytes() <= 2048);
+  assertTrue(archive.snapshot().size() >= 2);
+  assertEqual((uint32_t)6, archive.snapshot().back().id);
+
+  // A single roast over the budget is still kept
+  RoastArchive tiny(files, 40, 16);
+  tiny.begin();
+  recordRoast(tiny, 120);
+  assertEqual((size_t)1, tiny.snapshot().size());
+  assertEqual((uint32_t)7, tiny.snapshot().front().id);
+}
+
+test(RoastArchive_ResetMidRoastIsKeptAsInterrupted)
+{
+  MemoryRoastFiles files;
+  {
+    RoastArchive archive(files);
+    archive.begin();
+    archive.startRoast(roastInfo("Cut Short"));
+    for (uint32_t second = 0; second < 310; second++)
+      archive.recordSample(sampleAt(second));
+    // Power lost here: the unflushed tail and the final header never land
+  }
+  RoastArchive rebooted(files);
+  assertTrue(rebooted.begin());
+  RoastArchiveReader reader;
+  assertTrue(reader.open(files, 1));
+  const RoastArchiveHeader &header = reader.getHeader();
+  assertEqual((int)ROAST_ARCHIVE_INTERRUPTED, (int)header.outcome);
+  assertEqual(String("controller_reset"), String(header.reason));
+  assertTrue(header.sampleCount > 250);
+  assertTrue(header.sampleCount < 310);
+  assertEqual(header.sampleCount - 1, header.durationSeconds);
+  assertEqual(files.size(1), ROAST_ARCHIVE_HEADER_SIZE + header.streamBytes);
+  assertFalse(rebooted.remove(99));
+  assertTrue(rebooted.remove(1));
+  assertEqual((size_t)0, files.files.size());
+}
+
+// ============================================================================
+// Export Tests
+// ============================================================================
+
+test(RoastArchive_CsvExportStreamsEverySample)
+{
+  MemoryRoastFiles files;
+  RoastArchive archive(files);
+  archive.begin();
+  recordRoast(archive, 900);
+
+  RoastArchiveExporter exporter(files, 1, RoastArchiveExporter::FORMAT_CSV);
+  assertTrue(exporter.isOpen());
+  std::string csv = drain(exporter, 7);
+  assertEqual((size_t)900, exporter.exportedSamples());
+  assertEqual(901, (int)std::count(csv.begin(), csv.end(), '\n'));
+  assertEqual(0, (int)csv.find("seconds,bean_f,target_f,heater,fan_temp_f,fan\n"));
+  // Second 1: bean 70.3, target 72.4, heater 181.5, fan temp 65.5, fan 255
+  assertTrue(csv.find("\n1,70.3,72.4,181.5,65.5,255\n") != std::string::npos);
+  assertTrue(csv.find("\n899,") != std::string::npos);
+
+  RoastArchiveExporter missing(files, 9, RoastArchiveExporter::FORMAT_CSV);
+  assertFalse(missing.isOpen());
+  uint8_t buffer[16];
+  assertEqual((size_t)0, missing.read(buffer, sizeof(buffer)));
+}
+
+test(RoastArchive_JsonExportCarriesHeaderAndSamples)
+{
+  MemoryRoastFiles files;
+  RoastArchive archive(files);
+  archive.begin();
+  recordRoast(archive, 3, "Kenya \"AA\"");
+
+  RoastArchiveExporter exporter(files, 1, RoastArchiveExporter::FORMAT_JSON);
+  std::string json = drain(exporter, 64);
+  assertEqual(String("{\"id\":1,\"profileId\":\"p1\",\"profileName\":\"Kenya \\\"AA\\\"\","
+                     "\"outcome\":\"passed\",\"reason\":\"final_target_reached\",\"startedAt\":1760000000,"
+                     "\"durationSeconds\":2,\"sampleCount\":3,\"truncated\":false,\"finalTargetTempF\":430,"
+                     "\"kp\":8,\"ki\":0.46,\"kd\":0,"
+                     "\"columns\":[\"seconds\",\"beanTempF\",\"targetTempF\",\"heater\",\"fanTempF\",\"fan\"],"
+                     "\"samples\":[[0,70,72,180,65,255],[1,70.3,72.4,181.5,65.5,255],[2,70.6,72.8,183,66,255]]}"),
+              String(json.c_str()));
+}
+
+test(RoastArchive_ListingIsNewestFirst)
+{
+  MemoryRoastFiles files;
+  RoastArchive archive(files);
+  archive.begin();
+  recordRoast(archive, 10, "First");
+  recordRoast(archive, 10, "Second");
+  archive.startRoast(roastInfo("Now"));
+
+  RoastArchiveListing listing(archive);
+  std::string json = drain(listing, 5);
+  assertEqual((size_t)3, listing.listedCount());
+  assertEqual(0, (int)json.find("{\"roasts\":[{\"id\":3,"));
+  size_t now = json.find("\"Now\",\"outcome\":\"recording\"");
+  size_t second = json.find("\"Second\"");
+  size_t first = json.find("\"First\"");
+  assertTrue(now != std::string::npos);
+  assertTrue(now < second);
+  assertTrue(second < first);
+  assertTrue(json.find("\"bytes\":") != std::string::npos);
+  char tail[96];
+  snprintf(tail, sizeof(tail), "],\"bytes\":%u,\"maxRoasts\":40,\"maxBytes\":393216}", (unsigned)archive.totalBytes());
+  assertTrue(json.size() > strlen(tail));
+  assertEqual(String(tail), String(json.substr(json.size() - strlen(tail)).c_str()));
+
+  // The roast being recorded cannot be removed
+  assertFalse(archive.remove(3));
+  assertTrue(archive.remove(1));
+  RoastArchiveListing after(archive);
+  drain(after, 64);
+  assertEqual((size_t)2, after.listedCount());
+
+  // Only until its final header is written
+  assertEqual((uint32_t)3, archive.currentId());
+  archive.finishRoast(ROAST_ARCHIVE_RECORDING, "cooling_complete");
+  assertEqual((uint32_t)0, archive.currentId());
+  assertTrue(archive.remove(3));
+}
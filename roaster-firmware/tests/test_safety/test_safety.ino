@@ -353,6 +353,7 @@ test(Safety_SensorFault_StickyReading)
 
   // This would be detected over time in real system
   assertTrue(stuckTime > 0); // Placeholder assertion
+  assertEqual(isSensorStuck, testSensorFault);
 }
 
 // ============================================================================
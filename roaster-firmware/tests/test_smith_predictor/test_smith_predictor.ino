@@ -0,0 +1,262 @@
+/**
+ * Smith Predictor Tests
+ *
+ * Tests for the dead-time compensation in the Smith heater mode including:
+ * - Band models and delay-free gains built when bands load
+ * - Correction equals the heater response still in flight
+ * - Correction returns to zero once a constant command has fully arrived
+ * - Delay line stays bounded across arbitrarily long roasts
+ * - Closed loop on a dead-time plant beats the same PI without the predictor
+ */
+
+#include <AUnit.h>
+#include "../../src/control/PIDController.hpp"
+#include "../../src/control/PIDRuntimeController.hpp"
+
+using namespace aunit;
+
+#define AMBIENT_F 75.0
+#define HEATER_COEFF 0.020
+#define COOLING_COEFF 0.011
+#define DEAD_TIME_S 5.0
+#define STEP_SECONDS 0.25
+
+static void configure(SmithPredictor &smith)
+{
+  smith.clear();
+  smith.configureBand(0, COOLING_COEFF, HEATER_COEFF, DEAD_TIME_S);
+}
+
+// Exact discrete FOPDT plant on the 250 ms step, delayed by the band dead time.
+struct DelayedPlant
+{
+  double temp = AMBIENT_F;
+  double queue[64] = {};
+  uint8_t delaySteps = static_cast<uint8_t>(DEAD_TIME_S / STEP_SECONDS);
+  uint8_t index = 0;
+
+  void step(double command)
+  {
+    queue[index] = command;
+    double delayed = queue[(index + 64 - delaySteps) % 64];
+    index = (index + 1) % 64;
+    double decay = exp(-COOLING_COEFF * STEP_SECONDS);
+    temp = AMBIENT_F + decay * (temp - AMBIENT_F) + HEATER_COEFF * (1.0 - decay) / COOLING_COEFF * delayed;
+  }
+};
+
+// Settles at 250F, then steps the setpoint to 300F and returns the mean
+// absolute error and overshoot over the `seconds` after the step, using PI
+// gains from the predictor with or without the correction applied.
+static double runStep(bool compensate, double seconds, double &overshoot)
+{
+  SmithPredictor smith;
+  configure(smith);
+  SmithPredictor::Gains gains = smith.getGains(0);
+  DelayedPlant plant;
+  double input = AMBIENT_F;
+  double setpoint = 250.0;
+  double output = 0.0;
+  PIDController pid(&input, &setpoint, &output, 0, 255, gains.kp, gains.ki, gains.kd);
+  pid.setTimeStep(250);
+
+  const unsigned long stepMs = 600000UL;
+  double errorSum = 0.0;
+  uint32_t ticks = 0;
+  overshoot = 0.0;
+  for (unsigned long now = 0; now < stepMs + seconds * 1000.0; now += 250)
+  {
+    if (now == stepMs)
+    {
+      setpoint = 300.0;
+    }
+    input = plant.temp + (compensate ? smith.getCorrection() : 0.0);
+    pid.run(now);
+    smith.recordCommand(0, output);
+    plant.step(output);
+    if (now >= stepMs)
+    {
+      errorSum += fabs(plant.temp - setpoint);
+      overshoot = max(overshoot, plant.temp - setpoint);
+      ticks++;
+    }
+  }
+  return errorSum / ticks;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Model Setup Tests
+// ============================================================================
+
+test(Smith_ConfiguresOnlyUsableBands)
+{
+  SmithPredictor smith;
+  assertFalse(smith.isBandReady(0));
+  assertTrue(smith.configureBand(0, COOLING_COEFF, HEATER_COEFF, DEAD_TIME_S));
+  assertFalse(smith.configureBand(1, COOLING_COEFF, 0.0, DEAD_TIME_S));
+  assertFalse(smith.configureBand(2, 0.0, HEATER_COEFF, DEAD_TIME_S));
+  assertFalse(smith.configureBand(Calibration::BAND_COUNT, COOLING_COEFF, HEATER_COEFF, DEAD_TIME_S));
+  assertTrue(smith.isBandReady(0));
+  assertFalse(smith.isBandReady(1));
+  assertFalse(smith.isBandReady(-1));
+  assertEqual(5000UL, (unsigned long)smith.getLeadMs(0));
+  assertEqual(0UL, (unsigned long)smith.getLeadMs(1));
+
+  smith.clear();
+  assertFalse(smith.isBandReady(0));
+}
+
+test(Smith_GainsAreTighterThanDeadTimeSIMC)
+{
+  SmithPredictor smith;
+  configure(smith);
+  SmithPredictor::Gains gains = smith.getGains(0);
+
+  // SIMC for the full FOPDT with tau_c = theta, as the step tuner would set.
+  double tau = 1.0 / COOLING_COEFF;
+  double gain = HEATER_COEFF / COOLING_COEFF;
+  double simcKp = tau / (gain * 2.0 * DEAD_TIME_S);
+  assertNear(2.0 * simcKp, gains.kp, 1e-9);
+  assertMore(gains.ki, simcKp / min(tau, 8.0 * DEAD_TIME_S));
+  assertEqual(0.0, gains.kd);
+}
+
+test(Smith_RuntimeControllerBuildsModelsOnLoad)
+{
+  Calibration::CharacterizationSummary summary = {};
+  for (uint8_t index = 0; index < 2; index++)
+  {
+    Calibration::BandCharacterization &band = summary.bands[index];
+    band.valid = true;
+    band.targetTemp = 200.0 + 100.0 * index;
+    band.minTemp = 150.0 + 100.0 * index;
+    band.maxTemp = 250.0 + 100.0 * index;
+    band.coolingCoeff = COOLING_COEFF;
+    band.heaterCoeff = HEATER_COEFF;
+    band.deadTime = DEAD_TIME_S + index;
+  }
+
+  PIDRuntimeController runtime;
+  assertTrue(runtime.loadFromSummary(summary));
+  assertTrue(runtime.getSmithPredictor().isBandReady(0));
+  assertTrue(runtime.getSmithPredictor().isBandReady(1));
+  assertFalse(runtime.getSmithPredictor().isBandReady(2));
+  assertEqual(6000UL, (unsigned long)runtime.getSmithPredictor().getLeadMs(1));
+
+  runtime.clear();
+  assertFalse(runtime.getSmithPredictor().isBandReady(0));
+}
+
+// ============================================================================
+// Correction Tests
+// ============================================================================
+
+test(Smith_CorrectionIsResponseInFlight)
+{
+  SmithPredictor smith;
+  configure(smith);
+  assertEqual(0.0, smith.getCorrection());
+
+  // During the dead time the plant has not moved, so the correction is the
+  // whole undelayed model response.
+  DelayedPlant plant;
+  double decay = exp(-COOLING_COEFF * STEP_SECONDS);
+  double expected = 0.0;
+  for (uint8_t tick = 0; tick < plant.delaySteps; tick++)
+  {
+    smith.recordCommand(0, 200.0);
+    plant.step(200.0);
+    expected = decay * expected + HEATER_COEFF * (1.0 - decay) / COOLING_COEFF * 200.0;
+    assertNear(AMBIENT_F, plant.temp, 1e-9);
+    assertNear(expected, smith.getCorrection(), 1e-3);
+  }
+
+  // From then on measured + correction is where the plant will read one dead
+  // time later, whatever is commanded in the meantime.
+  for (int tick = 0; tick < 200; tick++)
+  {
+    double command = tick % 40 < 20 ? 255.0 : 30.0;
+    smith.recordCommand(0, command);
+    plant.step(command);
+  }
+  double predicted = plant.temp + smith.getCorrection();
+  for (uint8_t tick = 0; tick < plant.delaySteps; tick++)
+  {
+    plant.step(tick % 2 == 0 ? 255.0 : 0.0);
+  }
+  assertNear(predicted, plant.temp, 0.01);
+}
+
+test(Smith_ConstantCommandSettlesToZeroCorrection)
+{
+  SmithPredictor smith;
+  configure(smith);
+  for (int tick = 0; tick < 8000; tick++)
+  {
+    smith.recordCommand(0, 120.0);
+  }
+  assertNear(0.0, smith.getCorrection(), 0.01);
+}
+
+test(Smith_IgnoresCommandsBeforeABandIsActive)
+{
+  SmithPredictor smith;
+  configure(smith);
+  smith.recordCommand(-1, 255.0);
+  smith.recordCommand(1, 255.0);
+  assertEqual(0.0, smith.getCorrection());
+
+  smith.recordCommand(0, 255.0);
+  assertMore(smith.getCorrection(), 0.0);
+  // No band this tick: the last usable band keeps the models running.
+  smith.recordCommand(-1, 255.0);
+  assertMore(smith.getCorrection(), 0.0);
+
+  smith.reset();
+  assertEqual(0.0, smith.getCorrection());
+  assertTrue(smith.isBandReady(0));
+}
+
+test(Smith_DelayLineStaysBounded)
+{
+  SmithPredictor smith;
+  smith.clear();
+  smith.configureBand(0, COOLING_COEFF, HEATER_COEFF, 60.0); // Clamped to MAX_DELAY_STEPS
+  assertEqual((unsigned long)SmithPredictor::MAX_DELAY_STEPS * SmithPredictor::STEP_MS,
+              (unsigned long)smith.getLeadMs(0));
+  for (uint32_t tick = 0; tick < 20UL * 60UL * 4UL; tick++)
+  {
+    smith.recordCommand(0, tick % 2 == 0 ? 255.0 : 0.0);
+  }
+  assertTrue(smith.getCorrection() > -255.0 && smith.getCorrection() < 255.0);
+}
+
+// ============================================================================
+// Closed-Loop Tests
+// ============================================================================
+
+test(Smith_CompensationBeatsPlainPIOnDeadTimePlant)
+{
+  double compensatedOvershoot = 0.0;
+  double plainOvershoot = 0.0;
+  double compensated = runStep(true, 180.0, compensatedOvershoot);
+  double plain = runStep(false, 180.0, plainOvershoot);
+  Serial.printf("  250F->300F step: smith mae=%.2fF over=%.2fF  plain mae=%.2fF over=%.2fF\n", compensated,
+                compensatedOvershoot, plain, plainOvershoot);
+  assertLess(compensated, plain);
+  assertLess(compensatedOvershoot, 1.0);
+  assertMore(plainOvershoot, compensatedOvershoot);
+}
@@ -0,0 +1,313 @@
+/**
+ * System State JSON Tests
+ *
+ * Tests for the heap-free state payload behind /api/state and the
+ * WebSocket broadcast including:
+ * - JsonWriter commas, nesting, string escapes and number formatting
+ * - Overflow reported instead of a truncated payload
+ * - The state payload keeps the layout the console reads
+ * - Broadcast frames are reused while clients keep up
+ * - A day of broadcasts makes no heap allocations
+ */
+
+#include <AUnit.h>
+#include <new>
+#include <stdlib.h>
+#include "../../src/network/SystemStateJson.hpp"
+#include "../../src/support/SharedFrameBuffer.hpp"
+
+using namespace aunit;
+
+// Counts every operator new so the soak tests can show the broadcast
+// path never reaches the heap.
+static volatile uint32_t heapAllocations = 0;
+
+void *operator new(size_t size)
+{
+  heapAllocations++;
+  void *block = malloc(size ? size : 1);
+  if (block == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return block;
+}
+
+void operator delete(void *block) noexcept
+{
+  free(block);
+}
+
+void operator delete(void *block, size_t) noexcept
+{
+  free(block);
+}
+
+PerfChannel testControl("control", 125);
+PerfChannel testBroadcast("wsBroadcast", 1000);
+PerfChannel *const testChannels[] = {&testControl, &testBroadcast};
+
+static SystemStateSnapshot sampleState()
+{
+  SystemStateSnapshot state;
+  state.timestamp = 125400;
+  state.state = "ROASTING";
+  state.currentTemp = 385.26;
+  state.setpointTemp = 390.0;
+  state.fanTemp = 212.04;
+  state.rateOfRise = -0.04;
+  state.heater = 182;
+  state.pidTrim = -12.35;
+  state.feedforward = 140.0;
+  state.pwmFan = 200;
+  state.bdcFan = 1450;
+  state.scheduleEnabled = true;
+  state.activeBand = 2;
+  state.heaterMode = "pid";
+  state.progress = 540;
+  state.setpointCount = 9;
+  state.finalTemp = 435;
+  state.lastRejectedReason = "spike";
+  state.faultCode = "none";
+  state.faultMessage = "";
+  state.heapFree = 181220;
+  state.heapSize = 327680;
+  state.perfChannels = testChannels;
+  state.perfChannelCount = 2;
+  return state;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Writer Tests
+// ============================================================================
+
+test(JsonWriter_NestsAndSeparates)
+{
+  char buffer[128];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.fieldInt("a", -42);
+  json.beginObject("b");
+  json.endObject();
+  json.beginArray("c");
+  json.endArray();
+  json.beginObject("d");
+  json.fieldBool("e", false);
+  json.fieldUInt("f", 4294967295UL);
+  json.endObject();
+  json.endObject();
+  assertFalse(json.overflowed());
+  assertEqual(String("{\"a\":-42,\"b\":{},\"c\":[],\"d\":{\"e\":false,\"f\":4294967295}}"), String(buffer));
+  assertEqual(strlen(buffer), json.length());
+}
+
+test(JsonWriter_FormatsFixedPoint)
+{
+  char buffer[160];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.fieldFixed("a", 205.26, 1);
+  json.fieldFixed("b", 200.0, 1);
+  json.fieldFixed("c", -0.04, 1);
+  json.fieldFixed("d", -12.35, 1);
+  json.fieldFixed("e", 0.5, 3);
+  json.fieldFixed("f", 0.0625, 4);
+  json.fieldFixed("g", NAN, 1);
+  json.fieldFixed("h", INFINITY, 1);
+  json.endObject();
+  assertEqual(String("{\"a\":205.3,\"b\":200,\"c\":0,\"d\":-12.4,\"e\":0.5,\"f\":0.0625,\"g\":null,\"h\":null}"), String(buffer));
+}
+
+test(JsonWriter_EscapesStrings)
+{
+  char buffer[96];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.fieldString("msg", "Probe \"BT\"\\open\n\x01");
+  json.fieldString("none", nullptr);
+  json.endObject();
+  assertEqual(String("{\"msg\":\"Probe \\\"BT\\\"\\\\open\\n\\u0001\",\"none\":\"\"}"), String(buffer));
+}
+
+test(JsonWriter_ReportsOverflow)
+{
+  char buffer[16];
+  JsonWriter json(buffer, sizeof(buffer));
+  json.beginObject();
+  json.fieldString("state", "ROASTING");
+  json.fieldInt("x", 1);
+  json.endObject();
+  assertTrue(json.overflowed());
+  assertTrue(json.length() < sizeof(buffer));
+  assertEqual(json.length(), strlen(buffer));
+}
+
+// ============================================================================
+// State Payload Tests
+// ============================================================================
+
+test(StateJson_KeepsConsoleLayout)
+{
+  char buffer[STATE_JSON_CAPACITY];
+  size_t length = writeSystemStateJson(sampleState(), buffer, sizeof(buffer));
+  assertEqual(strlen(buffer), length);
+  assertEqual(
+      String("{\"timestamp\":125400,\"state\":\"ROASTING\",\"uptime\":125,"
+      "\"temps\":{\"current\":385.3,\"setpoint\":390,\"fan\":212,\"ror\":0},"
+      "\"control\":{\"heater\":182,\"pidTrim\":-12.4,\"feedforward\":140,\"pwmFan\":200,\"bdcFan\":1450,"
+      "\"scheduleEnabled\":true,\"activeBand\":2,\"mode\":\"pid\",\"mpcActive\":false,\"smithActive\":false},"
+      "\"profile\":{\"progress\":540,\"setpointCount\":9,\"finalTemp\":435},"
+      "\"safety\":{\"badReadings\":0,\"lastRejectedReason\":\"spike\"},"
+      "\"fault\":{\"code\":\"none\",\"message\":\"\",\"canClear\":false},"
+      "\"memory\":{\"heapFree\":181220,\"heapSize\":327680},"
+      "\"perf\":{\"control\":{\"lateP99\":0,\"lateMax\":0,\"runP50\":0,\"runP99\":0,\"runMax\":0,\"overruns\":0},"
+      "\"wsBroadcast\":{\"lateP99\":0,\"lateMax\":0,\"runP50\":0,\"runP99\":0,\"runMax\":0,\"overruns\":0}}}"),
+      String(buffer));
+}
+
+test(StateJson_WorstCaseFits)
+{
+  PerfChannel control("control", 125);
+  PerfChannel tick("tick", 5);
+  PerfChannel stateMachine("stateMachine", 500);
+  PerfChannel wsBroadcast("wsBroadcast", 1000);
+  PerfChannel roastTrace("roastTrace", 1000);
+  PerfChannel loopChannel("loop", 0);
+  PerfChannel *const channels[] = {&control, &tick, &stateMachine, &wsBroadcast, &roastTrace, &loopChannel};
+
+  char message[96];
+  memset(message, '"', sizeof(message) - 1); // Every character escaped
+  message[sizeof(message) - 1] = '\0';
+  SystemStateSnapshot state = sampleState();
+  state.timestamp = 4294967295UL;
+  state.state = "START_ROAST";
+  state.currentTemp = -1999.99;
+  state.setpointTemp = -1999.99;
+  state.fanTemp = -1999.99;
+  state.rateOfRise = -1999.99;
+  state.heater = -2147483647;
+  state.pidTrim = -1999.99;
+  state.feedforward = -1999.99;
+  state.heaterMode = "smith";
+  state.lastRejectedReason = "123456789012345";
+  state.faultCode = "1234567890123456789012345678901";
+  state.faultMessage = message;
+  state.heapFree = 4294967295UL;
+  state.heapSize = 4294967295UL;
+  state.perfChannels = channels;
+  state.perfChannelCount = 6;
+
+  char buffer[STATE_JSON_CAPACITY];
+  assertTrue(writeSystemStateJson(state, buffer, sizeof(buffer)) > 0);
+  assertEqual((size_t)0, writeSystemStateJson(state, buffer, 200));
+}
+
+// ============================================================================
+// Broadcast Buffer Tests
+// ============================================================================
+
+test(SharedFrame_ReusedOnceClientsRelease)
+{
+  SharedFrameBuffer frames(STATE_JSON_CAPACITY);
+  SharedFrameBuffer::Frame first = frames.acquire();
+  assertEqual(STATE_JSON_CAPACITY, first->size());
+  const uint8_t *storage = first->data();
+  first->resize(100);
+
+  // Two client queues still hold the frame: the next one is new
+  SharedFrameBuffer::Frame clientA = first;
+  SharedFrameBuffer::Frame clientB = first;
+  first.reset();
+  SharedFrameBuffer::Frame second = frames.acquire();
+  assertTrue(second->data() != storage);
+  assertEqual((uint32_t)1, frames.replacementCount());
+  assertEqual((size_t)100, clientA->size());
+
+  clientA.reset();
+  clientB.reset();
+  second->resize(10);
+  const uint8_t *secondStorage = second->data();
+  second.reset();
+  SharedFrameBuffer::Frame third = frames.acquire();
+  assertTrue(third->data() == secondStorage);
+  assertEqual(STATE_JSON_CAPACITY, third->size());
+  assertEqual((uint32_t)1, frames.replacementCount());
+}
+
+// ============================================================================
+// Soak Tests
+// ============================================================================
+
+test(StateJson_DayOfBroadcastsAllocatesNothing)
+{
+  SharedFrameBuffer frames(STATE_JSON_CAPACITY);
+  SystemStateSnapshot state = sampleState();
+  size_t totalBytes = 0;
+
+  uint32_t before = heapAllocations;
+  for (uint32_t second = 0; second < 86400; second++)
+  {
+    // Varying values so every payload differs in length
+    state.timestamp = second * 1000UL;
+    state.currentTemp = 200.0 + (second % 2500) * 0.1;
+    state.rateOfRise = ((int)(second % 400) - 200) * 0.05;
+    state.heater = second % 256;
+    state.heapFree = 150000 + second % 30000;
+    state.badReadings = second % 3;
+
+    SharedFrameBuffer::Frame frame = frames.acquire();
+    size_t length = writeSystemStateJson(state, reinterpret_cast<char *>(frame->data()), frame->size());
+    if (length == 0)
+    {
+      break;
+    }
+    frame->resize(length);
+    // Two clients send the frame before the next broadcast
+    SharedFrameBuffer::Frame clientA = frame;
+    SharedFrameBuffer::Frame clientB = frame;
+    totalBytes += clientA->size() + clientB->size() - length;
+  }
+  uint32_t allocations = heapAllocations - before;
+
+  assertEqual((uint32_t)0, allocations);
+  assertEqual((uint32_t)0, frames.replacementCount());
+  assertTrue(totalBytes > 86400UL * 600);
+}
+
+test(StateJson_SlowClientCostsOneBufferPerStall)
+{
+  SharedFrameBuffer frames(STATE_JSON_CAPACITY);
+  SystemStateSnapshot state = sampleState();
+  SharedFrameBuffer::Frame slowClient;
+
+  uint32_t before = heapAllocations;
+  for (uint32_t second = 0; second < 3600; second++)
+  {
+    SharedFrameBuffer::Frame frame = frames.acquire();
+    size_t length = writeSystemStateJson(state, reinterpret_cast<char *>(frame->data()), frame->size());
+    frame->resize(length);
+    // A client that only drains its queue every tenth broadcast
+    if (second % 10 == 0)
+    {
+      slowClient = frame;
+    }
+  }
+  uint32_t allocations = heapAllocations - before;
+
+  // One new buffer each time the client was still holding the last frame
+  assertEqual((uint32_t)360, frames.replacementCount());
+  assertTrue(allocations <= frames.replacementCount() * 2);
+}
@@ -474,6 +474,7 @@ test(StateMachine_Sequence_InvalidTransition)
   // For test, we verify states are different concepts
   assertNotEqual(IDLE, COOLING);
   assertNotEqual(START_ROAST, COOLING);
+  assertNotEqual(testState, attemptedState);
 }
 
 // ============================================================================
@@ -493,7 +493,7 @@ test(StepResponse_FeedforwardFieldsPopulated) {
         if (!pn.startsWith("STABILIZE")) break;
         double noise = (i % 3 - 1) * 0.02;
         t.getOutput(baseline + noise, 70.0, 180.0);
-        delay(1);
+        delay(250);  // Tuner samples every 250ms
     }
 
     if (t.isRunning()) {
@@ -510,7 +510,7 @@ test(StepResponse_FeedforwardFieldsPopulated) {
         double timeSec = (double)i * 0.25;
         double temp = fopdtTemp(timeSec, baseline, kp_proc, stepDelta, tau, theta);
         t.getOutput(temp, 70.0, 180.0);
-        delay(1);
+        delay(250);  // Tuner samples every 250ms
     }
 
     Calibration::CharacterizationSummary cs = t.getCharacterizationSummary();
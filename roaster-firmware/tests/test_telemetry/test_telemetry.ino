@@ -0,0 +1,325 @@
+/**
+ * Telemetry Stream Tests
+ *
+ * Tests for the opt-in delta telemetry stream on /WebSocket including:
+ * - CBOR and MessagePack headers match the specifications' examples
+ * - Only fields that changed at displayed resolution go in a delta
+ * - Text edited in place is still seen as a change
+ * - Keyframes carry every field and fit their buffers at worst case
+ * - A steady roast costs a fraction of the full state per second
+ * - Subscriber bookkeeping and keyframe requests
+ */
+
+#include <AUnit.h>
+#include <vector>
+#include "../../src/network/TelemetryStream.hpp"
+
+using namespace aunit;
+
+static std::vector<uint8_t> cbor(void (*write)(PackWriter &))
+{
+  uint8_t buffer[32];
+  PackWriter pack(PackWriter::FORMAT_CBOR, buffer, sizeof(buffer));
+  write(pack);
+  return std::vector<uint8_t>(buffer, buffer + pack.length());
+}
+
+static std::vector<uint8_t> msgpack(void (*write)(PackWriter &))
+{
+  uint8_t buffer[32];
+  PackWriter pack(PackWriter::FORMAT_MSGPACK, buffer, sizeof(buffer));
+  write(pack);
+  return std::vector<uint8_t>(buffer, buffer + pack.length());
+}
+
+static bool bytesEqual(const std::vector<uint8_t> &actual, std::initializer_list<uint8_t> expected)
+{
+  return actual == std::vector<uint8_t>(expected);
+}
+
+static char faultMessage[96] = "";
+
+static SystemStateSnapshot roastingState()
+{
+  SystemStateSnapshot state;
+  state.timestamp = 125400;
+  state.state = "ROASTING";
+  state.currentTemp = 385.26;
+  state.setpointTemp = 390.0;
+  state.fanTemp = 212.04;
+  state.rateOfRise = 9.5;
+  state.heater = 182;
+  state.pidTrim = -12.35;
+  state.feedforward = 140.0;
+  state.pwmFan = 200;
+  state.bdcFan = 1450;
+  state.scheduleEnabled = true;
+  state.activeBand = 2;
+  state.heaterMode = "pid";
+  state.progress = 540;
+  state.setpointCount = 9;
+  state.finalTemp = 435;
+  state.lastRejectedReason = "none";
+  state.faultCode = "none";
+  state.faultMessage = faultMessage;
+  state.heapFree = 181220;
+  state.heapSize = 327680;
+  return state;
+}
+
+static String encodeJson(const TelemetryFrame &frame, uint32_t fields, bool keyframe)
+{
+  uint8_t buffer[TELEMETRY_JSON_CAPACITY];
+  size_t length = encodeTelemetryFrame(frame, fields, keyframe, TELEMETRY_JSON, buffer, sizeof(buffer));
+  return String(std::string(reinterpret_cast<const char *>(buffer), length));
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Binary Encoding Tests
+// ============================================================================
+
+test(Telemetry_CborMatchesRfcExamples)
+{
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeUInt(0); }), {0x00}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeUInt(23); }), {0x17}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeUInt(24); }), {0x18, 0x18}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeUInt(1000); }), {0x19, 0x03, 0xE8}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeUInt(1000000); }), {0x1A, 0x00, 0x0F, 0x42, 0x40}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeInt(-1); }), {0x20}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeInt(-100); }), {0x38, 0x63}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeInt(-1000); }), {0x39, 0x03, 0xE7}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeFloat(1.5f); }), {0xFA, 0x3F, 0xC0, 0x00, 0x00}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeBool(true); }), {0xF5}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeNull(); }), {0xF6}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.writeString("IETF"); }), {0x64, 0x49, 0x45, 0x54, 0x46}));
+  assertTrue(bytesEqual(cbor([](PackWriter &p) { p.beginMap(2); }), {0xA2}));
+}
+
+test(Telemetry_MsgPackMatchesSpec)
+{
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeUInt(127); }), {0x7F}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeUInt(128); }), {0xCC, 0x80}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeUInt(1000); }), {0xCD, 0x03, 0xE8}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeUInt(181220); }), {0xCE, 0x00, 0x02, 0xC3, 0xE4}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeInt(-1); }), {0xFF}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeInt(-33); }), {0xD0, 0xDF}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeInt(-1000); }), {0xD1, 0xFC, 0x18}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeFloat(1.5f); }), {0xCA, 0x3F, 0xC0, 0x00, 0x00}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeBool(false); }), {0xC2}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeNull(); }), {0xC0}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.writeString("ts"); }), {0xA2, 0x74, 0x73}));
+  assertTrue(bytesEqual(msgpack([](PackWriter &p) { p.beginMap(16); }), {0xDE, 0x00, 0x10}));
+}
+
+test(Telemetry_PackWriterReportsOverflow)
+{
+  uint8_t buffer[4];
+  PackWriter pack(PackWriter::FORMAT_CBOR, buffer, sizeof(buffer));
+  pack.writeString("ROASTING");
+  assertTrue(pack.overflowed());
+  assertTrue(pack.length() <= sizeof(buffer));
+}
+
+// ============================================================================
+// Delta Tests
+// ============================================================================
+
+test(Telemetry_DeltaCarriesOnlyChangedFields)
+{
+  TelemetryDeltaTracker tracker;
+  SystemStateSnapshot state = roastingState();
+  TelemetryFrame frame;
+  captureTelemetryFrame(state, frame);
+  assertEqual(TELEMETRY_ALL_FIELDS, tracker.update(frame));
+  assertEqual((uint32_t)0, tracker.update(frame));
+
+  // Below the 0.1 display resolution
+  state.currentTemp = 385.29;
+  captureTelemetryFrame(state, frame);
+  assertEqual((uint32_t)0, tracker.update(frame));
+
+  state.currentTemp = 385.36;
+  state.progress = 541;
+  captureTelemetryFrame(state, frame);
+  frame.seq = 2;
+  frame.timestamp = 126400;
+  uint32_t changed = tracker.update(frame);
+  assertEqual((uint32_t)((1UL << TF_TEMP_CURRENT) | (1UL << TF_PROGRESS)), changed);
+  assertEqual(String("{\"t\":\"d\",\"seq\":2,\"ts\":126400,\"f\":{\"temps.current\":385.4,\"profile.progress\":541}}"),
+              encodeJson(frame, changed, false));
+}
+
+test(Telemetry_TextEditedInPlaceIsAChange)
+{
+  TelemetryDeltaTracker tracker;
+  SystemStateSnapshot state = roastingState();
+  TelemetryFrame frame;
+  strcpy(faultMessage, "");
+  captureTelemetryFrame(state, frame);
+  tracker.update(frame);
+
+  // The firmware rewrites activeFaultMessage in place; the pointer stays put
+  strcpy(faultMessage, "Bean probe open");
+  captureTelemetryFrame(state, frame);
+  assertEqual((uint32_t)(1UL << TF_FAULT_MESSAGE), tracker.update(frame));
+  strcpy(faultMessage, "");
+}
+
+test(Telemetry_MissingTemperatureIsNull)
+{
+  SystemStateSnapshot state = roastingState();
+  state.currentTemp = NAN;
+  TelemetryFrame frame;
+  captureTelemetryFrame(state, frame);
+  assertEqual(String("{\"t\":\"d\",\"seq\":0,\"ts\":125400,\"f\":{\"temps.current\":null}}"),
+              encodeJson(frame, 1UL << TF_TEMP_CURRENT, false));
+
+  uint8_t buffer[TELEMETRY_BINARY_CAPACITY];
+  size_t length = encodeTelemetryFrame(frame, 1UL << TF_TEMP_CURRENT, false, TELEMETRY_CBOR, buffer, sizeof(buffer));
+  assertEqual((uint8_t)0xA1, buffer[length - 3]); // One-entry field map
+  assertEqual((uint8_t)TF_TEMP_CURRENT, buffer[length - 2]);
+  assertEqual((uint8_t)0xF6, buffer[length - 1]);
+}
+
+// ============================================================================
+// Frame Size Tests
+// ============================================================================
+
+test(Telemetry_KeyframesFitAtWorstCase)
+{
+  char message[96];
+  memset(message, '"', sizeof(message) - 1); // Every character escaped
+  message[sizeof(message) - 1] = '\0';
+  SystemStateSnapshot state = roastingState();
+  state.timestamp = 4294967295UL;
+  state.state = "START_ROAST";
+  state.currentTemp = -1999.99;
+  state.setpointTemp = -1999.99;
+  state.fanTemp = -1999.99;
+  state.rateOfRise = -1999.99;
+  state.heater = -2147483647;
+  state.pidTrim = -1999.99;
+  state.feedforward = -1999.99;
+  state.heaterMode = "smith";
+  state.lastRejectedReason = "123456789012345";
+  state.faultCode = "1234567890123456789012345678901";
+  state.faultMessage = message;
+  state.heapFree = 4294967295UL;
+  state.heapSize = 4294967295UL;
+  TelemetryFrame frame;
+  captureTelemetryFrame(state, frame);
+  frame.seq = 4294967295UL;
+
+  uint8_t buffer[TELEMETRY_JSON_CAPACITY];
+  assertTrue(encodeTelemetryFrame(frame, 0, true, TELEMETRY_JSON, buffer, TELEMETRY_JSON_CAPACITY) > 0);
+  assertTrue(encodeTelemetryFrame(frame, 0, true, TELEMETRY_CBOR, buffer, TELEMETRY_BINARY_CAPACITY) > 0);
+  assertTrue(encodeTelemetryFrame(frame, 0, true, TELEMETRY_MSGPACK, buffer, TELEMETRY_BINARY_CAPACITY) > 0);
+
+  char ack[768];
+  assertTrue(writeTelemetryAck(true, TELEMETRY_CBOR, ack, sizeof(ack)) > 0);
+  assertTrue(strstr(ack, "\"fields\":[\"state\",\"temps.current\"") != nullptr);
+}
+
+test(Telemetry_SteadyRoastCostsAFractionOfFullState)
+{
+  TelemetryDeltaTracker tracker;
+  SystemStateSnapshot state = roastingState();
+  char full[STATE_JSON_CAPACITY];
+  uint8_t buffer[TELEMETRY_JSON_CAPACITY];
+  size_t fullBytes = 0;
+  size_t deltaBytes[TELEMETRY_ENCODING_COUNT] = {};
+
+  // Five minutes of a roast: temperatures, heater, progress and heap move
+  for (uint32_t second = 0; second < 300; second++)
+  {
+    state.timestamp = 125400 + second * 1000UL;
+    state.currentTemp = 300.0 + second * 0.15;
+    state.setpointTemp = 302.0 + second * 0.15;
+    state.fanTemp = 180.0 + second * 0.05;
+    state.rateOfRise = 9.0 - second * 0.01;
+    state.heater = 150 + second % 20;
+    state.progress = 240 + second;
+    state.heapFree = 181220 - (second % 7) * 64;
+    fullBytes += writeSystemStateJson(state, full, sizeof(full));
+
+    TelemetryFrame frame;
+    captureTelemetryFrame(state, frame);
+    frame.seq = second + 1;
+    uint32_t changed = tracker.update(frame);
+    bool keyframe = second == 0 || frame.seq % TELEMETRY_KEYFRAME_INTERVAL == 0;
+    for (uint8_t encoding = 0; encoding < TELEMETRY_ENCODING_COUNT; encoding++)
+    {
+      size_t length = encodeTelemetryFrame(frame, changed, keyframe, (TelemetryEncoding)encoding, buffer, sizeof(buffer));
+      assertTrue(length > 0);
+      deltaBytes[encoding] += length;
+    }
+  }
+
+  // The full state here has no perf timers; on the device it is larger still
+  assertTrue(deltaBytes[TELEMETRY_JSON] * 2 < fullBytes);
+  assertTrue(deltaBytes[TELEMETRY_CBOR] * 2 < deltaBytes[TELEMETRY_JSON]);
+  assertTrue(deltaBytes[TELEMETRY_MSGPACK] * 2 < deltaBytes[TELEMETRY_JSON]);
+}
+
+// ============================================================================
+// Subscriber Tests
+// ============================================================================
+
+test(Telemetry_SubscribersGetAKeyframeFirst)
+{
+  TelemetrySubscribers subscribers;
+  TelemetrySubscribers::Subscriber out[TelemetrySubscribers::MAX_SUBSCRIBERS];
+  assertTrue(subscribers.subscribe(7, TELEMETRY_CBOR));
+  assertTrue(subscribers.subscribe(9, TELEMETRY_JSON));
+  assertEqual((size_t)2, subscribers.take(out));
+  assertTrue(out[0].needsKeyframe);
+  assertEqual((int)TELEMETRY_CBOR, (int)out[0].encoding);
+
+  subscribers.take(out);
+  assertFalse(out[0].needsKeyframe);
+  assertTrue(subscribers.requestKeyframe(9));
+  assertFalse(subscribers.requestKeyframe(8));
+  subscribers.take(out);
+  assertTrue(out[1].needsKeyframe);
+
+  // Re-subscribing changes the encoding in place
+  assertTrue(subscribers.subscribe(7, TELEMETRY_MSGPACK));
+  assertEqual((size_t)2, subscribers.take(out));
+  assertEqual((int)TELEMETRY_MSGPACK, (int)out[0].encoding);
+
+  subscribers.unsubscribe(7);
+  subscribers.unsubscribe(7);
+  assertEqual((size_t)1, subscribers.take(out));
+  assertEqual((uint32_t)9, out[0].clientId);
+}
+
+test(Telemetry_SubscriberSlotsAreBounded)
+{
+  TelemetrySubscribers subscribers;
+  for (uint32_t id = 0; id < TelemetrySubscribers::MAX_SUBSCRIBERS; id++)
+  {
+    assertTrue(subscribers.subscribe(id, TELEMETRY_JSON));
+  }
+  assertFalse(subscribers.subscribe(100, TELEMETRY_JSON));
+  subscribers.unsubscribe(3);
+  assertTrue(subscribers.subscribe(100, TELEMETRY_JSON));
+  assertEqual(TelemetrySubscribers::MAX_SUBSCRIBERS, subscribers.size());
+
+  TelemetryEncoding encoding;
+  assertTrue(parseTelemetryEncoding("msgpack", encoding));
+  assertEqual((int)TELEMETRY_MSGPACK, (int)encoding);
+  assertFalse(parseTelemetryEncoding("protobuf", encoding));
+}
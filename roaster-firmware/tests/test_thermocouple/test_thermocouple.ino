@@ -0,0 +1,248 @@
+/**
+ * Thermocouple Acquisition Tests
+ *
+ * Tests for the non-blocking MAX6675 acquisition pipeline including:
+ * - MAX6675 frame decoding (temperature and open-input bit)
+ * - Reads wait for the conversion time and stay on a staggered grid
+ * - Late polls skip missed reads instead of reading early
+ * - Ring buffer overflow and transport error accounting
+ * - Range, open-circuit and spike rejection
+ * - Replaying a recorded stream through the whole pipeline
+ */
+
+#include <AUnit.h>
+#include "../../src/sensors/ThermocoupleAcquisition.hpp"
+
+using namespace aunit;
+
+#define MS 1000UL
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+static uint16_t frameF(double fahrenheit)
+{
+  return ReplayThermocoupleTransport::encodeFahrenheit(fahrenheit);
+}
+
+// ============================================================================
+// Frame Decoding Tests
+// ============================================================================
+
+test(Sample_DecodesFrames)
+{
+  ThermocoupleSample sample = {0, static_cast<uint16_t>(400 << 3), 0}; // 100.00C
+  assertFalse(sample.isOpen());
+  assertNear(100.0, sample.celsius(), 0.001);
+  assertNear(212.0, sample.fahrenheit(), 0.001);
+
+  sample.frame = ReplayThermocoupleTransport::OPEN_FRAME;
+  assertTrue(sample.isOpen());
+  assertTrue(isnan(sample.fahrenheit()));
+}
+
+test(Sample_EncodeRoundTrip)
+{
+  ThermocoupleSample sample = {0, frameF(425.0), 0};
+  assertNear(425.0, sample.fahrenheit(), 0.45); // 0.25C resolution
+}
+
+// ============================================================================
+// Acquisition Scheduling Tests
+// ============================================================================
+
+test(Acquisition_WaitsForConversion)
+{
+  uint16_t bean[] = {frameF(200.0)};
+  uint16_t fan[] = {frameF(150.0)};
+  ReplayThermocoupleTransport transport;
+  transport.setStream(0, bean, 1);
+  transport.setStream(1, fan, 1);
+
+  ThermocoupleAcquisition acquisition;
+  assertTrue(acquisition.begin(transport, 0));
+
+  assertEqual(0, (int)acquisition.poll(125 * MS));
+  assertEqual(1, (int)acquisition.poll(250 * MS));
+
+  ThermocoupleSample sample;
+  assertTrue(acquisition.pop(sample));
+  assertEqual(0, (int)sample.channel);
+  assertEqual(250 * MS, (unsigned long)sample.timestampUs);
+  assertFalse(acquisition.pop(sample));
+
+  assertEqual(1, (int)acquisition.poll(375 * MS));
+  assertTrue(acquisition.pop(sample));
+  assertEqual(1, (int)sample.channel);
+}
+
+test(Acquisition_StaggersChannelsAcrossCycles)
+{
+  uint16_t bean[] = {frameF(200.0)};
+  uint16_t fan[] = {frameF(150.0)};
+  ReplayThermocoupleTransport transport;
+  transport.setStream(0, bean, 1);
+  transport.setStream(1, fan, 1);
+
+  ThermocoupleAcquisition acquisition;
+  acquisition.begin(transport, 0);
+
+  // Polled every 125 ms like the control task: never two reads in one cycle.
+  for (uint32_t nowUs = 0; nowUs <= 2000 * MS; nowUs += 125 * MS)
+  {
+    assertLessOrEqual((int)acquisition.poll(nowUs), 1);
+  }
+  assertEqual(8UL, (unsigned long)transport.getReadCount(0)); // 250..2000 ms
+  assertEqual(7UL, (unsigned long)transport.getReadCount(1)); // 375..1875 ms
+  assertEqual(0UL, (unsigned long)acquisition.getStats().skippedReads);
+}
+
+test(Acquisition_LatePollNeverReadsEarly)
+{
+  uint16_t bean[] = {frameF(200.0)};
+  ReplayThermocoupleTransport transport;
+  transport.setStream(0, bean, 1);
+
+  ThermocoupleAcquisition acquisition;
+  acquisition.begin(transport, 0);
+
+  assertEqual(1, (int)acquisition.poll(250 * MS));
+  assertEqual(1, (int)acquisition.poll(740 * MS)); // Late for the 500 ms read
+  // The 750 ms release is due, but the conversion started at 740 ms.
+  assertEqual(0, (int)acquisition.poll(750 * MS));
+  assertEqual(1, (int)acquisition.poll(960 * MS));
+
+  // A long stall skips the missed reads rather than bursting.
+  assertEqual(1, (int)acquisition.poll(2100 * MS));
+  assertEqual(0, (int)acquisition.poll(2200 * MS));
+  assertEqual(4UL, (unsigned long)acquisition.getStats().skippedReads);
+  assertEqual(4UL, (unsigned long)acquisition.getStats().samples);
+}
+
+test(Acquisition_HandlesMicrosWraparound)
+{
+  uint16_t bean[] = {frameF(200.0)};
+  ReplayThermocoupleTransport transport;
+  transport.setStream(0, bean, 1);
+
+  ThermocoupleAcquisition acquisition;
+  uint32_t startUs = 0xFFFFFFFFUL - 100 * MS;
+  acquisition.begin(transport, startUs);
+
+  assertEqual(0, (int)acquisition.poll(startUs + 249 * MS));
+  assertEqual(1, (int)acquisition.poll(startUs + 250 * MS));
+  assertEqual(0UL, (unsigned long)acquisition.getStats().skippedReads);
+}
+
+test(Acquisition_CountsTransportErrorsAndOverflows)
+{
+  uint16_t bean[] = {frameF(200.0)};
+  ReplayThermocoupleTransport transport;
+  transport.setStream(0, bean, 1);
+
+  ThermocoupleAcquisition acquisition;
+  acquisition.begin(transport, 0);
+
+  transport.failNext();
+  assertEqual(0, (int)acquisition.poll(250 * MS));
+  assertEqual(1UL, (unsigned long)acquisition.getStats().transportErrors);
+  assertEqual(0, (int)acquisition.available());
+
+  // Nobody drains the queue: the oldest samples are dropped.
+  uint32_t nowUs = 250 * MS;
+  for (size_t read = 0; read < ThermocoupleAcquisition::QUEUE_DEPTH + 3; read++)
+  {
+    nowUs += 250 * MS;
+    acquisition.poll(nowUs);
+  }
+  assertEqual((int)ThermocoupleAcquisition::QUEUE_DEPTH, (int)acquisition.available());
+  assertEqual(3UL, (unsigned long)acquisition.getOverflows());
+
+  ThermocoupleSample sample;
+  assertTrue(acquisition.pop(sample));
+  assertEqual(1250 * MS, (unsigned long)sample.timestampUs);
+}
+
+// ============================================================================
+// Filter Tests
+// ============================================================================
+
+test(Filter_RejectsRangeAndOpen)
+{
+  ThermocoupleFilter filter;
+  assertEqual((int)ThermocoupleFilter::OPEN_CIRCUIT, (int)filter.evaluate(NAN, true));
+  assertEqual((int)ThermocoupleFilter::RANGE_ERROR, (int)filter.evaluate(2048.0, true));
+  assertEqual((int)ThermocoupleFilter::RANGE_ERROR, (int)filter.evaluate(-5.0, true));
+  assertFalse(filter.hasValidReading());
+
+  assertEqual((int)ThermocoupleFilter::ACCEPTED, (int)filter.evaluate(600.0, true));
+  assertEqual((int)ThermocoupleFilter::ACCEPTED, (int)filter.evaluate(0.0, false));
+}
+
+test(Filter_RejectsSpikesOnlyWhenEnabled)
+{
+  ThermocoupleFilter filter;
+  // First reading sets the reference even while spike filtering is on.
+  assertEqual((int)ThermocoupleFilter::ACCEPTED, (int)filter.evaluate(300.0, true));
+  assertEqual((int)ThermocoupleFilter::SPIKE, (int)filter.evaluate(345.0, true));
+  assertNear(300.0, filter.getLastValid(), 0.001);
+  assertEqual((int)ThermocoupleFilter::ACCEPTED, (int)filter.evaluate(339.0, true));
+  assertEqual((int)ThermocoupleFilter::ACCEPTED, (int)filter.evaluate(150.0, false));
+  assertNear(150.0, filter.getLastValid(), 0.001);
+
+  filter.reset();
+  assertFalse(filter.hasValidReading());
+  assertEqual((int)ThermocoupleFilter::ACCEPTED, (int)filter.evaluate(450.0, true));
+}
+
+// ============================================================================
+// Pipeline Replay Tests
+// ============================================================================
+
+test(Pipeline_ReplaysRecordedStream)
+{
+  // Recorded bean trace with a spike, an open-input glitch and a wiring fault.
+  uint16_t bean[] = {
+    frameF(180.0), frameF(182.0), frameF(260.0), frameF(184.5),
+    ReplayThermocoupleTransport::OPEN_FRAME, 0x7FF8, frameF(187.0)
+  };
+  ReplayThermocoupleTransport transport;
+  transport.setStream(0, bean, sizeof(bean) / sizeof(bean[0]));
+
+  ThermocoupleAcquisition acquisition;
+  acquisition.begin(transport, 0);
+  ThermocoupleFilter filter;
+
+  int verdicts[4] = {};
+  double accepted = 0.0;
+  for (uint32_t nowUs = 0; nowUs <= 1750 * MS; nowUs += 125 * MS)
+  {
+    acquisition.poll(nowUs);
+    ThermocoupleSample sample;
+    while (acquisition.pop(sample))
+    {
+      ThermocoupleFilter::Verdict verdict = filter.evaluate(sample.fahrenheit(), true);
+      verdicts[verdict]++;
+      if (verdict == ThermocoupleFilter::ACCEPTED)
+      {
+        accepted = sample.fahrenheit();
+      }
+    }
+  }
+
+  assertEqual(4, verdicts[ThermocoupleFilter::ACCEPTED]);
+  assertEqual(1, verdicts[ThermocoupleFilter::SPIKE]);
+  assertEqual(1, verdicts[ThermocoupleFilter::OPEN_CIRCUIT]);
+  assertEqual(1, verdicts[ThermocoupleFilter::RANGE_ERROR]); // 0x7FF8 = 1023.75C
+  assertNear(187.0, accepted, 0.45);
+}
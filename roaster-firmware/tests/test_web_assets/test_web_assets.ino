@@ -0,0 +1,102 @@
+/**
+ * Web Asset Tests
+ *
+ * Tests for the gzipped web UIs served from flash including:
+ * - Every page is a gzip stream with a quoted, content-derived ETag
+ * - Pages keep distinct paths and ETags
+ * - If-None-Match lists, weak tags and "*" match as browsers send them
+ * - Other tags, partial tags and a missing header do not match
+ */
+
+#include <AUnit.h>
+#include "../../src/network/WebAssetData.hpp"
+
+using namespace aunit;
+
+static const WebAsset *const assets[] = {
+    &WEB_ASSET_CONSOLE,
+    &WEB_ASSET_PID,
+    &WEB_ASSET_PROFILE,
+    &WEB_ASSET_SYSTEMLINK,
+};
+static const size_t assetCount = sizeof(assets) / sizeof(assets[0]);
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Asset Tests
+// ============================================================================
+
+test(WebAssets_PagesAreGzipStreams)
+{
+  for (size_t i = 0; i < assetCount; i++)
+  {
+    const WebAsset &asset = *assets[i];
+    assertTrue(asset.length > 18);
+    // Magic, deflate, then the zeroed mtime that keeps builds reproducible
+    assertEqual((int)0x1f, (int)asset.data[0]);
+    assertEqual((int)0x8b, (int)asset.data[1]);
+    assertEqual((int)0x08, (int)asset.data[2]);
+    assertEqual((int)0, (int)(asset.data[4] | asset.data[5] | asset.data[6] | asset.data[7]));
+    assertEqual(String("text/html"), String(asset.contentType));
+  }
+}
+
+test(WebAssets_ETagsAreQuotedHashes)
+{
+  for (size_t i = 0; i < assetCount; i++)
+  {
+    const char *etag = assets[i]->etag;
+    assertEqual((size_t)18, strlen(etag));
+    assertEqual('"', etag[0]);
+    assertEqual('"', etag[17]);
+    for (size_t c = 1; c < 17; c++)
+    {
+      assertTrue(isxdigit(static_cast<unsigned char>(etag[c])) != 0);
+    }
+    for (size_t j = i + 1; j < assetCount; j++)
+    {
+      assertTrue(strcmp(etag, assets[j]->etag) != 0);
+      assertTrue(strcmp(assets[i]->path, assets[j]->path) != 0);
+    }
+  }
+}
+
+// ============================================================================
+// If-None-Match Tests
+// ============================================================================
+
+test(WebAssets_IfNoneMatchAcceptsWhatBrowsersSend)
+{
+  const char *etag = "\"0123456789abcdef\"";
+  assertTrue(webAssetETagMatches("\"0123456789abcdef\"", etag));
+  assertTrue(webAssetETagMatches("W/\"0123456789abcdef\"", etag));
+  assertTrue(webAssetETagMatches("\"aaaa\", \"0123456789abcdef\"", etag));
+  assertTrue(webAssetETagMatches("\"aaaa\",W/\"0123456789abcdef\" ", etag));
+  assertTrue(webAssetETagMatches("*", etag));
+  assertTrue(webAssetETagMatches(" * ", etag));
+}
+
+test(WebAssets_IfNoneMatchRejectsOtherTags)
+{
+  const char *etag = "\"0123456789abcdef\"";
+  assertFalse(webAssetETagMatches(nullptr, etag));
+  assertFalse(webAssetETagMatches("", etag));
+  assertFalse(webAssetETagMatches("\"0123456789abcde0\"", etag));
+  assertFalse(webAssetETagMatches("\"0123456789abcdef", etag));
+  assertFalse(webAssetETagMatches("0123456789abcdef", etag));
+  assertFalse(webAssetETagMatches("\"0123456789abcdef\"x", etag));
+  assertFalse(webAssetETagMatches("\"aaaa\", \"bbbb\"", etag));
+  assertFalse(webAssetETagMatches("**", etag));
+}
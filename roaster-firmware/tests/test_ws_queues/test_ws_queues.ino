@@ -0,0 +1,233 @@
+/**
+ * WebSocket Client Queue Tests
+ *
+ * Tests for the bounded per-client queues in front of AsyncWebSocket
+ * including:
+ * - A newer periodic frame replaces the unsent one and counts a drop
+ * - Events are kept in order and go out before periodic frames
+ * - A client with a full event queue is refused rather than losing one
+ * - Frames held for a client are released when it disconnects
+ * - Entries a broadcast adds after the disconnect are pruned
+ * - Clients registered on connect are listed until they disconnect
+ * - A slow client never holds more than one frame per kind
+ */
+
+#include <AUnit.h>
+#include "../../src/network/WsClientQueues.hpp"
+
+using namespace aunit;
+
+static SharedFrameBuffer::Frame makeFrame(const char *text)
+{
+  return std::make_shared<std::vector<uint8_t>>(text, text + strlen(text));
+}
+
+static String frameText(const WsClientQueues::Message &message)
+{
+  return String(std::string(message.frame->begin(), message.frame->end()).c_str());
+}
+
+static WsClientQueues::ClientStats statsFor(WsClientQueues &queues, uint32_t clientId)
+{
+  WsClientQueues::ClientStats stats[WsClientQueues::MAX_CLIENTS];
+  size_t count = queues.snapshot(stats);
+  for (size_t i = 0; i < count; i++)
+  {
+    if (stats[i].clientId == clientId)
+      return stats[i];
+  }
+  return WsClientQueues::ClientStats{};
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  while (!Serial)
+    ;
+  delay(1000);
+}
+
+void loop()
+{
+  TestRunner::run();
+}
+
+// ============================================================================
+// Coalescing Tests
+// ============================================================================
+
+test(WsQueues_LatestFrameReplacesUnsentOne)
+{
+  WsClientQueues queues;
+  assertFalse(queues.offerLatest(1, WS_FRAME_STATE, makeFrame("state 1")));
+  assertTrue(queues.offerLatest(1, WS_FRAME_STATE, makeFrame("state 2")));
+  assertTrue(queues.offerLatest(1, WS_FRAME_STATE, makeFrame("state 3")));
+
+  WsClientQueues::Message message;
+  assertTrue(queues.pop(1, message));
+  assertEqual(String("state 3"), frameText(message));
+  assertFalse(queues.pop(1, message));
+
+  WsClientQueues::ClientStats stats = statsFor(queues, 1);
+  assertEqual((uint32_t)2, stats.dropped);
+  assertEqual((uint32_t)1, stats.sent);
+  assertEqual((uint8_t)0, stats.pending);
+}
+
+test(WsQueues_KindsAreQueuedSeparately)
+{
+  WsClientQueues queues;
+  queues.offerLatest(7, WS_FRAME_LOGS, makeFrame("logs"));
+  queues.offerLatest(7, WS_FRAME_TELEMETRY, makeFrame("\xa2"), true);
+  queues.offerLatest(7, WS_FRAME_STATE, makeFrame("state"));
+  assertTrue(queues.hasPending(7, WS_FRAME_LOGS));
+  assertFalse(queues.hasPending(7, WS_FRAME_ARTISAN));
+  assertFalse(queues.hasPending(8, WS_FRAME_LOGS));
+
+  WsClientQueues::Message message;
+  assertTrue(queues.pop(7, message));
+  assertEqual(String("state"), frameText(message));
+  assertTrue(queues.pop(7, message));
+  assertTrue(message.binary);
+  assertTrue(queues.pop(7, message));
+  assertEqual(String("logs"), frameText(message));
+  assertFalse(message.binary);
+  assertFalse(queues.hasPending(7, WS_FRAME_LOGS));
+}
+
+// ============================================================================
+// Event Tests
+// ============================================================================
+
+test(WsQueues_EventsGoFirstAndInOrder)
+{
+  WsClientQueues queues;
+  queues.offerLatest(2, WS_FRAME_STATE, makeFrame("state"));
+  assertTrue(queues.offerEvent(2, makeFrame("startRoasting")));
+  assertTrue(queues.offerEvent(2, makeFrame("endRoasting")));
+
+  WsClientQueues::Message message;
+  queues.pop(2, message);
+  assertEqual(String("startRoasting"), frameText(message));
+  queues.pop(2, message);
+  assertEqual(String("endRoasting"), frameText(message));
+  queues.pop(2, message);
+  assertEqual(String("state"), frameText(message));
+  assertEqual((uint32_t)0, statsFor(queues, 2).dropped);
+  assertEqual((uint32_t)2, statsFor(queues, 2).events);
+}
+
+test(WsQueues_FullEventQueueRefusesInsteadOfDropping)
+{
+  WsClientQueues queues;
+  for (size_t i = 0; i < WS_MAX_QUEUED_EVENTS; i++)
+  {
+    char text[16];
+    snprintf(text, sizeof(text), "event %u", (unsigned)i);
+    assertTrue(queues.offerEvent(3, makeFrame(text)));
+  }
+  assertFalse(queues.offerEvent(3, makeFrame("one too many")));
+  assertEqual((uint8_t)WS_MAX_QUEUED_EVENTS, statsFor(queues, 3).pending);
+
+  // Every queued event still comes out, oldest first
+  WsClientQueues::Message message;
+  queues.pop(3, message);
+  assertEqual(String("event 0"), frameText(message));
+  assertTrue(queues.offerEvent(3, makeFrame("event 8")));
+  for (size_t i = 1; i < WS_MAX_QUEUED_EVENTS; i++)
+  {
+    queues.pop(3, message);
+  }
+  queues.pop(3, message);
+  assertEqual(String("event 8"), frameText(message));
+}
+
+// ============================================================================
+// Memory Tests
+// ============================================================================
+
+test(WsQueues_DisconnectReleasesFrames)
+{
+  WsClientQueues queues;
+  SharedFrameBuffer::Frame frame = makeFrame("state");
+  queues.offerLatest(4, WS_FRAME_STATE, frame);
+  queues.offerLatest(5, WS_FRAME_STATE, frame);
+  queues.offerEvent(4, frame);
+  assertEqual(4L, frame.use_count());
+
+  queues.remove(4);
+  assertEqual(2L, frame.use_count());
+  assertEqual((uint8_t)1, statsFor(queues, 5).pending);
+  assertTrue(queues.hasPending(5, WS_FRAME_STATE));
+  assertFalse(queues.hasPending(4, WS_FRAME_STATE));
+}
+
+test(WsQueues_StalledClientHoldsOneFramePerKind)
+{
+  WsClientQueues queues;
+  SharedFrameBuffer stateFrames(256);
+  std::weak_ptr<std::vector<uint8_t>> first;
+  // A day of once-a-second broadcasts to a client that never drains
+  for (int second = 0; second < 86400; second++)
+  {
+    SharedFrameBuffer::Frame frame = stateFrames.acquire();
+    frame->resize(64);
+    queues.offerLatest(6, WS_FRAME_STATE, frame);
+    if (second == 0)
+      first = frame;
+  }
+  WsClientQueues::ClientStats stats = statsFor(queues, 6);
+  assertEqual((uint8_t)1, stats.pending);
+  assertEqual((uint8_t)1, stats.maxPending);
+  assertEqual((uint32_t)86399, stats.dropped);
+  // Replaced frames are freed, not held for the client
+  assertTrue(first.expired());
+}
+
+test(WsQueues_PruneDropsClientsThatAreGone)
+{
+  WsClientQueues queues;
+  SharedFrameBuffer frames(64);
+  SharedFrameBuffer::Frame frame = frames.acquire();
+  queues.offerLatest(7, WS_FRAME_STATE, frame);
+  queues.offerLatest(8, WS_FRAME_STATE, frame);
+  // Client 7's disconnect event ran, then a broadcast offered to it again
+  queues.remove(7);
+  queues.offerLatest(7, WS_FRAME_ARTISAN, frame);
+  // Ours, the buffer's and one per client
+  assertEqual(4L, frame.use_count());
+
+  size_t removed = queues.prune([](uint32_t clientId) { return clientId == 8; });
+  assertEqual((size_t)1, removed);
+  assertFalse(queues.hasPending(7, WS_FRAME_ARTISAN));
+  assertTrue(queues.hasPending(8, WS_FRAME_STATE));
+  assertEqual(3L, frame.use_count());
+
+  WsClientQueues::ClientStats stats[WsClientQueues::MAX_CLIENTS];
+  assertEqual((size_t)1, queues.snapshot(stats));
+  assertEqual((size_t)0, queues.prune([](uint32_t) { return true; }));
+}
+
+test(WsQueues_ConnectedClientsAreListedUntilRemoved)
+{
+  WsClientQueues queues;
+  for (uint32_t id = 1; id <= WsClientQueues::MAX_CLIENTS; id++)
+  {
+    assertTrue(queues.add(id));
+  }
+  // Registering twice keeps one slot, and a client past the limit is refused
+  assertTrue(queues.add(3));
+  assertFalse(queues.add(100));
+
+  uint32_t ids[WsClientQueues::MAX_CLIENTS];
+  assertEqual(WsClientQueues::MAX_CLIENTS, queues.clientIds(ids));
+
+  queues.remove(3);
+  size_t count = queues.clientIds(ids);
+  assertEqual(WsClientQueues::MAX_CLIENTS - 1, count);
+  for (size_t i = 0; i < count; i++)
+  {
+    assertNotEqual((uint32_t)3, ids[i]);
+  }
+  assertTrue(queues.add(100));
+}
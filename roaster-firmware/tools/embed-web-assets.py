@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""Gzip the embedded web UIs into src/network/WebAssetData.hpp.
+
+Each page in web/ becomes a PROGMEM byte array that the firmware serves as
+is with Content-Encoding: gzip, plus a strong ETag taken from a hash of the
+page so browsers can revalidate with If-None-Match and get a 304. The output
+is deterministic (no gzip timestamp), so regenerating an unchanged page
+leaves the header untouched.
+
+Usage:
+  ./tools/embed-web-assets.py          Regenerate the header
+  ./tools/embed-web-assets.py --check  Exit 1 if the header is out of date
+"""
+
+import argparse
+import gzip
+import hashlib
+import sys
+from pathlib import Path
+
+FIRMWARE_DIR = Path(__file__).resolve().parent.parent
+WEB_DIR = FIRMWARE_DIR / "web"
+OUTPUT = FIRMWARE_DIR / "src" / "network" / "WebAssetData.hpp"
+
+# (source file, C++ name, URL path)
+ASSETS = [
+    ("console.html", "WEB_ASSET_CONSOLE", "/console"),
+    ("pid.html", "WEB_ASSET_PID", "/pid"),
+    ("profile.html", "WEB_ASSET_PROFILE", "/profile"),
+    ("systemlink.html", "WEB_ASSET_SYSTEMLINK", "/systemlink"),
+]
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".js": "application/javascript",
+    ".css": "text/css",
+}
+
+BYTES_PER_LINE = 20
+
+
+def render() -> str:
+    lines = [
+        "// Generated by tools/embed-web-assets.py from web/. Do not edit;",
+        "// change the page and rerun the script (./tools/firmware.sh build does).",
+        "",
+        "#ifndef WEB_ASSET_DATA_HPP",
+        "#define WEB_ASSET_DATA_HPP",
+        "",
+        '#include "WebAssets.hpp"',
+        "",
+    ]
+    total_source = 0
+    total_gzip = 0
+    for file_name, symbol, path in ASSETS:
+        source = (WEB_DIR / file_name).read_bytes()
+        compressed = gzip.compress(source, compresslevel=9, mtime=0)
+        etag = '"' + hashlib.sha256(source).hexdigest()[:16] + '"'
+        content_type = CONTENT_TYPES[Path(file_name).suffix]
+        total_source += len(source)
+        total_gzip += len(compressed)
+
+        lines.append(f"// web/{file_name}: {len(source)} bytes, {len(compressed)} gzipped")
+        lines.append(f"static const uint8_t {symbol}_GZ[] PROGMEM = {{")
+        for offset in range(0, len(compressed), BYTES_PER_LINE):
+            chunk = compressed[offset:offset + BYTES_PER_LINE]
+            lines.append("  " + ", ".join(f"0x{byte:02x}" for byte in chunk) + ",")
+        lines.append("};")
+        etag_literal = etag.replace('"', '\\"')
+        lines.append(
+            f'static const WebAsset {symbol} = {{"{path}", "{content_type}", '
+            f'{symbol}_GZ, sizeof({symbol}_GZ), "{etag_literal}"}};'
+        )
+        lines.append("")
+
+    lines.append(f"// {total_source} bytes of pages in {total_gzip} bytes of flash")
+    lines.append("")
+    lines.append("#endif // WEB_ASSET_DATA_HPP")
+    lines.append("")
+    return "\n".join(lines)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true", help="fail if the header is out of date")
+    args = parser.parse_args()
+
+    rendered = render()
+    current = OUTPUT.read_text() if OUTPUT.exists() else ""
+    if args.check:
+        if rendered != current:
+            print(f"{OUTPUT.relative_to(FIRMWARE_DIR)} is out of date; run tools/embed-web-assets.py",
+                  file=sys.stderr)
+            return 1
+        return 0
+    if rendered != current:
+        OUTPUT.write_text(rendered)
+        print(f"Wrote {OUTPUT.relative_to(FIRMWARE_DIR)}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
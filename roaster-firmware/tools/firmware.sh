@@ -24,6 +24,8 @@ Boards:
 Examples:
   ./tools/firmware.sh build
   ./tools/firmware.sh build --board jc4827w543c
+  ROASTER_PROFILE_STORE=littlefs ./tools/firmware.sh upload
+  ROASTER_ROAST_ARCHIVE=1 ./tools/firmware.sh upload
     OTA_HOST=roaster-dev.local ./tools/firmware.sh ota --board jc4827w543c
 EOF
 }
@@ -0,0 +1,70 @@
+#!/bin/bash
+# Host-native (Linux/macOS) build of the control core, AUnit suites, benchmarks,
+# and the closed-loop roast simulator.
+
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+HOST_DIR="$ROOT_DIR/host"
+BUILD_DIR="${ROASTER_HOST_BUILD_DIR:-$ROOT_DIR/build/host}"
+
+usage() {
+    cat <<'EOF'
+Usage: ./tools/host.sh <command> [args...]
+
+Commands:
+  build     Configure and build the host targets
+  test      Build, then run the AUnit suites and smoke benchmarks with ctest
+  bench     Build, then run the control-core benchmarks (extra args are passed through)
+  state-bench
+            Build, then benchmark the state broadcast and count its heap allocations
+  sim       Build, then simulate roast profiles against the band plant model
+            (defaults to every roast-profiles/*.json; extra args are passed through)
+  help      Show this help
+
+Examples:
+  ./tools/host.sh test
+  ./tools/host.sh bench --csv > bench.csv
+  ./tools/host.sh sim --validation
+EOF
+}
+
+build_host() {
+    cmake -S "$HOST_DIR" -B "$BUILD_DIR" -DCMAKE_BUILD_TYPE=Release
+    cmake --build "$BUILD_DIR" -j"$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 2)"
+}
+
+command_name="${1:-help}"
+if [[ $# -gt 0 ]]; then
+    shift
+fi
+
+case "$command_name" in
+    build)
+        build_host
+        ;;
+    test)
+        build_host
+        ctest --test-dir "$BUILD_DIR" --output-on-failure
+        ;;
+    bench)
+        build_host
+        "$BUILD_DIR/roaster-control-bench" "$@"
+        ;;
+    state-bench)
+        build_host
+        "$BUILD_DIR/roaster-state-bench" "$@"
+        ;;
+    sim)
+        build_host
+        "$BUILD_DIR/roaster-roast-sim" "$@"
+        ;;
+    help|-h|--help)
+        usage
+        ;;
+    *)
+        echo "Unknown command: $command_name" >&2
+        usage >&2
+        exit 1
+        ;;
+esac
@@ -34,6 +34,36 @@ case "$TARGET_BOARD" in
         ;;
 esac
 
+# Profile storage backend (src/profiles/ProfileStore.hpp). LittleFS needs a
+# partition scheme with a filesystem, which no_fs does not have.
+case "${ROASTER_PROFILE_STORE:-nvs}" in
+    nvs)
+        ;;
+    littlefs)
+        BUILD_EXTRA_FLAGS="$BUILD_EXTRA_FLAGS -DROASTER_PROFILE_STORE=ROASTER_PROFILE_STORE_LITTLEFS"
+        BOARD_FQBN="${BOARD_FQBN/PartitionScheme=no_fs/PartitionScheme=default}"
+        ;;
+    *)
+        echo "Unknown ROASTER_PROFILE_STORE: $ROASTER_PROFILE_STORE (nvs or littlefs)" >&2
+        exit 1
+        ;;
+esac
+
+# Roast archive (src/profiles/RoastArchive.hpp). Off by default: it lives on
+# LittleFS too, and a scheme with a filesystem leaves less room for the app.
+case "${ROASTER_ROAST_ARCHIVE:-0}" in
+    0)
+        ;;
+    1)
+        BUILD_EXTRA_FLAGS="$BUILD_EXTRA_FLAGS -DROASTER_ROAST_ARCHIVE=1"
+        BOARD_FQBN="${BOARD_FQBN/PartitionScheme=no_fs/PartitionScheme=default}"
+        ;;
+    *)
+        echo "Unknown ROASTER_ROAST_ARCHIVE: $ROASTER_ROAST_ARCHIVE (0 or 1)" >&2
+        exit 1
+        ;;
+esac
+
 # Colors for output
 RED='\033[0;31m'
 GREEN='\033[0;32m'
@@ -102,6 +132,11 @@ compile_sketch() {
     print_info "Target board: $TARGET_BOARD ($BOARD_FQBN)"
 
     if [[ "$sketch_name" == "roaster-firmware" ]]; then
+        # Regenerate the gzipped web UIs if a page in web/ changed
+        if ! python3 "$TOOLS_DIR/embed-web-assets.py"; then
+            print_error "Embedding web/ pages failed"
+            return 1
+        fi
         local build_version="${ROASTER_BUILD_VERSION:-$(date +%F)}"
         all_extra_flags="${all_extra_flags:+$all_extra_flags }-DVERSION=\"${build_version}\""
         print_info "Firmware version: $build_version"
@@ -656,8 +691,25 @@ list_tests() {
     echo "  6. unit          - AUnit framework demo tests"
     echo "  7. hardware      - Hardware validation"
     echo "  8. step_response - Step response tuner tests"
+    echo "  9. control_task  - Control task scheduler tests"
+    echo " 10. perf_stats    - Timer latency histogram tests"
+    echo " 11. thermocouple  - Thermocouple acquisition tests"
+    echo " 12. rate_of_rise  - Rate-of-rise estimator tests"
+    echo " 13. mpc           - Model-predictive heater controller tests"
+    echo " 14. smith         - Smith predictor dead-time compensation tests"
+    echo " 15. profile_index - Binary profile id index tests"
+    echo " 16. profile_archive - Streaming tar import/export tests"
+    echo " 17. preferences   - Write-behind preferences journal tests"
+    echo " 18. state_json    - Heap-free state payload and broadcast buffers"
+    echo " 19. telemetry     - Delta telemetry stream and CBOR/MessagePack"
+    echo " 20. debug_log     - Log seq cursors and incremental log stream"
+    echo " 21. artisan       - Artisan getData replies and push mode"
+    echo " 22. ws_queues     - Per-client WebSocket queues and coalescing"
+    echo " 23. web_assets    - Gzipped web UIs and ETag matching"
+    echo " 24. roast_archive - Roast archive format, retention, export"
+    echo " 25. chunked_json  - Streamed calibration and profile responses"
     echo ""
-    echo "Legacy usage: $CLI_NAME [1-8] [compile|upload|monitor|ota|port|all]"
+    echo "Legacy usage: $CLI_NAME [1-25] [compile|upload|monitor|ota|port|all]"
     echo "Example: $CLI_NAME 2 all"
     echo "Example: OTA_HOST=roaster-dev.local $CLI_NAME 1 ota"
 }
@@ -696,6 +748,74 @@ get_sketch_path() {
             echo "$TESTS_DIR/test_step_response/test_step_response.ino"
             echo "Step Response"
             ;;
+        9|control_task)
+            echo "$TESTS_DIR/test_control_task/test_control_task.ino"
+            echo "Control Task"
+            ;;
+        10|perf_stats)
+            echo "$TESTS_DIR/test_perf_stats/test_perf_stats.ino"
+            echo "Perf Stats"
+            ;;
+        11|thermocouple)
+            echo "$TESTS_DIR/test_thermocouple/test_thermocouple.ino"
+            echo "Thermocouple"
+            ;;
+        12|rate_of_rise|ror)
+            echo "$TESTS_DIR/test_rate_of_rise/test_rate_of_rise.ino"
+            echo "Rate of Rise"
+            ;;
+        13|mpc)
+            echo "$TESTS_DIR/test_mpc/test_mpc.ino"
+            echo "MPC"
+            ;;
+        14|smith)
+            echo "$TESTS_DIR/test_smith_predictor/test_smith_predictor.ino"
+            echo "Smith Predictor"
+            ;;
+        15|profile_index)
+            echo "$TESTS_DIR/test_profile_index/test_profile_index.ino"
+            echo "Profile Index"
+            ;;
+        16|profile_archive)
+            echo "$TESTS_DIR/test_profile_archive/test_profile_archive.ino"
+            echo "Profile Archive"
+            ;;
+        17|preferences)
+            echo "$TESTS_DIR/test_preferences_journal/test_preferences_journal.ino"
+            echo "Preferences Journal"
+            ;;
+        18|state_json)
+            echo "$TESTS_DIR/test_state_json/test_state_json.ino"
+            echo "State JSON"
+            ;;
+        19|telemetry)
+            echo "$TESTS_DIR/test_telemetry/test_telemetry.ino"
+            echo "Telemetry"
+            ;;
+        20|debug_log)
+            echo "$TESTS_DIR/test_debug_log/test_debug_log.ino"
+            echo "Debug Log"
+            ;;
+        21|artisan)
+            echo "$TESTS_DIR/test_artisan/test_artisan.ino"
+            echo "Artisan"
+            ;;
+        22|ws_queues)
+            echo "$TESTS_DIR/test_ws_queues/test_ws_queues.ino"
+            echo "WebSocket Queues"
+            ;;
+        23|web_assets)
+            echo "$TESTS_DIR/test_web_assets/test_web_assets.ino"
+            echo "Web Assets"
+            ;;
+        24|roast_archive)
+            echo "$TESTS_DIR/test_roast_archive/test_roast_archive.ino"
+            echo "Roast Archive"
+            ;;
+        25|chunked_json)
+            echo "$TESTS_DIR/test_chunked_json/test_chunked_json.ino"
+            echo "Chunked JSON Tests"
+            ;;
         *)
             echo "INVALID"
             echo "Invalid test"
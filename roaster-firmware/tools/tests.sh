@@ -25,6 +25,23 @@ Suites:
   unit
   hardware
   step-response
+  control-task
+  perf-stats
+  thermocouple
+  ror
+  mpc
+  smith
+  profile_index
+  profile_archive
+  preferences
+  state_json
+  telemetry
+  debug_log
+  artisan
+  ws_queues
+  web_assets
+  roast_archive
+  chunked_json
 
 Boards:
   jc4827w543c
@@ -58,6 +75,57 @@ map_suite() {
         step-response|step_response)
             echo "8"
             ;;
+        control-task|control_task)
+            echo "9"
+            ;;
+        perf-stats|perf_stats|perf)
+            echo "10"
+            ;;
+        thermocouple|thermocouples)
+            echo "11"
+            ;;
+        ror|rate-of-rise|rate_of_rise)
+            echo "12"
+            ;;
+        mpc|model-predictive)
+            echo "13"
+            ;;
+        smith|smith_predictor)
+            echo "14"
+            ;;
+        profile_index|profile_idx)
+            echo "15"
+            ;;
+        profile_archive|archive)
+            echo "16"
+            ;;
+        preferences|journal)
+            echo "17"
+            ;;
+        state_json|state)
+            echo "18"
+            ;;
+        telemetry)
+            echo "19"
+            ;;
+        debug_log|debuglog|logs)
+            echo "20"
+            ;;
+        artisan)
+            echo "21"
+            ;;
+        ws_queues|wsqueues)
+            echo "22"
+            ;;
+        web_assets|webassets)
+            echo "23"
+            ;;
+        roast_archive|roastarchive)
+            echo "24"
+            ;;
+        chunked_json|chunked)
+            echo "25"
+            ;;
         *)
             return 1
             ;;